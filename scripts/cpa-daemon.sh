@@ -0,0 +1,21 @@
+#!/bin/bash
+
+# This file is part of CPAchecker,
+# a tool for configurable software verification:
+# https://cpachecker.sosy-lab.org
+#
+# SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# Start CPAchecker as a daemon that reads verification tasks from stdin,
+# one task per line, and writes one result line per task to stdout.
+# Each line contains the command-line arguments for one run of scripts/cpa.sh
+# (without JVM options like -heap), for example:
+#   -predicateAnalysis -spec default -outputpath output/task1 program.c
+# Lines on stdout that do not start with RESULT or ERROR should be ignored.
+# Arguments given to this script (e.g., -heap) are used for the JVM of the daemon.
+# Cf. the documentation of org.sosy_lab.cpachecker.cmdline.CPADaemon for details.
+
+CPACHECKER_MAIN_CLASS=org.sosy_lab.cpachecker.cmdline.CPADaemon \
+  exec "$(dirname "$0")/cpa.sh" "$@"
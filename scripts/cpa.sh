@@ -11,6 +11,9 @@
 # the location of the java command
 [ -z "$JAVA" ] && JAVA=java
 
+# the main class of CPAchecker (scripts/cpa-daemon.sh uses a different one)
+[ -z "$CPACHECKER_MAIN_CLASS" ] && CPACHECKER_MAIN_CLASS=org.sosy_lab.cpachecker.cmdline.CPAMain
+
 # the default heap and stack sizes of the Java VM
 DEFAULT_HEAP_SIZE="1200M"
 DEFAULT_STACK_SIZE="1024k"
@@ -64,7 +67,17 @@ if [ ! -e "$PATH_TO_CPACHECKER/bin/org/sosy_lab/cpachecker/cmdline/CPAMain.class
   fi
 fi
 
-export CLASSPATH="$CLASSPATH:$PATH_TO_CPACHECKER/bin:$PATH_TO_CPACHECKER/cpachecker.jar:$PATH_TO_CPACHECKER/lib/*:$PATH_TO_CPACHECKER/lib/java/runtime/*"
+# Use the AppCDS archive from scripts/create-cds-archive.sh if it is up to date.
+# The archive only works with the JAR files in exactly the order used for creating it,
+# so we cannot use the classes in bin/ and need to check that they are not newer.
+CDS_ARCHIVE="$PATH_TO_CPACHECKER/cpachecker.jsa"
+if [ -e "$CDS_ARCHIVE" ] && [ "$CDS_ARCHIVE" -nt "$PATH_TO_CPACHECKER/cpachecker.jar" ] \
+    && [ -z "$(find "$PATH_TO_CPACHECKER/bin" -name '*.class' -newer "$CDS_ARCHIVE" -print -quit 2>/dev/null)" ]; then
+  export CLASSPATH="$PATH_TO_CPACHECKER/cpachecker.jar:$PATH_TO_CPACHECKER/lib/*:$PATH_TO_CPACHECKER/lib/java/runtime/*${CLASSPATH:+:$CLASSPATH}"
+  JAVA_VM_ARGUMENTS="-Xshare:auto -XX:SharedArchiveFile=$CDS_ARCHIVE $JAVA_VM_ARGUMENTS"
+else
+  export CLASSPATH="$CLASSPATH:$PATH_TO_CPACHECKER/bin:$PATH_TO_CPACHECKER/cpachecker.jar:$PATH_TO_CPACHECKER/lib/*:$PATH_TO_CPACHECKER/lib/java/runtime/*"
+fi
 
 # loop over all input parameters and parse them
 declare -a OPTIONS
@@ -162,6 +175,6 @@ exec "$JAVA" \
     -Xss${JAVA_STACK_SIZE} \
     -Xmx${JAVA_HEAP_SIZE} \
     $JAVA_ASSERTIONS \
-    org.sosy_lab.cpachecker.cmdline.CPAMain \
+    "$CPACHECKER_MAIN_CLASS" \
     "${OPTIONS[@]}" \
     $CPACHECKER_ARGUMENTS
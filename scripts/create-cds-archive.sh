@@ -0,0 +1,63 @@
+#!/bin/bash
+
+# This file is part of CPAchecker,
+# a tool for configurable software verification:
+# https://cpachecker.sosy-lab.org
+#
+# SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# the location of the java command
+[ -z "$JAVA" ] && JAVA=java
+# Create an AppCDS archive (cpachecker.jsa) with the classes that are loaded
+# by typical analyses. scripts/cpa.sh uses this archive automatically,
+# which reduces the startup time of the JVM considerably.
+# This needs cpachecker.jar (run "ant jar" first, or simply "ant cds-archive").
+#
+# Usage: scripts/create-cds-archive.sh [PROGRAM [CONFIG ...]]
+# The classes are collected by analyzing PROGRAM (default: doc/examples/example.c)
+# once with each of the given configurations (default: -predicateAnalysis -valueAnalysis).
+
+set -e
+
+[ -z "$JAVA" ] && JAVA=java
+
+SCRIPT="$(readlink -f "$0")"
+PATH_TO_CPACHECKER="$(readlink -f "$(dirname "$SCRIPT")/..")"
+cd "$PATH_TO_CPACHECKER"
+
+if [ ! -e cpachecker.jar ]; then
+  echo "cpachecker.jar not found, please run \"ant jar\" first." 1>&2
+  exit 1
+fi
+
+PROGRAM="${1:-doc/examples/example.c}"
+[ $# -gt 0 ] && shift
+if [ $# -gt 0 ]; then
+  CONFIGS=("$@")
+else
+  CONFIGS=(-predicateAnalysis -valueAnalysis)
+fi
+
+# This needs to be exactly the same class path as in scripts/cpa.sh,
+# otherwise the JVM silently ignores the archive.
+CDS_CLASSPATH="$PATH_TO_CPACHECKER/cpachecker.jar:$PATH_TO_CPACHECKER/lib/*:$PATH_TO_CPACHECKER/lib/java/runtime/*"
+
+OUTPUT="$(mktemp -d)"
+trap 'rm -rf "$OUTPUT"' EXIT
+
+rm -f cpachecker.jsa
+for CONFIG in "${CONFIGS[@]}"; do
+  echo "Collecting classes used by $CONFIG ..."
+  JAVA_VM_ARGUMENTS="-XX:DumpLoadedClassList=$OUTPUT/classes$CONFIG.lst" \
+    scripts/cpa.sh "$CONFIG" -outputpath "$OUTPUT/output" -disable-java-assertions \
+    "$PROGRAM" > "$OUTPUT/log$CONFIG.txt"
+done
+cat "$OUTPUT"/classes*.lst | sort -u > "$OUTPUT/classes.lst"
+
+echo "Creating archive cpachecker.jsa ..."
+"$JAVA" -Xshare:dump \
+  -XX:SharedClassListFile="$OUTPUT/classes.lst" \
+  -XX:SharedArchiveFile="$PATH_TO_CPACHECKER/cpachecker.jsa" \
+  -cp "$CDS_CLASSPATH"
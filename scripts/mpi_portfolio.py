@@ -21,9 +21,10 @@ import socket
 import subprocess
 import sys
 import threading
+import zlib
 
 # MPI message tags
-tags = Enum("Status", "READY DONE")
+tags = Enum("Status", "READY DONE PREDICATES")
 
 results = Enum("Status", "SUCCESS UNKNOWN EXCEPTION")
 
@@ -36,6 +37,13 @@ LOGFILE = "logfile"
 
 SUBANALYSIS_RESULT = "subanalysis_result"
 
+# predicates exported by inconclusive subanalyses and shared with the other ranks
+SHARE_PREDICATES = "share_predicates"
+PREDICATE_MAP_FILE = "predmap.txt"
+SHARED_PREDICATES_DIR = "shared-predicates"
+PREDICATES_DATA = "predicates"
+INITIAL_PREDICATES_OPTION = "cpa.predicate.abstraction.initialPredicates"
+
 logger = None
 mpi = None
 
@@ -60,7 +68,15 @@ class MPIMain:
 
     main_node_network_config = None
 
+    share_predicates = False
+    received_predicates = None
+    received_predicates_lock = None
+    pending_requests = None
+
     def __init__(self, argv):
+        self.pending_requests = []
+        self.received_predicates = {}
+        self.received_predicates_lock = threading.Lock()
         self.setup_mpi()
         self.setup_logger()
         self.parse_input_args(argv)
@@ -136,6 +152,7 @@ class MPIMain:
 
         logger.debug("Input of user args: %s", str(argv))
 
+        self.share_predicates = bool(self.input_args.get(SHARE_PREDICATES, False))
         self.main_node_network_config = self.input_args.get("network_settings")
         if self.main_node_network_config is not None:
             main_node_ip = self.main_node_network_config.get("main_node_ipv4_address")
@@ -190,10 +207,13 @@ class MPIMain:
                     self.rank,
                     source,
                     tags(tag).name,
-                    data,
+                    data if tag != tags.PREDICATES.value else "<predicate map>",
                 )
 
-                if isinstance(data, dict):
+                if isinstance(data, dict) and tag == tags.PREDICATES.value:
+                    with self.received_predicates_lock:
+                        self.received_predicates[source] = data.get(PREDICATES_DATA)
+                elif isinstance(data, dict):
                     result = data.get(SUBANALYSIS_RESULT)
                     # only shut this process down if another subanalysis reported
                     # a TRUE or FALSE result.
@@ -237,6 +257,46 @@ class MPIMain:
         self.interrupt_mpi_listener()
         self.mpi_listener_thread.join()
 
+    def publish_predicates(self):
+        """
+        Send the predicate map that the finished subanalysis exported to all other ranks,
+        such that they can use the predicates if their own analysis is inconclusive.
+        The predicate map is sent in compressed form.
+        """
+        predmap = os.path.join(self.analysis_param[OUTPUT_PATH], PREDICATE_MAP_FILE)
+        if not os.path.isfile(predmap):
+            logger.debug("No predicate map found in %s", predmap)
+            return
+        with open(predmap, "rb") as f:
+            data = {PREDICATES_DATA: zlib.compress(f.read())}
+        logger.info("SENDING: Process %d broadcasts its predicates", self.rank)
+        # Ranks that have already finished do not receive anymore, so a blocking send of
+        # the (potentially large) predicate map could wait forever.
+        for i in range(0, self.size):
+            if self.rank != i:
+                self.pending_requests.append(
+                    self.comm.isend(data, dest=i, tag=tags.PREDICATES.value)
+                )
+
+    def write_received_predicates(self):
+        """
+        Write the predicate maps received from other ranks into the output directory
+        and return the paths of the written files.
+        """
+        with self.received_predicates_lock:
+            received = dict(self.received_predicates)
+        if not received:
+            return []
+        shared_dir = os.path.join(self.analysis_param[OUTPUT_PATH], SHARED_PREDICATES_DIR)
+        os.makedirs(shared_dir, exist_ok=True)
+        files = []
+        for source, data in sorted(received.items()):
+            path = os.path.join(shared_dir, "predmap-rank{}.txt".format(source))
+            with open(path, "wb") as f:
+                f.write(zlib.decompress(data))
+            files.append(path)
+        return files
+
     def interrupt_mpi_listener(self):
         self.event_listener.set()
 
@@ -276,30 +336,60 @@ class MPIMain:
             if not os.path.isdir(self.analysis_param[OUTPUT_PATH]):
                 os.makedirs(self.analysis_param[OUTPUT_PATH])
 
-            logger.info("Executing cmd: %s", cmdline)
-            with open(self.analysis_param[LOGFILE], "w+", buffering=1) as outputfile:
-                with subprocess.Popen(
-                    cmdline,
-                    stdout=subprocess.PIPE,
-                    stderr=subprocess.STDOUT,
-                    universal_newlines=True,
-                ) as self.process:
-
-                    try:
-                        proc_stdout, _ = self.process.communicate()
-                    except KeyboardInterrupt:
-                        mpi.interrupt_mpi_listener()
-
-                    if proc_stdout is not None:
-                        outputfile.write(proc_stdout)
-                        proc_output = proc_stdout.split("\n")
-
-            logger.info("Process returned with status code %d", self.process.returncode)
+            proc_output = self.run_subprocess(cmdline)
+            subanalysis_result = self.parse_data(proc_output)[SUBANALYSIS_RESULT]
+            if (
+                self.share_predicates
+                and not self.shutdown_requested
+                and subanalysis_result != results.SUCCESS.name
+            ):
+                # let the other ranks benefit from the predicates of this analysis,
+                # and retry once with the predicates the other ranks have shared so far
+                self.publish_predicates()
+                predicate_files = self.write_received_predicates()
+                if predicate_files and not self.shutdown_requested:
+                    logger.info(
+                        "Restarting the analysis with the predicates of %d other ranks",
+                        len(predicate_files),
+                    )
+                    proc_output = self.run_subprocess(
+                        cmdline
+                        + [
+                            "-setprop",
+                            "{}={}".format(
+                                INITIAL_PREDICATES_OPTION, ",".join(predicate_files)
+                            ),
+                        ]
+                    )
+
             if not self.shutdown_requested:
                 self.shutdown_requested = True
                 self.publish_completion_of_subprocess(proc_output)
                 logger.debug("Rank %d is about to shut itself down", self.rank)
 
+    def run_subprocess(self, cmdline):
+        proc_output = []
+        logger.info("Executing cmd: %s", cmdline)
+        with open(self.analysis_param[LOGFILE], "w+", buffering=1) as outputfile:
+            with subprocess.Popen(
+                cmdline,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.STDOUT,
+                universal_newlines=True,
+            ) as self.process:
+
+                try:
+                    proc_stdout, _ = self.process.communicate()
+                except KeyboardInterrupt:
+                    mpi.interrupt_mpi_listener()
+
+                if proc_stdout is not None:
+                    outputfile.write(proc_stdout)
+                    proc_output = proc_stdout.split("\n")
+
+        logger.info("Process returned with status code %d", self.process.returncode)
+        return proc_output
+
     def prepare_cmdline(self):
         logger.debug("Running analysis with number: %d", self.rank)
         analysis_args = None
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+
+# This file is part of CPAchecker,
+# a tool for configurable software verification:
+# https://cpachecker.sosy-lab.org
+#
+# SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Record the per-phase times of benchmark results in a history file
+and report performance regressions compared to previous entries.
+
+The input are BenchExec result files (e.g., for test/test-sets/performance.xml),
+the history is a file with one JSON object per line and entry.
+"""
+
+import argparse
+import bz2
+import gzip
+import json
+import statistics
+import sys
+import xml.etree.ElementTree as ET
+from collections import defaultdict
+
+# Columns that are always present in BenchExec results
+DEFAULT_COLUMNS = ["cputime", "walltime"]
+
+
+def parse_seconds(value):
+    """Parse a time value like "1.23s" or "1.23" into seconds, None if not a time."""
+    if value is None:
+        return None
+    value = value.strip()
+    if value.endswith("s"):
+        value = value[:-1]
+    try:
+        return float(value)
+    except ValueError:
+        return None
+
+
+def open_result_file(path):
+    if path.endswith(".bz2"):
+        return bz2.open(path)
+    if path.endswith(".gz"):
+        return gzip.open(path)
+    return open(path, "rb")
+
+
+def read_result_file(path):
+    """
+    Read a BenchExec result file and return the name of its run definition
+    and a dict from column title to the sum of this column over all runs.
+    """
+    with open_result_file(path) as f:
+        root = ET.parse(f).getroot()
+    name = root.get("name") or root.get("benchmarkname")
+    totals = defaultdict(float)
+    for run in root.iter("run"):
+        for column in run.iter("column"):
+            seconds = parse_seconds(column.get("value"))
+            if seconds is not None:
+                totals[column.get("title")] += seconds
+        totals["runs"] += 1
+    return name, dict(totals)
+
+
+def read_history(path):
+    try:
+        with open(path) as f:
+            return [json.loads(line) for line in f if line.strip()]
+    except FileNotFoundError:
+        return []
+
+
+def find_regressions(entry, history, threshold, min_difference, window):
+    """
+    Compare the times of the entry with the median of the last entries of the history
+    and return a list of (run definition, column, previous, current) for all
+    columns that got slower by more than the given relative threshold
+    and the given absolute difference.
+    """
+    regressions = []
+    previous_entries = history[-window:]
+    for rundefinition, current_times in sorted(entry["results"].items()):
+        for column, current in sorted(current_times.items()):
+            if column == "runs":
+                continue
+            previous_values = [
+                e["results"][rundefinition][column]
+                for e in previous_entries
+                if column in e["results"].get(rundefinition, {})
+                and e["results"][rundefinition].get("runs")
+                == current_times.get("runs")
+            ]
+            if not previous_values:
+                continue
+            previous = statistics.median(previous_values)
+            if (
+                current - previous > min_difference
+                and current > previous * (1 + threshold)
+            ):
+                regressions.append((rundefinition, column, previous, current))
+    return regressions
+
+
+def main(args=None):
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "results", nargs="+", metavar="RESULT_XML", help="BenchExec result files"
+    )
+    parser.add_argument(
+        "--history", required=True, help="history file with one JSON entry per line"
+    )
+    parser.add_argument(
+        "--revision", required=True, help="revision that the results belong to"
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="relative slowdown that is reported as regression (default: 0.1)",
+    )
+    parser.add_argument(
+        "--min-difference",
+        type=float,
+        default=5.0,
+        help="minimal absolute slowdown in seconds that is reported (default: 5)",
+    )
+    parser.add_argument(
+        "--window",
+        type=int,
+        default=5,
+        help="compare against the median of this many previous entries (default: 5)",
+    )
+    parser.add_argument(
+        "--no-record",
+        action="store_true",
+        help="only check for regressions, do not add the results to the history",
+    )
+    options = parser.parse_args(args)
+
+    results = {}
+    for path in options.results:
+        name, totals = read_result_file(path)
+        results[name] = totals
+    entry = {"revision": options.revision, "results": results}
+
+    history = read_history(options.history)
+    regressions = find_regressions(
+        entry, history, options.threshold, options.min_difference, options.window
+    )
+    for rundefinition, column, previous, current in regressions:
+        print(
+            "Regression in {} for {}: {:.2f}s -> {:.2f}s (+{:.0%})".format(
+                rundefinition, column, previous, current, current / previous - 1
+            )
+        )
+
+    if not options.no_record:
+        with open(options.history, "a") as f:
+            f.write(json.dumps(entry, sort_keys=True) + "\n")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
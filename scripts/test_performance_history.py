@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+
+# This file is part of CPAchecker,
+# a tool for configurable software verification:
+# https://cpachecker.sosy-lab.org
+#
+# SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import unittest
+
+import performance_history
+
+
+def entry(analysis_time, runs=10):
+    return {
+        "revision": "r",
+        "results": {"predicate": {"analysis": analysis_time, "runs": runs}},
+    }
+
+
+class TestPerformanceHistory(unittest.TestCase):
+    def test_parse_seconds(self):
+        self.assertEqual(performance_history.parse_seconds("1.5s"), 1.5)
+        self.assertEqual(performance_history.parse_seconds("2"), 2.0)
+        self.assertIsNone(performance_history.parse_seconds("true"))
+        self.assertIsNone(performance_history.parse_seconds(None))
+
+    def test_regression_found(self):
+        history = [entry(100), entry(102), entry(98)]
+        regressions = performance_history.find_regressions(
+            entry(130), history, threshold=0.1, min_difference=5, window=5
+        )
+        self.assertEqual(regressions, [("predicate", "analysis", 100, 130)])
+
+    def test_small_differences_ignored(self):
+        history = [entry(100), entry(102), entry(98)]
+        self.assertEqual(
+            performance_history.find_regressions(
+                entry(105), history, threshold=0.1, min_difference=5, window=5
+            ),
+            [],
+        )
+        self.assertEqual(
+            performance_history.find_regressions(
+                entry(1.5), [entry(1)], threshold=0.1, min_difference=5, window=5
+            ),
+            [],
+        )
+
+    def test_different_task_sets_not_compared(self):
+        self.assertEqual(
+            performance_history.find_regressions(
+                entry(200, runs=20),
+                [entry(100)],
+                threshold=0.1,
+                min_difference=5,
+                window=5,
+            ),
+            [],
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
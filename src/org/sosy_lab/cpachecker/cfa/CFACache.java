@@ -0,0 +1,156 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static java.nio.charset.StandardCharsets.UTF_8;
+
+import com.google.common.base.Splitter;
+import com.google.common.collect.ImmutableList;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.ObjectInputStream;
+import java.io.ObjectOutputStream;
+import java.io.OutputStream;
+import java.nio.file.AtomicMoveNotSupportedException;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.util.List;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.CPAchecker;
+
+/**
+ * On-disk cache for CFAs that can be shared between several runs of CPAchecker on the same
+ * program.
+ *
+ * <p>The cache is content-addressed: the key of an entry is a hash of the version of CPAchecker,
+ * the content of the source files, and all configuration options that may influence the CFA
+ * (including the machine model). Each entry is stored in its own file, named after the key, that
+ * contains the serialized CFA. As in {@link
+ * org.sosy_lab.cpachecker.cpa.predicate.persistence.PersistentAbstractionCache}, entries are
+ * written to a temporary file first and then atomically moved to their final name, such that
+ * several processes can use the same directory concurrently. Entries that cannot be read (e.g.,
+ * because they were written by an incompatible version) are treated as missing.
+ *
+ * <p>Files that are included by the source files (e.g., headers that are included by the
+ * preprocessor) are not part of the key.
+ */
+final class CFACache {
+
+  private static final String FILE_SUFFIX = ".cfa.ser";
+
+  /** Prefixes of configuration options that are considered to influence the CFA. */
+  private static final ImmutableList<String> RELEVANT_OPTION_PREFIXES =
+      ImmutableList.of(
+          "analysis.", "cfa.", "clang.", "language", "liveVar.", "parser.", "preprocessor.");
+
+  /** Options with the relevant prefixes that only control output and do not influence the CFA. */
+  private static final ImmutableList<String> IRRELEVANT_OPTION_PREFIXES =
+      ImmutableList.of(
+          "cfa.cacheDirectory",
+          "cfa.callgraph.",
+          "cfa.export",
+          "cfa.file",
+          "cfa.pixelGraphicFile",
+          "cfa.serialize");
+
+  private final Path directory;
+  private final LogManager logger;
+
+  CFACache(Path pDirectory, LogManager pLogger) {
+    directory = pDirectory;
+    logger = pLogger;
+  }
+
+  /** Compute the key for the CFA of the given source files with the given configuration. */
+  String computeKey(List<String> pSourceFiles, Configuration pConfig) throws IOException {
+    Hasher hasher = Hashing.sha256().newHasher();
+    hasher.putString(CPAchecker.getPlainVersion(), UTF_8).putChar('\0');
+    for (String option :
+        ImmutableList.sortedCopyOf(
+            Splitter.on('\n').omitEmptyStrings().split(pConfig.asPropertiesString()))) {
+      if (isRelevantOption(option)) {
+        hasher.putString(option, UTF_8).putChar('\0');
+      }
+    }
+    for (String sourceFile : pSourceFiles) {
+      hasher.putString(sourceFile, UTF_8).putChar('\0');
+      hasher.putBytes(Files.readAllBytes(Paths.get(sourceFile))).putChar('\0');
+    }
+    return hasher.hash().toString();
+  }
+
+  private static boolean isRelevantOption(String pOption) {
+    return RELEVANT_OPTION_PREFIXES.stream().anyMatch(pOption::startsWith)
+        && IRRELEVANT_OPTION_PREFIXES.stream().noneMatch(pOption::startsWith);
+  }
+
+  /** Return the CFA stored for the given key, or null if not present. */
+  @Nullable CFA get(String pKey) {
+    Path file = getFile(pKey);
+    try (InputStream inputStream = new BufferedInputStream(Files.newInputStream(file));
+        ObjectInputStream ois = new ObjectInputStream(inputStream)) {
+      return (CFA) ois.readObject();
+    } catch (NoSuchFileException e) {
+      return null;
+    } catch (IOException | ClassNotFoundException | ClassCastException e) {
+      logger.logfDebugException(e, "Ignoring invalid entry %s of CFA cache", file);
+      return null;
+    }
+  }
+
+  /** Store the given CFA for the given key. */
+  void put(String pKey, CFA pCfa) {
+    Path file = getFile(pKey);
+    if (Files.exists(file)) {
+      // content-addressed, so the existing entry is equivalent
+      return;
+    }
+    Path tmpFile = null;
+    try {
+      Files.createDirectories(file.getParent());
+      tmpFile = Files.createTempFile(file.getParent(), pKey, ".tmp");
+      try (OutputStream outputStream = new BufferedOutputStream(Files.newOutputStream(tmpFile));
+          ObjectOutputStream oos = new ObjectOutputStream(outputStream)) {
+        oos.writeObject(pCfa);
+      }
+      try {
+        Files.move(
+            tmpFile, file, StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING);
+      } catch (AtomicMoveNotSupportedException e) {
+        Files.move(tmpFile, file, StandardCopyOption.REPLACE_EXISTING);
+      }
+      tmpFile = null;
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write CFA cache");
+    } finally {
+      if (tmpFile != null) {
+        try {
+          Files.deleteIfExists(tmpFile);
+        } catch (IOException e) {
+          logger.logDebugException(e);
+        }
+      }
+    }
+  }
+
+  private Path getFile(String pKey) {
+    // use subdirectories to avoid too many files in a single directory
+    return directory.resolve(pKey.substring(0, 2)).resolve(pKey + FILE_SUFFIX);
+  }
+}
@@ -0,0 +1,69 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.log.LogManager;
+
+public class CFACacheTest {
+
+  @Rule public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+  private CFACache cache;
+  private Path program;
+
+  @Before
+  public void setUp() throws Exception {
+    cache = new CFACache(tempFolder.newFolder("cache").toPath(), LogManager.createTestLogManager());
+    program = tempFolder.newFile("program.c").toPath();
+    Files.writeString(program, "int main() { return 0; }");
+  }
+
+  private String key(String... pOptions) throws Exception {
+    Configuration.Builder config = Configuration.builder();
+    for (int i = 0; i < pOptions.length; i += 2) {
+      config.setOption(pOptions[i], pOptions[i + 1]);
+    }
+    List<String> files = ImmutableList.of(program.toString());
+    return cache.computeKey(files, config.build());
+  }
+
+  @Test
+  public void testKeyIgnoresUnrelatedOptions() throws Exception {
+    assertThat(key("cpa.predicate.solver", "Z3", "cfa.export", "true")).isEqualTo(key());
+  }
+
+  @Test
+  public void testKeyDependsOnRelevantOptions() throws Exception {
+    assertThat(key("analysis.machineModel", "LINUX64")).isNotEqualTo(key());
+    assertThat(key("cfa.simplifyCfa", "false")).isNotEqualTo(key());
+  }
+
+  @Test
+  public void testKeyDependsOnContent() throws Exception {
+    String key = key();
+    Files.writeString(program, "int main() { return 1; }");
+    assertThat(key()).isNotEqualTo(key);
+  }
+
+  @Test
+  public void testMissingEntry() throws Exception {
+    assertThat(cache.get(key())).isNull();
+  }
+}
@@ -11,6 +11,7 @@ package org.sosy_lab.cpachecker.cfa;
 import com.google.common.base.Preconditions;
 import com.google.common.collect.Iterables;
 import com.google.common.io.MoreFiles;
+import java.io.BufferedOutputStream;
 import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.ObjectOutputStream;
@@ -30,6 +31,7 @@ import java.util.Optional;
 import java.util.Set;
 import java.util.logging.Level;
 import java.util.zip.GZIPOutputStream;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.Concurrency;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
@@ -73,6 +75,9 @@ import org.sosy_lab.cpachecker.cfa.postprocessing.function.ThreadCreateTransform
 import org.sosy_lab.cpachecker.cfa.postprocessing.global.CFACloner;
 import org.sosy_lab.cpachecker.cfa.postprocessing.global.FunctionCallUnwinder;
 import org.sosy_lab.cpachecker.cfa.postprocessing.global.LabelAdder;
+import org.sosy_lab.cpachecker.cfa.postprocessing.global.DeadStoreRemover;
+import org.sosy_lab.cpachecker.cfa.postprocessing.global.LoopAccelerator;
+import org.sosy_lab.cpachecker.cfa.postprocessing.global.UnreachableFunctionRemover;
 import org.sosy_lab.cpachecker.cfa.types.MachineModel;
 import org.sosy_lab.cpachecker.cfa.types.c.CComplexType.ComplexTypeKind;
 import org.sosy_lab.cpachecker.cfa.types.c.CDefaults;
@@ -94,6 +99,7 @@ import org.sosy_lab.cpachecker.util.LoopStructure;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.cwriter.CFAToCTranslator;
 import org.sosy_lab.cpachecker.util.statistics.StatisticsUtils;
+import org.sosy_lab.cpachecker.util.statistics.TraceEvents.CFACreationStageEvent;
 import org.sosy_lab.cpachecker.util.variableclassification.VariableClassification;
 import org.sosy_lab.cpachecker.util.variableclassification.VariableClassificationBuilder;
 
@@ -220,6 +226,19 @@ public class CFACreator {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private Path serializeCfaFile = Paths.get("cfa.ser.gz");
 
+  @Option(
+      secure = true,
+      name = "cfa.cacheDirectory",
+      description =
+          "Directory for a persistent cache of CFAs that can be shared between runs."
+              + " The CFA is looked up by a hash of the source files, the CPAchecker version,"
+              + " and all options that may influence the CFA,"
+              + " and stored after it was created if it was not found."
+              + " Files included by the source files are not part of the hash."
+              + " If set to 'null', no cache is used.")
+  @FileOption(FileOption.Type.OUTPUT_DIRECTORY)
+  private @Nullable Path cfaCacheDirectory = null;
+
   @Option(
     secure = true,
     name = "cfa.pixelGraphicFile",
@@ -271,6 +290,37 @@ public class CFACreator {
               + " is read later on.")
   private boolean findLiveVariables = false;
 
+  @Option(
+      secure = true,
+      name = "cfa.removeUnreachableFunctions",
+      description =
+          "Remove the CFAs of all functions that are never called from the main function"
+              + " directly after parsing, such that no post-processing is done for them."
+              + " Functions whose name is used anywhere in reachable code (e.g., for function"
+              + " pointers) are kept. Only supported for C programs.")
+  private boolean removeUnreachableFunctions = false;
+
+  @Option(
+      secure = true,
+      name = "cfa.removeDeadStores",
+      description =
+          "Replace assignments to local variables that are not live afterwards by blank edges."
+              + " Only assignments whose right-hand side has no side effects and cannot fail"
+              + " are removed. Requires cfa.findLiveVariables and is only supported for C"
+              + " programs.")
+  private boolean removeDeadStores = false;
+
+  @Option(
+      secure = true,
+      name = "cfa.accelerateLoops",
+      description =
+          "Replace the bodies of counting loops, whose branch-free body only adds constants to"
+              + " integer variables and whose condition compares a counter that moves by one"
+              + " with a loop-invariant bound, by the closed form of all remaining iterations."
+              + " Overflows of the variables inside such loops are not preserved. Requires"
+              + " analysis.useLoopStructure and is only supported for C programs.")
+  private boolean accelerateLoops = false;
+
   @Option(
       secure = true,
       name = "cfa.addLabels",
@@ -405,7 +455,10 @@ public class CFACreator {
 
     stats.totalTime.start();
     try {
+      CFACreationStageEvent parseEvent = new CFACreationStageEvent("Parsing");
+      parseEvent.begin();
       ParseResult parseResult = parseToCFAs(program);
+      parseEvent.commit();
       FunctionEntryNode mainFunction = parseResult.getFunctions().get(mainFunctionName);
       assert mainFunction != null : "program lacks main function.";
 
@@ -434,10 +487,28 @@ public class CFACreator {
 
     stats.totalTime.start();
     try {
+      CFACache cache = null;
+      String cacheKey = null;
+      if (cfaCacheDirectory != null) {
+        cache = new CFACache(cfaCacheDirectory, logger);
+        cacheKey = cache.computeKey(sourceFiles, config);
+        CFA cachedCfa = cache.get(cacheKey);
+        if (cachedCfa != null) {
+          logger.log(Level.FINE, "Using CFA from cache entry", cacheKey);
+          if (isExportRequested()) {
+            exportCFAAsync(cachedCfa);
+          }
+          return cachedCfa;
+        }
+      }
+
       // FIRST, parse file(s) and create CFAs for each function
       logger.log(Level.FINE, "Starting parsing of file(s)");
 
+      CFACreationStageEvent parseEvent = new CFACreationStageEvent("Parsing");
+      parseEvent.begin();
       final ParseResult c = parseToCFAs(sourceFiles);
+      parseEvent.commit();
 
       logger.log(Level.FINE, "Parser Finished");
 
@@ -454,7 +525,11 @@ public class CFACreator {
         throw new AssertionError();
       }
 
-      return createCFA(c, mainFunction);
+      CFA cfa = createCFA(c, mainFunction);
+      if (cache != null) {
+        cache.put(cacheKey, cfa);
+      }
+      return cfa;
 
     } finally {
       stats.totalTime.stop();
@@ -464,16 +539,28 @@ public class CFACreator {
   private CFA createCFA(ParseResult pParseResult, FunctionEntryNode pMainFunction) throws InvalidConfigurationException, InterruptedException, ParserException {
 
     FunctionEntryNode mainFunction = pMainFunction;
+    ParseResult parseResult = pParseResult;
 
     assert mainFunction != null;
 
+    if (removeUnreachableFunctions && language == Language.C) {
+      int numberOfFunctions = parseResult.getFunctions().size();
+      parseResult =
+          UnreachableFunctionRemover.removeUnreachableFunctions(parseResult, mainFunction);
+      logger.log(
+          Level.FINE,
+          "Removed",
+          numberOfFunctions - parseResult.getFunctions().size(),
+          "unreachable functions.");
+    }
+
     MutableCFA cfa =
         new MutableCFA(
             machineModel,
-            pParseResult.getFunctions(),
-            pParseResult.getCFANodes(),
+            parseResult.getFunctions(),
+            parseResult.getCFANodes(),
             mainFunction,
-            pParseResult.getFileNames(),
+            parseResult.getFileNames(),
             language);
 
     stats.checkTime.start();
@@ -487,8 +574,10 @@ public class CFACreator {
 
     // SECOND, do those post-processings that change the CFA by adding/removing nodes/edges
     stats.processingTime.start();
+    CFACreationStageEvent processingEvent = new CFACreationStageEvent("Post-processing");
+    processingEvent.begin();
 
-    cfa = postProcessingOnMutableCFAs(cfa, pParseResult.getGlobalDeclarations());
+    cfa = postProcessingOnMutableCFAs(cfa, parseResult.getGlobalDeclarations());
 
     // Check CFA again after post-processings
     stats.checkTime.start();
@@ -503,7 +592,8 @@ public class CFACreator {
     // Annotate CFA nodes with reverse postorder information for later use.
     for (FunctionEntryNode function : cfa.getAllFunctionHeads()) {
       CFAReversePostorder sorter = new CFAReversePostorder();
-      sorter.assignSorting(function);
+      sorter.assignSorting(
+          CFAEdgeIndex.of(cfa.getFunctionNodes(function.getFunctionName())), function);
     }
 
     // get loop information
@@ -512,6 +602,22 @@ public class CFACreator {
       addLoopStructure(cfa);
     }
 
+    // summarize counting loops (needs loop structure and changes it)
+    if (accelerateLoops && language == Language.C && cfa.getLoopStructure().isPresent()) {
+      int accelerated =
+          LoopAccelerator.accelerateLoops(cfa, cfa.getLoopStructure().orElseThrow(), logger);
+      logger.log(Level.FINER, "Accelerated", accelerated, "loops in CFA.");
+      if (accelerated > 0) {
+        // Re-compute postorder ids and loops to include the nodes of the loop summaries
+        for (FunctionEntryNode function : cfa.getAllFunctionHeads()) {
+          CFAReversePostorder sorter = new CFAReversePostorder();
+          sorter.assignSorting(
+              CFAEdgeIndex.of(cfa.getFunctionNodes(function.getFunctionName())), function);
+        }
+        addLoopStructure(cfa);
+      }
+    }
+
     // instrument the cfa, if any configuration regarding that is set (needs loop structure)
     instrumentCfa(cfa);
 
@@ -549,11 +655,17 @@ public class CFACreator {
     if (findLiveVariables &&
         (varClassification.isPresent() || cfa.getLanguage() != Language.C)) {
       cfa.setLiveVariables(LiveVariables.create(varClassification,
-                                                pParseResult.getGlobalDeclarations(),
+                                                parseResult.getGlobalDeclarations(),
                                                 cfa, logger, shutdownNotifier,
                                                 config));
     }
 
+    if (removeDeadStores && language == Language.C && cfa.getLiveVariables().isPresent()) {
+      int removed = DeadStoreRemover.removeDeadStores(cfa, cfa.getLiveVariables().orElseThrow());
+      logger.log(Level.FINER, "Removed", removed, "dead stores from CFA.");
+    }
+
+    processingEvent.commit();
     stats.processingTime.stop();
 
     final ImmutableCFA immutableCFA = cfa.makeImmutableCFA(varClassification);
@@ -563,12 +675,7 @@ public class CFACreator {
     assert CFACheck.check(mainFunction, null, machineModel);
     stats.checkTime.stop();
 
-    if (((exportCfaFile != null) && (exportCfa || exportCfaPerFunction))
-        || ((exportFunctionCallsFile != null) && exportFunctionCalls)
-        || ((exportFunctionCallsUsedFile != null) && exportFunctionCalls)
-        || ((serializeCfaFile != null) && serializeCfa)
-        || (exportCfaPixelFile != null)
-        || (exportCfaToCFile != null && exportCfaToC)) {
+    if (isExportRequested()) {
       exportCFAAsync(immutableCFA);
     }
 
@@ -588,7 +695,8 @@ public class CFACreator {
       // Re-compute postorder ids to include newly added label nodes
       for (FunctionEntryNode function : pCfa.getAllFunctionHeads()) {
         CFAReversePostorder sorter = new CFAReversePostorder();
-        sorter.assignSorting(function);
+        sorter.assignSorting(
+            CFAEdgeIndex.of(pCfa.getFunctionNodes(function.getFunctionName())), function);
       }
     }
   }
@@ -663,7 +771,7 @@ public class CFACreator {
    */
   private MutableCFA postProcessingOnMutableCFAs(
       MutableCFA cfa, final List<Pair<ADeclaration, String>> globalDeclarations)
-      throws InvalidConfigurationException, CParserException {
+      throws InvalidConfigurationException, CParserException, InterruptedException {
     // remove all edges which don't have any effect on the program
     if (simplifyCfa) {
       CFASimplifier.simplifyCFA(cfa);
@@ -686,7 +794,9 @@ public class CFACreator {
 
     // add function pointer edges
     if (language == Language.C && fptrCallEdges) {
-      CFunctionPointerResolver fptrResolver = new CFunctionPointerResolver(cfa, globalDeclarations, config, logger);
+      CFunctionPointerResolver fptrResolver =
+          new CFunctionPointerResolver(
+              cfa, globalDeclarations, config, logger, shutdownNotifier);
       fptrResolver.resolveFunctionPointers();
       fptrResolver.collectStatistics(stats.statisticsCollection);
     }
@@ -977,6 +1087,15 @@ v.addInitializer(initializer);
     }
   }
 
+  private boolean isExportRequested() {
+    return ((exportCfaFile != null) && (exportCfa || exportCfaPerFunction))
+        || ((exportFunctionCallsFile != null) && exportFunctionCalls)
+        || ((exportFunctionCallsUsedFile != null) && exportFunctionCalls)
+        || ((serializeCfaFile != null) && serializeCfa)
+        || (exportCfaPixelFile != null)
+        || (exportCfaToCFile != null && exportCfaToC);
+  }
+
   private void exportCFAAsync(final CFA cfa) {
     // Execute asynchronously, this may take several seconds for large programs on slow disks.
     // This is safe because we don't modify the CFA from this point on.
@@ -985,6 +1104,8 @@ v.addInitializer(initializer);
 
   private void exportCFA(final CFA cfa) {
     stats.exportTime.start();
+    CFACreationStageEvent exportEvent = new CFACreationStageEvent("Export");
+    exportEvent.begin();
 
     // write CFA to file
     if (exportCfa && exportCfaFile != null) {
@@ -1040,7 +1161,8 @@ v.addInitializer(initializer);
     if (serializeCfa && serializeCfaFile != null) {
       try {
         MoreFiles.createParentDirectories(serializeCfaFile);
-        try (OutputStream outputStream = Files.newOutputStream(serializeCfaFile);
+        try (OutputStream outputStream =
+                new BufferedOutputStream(Files.newOutputStream(serializeCfaFile));
             OutputStream gzipOutputStream = new GZIPOutputStream(outputStream);
             ObjectOutputStream oos = new ObjectOutputStream(gzipOutputStream)) {
           oos.writeObject(cfa);
@@ -1061,6 +1183,7 @@ v.addInitializer(initializer);
       }
     }
 
+    exportEvent.commit();
     stats.exportTime.stop();
   }
 
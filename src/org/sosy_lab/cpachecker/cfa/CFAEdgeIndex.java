@@ -0,0 +1,150 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static com.google.common.base.Preconditions.checkArgument;
+
+import com.google.common.collect.ImmutableList;
+import java.util.Collection;
+import java.util.HashMap;
+import java.util.Map;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+
+/**
+ * Immutable, array-based index of the edges between a fixed set of CFA nodes, in the style of a
+ * compressed sparse row (CSR) representation of a graph.
+ *
+ * <p>Each node of the set gets a dense id between 0 (inclusive) and {@link #size()} (exclusive),
+ * in the iteration order of the given nodes. The successors of the node with id {@code id} are
+ * the ids {@link #getSuccessor(int, int) getSuccessor(id, i)} for {@code 0 <= i <}{@link
+ * #getNumSuccessors(int) getNumSuccessors(id)}, in the order of the leaving edges of the node.
+ * Predecessors are stored in the same way. Summary edges are not contained, and edges from or to
+ * nodes outside of the set are ignored. Querying the index does not allocate, so it is intended
+ * for algorithms that traverse the same part of the CFA repeatedly.
+ *
+ * <p>The index is a snapshot: it is not updated if edges are added to or removed from the nodes
+ * afterwards, so it should only be created for parts of the CFA that are not modified anymore.
+ */
+public final class CFAEdgeIndex {
+
+  private final ImmutableList<CFANode> nodes;
+  private final Map<CFANode, Integer> ids;
+
+  private final int[] successorOffsets;
+  private final int[] successors;
+  private final int[] predecessorOffsets;
+  private final int[] predecessors;
+
+  private CFAEdgeIndex(
+      ImmutableList<CFANode> pNodes,
+      Map<CFANode, Integer> pIds,
+      int[] pSuccessorOffsets,
+      int[] pSuccessors,
+      int[] pPredecessorOffsets,
+      int[] pPredecessors) {
+    nodes = pNodes;
+    ids = pIds;
+    successorOffsets = pSuccessorOffsets;
+    successors = pSuccessors;
+    predecessorOffsets = pPredecessorOffsets;
+    predecessors = pPredecessors;
+  }
+
+  /** Create an index of all edges between the given nodes. */
+  public static CFAEdgeIndex of(Collection<CFANode> pNodes) {
+    ImmutableList<CFANode> nodes = ImmutableList.copyOf(pNodes);
+    Map<CFANode, Integer> ids = new HashMap<>(nodes.size() * 2);
+    for (CFANode node : nodes) {
+      checkArgument(ids.put(node, ids.size()) == null, "duplicate node %s", node);
+    }
+
+    int[] successorOffsets = new int[nodes.size() + 1];
+    int[] predecessorOffsets = new int[nodes.size() + 1];
+    for (int id = 0; id < nodes.size(); id++) {
+      CFANode node = nodes.get(id);
+      successorOffsets[id + 1] = successorOffsets[id];
+      for (int i = 0; i < node.getNumLeavingEdges(); i++) {
+        if (ids.containsKey(node.getLeavingEdge(i).getSuccessor())) {
+          successorOffsets[id + 1]++;
+        }
+      }
+      predecessorOffsets[id + 1] = predecessorOffsets[id];
+      for (int i = 0; i < node.getNumEnteringEdges(); i++) {
+        if (ids.containsKey(node.getEnteringEdge(i).getPredecessor())) {
+          predecessorOffsets[id + 1]++;
+        }
+      }
+    }
+
+    int[] successors = new int[successorOffsets[nodes.size()]];
+    int[] predecessors = new int[predecessorOffsets[nodes.size()]];
+    for (int id = 0; id < nodes.size(); id++) {
+      CFANode node = nodes.get(id);
+      int next = successorOffsets[id];
+      for (int i = 0; i < node.getNumLeavingEdges(); i++) {
+        Integer successor = ids.get(node.getLeavingEdge(i).getSuccessor());
+        if (successor != null) {
+          successors[next++] = successor;
+        }
+      }
+      next = predecessorOffsets[id];
+      for (int i = 0; i < node.getNumEnteringEdges(); i++) {
+        Integer predecessor = ids.get(node.getEnteringEdge(i).getPredecessor());
+        if (predecessor != null) {
+          predecessors[next++] = predecessor;
+        }
+      }
+    }
+
+    return new CFAEdgeIndex(
+        nodes, ids, successorOffsets, successors, predecessorOffsets, predecessors);
+  }
+
+  /** Return the number of nodes in this index. */
+  public int size() {
+    return nodes.size();
+  }
+
+  /** Return the node with the given id. */
+  public CFANode getNode(int pId) {
+    return nodes.get(pId);
+  }
+
+  /** Return the id of the given node, or -1 if the node is not part of this index. */
+  public int getId(CFANode pNode) {
+    Integer id = ids.get(pNode);
+    return id == null ? -1 : id;
+  }
+
+  public int getNumSuccessors(int pId) {
+    return successorOffsets[pId + 1] - successorOffsets[pId];
+  }
+
+  /** Return the id of the {@code pIndex}-th successor of the node with the given id. */
+  public int getSuccessor(int pId, int pIndex) {
+    checkIndex(pIndex, getNumSuccessors(pId));
+    return successors[successorOffsets[pId] + pIndex];
+  }
+
+  public int getNumPredecessors(int pId) {
+    return predecessorOffsets[pId + 1] - predecessorOffsets[pId];
+  }
+
+  /** Return the id of the {@code pIndex}-th predecessor of the node with the given id. */
+  public int getPredecessor(int pId, int pIndex) {
+    checkIndex(pIndex, getNumPredecessors(pId));
+    return predecessors[predecessorOffsets[pId] + pIndex];
+  }
+
+  private static void checkIndex(int pIndex, int pSize) {
+    if (pIndex < 0 || pIndex >= pSize) {
+      throw new IndexOutOfBoundsException("index " + pIndex + " for size " + pSize);
+    }
+  }
+}
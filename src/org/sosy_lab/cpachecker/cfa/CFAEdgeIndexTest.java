@@ -0,0 +1,90 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.ast.FileLocation;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionDeclaration;
+import org.sosy_lab.cpachecker.cfa.model.BlankEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+
+public class CFAEdgeIndexTest {
+
+  // a -> b, a -> c, b -> d, c -> d, d -> a
+  private CFANode a;
+  private CFANode b;
+  private CFANode c;
+  private CFANode d;
+
+  @Before
+  public void setUp() {
+    a = new CFANode(CFunctionDeclaration.DUMMY);
+    b = new CFANode(CFunctionDeclaration.DUMMY);
+    c = new CFANode(CFunctionDeclaration.DUMMY);
+    d = new CFANode(CFunctionDeclaration.DUMMY);
+    addEdge(a, b);
+    addEdge(a, c);
+    addEdge(b, d);
+    addEdge(c, d);
+    addEdge(d, a);
+  }
+
+  private static void addEdge(CFANode pFrom, CFANode pTo) {
+    CFAEdge edge = new BlankEdge("", FileLocation.DUMMY, pFrom, pTo, "");
+    pFrom.addLeavingEdge(edge);
+    pTo.addEnteringEdge(edge);
+  }
+
+  @Test
+  public void testSuccessorsAndPredecessors() {
+    CFAEdgeIndex index = CFAEdgeIndex.of(ImmutableList.of(a, b, c, d));
+    assertThat(index.size()).isEqualTo(4);
+    assertThat(index.getNode(index.getId(c))).isSameInstanceAs(c);
+
+    int idA = index.getId(a);
+    assertThat(index.getNumSuccessors(idA)).isEqualTo(2);
+    assertThat(index.getSuccessor(idA, 0)).isEqualTo(index.getId(b));
+    assertThat(index.getSuccessor(idA, 1)).isEqualTo(index.getId(c));
+
+    int idD = index.getId(d);
+    assertThat(index.getNumPredecessors(idD)).isEqualTo(2);
+    assertThat(index.getPredecessor(idD, 0)).isEqualTo(index.getId(b));
+    assertThat(index.getPredecessor(idD, 1)).isEqualTo(index.getId(c));
+  }
+
+  @Test
+  public void testEdgesLeavingTheSetAreIgnored() {
+    CFAEdgeIndex index = CFAEdgeIndex.of(ImmutableList.of(a, b));
+    assertThat(index.getId(c)).isEqualTo(-1);
+    assertThat(index.getNumSuccessors(index.getId(a))).isEqualTo(1);
+    assertThat(index.getNumSuccessors(index.getId(b))).isEqualTo(0);
+    assertThat(index.getNumPredecessors(index.getId(a))).isEqualTo(0);
+  }
+
+  @Test(expected = IndexOutOfBoundsException.class)
+  public void testInvalidSuccessorIndex() {
+    CFAEdgeIndex index = CFAEdgeIndex.of(ImmutableList.of(a, b, c, d));
+    index.getSuccessor(index.getId(b), 1);
+  }
+
+  @Test
+  public void testReversePostorder() {
+    new CFAReversePostorder().assignSorting(a);
+    // postorder of the DFS is d, b, c, a
+    assertThat(d.getReversePostorderId()).isEqualTo(0);
+    assertThat(b.getReversePostorderId()).isEqualTo(1);
+    assertThat(c.getReversePostorderId()).isEqualTo(2);
+    assertThat(a.getReversePostorderId()).isEqualTo(3);
+  }
+}
@@ -8,13 +8,12 @@
 
 package org.sosy_lab.cpachecker.cfa;
 
-import java.util.ArrayDeque;
-import java.util.Deque;
+import static com.google.common.base.Preconditions.checkArgument;
+
 import java.util.HashSet;
-import java.util.Iterator;
-import java.util.LinkedList;
 import java.util.Set;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.util.CFATraversal;
 import org.sosy_lab.cpachecker.util.CFAUtils;
 
 public class CFAReversePostorder {
@@ -48,68 +47,59 @@ public class CFAReversePostorder {
     return true;
   }
 
+  /**
+   * Assign reverse postorder ids to all nodes reachable from the given node. This builds a {@link
+   * CFAEdgeIndex} of the reachable nodes first. If the index is already available, use {@link
+   * #assignSorting(CFAEdgeIndex, CFANode)}.
+   */
   public void assignSorting(final CFANode start) {
-    // This is an iterative version of the original algorithm that is now in checkIds().
-    // We store the state of the function in two stacks:
-    // - the current node (variable "node" in checkIds())
-    // - the iterator over the current node's successors (this is state hidden in the for-each loop in checkIds())
-    // Together, these two items form a "stack frame".
-
-    final Set<CFANode> finished = new HashSet<>();
-
-    final Deque<CFANode> nodeStack = new ArrayDeque<>();
-    @SuppressWarnings("JdkObsolete") // ArrayDeque doesn't work here because we store nulls
-    final Deque<Iterator<CFANode>> iteratorStack = new LinkedList<>();
-
-    nodeStack.push(start);
-    iteratorStack.push(null);
-
-    while (!nodeStack.isEmpty()) {
-      assert nodeStack.size() == iteratorStack.size();
-
-      final CFANode node = nodeStack.peek();
-      Iterator<CFANode> successors = iteratorStack.peek();
-
-      if (successors == null) {
-        // Entering this stack frame.
-        // This part of the code corresponds to the code in checkIds()
-        // before the for loop.
-
-        if (!finished.add(node)) {
-          // already handled, do nothing
+    assignSorting(CFAEdgeIndex.of(CFATraversal.dfs().collectNodesReachableFrom(start)), start);
+  }
 
-          // Do a simulated "return".
-          nodeStack.pop();
-          iteratorStack.pop();
-          continue;
+  /**
+   * Assign reverse postorder ids to all nodes reachable from the given node, which need to be
+   * contained in the given index. This assigns exactly the same ids as the recursive algorithm in
+   * {@link #checkIds(CFANode)}, but works on the int ids of the index and does not allocate
+   * anything apart from two stacks.
+   */
+  public void assignSorting(final CFAEdgeIndex index, final CFANode start) {
+    // The state of the recursive algorithm is stored in two stacks that form its "stack frames":
+    // - the id of the current node (variable "node" in checkIds())
+    // - the position in the list of the current node's successors
+    //   (this is state hidden in the for-each loop in checkIds())
+    // Each node is entered at most once, so there are at most as many frames as nodes.
+    final boolean[] entered = new boolean[index.size()];
+    final int[] nodeStack = new int[index.size()];
+    final int[] successorStack = new int[index.size()];
+    int top = 0;
+
+    final int startId = index.getId(start);
+    checkArgument(startId >= 0, "Start node %s is not part of the index", start);
+    entered[startId] = true;
+    nodeStack[top] = startId;
+    successorStack[top] = 0;
+
+    while (top >= 0) {
+      final int node = nodeStack[top];
+      final int nextSuccessor = successorStack[top];
+
+      if (nextSuccessor < index.getNumSuccessors(node)) {
+        // "recursive call", but only for nodes that are not yet visited
+        // (this corresponds to the check at the beginning of checkIds())
+        successorStack[top]++;
+        final int successor = index.getSuccessor(node, nextSuccessor);
+        if (!entered[successor]) {
+          entered[successor] = true;
+          top++;
+          nodeStack[top] = successor;
+          successorStack[top] = 0;
         }
 
-        // enter the for loop
-        successors = CFAUtils.successorsOf(node).iterator();
-        iteratorStack.pop();
-        iteratorStack.push(successors);
-      }
-
-      if (successors.hasNext()) {
-        // "recursive call"
-        // This part of the code corresponds to the code in checkIds()
-        // during the loop.
-        CFANode successor = successors.next();
-
-        // Do a simulated "function call" by pushing something on the stacks,
-        // creating a new stack frame.
-        nodeStack.push(successor);
-        iteratorStack.push(null);
-
       } else {
         // All children handled.
-        // This part of the code corresponds to the code in checkIds()
-        // after the loop.
-        node.setReversePostorderId(reversePostorderId++);
-
-        // Do a simulated "return".
-        nodeStack.pop();
-        iteratorStack.pop();
+        // This part of the code corresponds to the code in checkIds() after the loop.
+        index.getNode(node).setReversePostorderId(reversePostorderId++);
+        top--;
       }
     }
 
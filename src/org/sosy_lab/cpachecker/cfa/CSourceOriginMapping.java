@@ -8,12 +8,15 @@
 
 package org.sosy_lab.cpachecker.cfa;
 
+import com.google.common.collect.BoundType;
 import com.google.common.collect.Range;
 import com.google.common.collect.RangeMap;
 import com.google.common.collect.TreeRangeMap;
+import java.util.Arrays;
 import java.util.HashMap;
 import java.util.Map;
 import java.util.Objects;
+import org.checkerframework.checker.nullness.qual.Nullable;
 
 
 public class CSourceOriginMapping {
@@ -24,6 +27,10 @@ public class CSourceOriginMapping {
   // one for each input file.
   private final Map<String, RangeMap<Integer, CodePosition>> mapping = new HashMap<>();
 
+  // The same mapping as sorted arrays of the line ranges, which are created on demand and
+  // are used for the lookups, because these happen for every AST node while parsing.
+  private final Map<String, LineRangeIndex> indices = new HashMap<>();
+
   void mapInputLineRangeToDelta(
       String pAnalysisFileName,
       String pOriginFileName,
@@ -39,6 +46,7 @@ public class CSourceOriginMapping {
     Range<Integer> lineRange =
         Range.closedOpen(pFromAnalysisCodeLineNumber, pToAnalysisCodeLineNumber);
     fileMapping.put(lineRange, CodePosition.of(pOriginFileName, pLineDeltaToOrigin));
+    indices.remove(pAnalysisFileName);
   }
 
   /**
@@ -52,10 +60,17 @@ public class CSourceOriginMapping {
    */
   public CodePosition getOriginLineFromAnalysisCodeLine(
       String pAnalysisFileName, int pAnalysisCodeLine) {
-    RangeMap<Integer, CodePosition> fileMapping = mapping.get(pAnalysisFileName);
+    LineRangeIndex fileIndex = indices.get(pAnalysisFileName);
+    if (fileIndex == null) {
+      RangeMap<Integer, CodePosition> fileMapping = mapping.get(pAnalysisFileName);
+      if (fileMapping != null) {
+        fileIndex = new LineRangeIndex(fileMapping);
+        indices.put(pAnalysisFileName, fileIndex);
+      }
+    }
 
-    if (fileMapping != null) {
-      CodePosition originFileAndLineDelta = fileMapping.get(pAnalysisCodeLine);
+    if (fileIndex != null) {
+      CodePosition originFileAndLineDelta = fileIndex.get(pAnalysisCodeLine);
 
       if (originFileAndLineDelta != null) {
         return originFileAndLineDelta.addToLineNumber(pAnalysisCodeLine);
@@ -72,6 +87,43 @@ public class CSourceOriginMapping {
     return mapping.isEmpty();
   }
 
+  /**
+   * Disjoint line ranges of one analysis file, sorted by their first line, such that the range of
+   * a line can be found by binary search without boxing the line number.
+   */
+  private static final class LineRangeIndex {
+
+    private final int[] fromLines;
+    private final int[] toLines;
+    private final CodePosition[] positions;
+
+    private LineRangeIndex(RangeMap<Integer, CodePosition> pFileMapping) {
+      Map<Range<Integer>, CodePosition> ranges = pFileMapping.asMapOfRanges();
+      fromLines = new int[ranges.size()];
+      toLines = new int[ranges.size()];
+      positions = new CodePosition[ranges.size()];
+      int i = 0;
+      for (Map.Entry<Range<Integer>, CodePosition> entry : ranges.entrySet()) {
+        Range<Integer> range = entry.getKey();
+        assert range.lowerBoundType() == BoundType.CLOSED
+            && range.upperBoundType() == BoundType.OPEN;
+        fromLines[i] = range.lowerEndpoint();
+        toLines[i] = range.upperEndpoint();
+        positions[i] = entry.getValue();
+        i++;
+      }
+    }
+
+    private @Nullable CodePosition get(int pLine) {
+      int i = Arrays.binarySearch(fromLines, pLine);
+      if (i < 0) {
+        // index of the last range that starts before the line
+        i = -i - 2;
+      }
+      return i >= 0 && pLine < toLines[i] ? positions[i] : null;
+    }
+  }
+
   /** Code position in terms of file name and absolute or relative line number. */
   public static class CodePosition {
 
@@ -0,0 +1,58 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.CSourceOriginMapping.CodePosition;
+
+public class CSourceOriginMappingTest {
+
+  @Test
+  public void testLookupInRanges() {
+    CSourceOriginMapping mapping = new CSourceOriginMapping();
+    mapping.mapInputLineRangeToDelta("test.i", "a.h", 1, 10, 5);
+    mapping.mapInputLineRangeToDelta("test.i", "test.c", 20, 30, -19);
+
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 1))
+        .isEqualTo(CodePosition.of("a.h", 6));
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 9))
+        .isEqualTo(CodePosition.of("a.h", 14));
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 25))
+        .isEqualTo(CodePosition.of("test.c", 6));
+
+    // lines outside of the ranges and other files are not mapped
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 10))
+        .isEqualTo(CodePosition.of("test.i", 10));
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 0))
+        .isEqualTo(CodePosition.of("test.i", 0));
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 30))
+        .isEqualTo(CodePosition.of("test.i", 30));
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("other.i", 5))
+        .isEqualTo(CodePosition.of("other.i", 5));
+  }
+
+  @Test
+  public void testLookupAfterOverlappingRange() {
+    CSourceOriginMapping mapping = new CSourceOriginMapping();
+    mapping.mapInputLineRangeToDelta("test.i", "test.c", 1, 100, 0);
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 50))
+        .isEqualTo(CodePosition.of("test.c", 50));
+
+    // later ranges override earlier ones, also after lookups
+    mapping.mapInputLineRangeToDelta("test.i", "a.h", 40, 60, -39);
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 50))
+        .isEqualTo(CodePosition.of("a.h", 11));
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 39))
+        .isEqualTo(CodePosition.of("test.c", 39));
+    assertThat(mapping.getOriginLineFromAnalysisCodeLine("test.i", 60))
+        .isEqualTo(CodePosition.of("test.c", 60));
+  }
+}
@@ -9,11 +9,15 @@
 
 package org.sosy_lab.cpachecker.cfa;
 
+import java.io.IOException;
+import java.nio.charset.Charset;
+import java.nio.file.Files;
 import java.nio.file.Path;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.io.IO;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.exceptions.CParserException;
 import org.sosy_lab.llvm_j.binding.LLVMLibrary;
@@ -41,9 +45,34 @@ public class ClangPreprocessor extends Preprocessor {
     config.inject(this);
   }
 
+  /**
+   * Run clang on the given file and return a file that contains the result. If the cache is
+   * enabled and contains a result for the file, clang is not run. If the result is neither cached
+   * nor dumped, it is written to a temporary file that is deleted on exit.
+   */
   public Path preprocessAndGetDumpedFile(String file) throws CParserException, InterruptedException {
+    Path cachedFile = getCachedFile(file);
+    if (cachedFile != null) {
+      return cachedFile;
+    }
+
     String result = preprocess0(file);
-    return getAndWriteDumpedFile(result, file);
+    Path dumpedFile = getAndWriteDumpedFile(result, file);
+    cachedFile = putCachedFile(file, result);
+    if (cachedFile != null) {
+      return cachedFile;
+    }
+    if (dumpedFile != null) {
+      return dumpedFile;
+    }
+    try {
+      Path tmpFile = Files.createTempFile("cpachecker-clang", ".ll");
+      tmpFile.toFile().deleteOnExit();
+      IO.writeFile(tmpFile, Charset.defaultCharset(), result);
+      return tmpFile;
+    } catch (IOException e) {
+      throw new CParserException("Cannot write result of clang to temporary file", e);
+    }
   }
 
   @Override
@@ -8,6 +8,8 @@
 
 package org.sosy_lab.cpachecker.cfa;
 
+import static java.nio.charset.StandardCharsets.UTF_8;
+
 import com.google.common.base.CharMatcher;
 import com.google.common.base.Splitter;
 import com.google.common.collect.ImmutableMap;
@@ -15,10 +17,12 @@ import com.google.common.collect.Lists;
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 import java.io.IOException;
 import java.nio.charset.Charset;
+import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.List;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.MoreStrings;
 import org.sosy_lab.common.ProcessExecutor;
 import org.sosy_lab.common.configuration.Configuration;
@@ -40,7 +44,19 @@ public abstract class Preprocessor {
   @FileOption(Type.OUTPUT_DIRECTORY)
   private Path dumpDirectory = Paths.get("preprocessed");
 
+  @Option(
+      name = "preprocessor.cacheDirectory",
+      description =
+          "Directory for a cache of the results of the preprocessor (or clang) that is kept on"
+              + " disk and can be shared between several (also concurrent) runs of CPAchecker."
+              + " Results are looked up by a hash of the command line and the source file,"
+              + " and are only used if all files included by the source file are unchanged."
+              + " No cache is used if not set.")
+  @FileOption(Type.OUTPUT_DIRECTORY)
+  private @Nullable Path cacheDirectory = null;
+
   private final LogManager logger;
+  private final @Nullable PreprocessorCache cache;
 
   protected Preprocessor(Configuration config, LogManager pLogger)
       throws InvalidConfigurationException {
@@ -49,14 +65,48 @@ public abstract class Preprocessor {
     if (dumpDirectory != null) {
       dumpDirectory = dumpDirectory.toAbsolutePath().normalize();
     }
+    cache = cacheDirectory == null ? null : new PreprocessorCache(cacheDirectory, logger);
   }
 
   public String preprocess(String file) throws CParserException, InterruptedException {
+    Path cachedFile = getCachedFile(file);
+    if (cachedFile != null) {
+      try {
+        return Files.readString(cachedFile, UTF_8);
+      } catch (IOException e) {
+        logger.logDebugException(e, "Could not read cached result of preprocessing");
+      }
+    }
     String result = preprocess0(file);
     getAndWriteDumpedFile(result, file);
+    putCachedFile(file, result);
     return result;
   }
 
+  /**
+   * Return the file with the cached result of preprocessing the given file, or null if the cache
+   * is disabled or has no valid entry.
+   */
+  protected @Nullable Path getCachedFile(String file) {
+    if (cache == null) {
+      return null;
+    }
+    Path cachedFile = cache.lookup(getCommandLine(), file);
+    if (cachedFile != null) {
+      logger.log(Level.FINE, "Using cached result of", getName(), "for file", file);
+    }
+    return cachedFile;
+  }
+
+  /**
+   * Store the given result of preprocessing the given file in the cache.
+   *
+   * @return The file of the cache entry, or null if the cache is disabled or writing failed.
+   */
+  protected @Nullable Path putCachedFile(String file, String result) {
+    return cache == null ? null : cache.store(getCommandLine(), file, result);
+  }
+
   @SuppressWarnings("JdkObsolete") // buffer is accessed from several threads
   protected String preprocess0(String file) throws CParserException, InterruptedException {
     // create command line
@@ -0,0 +1,184 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static java.nio.charset.StandardCharsets.UTF_8;
+
+import com.google.common.base.Splitter;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.hash.Hashing;
+import java.io.IOException;
+import java.nio.file.AtomicMoveNotSupportedException;
+import java.nio.file.Files;
+import java.nio.file.InvalidPathException;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.util.List;
+import java.util.logging.Level;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.log.LogManager;
+
+/**
+ * On-disk cache for the results of a {@link Preprocessor} that can be shared between several
+ * (also concurrent) runs of CPAchecker.
+ *
+ * <p>Entries are addressed by a hash of the command line of the preprocessor and the content of
+ * the source file. Next to each entry, a manifest stores the hashes of all files that were
+ * included while preprocessing, as given by the line markers in the output. An entry is only used
+ * if all these files are still unchanged, so changes to headers are detected as well. (The output
+ * of clang with {@code -emit-llvm} has no line markers, so for clang only the source file itself
+ * is taken into account.) The source origin mapping is computed from the line markers of the
+ * output and thus does not need to be stored separately.
+ *
+ * <p>Files are written to a temporary file first and then atomically moved to their final name.
+ * The manifest is written before the entry itself, so every visible entry has a complete manifest.
+ */
+final class PreprocessorCache {
+
+  private static final String ENTRY_SUFFIX = ".out";
+  private static final String MANIFEST_SUFFIX = ".deps";
+
+  /** Line markers as printed by cpp, e.g., {@code # 1 "/usr/include/stdio.h" 1 3 4} */
+  private static final Pattern LINE_MARKER = Pattern.compile("^#(?:line)? \\d+ \"([^\"]*)\".*");
+
+  private static final Splitter TAB_SPLITTER = Splitter.on('\t').limit(2);
+
+  private final Path directory;
+  private final LogManager logger;
+
+  PreprocessorCache(Path pDirectory, LogManager pLogger) {
+    directory = pDirectory;
+    logger = pLogger;
+  }
+
+  /**
+   * Return the file of the cache entry for the given preprocessor command and source file, or null
+   * if there is no valid entry.
+   */
+  @Nullable Path lookup(String pCommandLine, String pSourceFile) {
+    Path entry;
+    List<String> manifest;
+    try {
+      entry = getEntryFile(pCommandLine, pSourceFile);
+      manifest = Files.readAllLines(getManifestFile(entry), UTF_8);
+    } catch (NoSuchFileException e) {
+      return null;
+    } catch (IOException e) {
+      logger.logfDebugException(e, "Could not read preprocessor cache for %s", pSourceFile);
+      return null;
+    }
+
+    for (String line : manifest) {
+      List<String> parts = TAB_SPLITTER.splitToList(line);
+      if (parts.size() != 2) {
+        return null;
+      }
+      try {
+        if (!parts.get(0).equals(hashFile(Paths.get(parts.get(1))))) {
+          logger.log(Level.FINE, "Ignoring outdated preprocessor cache entry for", pSourceFile);
+          return null;
+        }
+      } catch (IOException | InvalidPathException e) {
+        return null;
+      }
+    }
+    return Files.isReadable(entry) ? entry : null;
+  }
+
+  /**
+   * Store the given output of the preprocessor for the given command and source file.
+   *
+   * @return The file of the new cache entry, or null if it could not be written.
+   */
+  @Nullable Path store(String pCommandLine, String pSourceFile, String pOutput) {
+    try {
+      Path entry = getEntryFile(pCommandLine, pSourceFile);
+      StringBuilder manifest = new StringBuilder();
+      for (Path includedFile : getIncludedFiles(pOutput)) {
+        manifest.append(hashFile(includedFile)).append('\t').append(includedFile).append('\n');
+      }
+      Files.createDirectories(entry.getParent());
+      writeAtomically(getManifestFile(entry), manifest.toString());
+      writeAtomically(entry, pOutput);
+      return entry;
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write preprocessor cache");
+      return null;
+    }
+  }
+
+  /** Return all existing files that are referenced by line markers in the given output. */
+  static ImmutableSet<Path> getIncludedFiles(String pOutput) {
+    ImmutableSet.Builder<Path> result = ImmutableSet.builder();
+    for (String line : Splitter.on('\n').split(pOutput)) {
+      if (line.startsWith("#")) {
+        Matcher matcher = LINE_MARKER.matcher(line);
+        if (matcher.matches()) {
+          try {
+            Path file = Paths.get(matcher.group(1));
+            if (Files.isRegularFile(file)) {
+              result.add(file);
+            }
+          } catch (InvalidPathException e) {
+            // pseudo files like "<built-in>" on some platforms
+          }
+        }
+      }
+    }
+    return result.build();
+  }
+
+  private Path getEntryFile(String pCommandLine, String pSourceFile) throws IOException {
+    String key =
+        Hashing.sha256()
+            .newHasher()
+            .putString(pCommandLine, UTF_8)
+            .putChar('\0')
+            .putString(pSourceFile, UTF_8)
+            .putChar('\0')
+            .putBytes(Files.readAllBytes(Paths.get(pSourceFile)))
+            .hash()
+            .toString();
+    // use subdirectories to avoid too many files in a single directory
+    return directory.resolve(key.substring(0, 2)).resolve(key + ENTRY_SUFFIX);
+  }
+
+  private static Path getManifestFile(Path pEntry) {
+    String name = pEntry.getFileName().toString();
+    return pEntry.resolveSibling(
+        name.substring(0, name.length() - ENTRY_SUFFIX.length()) + MANIFEST_SUFFIX);
+  }
+
+  private static String hashFile(Path pFile) throws IOException {
+    return Hashing.sha256().hashBytes(Files.readAllBytes(pFile)).toString();
+  }
+
+  private void writeAtomically(Path pFile, String pContent) throws IOException {
+    Path tmpFile = Files.createTempFile(pFile.getParent(), pFile.getFileName().toString(), ".tmp");
+    try {
+      Files.writeString(tmpFile, pContent, UTF_8);
+      try {
+        Files.move(
+            tmpFile, pFile, StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING);
+      } catch (AtomicMoveNotSupportedException e) {
+        Files.move(tmpFile, pFile, StandardCopyOption.REPLACE_EXISTING);
+      }
+    } finally {
+      try {
+        Files.deleteIfExists(tmpFile);
+      } catch (IOException e) {
+        logger.logDebugException(e);
+      }
+    }
+  }
+}
@@ -0,0 +1,72 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+import org.sosy_lab.common.log.LogManager;
+
+public class PreprocessorCacheTest {
+
+  private static final String COMMAND = "cpp";
+
+  @Rule public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+  private PreprocessorCache cache;
+  private Path source;
+  private Path header;
+  private String output;
+
+  @Before
+  public void setUp() throws Exception {
+    cache =
+        new PreprocessorCache(
+            tempFolder.newFolder("cache").toPath(), LogManager.createTestLogManager());
+    source = tempFolder.newFile("program.c").toPath();
+    header = tempFolder.newFile("header.h").toPath();
+    Files.writeString(source, "#include \"header.h\"\nint main() { return X; }\n");
+    Files.writeString(header, "#define X 0\n");
+    output =
+        "# 1 \""
+            + source
+            + "\"\n# 1 \"<built-in>\"\n# 1 \""
+            + header
+            + "\" 1\n# 2 \""
+            + source
+            + "\" 2\nint main() { return 0; }\n";
+  }
+
+  @Test
+  public void testIncludedFiles() {
+    assertThat(PreprocessorCache.getIncludedFiles(output)).containsExactly(source, header);
+  }
+
+  @Test
+  public void testStoreAndLookup() throws Exception {
+    assertThat(cache.lookup(COMMAND, source.toString())).isNull();
+    Path entry = cache.store(COMMAND, source.toString(), output);
+    assertThat(entry).isNotNull();
+    assertThat(cache.lookup(COMMAND, source.toString())).isEqualTo(entry);
+    assertThat(Files.readString(entry)).isEqualTo(output);
+    assertThat(cache.lookup("cpp -DX=1", source.toString())).isNull();
+  }
+
+  @Test
+  public void testChangedHeaderInvalidatesEntry() throws Exception {
+    cache.store(COMMAND, source.toString(), output);
+    Files.writeString(header, "#define X 1\n");
+    assertThat(cache.lookup(COMMAND, source.toString())).isNull();
+  }
+}
@@ -29,6 +29,7 @@ public class Block {
   private final ImmutableSet<CFANode> callNodes;
   private final ImmutableSet<CFANode> returnNodes;
   private final ImmutableSet<CFANode> nodes;
+  private final int hashCode; // blocks are used as keys of several caches
 
   public Block(
       Iterable<ReferencedVariable> pReferencedVariables,
@@ -40,6 +41,7 @@ public class Block {
     callNodes = ImmutableSortedSet.copyOf(pCallNodes);
     returnNodes = ImmutableSortedSet.copyOf(pReturnNodes);
     nodes = ImmutableSortedSet.copyOf(allNodes);
+    hashCode = nodes.hashCode();
   }
 
   public Set<CFANode> getCallNodes() {
@@ -149,6 +151,6 @@ public class Block {
 
   @Override
   public int hashCode() {
-    return nodes.hashCode();
+    return hashCode;
   }
 }
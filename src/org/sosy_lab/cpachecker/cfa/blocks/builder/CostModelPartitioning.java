@@ -0,0 +1,95 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.blocks.builder;
+
+import java.util.Set;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
+import org.sosy_lab.cpachecker.util.CFATraversal;
+
+/**
+ * <code>PartitioningHeuristic</code> that creates blocks for loop-bodies and for those function
+ * bodies where a simple cost model predicts that caching the block pays off. All other functions
+ * are analyzed as part of their callers, i.e., they are 'inlined'.
+ *
+ * <p>The benefit of a function block is estimated as the work that is saved by cache hits, i.e.,
+ * (callsites - 1) * size of the function body. The cost is the reduce and expand operations for
+ * each callsite, which grow with the number of variables referenced in the block. A block is
+ * created if benefit / cost is at least {@link #minBenefitCostRatio}.
+ */
+@Options(prefix = "cpa.bam.blockHeuristic.costModelPartitioning")
+public class CostModelPartitioning extends PartitioningHeuristic {
+
+  private static final CFATraversal TRAVERSE_CFA_INSIDE_FUNCTION =
+      CFATraversal.dfs().ignoreFunctionCalls();
+
+  @Option(
+      secure = true,
+      description =
+          "minimal ratio of estimated benefit (saved analysis work by cache hits) and estimated"
+              + " cost (reduce and expand operations) that is required for building a block"
+              + " for a function")
+  private double minBenefitCostRatio = 1.0;
+
+  @Option(
+      secure = true,
+      description =
+          "cost of reduce and expand for each variable referenced in a block, relative to the"
+              + " cost of a single reduce and expand operation of a block without any variables")
+  private double costPerReferencedVariable = 0.5;
+
+  private final LoopPartitioning loopPartitioning;
+
+  /** Do not change signature! Constructor will be created with Reflections. */
+  public CostModelPartitioning(LogManager pLogger, CFA pCfa, Configuration pConfig)
+      throws InvalidConfigurationException {
+    super(pLogger, pCfa, pConfig);
+    pConfig.inject(this);
+    loopPartitioning = new LoopPartitioning(pLogger, pCfa, pConfig);
+  }
+
+  @Override
+  @Nullable
+  protected Set<CFANode> getBlockForNode(CFANode pBlockHead) {
+    if (!(pBlockHead instanceof FunctionEntryNode)) {
+      return loopPartitioning.getBlockForNode(pBlockHead);
+    }
+
+    Set<CFANode> nodes = TRAVERSE_CFA_INSIDE_FUNCTION.collectNodesReachableFrom(pBlockHead);
+
+    // main function
+    if (pBlockHead.getNumEnteringEdges() == 0) {
+      return nodes;
+    }
+
+    int callsites = pBlockHead.getNumEnteringEdges();
+    int referencedVariables = new ReferencedVariablesCollector(nodes).getVars().size();
+    double benefit = (callsites - 1) * (double) nodes.size();
+    double cost = callsites * (1 + costPerReferencedVariable * referencedVariables);
+
+    boolean isBlock = benefit >= minBenefitCostRatio * cost;
+    logger.logf(
+        Level.FINEST,
+        "function %s: %d callsites, %d nodes, %d variables, %s block",
+        pBlockHead.getFunctionName(),
+        callsites,
+        nodes.size(),
+        referencedVariables,
+        isBlock ? "building" : "no");
+    return isBlock ? nodes : null;
+  }
+}
@@ -241,20 +241,6 @@ public final class DOTBuilder2 {
       MoreFiles.createParentDirectories(cfaFile);
       try (Writer out = Files.newBufferedWriter(cfaFile, StandardCharsets.UTF_8)) {
         out.write("digraph " + funcname + " {\n");
-        StringBuilder outb = new StringBuilder();
-
-        //write comboedges
-        for (List<CFAEdge> combo : comboedges.get(funcname)) {
-          outb.append(comboToDot(combo));
-
-          CFAEdge first = combo.get(0);
-          CFAEdge last = combo.get(combo.size() - 1);
-
-          outb.append(first.getPredecessor().getNodeNumber());
-          outb.append(" -> ");
-          outb.append(last.getSuccessor().getNodeNumber());
-          outb.append("[label=\"\"]\n");
-        }
 
         //write nodes
         for (CFANode node : nodes.get(funcname)) {
@@ -262,7 +248,18 @@ public final class DOTBuilder2 {
           out.write('\n');
         }
 
-        out.write(outb.toString());
+        //write comboedges directly, the order of statements does not matter for dot
+        for (List<CFAEdge> combo : comboedges.get(funcname)) {
+          out.write(comboToDot(combo));
+
+          CFAEdge first = combo.get(0);
+          CFAEdge last = combo.get(combo.size() - 1);
+
+          out.write(Integer.toString(first.getPredecessor().getNodeNumber()));
+          out.write(" -> ");
+          out.write(Integer.toString(last.getSuccessor().getNodeNumber()));
+          out.write("[label=\"\"]\n");
+        }
 
         //write edges
         for (CFAEdge edge : edges.get(funcname)) {
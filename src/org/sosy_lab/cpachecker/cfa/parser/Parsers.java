@@ -19,6 +19,7 @@ import org.sosy_lab.common.Classes;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.annotations.SuppressForbidden;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -63,6 +64,14 @@ public class Parsers {
     @Option(secure = true, description = "simplify simple const expressions like 1+2")
     private boolean simplifyConstExpressions = true;
 
+    @Option(
+        secure = true,
+        description =
+            "Number of threads that parse the source files in parallel if several files are"
+                + " given. The CFA is built sequentially afterwards.")
+    @IntegerOption(min = 1)
+    private int parserThreads = 1;
+
     public boolean initializeAllVariables() {
       return initializeAllVariables;
     }
@@ -78,6 +87,10 @@ public class Parsers {
     public boolean simplifyConstExpressions() {
       return simplifyConstExpressions;
     }
+
+    public int getParserThreads() {
+      return parserThreads;
+    }
   }
 
   private Parsers() { }
@@ -13,10 +13,12 @@ import static com.google.common.base.Preconditions.checkArgument;
 import com.google.common.base.Function;
 import com.google.common.base.Preconditions;
 import com.google.common.base.Strings;
+import com.google.common.base.Throwables;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.Lists;
 import com.google.common.io.MoreFiles;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
 import java.io.File;
 import java.io.IOException;
 import java.nio.charset.Charset;
@@ -28,6 +30,10 @@ import java.util.HashMap;
 import java.util.Iterator;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import org.eclipse.cdt.core.dom.ast.IASTCompoundStatement;
 import org.eclipse.cdt.core.dom.ast.IASTDeclaration;
 import org.eclipse.cdt.core.dom.ast.IASTFunctionDefinition;
@@ -149,21 +155,71 @@ class EclipseCParser implements CParser {
     ParseContext parseContext =
         new ParseContext(createNiceFileNameFunction(fileNameMapping.keySet()), sourceOriginMapping);
 
-    List<IASTTranslationUnit> astUnits = new ArrayList<>(pInput.size());
-
-    for (FileToParse f : pInput) {
-      final String fileName = fixPath(f.getFileName());
+    List<IASTTranslationUnit> astUnits;
+    if (options.getParserThreads() > 1 && pInput.size() > 1) {
+      astUnits = parseInParallel(pInput, parseContext, pWrapperFunction);
+    } else {
+      astUnits = new ArrayList<>(pInput.size());
+      for (FileToParse f : pInput) {
+        final String fileName = fixPath(f.getFileName());
 
-      try {
-        astUnits.add(parse(pWrapperFunction.wrap(fileName, f), parseContext));
-      } catch (IOException e) {
-        throw new CParserException("IO failed!", e);
+        try {
+          astUnits.add(parse(pWrapperFunction.wrap(fileName, f), parseContext));
+        } catch (IOException e) {
+          throw new CParserException("IO failed!", e);
+        }
       }
     }
 
     return buildCFA(astUnits, parseContext, scope);
   }
 
+  /**
+   * Parse the given files in parallel. The translation units are independent of each other until
+   * the CFA is built, which is done sequentially afterwards.
+   */
+  private List<IASTTranslationUnit> parseInParallel(
+      List<? extends FileToParse> pInput,
+      ParseContext pParseContext,
+      FileParseWrapper pWrapperFunction)
+      throws CParserException, InterruptedException {
+    ExecutorService executor =
+        Executors.newFixedThreadPool(
+            Math.min(options.getParserThreads(), pInput.size()),
+            new ThreadFactoryBuilder().setDaemon(true).setNameFormat("c-parser-%d").build());
+    parseTimer.start();
+    try {
+      List<Future<IASTTranslationUnit>> futures = new ArrayList<>(pInput.size());
+      for (FileToParse f : pInput) {
+        final String fileName = fixPath(f.getFileName());
+        futures.add(
+            executor.submit(
+                () -> parseWithoutTiming(pWrapperFunction.wrap(fileName, f), pParseContext)));
+      }
+
+      List<IASTTranslationUnit> astUnits = new ArrayList<>(pInput.size());
+      for (Future<IASTTranslationUnit> future : futures) {
+        try {
+          astUnits.add(future.get());
+        } catch (ExecutionException e) {
+          Throwable cause = e.getCause();
+          if (cause instanceof IOException) {
+            throw new CParserException("IO failed!", cause);
+          }
+          Throwables.throwIfInstanceOf(cause, CParserException.class);
+          Throwables.throwIfInstanceOf(cause, InterruptedException.class);
+          Throwables.throwIfUnchecked(cause);
+          throw new AssertionError("Unexpected exception during parsing", cause);
+        }
+      }
+      return astUnits;
+
+    } finally {
+      executor.shutdownNow();
+      parseTimer.stop();
+    }
+  }
+
   @Override
   public ParseResult parseFile(List<String> pFilenames)
       throws CParserException, InterruptedException {
@@ -303,6 +359,15 @@ class EclipseCParser implements CParser {
   private IASTTranslationUnit parse(FileContent codeReader, ParseContext parseContext)
       throws CParserException, InterruptedException {
     parseTimer.start();
+    try {
+      return parseWithoutTiming(codeReader, parseContext);
+    } finally {
+      parseTimer.stop();
+    }
+  }
+
+  private IASTTranslationUnit parseWithoutTiming(FileContent codeReader, ParseContext parseContext)
+      throws CParserException, InterruptedException {
     try {
       IASTTranslationUnit result = getASTTranslationUnit(codeReader);
 
@@ -329,8 +394,6 @@ class EclipseCParser implements CParser {
 
     } catch (CFAGenerationRuntimeException | CoreException e) {
       throw new CParserException(e);
-    } finally {
-      parseTimer.stop();
     }
   }
 
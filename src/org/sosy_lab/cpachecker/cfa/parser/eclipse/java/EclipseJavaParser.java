@@ -23,6 +23,8 @@ import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.ArrayList;
 import java.util.Collections;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Optional;
@@ -33,6 +35,7 @@ import org.eclipse.jdt.core.dom.AST;
 import org.eclipse.jdt.core.dom.ASTParser;
 import org.eclipse.jdt.core.dom.AnonymousClassDeclaration;
 import org.eclipse.jdt.core.dom.CompilationUnit;
+import org.eclipse.jdt.core.dom.FileASTRequestor;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -174,17 +177,47 @@ class EclipseJavaParser implements Parser {
   }
 
   private List<JavaFileAST> getASTsOfProgram() throws IOException {
-    List<JavaFileAST> astsOfFoundFiles = new ArrayList<>();
-
+    List<Path> foundFiles = new ArrayList<>();
     for (Path directory : javaSourcePaths) {
       try (Stream<Path> files = getJavaFilesInPath(directory)) {
-        for (Path file : files.collect(ImmutableList.toImmutableList())) {
-          CompilationUnit ast = parse(file, IGNORE_METHOD_BODY);
-          astsOfFoundFiles.add(new JavaFileAST(file, ast));
-        }
+        files.forEach(foundFiles::add);
       }
     }
 
+    // Parse all files with one call to the JDT parser, such that the (expensive) lookup
+    // environment for the class path is created only once instead of once per file.
+    Map<String, Path> filesByName = new LinkedHashMap<>();
+    for (Path file : foundFiles) {
+      filesByName.put(file.toAbsolutePath().normalize().toString(), file);
+    }
+    Map<Path, CompilationUnit> asts = new HashMap<>();
+    configureParser(IGNORE_METHOD_BODY);
+    parseTimer.start();
+    try {
+      parser.createASTs(
+          filesByName.keySet().toArray(new String[0]),
+          Collections.nCopies(filesByName.size(), encoding.name()).toArray(new String[0]),
+          new String[0],
+          new FileASTRequestor() {
+            @Override
+            public void acceptAST(String pSourceFilePath, CompilationUnit pAst) {
+              asts.put(filesByName.get(pSourceFilePath), pAst);
+            }
+          },
+          null);
+    } finally {
+      parseTimer.stop();
+    }
+
+    List<JavaFileAST> astsOfFoundFiles = new ArrayList<>(foundFiles.size());
+    for (Path file : foundFiles) {
+      parsedFiles.add(file);
+      CompilationUnit ast = asts.get(file);
+      if (ast == null) {
+        throw new IOException("Parser did not return an AST for file " + file);
+      }
+      astsOfFoundFiles.add(new JavaFileAST(file, ast));
+    }
     return astsOfFoundFiles;
   }
 
@@ -215,7 +248,21 @@ class EclipseJavaParser implements Parser {
 
   private CompilationUnit parse(Path file, boolean ignoreMethodBody) throws IOException {
     parsedFiles.add(file);
+    configureParser(ignoreMethodBody);
+
+    parseTimer.start();
+
+    try {
+      parser.setUnitName(file.normalize().toString());
+      parser.setSource(IO.toCharArray(MoreFiles.asCharSource(file, encoding)));
+      return (CompilationUnit) parser.createAST(null);
+    } finally {
+      parseTimer.stop();
+    }
+  }
 
+  /** The JDT parser resets its settings after each parse, so they need to be set every time. */
+  private void configureParser(boolean ignoreMethodBody) {
     String[] encodings =
         Collections.nCopies(javaSourcePaths.size(), encoding.name()).toArray(new String[0]);
     parser.setEnvironment(asStrings(javaClassPaths), asStrings(javaSourcePaths), encodings, false);
@@ -228,17 +275,7 @@ class EclipseJavaParser implements Parser {
     Map<String, String> options = JavaCore.getOptions();
     JavaCore.setComplianceOptions(version, options);
     parser.setCompilerOptions(options);
-
-    parseTimer.start();
-
-    try {
-      parser.setUnitName(file.normalize().toString());
-      parser.setSource(IO.toCharArray(MoreFiles.asCharSource(file, encoding)));
-      parser.setIgnoreMethodBodies(ignoreMethodBody);
-      return (CompilationUnit) parser.createAST(null);
-    } finally {
-      parseTimer.stop();
-    }
+    parser.setIgnoreMethodBodies(ignoreMethodBody);
   }
 
   private String[] asStrings(List<Path> files) {
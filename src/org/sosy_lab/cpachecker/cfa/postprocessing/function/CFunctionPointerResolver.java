@@ -9,11 +9,14 @@
 package org.sosy_lab.cpachecker.cfa.postprocessing.function;
 
 import static com.google.common.collect.FluentIterable.from;
+import static com.google.common.collect.ImmutableList.toImmutableList;
+import static com.google.common.collect.ImmutableSet.toImmutableSet;
 import static org.sosy_lab.common.collect.Collections3.transformedImmutableListCopy;
 import static org.sosy_lab.cpachecker.util.CFAUtils.leavingEdges;
 
 import com.google.common.base.Functions;
 import com.google.common.base.Joiner;
+import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Sets;
 import java.io.PrintStream;
@@ -21,8 +24,12 @@ import java.util.ArrayList;
 import java.util.Collection;
 import java.util.List;
 import java.util.Set;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Function;
 import java.util.logging.Level;
+import java.util.stream.Stream;
 import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
@@ -48,15 +55,24 @@ import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
 import org.sosy_lab.cpachecker.cfa.types.c.CFunctionType;
 import org.sosy_lab.cpachecker.cfa.types.c.CFunctionTypeWithNames;
 import org.sosy_lab.cpachecker.cfa.types.c.CPointerType;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
 import org.sosy_lab.cpachecker.cfa.types.c.CTypes;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
+import org.sosy_lab.cpachecker.cpa.pointer2.AndersenPointerAnalysis;
+import org.sosy_lab.cpachecker.cpa.pointer2.PointerState;
+import org.sosy_lab.cpachecker.cpa.pointer2.PointerTransferRelation;
+import org.sosy_lab.cpachecker.cpa.pointer2.util.ExplicitLocationSet;
+import org.sosy_lab.cpachecker.cpa.pointer2.util.LocationSet;
+import org.sosy_lab.cpachecker.exceptions.CPATransferException;
+import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
 import org.sosy_lab.cpachecker.util.CFATraversal;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.statistics.StatInt;
 import org.sosy_lab.cpachecker.util.statistics.StatKind;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 import org.sosy_lab.cpachecker.util.statistics.StatTimer;
 
 /**
@@ -126,6 +142,24 @@ public class CFunctionPointerResolver implements StatisticsProvider {
       ImmutableSet.of(
           FunctionSet.USED_IN_CODE, FunctionSet.RETURN_VALUE, FunctionSet.EQ_PARAM_TYPES);
 
+  @Option(
+    secure = true,
+    name = "analysis.functionPointerTargets.parallel",
+    description =
+        "collect function pointer calls and addressed functions and compute the targets"
+            + " of the calls concurrently for all functions"
+  )
+  private boolean parallel = false;
+
+  @Option(
+    secure = true,
+    name = "analysis.functionPointerTargets.usePointerAnalysis",
+    description =
+        "narrow the potential targets of function pointer calls to the functions that the"
+            + " called pointer may point to according to a flow-insensitive pointer analysis"
+  )
+  private boolean usePointerAnalysis = false;
+
   private static class CFunctionPointerResolverStatistics implements Statistics {
     private StatInt totalFPs = new StatInt(StatKind.SUM, "Function calls via function pointers");
     private StatInt instrumentedFPs =
@@ -135,6 +169,9 @@ public class CFunctionPointerResolver implements StatisticsProvider {
     private StatInt instrumentedFPsWithParameter =
         new StatInt(StatKind.SUM, "Instrumented function pointer arguments");
     private StatTimer totalTimer = new StatTimer("Time for function pointers resolving");
+    private StatTimer pointerAnalysisTimer = new StatTimer("Time for pointer analysis");
+    private StatInt narrowedFPs =
+        new StatInt(StatKind.SUM, "Function pointer calls narrowed by pointer analysis");
 
     @Override
     public String getName() {
@@ -149,6 +186,10 @@ public class CFunctionPointerResolver implements StatisticsProvider {
         put(out, 4, instrumentedFPs);
         put(out, 4, totalFPsWithParameter);
         put(out, 4, instrumentedFPsWithParameter);
+        if (pointerAnalysisTimer.getUpdateCount() > 0) {
+          put(out, 4, pointerAnalysisTimer);
+          put(out, 4, narrowedFPs);
+        }
       }
     }
   }
@@ -160,16 +201,25 @@ public class CFunctionPointerResolver implements StatisticsProvider {
 
   private final MutableCFA cfa;
   private final LogManager logger;
+  private final ShutdownNotifier shutdownNotifier;
   private final Configuration pConfig;
 
+  /** The points-to information used for narrowing the targets, if enabled. */
+  private @Nullable PointerState pointerState = null;
+
+  /** The number of calls whose targets were narrowed, counted concurrently. */
+  private final AtomicInteger narrowedCalls = new AtomicInteger();
+
   public CFunctionPointerResolver(
       MutableCFA pCfa,
       List<Pair<ADeclaration, String>> pGlobalVars,
       Configuration config,
-      LogManager pLogger)
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier)
       throws InvalidConfigurationException {
     cfa = pCfa;
     logger = pLogger;
+    shutdownNotifier = pShutdownNotifier;
     pConfig = config;
 
     config.inject(this);
@@ -189,9 +239,14 @@ public class CFunctionPointerResolver implements StatisticsProvider {
       } else {
         varCollector = new CReferencedFunctionsCollector();
       }
-      for (CFANode node : cfa.getAllNodes()) {
-        for (CFAEdge edge : leavingEdges(node)) {
-          varCollector.visitEdge(edge);
+      if (parallel && !matchAssignedFunctionPointers) {
+        // without field matching, the functions referenced in each function are independent
+        varCollector.getCollectedFunctions().addAll(collectReferencedFunctionsConcurrently());
+      } else {
+        for (CFANode node : cfa.getAllNodes()) {
+          for (CFAEdge edge : leavingEdges(node)) {
+            varCollector.visitEdge(edge);
+          }
         }
       }
       for (Pair<ADeclaration, String> decl : pGlobalVars) {
@@ -231,32 +286,70 @@ public class CFunctionPointerResolver implements StatisticsProvider {
     }
   }
 
+  private Set<String> collectReferencedFunctionsConcurrently() {
+    return cfa.getAllFunctionNames()
+        .parallelStream()
+        .flatMap(
+            function -> {
+              CReferencedFunctionsCollector collector = new CReferencedFunctionsCollector();
+              for (CFANode node : cfa.getFunctionNodes(function)) {
+                for (CFAEdge edge : leavingEdges(node)) {
+                  collector.visitEdge(edge);
+                }
+              }
+              return collector.getCollectedFunctions().stream();
+            })
+        .collect(toImmutableSet());
+  }
+
   /**
    * This method traverses the whole CFA, potentially replacing function pointer calls with regular
    * function calls.
    */
-  public void resolveFunctionPointers() throws InvalidConfigurationException {
+  public void resolveFunctionPointers() throws InvalidConfigurationException, InterruptedException {
 
     stats.totalTimer.start();
     // 1.Step: get all function calls
-    final FunctionPointerCallCollector visitor = new FunctionPointerCallCollector();
-    for (FunctionEntryNode functionStartNode : cfa.getAllFunctionHeads()) {
-      CFATraversal.dfs().traverseOnce(functionStartNode, visitor);
+    final List<CStatementEdge> functionPointerCalls;
+    final List<CStatementEdge> functionParameterPointerCalls;
+    if (parallel) {
+      // the calls are concatenated in the order of the functions, as in the sequential traversal
+      List<FunctionPointerCallCollector> visitors =
+          cfa.getAllFunctionHeads()
+              .parallelStream()
+              .map(functionStartNode -> collectCalls(ImmutableList.of(functionStartNode)))
+              .collect(toImmutableList());
+      functionPointerCalls =
+          from(visitors).transformAndConcat(v -> v.functionPointerCalls).toList();
+      functionParameterPointerCalls =
+          from(visitors).transformAndConcat(v -> v.functionParameterPointerCalls).toList();
+    } else {
+      final FunctionPointerCallCollector visitor = collectCalls(cfa.getAllFunctionHeads());
+      functionPointerCalls = visitor.functionPointerCalls;
+      functionParameterPointerCalls = visitor.functionParameterPointerCalls;
     }
 
-    // 2.Step: replace functionCalls with functioncall- and return-edges
+    if (usePointerAnalysis) {
+      pointerState = computePointsToInformation();
+    }
+    narrowedCalls.set(0);
+
+    // 2.Step: compute the targets of all calls, which does not modify the CFA
+    List<Collection<CFunctionEntryNode>> targets =
+        computeForAll(functionPointerCalls, this::getFunctionPointerCallTargets);
+    List<Collection<CFunctionEntryNode>> parameterTargets =
+        computeForAll(functionParameterPointerCalls, this::getParameterCallTargets);
+
+    // 3.Step: replace functionCalls with functioncall- and return-edges
     // This loop replaces function pointer calls inside the given function with regular function
     // calls.
 
     final EdgeReplacerFunctionPointer edgeReplacerFunctionPointer =
         new EdgeReplacerFunctionPointer(cfa, pConfig, logger);
-    for (final CStatementEdge edge : visitor.functionPointerCalls) {
+    for (int i = 0; i < functionPointerCalls.size(); i++) {
+      final CStatementEdge edge = functionPointerCalls.get(i);
       CFunctionCall functionCall = (CFunctionCall) edge.getStatement();
-      CFunctionCallExpression fExp = functionCall.getFunctionCallExpression();
-      CExpression nameExp = fExp.getFunctionNameExpression();
-      CFunctionType func = (CFunctionType) nameExp.getExpressionType().getCanonicalType();
-      logger.log(Level.FINEST, "Function pointer call", fExp);
-      Collection<CFunctionEntryNode> funcs = getTargets(nameExp, func, targetFunctionsProvider);
+      CExpression nameExp = functionCall.getFunctionCallExpression().getFunctionNameExpression();
 
       // need only to remove the symbol "*"
       if (nameExp instanceof CPointerExpression) {
@@ -265,30 +358,136 @@ public class CFunctionPointerResolver implements StatisticsProvider {
           nameExp = operand;
         }
       }
-      edgeReplacerFunctionPointer.instrument(edge, funcs, nameExp);
+      edgeReplacerFunctionPointer.instrument(edge, targets.get(i), nameExp);
     }
 
     EdgeReplacerParameterFunctionPointer edgeReplacerParameterFunctionPointer =
         new EdgeReplacerParameterFunctionPointer(cfa, pConfig, logger);
-    for (final CStatementEdge edge : visitor.functionParameterPointerCalls) {
+    for (int i = 0; i < functionParameterPointerCalls.size(); i++) {
+      final CStatementEdge edge = functionParameterPointerCalls.get(i);
       CExpression param = getParameter((CFunctionCall) edge.getStatement());
-      CFunctionType func =
-          (CFunctionType) ((CPointerType) param.getExpressionType()).getType().getCanonicalType();
-      logger.log(Level.FINEST, "Function pointer param", param);
-      Collection<CFunctionEntryNode> funcs =
-          getTargets(param, func, targetParameterFunctionsProvider);
-      edgeReplacerParameterFunctionPointer.instrument(edge, funcs, param);
+      edgeReplacerParameterFunctionPointer.instrument(edge, parameterTargets.get(i), param);
     }
 
-    stats.totalFPs.setNextValue(visitor.functionPointerCalls.size());
+    stats.totalFPs.setNextValue(functionPointerCalls.size());
     stats.instrumentedFPs.setNextValue(
         edgeReplacerFunctionPointer.getNumberOfInstrumenetedFunctions());
-    stats.totalFPsWithParameter.setNextValue(visitor.functionParameterPointerCalls.size());
+    stats.totalFPsWithParameter.setNextValue(functionParameterPointerCalls.size());
     stats.instrumentedFPsWithParameter.setNextValue(
         edgeReplacerParameterFunctionPointer.getNumberOfInstrumenetedFunctions());
+    stats.narrowedFPs.setNextValue(narrowedCalls.get());
     stats.totalTimer.stop();
   }
 
+  private FunctionPointerCallCollector collectCalls(
+      Collection<FunctionEntryNode> pFunctionStartNodes) {
+    final FunctionPointerCallCollector visitor = new FunctionPointerCallCollector();
+    for (FunctionEntryNode functionStartNode : pFunctionStartNodes) {
+      CFATraversal.dfs().traverseOnce(functionStartNode, visitor);
+    }
+    return visitor;
+  }
+
+  private <T> List<T> computeForAll(
+      List<CStatementEdge> pEdges, Function<CStatementEdge, T> pFunction) {
+    Stream<CStatementEdge> edges = parallel ? pEdges.parallelStream() : pEdges.stream();
+    return edges.map(pFunction).collect(toImmutableList());
+  }
+
+  private Collection<CFunctionEntryNode> getFunctionPointerCallTargets(CStatementEdge edge) {
+    CFunctionCallExpression fExp =
+        ((CFunctionCall) edge.getStatement()).getFunctionCallExpression();
+    CExpression nameExp = fExp.getFunctionNameExpression();
+    CFunctionType func = (CFunctionType) nameExp.getExpressionType().getCanonicalType();
+    logger.log(Level.FINEST, "Function pointer call", fExp);
+    return getTargets(nameExp, func, targetFunctionsProvider);
+  }
+
+  private Collection<CFunctionEntryNode> getParameterCallTargets(CStatementEdge edge) {
+    CExpression param = getParameter((CFunctionCall) edge.getStatement());
+    CFunctionType func =
+        (CFunctionType) ((CPointerType) param.getExpressionType()).getType().getCanonicalType();
+    logger.log(Level.FINEST, "Function pointer param", param);
+    return getTargets(param, func, targetParameterFunctionsProvider);
+  }
+
+  /**
+   * Run the pointer analysis on the CFA, in which calls are still statements. Direct calls are
+   * bound to the called function and calls via function pointers to all their type-based targets.
+   * Returns null if the CFA contains code that the pointer analysis does not support.
+   */
+  private @Nullable PointerState computePointsToInformation() throws InterruptedException {
+    stats.pointerAnalysisTimer.start();
+    try {
+      return AndersenPointerAnalysis.computePointsToInformationForCallStatements(
+          cfa, true, this::getCallees, shutdownNotifier);
+    } catch (CPATransferException e) {
+      logger.logUserException(
+          Level.WARNING, e, "Pointer analysis failed, function pointer targets are not narrowed");
+      return null;
+    } finally {
+      stats.pointerAnalysisTimer.stop();
+    }
+  }
+
+  private Collection<CFunctionEntryNode> getCallees(CFunctionCallExpression pCall) {
+    if (pCall.getDeclaration() != null) {
+      FunctionEntryNode callee = cfa.getAllFunctions().get(pCall.getDeclaration().getName());
+      return callee instanceof CFunctionEntryNode
+          ? ImmutableList.of((CFunctionEntryNode) callee)
+          : ImmutableList.of();
+    }
+    CType type = pCall.getFunctionNameExpression().getExpressionType().getCanonicalType();
+    if (type instanceof CPointerType) {
+      type = ((CPointerType) type).getType().getCanonicalType();
+    }
+    if (type instanceof CFunctionType) {
+      return targetFunctionsProvider.getFunctionSet((CFunctionType) type);
+    }
+    return ImmutableList.of();
+  }
+
+  /**
+   * Restrict the given targets to the functions that the given function pointer may point to, if
+   * the pointer analysis knows a non-empty set of such functions.
+   */
+  private Collection<CFunctionEntryNode> narrowTargets(
+      CExpression pPointer, Collection<CFunctionEntryNode> pFuncs) {
+    List<LocationSet> pointees = new ArrayList<>();
+    try {
+      LocationSet pointers = PointerTransferRelation.asLocations(pPointer, pointerState);
+      if (!(pointers instanceof ExplicitLocationSet)) {
+        return pFuncs;
+      }
+      for (MemoryLocation pointer : (ExplicitLocationSet) pointers) {
+        LocationSet pointsTo = pointerState.getPointsToSet(pointer);
+        if (pointsTo.isTop()) {
+          return pFuncs;
+        } else if (!pointsTo.isBot()) {
+          pointees.add(pointsTo);
+        }
+      }
+    } catch (UnrecognizedCodeException e) {
+      return pFuncs;
+    }
+    if (pointees.isEmpty()) {
+      // nothing is known about the pointer, e.g., because it is set outside of the program
+      return pFuncs;
+    }
+    ImmutableList<CFunctionEntryNode> narrowed =
+        from(pFuncs)
+            .filter(
+                f -> {
+                  MemoryLocation function = MemoryLocation.valueOf(f.getFunctionName());
+                  return from(pointees).anyMatch(p -> p.mayPointTo(function));
+                })
+            .toList();
+    if (narrowed.size() < pFuncs.size()) {
+      narrowedCalls.incrementAndGet();
+    }
+    return narrowed;
+  }
+
   private @Nullable CExpression getParameter(CFunctionCall call) {
     for (CExpression param : call.getFunctionCallExpression().getParameterExpressions()) {
       if (param.getExpressionType() instanceof CPointerType
@@ -325,6 +524,16 @@ public class CFunctionPointerResolver implements StatisticsProvider {
       CExpression nameExp, CFunctionType func, TargetFunctionsProvider targetFunctions) {
     Collection<CFunctionEntryNode> funcs = targetFunctions.getFunctionSet(func);
 
+    if (pointerState != null) {
+      CExpression pointer = nameExp;
+      if (pointer instanceof CPointerExpression) {
+        pointer = ((CPointerExpression) pointer).getOperand();
+      }
+      if (pointer.getExpressionType().getCanonicalType() instanceof CPointerType) {
+        funcs = narrowTargets(pointer, funcs);
+      }
+    }
+
     if (matchAssignedFunctionPointers) {
       CExpression expression = nameExp;
       if (expression instanceof CPointerExpression) {
@@ -17,7 +17,9 @@ import java.util.ArrayList;
 import java.util.Collection;
 import java.util.EnumSet;
 import java.util.List;
+import java.util.Map;
 import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
 import java.util.function.BiPredicate;
 import java.util.logging.Level;
 import org.sosy_lab.common.log.LogManager;
@@ -43,6 +45,10 @@ public class TargetFunctionsProvider {
   private final ImmutableSetMultimap<String, String> globalsMatching;
   private final BiPredicate<CFunctionType, CFunctionType> matchingFunctionCall;
 
+  /** The function sets per function type, which are shared by all calls with this type. */
+  private final Map<CFunctionType, List<CFunctionEntryNode>> functionSets =
+      new ConcurrentHashMap<>();
+
   public TargetFunctionsProvider(
       MachineModel pMachine,
       LogManager pLogger,
@@ -85,6 +91,10 @@ public class TargetFunctionsProvider {
   }
 
   public List<CFunctionEntryNode> getFunctionSet(CFunctionType func) {
+    return functionSets.computeIfAbsent(func, this::computeFunctionSet);
+  }
+
+  private List<CFunctionEntryNode> computeFunctionSet(CFunctionType func) {
     return from(candidateFunctions)
         .filter(CFunctionEntryNode.class)
         .filter(f -> matchingFunctionCall.test(func, f.getFunctionDefinition().getType()))
@@ -0,0 +1,177 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.postprocessing.global;
+
+import java.util.ArrayList;
+import java.util.List;
+import org.sosy_lab.cpachecker.cfa.CFACreationUtils;
+import org.sosy_lab.cpachecker.cfa.MutableCFA;
+import org.sosy_lab.cpachecker.cfa.ast.c.CBinaryExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CCastExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CCharLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CExpressionAssignmentStatement;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFloatLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIdExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIntegerLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CLeftHandSide;
+import org.sosy_lab.cpachecker.cfa.ast.c.CSimpleDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.CUnaryExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CVariableDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.DefaultCExpressionVisitor;
+import org.sosy_lab.cpachecker.cfa.model.BlankEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.exceptions.NoException;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.LiveVariables;
+
+/**
+ * Replaces assignments to local variables that are never read afterwards by blank edges.
+ *
+ * <p>Only stores whose right-hand side can neither fail nor have side effects are removed, i.e.,
+ * expressions without pointer dereferences, array accesses, divisions, or arithmetic that might
+ * overflow. Stores to global, addressed, or volatile variables are never removed, so analyses of
+ * all supported properties yield the same results on the simplified CFA. The blank edge keeps the
+ * raw statement and file location of the removed assignment, and the structure of the CFA is not
+ * changed, so the loop structure and the reverse postorder stay valid.
+ */
+public final class DeadStoreRemover {
+
+  private DeadStoreRemover() {}
+
+  /**
+   * Remove all dead stores of the C program represented by the given CFA.
+   *
+   * @param pCfa the CFA to simplify
+   * @param pLiveVariables the live variables of the CFA
+   * @return the number of removed assignments
+   */
+  public static int removeDeadStores(MutableCFA pCfa, LiveVariables pLiveVariables) {
+    List<CStatementEdge> deadStores = new ArrayList<>();
+    for (CFANode node : pCfa.getAllNodes()) {
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        if (edge instanceof CStatementEdge && isDeadStore((CStatementEdge) edge, pLiveVariables)) {
+          deadStores.add((CStatementEdge) edge);
+        }
+      }
+    }
+
+    for (CStatementEdge edge : deadStores) {
+      CFAEdge replacement =
+          new BlankEdge(
+              edge.getRawStatement(),
+              edge.getFileLocation(),
+              edge.getPredecessor(),
+              edge.getSuccessor(),
+              "dead store: " + edge.getDescription());
+      CFACreationUtils.removeEdgeFromNodes(edge);
+      CFACreationUtils.addEdgeUnconditionallyToCFA(replacement);
+    }
+    return deadStores.size();
+  }
+
+  private static boolean isDeadStore(CStatementEdge pEdge, LiveVariables pLiveVariables) {
+    if (!(pEdge.getStatement() instanceof CExpressionAssignmentStatement)) {
+      return false;
+    }
+    CExpressionAssignmentStatement assignment =
+        (CExpressionAssignmentStatement) pEdge.getStatement();
+
+    CLeftHandSide lhs = assignment.getLeftHandSide();
+    if (!(lhs instanceof CIdExpression)) {
+      return false;
+    }
+    CSimpleDeclaration declaration = ((CIdExpression) lhs).getDeclaration();
+    if (!(declaration instanceof CVariableDeclaration)
+        || ((CVariableDeclaration) declaration).isGlobal()
+        || isVolatile(declaration.getType())) {
+      return false;
+    }
+
+    return !pLiveVariables.isVariableLive(declaration, pEdge.getSuccessor())
+        && assignment.getRightHandSide().accept(SafeExpressionVisitor.INSTANCE);
+  }
+
+  private static boolean isVolatile(CType pType) {
+    return pType.isVolatile() || pType.getCanonicalType().isVolatile();
+  }
+
+  /**
+   * Checks whether an expression can be evaluated in every state without side effects, undefined
+   * behavior, or any other violation of a specification.
+   */
+  private static class SafeExpressionVisitor
+      extends DefaultCExpressionVisitor<Boolean, NoException> {
+
+    private static final SafeExpressionVisitor INSTANCE = new SafeExpressionVisitor();
+
+    @Override
+    protected Boolean visitDefault(CExpression pExp) {
+      return false;
+    }
+
+    @Override
+    public Boolean visit(CIdExpression pExp) {
+      return !isVolatile(pExp.getExpressionType());
+    }
+
+    @Override
+    public Boolean visit(CIntegerLiteralExpression pExp) {
+      return true;
+    }
+
+    @Override
+    public Boolean visit(CCharLiteralExpression pExp) {
+      return true;
+    }
+
+    @Override
+    public Boolean visit(CFloatLiteralExpression pExp) {
+      return true;
+    }
+
+    @Override
+    public Boolean visit(CCastExpression pExp) {
+      return pExp.getOperand().accept(this);
+    }
+
+    @Override
+    public Boolean visit(CUnaryExpression pExp) {
+      switch (pExp.getOperator()) {
+        case TILDE:
+          return pExp.getOperand().accept(this);
+        case AMPER:
+          return pExp.getOperand() instanceof CIdExpression;
+        default:
+          return false;
+      }
+    }
+
+    @Override
+    public Boolean visit(CBinaryExpression pExp) {
+      switch (pExp.getOperator()) {
+        case BINARY_AND:
+        case BINARY_OR:
+        case BINARY_XOR:
+        case LESS_EQUAL:
+        case LESS_THAN:
+        case GREATER_EQUAL:
+        case GREATER_THAN:
+        case EQUALS:
+        case NOT_EQUALS:
+          return pExp.getOperand1().accept(this) && pExp.getOperand2().accept(this);
+        default:
+          return false;
+      }
+    }
+  }
+}
@@ -0,0 +1,414 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.postprocessing.global;
+
+import java.math.BigInteger;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFACreationUtils;
+import org.sosy_lab.cpachecker.cfa.MutableCFA;
+import org.sosy_lab.cpachecker.cfa.ast.FileLocation;
+import org.sosy_lab.cpachecker.cfa.ast.c.CBinaryExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CBinaryExpression.BinaryOperator;
+import org.sosy_lab.cpachecker.cfa.ast.c.CBinaryExpressionBuilder;
+import org.sosy_lab.cpachecker.cfa.ast.c.CCastExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CExpressionAssignmentStatement;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIdExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIntegerLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CVariableDeclaration;
+import org.sosy_lab.cpachecker.cfa.model.BlankEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.c.CAssumeEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
+import org.sosy_lab.cpachecker.cfa.types.c.CBasicType;
+import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
+import org.sosy_lab.cpachecker.cfa.types.c.CSimpleType;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.util.LoopStructure;
+import org.sosy_lab.cpachecker.util.LoopStructure.Loop;
+
+/**
+ * Replaces the bodies of simple counting loops by the closed form of their effect, such that
+ * analyses can apply all iterations of such a loop in one step.
+ *
+ * <p>A loop is accelerated if it has a single loop head with the condition {@code i < n} or {@code
+ * i > n} and a body without branches that only adds constants to integer variables, where the
+ * counter {@code i} moves by one towards the bound {@code n}, which is a constant or a variable
+ * that is not changed in the loop. The body is replaced by assignments that add each constant
+ * multiplied by the number of remaining iterations and set the counter to the bound, so the loop
+ * is left after this single iteration. The closed form is computed in {@code long long}, which is
+ * larger than all accelerated variables, so it does not overflow where the loop did not, but
+ * overflows of the variables during the loop are not visible in the summary.
+ */
+public final class LoopAccelerator {
+
+  private static final String SUMMARY_DESCRIPTION = "loop summary";
+
+  private LoopAccelerator() {}
+
+  /**
+   * Accelerate all counting loops of the given CFA. Afterwards, the reverse postorder and the loop
+   * structure of the affected functions need to be recomputed.
+   *
+   * @param pCfa the CFA to transform
+   * @param pLoopStructure the loop structure of the CFA
+   * @param pLogger the logger for building expressions
+   * @return the number of accelerated loops
+   */
+  public static int accelerateLoops(
+      MutableCFA pCfa, LoopStructure pLoopStructure, LogManager pLogger) {
+    MachineModel machineModel = pCfa.getMachineModel();
+    CBinaryExpressionBuilder builder = new CBinaryExpressionBuilder(machineModel, pLogger);
+    // collect all loops first, as the loop structure is not updated by the replacements
+    List<CountingLoop> countingLoops = new ArrayList<>();
+    for (Loop loop : pLoopStructure.getAllLoops()) {
+      CountingLoop.of(loop, pLoopStructure, machineModel).ifPresent(countingLoops::add);
+    }
+    for (CountingLoop countingLoop : countingLoops) {
+      countingLoop.replaceBody(pCfa, builder);
+    }
+    return countingLoops.size();
+  }
+
+  /** A loop with a branch-free body that only adds constants to variables. */
+  private static final class CountingLoop {
+
+    private final CFANode head;
+    private final CAssumeEdge enteringEdge;
+    private final List<CFAEdge> bodyEdges;
+
+    /** The sum of the constants added to each variable in the body, by qualified name. */
+    private final Map<String, BigInteger> increments;
+
+    private final Map<String, CIdExpression> variables;
+    private final CIdExpression counter;
+    private final CExpression bound;
+    private final boolean increasing;
+
+    private CountingLoop(
+        CFANode pHead,
+        CAssumeEdge pEnteringEdge,
+        List<CFAEdge> pBodyEdges,
+        Map<String, BigInteger> pIncrements,
+        Map<String, CIdExpression> pVariables,
+        CIdExpression pCounter,
+        CExpression pBound,
+        boolean pIncreasing) {
+      head = pHead;
+      enteringEdge = pEnteringEdge;
+      bodyEdges = pBodyEdges;
+      increments = pIncrements;
+      variables = pVariables;
+      counter = pCounter;
+      bound = pBound;
+      increasing = pIncreasing;
+    }
+
+    private static Optional<CountingLoop> of(
+        Loop pLoop, LoopStructure pLoopStructure, MachineModel pMachineModel) {
+      if (pLoop.getLoopHeads().size() != 1 || pLoop.getOutgoingEdges().size() != 1) {
+        return Optional.empty();
+      }
+      CFANode head = pLoop.getLoopHeads().iterator().next();
+      if (pLoopStructure.getLoopsForLoopHead(head).size() != 1
+          || head.getNumLeavingEdges() != 2
+          || !(head.getLeavingEdge(0) instanceof CAssumeEdge)
+          || !(head.getLeavingEdge(1) instanceof CAssumeEdge)) {
+        return Optional.empty();
+      }
+      CFAEdge exitEdge = pLoop.getOutgoingEdges().iterator().next();
+      if (!exitEdge.getPredecessor().equals(head)) {
+        return Optional.empty();
+      }
+      CAssumeEdge enteringEdge =
+          (CAssumeEdge)
+              (head.getLeavingEdge(0).equals(exitEdge)
+                  ? head.getLeavingEdge(1)
+                  : head.getLeavingEdge(0));
+
+      // the body has to be a single path back to the head
+      List<CFAEdge> bodyEdges = new ArrayList<>();
+      Map<String, BigInteger> increments = new LinkedHashMap<>();
+      Map<String, CIdExpression> variables = new LinkedHashMap<>();
+      CFANode node = enteringEdge.getSuccessor();
+      while (!node.equals(head)) {
+        if (node.getNumEnteringEdges() != 1
+            || node.getNumLeavingEdges() != 1
+            || bodyEdges.size() >= pLoop.getLoopNodes().size()) {
+          return Optional.empty();
+        }
+        CFAEdge edge = node.getLeavingEdge(0);
+        if (edge instanceof CStatementEdge) {
+          if (!addIncrement((CStatementEdge) edge, increments, variables, pMachineModel)) {
+            return Optional.empty();
+          }
+        } else if (!(edge instanceof BlankEdge)) {
+          return Optional.empty();
+        }
+        bodyEdges.add(edge);
+        node = edge.getSuccessor();
+      }
+      if (bodyEdges.size() + 1 != pLoop.getLoopNodes().size()) {
+        return Optional.empty();
+      }
+
+      return fromCondition(head, enteringEdge, bodyEdges, increments, variables, pMachineModel);
+    }
+
+    /**
+     * Check that the edge has the form {@code x = x + c} or {@code x = x - c} for an integer
+     * variable {@code x} and an integer constant {@code c} and add {@code c} to the increment of
+     * {@code x}.
+     */
+    private static boolean addIncrement(
+        CStatementEdge pEdge,
+        Map<String, BigInteger> pIncrements,
+        Map<String, CIdExpression> pVariables,
+        MachineModel pMachineModel) {
+      if (!(pEdge.getStatement() instanceof CExpressionAssignmentStatement)) {
+        return false;
+      }
+      CExpressionAssignmentStatement assignment =
+          (CExpressionAssignmentStatement) pEdge.getStatement();
+      if (!(assignment.getLeftHandSide() instanceof CIdExpression)
+          || !(assignment.getRightHandSide() instanceof CBinaryExpression)) {
+        return false;
+      }
+      CIdExpression variable = (CIdExpression) assignment.getLeftHandSide();
+      if (!isAcceleratableVariable(variable, pMachineModel)) {
+        return false;
+      }
+      CBinaryExpression rhs = (CBinaryExpression) assignment.getRightHandSide();
+      BigInteger increment;
+      if (isSameVariable(rhs.getOperand1(), variable)
+          && rhs.getOperand2() instanceof CIntegerLiteralExpression) {
+        increment = ((CIntegerLiteralExpression) rhs.getOperand2()).getValue();
+        if (rhs.getOperator() == BinaryOperator.MINUS) {
+          increment = increment.negate();
+        } else if (rhs.getOperator() != BinaryOperator.PLUS) {
+          return false;
+        }
+      } else if (isSameVariable(rhs.getOperand2(), variable)
+          && rhs.getOperand1() instanceof CIntegerLiteralExpression
+          && rhs.getOperator() == BinaryOperator.PLUS) {
+        increment = ((CIntegerLiteralExpression) rhs.getOperand1()).getValue();
+      } else {
+        return false;
+      }
+      String name = variable.getDeclaration().getQualifiedName();
+      pIncrements.merge(name, increment, BigInteger::add);
+      pVariables.putIfAbsent(name, variable);
+      return true;
+    }
+
+    /**
+     * Check that the loop condition compares a variable that moves by one towards the bound, and
+     * that the bound is a constant in the range of the counter or a variable of the same type that
+     * is not changed in the loop.
+     */
+    private static Optional<CountingLoop> fromCondition(
+        CFANode pHead,
+        CAssumeEdge pEnteringEdge,
+        List<CFAEdge> pBodyEdges,
+        Map<String, BigInteger> pIncrements,
+        Map<String, CIdExpression> pVariables,
+        MachineModel pMachineModel) {
+      if (!(pEnteringEdge.getExpression() instanceof CBinaryExpression)) {
+        return Optional.empty();
+      }
+      CBinaryExpression condition = (CBinaryExpression) pEnteringEdge.getExpression();
+      BinaryOperator operator = condition.getOperator();
+      if (!pEnteringEdge.getTruthAssumption()) {
+        operator = operator.getOppositLogicalOperator();
+      }
+      CExpression counterExpression = condition.getOperand1();
+      CExpression bound = condition.getOperand2();
+      if (!(counterExpression instanceof CIdExpression)
+          || !pIncrements.containsKey(
+              ((CIdExpression) counterExpression).getDeclaration().getQualifiedName())) {
+        // the counter may be the right operand, e.g. "n > i"
+        counterExpression = condition.getOperand2();
+        bound = condition.getOperand1();
+        operator = mirror(operator);
+      }
+      if (!(counterExpression instanceof CIdExpression)) {
+        return Optional.empty();
+      }
+      CIdExpression counter = (CIdExpression) counterExpression;
+      BigInteger step = pIncrements.get(counter.getDeclaration().getQualifiedName());
+      boolean increasing;
+      if (operator == BinaryOperator.LESS_THAN && BigInteger.ONE.equals(step)) {
+        increasing = true;
+      } else if (operator == BinaryOperator.GREATER_THAN
+          && BigInteger.ONE.negate().equals(step)) {
+        increasing = false;
+      } else {
+        return Optional.empty();
+      }
+
+      CSimpleType counterType = (CSimpleType) counter.getExpressionType().getCanonicalType();
+      if (bound instanceof CIntegerLiteralExpression) {
+        BigInteger value = ((CIntegerLiteralExpression) bound).getValue();
+        if (value.compareTo(pMachineModel.getMinimalIntegerValue(counterType)) < 0
+            || value.compareTo(pMachineModel.getMaximalIntegerValue(counterType)) > 0) {
+          return Optional.empty();
+        }
+      } else if (!(bound instanceof CIdExpression)
+          || !isAcceleratableVariable((CIdExpression) bound, pMachineModel)
+          || !bound.getExpressionType().getCanonicalType().equals(counterType)
+          || pIncrements.containsKey(
+              ((CIdExpression) bound).getDeclaration().getQualifiedName())) {
+        return Optional.empty();
+      }
+
+      return Optional.of(
+          new CountingLoop(
+              pHead,
+              pEnteringEdge,
+              pBodyEdges,
+              pIncrements,
+              pVariables,
+              counter,
+              bound,
+              increasing));
+    }
+
+    private static BinaryOperator mirror(BinaryOperator pOperator) {
+      switch (pOperator) {
+        case LESS_THAN:
+          return BinaryOperator.GREATER_THAN;
+        case GREATER_THAN:
+          return BinaryOperator.LESS_THAN;
+        case LESS_EQUAL:
+          return BinaryOperator.GREATER_EQUAL;
+        case GREATER_EQUAL:
+          return BinaryOperator.LESS_EQUAL;
+        default:
+          return pOperator;
+      }
+    }
+
+    /**
+     * Replace the body of the loop by the summary edges. The entering edge of the loop is kept, so
+     * the summary is only applied if the loop condition holds.
+     */
+    private void replaceBody(MutableCFA pCfa, CBinaryExpressionBuilder pBuilder) {
+      FileLocation fileLocation = enteringEdge.getFileLocation();
+
+      // the number of remaining iterations, which is positive if the loop condition holds
+      CExpression iterations =
+          increasing
+              ? pBuilder.buildBinaryExpressionUnchecked(
+                  toLongLong(bound), toLongLong(counter), BinaryOperator.MINUS)
+              : pBuilder.buildBinaryExpressionUnchecked(
+                  toLongLong(counter), toLongLong(bound), BinaryOperator.MINUS);
+
+      List<CExpressionAssignmentStatement> summary = new ArrayList<>();
+      for (Map.Entry<String, BigInteger> increment : increments.entrySet()) {
+        CIdExpression variable = variables.get(increment.getKey());
+        if (variable.getDeclaration().equals(counter.getDeclaration())
+            || increment.getValue().signum() == 0) {
+          continue;
+        }
+        CExpression change =
+            pBuilder.buildBinaryExpressionUnchecked(
+                new CIntegerLiteralExpression(
+                    fileLocation, CNumericTypes.LONG_LONG_INT, increment.getValue()),
+                iterations,
+                BinaryOperator.MULTIPLY);
+        CExpression value =
+            pBuilder.buildBinaryExpressionUnchecked(
+                toLongLong(variable), change, BinaryOperator.PLUS);
+        summary.add(
+            new CExpressionAssignmentStatement(
+                fileLocation,
+                variable,
+                new CCastExpression(fileLocation, variable.getExpressionType(), value)));
+      }
+      CType counterType = counter.getExpressionType();
+      summary.add(
+          new CExpressionAssignmentStatement(
+              fileLocation,
+              counter,
+              bound.getExpressionType().getCanonicalType().equals(counterType.getCanonicalType())
+                  ? bound
+                  : new CCastExpression(fileLocation, counterType, bound)));
+
+      for (CFAEdge edge : bodyEdges) {
+        CFACreationUtils.removeEdgeFromNodes(edge);
+        if (!edge.getPredecessor().equals(head)) {
+          pCfa.removeNode(edge.getPredecessor());
+        }
+      }
+      CFACreationUtils.removeEdgeFromNodes(enteringEdge);
+
+      CFANode predecessor = new CFANode(head.getFunction());
+      pCfa.addNode(predecessor);
+      CFACreationUtils.addEdgeUnconditionallyToCFA(
+          new CAssumeEdge(
+              enteringEdge.getRawStatement(),
+              enteringEdge.getFileLocation(),
+              head,
+              predecessor,
+              enteringEdge.getExpression(),
+              enteringEdge.getTruthAssumption()));
+      for (int i = 0; i < summary.size(); i++) {
+        CFANode successor;
+        if (i == summary.size() - 1) {
+          successor = head;
+        } else {
+          successor = new CFANode(head.getFunction());
+          pCfa.addNode(successor);
+        }
+        CFACreationUtils.addEdgeUnconditionallyToCFA(
+            new CStatementEdge(
+                SUMMARY_DESCRIPTION, summary.get(i), fileLocation, predecessor, successor));
+        predecessor = successor;
+      }
+    }
+
+    private static CExpression toLongLong(CExpression pExpression) {
+      return new CCastExpression(
+          pExpression.getFileLocation(), CNumericTypes.LONG_LONG_INT, pExpression);
+    }
+  }
+
+  private static boolean isSameVariable(CExpression pExpression, CIdExpression pVariable) {
+    return pExpression instanceof CIdExpression
+        && ((CIdExpression) pExpression).getDeclaration().equals(pVariable.getDeclaration());
+  }
+
+  /**
+   * Check that the variable is a non-volatile integer variable that is smaller than {@code long
+   * long}, such that the summary can be computed in {@code long long} without overflows.
+   */
+  private static boolean isAcceleratableVariable(
+      CIdExpression pVariable, MachineModel pMachineModel) {
+    if (!(pVariable.getDeclaration() instanceof CVariableDeclaration)) {
+      return false;
+    }
+    CType type = pVariable.getExpressionType();
+    if (type.isVolatile() || !(type.getCanonicalType() instanceof CSimpleType)) {
+      return false;
+    }
+    CSimpleType simpleType = (CSimpleType) type.getCanonicalType();
+    return !simpleType.isVolatile()
+        && (simpleType.getType() == CBasicType.INT
+            || simpleType.getType() == CBasicType.UNSPECIFIED
+            || simpleType.getType() == CBasicType.CHAR)
+        && pMachineModel.getSizeof(simpleType) < pMachineModel.getSizeofLongLongInt();
+  }
+}
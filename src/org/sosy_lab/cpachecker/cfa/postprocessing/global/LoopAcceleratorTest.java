@@ -0,0 +1,75 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.postprocessing.global;
+
+import static com.google.common.collect.FluentIterable.from;
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import org.junit.Test;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+
+public class LoopAcceleratorTest {
+
+  private static ImmutableList<String> getStatements(String... pLines) throws Exception {
+    Configuration config =
+        TestDataTools.configurationForTest().setOption("cfa.accelerateLoops", "true").build();
+    CFA cfa = TestDataTools.makeCFA(config, pLines);
+    ImmutableList.Builder<String> statements = ImmutableList.builder();
+    for (CFANode node : cfa.getAllNodes()) {
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        if (edge instanceof CStatementEdge) {
+          statements.add(((CStatementEdge) edge).getStatement().toASTString());
+        }
+      }
+    }
+    return statements.build();
+  }
+
+  @Test
+  public void testCountingLoop() throws Exception {
+    ImmutableList<String> statements =
+        getStatements(
+            "int main() {",
+            "  int n = __VERIFIER_nondet_int();",
+            "  int j = 0;",
+            "  for (int i = 0; i < n; i++) {",
+            "    j += 2;",
+            "  }",
+            "  return j;",
+            "}");
+
+    assertThat(statements).contains("i = n;");
+    assertThat(from(statements).filter(s -> s.startsWith("j = (int)"))).hasSize(1);
+    assertThat(statements).doesNotContain("i = i + 1;");
+  }
+
+  @Test
+  public void testLoopWithBranchIsKept() throws Exception {
+    ImmutableList<String> statements =
+        getStatements(
+            "int main() {",
+            "  int j = 0;",
+            "  for (int i = 0; i < 1000000; i++) {",
+            "    if (i == 5) {",
+            "      j++;",
+            "    }",
+            "  }",
+            "  return j;",
+            "}");
+
+    assertThat(statements).contains("i = i + 1;");
+  }
+}
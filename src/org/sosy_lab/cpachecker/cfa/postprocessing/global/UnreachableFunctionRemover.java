@@ -0,0 +1,98 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cfa.postprocessing.global;
+
+import com.google.common.collect.TreeMultimap;
+import java.util.ArrayDeque;
+import java.util.Deque;
+import java.util.HashSet;
+import java.util.NavigableMap;
+import java.util.Set;
+import java.util.TreeMap;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+import org.sosy_lab.cpachecker.cfa.ParseResult;
+import org.sosy_lab.cpachecker.cfa.ast.ADeclaration;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.Pair;
+
+/**
+ * Removes the CFAs of all functions that can never be called from the main function, before any
+ * post-processing is done on them.
+ *
+ * <p>A function is considered reachable if its name occurs as an identifier in the code of some
+ * edge of a reachable function or in a global declaration. This over-approximates direct calls as
+ * well as all ways of taking the address of a function (e.g., for function pointers or thread
+ * creation), so it is sound without a points-to analysis. It has to be applied before call edges
+ * are inserted.
+ */
+public final class UnreachableFunctionRemover {
+
+  private static final Pattern IDENTIFIER = Pattern.compile("[A-Za-z_$][A-Za-z0-9_$]*");
+
+  private UnreachableFunctionRemover() {}
+
+  /**
+   * Return a parse result that contains only the functions of the given one that are reachable
+   * from the given main function. The global declarations are kept unchanged.
+   */
+  public static ParseResult removeUnreachableFunctions(
+      ParseResult pParseResult, FunctionEntryNode pMainFunction) {
+    NavigableMap<String, FunctionEntryNode> functions = pParseResult.getFunctions();
+    TreeMultimap<String, CFANode> nodes = pParseResult.getCFANodes();
+
+    Set<String> reachable = new HashSet<>();
+    Deque<String> waitlist = new ArrayDeque<>();
+    reachable.add(pMainFunction.getFunctionName());
+    waitlist.add(pMainFunction.getFunctionName());
+    for (Pair<ADeclaration, String> declaration : pParseResult.getGlobalDeclarations()) {
+      addReferencedFunctions(
+          declaration.getFirst().toASTString(), functions.keySet(), reachable, waitlist);
+    }
+
+    while (!waitlist.isEmpty()) {
+      String function = waitlist.pop();
+      for (CFANode node : nodes.get(function)) {
+        for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+          addReferencedFunctions(edge.getCode(), functions.keySet(), reachable, waitlist);
+        }
+      }
+    }
+
+    if (reachable.size() == functions.size()) {
+      return pParseResult;
+    }
+
+    NavigableMap<String, FunctionEntryNode> reachableFunctions = new TreeMap<>();
+    TreeMultimap<String, CFANode> reachableNodes = TreeMultimap.create();
+    for (String function : reachable) {
+      reachableFunctions.put(function, functions.get(function));
+      reachableNodes.putAll(function, nodes.get(function));
+    }
+    return new ParseResult(
+        reachableFunctions,
+        reachableNodes,
+        pParseResult.getGlobalDeclarations(),
+        pParseResult.getFileNames());
+  }
+
+  private static void addReferencedFunctions(
+      String pCode, Set<String> pFunctions, Set<String> pReachable, Deque<String> pWaitlist) {
+    Matcher matcher = IDENTIFIER.matcher(pCode);
+    while (matcher.find()) {
+      String identifier = matcher.group();
+      if (pFunctions.contains(identifier) && pReachable.add(identifier)) {
+        pWaitlist.push(identifier);
+      }
+    }
+  }
+}
@@ -0,0 +1,192 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cmdline;
+
+import com.google.common.base.CharMatcher;
+import com.google.common.base.Splitter;
+import com.google.common.collect.ImmutableSet;
+import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.PrintStream;
+import java.nio.charset.Charset;
+import java.util.List;
+import java.util.Locale;
+import java.util.logging.Level;
+import org.sosy_lab.common.ShutdownManager;
+import org.sosy_lab.common.annotations.SuppressForbidden;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.log.BasicLogManager;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.log.LoggingOptions;
+import org.sosy_lab.cpachecker.cmdline.CPAMain.Config;
+import org.sosy_lab.cpachecker.cmdline.CPAMain.MainOptions;
+import org.sosy_lab.cpachecker.cmdline.CmdLineArguments.InvalidCmdlineArgumentException;
+import org.sosy_lab.cpachecker.core.CPAchecker;
+import org.sosy_lab.cpachecker.core.CPAcheckerResult;
+import org.sosy_lab.cpachecker.core.algorithm.pcc.ProofGenerator;
+import org.sosy_lab.cpachecker.core.counterexample.ReportGenerator;
+import org.sosy_lab.cpachecker.util.globalinfo.GlobalInfo;
+import org.sosy_lab.cpachecker.util.resources.ResourceLimitChecker;
+
+/**
+ * Entry point for running CPAchecker as a long-lived process that verifies many tasks one after
+ * another, such that JVM startup, class loading, and JIT warm-up are paid only once instead of once
+ * per task.
+ *
+ * <p>Tasks are read from stdin, one per line. Each line contains the command-line arguments of one
+ * CPAchecker run (exactly as they would be given to {@link CPAMain}) separated by whitespace, e.g.,
+ * <code>-predicateAnalysis -spec default -outputpath output/task1 program.c</code>. Empty lines are
+ * ignored, and the daemon terminates at the end of the input. Each task gets its own configuration,
+ * log, output directory, and resource limits (which are measured from the start of the task).
+ *
+ * <p>For each task, exactly one line is written to stdout after the task has finished, either
+ * <code>RESULT &lt;task number&gt; &lt;result&gt;</code> with one of the values of {@link
+ * CPAcheckerResult.Result}, or <code>ERROR &lt;task number&gt; &lt;message&gt;</code> if the task
+ * could not be started. All other output that CPAchecker would write to stdout (e.g., the
+ * verification result and statistics) is redirected to stderr, such that stdout contains only
+ * these lines (clients should nevertheless ignore other lines, because start scripts like
+ * scripts/cpa.sh may write messages to stdout before the JVM is started).
+ *
+ * <p>Tasks are run sequentially, because some parts of CPAchecker use global state (e.g., {@link
+ * GlobalInfo} and the default converter for file options). To verify several tasks in parallel,
+ * start several daemons. Note that arguments that make {@link CPAMain} terminate the JVM (e.g.,
+ * invalid arguments) also terminate the daemon.
+ */
+@SuppressForbidden("System.out in this class is ok")
+public final class CPADaemon {
+
+  private static final ImmutableSet<String> UNSUPPORTED_ARGUMENTS =
+      ImmutableSet.of("-h", "-help", "-version", "-printOptions", "-secureMode");
+
+  private static final Splitter ARGUMENT_SPLITTER =
+      Splitter.on(CharMatcher.whitespace()).omitEmptyStrings();
+
+  private CPADaemon() {} // prevent instantiation
+
+  @SuppressFBWarnings(
+      value = "DM_DEFAULT_ENCODING",
+      justification = "Default encoding is the correct one for stdin and stdout.")
+  public static void main(String[] args) throws IOException {
+    // CPAchecker uses American English for output,
+    // so make sure numbers are formatted appropriately.
+    Locale.setDefault(Locale.US);
+
+    // Only the task results are written to the real stdout.
+    PrintStream results = System.out;
+    System.setOut(System.err);
+
+    BufferedReader tasks =
+        new BufferedReader(new InputStreamReader(System.in, Charset.defaultCharset()));
+    int taskNumber = 0;
+    String line;
+    while ((line = tasks.readLine()) != null) {
+      List<String> taskArgs = ARGUMENT_SPLITTER.splitToList(line);
+      if (taskArgs.isEmpty()) {
+        continue;
+      }
+      taskNumber++;
+
+      String response;
+      if (taskArgs.stream().anyMatch(UNSUPPORTED_ARGUMENTS::contains)) {
+        response = "ERROR " + taskNumber + " Unsupported argument in task: " + line;
+      } else {
+        response = runTask(taskNumber, taskArgs.toArray(new String[0]));
+      }
+      results.println(response);
+      results.flush();
+    }
+  }
+
+  /**
+   * Run a single task in the current JVM. This mirrors {@link CPAMain#main(String[])}, except that
+   * it does not install shutdown hooks or terminate the JVM, and that problems with the task are
+   * reported in the returned response line.
+   */
+  @SuppressWarnings("resource") // We don't close LogManager
+  private static String runTask(int taskNumber, String[] args) {
+    Configuration config;
+    Config p;
+    try {
+      p = CPAMain.createConfiguration(args);
+    } catch (InvalidCmdlineArgumentException e) {
+      return "ERROR " + taskNumber + " Could not process command line arguments: " + e.getMessage();
+    } catch (IOException e) {
+      return "ERROR " + taskNumber + " Could not read config file " + e.getMessage();
+    } catch (InvalidConfigurationException e) {
+      return "ERROR " + taskNumber + " Invalid configuration: " + e.getMessage();
+    } catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+      return "ERROR " + taskNumber + " Interrupted: " + e.getMessage();
+    }
+    config = p.configuration;
+
+    final LoggingOptions logOptions;
+    try {
+      logOptions = new LoggingOptions(config);
+    } catch (InvalidConfigurationException e) {
+      return "ERROR " + taskNumber + " Invalid configuration: " + e.getMessage();
+    }
+    final LogManager logManager = BasicLogManager.create(logOptions);
+    config.enableLogging(logManager);
+    GlobalInfo.getInstance().storeLogManager(logManager);
+
+    final ShutdownManager shutdownManager = ShutdownManager.create();
+    final CPAchecker cpachecker;
+    final ResourceLimitChecker limits;
+    final ReportGenerator reportGenerator;
+    ProofGenerator proofGenerator = null;
+    MainOptions options = new MainOptions();
+    try {
+      config.inject(options);
+      if (options.programs.isEmpty()) {
+        throw new InvalidConfigurationException("Please specify a program to analyze.");
+      }
+      CPAMain.dumpConfiguration(options, config, logManager);
+      config = CPAMain.detectFrontendLanguageIfNecessary(options, config, logManager);
+
+      cpachecker = new CPAchecker(config, logManager, shutdownManager);
+      if (options.doPCC) {
+        proofGenerator = new ProofGenerator(config, logManager, shutdownManager.getNotifier());
+      }
+      reportGenerator =
+          new ReportGenerator(config, logManager, logOptions.getOutputFile(), options.programs);
+      limits = ResourceLimitChecker.fromConfiguration(config, logManager, shutdownManager);
+    } catch (InvalidConfigurationException e) {
+      logManager.logUserException(Level.SEVERE, e, "Invalid configuration");
+      logManager.flush();
+      return "ERROR " + taskNumber + " Invalid configuration: " + e.getMessage();
+    }
+
+    limits.start();
+    CPAcheckerResult result;
+    try {
+      result = cpachecker.run(options.programs, p.properties);
+      if (proofGenerator != null) {
+        proofGenerator.generateProof(result);
+      }
+    } finally {
+      limits.cancel();
+      Thread.interrupted(); // clear interrupted flag
+    }
+
+    try {
+      CPAMain.printResultAndStatistics(
+          result, p.outputPath, options, reportGenerator, logManager);
+    } catch (IOException e) {
+      logManager.logUserException(Level.WARNING, e, "Could not write statistics to file");
+    }
+    System.out.flush();
+    logManager.flush();
+
+    return "RESULT " + taskNumber + " " + result.getResult();
+  }
+}
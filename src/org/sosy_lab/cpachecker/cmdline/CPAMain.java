@@ -247,7 +247,7 @@ public class CPAMain {
       //required=true, NOT required because we want to give a nicer user message ourselves
       description = "A String, denoting the programs to be analyzed"
     )
-    private ImmutableList<String> programs = ImmutableList.of();
+    ImmutableList<String> programs = ImmutableList.of();
 
     @Option(secure=true,
         description="Programming language of the input program. If not given explicitly, "
@@ -272,10 +272,10 @@ public class CPAMain {
     private boolean printStatistics = false;
 
     @Option(secure=true, name = "pcc.proofgen.doPCC", description = "Generate and dump a proof")
-    private boolean doPCC = false;
+    boolean doPCC = false;
   }
 
-  private static void dumpConfiguration(MainOptions options, Configuration config,
+  static void dumpConfiguration(MainOptions options, Configuration config,
       LogManager logManager) {
     if (options.configurationOutputFile != null) {
       try {
@@ -298,7 +298,7 @@ public class CPAMain {
    *
    * @return A Configuration object, the output directory, and the specification properties.
    */
-  private static Config createConfiguration(String[] args)
+  static Config createConfiguration(String[] args)
       throws InvalidConfigurationException, InvalidCmdlineArgumentException, IOException,
           InterruptedException {
     // if there are some command line arguments, process them
@@ -718,7 +718,7 @@ public class CPAMain {
   }
 
   @SuppressWarnings("deprecation")
-  private static void printResultAndStatistics(
+  static void printResultAndStatistics(
       CPAcheckerResult mResult,
       String outputDirectory,
       MainOptions options,
@@ -797,13 +797,13 @@ public class CPAMain {
 
   private CPAMain() { } // prevent instantiation
 
-  private static class Config {
+  static class Config {
 
-    private final Configuration configuration;
+    final Configuration configuration;
 
-    private final String outputPath;
+    final String outputPath;
 
-    private final Set<SpecificationProperty> properties;
+    final Set<SpecificationProperty> properties;
 
     public Config(
         Configuration pConfiguration, String pOutputPath, Set<SpecificationProperty> pProperties) {
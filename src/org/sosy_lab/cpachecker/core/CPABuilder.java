@@ -8,11 +8,13 @@
 
 package org.sosy_lab.cpachecker.core;
 
+import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
 import com.google.common.base.Splitter;
 import com.google.common.base.Throwables;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.Iterables;
+import com.google.common.collect.Lists;
 import java.lang.reflect.InvocationTargetException;
 import java.lang.reflect.Method;
 import java.lang.reflect.Modifier;
@@ -21,11 +23,14 @@ import java.util.HashSet;
 import java.util.List;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
 import java.util.logging.Level;
 import org.sosy_lab.common.Classes;
 import org.sosy_lab.common.Classes.UnexpectedCheckedException;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -37,7 +42,9 @@ import org.sosy_lab.cpachecker.core.reachedset.AggregatedReachedSets;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
 import org.sosy_lab.cpachecker.core.specification.Specification;
 import org.sosy_lab.cpachecker.cpa.automaton.Automaton;
+import org.sosy_lab.cpachecker.cpa.automaton.AutomatonProduct;
 import org.sosy_lab.cpachecker.cpa.automaton.ControlAutomatonCPA;
+import org.sosy_lab.cpachecker.cpa.automaton.InvalidAutomatonException;
 import org.sosy_lab.cpachecker.cpa.composite.CompositeCPA;
 import org.sosy_lab.cpachecker.cpa.location.LocationCPA;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
@@ -51,10 +58,40 @@ public class CPABuilder {
 
   private static final Splitter LIST_SPLITTER = Splitter.on(',').trimResults().omitEmptyStrings();
 
+  /**
+   * Caches for the reflective lookups of CPA classes and their verified factory methods, which
+   * are repeated whenever a CPA is built again, e.g., for restarts and nested analyses.
+   */
+  private static final ConcurrentMap<String, Class<?>> CPA_CLASSES = new ConcurrentHashMap<>();
+
+  private static final ConcurrentMap<Class<?>, Method> FACTORY_METHODS =
+      new ConcurrentHashMap<>();
+
   @Option(secure=true, name=CPA_OPTION_NAME,
       description="CPA to use (see doc/Configuration.md for more documentation on this)")
   private String cpaName = CompositeCPA.class.getCanonicalName();
 
+  @Option(
+      secure = true,
+      name = "specification.combineAutomata",
+      description =
+          "Combine the specification automata into a single product automaton, such that only one"
+              + " automaton CPA needs to be run. Only deterministic automata without variables,"
+              + " actions, assertions, and assumptions can be combined, the other ones are kept as"
+              + " separate CPAs. Automaton-specific options are not applied to the product, and if"
+              + " several properties are violated at the same edge only one of them is reported,"
+              + " so this should not be used for verifying several properties separately.")
+  private boolean combineSpecificationAutomata = false;
+
+  @Option(
+      secure = true,
+      name = "specification.combineAutomata.maxStates",
+      description =
+          "Maximal number of states of the product of the specification automata. If the product"
+              + " would be larger, the automata are kept separate.")
+  @IntegerOption(min = 1)
+  private int maxProductStates = 1000;
+
   private final Configuration config;
   private final LogManager logger;
   private final ShutdownNotifier shutdownNotifier;
@@ -86,6 +123,9 @@ public class CPABuilder {
     Set<String> usedAliases = new HashSet<>();
 
     List<Automaton> specAutomata = specification.getSpecificationAutomata();
+    if (combineSpecificationAutomata) {
+      specAutomata = combineAutomata(specAutomata);
+    }
     List<ConfigurableProgramAnalysis> cpas =
         new ArrayList<>(specAutomata.size() + additionalAutomata.size());
 
@@ -118,6 +158,46 @@ public class CPABuilder {
     return cpa;
   }
 
+  /**
+   * Replaces all automata that can be part of a product automaton by their product and keeps the
+   * remaining ones as they are.
+   */
+  private List<Automaton> combineAutomata(List<Automaton> pAutomata)
+      throws InvalidConfigurationException {
+    List<Automaton> combinable = new ArrayList<>();
+    List<Automaton> others = new ArrayList<>();
+    for (Automaton automaton : pAutomata) {
+      (AutomatonProduct.isSupported(automaton) ? combinable : others).add(automaton);
+    }
+    if (combinable.size() < 2) {
+      return pAutomata;
+    }
+
+    String name =
+        "Product_" + Joiner.on('_').join(Lists.transform(combinable, Automaton::getName));
+    Optional<Automaton> product;
+    try {
+      product = AutomatonProduct.build(name, combinable, maxProductStates);
+    } catch (InvalidAutomatonException e) {
+      throw new InvalidConfigurationException(
+          "Could not combine specification automata: " + e.getMessage(), e);
+    }
+    if (!product.isPresent()) {
+      logger.logf(
+          Level.INFO,
+          "Not combining %d specification automata because the product has more than %d states.",
+          combinable.size(),
+          maxProductStates);
+      return pAutomata;
+    }
+    logger.logf(
+        Level.INFO,
+        "Combined %d specification automata into one automaton with %d states.",
+        combinable.size(),
+        product.orElseThrow().getNumberOfStates());
+    return ImmutableList.<Automaton>builder().add(product.orElseThrow()).addAll(others).build();
+  }
+
   private ConfigurableProgramAnalysis buildCPAs(
       String optionValue,
       String optionName,
@@ -228,12 +308,15 @@ public class CPABuilder {
 
   private Class<?> getCPAClass(String optionName, String pCpaName)
       throws InvalidConfigurationException {
-    Class<?> cpaClass;
-    try {
-      cpaClass = Classes.forName(pCpaName, CPA_CLASS_PREFIX);
-    } catch (ClassNotFoundException e) {
-      throw new InvalidConfigurationException(
-          "Option " + optionName + " is set to unknown CPA " + pCpaName, e);
+    Class<?> cpaClass = CPA_CLASSES.get(pCpaName);
+    if (cpaClass == null) {
+      try {
+        cpaClass = Classes.forName(pCpaName, CPA_CLASS_PREFIX);
+      } catch (ClassNotFoundException e) {
+        throw new InvalidConfigurationException(
+            "Option " + optionName + " is set to unknown CPA " + pCpaName, e);
+      }
+      CPA_CLASSES.putIfAbsent(pCpaName, cpaClass);
     }
 
     if (!ConfigurableProgramAnalysis.class.isAssignableFrom(cpaClass)) {
@@ -247,23 +330,10 @@ public class CPABuilder {
   }
 
   private CPAFactory getFactoryInstance(String pCpaName, Class<?> cpaClass) throws CPAException {
-
-    // get factory method
-    Method factoryMethod;
-    try {
-      factoryMethod = cpaClass.getMethod("factory", (Class<?>[]) null);
-    } catch (NoSuchMethodException e) {
-      throw new InvalidComponentException(cpaClass, "CPA", "No public static method \"factory\" with zero parameters.");
-    }
-
-    // verify signature
-    if (!Modifier.isStatic(factoryMethod.getModifiers())) {
-      throw new InvalidComponentException(cpaClass, "CPA", "Factory method is not static.");
-    }
-
-    String exception = Classes.verifyDeclaredExceptions(factoryMethod, CPAException.class);
-    if (exception != null) {
-      throw new InvalidComponentException(cpaClass, "CPA", "Factory method declares the unsupported checked exception " + exception + " .");
+    Method factoryMethod = FACTORY_METHODS.get(cpaClass);
+    if (factoryMethod == null) {
+      factoryMethod = getFactoryMethod(cpaClass);
+      FACTORY_METHODS.putIfAbsent(cpaClass, factoryMethod);
     }
 
     // invoke factory method
@@ -288,6 +358,28 @@ public class CPABuilder {
     return (CPAFactory)factoryObj;
   }
 
+  private static Method getFactoryMethod(Class<?> cpaClass) throws InvalidComponentException {
+    // get factory method
+    Method factoryMethod;
+    try {
+      factoryMethod = cpaClass.getMethod("factory", (Class<?>[]) null);
+    } catch (NoSuchMethodException e) {
+      throw new InvalidComponentException(cpaClass, "CPA", "No public static method \"factory\" with zero parameters.");
+    }
+
+    // verify signature
+    if (!Modifier.isStatic(factoryMethod.getModifiers())) {
+      throw new InvalidComponentException(cpaClass, "CPA", "Factory method is not static.");
+    }
+
+    String exception = Classes.verifyDeclaredExceptions(factoryMethod, CPAException.class);
+    if (exception != null) {
+      throw new InvalidComponentException(cpaClass, "CPA", "Factory method declares the unsupported checked exception " + exception + " .");
+    }
+
+    return factoryMethod;
+  }
+
   private boolean createAndSetChildrenCPAs(
       String pCpaName,
       String cpaAlias,
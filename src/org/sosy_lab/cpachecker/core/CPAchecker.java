@@ -18,6 +18,7 @@ import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Sets;
 import com.google.common.io.Resources;
+import java.io.BufferedInputStream;
 import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.InputStream;
@@ -82,6 +83,7 @@ import org.sosy_lab.cpachecker.util.LoopStructure;
 import org.sosy_lab.cpachecker.util.automaton.TargetLocationProvider;
 import org.sosy_lab.cpachecker.util.automaton.TargetLocationProviderImpl;
 import org.sosy_lab.cpachecker.util.globalinfo.GlobalInfo;
+import org.sosy_lab.cpachecker.util.resources.MemoryPressureMonitor;
 
 @Options
 public class CPAchecker {
@@ -487,7 +489,8 @@ public class CPAchecker {
     } else {
       // load CFA from serialization file
       logger.logf(Level.INFO, "Reading CFA from file \"%s\"", serializedCfaFile);
-      try (InputStream inputStream = Files.newInputStream(serializedCfaFile);
+      try (InputStream inputStream =
+              new BufferedInputStream(Files.newInputStream(serializedCfaFile));
           InputStream gzipInputStream = new GZIPInputStream(inputStream);
           ObjectInputStream ois = new ObjectInputStream(gzipInputStream)) {
         cfa = (CFA) ois.readObject();
@@ -515,7 +518,8 @@ public class CPAchecker {
 
   private AlgorithmStatus runAlgorithm(final Algorithm algorithm,
       final ReachedSet reached,
-      final MainCPAStatistics stats) throws CPAException, InterruptedException {
+      final MainCPAStatistics stats)
+      throws CPAException, InterruptedException, InvalidConfigurationException {
 
     logger.log(Level.INFO, "Starting analysis ...");
 
@@ -525,6 +529,13 @@ public class CPAchecker {
     CPAcheckerBean mxbean = new CPAcheckerBean(reached, logger, shutdownManager);
     mxbean.register();
 
+    ProgressMetricsWriter progressWriter =
+        new ProgressMetricsWriter(config, logger, reached, algorithm);
+    progressWriter.start();
+
+    MemoryPressureMonitor memoryPressureMonitor = new MemoryPressureMonitor(config, logger);
+    memoryPressureMonitor.start();
+
     stats.startAnalysisTimer();
     try {
       int counterExampleCount = 0;
@@ -550,6 +561,8 @@ public class CPAchecker {
 
     } finally {
       stats.stopAnalysisTimer();
+      progressWriter.stop();
+      memoryPressureMonitor.stop();
 
       // unregister management interface for CPAchecker
       mxbean.unregister();
@@ -32,6 +32,7 @@ import org.sosy_lab.cpachecker.core.algorithm.ExceptionHandlingAlgorithm;
 import org.sosy_lab.cpachecker.core.algorithm.ExternalCBMCAlgorithm;
 import org.sosy_lab.cpachecker.core.algorithm.FaultLocalizationWithCoverage;
 import org.sosy_lab.cpachecker.core.algorithm.FaultLocalizationWithTraceFormula;
+import org.sosy_lab.cpachecker.core.algorithm.HornClauseExportAlgorithm;
 import org.sosy_lab.cpachecker.core.algorithm.MPIPortfolioAlgorithm;
 import org.sosy_lab.cpachecker.core.algorithm.NoopAlgorithm;
 import org.sosy_lab.cpachecker.core.algorithm.ParallelAlgorithm;
@@ -274,6 +275,14 @@ public class CoreComponentsFactory {
       description = "collect undefined functions")
   private boolean useUndefinedFunctionCollector = false;
 
+  @Option(
+      secure = true,
+      name = "algorithm.exportHornClauses",
+      description =
+          "do not analyze the program, but export it as constrained Horn clauses for external"
+              + " Horn solvers (cf. option hornClauseExport.file)")
+  private boolean exportHornClauses = false;
+
   @Option(
       secure = true,
       name = "extractRequirements.customInstruction",
@@ -400,6 +409,9 @@ public class CoreComponentsFactory {
     if (useUndefinedFunctionCollector) {
       logger.log(Level.INFO, "Using undefined function collector");
       algorithm = new UndefinedFunctionCollectorAlgorithm(config, logger, shutdownNotifier, cfa);
+    } else if (exportHornClauses) {
+      logger.log(Level.INFO, "Using export of Horn clauses");
+      algorithm = new HornClauseExportAlgorithm(config, logger, shutdownNotifier, cfa);
     } else if (useNonTerminationWitnessValidation) {
       logger.log(Level.INFO, "Using validator for violation witnesses for termination");
       algorithm =
@@ -671,6 +683,7 @@ public class CoreComponentsFactory {
         || asConditionalVerifier
         || useNonTerminationWitnessValidation
         || useUndefinedFunctionCollector
+        || exportHornClauses
         || constructProgramSlice
         || useFaultLocalizationWithDistanceMetrics) {
       // hard-coded dummy CPA
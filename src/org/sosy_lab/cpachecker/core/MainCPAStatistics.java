@@ -16,11 +16,14 @@ import static com.google.common.collect.FluentIterable.from;
 import com.google.common.base.Function;
 import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
+import com.google.common.base.Throwables;
 import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ListMultimap;
 import com.google.common.collect.Multimaps;
 import com.google.common.collect.Multiset;
 import com.google.common.collect.Ordering;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
 import java.io.IOException;
 import java.io.PrintStream;
 import java.io.Writer;
@@ -29,8 +32,13 @@ import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.List;
 import java.util.Map;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.concurrent.TimeUnit;
 import java.util.logging.Level;
 import javax.management.JMException;
@@ -40,6 +48,7 @@ import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
 import org.sosy_lab.common.configuration.FileOption.Type;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -63,7 +72,9 @@ import org.sosy_lab.cpachecker.core.reachedset.PartitionedReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.bam.AbstractBAMCPA;
+import org.sosy_lab.cpachecker.cpa.coverage.CoverageCPA;
 import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.CPAs;
 import org.sosy_lab.cpachecker.util.coverage.CoverageCollector;
 import org.sosy_lab.cpachecker.util.coverage.CoverageData;
 import org.sosy_lab.cpachecker.util.coverage.CoverageReportGcov;
@@ -73,6 +84,7 @@ import org.sosy_lab.cpachecker.util.resources.MemoryStatistics;
 import org.sosy_lab.cpachecker.util.resources.ProcessCpuTime;
 import org.sosy_lab.cpachecker.util.statistics.StatInt;
 import org.sosy_lab.cpachecker.util.statistics.StatKind;
+import org.sosy_lab.cpachecker.util.statistics.StateSizeEstimator;
 import org.sosy_lab.cpachecker.util.statistics.StatisticsUtils;
 import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
 
@@ -100,6 +112,14 @@ class MainCPAStatistics implements Statistics {
     description="track memory usage of JVM during runtime")
   private boolean monitorMemoryUsage = true;
 
+  @Option(
+      secure = true,
+      name = "statistics.stateSizes",
+      description =
+          "estimate the memory used by the states of each CPA in the final reached set"
+              + " (based on a sample of the reached set)")
+  private boolean estimateStateSizes = false;
+
   @Option(
     secure = true,
     name = "cinvariants.export",
@@ -127,9 +147,30 @@ class MainCPAStatistics implements Statistics {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private Path outputCoverageFile = Paths.get("coverage.info");
 
+  @Option(
+      secure = true,
+      name = "coverage.fromTransfer",
+      description =
+          "use the edges recorded by the CoverageCPA during the analysis, if it is part of the"
+              + " analysis, instead of traversing the reached set (faster for large reached sets,"
+              + " but also counts edges of states that were removed later, e.g., by refinement)")
+  private boolean coverageFromTransfer = false;
+
+  @Option(
+      secure = true,
+      name = "statistics.outputFileWriterThreads",
+      description =
+          "number of threads that write the output files of the different statistics "
+              + "concurrently after the analysis (0 writes them one after another). "
+              + "Only use this if no output needs the solver, e.g., no witness export "
+              + "with invariants, because solvers are not thread-safe.")
+  @IntegerOption(min = 0)
+  private int outputFileWriterThreads = 0;
+
   private final LogManager logger;
   private final Collection<Statistics> subStats;
   private final @Nullable MemoryStatistics memStats;
+  private final @Nullable StateSizeEstimator stateSizeEstimator;
   private final @Nullable CExpressionInvariantExporter cExpressionInvariantExporter;
   private Thread memStatsThread;
 
@@ -162,6 +203,7 @@ class MainCPAStatistics implements Statistics {
     } else {
       memStats = null;
     }
+    stateSizeEstimator = estimateStateSizes ? new StateSizeEstimator(pConfig) : null;
 
     programTime.start();
     try {
@@ -284,6 +326,9 @@ class MainCPAStatistics implements Statistics {
     if (result != Result.NOT_YET_STARTED) {
       try {
         printReachedSetStatistics(reached, out);
+        if (stateSizeEstimator != null) {
+          StateSizeEstimator.printEstimate(stateSizeEstimator.estimate(reached), out);
+        }
       } catch (OutOfMemoryError e) {
         logger.logUserException(Level.WARNING, e,
             "Out of memory while generating statistics about final reached set");
@@ -317,16 +362,23 @@ class MainCPAStatistics implements Statistics {
 
   private void exportCoverage(PrintStream out, UnmodifiableReachedSet reached) {
     if (exportCoverage && cfa != null && reached.size() > 1) {
-      FluentIterable<AbstractState> reachedStates = FluentIterable.from(reached);
+      CoverageCPA coverageCpa =
+          coverageFromTransfer && cpa != null ? CPAs.retrieveCPA(cpa, CoverageCPA.class) : null;
+      CoverageData infosPerFile;
+      if (coverageCpa != null) {
+        infosPerFile = coverageCpa.getCoverageData();
+      } else {
+        FluentIterable<AbstractState> reachedStates = FluentIterable.from(reached);
 
-      // hack to get all reached states for BAM
-      if (cpa instanceof AbstractBAMCPA) {
-        Collection<ReachedSet> otherReachedSets =
-            ((AbstractBAMCPA) cpa).getData().getCache().getAllCachedReachedStates();
-        reachedStates = reachedStates.append(FluentIterable.concat(otherReachedSets));
-      }
+        // hack to get all reached states for BAM
+        if (cpa instanceof AbstractBAMCPA) {
+          Collection<ReachedSet> otherReachedSets =
+              ((AbstractBAMCPA) cpa).getData().getCache().getAllCachedReachedStates();
+          reachedStates = reachedStates.append(FluentIterable.concat(otherReachedSets));
+        }
 
-      CoverageData infosPerFile = CoverageCollector.fromReachedSet(reachedStates, cfa);
+        infosPerFile = CoverageCollector.fromReachedSet(reachedStates, cfa);
+      }
 
       out.println();
       out.println("Code Coverage");
@@ -406,11 +458,46 @@ class MainCPAStatistics implements Statistics {
   public void writeOutputFiles(Result pResult, UnmodifiableReachedSet pReached) {
     assert pReached != null : "ReachedSet may be null only if analysis not yet started";
 
+    if (outputFileWriterThreads > 0 && subStats.size() > 1) {
+      writeOutputFilesConcurrently(pResult, pReached);
+      return;
+    }
     for (Statistics s : subStats) {
       StatisticsUtils.writeOutputFiles(s, logger, pResult, pReached);
     }
   }
 
+  /**
+   * Write the output files of all sub-statistics with a thread pool. The analysis has finished at
+   * this point, so the reached set is only read.
+   */
+  private void writeOutputFilesConcurrently(Result pResult, UnmodifiableReachedSet pReached) {
+    ExecutorService executor =
+        Executors.newFixedThreadPool(
+            Math.min(outputFileWriterThreads, subStats.size()),
+            new ThreadFactoryBuilder()
+                .setDaemon(true)
+                .setNameFormat("output-file-writer-%d")
+                .build());
+    try {
+      List<Future<?>> futures = new ArrayList<>(subStats.size());
+      for (Statistics s : subStats) {
+        futures.add(
+            executor.submit(() -> StatisticsUtils.writeOutputFiles(s, logger, pResult, pReached)));
+      }
+      for (Future<?> future : futures) {
+        try {
+          Uninterruptibles.getUninterruptibly(future);
+        } catch (ExecutionException e) {
+          Throwables.throwIfUnchecked(e.getCause());
+          throw new AssertionError(e.getCause());
+        }
+      }
+    } finally {
+      executor.shutdownNow();
+    }
+  }
+
   private void printReachedSetStatistics(UnmodifiableReachedSet reached, PrintStream out) {
     assert reached != null : "ReachedSet may be null only if analysis not yet started";
 
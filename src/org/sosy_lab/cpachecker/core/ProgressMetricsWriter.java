@@ -0,0 +1,183 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core;
+
+import java.io.IOException;
+import java.io.Writer;
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryUsage;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.ConcurrentModificationException;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.concurrent.TimeUnit;
+import java.util.logging.Level;
+import javax.management.JMException;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.Concurrency;
+import org.sosy_lab.common.JSON;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.configuration.TimeSpanOption;
+import org.sosy_lab.common.io.IO;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
+import org.sosy_lab.cpachecker.core.algorithm.Algorithm;
+import org.sosy_lab.cpachecker.core.algorithm.ProgressReportingAlgorithm;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
+import org.sosy_lab.cpachecker.util.resources.ProcessCpuTime;
+import org.sosy_lab.cpachecker.util.statistics.StateSizeEstimator;
+import org.sosy_lab.cpachecker.util.statistics.StateSizeEstimator.StateTypeSize;
+
+/**
+ * Periodically appends the current progress of the analysis (e.g., the size of the reached set
+ * and the memory usage) as one JSON object per line to a file, such that long-running analyses
+ * can be monitored while they are running. The values are read from a separate thread without
+ * synchronizing with the analysis, so they are only approximations.
+ */
+@Options(prefix = "statistics.progress")
+class ProgressMetricsWriter implements Runnable {
+
+  @Option(
+      secure = true,
+      name = "export",
+      description =
+          "periodically write the progress of the analysis to a file in JSON Lines format")
+  private boolean export = false;
+
+  @Option(secure = true, name = "file", description = "file for the progress of the analysis")
+  @FileOption(FileOption.Type.OUTPUT_FILE)
+  private @Nullable Path file = Paths.get("progress.jsonl");
+
+  @Option(
+      secure = true,
+      name = "interval",
+      description = "time between two entries in the file for the progress of the analysis")
+  @TimeSpanOption(codeUnit = TimeUnit.MILLISECONDS, defaultUserUnit = TimeUnit.SECONDS, min = 1)
+  private TimeSpan interval = TimeSpan.ofSeconds(10);
+
+  @Option(
+      secure = true,
+      name = "stateSizes",
+      description =
+          "add an estimate of the memory used by the states of each CPA to each entry"
+              + " in the file for the progress of the analysis (expensive for large reached sets)")
+  private boolean stateSizes = false;
+
+  private final LogManager logger;
+  private final ReachedSet reached;
+  private final Algorithm algorithm;
+  private final @Nullable StateSizeEstimator stateSizeEstimator;
+
+  private @Nullable Thread thread;
+
+  private final long startTime = System.nanoTime();
+  private long lastTime = startTime;
+  private int lastReachedSize = 0;
+
+  ProgressMetricsWriter(
+      Configuration pConfig, LogManager pLogger, ReachedSet pReached, Algorithm pAlgorithm)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+    reached = pReached;
+    algorithm = pAlgorithm;
+    stateSizeEstimator = stateSizes ? new StateSizeEstimator(pConfig) : null;
+  }
+
+  /** Start writing the progress in a separate thread, if this is enabled. */
+  void start() {
+    if (export && file != null) {
+      thread = Concurrency.newDaemonThread("CPAchecker progress metrics writer", this);
+      thread.start();
+    }
+  }
+
+  /** Stop writing the progress, the writer will still add a final entry. */
+  void stop() {
+    if (thread != null) {
+      thread.interrupt();
+    }
+  }
+
+  @Override
+  public void run() {
+    try (Writer out = IO.openOutputFile(file, StandardCharsets.UTF_8)) {
+      boolean interrupted = false;
+      while (!interrupted) {
+        try {
+          TimeUnit.MILLISECONDS.sleep(interval.asMillis());
+        } catch (InterruptedException e) {
+          // analysis has finished, write final entry
+          interrupted = true;
+        }
+        JSON.writeJSONString(collectMetrics(), out);
+        out.write('\n');
+        out.flush();
+      }
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write progress of the analysis");
+    }
+  }
+
+  private Map<String, Object> collectMetrics() {
+    Map<String, Object> metrics = new LinkedHashMap<>();
+    long now = System.nanoTime();
+    metrics.put("time", TimeUnit.NANOSECONDS.toMillis(now - startTime));
+
+    int reachedSize = reached.size();
+    metrics.put("reachedSet", reachedSize);
+    metrics.put("waitlist", reached.getWaitlist().size());
+    double seconds = (now - lastTime) / 1e9;
+    metrics.put("statesPerSecond", seconds > 0 ? (reachedSize - lastReachedSize) / seconds : 0);
+    lastTime = now;
+    lastReachedSize = reachedSize;
+
+    if (algorithm instanceof ProgressReportingAlgorithm) {
+      metrics.put("progress", ((ProgressReportingAlgorithm) algorithm).getProgress());
+    }
+
+    MemoryUsage heap = ManagementFactory.getMemoryMXBean().getHeapMemoryUsage();
+    metrics.put("heapUsed", heap.getUsed());
+    metrics.put("heapCommitted", heap.getCommitted());
+    long gcCount = 0;
+    long gcTime = 0;
+    for (GarbageCollectorMXBean gc : ManagementFactory.getGarbageCollectorMXBeans()) {
+      gcCount += Math.max(gc.getCollectionCount(), 0);
+      gcTime += Math.max(gc.getCollectionTime(), 0);
+    }
+    metrics.put("gcCount", gcCount);
+    metrics.put("gcTime", gcTime);
+
+    try {
+      metrics.put("cpuTime", TimeUnit.NANOSECONDS.toMillis(ProcessCpuTime.read()));
+    } catch (JMException e) {
+      // not supported by this JVM, omit value
+    }
+
+    if (stateSizeEstimator != null) {
+      try {
+        Map<String, Long> sizes = new LinkedHashMap<>();
+        for (StateTypeSize size : stateSizeEstimator.estimate(reached)) {
+          sizes.put(size.getType(), size.getBytes());
+        }
+        metrics.put("stateSizes", sizes);
+      } catch (ConcurrentModificationException e) {
+        // reached set was modified by the analysis, omit value for this entry
+      }
+    }
+    return metrics;
+  }
+}
@@ -43,6 +43,7 @@ import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.value.refiner.UnsoundRefiner;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.exceptions.RefinementFailedException;
+import org.sosy_lab.cpachecker.util.statistics.TraceEvents.RefinementEvent;
 
 public class CEGARAlgorithm implements Algorithm, StatisticsProvider, ReachedSetUpdater {
 
@@ -289,14 +290,18 @@ public class CEGARAlgorithm implements Algorithm, StatisticsProvider, ReachedSet
     sizeOfReachedSetBeforeRefinement = reached.size();
 
     stats.refinementTimer.start();
+    RefinementEvent event = new RefinementEvent(stats.countRefinements, reached.size());
+    event.begin();
     boolean refinementResult;
     try {
       refinementResult = mRefiner.performRefinement(reached);
+      event.setSuccessful(refinementResult);
 
     } catch (RefinementFailedException e) {
       stats.countFailedRefinements++;
       throw e;
     } finally {
+      event.commit();
       stats.refinementTimer.stop();
     }
 
@@ -24,6 +24,7 @@ import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.ClassOption;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -43,12 +44,14 @@ import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
+import org.sosy_lab.cpachecker.core.reachedset.ConcurrentPartitionedReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGMergeJoinCPAEnabledAnalysis;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.resources.MemoryPressureMonitor;
 import org.sosy_lab.cpachecker.util.statistics.AbstractStatValue;
 import org.sosy_lab.cpachecker.util.statistics.StatCounter;
 import org.sosy_lab.cpachecker.util.statistics.StatHist;
@@ -173,6 +176,26 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
         + " Useful for incomplete analysis with no counterexample checking.")
     private boolean reportFalseAsUnknown = false;
 
+    @Option(
+        secure = true,
+        name = "parallel.numberOfThreads",
+        description =
+            "Number of threads for exploring the state space in parallel with work stealing. "
+                + "Values larger than 1 require merge-sep, thread-safe CPA operators, and "
+                + "analysis.reachedSet=CONCURRENTPARTITIONED, "
+                + "otherwise the sequential algorithm is used.")
+    private int numberOfThreads = 1;
+
+    @Option(
+        secure = true,
+        name = "parallel.timerSampleRate",
+        description =
+            "Measure only one of this many calls of the CPA operators for the statistics of the"
+                + " parallel CPA algorithm and extrapolate the total time, 0 disables time"
+                + " measurement for these calls.")
+    @IntegerOption(min = 0)
+    private int timerSampleRate = 1;
+
     private final ForcedCovering forcedCovering;
 
     private final ConfigurableProgramAnalysis cpa;
@@ -193,11 +216,32 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
         forcedCovering = null;
       }
 
+      if (numberOfThreads < 1) {
+        throw new InvalidConfigurationException(
+            "Invalid number of threads for CPA algorithm: " + numberOfThreads);
+      }
+      if (numberOfThreads > 1) {
+        if (cpa.getMergeOperator() != MergeSepOperator.getInstance()) {
+          throw new InvalidConfigurationException(
+              "Parallel CPA algorithm is only supported for analyses with merge-sep.");
+        }
+        if (forcedCovering != null) {
+          throw new InvalidConfigurationException(
+              "Parallel CPA algorithm does not support forced coverings.");
+        }
+      }
     }
 
     @Override
     public CPAAlgorithm newInstance() {
-      return new CPAAlgorithm(cpa, logger, shutdownNotifier, forcedCovering, reportFalseAsUnknown);
+      return new CPAAlgorithm(
+          cpa,
+          logger,
+          shutdownNotifier,
+          forcedCovering,
+          numberOfThreads,
+          timerSampleRate,
+          reportFalseAsUnknown);
     }
   }
 
@@ -223,9 +267,14 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
 
   private final AlgorithmStatus status;
 
+  /** The parallel variant of this algorithm, if it was configured. */
+  private final @Nullable WorkStealingCPAAlgorithm parallelAlgorithm;
+
   private CPAAlgorithm(ConfigurableProgramAnalysis cpa, LogManager logger,
       ShutdownNotifier pShutdownNotifier,
       ForcedCovering pForcedCovering,
+      int pNumberOfThreads,
+      int pTimerSampleRate,
       boolean pIsImprecise) {
 
     transferRelation = cpa.getTransferRelation();
@@ -236,10 +285,28 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
     this.shutdownNotifier = pShutdownNotifier;
     this.forcedCovering = pForcedCovering;
     status = AlgorithmStatus.SOUND_AND_PRECISE.withPrecise(!pIsImprecise);
+
+    if (pNumberOfThreads > 1) {
+      parallelAlgorithm =
+          new WorkStealingCPAAlgorithm(
+              cpa, logger, pShutdownNotifier, pNumberOfThreads, pTimerSampleRate, pIsImprecise);
+    } else {
+      parallelAlgorithm = null;
+    }
   }
 
   @Override
   public AlgorithmStatus run(final ReachedSet reachedSet) throws CPAException, InterruptedException {
+    if (parallelAlgorithm != null) {
+      if (reachedSet instanceof ConcurrentPartitionedReachedSet) {
+        return parallelAlgorithm.run(reachedSet);
+      }
+      logger.log(
+          Level.WARNING,
+          "Parallel CPA algorithm requires a thread-safe reached set "
+              + "(analysis.reachedSet=CONCURRENTPARTITIONED), using sequential algorithm.");
+    }
+
     stats.totalTimer.start();
     try {
       return run0(reachedSet);
@@ -252,6 +319,7 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
   private AlgorithmStatus run0(final ReachedSet reachedSet) throws CPAException, InterruptedException {
     while (reachedSet.hasWaitingState()) {
       shutdownNotifier.shutdownIfNecessary();
+      MemoryPressureMonitor.shedCachesIfRequested();
 
       stats.countIterations++;
 
@@ -268,7 +336,9 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
       final Precision precision = reachedSet.getPrecision(state);
       stats.chooseTimer.stop();
 
-      logger.log(Level.FINER, "Retrieved state from waitlist");
+      if (logger.wouldBeLogged(Level.FINER)) {
+        logger.log(Level.FINER, "Retrieved state from waitlist");
+      }
       try {
         if (handleState(state, precision, reachedSet)) {
           // Prec operator requested break
@@ -296,7 +366,13 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
   private boolean handleState(
       final AbstractState state, final Precision precision, final ReachedSet reachedSet)
       throws CPAException, InterruptedException {
-    logger.log(Level.ALL, "Current state is", state, "with precision", precision);
+    // The following log statements are executed for every state, so avoid creating the varargs
+    // arrays if the messages would be discarded anyway.
+    final boolean logFiner = logger.wouldBeLogged(Level.FINER);
+    final boolean logAll = logger.wouldBeLogged(Level.ALL);
+    if (logAll) {
+      logger.log(Level.ALL, "Current state is", state, "with precision", precision);
+    }
 
     if (forcedCovering != null) {
       stats.forcedCoveringTimer.start();
@@ -323,15 +399,21 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
     // we could continue analysis on a CPATransferException with the next state from waitlist.
 
     int numSuccessors = successors.size();
-    logger.log(Level.FINER, "Current state has", numSuccessors, "successors");
+    if (logFiner) {
+      logger.log(Level.FINER, "Current state has", numSuccessors, "successors");
+    }
     stats.countSuccessors += numSuccessors;
     stats.maxSuccessors = Math.max(numSuccessors, stats.maxSuccessors);
 
     for (Iterator<? extends AbstractState> it = successors.iterator(); it.hasNext();) {
       AbstractState successor = it.next();
       shutdownNotifier.shutdownIfNecessary();
-      logger.log(Level.FINER, "Considering successor of current state");
-      logger.log(Level.ALL, "Successor of", state, "\nis", successor);
+      if (logFiner) {
+        logger.log(Level.FINER, "Considering successor of current state");
+      }
+      if (logAll) {
+        logger.log(Level.ALL, "Successor of", state, "\nis", successor);
+      }
 
       stats.precisionTimer.start();
       PrecisionAdjustmentResult precAdjustmentResult;
@@ -355,7 +437,9 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
         stats.stopTimer.start();
         boolean stop;
         try {
-          stop = stopOperator.stop(successor, reachedSet.getReached(successor), successorPrecision);
+          stop =
+              stopOperator.stop(
+                  successor, reachedSet.getCoveringCandidates(successor), successorPrecision);
         } finally {
           stats.stopTimer.stop();
         }
@@ -396,17 +480,23 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
           List<AbstractState> toRemove = new ArrayList<>();
           List<Pair<AbstractState, Precision>> toAdd = new ArrayList<>();
           try {
-            logger.log(
-                Level.FINER, "Considering", reached.size(), "states from reached set for merge");
+            if (logFiner) {
+              logger.log(
+                  Level.FINER, "Considering", reached.size(), "states from reached set for merge");
+            }
             for (AbstractState reachedState : reached) {
               shutdownNotifier.shutdownIfNecessary();
               AbstractState mergedState =
                   mergeOperator.merge(successor, reachedState, successorPrecision);
 
               if (!mergedState.equals(reachedState)) {
-                logger.log(Level.FINER, "Successor was merged with state from reached set");
-                logger.log(
-                    Level.ALL, "Merged", successor, "\nand", reachedState, "\n-->", mergedState);
+                if (logFiner) {
+                  logger.log(Level.FINER, "Successor was merged with state from reached set");
+                }
+                if (logAll) {
+                  logger.log(
+                      Level.ALL, "Merged", successor, "\nand", reachedState, "\n-->", mergedState);
+                }
                 stats.countMerge++;
 
                 toRemove.add(reachedState);
@@ -432,17 +522,23 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
       stats.stopTimer.start();
       boolean stop;
       try {
-        stop = stopOperator.stop(successor, reached, successorPrecision);
+        stop =
+            stopOperator.stop(
+                successor, reachedSet.getCoveringCandidates(successor), successorPrecision);
       } finally {
         stats.stopTimer.stop();
       }
 
       if (stop) {
-        logger.log(Level.FINER, "Successor is covered or unreachable, not adding to waitlist");
+        if (logFiner) {
+          logger.log(Level.FINER, "Successor is covered or unreachable, not adding to waitlist");
+        }
         stats.countStop++;
 
       } else {
-        logger.log(Level.FINER, "No need to stop, adding successor to waitlist");
+        if (logFiner) {
+          logger.log(Level.FINER, "No need to stop, adding successor to waitlist");
+        }
 
         stats.addTimer.start();
         reachedSet.add(successor, successorPrecision);
@@ -458,6 +554,9 @@ public class CPAAlgorithm implements Algorithm, StatisticsProvider {
     if (forcedCovering instanceof StatisticsProvider) {
       ((StatisticsProvider)forcedCovering).collectStatistics(pStatsCollection);
     }
+    if (parallelAlgorithm != null) {
+      parallelAlgorithm.collectStatistics(pStatsCollection);
+    }
     pStatsCollection.add(stats);
   }
 }
@@ -26,6 +26,7 @@ import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.Optionals;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -107,6 +108,23 @@ public class FaultLocalizationWithTraceFormula
       description="ban faults with certain variables")
   private String ban = "";
 
+  @Option(
+      secure = true,
+      name = "maxsat.incremental",
+      description =
+          "assert the trace formula only once on a single prover and check the sets of selectors"
+              + " as assumptions, caching the unsat cores (for MAXSAT and MAXORG)")
+  private boolean incremental = false;
+
+  @Option(
+      secure = true,
+      name = "maxsat.threads",
+      description =
+          "number of threads that check independent candidate sets in parallel"
+              + " (for MAXSAT with maxsat.incremental)")
+  @IntegerOption(min = 1)
+  private int threads = 1;
+
   public FaultLocalizationWithTraceFormula(
       final Algorithm pStoreAlgorithm,
       final Configuration pConfig,
@@ -144,10 +162,10 @@ public class FaultLocalizationWithTraceFormula
 
     switch (algorithmType){
       case MAXORG:
-        faultAlgorithm = new OriginalMaxSatAlgorithm();
+        faultAlgorithm = new OriginalMaxSatAlgorithm(incremental);
         break;
       case MAXSAT:
-        faultAlgorithm = new ModifiedMaxSatAlgorithm();
+        faultAlgorithm = new ModifiedMaxSatAlgorithm(incremental, threads);
         break;
       case ERRINV:
         faultAlgorithm = new ErrorInvariantsAlgorithm(pShutdownNotifier, pConfig, logger);
@@ -173,6 +191,16 @@ public class FaultLocalizationWithTraceFormula
       throw new InvalidConfigurationException(
           "The option reduceselectors requires the MAXSAT algorithm");
     }
+    if (incremental
+        && !algorithmType.equals(AlgorithmTypes.MAXSAT)
+        && !algorithmType.equals(AlgorithmTypes.MAXORG)) {
+      throw new InvalidConfigurationException(
+          "The option maxsat.incremental requires the MAXSAT or MAXORG algorithm");
+    }
+    if (threads > 1 && (!incremental || !algorithmType.equals(AlgorithmTypes.MAXSAT))) {
+      throw new InvalidConfigurationException(
+          "The option maxsat.threads requires the MAXSAT algorithm with maxsat.incremental");
+    }
     if (!options.getDisable().isBlank() && algorithmType.equals(AlgorithmTypes.ERRINV)) {
       throw new InvalidConfigurationException(
           "The option ban will be ignored because it is not applicable on the error invariants"
@@ -0,0 +1,407 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import java.io.IOException;
+import java.io.Writer;
+import java.nio.charset.Charset;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.OptionalInt;
+import java.util.Set;
+import java.util.TreeMap;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.io.IO;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.ast.AExpression;
+import org.sosy_lab.cpachecker.cfa.ast.AFunctionCall;
+import org.sosy_lab.cpachecker.cfa.ast.AIdExpression;
+import org.sosy_lab.cpachecker.cfa.model.AStatementEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionCallEdge;
+import org.sosy_lab.cpachecker.core.AnalysisDirection;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormula;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManager;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManagerImpl;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap.SSAMapBuilder;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing.PointerTargetSet;
+import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.QuantifiedFormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.Formula;
+import org.sosy_lab.java_smt.api.FormulaType;
+import org.sosy_lab.java_smt.api.FunctionDeclaration;
+
+/**
+ * Algorithm that does not verify the program, but exports it as a set of constrained Horn clauses
+ * in SMT-LIB2 format, such that it can be given to external Horn solvers.
+ *
+ * <p>There is one uninterpreted predicate per cut point of the CFA, i.e., for the entry of each
+ * function and for each loop head. The transitions between two cut points are encoded as one path
+ * formula by the configured {@link PathFormulaManager}, similar to large-block encoding. The
+ * arguments of all predicates are the same list of all program variables, the values before the
+ * transition are represented by the SSA index 1. Function calls are not matched with their
+ * returns, so the clauses over-approximate the program if a function is called from several
+ * places. Heap contents are only represented if they are encoded as variables (arrays).
+ */
+@Options(prefix = "hornClauseExport")
+public class HornClauseExportAlgorithm implements Algorithm {
+
+  private static final int INITIAL_INDEX = 1;
+  private static final String PREDICATE_PREFIX = "inv_N";
+
+  @Option(secure = true, description = "file for the exported Horn clauses in SMT-LIB2 format")
+  @FileOption(FileOption.Type.OUTPUT_FILE)
+  private Path file = Paths.get("program.smt2");
+
+  @Option(
+      secure = true,
+      description = "functions whose call is treated as reaching an error, i.e., as a query")
+  private Set<String> errorFunctions = ImmutableSet.of("reach_error", "__VERIFIER_error");
+
+  private final LogManager logger;
+  private final ShutdownNotifier shutdownNotifier;
+  private final CFA cfa;
+  private final Solver solver;
+  private final FormulaManagerView fmgr;
+  private final BooleanFormulaManagerView bfmgr;
+  private final QuantifiedFormulaManagerView qfmgr;
+  private final PathFormulaManager pfmgr;
+
+  /** The path formulas of the transitions from one cut point to the others and to an error. */
+  private static class BlockSummary {
+    private final Map<CFANode, PathFormula> successors = new LinkedHashMap<>();
+    private @Nullable PathFormula error = null;
+  }
+
+  public HornClauseExportAlgorithm(
+      Configuration pConfig, LogManager pLogger, ShutdownNotifier pShutdownNotifier, CFA pCfa)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+    shutdownNotifier = pShutdownNotifier;
+    cfa = pCfa;
+
+    solver = Solver.create(pConfig, pLogger, pShutdownNotifier);
+    fmgr = solver.getFormulaManager();
+    bfmgr = fmgr.getBooleanFormulaManager();
+    try {
+      qfmgr = fmgr.getQuantifiedFormulaManager();
+    } catch (UnsupportedOperationException e) {
+      solver.close();
+      throw new InvalidConfigurationException(
+          "Exporting Horn clauses requires a solver with support for quantifiers", e);
+    }
+    pfmgr =
+        new PathFormulaManagerImpl(
+            fmgr, pConfig, pLogger, pShutdownNotifier, pCfa, AnalysisDirection.FORWARD);
+  }
+
+  @Override
+  public AlgorithmStatus run(ReachedSet pReachedSet) throws CPAException, InterruptedException {
+    try {
+      exportHornClauses();
+    } finally {
+      solver.close();
+    }
+
+    // clear reached set and therefore waitlist, nothing was analyzed
+    pReachedSet.clear();
+    return AlgorithmStatus.NO_PROPERTY_CHECKED;
+  }
+
+  private void exportHornClauses() throws CPAException, InterruptedException {
+    Set<CFANode> candidates = new HashSet<>(cfa.getAllFunctionHeads());
+    candidates.addAll(cfa.getAllLoopHeads().orElse(ImmutableSet.of()));
+    List<CFANode> cutPoints = collectCutPoints(candidates);
+
+    // Determine the program variables with their types from summaries with an empty SSA map,
+    // and summarize the blocks again with all variables at the initial index.
+    SSAMapBuilder initialSsa = SSAMap.emptySSAMap().builder();
+    Map<String, FormulaType<?>> variables = new TreeMap<>();
+    for (CFANode cutPoint : cutPoints) {
+      BlockSummary summary = summarizeBlock(cutPoint, candidates, pfmgr.makeEmptyPathFormula());
+      for (PathFormula pf : getPathFormulas(summary)) {
+        collectVariables(pf, initialSsa, variables);
+      }
+    }
+    PathFormula initial =
+        new PathFormula(
+            bfmgr.makeTrue(), initialSsa.build(), PointerTargetSet.emptyPointerTargetSet(), 0);
+
+    Map<CFANode, FunctionDeclaration<BooleanFormula>> predicates = new HashMap<>();
+    List<FormulaType<?>> argumentTypes = ImmutableList.copyOf(variables.values());
+    for (CFANode cutPoint : cutPoints) {
+      predicates.put(
+          cutPoint,
+          fmgr.getFunctionFormulaManager()
+              .declareUF(
+                  PREDICATE_PREFIX + cutPoint.getNodeNumber(),
+                  FormulaType.BooleanType,
+                  argumentTypes));
+    }
+
+    int clauses = 0;
+    try (Writer w = IO.openOutputFile(file, Charset.defaultCharset())) {
+      Set<String> declarations = new HashSet<>();
+      w.write("(set-logic HORN)\n");
+
+      BooleanFormula entry =
+          fmgr.getFunctionFormulaManager()
+              .callUF(predicates.get(cfa.getMainFunction()), instantiate(variables, null));
+      writeClause(entry, w, declarations);
+      clauses++;
+
+      for (CFANode cutPoint : cutPoints) {
+        shutdownNotifier.shutdownIfNecessary();
+        BlockSummary summary = summarizeBlock(cutPoint, candidates, initial);
+        BooleanFormula before =
+            fmgr.getFunctionFormulaManager()
+                .callUF(predicates.get(cutPoint), instantiate(variables, null));
+
+        for (Map.Entry<CFANode, PathFormula> successor : summary.successors.entrySet()) {
+          PathFormula pf = successor.getValue();
+          BooleanFormula after =
+              fmgr.getFunctionFormulaManager()
+                  .callUF(
+                      predicates.get(successor.getKey()), instantiate(variables, pf.getSsa()));
+          writeClause(
+              bfmgr.implication(bfmgr.and(before, pf.getFormula()), after), w, declarations);
+          clauses++;
+        }
+        if (summary.error != null) {
+          writeClause(
+              bfmgr.not(bfmgr.and(before, summary.error.getFormula())), w, declarations);
+          clauses++;
+        }
+      }
+      w.write("(check-sat)\n");
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write Horn clauses to the file");
+      return;
+    }
+    logger.logf(
+        Level.INFO,
+        "Exported %d Horn clauses over %d predicates with %d arguments to %s",
+        clauses,
+        predicates.size(),
+        variables.size(),
+        file);
+  }
+
+  /**
+   * Collect the cut points that are reachable from the program entry. If a cycle of the CFA does
+   * not contain one of the given candidates, a node of the cycle is added to them.
+   */
+  private List<CFANode> collectCutPoints(Set<CFANode> pCandidates) throws InterruptedException {
+    outer:
+    while (true) {
+      List<CFANode> cutPoints = new ArrayList<>();
+      Set<CFANode> seen = new HashSet<>();
+      Deque<CFANode> waitlist = new ArrayDeque<>();
+      seen.add(cfa.getMainFunction());
+      waitlist.add(cfa.getMainFunction());
+
+      while (!waitlist.isEmpty()) {
+        shutdownNotifier.shutdownIfNecessary();
+        CFANode cutPoint = waitlist.poll();
+        List<CFANode> order = new ArrayList<>();
+        CFANode cycle = orderBlock(cutPoint, pCandidates, order);
+        if (cycle != null) {
+          pCandidates.add(cycle);
+          continue outer;
+        }
+        cutPoints.add(cutPoint);
+
+        for (CFANode node : order) {
+          for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+            CFANode successor = edge.getSuccessor();
+            if (!isErrorEdge(edge) && pCandidates.contains(successor) && seen.add(successor)) {
+              waitlist.add(successor);
+            }
+          }
+        }
+      }
+      return cutPoints;
+    }
+  }
+
+  /**
+   * Compute a topological order of the nodes of the block that starts at the given cut point and
+   * stops at all cut points. Returns a node that is part of a cycle inside the block, if any.
+   */
+  private @Nullable CFANode orderBlock(
+      CFANode pStart, Set<CFANode> pCutPoints, List<CFANode> pOrder) {
+    Deque<Pair<CFANode, Iterator<CFAEdge>>> stack = new ArrayDeque<>();
+    Set<CFANode> onStack = new HashSet<>();
+    Set<CFANode> visited = new HashSet<>();
+    stack.push(Pair.of(pStart, CFAUtils.leavingEdges(pStart).iterator()));
+    onStack.add(pStart);
+    visited.add(pStart);
+
+    while (!stack.isEmpty()) {
+      Pair<CFANode, Iterator<CFAEdge>> top = stack.peek();
+      if (top.getSecond().hasNext()) {
+        CFAEdge edge = top.getSecond().next();
+        CFANode successor = edge.getSuccessor();
+        if (isErrorEdge(edge) || pCutPoints.contains(successor)) {
+          continue;
+        }
+        if (onStack.contains(successor)) {
+          return successor;
+        }
+        if (visited.add(successor)) {
+          stack.push(Pair.of(successor, CFAUtils.leavingEdges(successor).iterator()));
+          onStack.add(successor);
+        }
+      } else {
+        stack.pop();
+        onStack.remove(top.getFirst());
+        pOrder.add(top.getFirst());
+      }
+    }
+    Collections.reverse(pOrder);
+    return null;
+  }
+
+  private BlockSummary summarizeBlock(
+      CFANode pStart, Set<CFANode> pCutPoints, PathFormula pInitial)
+      throws CPAException, InterruptedException {
+    List<CFANode> order = new ArrayList<>();
+    CFANode cycle = orderBlock(pStart, pCutPoints, order);
+    assert cycle == null : "cycle without cut point at " + cycle;
+
+    BlockSummary summary = new BlockSummary();
+    Map<CFANode, PathFormula> atNode = new HashMap<>();
+    atNode.put(pStart, pInitial);
+    for (CFANode node : order) {
+      PathFormula pf = atNode.remove(node);
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        if (isErrorEdge(edge)) {
+          summary.error = or(summary.error, pf);
+          continue;
+        }
+        PathFormula successorPf = pfmgr.makeAnd(pf, edge);
+        CFANode successor = edge.getSuccessor();
+        if (pCutPoints.contains(successor)) {
+          summary.successors.put(successor, or(summary.successors.get(successor), successorPf));
+        } else {
+          atNode.put(successor, or(atNode.get(successor), successorPf));
+        }
+      }
+    }
+    return summary;
+  }
+
+  private PathFormula or(@Nullable PathFormula pFormula1, PathFormula pFormula2)
+      throws InterruptedException {
+    return pFormula1 == null ? pFormula2 : pfmgr.makeOr(pFormula1, pFormula2);
+  }
+
+  private static List<PathFormula> getPathFormulas(BlockSummary pSummary) {
+    List<PathFormula> result = new ArrayList<>(pSummary.successors.values());
+    if (pSummary.error != null) {
+      result.add(pSummary.error);
+    }
+    return result;
+  }
+
+  private void collectVariables(
+      PathFormula pFormula, SSAMapBuilder pSsa, Map<String, FormulaType<?>> pVariables) {
+    SSAMap ssa = pFormula.getSsa();
+    for (Map.Entry<String, Formula> variable :
+        fmgr.extractVariables(pFormula.getFormula()).entrySet()) {
+      Pair<String, OptionalInt> name = FormulaManagerView.parseName(variable.getKey());
+      String baseName = name.getFirst();
+      if (name.getSecond().isPresent()
+          && ssa.containsVariable(baseName)
+          && !pVariables.containsKey(baseName)) {
+        pVariables.put(baseName, fmgr.getFormulaType(variable.getValue()));
+        pSsa.setIndex(baseName, ssa.getType(baseName), INITIAL_INDEX);
+      }
+    }
+  }
+
+  /**
+   * Create the arguments of a predicate, i.e., all program variables with their index in the
+   * given SSA map or with the initial index.
+   */
+  private List<Formula> instantiate(Map<String, FormulaType<?>> pVariables, @Nullable SSAMap pSsa) {
+    List<Formula> result = new ArrayList<>(pVariables.size());
+    for (Map.Entry<String, FormulaType<?>> variable : pVariables.entrySet()) {
+      int index = pSsa == null ? INITIAL_INDEX : pSsa.getIndex(variable.getKey());
+      index = Math.max(index, INITIAL_INDEX);
+      result.add(fmgr.makeVariable(variable.getValue(), variable.getKey(), index));
+    }
+    return result;
+  }
+
+  /**
+   * Universally quantify all variables of the clause and write it. Declarations of predicates and
+   * functions are written only once.
+   */
+  private void writeClause(BooleanFormula pClause, Writer pOut, Set<String> pDeclarations)
+      throws IOException {
+    List<Formula> variables = ImmutableList.copyOf(fmgr.extractVariables(pClause).values());
+    BooleanFormula clause = variables.isEmpty() ? pClause : qfmgr.forall(variables, pClause);
+    for (String line : fmgr.dumpFormula(clause).toString().split("\n")) {
+      if (line.startsWith("(declare-") || line.startsWith("(define-")) {
+        if (!pDeclarations.add(line)) {
+          continue;
+        }
+      }
+      pOut.write(line);
+      pOut.write('\n');
+    }
+  }
+
+  private boolean isErrorEdge(CFAEdge pEdge) {
+    AFunctionCall call = null;
+    if (pEdge instanceof FunctionCallEdge) {
+      call = ((FunctionCallEdge) pEdge).getSummaryEdge().getExpression();
+    } else if (pEdge instanceof AStatementEdge
+        && ((AStatementEdge) pEdge).getStatement() instanceof AFunctionCall) {
+      call = (AFunctionCall) ((AStatementEdge) pEdge).getStatement();
+    }
+    if (call == null) {
+      return false;
+    }
+    AExpression name = call.getFunctionCallExpression().getFunctionNameExpression();
+    return name instanceof AIdExpression
+        && errorFunctions.contains(((AIdExpression) name).getName());
+  }
+}
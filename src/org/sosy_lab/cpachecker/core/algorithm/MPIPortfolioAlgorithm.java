@@ -96,6 +96,15 @@ public class MPIPortfolioAlgorithm implements Algorithm, StatisticsProvider {
         + "disabled if unavailable on the working machine.")
   private boolean disableMCAOptions;
 
+  @Option(
+      secure = true,
+      description =
+          "Let subanalyses that finish without a result send their exported predicate map to the"
+              + " other processes. A subanalysis that finishes without a result and has received"
+              + " predicates from other processes is restarted once with these predicates as"
+              + " initial predicates.")
+  private boolean sharePredicates = false;
+
   private final Configuration globalConfig;
   private final LogManager logger;
   private final ShutdownManager shutdownManager;
@@ -211,6 +220,10 @@ public class MPIPortfolioAlgorithm implements Algorithm, StatisticsProvider {
         analysisMap.putAll(subanalysis.buildCommandLine());
       }
 
+      if (sharePredicates) {
+        analysisMap.put("share_predicates", true);
+      }
+
       // The following settings are required for the child CPAchecker instances. They might be
       // executed on different machines and thus need these information for copying the results
       // back to the main node after completing their analysis.
@@ -549,6 +562,7 @@ public class MPIPortfolioAlgorithm implements Algorithm, StatisticsProvider {
               .clearOption("analysis.name")
               .clearOption("mpiAlgorithm.numberProcesses")
               .clearOption("mpiAlgorithm.disableMCAOptions")
+              .clearOption("mpiAlgorithm.sharePredicates")
               .setOption("limits.time.cpu", pSubanalysesTimelimit)
               .setOption("output.path", checkNotNull(outputPath.toString()))
               .setOption("specification", checkNotNull(specPath.toString()))
@@ -24,17 +24,22 @@ import com.google.common.collect.Iterables;
 import com.google.common.util.concurrent.Futures;
 import com.google.common.util.concurrent.ListenableFuture;
 import com.google.common.util.concurrent.ListeningExecutorService;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
 import java.io.IOException;
 import java.io.PrintStream;
 import java.nio.file.Path;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 import java.util.concurrent.Callable;
 import java.util.concurrent.CancellationException;
+import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.CopyOnWriteArrayList;
 import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ScheduledExecutorService;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicReference;
@@ -50,7 +55,9 @@ import org.sosy_lab.common.configuration.FileOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.configuration.TimeSpanOption;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
@@ -94,6 +101,17 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
   @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
   private List<AnnotatedValue<Path>> configFiles;
 
+  @Option(
+      secure = true,
+      description =
+          "Cancel an analysis if neither the size of its reached set nor its reported progress"
+              + " changed for this amount of time, such that its thread is available for the"
+              + " remaining analyses. Analyses that supply their reached set to other analyses"
+              + " and the last running analysis are never cancelled."
+              + " (use seconds or specify a unit; 0 to disable)")
+  @TimeSpanOption(codeUnit = TimeUnit.NANOSECONDS, defaultUserUnit = TimeUnit.SECONDS, min = 0)
+  private TimeSpan stagnationTimeout = TimeSpan.ofNanos(0);
+
   private static final String SUCCESS_MESSAGE =
       "One of the parallel analyses has finished successfully, cancelling all other runs.";
 
@@ -105,6 +123,7 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
   private final ParallelAlgorithmStatistics stats;
 
   private ParallelAnalysisResult finalResult = null;
+  private final Map<String, ConfigurableProgramAnalysis> cpaOfAnalysis = new ConcurrentHashMap<>();
   private CFANode mainEntryNode = null;
   private final AggregatedReachedSetManager aggregatedReachedSetManager;
 
@@ -130,7 +149,8 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
     specification = checkNotNull(pSpecification);
     cfa = checkNotNull(pCfa);
 
-    aggregatedReachedSetManager = new AggregatedReachedSetManager();
+    aggregatedReachedSetManager =
+        new AggregatedReachedSetManager(pAggregatedReachedSets.getSharedInvariants());
     aggregatedReachedSetManager.addAggregated(pAggregatedReachedSets);
 
     ImmutableList.Builder<Callable<ParallelAnalysisResult>> analysesBuilder =
@@ -156,10 +176,26 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
     // shutdown the executor service,
     exec.shutdown();
 
+    ScheduledExecutorService stagnationMonitor = null;
+    if (!stagnationTimeout.isEmpty()) {
+      long checkInterval = Math.max(1, stagnationTimeout.asMillis() / 4);
+      stagnationMonitor =
+          Executors.newSingleThreadScheduledExecutor(
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("parallel-analysis-monitor-%d")
+                  .build());
+      stagnationMonitor.scheduleWithFixedDelay(
+          this::cancelStagnatingAnalyses, checkInterval, checkInterval, TimeUnit.MILLISECONDS);
+    }
+
     try {
       handleFutureResults(futures);
 
     } finally {
+      if (stagnationMonitor != null) {
+        stagnationMonitor.shutdownNow();
+      }
       // Wait some time so that all threads are shut down and we have a happens-before relation
       // (necessary for statistics).
       if (!awaitTermination(exec, 10, TimeUnit.SECONDS)) {
@@ -170,6 +206,10 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
     }
 
     if (finalResult != null) {
+      ConfigurableProgramAnalysis finalCpa = cpaOfAnalysis.get(finalResult.getAnalysisName());
+      if (finalCpa != null) {
+        GlobalInfo.getInstance().setUpInfoFromCPA(finalCpa);
+      }
       forwardingReachedSet.setDelegate(finalResult.getReached());
       return finalResult.getStatus();
     }
@@ -177,6 +217,32 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
     return AlgorithmStatus.UNSOUND_AND_PRECISE;
   }
 
+  /**
+   * Cancel all analyses that did not make progress within the stagnation timeout, as long as at
+   * least one other analysis keeps running. Called periodically by the stagnation monitor.
+   */
+  private void cancelStagnatingAnalyses() {
+    long now = System.nanoTime();
+    List<StatisticsEntry> running =
+        from(stats.allAnalysesStats).filter(StatisticsEntry::isRunning).toList();
+    int numberOfRunning = running.size();
+    for (StatisticsEntry entry : running) {
+      if (entry.updateProgress(now)
+          || entry.supplyingReached
+          || now - entry.lastProgressNanos < stagnationTimeout.asNanos()
+          || numberOfRunning <= 1) {
+        continue;
+      }
+      String reason =
+          "no progress for "
+              + TimeSpan.ofNanos(now - entry.lastProgressNanos).formatAs(TimeUnit.SECONDS);
+      logger.log(Level.INFO, "Cancelling", entry.name, "because of", reason);
+      entry.cancellationReason = reason;
+      entry.shutdownManager.requestShutdown("Analysis cancelled because of " + reason);
+      numberOfRunning--;
+    }
+  }
+
   private static boolean awaitTermination(
       ListeningExecutorService exec, long timeout, TimeUnit unit) {
     long timeoutNanos = unit.toNanos(timeout);
@@ -312,11 +378,18 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
             Iterables.getOnlyElement(
                 FluentIterable.from(singleAnalysisOverallLimit.getResourceLimits())
                     .filter(ThreadCpuTimeLimit.class),
-                null), terminated);
+                null),
+            terminated,
+            algorithm,
+            singleShutdownManager,
+            supplyReached || supplyRefinableReached);
+    GlobalInfo analysisInfo = GlobalInfo.getInstance().createInstanceForAnalysis();
     return () -> {
-      // TODO global info will not work correctly with parallel analyses
-      // as it is a mutable singleton object
-      GlobalInfo.getInstance().setUpInfoFromCPA(cpa);
+      // each analysis uses its own global info, the one of the analysis that provides
+      // the final result is installed globally in run()
+      GlobalInfo.setInstanceForCurrentThread(analysisInfo);
+      analysisInfo.setUpInfoFromCPA(cpa);
+      cpaOfAnalysis.put(singleConfigFileName.toString(), cpa);
 
       if (algorithm instanceof ConditionAdjustmentEventSubscriber) {
         conditionAdjustmentEventSubscribers.add((ConditionAdjustmentEventSubscriber) algorithm);
@@ -572,9 +645,24 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
     }
 
     public synchronized StatisticsEntry getNewSubStatistics(
-        ReachedSet pReached, String pName, @Nullable ThreadCpuTimeLimit pRLimit, AtomicBoolean pTerminated) {
+        ReachedSet pReached,
+        String pName,
+        @Nullable ThreadCpuTimeLimit pRLimit,
+        AtomicBoolean pTerminated,
+        Algorithm pAlgorithm,
+        ShutdownManager pShutdownManager,
+        boolean pSupplyingReached) {
       Collection<Statistics> subStats = new CopyOnWriteArrayList<>();
-      StatisticsEntry entry = new StatisticsEntry(subStats, pReached, pName, pRLimit, pTerminated);
+      StatisticsEntry entry =
+          new StatisticsEntry(
+              subStats,
+              pReached,
+              pName,
+              pRLimit,
+              pTerminated,
+              pAlgorithm,
+              pShutdownManager,
+              pSupplyingReached);
       allAnalysesStats.add(entry);
       return entry;
     }
@@ -590,6 +678,12 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
       if (successfulAnalysisName != null) {
         out.println("Successful analysis: " + successfulAnalysisName);
       }
+      for (StatisticsEntry subStats : allAnalysesStats) {
+        if (subStats.cancellationReason != null) {
+          out.println(
+              "Cancelled analysis: " + subStats.name + " (" + subStats.cancellationReason + ")");
+        }
+      }
       printSubStatistics(out, result);
     }
 
@@ -687,14 +781,69 @@ public class ParallelAlgorithm implements Algorithm, StatisticsProvider {
 
     private final AtomicBoolean terminated;
 
-    public StatisticsEntry(Collection<Statistics> pSubStatistics, ReachedSet pReachedSet, String pName, @Nullable ThreadCpuTimeLimit pRLimit, AtomicBoolean pTerminated) {
+    private final Algorithm algorithm;
+
+    private final ShutdownManager shutdownManager;
+
+    private final boolean supplyingReached;
+
+    /** Set if the analysis was cancelled because it did not make progress. */
+    private volatile @Nullable String cancellationReason = null;
+
+    // the following fields are only accessed by the stagnation monitor
+    private @Nullable ReachedSet lastReachedSet = null;
+    private int lastReachedSetSize = -1;
+    private double lastProgress = Double.NaN;
+    private long lastProgressNanos;
+
+    public StatisticsEntry(
+        Collection<Statistics> pSubStatistics,
+        ReachedSet pReachedSet,
+        String pName,
+        @Nullable ThreadCpuTimeLimit pRLimit,
+        AtomicBoolean pTerminated,
+        Algorithm pAlgorithm,
+        ShutdownManager pShutdownManager,
+        boolean pSupplyingReached) {
       subStatistics = Objects.requireNonNull(pSubStatistics);
       reachedSet = new AtomicReference<>(Objects.requireNonNull(pReachedSet));
       name = Objects.requireNonNull(pName);
       rLimit = pRLimit;
       terminated = Objects.requireNonNull(pTerminated);
+      algorithm = Objects.requireNonNull(pAlgorithm);
+      shutdownManager = Objects.requireNonNull(pShutdownManager);
+      supplyingReached = pSupplyingReached;
+    }
+
+    private boolean isRunning() {
+      return !terminated.get() && cancellationReason == null;
     }
 
+    /**
+     * Sample the progress signals of the analysis, i.e., its reached set and the progress reported
+     * by a {@link ProgressReportingAlgorithm}.
+     *
+     * @return whether the analysis made progress since the last sample
+     */
+    private boolean updateProgress(long pNow) {
+      ReachedSet currentReachedSet = reachedSet.get();
+      int currentSize = currentReachedSet.size();
+      double currentProgress =
+          algorithm instanceof ProgressReportingAlgorithm
+              ? ((ProgressReportingAlgorithm) algorithm).getProgress()
+              : Double.NaN;
+      boolean progress =
+          currentReachedSet != lastReachedSet
+              || currentSize != lastReachedSetSize
+              || Double.compare(currentProgress, lastProgress) != 0;
+      if (progress) {
+        lastReachedSet = currentReachedSet;
+        lastReachedSetSize = currentSize;
+        lastProgress = currentProgress;
+        lastProgressNanos = pNow;
+      }
+      return progress;
+    }
   }
 
   public interface ReachedSetUpdateListener {
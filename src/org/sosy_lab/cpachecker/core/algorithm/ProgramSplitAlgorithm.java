@@ -131,18 +131,17 @@ public class ProgramSplitAlgorithm implements Algorithm, StatisticsProvider, Sta
   private void extractSplitConditions(final ReachedSet pReached) throws InterruptedException {
     extractionComplete = false;
     for (int i = 0; i < numSplits; i++) {
-      int index = i;
+      splitConditions.add(new HashSet<>());
+    }
+    // one pass over the reached set for all splits
+    for (ARGState state : FluentIterable.from(pReached).filter(ARGState.class)) {
       shutdownNotifier.shutdownIfNecessary();
-
-      splitConditions.add(
-          new HashSet<>(
-              FluentIterable.from(pReached)
-                  .filter(
-                      state ->
-                          AbstractStates.extractStateByType(state, SplitInfoState.class)
-                              .isInSplit(index))
-                  .filter(ARGState.class)
-                  .toSet()));
+      SplitInfoState splitInfo = AbstractStates.extractStateByType(state, SplitInfoState.class);
+      for (int i = 0; i < numSplits; i++) {
+        if (splitInfo.isInSplit(i)) {
+          splitConditions.get(i).add(state);
+        }
+      }
     }
     extractionComplete = true;
   }
@@ -18,6 +18,7 @@ import com.google.common.collect.Iterators;
 import com.google.common.collect.PeekingIterator;
 import com.google.common.collect.Sets;
 import com.google.common.io.ByteStreams;
+import com.google.common.math.LongMath;
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 import java.io.IOException;
 import java.io.PrintStream;
@@ -29,6 +30,7 @@ import java.util.Collections;
 import java.util.List;
 import java.util.Optional;
 import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.concurrent.TimeUnit;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownManager;
@@ -38,10 +40,13 @@ import org.sosy_lab.common.annotations.SuppressForbidden;
 import org.sosy_lab.common.configuration.AnnotatedValue;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.configuration.TimeSpanOption;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
@@ -65,6 +70,8 @@ import org.sosy_lab.cpachecker.exceptions.RefinementFailedException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.CPAs;
 import org.sosy_lab.cpachecker.util.Triple;
+import org.sosy_lab.cpachecker.util.resources.ResourceLimit;
+import org.sosy_lab.cpachecker.util.resources.ResourceLimitChecker;
 
 @Options(prefix = "restartAlgorithm")
 public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpdater {
@@ -173,6 +180,46 @@ public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpda
   )
   private boolean alwaysRestart = false;
 
+  private enum BudgetSchedule {
+    /** Each analysis only has the resource limits of its own configuration. */
+    NONE,
+    /** The budget is multiplied with a constant factor in each round. */
+    GEOMETRIC,
+    /** The budget of the n-th analysis follows the Luby sequence 1, 1, 2, 1, 1, 2, 4, ... */
+    LUBY,
+  }
+
+  @Option(
+    secure = true,
+    name = "budget.schedule",
+    description =
+        "Assign a CPU-time budget to each analysis, such that a hopeless analysis does not use up"
+            + " the complete time limit. With GEOMETRIC, each analysis gets budget.base times"
+            + " budget.factor to the power of the number of the current round as budget,"
+            + " with LUBY, the n-th started analysis gets budget.base times the n-th element of"
+            + " the Luby sequence (1, 1, 2, 1, 1, 2, 4, ...)."
+            + " If the last configuration was reached and at least one analysis was stopped"
+            + " because of its budget, a new round starts with the first configuration."
+  )
+  private BudgetSchedule budgetSchedule = BudgetSchedule.NONE;
+
+  @Option(
+    secure = true,
+    name = "budget.base",
+    description = "CPU-time budget of an analysis in the first round of budget.schedule"
+  )
+  @TimeSpanOption(codeUnit = TimeUnit.NANOSECONDS, defaultUserUnit = TimeUnit.SECONDS, min = 1)
+  private TimeSpan budgetBase = TimeSpan.ofSeconds(10);
+
+  @Option(
+    secure = true,
+    name = "budget.factor",
+    description =
+        "factor by which the CPU-time budget grows per round for budget.schedule=GEOMETRIC"
+  )
+  @IntegerOption(min = 2)
+  private int budgetFactor = 2;
+
   private final ShutdownRequestListener logShutdownListener;
   private final RestartAlgorithmStatistics stats;
   private Algorithm currentAlgorithm;
@@ -242,11 +289,17 @@ public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpda
     boolean isLastReachedSetUsable = false;
     final List<ConfigurableProgramAnalysis> cpasToClose = new ArrayList<>();
 
+    // state of budget.schedule
+    int round = 0;
+    int budgetedRuns = 0;
+    boolean budgetExceededInRound = false;
+
     while (configFilesIterator.hasNext()) {
       stats.totalTime.start();
       @Nullable ConfigurableProgramAnalysis currentCpa = null;
       ReachedSet currentReached;
       ShutdownManager singleShutdownManager = ShutdownManager.createWithParent(shutdownNotifier);
+      @Nullable ResourceLimitChecker budgetLimit = null;
 
       boolean lastAnalysisInterrupted = false;
       boolean lastAnalysisFailed = false;
@@ -308,6 +361,18 @@ public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpda
 
         stats.noOfAlgorithmsUsed++;
 
+        if (budgetSchedule != BudgetSchedule.NONE) {
+          TimeSpan budget = getBudget(round, ++budgetedRuns);
+          logger.logf(
+              Level.INFO,
+              "Analysis %d gets a CPU-time budget of %s.",
+              stats.noOfAlgorithmsUsed,
+              budget.formatAs(TimeUnit.SECONDS));
+          budgetLimit =
+              ResourceLimitChecker.createCpuTimeLimitChecker(logger, singleShutdownManager, budget);
+          budgetLimit.start();
+        }
+
         // run algorithm
         registerReachedSetUpdateListeners();
         try {
@@ -369,7 +434,7 @@ public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpda
         } catch (InterruptedException e) {
           isLastReachedSetUsable = false;
           lastAnalysisInterrupted = true;
-          if (configFilesIterator.hasNext()) {
+          if (configFilesIterator.hasNext() || budgetLimit != null) {
             logger.logUserException(
                 Level.WARNING, e, "Analysis " + stats.noOfAlgorithmsUsed + " stopped.");
             shutdownNotifier.shutdownIfNecessary(); // check if we should also stop
@@ -378,6 +443,12 @@ public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpda
           }
         }
       } finally {
+        if (budgetLimit != null) {
+          budgetLimit.cancel();
+          for (ResourceLimit limit : budgetLimit.getResourceLimits()) {
+            budgetExceededInRound |= limit.isExceeded(limit.getCurrentValue());
+          }
+        }
         unregisterReachedSetUpdateListeners();
         singleShutdownManager.getNotifier().unregister(logShutdownListener);
         singleShutdownManager.requestShutdown("Analysis terminated"); // shutdown any remaining components
@@ -435,6 +506,14 @@ public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpda
         } while (!foundConfig && configFilesIterator.hasNext());
       }
 
+      if (!configFilesIterator.hasNext() && budgetExceededInRound) {
+        // start again with larger budgets
+        round++;
+        budgetExceededInRound = false;
+        configFilesIterator = Iterators.peekingIterator(configFiles.iterator());
+        logger.logf(Level.INFO, "RestartAlgorithm starts round %d of analyses...", round + 1);
+      }
+
       if (configFilesIterator.hasNext()) {
         printIntermediateStatistics(currentReached);
         stats.resetSubStatistics();
@@ -459,6 +538,44 @@ public class RestartAlgorithm extends NestingAlgorithm implements ReachedSetUpda
     return status;
   }
 
+  /**
+   * Compute the CPU-time budget for an analysis.
+   *
+   * @param pRound The number of completed passes over the list of configurations.
+   * @param pRun The number of the analysis over all rounds, starting with 1.
+   */
+  private TimeSpan getBudget(int pRound, int pRun) {
+    long multiplier;
+    switch (budgetSchedule) {
+      case GEOMETRIC:
+        multiplier = LongMath.saturatedPow(budgetFactor, pRound);
+        break;
+      case LUBY:
+        multiplier = luby(pRun);
+        break;
+      default:
+        throw new AssertionError("unexpected budget schedule " + budgetSchedule);
+    }
+    return TimeSpan.ofNanos(LongMath.saturatedMultiply(budgetBase.asNanos(), multiplier));
+  }
+
+  /**
+   * Return the i-th element (starting with 1) of the Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, 1, 2,
+   * 1, 1, 2, 4, 8, ...
+   */
+  private static long luby(int i) {
+    Preconditions.checkArgument(i >= 1);
+    // find smallest k with i <= 2^k - 1
+    int k = 1;
+    while ((1L << k) - 1 < i) {
+      k++;
+    }
+    if (i == (1L << k) - 1) {
+      return 1L << (k - 1);
+    }
+    return luby(i - (1 << (k - 1)) + 1);
+  }
+
   @SuppressFBWarnings(
       value = "DM_DEFAULT_ENCODING",
       justification = "Encoding is irrelevant for null output stream")
@@ -11,14 +11,27 @@ package org.sosy_lab.cpachecker.core.algorithm;
 import static com.google.common.collect.FluentIterable.from;
 
 import com.google.common.base.Preconditions;
+import com.google.common.collect.ImmutableList;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.List;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Future;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -41,6 +54,7 @@ import org.sosy_lab.cpachecker.core.specification.SpecificationProperty;
 import org.sosy_lab.cpachecker.cpa.arg.ARGCPA;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.cpa.arg.ARGUtils;
+import org.sosy_lab.cpachecker.cpa.arg.path.ARGPath;
 import org.sosy_lab.cpachecker.cpa.testtargets.CoverFunction;
 import org.sosy_lab.cpachecker.cpa.testtargets.TestTargetCPA;
 import org.sosy_lab.cpachecker.cpa.testtargets.TestTargetProvider;
@@ -55,6 +69,7 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.CPAs;
 import org.sosy_lab.cpachecker.util.error.DummyErrorState;
 import org.sosy_lab.cpachecker.util.testcase.TestCaseExporter;
+import org.sosy_lab.cpachecker.util.testcase.TestCaseReplayer;
 
 @Options(prefix = "testcase")
 public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, StatisticsProvider {
@@ -77,6 +92,36 @@ public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, S
   @Option(secure = true, name = "progress", description = "defines how progress is computed")
   private ProgressComputation progressType = ProgressComputation.RELATIVE_TOTAL;
 
+  @Option(
+      secure = true,
+      description =
+          "number of threads that write test cases in the background while the analysis "
+              + "continues (0 writes each test case directly when its target is reached)")
+  @IntegerOption(min = 0)
+  private int writerThreads = 0;
+
+  @Option(
+      secure = true,
+      description =
+          "maximal number of test cases that wait to be written in the background; "
+              + "if the queue is full, the analysis writes the next test case itself")
+  @IntegerOption(min = 1)
+  private int writerQueueSize = 100;
+
+  @Option(
+      secure = true,
+      description =
+          "do not write test cases whose input vector equals the one of a test case "
+              + "that was already written")
+  private boolean skipDuplicates = true;
+
+  @Option(
+      secure = true,
+      description =
+          "replay the inputs of each new test case with a value analysis and remove all test "
+              + "targets that the test case covers in addition to the one it was generated for")
+  private boolean replayForCoverage = false;
+
   private final Algorithm algorithm;
   private final AssumptionToEdgeAllocator assumptionToEdgeAllocator;
   private final ConfigurableProgramAnalysis cpa;
@@ -85,7 +130,14 @@ public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, S
   private final Set<CFAEdge> testTargets;
   private final SpecificationProperty specProp;
   private final TestCaseExporter exporter;
+  private final @Nullable TestCaseReplayer replayer;
   private double progress = 0;
+  private int collaterallyCoveredTargets = 0;
+
+  private final Set<ImmutableList<String>> writtenTestInputs = ConcurrentHashMap.newKeySet();
+  private final AtomicInteger skippedDuplicates = new AtomicInteger();
+  private @Nullable ExecutorService testCaseWriter = null;
+  private final List<Future<?>> pendingTestCases = new ArrayList<>();
 
   public TestCaseGeneratorAlgorithm(
       final Algorithm pAlgorithm,
@@ -109,6 +161,8 @@ public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, S
     testTargets =
         ((TestTargetTransferRelation) testTargetCpa.getTransferRelation()).getTestTargets();
     exporter = new TestCaseExporter(pCfa, logger, pConfig);
+    replayer =
+        replayForCoverage ? new TestCaseReplayer(pConfig, logger, pShutdownNotifier, pCfa) : null;
 
     if (pSpec.getProperties().size() == 1) {
       specProp = pSpec.getProperties().iterator().next();
@@ -127,6 +181,21 @@ public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, S
       throws CPAException, InterruptedException, CPAEnabledAnalysisPropertyViolationException {
     int uncoveredGoalsAtStart = testTargets.size();
     progress = 0;
+    if (writerThreads > 0) {
+      // when the queue is full, the analysis thread writes test cases itself and is slowed down
+      testCaseWriter =
+          new ThreadPoolExecutor(
+              writerThreads,
+              writerThreads,
+              0L,
+              TimeUnit.MILLISECONDS,
+              new ArrayBlockingQueue<>(writerQueueSize),
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("testcase-writer-%d")
+                  .build(),
+              new ThreadPoolExecutor.CallerRunsPolicy());
+    }
     // clean up ARG
     if (pReached.getWaitlist().size() > 1
         || !pReached.getWaitlist().contains(pReached.getFirstState())) {
@@ -211,11 +280,17 @@ public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, S
               if (testTargets.contains(targetEdge)) {
 
                 if (status.isPrecise()) {
-                  CounterexampleInfo cexInfo = ARGUtils.tryGetOrCreateCounterexampleInformation(argState, cpa, assumptionToEdgeAllocator).orElseThrow();
-                  exporter.writeTestCaseFiles(cexInfo, Optional.ofNullable(specProp));
+                  CounterexampleInfo cexInfo =
+                      ARGUtils.tryGetOrCreateCounterexampleInformation(
+                              argState, cpa, assumptionToEdgeAllocator)
+                          .orElseThrow();
+                  writeTestCase(cexInfo);
 
                   logger.log(Level.FINE, "Removing test target: " + targetEdge.toString());
                   testTargets.remove(targetEdge);
+                  if (replayer != null) {
+                    removeCollaterallyCoveredTargets(cexInfo);
+                  }
 
                   if (shouldReportCoveredErrorCallAsError()) {
                     addErrorStateWithViolatedProperty(pReached);
@@ -266,6 +341,14 @@ public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, S
 
       cleanUpIfNoTestTargetsRemain(pReached);
     } finally {
+      finishPendingTestCases();
+      if (collaterallyCoveredTargets > 0) {
+        logger.log(
+            Level.INFO,
+            "Replaying test cases covered",
+            collaterallyCoveredTargets,
+            "further test targets.");
+      }
       if (uncoveredGoalsAtStart != testTargets.size()) {
         logger.log(Level.SEVERE, TestTargetProvider.getCoverageInfo());
       }
@@ -274,6 +357,93 @@ public class TestCaseGeneratorAlgorithm implements ProgressReportingAlgorithm, S
     return AlgorithmStatus.NO_PROPERTY_CHECKED;
   }
 
+  /**
+   * Replay the inputs of the given test case and remove all test targets that it covers, such that
+   * the analysis does not generate further test cases for them.
+   */
+  private void removeCollaterallyCoveredTargets(final CounterexampleInfo pCexInfo)
+      throws InterruptedException {
+    Optional<ImmutableList<String>> inputs = exporter.getTestInputs(pCexInfo);
+    if (!inputs.isPresent()) {
+      return;
+    }
+    try {
+      for (CFAEdge edge : replayer.getCoveredEdges(inputs.orElseThrow())) {
+        if (testTargets.remove(edge)) {
+          logger.log(Level.FINE, "Removing test target covered by replayed test case:", edge);
+          collaterallyCoveredTargets++;
+          progress++;
+        }
+      }
+    } catch (CPAException e) {
+      logger.logDebugException(e, "Replaying test case failed");
+    }
+  }
+
+  private void writeTestCase(final CounterexampleInfo pCexInfo) {
+    if (testCaseWriter == null) {
+      writeTestCaseIfNew(pCexInfo);
+    } else {
+      // the analysis continues to change the ARG, so the writer gets its own copy of the path
+      CounterexampleInfo cexInfo = copyWithDetachedPath(pCexInfo);
+      pendingTestCases.add(testCaseWriter.submit(() -> writeTestCaseIfNew(cexInfo)));
+    }
+  }
+
+  private void writeTestCaseIfNew(final CounterexampleInfo pCexInfo) {
+    if (skipDuplicates) {
+      Optional<ImmutableList<String>> inputs = exporter.getTestInputs(pCexInfo);
+      if (inputs.isPresent() && !writtenTestInputs.add(inputs.orElseThrow())) {
+        logger.log(Level.FINE, "Skipping test case with the same inputs as an earlier one.");
+        skippedDuplicates.incrementAndGet();
+        return;
+      }
+    }
+    exporter.writeTestCaseFiles(pCexInfo, Optional.ofNullable(specProp));
+  }
+
+  /**
+   * Create a counterexample for a copy of the target path whose states are not linked to the ARG.
+   * The values of the counterexample belong to the edges, so they can be reused for the copy.
+   */
+  private static CounterexampleInfo copyWithDetachedPath(final CounterexampleInfo pCexInfo) {
+    ARGPath path = pCexInfo.getTargetPath();
+    List<ARGState> copiedStates = new ArrayList<>(path.size());
+    ARGState parent = null;
+    for (ARGState state : path.asStatesList()) {
+      parent = new ARGState(state.getWrappedState(), parent);
+      copiedStates.add(parent);
+    }
+    ARGPath copiedPath = new ARGPath(copiedStates, path.getInnerEdges());
+    if (pCexInfo.isPreciseCounterExample()) {
+      return CounterexampleInfo.feasiblePrecise(copiedPath, pCexInfo.getCFAPathWithAssignments());
+    } else {
+      return CounterexampleInfo.feasibleImprecise(copiedPath);
+    }
+  }
+
+  private void finishPendingTestCases() {
+    if (testCaseWriter != null) {
+      testCaseWriter.shutdown();
+      // the test cases belong to targets that are already reported as covered, so they are
+      // written even if the analysis was interrupted
+      for (Future<?> pending : pendingTestCases) {
+        try {
+          Uninterruptibles.getUninterruptibly(pending);
+        } catch (ExecutionException e) {
+          logger.logException(Level.WARNING, e.getCause(), "Could not write test case");
+        }
+      }
+      pendingTestCases.clear();
+      testCaseWriter = null;
+    }
+    exporter.flush();
+    if (skippedDuplicates.get() > 0) {
+      logger.log(
+          Level.INFO, "Skipped", skippedDuplicates.get(), "test cases with duplicate inputs.");
+    }
+  }
+
   private void cleanUpIfNoTestTargetsRemain(final ReachedSet pReached) {
     if (testTargets.isEmpty()) {
       List<AbstractState> waitlist = new ArrayList<>(pReached.getWaitlist());
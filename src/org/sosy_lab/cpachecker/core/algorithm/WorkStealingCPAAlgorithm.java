@@ -0,0 +1,383 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm;
+
+import static com.google.common.base.Preconditions.checkArgument;
+
+import com.google.common.base.Functions;
+import com.google.common.base.Throwables;
+import java.io.PrintStream;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinWorkerThread;
+import java.util.concurrent.RecursiveAction;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.concurrent.locks.Lock;
+import java.util.logging.Level;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustment;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustmentResult;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustmentResult.Action;
+import org.sosy_lab.cpachecker.core.interfaces.Statistics;
+import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
+import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
+import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
+import org.sosy_lab.cpachecker.core.reachedset.ConcurrentPartitionedReachedSet;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
+import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.statistics.StatCounter;
+import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
+import org.sosy_lab.cpachecker.util.statistics.ThreadSafeSampledTimer;
+import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer;
+import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer.TimerWrapper;
+
+/**
+ * Parallel version of the {@link CPAAlgorithm} for analyses that use merge-sep.
+ *
+ * <p>Every state from the waitlist is handled as a task of a {@link ForkJoinPool}, such that each
+ * worker has its own deque of pending states and idle workers steal work from the others. The
+ * states are stored in a {@link ConcurrentPartitionedReachedSet}, and the coverage check and the
+ * insertion of a new state are executed while holding the lock of the state's partition, which
+ * makes stop and add linearizable per partition.
+ *
+ * <p>The operators of the CPA (transfer relation, precision adjustment, and stop) are called
+ * concurrently from several threads and thus need to be thread-safe. States that are still pending
+ * when the analysis stops (because of a target state or an exception) are put back into the
+ * waitlist of the reached set, such that the analysis can be continued afterwards.
+ */
+class WorkStealingCPAAlgorithm implements Algorithm, StatisticsProvider {
+
+  private static class WorkerStatistics {
+    private final String name;
+    private long countIterations = 0;
+    private long countSuccessors = 0;
+    private long countStop = 0;
+
+    private WorkerStatistics(String pName) {
+      name = pName;
+    }
+  }
+
+  private class ParallelCPAStatistics implements Statistics {
+
+    private final ThreadSafeTimerContainer totalTimer =
+        new ThreadSafeTimerContainer("Total time for tasks");
+    private final ThreadSafeSampledTimer precisionTimer;
+    private final ThreadSafeSampledTimer transferTimer;
+    private final ThreadSafeSampledTimer stopTimer;
+    private final ThreadSafeSampledTimer lockTimer;
+    private final ThreadSafeSampledTimer addTimer;
+    private final StatCounter countBreak = new StatCounter("Number of times breaked");
+    private long countSteals = 0;
+
+    /** One entry per worker thread, each entry is only modified by its own thread. */
+    private final Map<Thread, WorkerStatistics> workerStatistics = new ConcurrentHashMap<>();
+
+    private ParallelCPAStatistics(int pTimerSampleRate) {
+      // these timers are used for every single operator call,
+      // so they are shared between all workers and only sample the intervals
+      precisionTimer =
+          new ThreadSafeSampledTimer("Time for precision adjustment", pTimerSampleRate);
+      transferTimer = new ThreadSafeSampledTimer("Time for transfer relation", pTimerSampleRate);
+      stopTimer = new ThreadSafeSampledTimer("Time for stop operator", pTimerSampleRate);
+      lockTimer =
+          new ThreadSafeSampledTimer("Time for waiting on partition locks", pTimerSampleRate);
+      addTimer = new ThreadSafeSampledTimer("Time for adding to reached set", pTimerSampleRate);
+    }
+
+    private WorkerStatistics forCurrentThread() {
+      return workerStatistics.computeIfAbsent(
+          Thread.currentThread(), t -> new WorkerStatistics(t.getName()));
+    }
+
+    @Override
+    public String getName() {
+      return "Work-stealing CPA algorithm";
+    }
+
+    @Override
+    public void printStatistics(PrintStream out, Result pResult, UnmodifiableReachedSet pReached) {
+      long countIterations = 0;
+      long countSuccessors = 0;
+      long countStop = 0;
+      for (WorkerStatistics worker : workerStatistics.values()) {
+        countIterations += worker.countIterations;
+        countSuccessors += worker.countSuccessors;
+        countStop += worker.countStop;
+      }
+
+      StatisticsWriter w =
+          StatisticsWriter.writingStatisticsTo(out)
+              .put("Number of threads", numberOfThreads)
+              .put("Number of iterations", countIterations)
+              .put("Number of computed successors", countSuccessors)
+              .put("Number of times stopped", countStop)
+              .put(countBreak)
+              .put("Number of stolen tasks", countSteals);
+      StatisticsWriter perWorker = w.beginLevel();
+      for (WorkerStatistics worker : workerStatistics.values()) {
+        perWorker.put(
+            "Iterations of " + worker.name,
+            String.format(
+                "%d (successors: %d, stopped: %d)",
+                worker.countIterations,
+                worker.countSuccessors,
+                worker.countStop));
+      }
+      w.spacer()
+          .put(totalTimer.getTitle(), totalTimer.prettyFormat())
+          .beginLevel()
+          .put(precisionTimer)
+          .put(transferTimer)
+          .put(lockTimer)
+          .put(stopTimer)
+          .put(addTimer);
+    }
+  }
+
+  private final ParallelCPAStatistics stats;
+
+  /** The task timer of each worker thread, created lazily per thread. */
+  private final ThreadLocal<TimerWrapper> totalTimers;
+
+  private final TransferRelation transferRelation;
+  private final StopOperator stopOperator;
+  private final PrecisionAdjustment precisionAdjustment;
+
+  private final LogManager logger;
+  private final ShutdownNotifier shutdownNotifier;
+  private final int numberOfThreads;
+  private final AlgorithmStatus status;
+
+  /** Set when the analysis should stop, i.e., no further tasks should be processed. */
+  private final AtomicBoolean breakRequested = new AtomicBoolean();
+
+  /** The first exception that was thrown by a worker. */
+  private final AtomicReference<Throwable> error = new AtomicReference<>();
+
+  WorkStealingCPAAlgorithm(
+      ConfigurableProgramAnalysis pCpa,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier,
+      int pNumberOfThreads,
+      int pTimerSampleRate,
+      boolean pIsImprecise) {
+    checkArgument(pNumberOfThreads > 1, "at least two threads required for parallel analysis");
+    stats = new ParallelCPAStatistics(pTimerSampleRate);
+    totalTimers = ThreadLocal.withInitial(stats.totalTimer::getNewTimer);
+    transferRelation = pCpa.getTransferRelation();
+    stopOperator = pCpa.getStopOperator();
+    precisionAdjustment = pCpa.getPrecisionAdjustment();
+    logger = pLogger;
+    shutdownNotifier = pShutdownNotifier;
+    numberOfThreads = pNumberOfThreads;
+    status = AlgorithmStatus.SOUND_AND_PRECISE.withPrecise(!pIsImprecise);
+  }
+
+  @Override
+  public AlgorithmStatus run(ReachedSet pReachedSet) throws CPAException, InterruptedException {
+    checkArgument(
+        pReachedSet instanceof ConcurrentPartitionedReachedSet,
+        "parallel CPA algorithm requires analysis.reachedSet=CONCURRENTPARTITIONED");
+    ConcurrentPartitionedReachedSet reachedSet = (ConcurrentPartitionedReachedSet) pReachedSet;
+    breakRequested.set(false);
+    error.set(null);
+
+    ForkJoinPool pool =
+        new ForkJoinPool(
+            numberOfThreads,
+            p -> {
+              ForkJoinWorkerThread thread =
+                  ForkJoinPool.defaultForkJoinWorkerThreadFactory.newThread(p);
+              thread.setName("CPAAlgorithm-worker-" + thread.getPoolIndex());
+              thread.setDaemon(true); // do not block termination of CPAchecker
+              return thread;
+            },
+            null,
+            false);
+    try {
+      while (reachedSet.hasWaitingState()) {
+        AbstractState state = reachedSet.popFromWaitlist();
+        pool.execute(new StateTask(state, reachedSet));
+      }
+      while (!pool.awaitQuiescence(1, TimeUnit.SECONDS)) {
+        if (shutdownNotifier.shouldShutdown()) {
+          breakRequested.set(true);
+        }
+      }
+    } finally {
+      pool.shutdownNow();
+      stats.countSteals += pool.getStealCount();
+    }
+
+    Throwable t = error.get();
+    if (t != null) {
+      Throwables.propagateIfPossible(t, CPAException.class, InterruptedException.class);
+      throw new AssertionError("unexpected exception in worker thread", t);
+    }
+    shutdownNotifier.shutdownIfNecessary();
+    return status;
+  }
+
+  /** The task of handling one state from the waitlist. */
+  private class StateTask extends RecursiveAction {
+
+    private static final long serialVersionUID = 1L;
+
+    private final AbstractState state;
+    private final ConcurrentPartitionedReachedSet reachedSet;
+
+    private StateTask(AbstractState pState, ConcurrentPartitionedReachedSet pReachedSet) {
+      state = pState;
+      reachedSet = pReachedSet;
+    }
+
+    @Override
+    protected void compute() {
+      if (breakRequested.get()) {
+        // keep the state for a later continuation of the analysis
+        reachedSet.reAddToWaitlist(state);
+        return;
+      }
+
+      TimerWrapper totalTimer = totalTimers.get();
+      totalTimer.start();
+      try {
+        if (handleState()) {
+          stats.countBreak.inc();
+          breakRequested.set(true);
+        }
+      } catch (CPAException | InterruptedException | RuntimeException | Error e) {
+        error.compareAndSet(null, e);
+        breakRequested.set(true);
+        reachedSet.reAddToWaitlist(state);
+      } finally {
+        totalTimer.stopIfRunning();
+      }
+    }
+
+    /**
+     * Handle the state of this task, i.e., produce successors and schedule them as new tasks.
+     *
+     * @return true if analysis should terminate, false if analysis should continue
+     */
+    private boolean handleState() throws CPAException, InterruptedException {
+      WorkerStatistics workerStats = stats.forCurrentThread();
+      workerStats.countIterations++;
+      shutdownNotifier.shutdownIfNecessary();
+
+      final Precision precision = reachedSet.getPrecision(state);
+      logger.log(Level.ALL, "Current state is", state, "with precision", precision);
+
+      long transferStart = stats.transferTimer.start();
+      Collection<? extends AbstractState> successors;
+      try {
+        successors = transferRelation.getAbstractSuccessors(state, precision);
+      } finally {
+        stats.transferTimer.stop(transferStart);
+      }
+      workerStats.countSuccessors += successors.size();
+
+      List<StateTask> newTasks = new ArrayList<>(successors.size());
+      try {
+        for (Iterator<? extends AbstractState> it = successors.iterator(); it.hasNext(); ) {
+          AbstractState successor = it.next();
+          shutdownNotifier.shutdownIfNecessary();
+
+          long precisionStart = stats.precisionTimer.start();
+          PrecisionAdjustmentResult precAdjustmentResult;
+          try {
+            Optional<PrecisionAdjustmentResult> precAdjustmentOptional =
+                precisionAdjustment.prec(
+                    successor, precision, reachedSet, Functions.identity(), successor);
+            if (!precAdjustmentOptional.isPresent()) {
+              continue;
+            }
+            precAdjustmentResult = precAdjustmentOptional.orElseThrow();
+          } finally {
+            stats.precisionTimer.stop(precisionStart);
+          }
+
+          successor = precAdjustmentResult.abstractState();
+          Precision successorPrecision = precAdjustmentResult.precision();
+          Action action = precAdjustmentResult.action();
+
+          long lockStart = stats.lockTimer.start();
+          Lock lock = reachedSet.getPartitionLock(successor);
+          lock.lock();
+          stats.lockTimer.stop(lockStart);
+          boolean stop;
+          try {
+            long stopStart = stats.stopTimer.start();
+            try {
+              stop =
+                  stopOperator.stop(
+                      successor, reachedSet.getCoveringCandidates(successor), successorPrecision);
+            } finally {
+              stats.stopTimer.stop(stopStart);
+            }
+
+            if (stop && (action == Action.CONTINUE || AbstractStates.isTargetState(successor))) {
+              // covered, and for BREAK the target state is ignored as in CPAAlgorithm
+              workerStats.countStop++;
+              continue;
+            }
+
+            long addStart = stats.addTimer.start();
+            reachedSet.add(successor, successorPrecision);
+            stats.addTimer.stop(addStart);
+          } finally {
+            lock.unlock();
+          }
+
+          if (action == Action.BREAK) {
+            logger.log(Level.FINER, "Break signalled, parallel CPAAlgorithm will stop.");
+            // the new state stays in the waitlist of the reached set
+            if (it.hasNext()) {
+              // there are unhandled successors left that otherwise would be forgotten
+              reachedSet.reAddToWaitlist(state);
+            }
+            return true;
+          }
+
+          assert action == Action.CONTINUE : "Enum Action has unhandled values!";
+          reachedSet.removeOnlyFromWaitlist(successor);
+          newTasks.add(new StateTask(successor, reachedSet));
+        }
+      } finally {
+        // schedule successors even in case of an exception,
+        // they will be re-added to the waitlist if the analysis stops
+        for (StateTask task : newTasks) {
+          task.fork();
+        }
+      }
+      return false;
+    }
+  }
+
+  @Override
+  public void collectStatistics(Collection<Statistics> pStatsCollection) {
+    pStatsCollection.add(stats);
+  }
+}
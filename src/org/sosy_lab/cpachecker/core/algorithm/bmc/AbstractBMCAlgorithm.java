@@ -17,11 +17,14 @@ import static org.sosy_lab.cpachecker.util.AbstractStates.extractLocation;
 import com.google.common.base.Joiner;
 import com.google.common.base.Predicate;
 import com.google.common.base.Predicates;
+import com.google.common.base.Throwables;
 import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
 import java.io.IOException;
 import java.math.BigInteger;
 import java.nio.file.Path;
@@ -32,9 +35,11 @@ import java.util.Comparator;
 import java.util.HashMap;
 import java.util.HashSet;
 import java.util.Iterator;
+import java.util.LinkedHashSet;
 import java.util.List;
 import java.util.Map;
 import java.util.Objects;
+import java.util.Optional;
 import java.util.PriorityQueue;
 import java.util.Queue;
 import java.util.Set;
@@ -42,6 +47,10 @@ import java.util.TreeSet;
 import java.util.concurrent.CopyOnWriteArrayList;
 import java.util.concurrent.CopyOnWriteArraySet;
 import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.function.ToIntFunction;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
@@ -70,6 +79,7 @@ import org.sosy_lab.cpachecker.core.algorithm.invariants.AbstractInvariantGenera
 import org.sosy_lab.cpachecker.core.algorithm.invariants.DoNothingInvariantGenerator;
 import org.sosy_lab.cpachecker.core.algorithm.invariants.InvariantGenerator;
 import org.sosy_lab.cpachecker.core.algorithm.invariants.KInductionInvariantGenerator;
+import org.sosy_lab.cpachecker.core.algorithm.invariants.SharedInvariantStore;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
 import org.sosy_lab.cpachecker.core.interfaces.LoopIterationBounding;
@@ -175,6 +185,29 @@ abstract class AbstractBMCAlgorithm
               + "The improvement depends on the underlying SMT solver.")
   private boolean simplifyBooleanFormula = false;
 
+  @Option(
+      secure = true,
+      description =
+          "Check the reachability of target states incrementally: the program formula of each"
+              + " bound is added to the prover permanently, guarded by an activation literal that"
+              + " is only assumed for the satisfiability check of this bound. This keeps the"
+              + " solver state (e.g., learned clauses) across bounds instead of pushing and"
+              + " popping the program formula. Requires a solver that supports checks under"
+              + " assumptions.")
+  private boolean incrementalTargetChecks = false;
+
+  @Option(
+      secure = true,
+      description =
+          "Run the step case of k-induction in a separate thread, in parallel to the base case of"
+              + " the same bound. Results of the step case are only applied to candidate"
+              + " invariants that passed the base case. Not used together with"
+              + " bmc.usePropertyDirection.")
+  private boolean parallelStepCase = false;
+
+  /** The number of activation literals that were created for incremental target checks. */
+  private int activationLiterals = 0;
+
   protected final BMCStatistics stats;
   private final Algorithm algorithm;
   private final ConfigurableProgramAnalysis cpa;
@@ -203,6 +236,9 @@ abstract class AbstractBMCAlgorithm
 
   private final AbstractionStrategy abstractionStrategy;
 
+  /** Invariants exchanged with other analyses, e.g., those running in parallel to this one. */
+  private final SharedInvariantStore sharedInvariants;
+
   /** The candidate invariants that have been proven to hold at the loop heads. */
   private final Set<CandidateInvariant> confirmedCandidates = new CopyOnWriteArraySet<>();
 
@@ -232,6 +268,7 @@ abstract class AbstractBMCAlgorithm
     reachedSetFactory = pReachedSetFactory;
     cfa = pCFA;
     specification = checkNotNull(pSpecification);
+    sharedInvariants = pAggregatedReachedSets.getSharedInvariants();
 
     shutdownNotifier = pShutdownManager.getNotifier();
     TestTargetCPA testCPA = CPAs.retrieveCPA(pCPA, TestTargetCPA.class);
@@ -365,6 +402,15 @@ abstract class AbstractBMCAlgorithm
 
     AlgorithmStatus status;
 
+    final @Nullable ExecutorService stepCaseExecutor =
+        induction && parallelStepCase
+            ? Executors.newSingleThreadExecutor(
+                new ThreadFactoryBuilder()
+                    .setDaemon(true)
+                    .setNameFormat("bmc-step-case-%d")
+                    .build())
+            : null;
+
     try (ProverEnvironment prover = solver.newProverEnvironment(ProverOptions.GENERATE_MODELS)) {
       invariantGeneratorHeadStart.waitForInvariantGenerator();
 
@@ -392,67 +438,95 @@ abstract class AbstractBMCAlgorithm
           return AlgorithmStatus.SOUND_AND_PRECISE;
         }
 
-        // Perform a bounded model check on each candidate invariant
-        Iterator<CandidateInvariant> candidateInvariantIterator = candidateGenerator.iterator();
-        while (candidateInvariantIterator.hasNext()) {
-          shutdownNotifier.shutdownIfNecessary();
-          CandidateInvariant candidateInvariant = candidateInvariantIterator.next();
-          // first check safety in k iterations
-
-          boolean safe = boundedModelCheck(reachedSet, prover, candidateInvariant);
-          if (!safe) {
-            if (candidateInvariant == TargetLocationCandidateInvariant.INSTANCE) {
-              return AlgorithmStatus.UNSOUND_AND_PRECISE;
+        @Nullable ParallelStepCase parallelStepCaseCheck = null;
+        if (stepCaseExecutor != null && status.isSound() && !usePropertyDirection) {
+          parallelStepCaseCheck =
+              new ParallelStepCase(
+                  stepCaseExecutor, reachedSet, candidateGenerator, ctiBlockingClauses);
+        }
+        try {
+          Set<CandidateInvariant> refutedCandidates = new HashSet<>();
+
+          // Perform a bounded model check on each candidate invariant
+          Iterator<CandidateInvariant> candidateInvariantIterator = candidateGenerator.iterator();
+          while (candidateInvariantIterator.hasNext()) {
+            shutdownNotifier.shutdownIfNecessary();
+            CandidateInvariant candidateInvariant = candidateInvariantIterator.next();
+            // first check safety in k iterations
+
+            boolean safe = boundedModelCheck(reachedSet, prover, candidateInvariant);
+            if (!safe) {
+              if (candidateInvariant == TargetLocationCandidateInvariant.INSTANCE) {
+                return AlgorithmStatus.UNSOUND_AND_PRECISE;
+              }
+              candidateInvariantIterator.remove();
+              refutedCandidates.add(candidateInvariant);
             }
-            candidateInvariantIterator.remove();
-          }
 
-          if (invariantGenerator.isProgramSafe()) {
-            TargetLocationCandidateInvariant.INSTANCE.assumeTruth(reachedSet);
-            return AlgorithmStatus.SOUND_AND_PRECISE;
+            if (invariantGenerator.isProgramSafe()) {
+              TargetLocationCandidateInvariant.INSTANCE.assumeTruth(reachedSet);
+              return AlgorithmStatus.SOUND_AND_PRECISE;
+            }
           }
-        }
 
-        // second check soundness
-        boolean sound;
+          // second check soundness
+          boolean sound;
 
-        // verify soundness, but don't bother if we are unsound anyway or we have found a bug
-        if (status.isSound()) {
+          // verify soundness, but don't bother if we are unsound anyway or we have found a bug
+          if (status.isSound()) {
 
-          // check bounding assertions
-          sound = candidateGenerator.hasCandidatesAvailable() ? checkBoundingAssertions(reachedSet, prover) : true;
+            // check bounding assertions
+            sound = candidateGenerator.hasCandidatesAvailable() ? checkBoundingAssertions(reachedSet, prover) : true;
 
-          if (invariantGenerator.isProgramSafe()) {
-            return AlgorithmStatus.SOUND_AND_PRECISE;
-          }
+            if (invariantGenerator.isProgramSafe()) {
+              return AlgorithmStatus.SOUND_AND_PRECISE;
+            }
 
-          // try to prove program safety via induction
-          if (induction && !sound) {
-            if (usePropertyDirection) {
-              usePropertyDirection =
-                  refineCtiBlockingClauses(reachedSet, prover, ctiBlockingClauses, checkedClauses);
-              if (!usePropertyDirection) {
-                ctiBlockingClauses.clear();
+            // try to prove program safety via induction
+            if (induction && !sound) {
+              if (usePropertyDirection) {
+                usePropertyDirection =
+                    refineCtiBlockingClauses(reachedSet, prover, ctiBlockingClauses, checkedClauses);
+                if (!usePropertyDirection) {
+                  ctiBlockingClauses.clear();
+                }
+              }
+              Optional<Boolean> parallelResult =
+                  parallelStepCaseCheck == null
+                      ? Optional.empty()
+                      : parallelStepCaseCheck.apply(candidateGenerator, refutedCandidates);
+              if (parallelResult.isPresent()) {
+                sound = parallelResult.orElseThrow();
+              } else {
+                try (@SuppressWarnings("resource")
+                    KInductionProver kInductionProver = createInductionProver(shutdownNotifier)) {
+                  sound =
+                      checkStepCase(
+                          reachedSet, candidateGenerator, kInductionProver, ctiBlockingClauses);
+                }
               }
             }
-            try (@SuppressWarnings("resource")
-                KInductionProver kInductionProver = createInductionProver()) {
-            sound =
-                checkStepCase(reachedSet, candidateGenerator, kInductionProver, ctiBlockingClauses);
+            if (invariantGenerator.isProgramSafe()
+                || (sound && !candidateGenerator.produceMoreCandidates())) {
+              return AlgorithmStatus.SOUND_AND_PRECISE;
             }
           }
-          if (invariantGenerator.isProgramSafe()
-              || (sound && !candidateGenerator.produceMoreCandidates())) {
-            return AlgorithmStatus.SOUND_AND_PRECISE;
-          }
-        }
 
-        if (!candidateGenerator.hasCandidatesAvailable()) {
-          // no remaining invariants to be proven
-          return status;
+          if (!candidateGenerator.hasCandidatesAvailable()) {
+            // no remaining invariants to be proven
+            return status;
+          }
+        } finally {
+          if (parallelStepCaseCheck != null) {
+            parallelStepCaseCheck.cancel();
+          }
         }
       }
       while (status.isSound() && adjustConditions());
+    } finally {
+      if (stepCaseExecutor != null) {
+        stepCaseExecutor.shutdownNow();
+      }
     }
 
     return AlgorithmStatus.UNSOUND_AND_PRECISE;
@@ -468,18 +542,66 @@ abstract class AbstractBMCAlgorithm
     final int k = CPAs.retrieveCPA(cpa, LoopIterationBounding.class).getMaxLoopIterations();
 
     Set<Object> checkedKeys = getCheckedKeys(reachedSet);
-    Predicate<CandidateInvariant> isApplicable =
-        getCandidateApplicabilityPredicate(reachedSet, checkedKeys);
-
     Set<CandidateInvariant> candidates =
-        FluentIterable.concat(pCtiBlockingClauses, candidateGenerator).filter(isApplicable).toSet();
-    Set<SymbolicCandiateInvariant> checked = new HashSet<>();
+        getStepCaseCandidates(reachedSet, checkedKeys, candidateGenerator, pCtiBlockingClauses);
 
     shutdownNotifier.shutdownIfNecessary();
 
-    boolean sound = true;
-    Iterable<CandidateInvariant> candidatesToCheck = candidates;
-    for (CandidateInvariant candidate : candidatesToCheck) {
+    StepCaseResult result =
+        checkStepCase(
+            k, checkedKeys, candidates, kInductionProver, pCtiBlockingClauses, confirmedCandidates);
+    candidateGenerator.confirmCandidates(result.confirmed);
+    publishConfirmedCandidates(result.confirmed);
+    return result.isSound();
+  }
+
+  /** Make the given confirmed candidates available to other analyses at the loop heads. */
+  private void publishConfirmedCandidates(Iterable<CandidateInvariant> pConfirmed) {
+    Set<CFANode> loopHeads = getLoopHeads();
+    for (CandidateInvariant candidate : pConfirmed) {
+      if (candidate == TargetLocationCandidateInvariant.INSTANCE) {
+        continue;
+      }
+      for (CFANode loopHead : loopHeads) {
+        if (candidate.appliesTo(loopHead)) {
+          sharedInvariants.publish(loopHead, candidate);
+        }
+      }
+    }
+  }
+
+  private Set<CandidateInvariant> getStepCaseCandidates(
+      ReachedSet pReachedSet,
+      Set<Object> pCheckedKeys,
+      CandidateGenerator pCandidateGenerator,
+      Set<Obligation> pCtiBlockingClauses) {
+    Predicate<CandidateInvariant> isApplicable =
+        getCandidateApplicabilityPredicate(pReachedSet, pCheckedKeys);
+    return FluentIterable.concat(pCtiBlockingClauses, pCandidateGenerator)
+        .filter(isApplicable)
+        .toSet();
+  }
+
+  /**
+   * Check the step case for the given candidates.
+   *
+   * @param pConfirmed the candidates that may be assumed to hold. The parts of successfully checked
+   *     candidates are added to this set immediately, because later candidates may rely on them.
+   * @return the result of the check. The confirmed candidates still need to be passed to the
+   *     candidate generator.
+   */
+  private StepCaseResult checkStepCase(
+      int k,
+      Set<Object> checkedKeys,
+      Set<CandidateInvariant> candidates,
+      KInductionProver kInductionProver,
+      Set<Obligation> pCtiBlockingClauses,
+      Set<CandidateInvariant> pConfirmed)
+      throws InterruptedException, CPAException, SolverException {
+    StepCaseResult result = new StepCaseResult();
+    Set<SymbolicCandiateInvariant> checked = new HashSet<>();
+
+    for (CandidateInvariant candidate : candidates) {
       // No need to check the same clause twice
       if (candidate instanceof Obligation) {
         if (!checked.add(((Obligation) candidate).getBlockingClause())) {
@@ -496,26 +618,26 @@ abstract class AbstractBMCAlgorithm
                   abstractionStrategy, AbstractionBasedLifting.RefinementLAFStrategies.EAGER)
               : StandardLiftings.NO_LIFTING;
 
+      // invariants proven by other analyses in the meantime may help, too
+      Set<CandidateInvariant> sharedAssumptions =
+          sharedInvariants.getInvariantsForAll(getLoopHeads());
+
       InductionResult<CandidateInvariant> inductionResult =
           kInductionProver.check(
-              Iterables.concat(confirmedCandidates, Collections.singleton(candidate)),
+              Iterables.concat(pConfirmed, sharedAssumptions, Collections.singleton(candidate)),
               k,
               candidate,
               checkedKeys,
               InvariantStrengthenings.noStrengthening(),
               lifting);
       if (inductionResult.isSuccessful()) {
-        Iterables.addAll(
-            confirmedCandidates,
-            CandidateInvariantCombination.getConjunctiveParts(candidate));
-        candidateGenerator.confirmCandidates(
-            CandidateInvariantCombination.getConjunctiveParts(candidate));
+        result.confirm(candidate, pConfirmed);
         if (candidate == TargetLocationCandidateInvariant.INSTANCE) {
-          sound = true;
+          result.targetLocationsUnreachable = true;
           break;
         }
       } else {
-        sound = false;
+        result.failed.add(candidate);
 
         if (candidate instanceof Obligation) {
           Obligation obligation = (Obligation) candidate;
@@ -523,18 +645,15 @@ abstract class AbstractBMCAlgorithm
           for (SymbolicCandiateInvariant weakening : weakenings) {
             inductionResult =
                 kInductionProver.check(
-                    Iterables.concat(confirmedCandidates, Collections.singleton(weakening)),
+                    Iterables.concat(
+                        pConfirmed, sharedAssumptions, Collections.singleton(weakening)),
                     k,
                     weakening,
                     checkedKeys,
                     InvariantStrengthenings.noStrengthening(),
                     lifting);
             if (inductionResult.isSuccessful()) {
-              Iterables.addAll(
-                  confirmedCandidates,
-                  CandidateInvariantCombination.getConjunctiveParts(weakening));
-              candidateGenerator.confirmCandidates(
-                  CandidateInvariantCombination.getConjunctiveParts(weakening));
+              result.confirm(weakening, pConfirmed);
               break;
             }
           }
@@ -556,7 +675,121 @@ abstract class AbstractBMCAlgorithm
         }
       }
     }
-    return sound;
+    return result;
+  }
+
+  /** The outcome of checking the step case for a set of candidate invariants. */
+  private static final class StepCaseResult {
+
+    /** The candidates (or weakenings of candidates) that were proven inductive, in order. */
+    private final List<CandidateInvariant> proven = new ArrayList<>();
+
+    /** The conjunctive parts of the proven candidates. */
+    private final List<CandidateInvariant> confirmed = new ArrayList<>();
+
+    /** The candidates for which the step case failed. */
+    private final List<CandidateInvariant> failed = new ArrayList<>();
+
+    private boolean targetLocationsUnreachable = false;
+
+    private void confirm(CandidateInvariant pCandidate, Set<CandidateInvariant> pConfirmed) {
+      proven.add(pCandidate);
+      for (CandidateInvariant part : CandidateInvariantCombination.getConjunctiveParts(pCandidate)) {
+        confirmed.add(part);
+        pConfirmed.add(part);
+      }
+    }
+
+    private boolean isSound() {
+      return targetLocationsUnreachable || failed.isEmpty();
+    }
+  }
+
+  /**
+   * A step-case check for the current bound that runs in parallel to the base case. It works on
+   * its own copy of the confirmed candidates, because the base case may still refute candidates
+   * that the step case proves inductive. The results are only applied if none of the proven
+   * candidates was refuted.
+   */
+  private final class ParallelStepCase {
+
+    private final ShutdownManager stepCaseShutdownManager;
+    private final Future<StepCaseResult> result;
+
+    private ParallelStepCase(
+        ExecutorService pExecutor,
+        ReachedSet pReachedSet,
+        CandidateGenerator pCandidateGenerator,
+        Set<Obligation> pCtiBlockingClauses) {
+      // everything that depends on the shared state is computed before the check is started
+      int k = CPAs.retrieveCPA(cpa, LoopIterationBounding.class).getMaxLoopIterations();
+      Set<Object> checkedKeys = getCheckedKeys(pReachedSet);
+      Set<CandidateInvariant> candidates =
+          getStepCaseCandidates(pReachedSet, checkedKeys, pCandidateGenerator, pCtiBlockingClauses);
+      Set<Obligation> ctiBlockingClauses = new TreeSet<>(pCtiBlockingClauses);
+      Set<CandidateInvariant> assumptions = new LinkedHashSet<>(confirmedCandidates);
+      stepCaseShutdownManager = ShutdownManager.createWithParent(shutdownNotifier);
+      ShutdownNotifier stepCaseShutdownNotifier = stepCaseShutdownManager.getNotifier();
+      result =
+          pExecutor.submit(
+              () -> {
+                try (KInductionProver kInductionProver =
+                    createInductionProver(stepCaseShutdownNotifier)) {
+                  return checkStepCase(
+                      k, checkedKeys, candidates, kInductionProver, ctiBlockingClauses, assumptions);
+                }
+              });
+    }
+
+    /**
+     * Wait for the step case and apply its results, if they are valid.
+     *
+     * @param pRefutedCandidates the candidates that were refuted by the base case of this bound.
+     * @return whether the step case succeeded, or empty if the result needs to be discarded and
+     *     the step case needs to be checked again.
+     */
+    private Optional<Boolean> apply(
+        CandidateGenerator pCandidateGenerator, Set<CandidateInvariant> pRefutedCandidates)
+        throws InterruptedException, CPAException, SolverException {
+      StepCaseResult stepCaseResult;
+      try {
+        stepCaseResult = result.get();
+      } catch (ExecutionException e) {
+        Throwables.throwIfInstanceOf(e.getCause(), CPAException.class);
+        Throwables.throwIfInstanceOf(e.getCause(), InterruptedException.class);
+        Throwables.throwIfInstanceOf(e.getCause(), SolverException.class);
+        Throwables.throwIfUnchecked(e.getCause());
+        throw new AssertionError(e);
+      }
+      if (!Collections.disjoint(stepCaseResult.proven, pRefutedCandidates)) {
+        logger.log(
+            Level.FINE,
+            "Discarding result of parallel step case, which relied on refuted candidates.");
+        return Optional.empty();
+      }
+      Iterables.addAll(confirmedCandidates, stepCaseResult.confirmed);
+      pCandidateGenerator.confirmCandidates(stepCaseResult.confirmed);
+      publishConfirmedCandidates(stepCaseResult.confirmed);
+      return Optional.of(
+          stepCaseResult.targetLocationsUnreachable
+              || pRefutedCandidates.containsAll(stepCaseResult.failed));
+    }
+
+    /**
+     * Stop the step case if it is still running and wait for it, because the step-case analysis
+     * must not be used by several checks concurrently.
+     */
+    private void cancel() {
+      if (!result.isDone()) {
+        stepCaseShutdownManager.requestShutdown("Result of parallel step case not needed");
+      }
+      try {
+        Uninterruptibles.getUninterruptibly(result);
+      } catch (ExecutionException e) {
+        // result not needed
+        logger.logDebugException(e);
+      }
+    }
   }
 
   /**
@@ -626,6 +859,11 @@ abstract class AbstractBMCAlgorithm
           sizeBeforeSimplification,
           sizeAfterSimplification);
     }
+    if (incrementalTargetChecks
+        && pCandidateInvariant == TargetLocationCandidateInvariant.INSTANCE
+        && pReachedSet instanceof ReachedSet) {
+      return boundedModelCheckIncrementally((ReachedSet) pReachedSet, pProver, program);
+    }
     logger.log(Level.INFO, "Starting satisfiability check...");
     stats.satCheck.start();
     pProver.push(program);
@@ -647,6 +885,38 @@ abstract class AbstractBMCAlgorithm
     return safe;
   }
 
+  /**
+   * Check whether target states are reachable without removing the program formula from the prover
+   * afterwards. Target states of previous bounds were already removed from the reached set, so the
+   * given program formula only describes the paths to the newly reached target states. It is
+   * asserted in an implication from a fresh activation literal, which is assumed for this check
+   * only. If the check is unsatisfiable, the negated literal is asserted, which disables the
+   * formula for good, while the solver may keep everything it learned about the shared path
+   * prefixes for the next bounds.
+   */
+  private boolean boundedModelCheckIncrementally(
+      ReachedSet pReachedSet, BasicProverEnvironment<?> pProver, BooleanFormula pProgram)
+      throws CPATransferException, InterruptedException, SolverException {
+    BooleanFormula activationLiteral =
+        bfmgr.makeVariable("__bmc_activation_" + activationLiterals++);
+    logger.log(Level.INFO, "Starting incremental satisfiability check...");
+    stats.satCheck.start();
+    pProver.addConstraint(bfmgr.implication(activationLiteral, pProgram));
+    boolean safe = pProver.isUnsatWithAssumptions(ImmutableList.of(activationLiteral));
+    stats.satCheck.stop();
+
+    if (safe) {
+      pProver.addConstraint(bfmgr.not(activationLiteral));
+      TargetLocationCandidateInvariant.INSTANCE.assumeTruth(pReachedSet);
+    } else {
+      // counterexample analysis expects the program formula on the solver stack
+      pProver.push(pProgram);
+      analyzeCounterexample(pProgram, pReachedSet, pProver);
+      pProver.pop();
+    }
+    return safe;
+  }
+
   private boolean refineCtiBlockingClauses(
       ReachedSet pReachedSet,
       BasicProverEnvironment<?> pProver,
@@ -835,7 +1105,7 @@ abstract class AbstractBMCAlgorithm
     }
   }
 
-  protected KInductionProver createInductionProver() {
+  protected KInductionProver createInductionProver(ShutdownNotifier pShutdownNotifier) {
     assert induction;
     return new KInductionProver(
         cfa,
@@ -845,7 +1115,7 @@ abstract class AbstractBMCAlgorithm
         invariantGenerator,
         stats,
         reachedSetFactory,
-        shutdownNotifier,
+        pShutdownNotifier,
         getLoopHeads(),
         usePropertyDirection);
   }
@@ -12,6 +12,7 @@ import com.google.common.base.Verify;
 import java.util.Objects;
 import java.util.Optional;
 import org.sosy_lab.common.ShutdownManager;
+import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.log.LogManager;
@@ -92,8 +93,8 @@ public class BMCAlgorithmForInvariantGeneration extends AbstractBMCAlgorithm {
   }
 
   @Override
-  protected KInductionProver createInductionProver() {
-    final KInductionProver prover = super.createInductionProver();
+  protected KInductionProver createInductionProver(ShutdownNotifier pShutdownNotifier) {
+    final KInductionProver prover = super.createInductionProver(pShutdownNotifier);
 
     if (prover != null) {
       locationInvariantsProvider =
@@ -8,7 +8,14 @@
 
 package org.sosy_lab.cpachecker.core.algorithm.bmc;
 
+import static java.util.concurrent.TimeUnit.SECONDS;
+
+import com.google.common.base.Joiner;
+import com.google.common.collect.Maps;
 import java.io.PrintStream;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
@@ -24,6 +31,12 @@ public class BMCStatistics implements Statistics {
   final Timer inductionPreparation = new Timer();
   final Timer inductionCheck = new Timer();
 
+  final Timer interpolation = new Timer();
+  final Timer fixedPointCheck = new Timer();
+
+  /** Time spent for computing fixed points by interpolation, for each loop bound. */
+  final Map<Integer, TimeSpan> interpolationTimePerBound = new LinkedHashMap<>();
+
   @Override
   public void printStatistics(PrintStream out, Result pResult, UnmodifiableReachedSet pReached) {
     if (bmcPreparation.getNumberOfIntervals() > 0) {
@@ -42,6 +55,15 @@ public class BMCStatistics implements Statistics {
       out.println("Time for induction formula creation: " + inductionPreparation);
       out.println("Time for induction check:            " + inductionCheck);
     }
+    if (interpolation.getNumberOfIntervals() > 0) {
+      out.println("Time for interpolation:              " + interpolation);
+      out.println("Time for fixed-point checks:         " + fixedPointCheck);
+      out.println(
+          "Time for interpolation per bound:    "
+              + Joiner.on(", ")
+                  .withKeyValueSeparator(": ")
+                  .join(Maps.transformValues(interpolationTimePerBound, t -> t.formatAs(SECONDS))));
+    }
   }
 
   @Override
@@ -15,12 +15,14 @@ import com.google.common.collect.ImmutableList;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownManager;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.core.algorithm.Algorithm;
 import org.sosy_lab.cpachecker.core.algorithm.bmc.candidateinvariants.TargetLocationCandidateInvariant;
@@ -47,6 +49,7 @@ import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
 import org.sosy_lab.java_smt.api.BooleanFormula;
 import org.sosy_lab.java_smt.api.InterpolatingProverEnvironment;
+import org.sosy_lab.java_smt.api.ProverEnvironment;
 import org.sosy_lab.java_smt.api.SolverException;
 
 /**
@@ -79,6 +82,14 @@ public class IMCAlgorithm extends AbstractBMCAlgorithm implements Algorithm {
   @Option(secure = true, description = "toggle removing unreachable stop states in ARG")
   private boolean removeUnreachableStopStates = false;
 
+  @Option(
+      secure = true,
+      description =
+          "toggle reusing the over-approximation of the reachable states computed for the"
+              + " previous loop bound as starting point for the next bound (falls back to the"
+              + " initial states if it is too coarse)")
+  private boolean reuseImages = false;
+
   private final ConfigurableProgramAnalysis cpa;
 
   private final Algorithm algorithm;
@@ -89,6 +100,9 @@ public class IMCAlgorithm extends AbstractBMCAlgorithm implements Algorithm {
 
   private final CFA cfa;
 
+  /** The image of the previous loop bound, if {@link #reuseImages} is enabled. */
+  private @Nullable ImageProver previousImage = null;
+
   public IMCAlgorithm(
       Algorithm pAlgorithm,
       ConfigurableProgramAnalysis pCPA,
@@ -133,6 +147,10 @@ public class IMCAlgorithm extends AbstractBMCAlgorithm implements Algorithm {
       throw new CPAException("Solver Failure " + e.getMessage(), e);
     } finally {
       invariantGenerator.cancel();
+      if (previousImage != null) {
+        previousImage.close();
+        previousImage = null;
+      }
     }
   }
 
@@ -213,12 +231,17 @@ public class IMCAlgorithm extends AbstractBMCAlgorithm implements Algorithm {
         PartitionedFormulas formulas = collectFormulas(pReachedSet);
         formulas.printCollectedFormulas(logger);
         logger.log(Level.FINE, "Computing fixed points by interpolation");
+        Timer boundTimer = new Timer();
+        boundTimer.start();
         try (InterpolatingProverEnvironment<?> itpProver =
             solver.newProverEnvironmentWithInterpolation()) {
           if (reachFixedPointByInterpolation(itpProver, formulas)) {
             removeUnreachableTargetStates(pReachedSet);
             return AlgorithmStatus.SOUND_AND_PRECISE;
           }
+        } finally {
+          boundTimer.stop();
+          stats.interpolationTimePerBound.put(maxLoopIterations, boundTimer.getSumTime());
         }
       }
       removeUnreachableTargetStates(pReachedSet);
@@ -400,7 +423,11 @@ public class IMCAlgorithm extends AbstractBMCAlgorithm implements Algorithm {
   }
 
   /**
-   * The method to iteratively compute fixed points by interpolation.
+   * The method to iteratively compute fixed points by interpolation. If {@link #reuseImages} is
+   * enabled, the image of the previous loop bound is tried first, because it already
+   * over-approximates the reachable states and was shown to not reach a target state in fewer
+   * steps. Only if it is too coarse for the current bound, the computation starts again from the
+   * initial states.
    *
    * @param itpProver the prover with interpolation enabled
    * @return {@code true} if a fixed point is reached, i.e., property is proved; {@code false} if
@@ -411,35 +438,146 @@ public class IMCAlgorithm extends AbstractBMCAlgorithm implements Algorithm {
       InterpolatingProverEnvironment<T> itpProver,
       final PartitionedFormulas formulas)
       throws InterruptedException, SolverException {
-    BooleanFormula prefixBooleanFormula = formulas.prefixFormula.getFormula();
+    if (previousImage != null) {
+      if (previousImage.appliesTo(formulas.prefixFormula)) {
+        logger.log(Level.FINE, "Continuing with the image of the previous bound");
+        if (reachFixedPointByInterpolation(itpProver, formulas, previousImage)) {
+          return true;
+        }
+        logger.log(Level.FINE, "The image of the previous bound is too coarse");
+      }
+      previousImage.close();
+      previousImage = null;
+    }
+
+    ImageProver image = new ImageProver(formulas.prefixFormula);
+    boolean fixedPointReached = false;
+    try {
+      fixedPointReached = reachFixedPointByInterpolation(itpProver, formulas, image);
+    } finally {
+      if (reuseImages && !fixedPointReached) {
+        previousImage = image;
+      } else {
+        image.close();
+      }
+    }
+    return fixedPointReached;
+  }
+
+  private <T> boolean reachFixedPointByInterpolation(
+      InterpolatingProverEnvironment<T> itpProver,
+      final PartitionedFormulas formulas,
+      final ImageProver image)
+      throws InterruptedException, SolverException {
     SSAMap prefixSsaMap = formulas.prefixFormula.getSsa();
     logger.log(Level.ALL, "The SSA map is", prefixSsaMap);
-    BooleanFormula currentImage = bfmgr.makeFalse();
-    currentImage = bfmgr.or(currentImage, prefixBooleanFormula);
 
     List<T> formulaA = new ArrayList<>();
     List<T> formulaB = new ArrayList<>();
     formulaB.add(itpProver.push(formulas.suffixFormula));
     formulaA.add(itpProver.push(formulas.loopFormula));
-    formulaA.add(itpProver.push(prefixBooleanFormula));
-
-    while (itpProver.isUnsat()) {
-      logger.log(Level.ALL, "The current image is", currentImage);
-      BooleanFormula interpolant = getInterpolantFrom(itpProver, formulaA, formulaB);
-      logger.log(Level.ALL, "The interpolant is", interpolant);
-      interpolant = fmgr.instantiate(fmgr.uninstantiate(interpolant), prefixSsaMap);
-      logger.log(Level.ALL, "After changing SSA", interpolant);
-      if (solver.implies(interpolant, currentImage)) {
-        logger.log(Level.INFO, "The current image reaches a fixed point");
-        return true;
+    formulaA.add(itpProver.push(image.getImage()));
+
+    try {
+      while (isUnsatForInterpolation(itpProver)) {
+        logger.log(Level.ALL, "The current image is", image.getImage());
+        stats.interpolation.start();
+        BooleanFormula interpolant;
+        try {
+          interpolant = getInterpolantFrom(itpProver, formulaA, formulaB);
+        } finally {
+          stats.interpolation.stop();
+        }
+        logger.log(Level.ALL, "The interpolant is", interpolant);
+        interpolant = fmgr.instantiate(fmgr.uninstantiate(interpolant), prefixSsaMap);
+        logger.log(Level.ALL, "After changing SSA", interpolant);
+        if (image.addIfNotImplied(interpolant)) {
+          logger.log(Level.INFO, "The current image reaches a fixed point");
+          return true;
+        }
+        itpProver.pop();
+        formulaA.remove(formulaA.size() - 1);
+        formulaA.add(itpProver.push(interpolant));
+      }
+      logger.log(Level.FINE, "The overapproximation is unsafe, going back to BMC phase");
+      return false;
+    } finally {
+      // leave the prover clean for a retry from the initial states
+      for (int i = 0; i < formulaA.size() + formulaB.size(); i++) {
+        itpProver.pop();
+      }
+    }
+  }
+
+  private boolean isUnsatForInterpolation(InterpolatingProverEnvironment<?> itpProver)
+      throws SolverException, InterruptedException {
+    stats.interpolation.start();
+    try {
+      return itpProver.isUnsat();
+    } finally {
+      stats.interpolation.stop();
+    }
+  }
+
+  /**
+   * The current over-approximation of the states reachable at the first loop head (the image),
+   * together with a prover that contains its negation. Because the image only grows by
+   * disjunctions, checking whether a new interpolant is implied by the image only needs to check
+   * the interpolant against the negations on this prover, which keeps its state between the
+   * checks, instead of a new implication query for the whole image each time.
+   */
+  private final class ImageProver implements AutoCloseable {
+
+    /** The formula of the initial states the image was started from. */
+    private final PathFormula prefixFormula;
+
+    private final ProverEnvironment prover;
+
+    private BooleanFormula image;
+
+    private ImageProver(PathFormula pPrefixFormula) throws InterruptedException {
+      prefixFormula = pPrefixFormula;
+      image = pPrefixFormula.getFormula();
+      prover = solver.newProverEnvironment();
+      prover.addConstraint(bfmgr.not(image));
+    }
+
+    /** Check whether this image was computed for the same initial states. */
+    private boolean appliesTo(PathFormula pPrefixFormula) {
+      return prefixFormula.equals(pPrefixFormula);
+    }
+
+    private BooleanFormula getImage() {
+      return image;
+    }
+
+    /**
+     * Check whether the given interpolant is implied by the image, and add it to the image
+     * otherwise.
+     *
+     * @return whether the image was a fixed point.
+     */
+    private boolean addIfNotImplied(BooleanFormula pInterpolant)
+        throws SolverException, InterruptedException {
+      stats.fixedPointCheck.start();
+      try {
+        prover.push(pInterpolant);
+        boolean implied = prover.isUnsat();
+        prover.pop();
+        if (!implied) {
+          prover.addConstraint(bfmgr.not(pInterpolant));
+          image = bfmgr.or(image, pInterpolant);
+        }
+        return implied;
+      } finally {
+        stats.fixedPointCheck.stop();
       }
-      currentImage = bfmgr.or(currentImage, interpolant);
-      itpProver.pop();
-      formulaA.remove(formulaA.size() - 1);
-      formulaA.add(itpProver.push(interpolant));
     }
-    logger.log(Level.FINE, "The overapproximation is unsafe, going back to BMC phase");
-    return false;
+
+    @Override
+    public void close() {
+      prover.close();
+    }
   }
 
   @Override
@@ -24,6 +24,7 @@ import java.util.Map;
 import java.util.Set;
 import java.util.stream.Collectors;
 import java.util.stream.IntStream;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.cpachecker.core.algorithm.bmc.ProverEnvironmentWithFallback;
 import org.sosy_lab.cpachecker.core.algorithm.bmc.candidateinvariants.CandidateInvariant;
 import org.sosy_lab.cpachecker.core.algorithm.bmc.candidateinvariants.CandidateInvariantCombination;
@@ -45,6 +46,13 @@ class FrameSet implements AutoCloseable {
   private final Map<CandidateInvariant, Integer> rootCandidateInvariantFrontierIndices =
       new HashMap<>();
 
+  /**
+   * Cache for the invariants of each frame, i.e., the clauses of the frame and all later frames.
+   * These are requested for every proof obligation, but change much less frequently. An entry is
+   * <code>null</code> if it needs to be recomputed.
+   */
+  private final List<@Nullable ImmutableSet<CandidateInvariant>> invariants = new ArrayList<>();
+
   public FrameSet(Solver pSolver, Set<ProverOptions> pProverOptions) {
     solver = pSolver;
     proverOptions =
@@ -54,6 +62,7 @@ class FrameSet implements AutoCloseable {
 
   private void newFrame() {
     frames.add(new LinkedHashSet<>());
+    invariants.add(ImmutableSet.of());
 
     @SuppressWarnings("resource")
     ProverEnvironmentWithFallback prover =
@@ -108,10 +117,23 @@ class FrameSet implements AutoCloseable {
     if (pFrameIndex > getFrontierIndex()) {
       return ImmutableSet.of();
     }
-    return IntStream.rangeClosed(pFrameIndex, getFrontierIndex())
-        .mapToObj(frames::get)
-        .flatMap(Collection::stream)
-        .collect(ImmutableSet.toImmutableSet());
+    ImmutableSet<CandidateInvariant> result = invariants.get(pFrameIndex);
+    if (result == null) {
+      result =
+          IntStream.rangeClosed(pFrameIndex, getFrontierIndex())
+              .mapToObj(frames::get)
+              .flatMap(Collection::stream)
+              .collect(ImmutableSet.toImmutableSet());
+      invariants.set(pFrameIndex, result);
+    }
+    return result;
+  }
+
+  /** Invalidate the cached invariants of all frames affected by a change of the given frame. */
+  private void frameChanged(int pFrameIndex) {
+    for (int i = 0; i <= pFrameIndex; ++i) {
+      invariants.set(i, null);
+    }
   }
 
   public void addFrameClause(int pFrameIndex, CandidateInvariant pClause) {
@@ -127,6 +149,7 @@ class FrameSet implements AutoCloseable {
     }
     if (added) {
       emptyFrames.remove(pFrameIndex);
+      frameChanged(pFrameIndex);
     }
   }
 
@@ -144,6 +167,7 @@ class FrameSet implements AutoCloseable {
     }
     addFrameClause(pFrameIndex + 1, pClause);
     frames.get(pFrameIndex + 1).add(pClause);
+    frameChanged(pFrameIndex + 1);
   }
 
   public int getFrontierIndex(CandidateInvariant pRootInvariant) {
@@ -185,6 +209,7 @@ class FrameSet implements AutoCloseable {
     assert getFrontierIndex() >= pFrontierIndex;
     frames.get(pFrontierIndex).add(pRootInvariant);
     rootCandidateInvariantFrontierIndices.put(pRootInvariant, pFrontierIndex);
+    frameChanged(pFrontierIndex);
   }
 
   public boolean isConfirmed(CandidateInvariant pRootInvariant) {
@@ -97,11 +97,16 @@ public class CompositionAlgorithm implements Algorithm, StatisticsProvider {
 
   private class CompositionAlgorithmStatistics implements Statistics {
     private final Timer totalTimer;
+    // time for setting up the CPA, reached set and algorithm of each run, which is overhead
+    // compared to running all analyses once
+    private final Timer creationTimer;
     private final Collection<Statistics> currentSubStat;
     private int noOfRuns = 0;
+    private int noOfCreatedCPAs = 0;
 
     public CompositionAlgorithmStatistics() {
       totalTimer = new Timer();
+      creationTimer = new Timer();
       currentSubStat = new ArrayList<>();
     }
 
@@ -127,7 +132,9 @@ public class CompositionAlgorithm implements Algorithm, StatisticsProvider {
 
       pOut.println("Number of algorithms provided:    " + configFiles.size());
       pOut.println("Number of composite analysis runs:        " + noOfRuns);
+      pOut.println("Number of created CPAs:           " + noOfCreatedCPAs);
       pOut.println("Total time: " + totalTimer);
+      pOut.println("Time for creating analyses: " + creationTimer);
 
       printSubStatistics(pOut, pResult, pReached);
     }
@@ -341,7 +348,12 @@ public class CompositionAlgorithm implements Algorithm, StatisticsProvider {
             continue;
           }
 
+          stats.creationTimer.start();
+          try {
             currentRun = createNextAlgorithm(currentContext, mainFunction, previousContext);
+          } finally {
+            stats.creationTimer.stop();
+          }
           if (currentRun == null) {
             logger
                 .log(Level.WARNING, "Skip current analysis because analysis could not be set up.");
@@ -553,6 +565,7 @@ public class CompositionAlgorithm implements Algorithm, StatisticsProvider {
                   shutdownNotifier,
                   aggregateReached);
           cpa = globalCoreComponents.createCPA(cfa, specification);
+          stats.noOfCreatedCPAs++;
           pCurrentContext.setCPA(cpa);
           if (!pCurrentContext.reusePrecision()) {
             // create reached set only once, continue analysis
@@ -564,6 +577,7 @@ public class CompositionAlgorithm implements Algorithm, StatisticsProvider {
         // do not reuse cpa, and, thus reached set
         try {
           cpa = localCoreComponents.createCPA(cfa, specification);
+          stats.noOfCreatedCPAs++;
           pCurrentContext.setCPA(cpa);
           newReachedSet = true;
         } catch (InvalidConfigurationException e) {
@@ -12,7 +12,10 @@ import static com.google.common.collect.FluentIterable.from;
 import static org.sosy_lab.common.collect.Collections3.transformedImmutableListCopy;
 import static org.sosy_lab.cpachecker.util.statistics.StatisticsUtils.toPercent;
 
+import com.google.common.base.Joiner;
 import com.google.common.base.Predicates;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
 import java.io.PrintStream;
 import java.util.ArrayList;
 import java.util.Collection;
@@ -59,6 +62,7 @@ public class CounterexampleCheckAlgorithm
 
   private final Algorithm algorithm;
   private final CounterexampleChecker checker;
+  private final String checkerDescription;
   private final LogManager logger;
 
   private final Timer checkTime = new Timer();
@@ -72,6 +76,15 @@ public class CounterexampleCheckAlgorithm
                     + "checker can be used.")
   private CounterexampleCheckerType checkerType = CounterexampleCheckerType.CBMC;
 
+  @Option(
+      secure = true,
+      name = "parallelCheckers",
+      description =
+          "Further checkers that check each counterexample in parallel to the one given by "
+              + "counterexample.checker. The first conclusive result is used "
+              + "and the remaining checks are cancelled.")
+  private List<CounterexampleCheckerType> parallelCheckers = ImmutableList.of();
+
   @Option(secure=true, name="ambigiousARG",
       description="True if the path to the error state can not always be uniquely determined from the ARG.\n"
                 + "This is the case e.g. for Slicing Abstractions, where the abstraction states in the ARG\n"
@@ -95,29 +108,57 @@ public class CounterexampleCheckAlgorithm
       throw new InvalidConfigurationException("ARG CPA needed for counterexample check");
     }
 
-    switch (checkerType) {
+    ImmutableList<CounterexampleCheckerType> checkerTypes =
+        ImmutableSet.<CounterexampleCheckerType>builder()
+            .add(checkerType)
+            .addAll(parallelCheckers)
+            .build()
+            .asList();
+    checkerDescription = Joiner.on(", ").join(checkerTypes);
+
+    if (checkerTypes.size() == 1) {
+      checker =
+          createChecker(
+              checkerType, config, pSpecification, logger, pShutdownNotifier, cfa, pCpa);
+    } else {
+      checker =
+          new ParallelCounterexampleChecker(
+              checkerTypes,
+              (type, notifier) ->
+                  createChecker(type, config, pSpecification, logger, notifier, cfa, pCpa),
+              logger,
+              pShutdownNotifier);
+    }
+  }
+
+  private static CounterexampleChecker createChecker(
+      CounterexampleCheckerType pType,
+      Configuration config,
+      Specification pSpecification,
+      LogManager logger,
+      ShutdownNotifier pShutdownNotifier,
+      CFA cfa,
+      ConfigurableProgramAnalysis pCpa)
+      throws InvalidConfigurationException {
+    switch (pType) {
     case CBMC:
-      checker = new CBMCChecker(config, logger, cfa);
-      break;
+      return new CBMCChecker(config, logger, cfa);
     case CPACHECKER:
       AssumptionToEdgeAllocator assumptionToEdgeAllocator =
           AssumptionToEdgeAllocator.create(config, logger, cfa.getMachineModel());
-      checker =
-          new CounterexampleCPAchecker(
-              config,
-              pSpecification,
-              logger,
-              pShutdownNotifier,
-              cfa,
-              s ->
-                  ARGUtils.tryGetOrCreateCounterexampleInformation(
-                      s, pCpa, assumptionToEdgeAllocator));
-      break;
+      return new CounterexampleCPAchecker(
+          config,
+          pSpecification,
+          logger,
+          pShutdownNotifier,
+          cfa,
+          s ->
+              ARGUtils.tryGetOrCreateCounterexampleInformation(
+                  s, pCpa, assumptionToEdgeAllocator));
     case CONCRETE_EXECUTION:
-      checker = new ConcretePathExecutionChecker(config, logger, cfa);
-      break;
+      return new ConcretePathExecutionChecker(config, logger, cfa);
     default:
-      throw new AssertionError("Unhandled case statement: " + checkerType);
+      throw new AssertionError("Unhandled case statement: " + pType);
     }
   }
 
@@ -165,7 +206,7 @@ public class CounterexampleCheckAlgorithm
           assert !infeasibleErrorPaths.isEmpty();
           throw new InfeasibleCounterexampleException(
               "Error path found, but identified as infeasible by counterexample check with "
-                  + checkerType
+                  + checkerDescription
                   + ".",
               transformedImmutableListCopy(infeasibleErrorPaths, ARGUtils::getOnePathTo));
         }
@@ -179,7 +220,9 @@ public class CounterexampleCheckAlgorithm
   private boolean checkCounterexample(ARGState errorState, ReachedSet reached)
       throws InterruptedException {
 
-    logger.log(Level.INFO, "Error path found, starting counterexample check with " + checkerType + ".");
+    logger.log(
+        Level.INFO,
+        "Error path found, starting counterexample check with " + checkerDescription + ".");
     final boolean feasibility;
     try {
       feasibility = checkErrorPaths(checker, errorState, reached);
@@ -189,7 +232,11 @@ public class CounterexampleCheckAlgorithm
     }
 
     if (feasibility) {
-      logger.log(Level.INFO, "Error path found and confirmed by counterexample check with " + checkerType + ".");
+      logger.log(
+          Level.INFO,
+          "Error path found and confirmed by counterexample check with "
+              + checkerDescription
+              + ".");
 
     } else {
       numberOfInfeasiblePaths++;
@@ -0,0 +1,147 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.counterexamplecheck;
+
+import com.google.common.base.Throwables;
+import com.google.common.collect.ImmutableList;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.CompletionService;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorCompletionService;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.logging.Level;
+import org.sosy_lab.common.Classes.UnexpectedCheckedException;
+import org.sosy_lab.common.ShutdownManager;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.algorithm.counterexamplecheck.CounterexampleCheckAlgorithm.CounterexampleCheckerType;
+import org.sosy_lab.cpachecker.cpa.arg.ARGState;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.exceptions.CounterexampleAnalysisFailed;
+
+/**
+ * Counterexample checker that lets several other checkers race on each counterexample. The
+ * result of the first checker that terminates without an error is returned, and the remaining
+ * checks are cancelled (by a shutdown request for checkers that support a {@link
+ * ShutdownNotifier}, and by interrupting their threads, which stops external processes).
+ *
+ * <p>The checkers only read the ARG, so they can run in parallel, but the ARG must not be changed
+ * during a check.
+ */
+class ParallelCounterexampleChecker implements CounterexampleChecker {
+
+  /** Creates a checker that stops when the given notifier requests a shutdown. */
+  interface CheckerFactory {
+    CounterexampleChecker create(CounterexampleCheckerType pType, ShutdownNotifier pNotifier)
+        throws InvalidConfigurationException;
+  }
+
+  private final ImmutableList<CounterexampleCheckerType> checkerTypes;
+  private final CheckerFactory checkerFactory;
+  private final LogManager logger;
+  private final ShutdownNotifier shutdownNotifier;
+  private final ExecutorService executor;
+
+  ParallelCounterexampleChecker(
+      List<CounterexampleCheckerType> pCheckerTypes,
+      CheckerFactory pCheckerFactory,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier)
+      throws InvalidConfigurationException {
+    checkerTypes = ImmutableList.copyOf(pCheckerTypes);
+    checkerFactory = pCheckerFactory;
+    logger = pLogger;
+    shutdownNotifier = pShutdownNotifier;
+
+    // create each checker once such that configuration errors are reported immediately
+    for (CounterexampleCheckerType type : checkerTypes) {
+      checkerFactory.create(type, pShutdownNotifier);
+    }
+
+    // threads of a cached pool terminate when they are idle, so no explicit shutdown is needed
+    executor =
+        Executors.newCachedThreadPool(
+            new ThreadFactoryBuilder()
+                .setDaemon(true)
+                .setNameFormat("counterexample-check-%d")
+                .build());
+  }
+
+  @Override
+  public boolean checkCounterexample(
+      ARGState pRootState, ARGState pErrorState, Set<ARGState> pErrorPathStates)
+      throws CPAException, InterruptedException {
+    ShutdownManager raceShutdownManager = ShutdownManager.createWithParent(shutdownNotifier);
+    CompletionService<Boolean> completionService = new ExecutorCompletionService<>(executor);
+    Map<Future<Boolean>, CounterexampleCheckerType> futures = new HashMap<>();
+
+    try {
+      for (CounterexampleCheckerType type : checkerTypes) {
+        CounterexampleChecker checker;
+        try {
+          // a new instance for each race, because the notifier cannot be reset after a shutdown
+          checker = checkerFactory.create(type, raceShutdownManager.getNotifier());
+        } catch (InvalidConfigurationException e) {
+          throw new CounterexampleAnalysisFailed(
+              "Invalid configuration for counterexample check with " + type, e);
+        }
+        futures.put(
+            completionService.submit(
+                () -> checker.checkCounterexample(pRootState, pErrorState, pErrorPathStates)),
+            type);
+      }
+
+      CPAException lastFailure = null;
+      for (int i = 0; i < futures.size(); i++) {
+        Future<Boolean> future = completionService.take();
+        CounterexampleCheckerType type = futures.get(future);
+        try {
+          boolean feasible = future.get();
+          logger.log(Level.FINE, "Counterexample check with", type, "finished first");
+          return feasible;
+
+        } catch (ExecutionException e) {
+          Throwable t = e.getCause();
+          if (t instanceof CPAException) {
+            logger.logDebugException(t, "Counterexample check with " + type + " failed");
+            lastFailure = (CPAException) t;
+            continue;
+          }
+          Throwables.propagateIfPossible(t, InterruptedException.class);
+          throw new UnexpectedCheckedException("counterexample check with " + type, t);
+        }
+      }
+      assert lastFailure != null;
+      throw lastFailure;
+
+    } finally {
+      raceShutdownManager.requestShutdown("Counterexample check finished by another checker");
+      for (Future<Boolean> future : futures.keySet()) {
+        future.cancel(true);
+      }
+      // wait for the cancelled checks such that no checker accesses the ARG after we return
+      for (Future<Boolean> future : futures.keySet()) {
+        try {
+          Uninterruptibles.getUninterruptibly(future);
+        } catch (ExecutionException | CancellationException e) {
+          // ignore, the result is not relevant anymore
+        }
+      }
+    }
+  }
+}
@@ -9,9 +9,14 @@
 package org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.unsat;
 
 import com.google.common.base.VerifyException;
+import java.util.ArrayList;
 import java.util.Collection;
 import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
 import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.FaultLocalizerWithTraceFormula;
 import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.trace_formula.FormulaContext;
 import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.trace_formula.Selector;
@@ -31,12 +36,35 @@ public class ModifiedMaxSatAlgorithm implements FaultLocalizerWithTraceFormula,
   private Solver solver;
   private BooleanFormulaManager bmgr;
 
+  private final boolean incremental;
+  private final int threads;
+
+  /** Checks the selector sets incrementally during a run if {@link #incremental} is set. */
+  private @Nullable SelectorSetChecker checker;
+
   // Statistics
   private final MaxSatStatistics stats = new MaxSatStatistics();
 
+  public ModifiedMaxSatAlgorithm() {
+    this(false, 1);
+  }
+
+  /**
+   * Create the algorithm.
+   *
+   * @param pIncremental whether the trace formula is asserted only once on a single prover, with
+   *     the selectors as assumptions and a cache of the found unsat cores
+   * @param pThreads the number of threads for checking independent candidates in incremental mode
+   */
+  public ModifiedMaxSatAlgorithm(boolean pIncremental, int pThreads) {
+    incremental = pIncremental;
+    threads = pThreads;
+  }
+
   @Override
   public Set<Fault> run(FormulaContext pContext, TraceFormula tf)
-      throws CPATransferException, InterruptedException, SolverException, VerifyException {
+      throws CPATransferException, InterruptedException, SolverException, VerifyException,
+          InvalidConfigurationException {
 
     solver = pContext.getSolver();
     bmgr = solver.getFormulaManager().getBooleanFormulaManager();
@@ -56,24 +84,71 @@ public class ModifiedMaxSatAlgorithm implements FaultLocalizerWithTraceFormula,
     Fault minUnsatCore = new Fault();
 
     stats.totalTime.start();
-    // loop as long as new unsat cores are found.
-    // if the newly found unsat core has the size of all left selectors break.
-    while (minUnsatCore.size() != numberSelectors) {
-      minUnsatCore = getMinUnsatCore(soft, tf, hard);
-      if (minUnsatCore.size() == 1) {
-        soft.removeAll(minUnsatCore);
-        numberSelectors = soft.size();
+    if (incremental) {
+      checker =
+          new SelectorSetChecker(
+              pContext, tf.getTraceFormula(), SelectorSetChecker.toSelectors(soft), threads, stats);
+    }
+    try {
+      // loop as long as new unsat cores are found.
+      // if the newly found unsat core has the size of all left selectors break.
+      while (minUnsatCore.size() != numberSelectors) {
+        minUnsatCore =
+            checker != null
+                ? getMinUnsatCoreIncrementally(soft, hard)
+                : getMinUnsatCore(soft, tf, hard);
+        if (minUnsatCore.size() == 1) {
+          soft.removeAll(minUnsatCore);
+          numberSelectors = soft.size();
+        }
+        // adding all possible selectors yields no information because the user knows that the
+        // program has bugs
+        if (minUnsatCore.size() != initSize) {
+          hard.add(minUnsatCore);
+        }
       }
-      // adding all possible selectors yields no information because the user knows that the program
-      // has bugs
-      if (minUnsatCore.size() != initSize) {
-        hard.add(minUnsatCore);
+    } finally {
+      if (checker != null) {
+        checker.close();
+        checker = null;
       }
+      stats.totalTime.stop();
     }
-    stats.totalTime.stop();
     return hard;
   }
 
+  /**
+   * Same as {@link #getMinUnsatCore(Set, TraceFormula, Set)}, but using the prover of {@link
+   * #checker}. If a check is unsatisfiable, the current set is immediately reduced to the unsat
+   * core that the solver reports, unless this core is a subset or superset of an already found
+   * set, which would lead to finding that set again.
+   */
+  private Fault getMinUnsatCoreIncrementally(Set<FaultContribution> pSoftSet, Set<Fault> pHardSet)
+      throws SolverException, InterruptedException {
+    Set<Selector> result = new HashSet<>(SelectorSetChecker.toSelectors(pSoftSet));
+    while (true) {
+      List<Set<Selector>> candidates = new ArrayList<>();
+      for (Selector s : result) {
+        Set<Selector> copy = new HashSet<>(result);
+        copy.remove(s);
+        if (!isSubsetOrSupersetOf(copy, pHardSet)) {
+          candidates.add(copy);
+        } else {
+          stats.savedCalls.inc();
+        }
+      }
+      Map.Entry<Integer, Set<Selector>> unsat = checker.findFirstUnsat(candidates);
+      if (unsat == null) {
+        return new Fault(new HashSet<>(result));
+      }
+      Set<Selector> core = unsat.getValue();
+      result =
+          isSubsetOrSupersetOf(core, pHardSet)
+              ? candidates.get(unsat.getKey())
+              : new HashSet<>(core);
+    }
+  }
+
   /**
    * Get a minimal subset of selectors considering the already found ones Minimal means that we
    * cannot remove a single selector from the returned set and maintain unsatisfiability. Minimal
@@ -112,7 +187,7 @@ public class ModifiedMaxSatAlgorithm implements FaultLocalizerWithTraceFormula,
     return result;
   }
 
-  private boolean isSubsetOrSupersetOf(Fault pSet, Set<Fault> pHardSet) {
+  private boolean isSubsetOrSupersetOf(Set<? extends FaultContribution> pSet, Set<Fault> pHardSet) {
     stats.timeForSubSupCheck.start();
     try {
       for (Set<FaultContribution> hardSet : pHardSet) {
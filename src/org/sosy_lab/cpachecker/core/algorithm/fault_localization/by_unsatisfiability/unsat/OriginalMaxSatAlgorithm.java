@@ -9,9 +9,12 @@
 package org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.unsat;
 
 import com.google.common.base.VerifyException;
+import com.google.common.collect.ImmutableSet;
 import java.util.Collection;
 import java.util.HashSet;
 import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.FaultLocalizerWithTraceFormula;
 import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.trace_formula.FormulaContext;
 import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.trace_formula.Selector;
@@ -31,12 +34,32 @@ public class OriginalMaxSatAlgorithm implements FaultLocalizerWithTraceFormula,
   private Solver solver;
   private BooleanFormulaManager bmgr;
 
+  private final boolean incremental;
+
+  /** Checks the selector sets incrementally during a run if {@link #incremental} is set. */
+  private @Nullable SelectorSetChecker checker;
+
   // Statistics
   private final MaxSatStatistics stats = new MaxSatStatistics();
 
+  public OriginalMaxSatAlgorithm() {
+    this(false);
+  }
+
+  /**
+   * Create the algorithm.
+   *
+   * @param pIncremental whether the trace formula is asserted only once on a single prover, with
+   *     the selectors as assumptions and a cache of the found unsat cores
+   */
+  public OriginalMaxSatAlgorithm(boolean pIncremental) {
+    incremental = pIncremental;
+  }
+
   @Override
   public Set<Fault> run(FormulaContext pContext, TraceFormula tf)
-      throws CPATransferException, InterruptedException, SolverException, VerifyException {
+      throws CPATransferException, InterruptedException, SolverException, VerifyException,
+          InvalidConfigurationException {
 
     solver = pContext.getSolver();
     bmgr = solver.getFormulaManager().getBooleanFormulaManager();
@@ -54,19 +77,61 @@ public class OriginalMaxSatAlgorithm implements FaultLocalizerWithTraceFormula,
 
     Fault complement;
     stats.totalTime.start();
-    // loop as long as new maxsat cores are found.
-    while (true) {
-      complement = coMSS(soft, tf, hard);
-      if (complement.isEmpty()) {
-        break;
+    if (incremental) {
+      checker =
+          new SelectorSetChecker(
+              pContext, tf.getTraceFormula(), SelectorSetChecker.toSelectors(soft), 1, stats);
+    }
+    try {
+      // loop as long as new maxsat cores are found.
+      while (true) {
+        complement = checker != null ? coMSSIncrementally(soft) : coMSS(soft, tf, hard);
+        if (complement.isEmpty()) {
+          break;
+        }
+        hard.add(complement);
+        soft.removeAll(complement);
+        if (checker != null) {
+          // strengthening keeps the cached unsat cores valid
+          checker.addConstraint(hardSetFormula(ImmutableSet.of(complement)));
+        }
+      }
+    } finally {
+      if (checker != null) {
+        checker.close();
+        checker = null;
       }
-      hard.add(complement);
-      soft.removeAll(complement);
+      stats.totalTime.stop();
     }
-    stats.totalTime.stop();
     return hard;
   }
 
+  /**
+   * Same as {@link #coMSS(Set, TraceFormula, Set)}, but using the prover of {@link #checker}, which
+   * already contains the trace formula and the found sets. Most of the repeated checks of the
+   * greedy loop are answered by the cached unsat cores.
+   */
+  private Fault coMSSIncrementally(Set<FaultContribution> pSoftSet)
+      throws SolverException, InterruptedException {
+    Set<Selector> selectors = new HashSet<>(SelectorSetChecker.toSelectors(pSoftSet));
+    Set<Selector> result = new HashSet<>();
+    boolean changed;
+    do {
+      changed = false;
+      for (Selector s : selectors) {
+        Set<Selector> copy = new HashSet<>(result);
+        copy.add(s);
+        if (checker.getUnsatCore(copy) == null) {
+          changed = true;
+          result.add(s);
+          selectors.remove(s);
+          break;
+        }
+      }
+    } while (changed);
+    return new Fault(new HashSet<>(selectors));
+  }
+
   /**
    * Get the complement of a maximal satisfiable set considering the already found ones
    *
@@ -0,0 +1,308 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.unsat;
+
+import static org.sosy_lab.java_smt.api.SolverContext.ProverOptions.GENERATE_UNSAT_CORE_OVER_ASSUMPTIONS;
+
+import com.google.common.base.Throwables;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import java.util.Set;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.Classes.UnexpectedCheckedException;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.trace_formula.FormulaContext;
+import org.sosy_lab.cpachecker.core.algorithm.fault_localization.by_unsatisfiability.trace_formula.Selector;
+import org.sosy_lab.cpachecker.util.faultlocalization.FaultContribution;
+import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool.PooledSolver;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.ProverEnvironment;
+import org.sosy_lab.java_smt.api.SolverException;
+
+/**
+ * Checks sets of selectors for unsatisfiability with a trace formula that is asserted only once.
+ * The selectors of a set are passed as assumptions to the prover, and the unsat cores over these
+ * assumptions are cached: a superset of a known core is unsatisfiable without a solver call.
+ *
+ * <p>Further hard constraints can be added with {@link #addConstraint(BooleanFormula)}. They keep
+ * all known cores valid, because a formula stays unsatisfiable if it is strengthened.
+ *
+ * <p>With more than one thread, independent candidate sets are checked in parallel on solvers of a
+ * {@link SolverPool}, which have their own copy of the trace formula.
+ */
+class SelectorSetChecker implements AutoCloseable {
+
+  private final MaxSatStatistics stats;
+  private final List<Set<Selector>> knownCores = new ArrayList<>();
+
+  private final Prover mainProver;
+
+  // only used for parallel checks
+  private final @Nullable SolverPool solverPool;
+  private final ImmutableList<Prover> pooledProvers;
+  private final @Nullable ExecutorService executor;
+
+  SelectorSetChecker(
+      FormulaContext pContext,
+      BooleanFormula pTraceFormula,
+      Collection<Selector> pSelectors,
+      int pThreads,
+      MaxSatStatistics pStats)
+      throws InterruptedException, InvalidConfigurationException {
+    stats = pStats;
+    Solver solver = pContext.getSolver();
+    ImmutableMap.Builder<Selector, BooleanFormula> selectorFormulas = ImmutableMap.builder();
+    for (Selector selector : ImmutableSet.copyOf(pSelectors)) {
+      selectorFormulas.put(selector, selector.getFormula());
+    }
+    mainProver = new Prover(solver, null, pTraceFormula, selectorFormulas.build());
+
+    if (pThreads > 1) {
+      solverPool =
+          new SolverPool(
+              pContext.getConfiguration(),
+              pContext.getLogger(),
+              pContext.getShutdownNotifier(),
+              solver.getFormulaManager(),
+              pThreads);
+      ImmutableList.Builder<Prover> provers = ImmutableList.builder();
+      for (int i = 0; i < pThreads; i++) {
+        // the solvers are acquired for the whole lifetime of this checker
+        PooledSolver pooled = solverPool.acquire();
+        ImmutableMap.Builder<Selector, BooleanFormula> translated = ImmutableMap.builder();
+        for (Selector selector : mainProver.selectorFormulas.keySet()) {
+          translated.put(selector, pooled.translateFromMain(selector.getFormula()));
+        }
+        provers.add(
+            new Prover(
+                pooled.getSolver(),
+                pooled,
+                pooled.translateFromMain(pTraceFormula),
+                translated.build()));
+      }
+      pooledProvers = provers.build();
+      executor =
+          Executors.newFixedThreadPool(
+              pThreads,
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("fault-localization-%d")
+                  .build());
+    } else {
+      solverPool = null;
+      pooledProvers = ImmutableList.of();
+      executor = null;
+    }
+  }
+
+  /**
+   * Add a further hard constraint, which must be a formula over the selectors of this checker.
+   */
+  void addConstraint(BooleanFormula pConstraint) throws InterruptedException {
+    mainProver.prover.addConstraint(pConstraint);
+    for (Prover prover : pooledProvers) {
+      prover.prover.addConstraint(prover.pooledSolver.translateFromMain(pConstraint));
+    }
+  }
+
+  /**
+   * Return an unsatisfiable subset of the given selectors (which may be much smaller than the
+   * given set), or null if the given selectors together with the trace formula are satisfiable.
+   */
+  @Nullable Set<Selector> getUnsatCore(Set<Selector> pSelectors)
+      throws SolverException, InterruptedException {
+    Set<Selector> known = getKnownCore(pSelectors);
+    if (known != null) {
+      return known;
+    }
+    stats.unsatCalls.inc();
+    return recordCore(mainProver.getUnsatCore(pSelectors));
+  }
+
+  /**
+   * Return the index of the first candidate that is unsatisfiable together with the trace formula
+   * and an unsat core for it, or null if all candidates are satisfiable. Candidates are checked in
+   * parallel if this checker has more than one thread, but the result is the same as for a
+   * sequential check in the given order.
+   */
+  @Nullable Map.Entry<Integer, Set<Selector>> findFirstUnsat(List<Set<Selector>> pCandidates)
+      throws SolverException, InterruptedException {
+    int batchSize = Math.max(1, pooledProvers.size());
+    for (int start = 0; start < pCandidates.size(); start += batchSize) {
+      List<Set<Selector>> batch =
+          pCandidates.subList(start, Math.min(start + batchSize, pCandidates.size()));
+
+      // first use the cache, it may answer the whole batch without a solver call
+      for (int i = 0; i < batch.size(); i++) {
+        Set<Selector> known = getKnownCore(batch.get(i));
+        if (known != null) {
+          return Map.entry(start + i, known);
+        }
+      }
+
+      List<@Nullable Set<Selector>> cores;
+      if (executor == null || batch.size() == 1) {
+        cores = new ArrayList<>(batch.size());
+        for (Set<Selector> candidate : batch) {
+          stats.unsatCalls.inc();
+          Set<Selector> core = mainProver.getUnsatCore(candidate);
+          cores.add(core);
+          if (core != null) {
+            break;
+          }
+        }
+      } else {
+        for (int i = 0; i < batch.size(); i++) {
+          stats.unsatCalls.inc();
+        }
+        cores = checkInParallel(batch);
+      }
+
+      for (int i = 0; i < cores.size(); i++) {
+        if (cores.get(i) != null) {
+          return Map.entry(start + i, recordCore(cores.get(i)));
+        }
+      }
+    }
+    return null;
+  }
+
+  private List<@Nullable Set<Selector>> checkInParallel(List<Set<Selector>> pBatch)
+      throws SolverException, InterruptedException {
+    List<Future<Set<Selector>>> futures = new ArrayList<>(pBatch.size());
+    try {
+      for (int i = 0; i < pBatch.size(); i++) {
+        Prover prover = pooledProvers.get(i);
+        Set<Selector> candidate = pBatch.get(i);
+        futures.add(executor.submit(() -> prover.getUnsatCore(candidate)));
+      }
+      List<@Nullable Set<Selector>> cores = new ArrayList<>(pBatch.size());
+      for (Future<Set<Selector>> future : futures) {
+        try {
+          cores.add(future.get());
+        } catch (ExecutionException e) {
+          Throwable t = e.getCause();
+          Throwables.propagateIfPossible(t, SolverException.class, InterruptedException.class);
+          throw new UnexpectedCheckedException("checking selectors for unsatisfiability", t);
+        }
+      }
+      return cores;
+
+    } finally {
+      // the provers may only be reused when no worker uses them anymore
+      for (Future<Set<Selector>> future : futures) {
+        future.cancel(true);
+      }
+      for (Future<Set<Selector>> future : futures) {
+        try {
+          Uninterruptibles.getUninterruptibly(future);
+        } catch (ExecutionException | CancellationException e) {
+          // already handled above or not relevant anymore
+        }
+      }
+    }
+  }
+
+  static List<Selector> toSelectors(Collection<? extends FaultContribution> pContributions) {
+    List<Selector> selectors = new ArrayList<>(pContributions.size());
+    for (FaultContribution fc : pContributions) {
+      selectors.add((Selector) fc);
+    }
+    return selectors;
+  }
+
+  private @Nullable Set<Selector> getKnownCore(Set<Selector> pSelectors) {
+    for (Set<Selector> core : knownCores) {
+      if (pSelectors.containsAll(core)) {
+        stats.savedCalls.inc();
+        return core;
+      }
+    }
+    return null;
+  }
+
+  private @Nullable Set<Selector> recordCore(@Nullable Set<Selector> pCore) {
+    if (pCore != null) {
+      knownCores.add(pCore);
+    }
+    return pCore;
+  }
+
+  @Override
+  public void close() {
+    if (executor != null) {
+      executor.shutdownNow();
+    }
+    mainProver.prover.close();
+    for (Prover prover : pooledProvers) {
+      prover.prover.close();
+      prover.pooledSolver.close();
+    }
+    if (solverPool != null) {
+      solverPool.close();
+    }
+  }
+
+  /** A prover with the trace formula and the selector literals in its own solver context. */
+  private static class Prover {
+
+    private final ProverEnvironment prover;
+    private final @Nullable PooledSolver pooledSolver;
+    private final ImmutableMap<Selector, BooleanFormula> selectorFormulas;
+    private final ImmutableMap<BooleanFormula, Selector> formulaToSelector;
+
+    private Prover(
+        Solver pSolver,
+        @Nullable PooledSolver pPooledSolver,
+        BooleanFormula pTraceFormula,
+        ImmutableMap<Selector, BooleanFormula> pSelectorFormulas)
+        throws InterruptedException {
+      pooledSolver = pPooledSolver;
+      selectorFormulas = pSelectorFormulas;
+      Map<BooleanFormula, Selector> inverse = new HashMap<>();
+      pSelectorFormulas.forEach((selector, formula) -> inverse.putIfAbsent(formula, selector));
+      formulaToSelector = ImmutableMap.copyOf(inverse);
+      prover = pSolver.newProverEnvironment(GENERATE_UNSAT_CORE_OVER_ASSUMPTIONS);
+      prover.push(pTraceFormula);
+    }
+
+    private @Nullable Set<Selector> getUnsatCore(Set<Selector> pSelectors)
+        throws SolverException, InterruptedException {
+      List<BooleanFormula> assumptions = new ArrayList<>(pSelectors.size());
+      for (Selector selector : pSelectors) {
+        assumptions.add(selectorFormulas.get(selector));
+      }
+      Optional<List<BooleanFormula>> core = prover.unsatCoreOverAssumptions(assumptions);
+      if (!core.isPresent()) {
+        return null;
+      }
+      ImmutableSet.Builder<Selector> result = ImmutableSet.builder();
+      for (BooleanFormula literal : core.orElseThrow()) {
+        result.add(formulaToSelector.get(literal));
+      }
+      return result.build();
+    }
+  }
+}
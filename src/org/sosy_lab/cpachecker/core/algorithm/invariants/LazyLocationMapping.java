@@ -25,8 +25,7 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
 public class LazyLocationMapping {
   private final UnmodifiableReachedSet reachedSet;
 
-  private final AtomicReference<Multimap<CFANode, AbstractState>> statesByLocationRef
-      = new AtomicReference<>();
+  private final AtomicReference<LocationIndex> statesByLocationRef = new AtomicReference<>();
 
   public LazyLocationMapping(UnmodifiableReachedSet pReachedSet) {
     this.reachedSet = Objects.requireNonNull(pReachedSet);
@@ -56,20 +55,44 @@ public class LazyLocationMapping {
     return toReturn;
   }
 
+  /**
+   * Get the number of states in the underlying reached set. Callers that cache information that
+   * is derived from the states of this mapping can use this to detect that the reached set has
+   * changed.
+   */
+  public int getNumberOfStates() {
+    return reachedSet.size();
+  }
+
   public Iterable<AbstractState> get0(CFANode pLocation) {
     if (reachedSet instanceof LocationMappedReachedSet) {
       return AbstractStates.filterLocation(reachedSet, pLocation);
     }
-    if (statesByLocationRef.get() == null) {
+    LocationIndex index = statesByLocationRef.get();
+    int numberOfStates = reachedSet.size();
+    if (index == null || index.numberOfStates != numberOfStates) {
+      // the reached set may still grow if it belongs to an analysis that is still running
       Multimap<CFANode, AbstractState> statesByLocation = HashMultimap.create();
       for (AbstractState state : reachedSet) {
         for (CFANode location : AbstractStates.extractLocations(state)) {
           statesByLocation.put(location, state);
         }
       }
-      this.statesByLocationRef.set(statesByLocation);
-      return statesByLocation.get(pLocation);
+      index = new LocationIndex(numberOfStates, statesByLocation);
+      statesByLocationRef.set(index);
+    }
+    return index.statesByLocation.get(pLocation);
+  }
+
+  private static final class LocationIndex {
+
+    private final int numberOfStates;
+
+    private final Multimap<CFANode, AbstractState> statesByLocation;
+
+    private LocationIndex(int pNumberOfStates, Multimap<CFANode, AbstractState> pStatesByLocation) {
+      numberOfStates = pNumberOfStates;
+      statesByLocation = pStatesByLocation;
     }
-    return statesByLocationRef.get().get(pLocation);
   }
-}
\ No newline at end of file
+}
@@ -15,6 +15,9 @@ import java.util.List;
 import java.util.Objects;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.atomic.AtomicReference;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
@@ -31,6 +34,14 @@ public class ReachedSetBasedExpressionTreeSupplier implements ExpressionTreeSupp
   private final LazyLocationMapping lazyLocationMapping;
   private final CFA cfa;
 
+  /**
+   * The invariants that were already built, per location. Building them requires iterating over
+   * all states at the location, and they are usually requested many times, e.g., in every step
+   * case of k-induction. The cache is discarded if the number of states in the reached set changes.
+   */
+  private final AtomicReference<InvariantCache> invariantCache =
+      new AtomicReference<>(new InvariantCache(-1));
+
   public ReachedSetBasedExpressionTreeSupplier(LazyLocationMapping pLazyLocationMapping, CFA pCFA) {
     lazyLocationMapping = Objects.requireNonNull(pLazyLocationMapping);
     cfa = Objects.requireNonNull(pCFA);
@@ -38,6 +49,16 @@ public class ReachedSetBasedExpressionTreeSupplier implements ExpressionTreeSupp
 
   @Override
   public ExpressionTree<Object> getInvariantFor(CFANode pLocation) {
+    InvariantCache cache = invariantCache.get();
+    int numberOfStates = lazyLocationMapping.getNumberOfStates();
+    if (cache.numberOfStates != numberOfStates) {
+      cache = new InvariantCache(numberOfStates);
+      invariantCache.set(cache);
+    }
+    return cache.invariants.computeIfAbsent(pLocation, this::buildInvariantFor);
+  }
+
+  private ExpressionTree<Object> buildInvariantFor(CFANode pLocation) {
 
     Set<InvariantsState> invStates = new HashSet<>();
     boolean otherReportingStates = false;
@@ -112,4 +133,16 @@ public class ReachedSetBasedExpressionTreeSupplier implements ExpressionTreeSupp
 
     return locationInvariant;
   }
+
+  private static final class InvariantCache {
+
+    private final int numberOfStates;
+
+    private final ConcurrentMap<CFANode, ExpressionTree<Object>> invariants =
+        new ConcurrentHashMap<>();
+
+    private InvariantCache(int pNumberOfStates) {
+      numberOfStates = pNumberOfStates;
+    }
+  }
 }
@@ -0,0 +1,147 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.invariants;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import com.google.common.collect.FluentIterable;
+import com.google.common.collect.ImmutableSet;
+import java.util.List;
+import java.util.Optional;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.concurrent.atomic.AtomicLong;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.algorithm.bmc.candidateinvariants.CandidateInvariant;
+import org.sosy_lab.cpachecker.cpa.callstack.CallstackStateEqualsWrapper;
+import org.sosy_lab.cpachecker.exceptions.CPATransferException;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormula;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManager;
+import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+
+/**
+ * Thread-safe store of invariants that were proven by one analysis and can be used by other
+ * analyses, e.g., by the analyses that run in parallel within a {@link
+ * org.sosy_lab.cpachecker.core.algorithm.ParallelAlgorithm}. The store is shared via {@link
+ * org.sosy_lab.cpachecker.core.reachedset.AggregatedReachedSets#getSharedInvariants()}.
+ *
+ * <p>Producers publish an invariant for each location at which it was proven, as soon as it is
+ * proven. Consumers either query the invariants of a location when they need them (using {@link
+ * #getVersion()} to detect cheaply whether anything was published in the meantime), or subscribe
+ * to be notified about each new invariant. Invariants are stored as {@link CandidateInvariant}s,
+ * which create their formula for any given formula manager, so analyses using different solvers
+ * can exchange them.
+ */
+public final class SharedInvariantStore implements InvariantSupplier {
+
+  /** Listener that is notified about each newly published invariant. */
+  @FunctionalInterface
+  public interface InvariantListener {
+
+    /**
+     * Called in the thread of the producer directly after an invariant was published, so this
+     * should be cheap and must not block.
+     */
+    void invariantPublished(CFANode pLocation, CandidateInvariant pInvariant);
+  }
+
+  private final ConcurrentMap<CFANode, Set<CandidateInvariant>> invariants =
+      new ConcurrentHashMap<>();
+
+  private final List<InvariantListener> listeners = new CopyOnWriteArrayList<>();
+
+  private final AtomicLong version = new AtomicLong();
+
+  /**
+   * Publish an invariant that was proven to hold at the given location.
+   *
+   * @return whether the invariant was not known for this location before.
+   */
+  public boolean publish(CFANode pLocation, CandidateInvariant pInvariant) {
+    checkNotNull(pLocation);
+    checkNotNull(pInvariant);
+    if (!invariants
+        .computeIfAbsent(pLocation, l -> ConcurrentHashMap.newKeySet())
+        .add(pInvariant)) {
+      return false;
+    }
+    version.incrementAndGet();
+    for (InvariantListener listener : listeners) {
+      listener.invariantPublished(pLocation, pInvariant);
+    }
+    return true;
+  }
+
+  /** Get the invariants that were published for the given location so far. */
+  public ImmutableSet<CandidateInvariant> getInvariants(CFANode pLocation) {
+    Set<CandidateInvariant> result = invariants.get(pLocation);
+    return result == null ? ImmutableSet.of() : ImmutableSet.copyOf(result);
+  }
+
+  /**
+   * Get the invariants that were proven at each of the given locations to which they apply, and
+   * can therefore be assumed at all of these locations.
+   */
+  public ImmutableSet<CandidateInvariant> getInvariantsForAll(Set<CFANode> pLocations) {
+    return FluentIterable.from(pLocations)
+        .transformAndConcat(this::getInvariants)
+        .filter(
+            inv ->
+                FluentIterable.from(pLocations)
+                    .filter(inv::appliesTo)
+                    .allMatch(l -> isPublished(l, inv)))
+        .toSet();
+  }
+
+  private boolean isPublished(CFANode pLocation, CandidateInvariant pInvariant) {
+    Set<CandidateInvariant> published = invariants.get(pLocation);
+    return published != null && published.contains(pInvariant);
+  }
+
+  /**
+   * Get the number of invariants published so far, which can be used to check whether new
+   * invariants are available.
+   */
+  public long getVersion() {
+    return version.get();
+  }
+
+  public void subscribe(InvariantListener pListener) {
+    listeners.add(checkNotNull(pListener));
+  }
+
+  public void unsubscribe(InvariantListener pListener) {
+    listeners.remove(pListener);
+  }
+
+  @Override
+  public BooleanFormula getInvariantFor(
+      CFANode pNode,
+      Optional<CallstackStateEqualsWrapper> pCallstackInformation,
+      FormulaManagerView pFmgr,
+      PathFormulaManager pPfmgr,
+      @Nullable PathFormula pContext)
+      throws InterruptedException {
+    BooleanFormulaManagerView bfmgr = pFmgr.getBooleanFormulaManager();
+    BooleanFormula result = bfmgr.makeTrue();
+    for (CandidateInvariant invariant : getInvariants(pNode)) {
+      try {
+        result = bfmgr.and(result, invariant.getFormula(pFmgr, pPfmgr, pContext));
+      } catch (CPATransferException e) {
+        // the invariant cannot be expressed here, leaving it out is sound
+      }
+    }
+    return result;
+  }
+}
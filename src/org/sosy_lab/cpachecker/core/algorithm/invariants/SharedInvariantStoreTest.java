@@ -0,0 +1,68 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.invariants;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableSet;
+import java.util.ArrayList;
+import java.util.List;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.algorithm.bmc.candidateinvariants.CandidateInvariant;
+import org.sosy_lab.cpachecker.core.algorithm.bmc.candidateinvariants.SingleLocationFormulaInvariant;
+
+public class SharedInvariantStoreTest {
+
+  private final CFANode loopHead1 = CFANode.newDummyCFANode("loop1");
+  private final CFANode loopHead2 = CFANode.newDummyCFANode("loop2");
+
+  @Test
+  public void testPublish() {
+    SharedInvariantStore store = new SharedInvariantStore();
+    CandidateInvariant invariant =
+        SingleLocationFormulaInvariant.makeBooleanInvariant(loopHead1, true);
+
+    assertThat(store.getInvariants(loopHead1)).isEmpty();
+    assertThat(store.publish(loopHead1, invariant)).isTrue();
+    assertThat(store.publish(loopHead1, invariant)).isFalse();
+    assertThat(store.getVersion()).isEqualTo(1);
+    assertThat(store.getInvariants(loopHead1)).containsExactly(invariant);
+    assertThat(store.getInvariants(loopHead2)).isEmpty();
+  }
+
+  @Test
+  public void testSubscribe() {
+    SharedInvariantStore store = new SharedInvariantStore();
+    List<CandidateInvariant> notified = new ArrayList<>();
+    SharedInvariantStore.InvariantListener listener = (loc, inv) -> notified.add(inv);
+    store.subscribe(listener);
+
+    CandidateInvariant invariant1 =
+        SingleLocationFormulaInvariant.makeBooleanInvariant(loopHead1, true);
+    CandidateInvariant invariant2 =
+        SingleLocationFormulaInvariant.makeBooleanInvariant(loopHead2, true);
+    store.publish(loopHead1, invariant1);
+    store.publish(loopHead1, invariant1);
+    store.unsubscribe(listener);
+    store.publish(loopHead2, invariant2);
+
+    assertThat(notified).containsExactly(invariant1);
+  }
+
+  @Test
+  public void testInvariantsForAll() {
+    SharedInvariantStore store = new SharedInvariantStore();
+    // applies to loopHead1 only, so it can be assumed at both loop heads
+    CandidateInvariant local = SingleLocationFormulaInvariant.makeBooleanInvariant(loopHead1, true);
+    store.publish(loopHead1, local);
+    assertThat(store.getInvariantsForAll(ImmutableSet.of(loopHead1, loopHead2)))
+        .containsExactly(local);
+  }
+}
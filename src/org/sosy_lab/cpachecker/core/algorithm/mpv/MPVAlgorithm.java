@@ -223,6 +223,7 @@ public class MPVAlgorithm implements Algorithm, StatisticsProvider {
   private final ConfigurableProgramAnalysis cpa;
   private final LogManager logger;
   private final Configuration config;
+  private final Configuration innerConfig;
   private final ShutdownNotifier shutdownNotifier;
   private final Specification specification;
   private final CFA cfa;
@@ -244,6 +245,11 @@ public class MPVAlgorithm implements Algorithm, StatisticsProvider {
     specification = pSpecification;
     cfa = pCfa;
     config.inject(this);
+    // The inner configuration does not depend on the partition, so build it only once
+    ConfigurationBuilder innerConfigBuilder = Configuration.builder();
+    innerConfigBuilder.copyFrom(config);
+    innerConfigBuilder.clearOption("analysis.algorithm.MPV"); // to prevent infinite recursion
+    innerConfig = innerConfigBuilder.build();
     multipleProperties =
         new MultipleProperties(
             specification.getPathToSpecificationAutomata(), propertySeparator, findAllViolations);
@@ -467,13 +473,9 @@ public class MPVAlgorithm implements Algorithm, StatisticsProvider {
       }
       stats.iterationNumber++;
 
-      ConfigurationBuilder innerConfigBuilder = Configuration.builder();
-      innerConfigBuilder.copyFrom(config);
-      innerConfigBuilder.clearOption("analysis.algorithm.MPV"); // to prevent infinite recursion
-      Configuration singleConfig = innerConfigBuilder.build();
       CoreComponentsFactory coreComponents =
           new CoreComponentsFactory(
-              singleConfig, logger, shutdownManager.getNotifier(), new AggregatedReachedSets());
+              innerConfig, logger, shutdownManager.getNotifier(), new AggregatedReachedSets());
 
       return coreComponents.createAlgorithm(cpa, cfa, specification);
     } catch (InvalidConfigurationException e) {
@@ -0,0 +1,204 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.parallel_bam;
+
+import com.google.common.collect.ImmutableList;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.AbstractExecutorService;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.Executor;
+import java.util.concurrent.LinkedBlockingDeque;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
+
+/**
+ * A thread pool that prefers to execute the jobs of a block on the thread that executed the last
+ * job of the same block, such that the data of the block (reached-set, caches of the analysis) is
+ * likely to be still in the cache of the processor core.
+ *
+ * <p>Each thread has its own queue of jobs. A job for a block is appended to the queue of the
+ * thread that last executed a job of this block, jobs for new blocks are distributed round-robin.
+ * An idle thread whose queue is empty steals jobs from the end of the other queues.
+ */
+final class BlockAffinityExecutor extends AbstractExecutorService {
+
+  /** Time an idle thread waits for new jobs in its own queue before trying to steal again. */
+  private static final long STEAL_INTERVAL_MILLIS = 1;
+
+  private final ImmutableList<Worker> workers;
+  private final ConcurrentMap<Block, Worker> lastWorkerOfBlock = new ConcurrentHashMap<>();
+  private final AtomicInteger nextWorker = new AtomicInteger();
+  private volatile boolean isShutdown = false;
+
+  BlockAffinityExecutor(int pNumberOfThreads, ThreadFactory pThreadFactory) {
+    ImmutableList.Builder<Worker> builder = ImmutableList.builder();
+    for (int i = 0; i < pNumberOfThreads; i++) {
+      builder.add(new Worker(pThreadFactory));
+    }
+    workers = builder.build();
+    for (Worker worker : workers) {
+      worker.thread.start();
+    }
+  }
+
+  /** Return an executor that schedules all jobs for the given block with affinity. */
+  Executor forBlock(Block pBlock) {
+    return job -> {
+      Worker worker = lastWorkerOfBlock.get(pBlock);
+      enqueue(worker == null ? nextWorker() : worker, new BlockJob(pBlock, job));
+    };
+  }
+
+  @Override
+  public void execute(Runnable pJob) {
+    enqueue(nextWorker(), pJob);
+  }
+
+  private Worker nextWorker() {
+    return workers.get(Math.floorMod(nextWorker.getAndIncrement(), workers.size()));
+  }
+
+  private void enqueue(Worker pWorker, Runnable pJob) {
+    if (isShutdown) {
+      throw new RejectedExecutionException("thread pool is shut down");
+    }
+    pWorker.jobs.addLast(pJob);
+  }
+
+  private boolean hasNoJobs() {
+    for (Worker worker : workers) {
+      if (!worker.jobs.isEmpty()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  @Override
+  public void shutdown() {
+    isShutdown = true;
+  }
+
+  @Override
+  public List<Runnable> shutdownNow() {
+    isShutdown = true;
+    List<Runnable> remainingJobs = new ArrayList<>();
+    for (Worker worker : workers) {
+      worker.jobs.drainTo(remainingJobs);
+      worker.thread.interrupt();
+    }
+    return remainingJobs;
+  }
+
+  @Override
+  public boolean isShutdown() {
+    return isShutdown;
+  }
+
+  @Override
+  public boolean isTerminated() {
+    for (Worker worker : workers) {
+      if (worker.thread.isAlive()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  @Override
+  public boolean awaitTermination(long pTimeout, TimeUnit pUnit) throws InterruptedException {
+    final long deadline = System.nanoTime() + pUnit.toNanos(pTimeout);
+    for (Worker worker : workers) {
+      long remaining = deadline - System.nanoTime();
+      if (remaining <= 0) {
+        return isTerminated();
+      }
+      TimeUnit.NANOSECONDS.timedJoin(worker.thread, remaining);
+    }
+    return isTerminated();
+  }
+
+  private static final class BlockJob implements Runnable {
+
+    private final Block block;
+    private final Runnable job;
+
+    private BlockJob(Block pBlock, Runnable pJob) {
+      block = pBlock;
+      job = pJob;
+    }
+
+    @Override
+    public void run() {
+      job.run();
+    }
+  }
+
+  private final class Worker implements Runnable {
+
+    private final LinkedBlockingDeque<Runnable> jobs = new LinkedBlockingDeque<>();
+    private final Thread thread;
+
+    private Worker(ThreadFactory pThreadFactory) {
+      thread = pThreadFactory.newThread(this);
+    }
+
+    @Override
+    public void run() {
+      while (true) {
+        Runnable job = jobs.pollFirst();
+        if (job == null) {
+          job = steal();
+        }
+        if (job == null) {
+          if (isShutdown && hasNoJobs()) {
+            return;
+          }
+          try {
+            job = jobs.pollFirst(STEAL_INTERVAL_MILLIS, TimeUnit.MILLISECONDS);
+          } catch (InterruptedException e) {
+            if (isShutdown) {
+              return;
+            }
+          }
+          if (job == null) {
+            continue;
+          }
+        }
+        if (job instanceof BlockJob) {
+          lastWorkerOfBlock.put(((BlockJob) job).block, this);
+        }
+        try {
+          job.run();
+        } catch (RuntimeException | Error e) {
+          // keep the thread alive, as a ThreadPoolExecutor would replace it
+          thread.getUncaughtExceptionHandler().uncaughtException(thread, e);
+        }
+      }
+    }
+
+    /** Take a job from the end of the queue of another thread. */
+    private Runnable steal() {
+      for (Worker other : workers) {
+        if (other != this) {
+          Runnable job = other.jobs.pollLast();
+          if (job != null) {
+            return job;
+          }
+        }
+      }
+      return null;
+    }
+  }
+}
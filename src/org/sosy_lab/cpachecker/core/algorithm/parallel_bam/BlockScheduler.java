@@ -0,0 +1,159 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.algorithm.parallel_bam;
+
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.Executor;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.PriorityBlockingQueue;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.LongAdder;
+import java.util.function.IntSupplier;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
+
+/**
+ * Scheduler for the jobs of {@link ReachedSetExecutor}s.
+ *
+ * <p>In FIFO mode, the jobs are executed in the order of their submission. In prioritizing mode,
+ * pending jobs are ordered by their expected contribution to the critical path of the analysis:
+ * the predicted cost of the analysis of the block, multiplied with the number of reached-sets that
+ * (transitively) wait for the block. The cost of a block is predicted from the times measured for
+ * earlier analyses of the same block, or from the size of the block if it was not yet analyzed.
+ * In affinity mode, the jobs of a block are preferably executed on the thread that executed the
+ * last job of the block, see {@link BlockAffinityExecutor}.
+ */
+class BlockScheduler {
+
+  private final ExecutorService pool;
+  private final boolean prioritize;
+  private final @Nullable BlockAffinityExecutor affinityPool;
+
+  /** used for FIFO order of jobs with equal priority. */
+  private final AtomicLong sequence = new AtomicLong();
+
+  private final ConcurrentMap<Block, BlockHistory> history = new ConcurrentHashMap<>();
+  private final LongAdder totalNanos = new LongAdder();
+  private final LongAdder totalNodes = new LongAdder();
+
+  private static class BlockHistory {
+    private final LongAdder nanos = new LongAdder();
+    private final LongAdder count = new LongAdder();
+  }
+
+  /**
+   * Create a scheduler with the given number of threads. Prioritizing and affinity mode can not
+   * be combined, affinity mode takes precedence.
+   */
+  BlockScheduler(
+      int pNumberOfThreads,
+      ThreadFactory pThreadFactory,
+      boolean pPrioritize,
+      boolean pAffinity) {
+    prioritize = pPrioritize && !pAffinity;
+    if (pAffinity) {
+      affinityPool = new BlockAffinityExecutor(pNumberOfThreads, pThreadFactory);
+      pool = affinityPool;
+      return;
+    }
+    affinityPool = null;
+    pool =
+        new ThreadPoolExecutor(
+            pNumberOfThreads,
+            pNumberOfThreads,
+            0L,
+            TimeUnit.MILLISECONDS,
+            // only PrioritizedJobs are submitted in prioritizing mode, which are comparable
+            prioritize
+                ? new PriorityBlockingQueue<Runnable>()
+                : new LinkedBlockingQueue<Runnable>(),
+            pThreadFactory);
+  }
+
+  /** The thread pool that executes all jobs, e.g. for shutting it down. */
+  ExecutorService getPool() {
+    return pool;
+  }
+
+  /**
+   * Return an executor for the jobs of the given RSE.
+   *
+   * @param pBlock the block analyzed by the jobs
+   * @param pWaitingCounter computes the number of RSEs that wait for the jobs, evaluated when a
+   *     job is submitted
+   */
+  Executor executorFor(Block pBlock, IntSupplier pWaitingCounter) {
+    if (affinityPool != null) {
+      return affinityPool.forBlock(pBlock);
+    }
+    if (!prioritize) {
+      return pool;
+    }
+    return job ->
+        pool.execute(
+            new PrioritizedJob(
+                job,
+                predictCost(pBlock) * (1 + pWaitingCounter.getAsInt()),
+                sequence.getAndIncrement()));
+  }
+
+  /** Register the time of a (partial) analysis of the given block. */
+  void recordTime(Block pBlock, long pNanos) {
+    BlockHistory blockHistory = history.computeIfAbsent(pBlock, b -> new BlockHistory());
+    blockHistory.nanos.add(pNanos);
+    blockHistory.count.increment();
+    totalNanos.add(pNanos);
+    totalNodes.add(pBlock.getNodes().size());
+  }
+
+  /** Predict the time (in nanoseconds) for the next analysis of the given block. */
+  private double predictCost(Block pBlock) {
+    BlockHistory blockHistory = history.get(pBlock);
+    if (blockHistory != null) {
+      long count = blockHistory.count.sum();
+      if (count > 0) {
+        return (double) blockHistory.nanos.sum() / count;
+      }
+    }
+    // unknown block, estimate from its size and the average time per CFA node
+    long nodes = totalNodes.sum();
+    double nanosPerNode = nodes > 0 ? (double) totalNanos.sum() / nodes : 1.0;
+    return Math.max(1, pBlock.getNodes().size()) * nanosPerNode;
+  }
+
+  private static final class PrioritizedJob implements Runnable, Comparable<PrioritizedJob> {
+
+    private final Runnable job;
+    private final double priority;
+    private final long sequenceNumber;
+
+    private PrioritizedJob(Runnable pJob, double pPriority, long pSequenceNumber) {
+      job = pJob;
+      priority = pPriority;
+      sequenceNumber = pSequenceNumber;
+    }
+
+    @Override
+    public void run() {
+      job.run();
+    }
+
+    @Override
+    public int compareTo(PrioritizedJob pOther) {
+      // higher priority first, then FIFO
+      int result = Double.compare(pOther.priority, priority);
+      return result != 0 ? result : Long.compare(sequenceNumber, pOther.sequenceNumber);
+    }
+  }
+}
@@ -28,7 +28,6 @@ import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.ConcurrentMap;
 import java.util.concurrent.ExecutionException;
 import java.util.concurrent.ExecutorService;
-import java.util.concurrent.Executors;
 import java.util.concurrent.RejectedExecutionException;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.TimeUnit;
@@ -59,6 +58,7 @@ import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGReachedSet;
 import org.sosy_lab.cpachecker.cpa.bam.BAMCPAWithBreakOnMissingBlock;
 import org.sosy_lab.cpachecker.cpa.bam.BAMReachedSetValidator;
+import org.sosy_lab.cpachecker.cpa.bam.cache.BAMDataManagerSynchronized;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.exceptions.CompoundException;
 import org.sosy_lab.cpachecker.util.statistics.StatCounter;
@@ -85,6 +85,30 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private Path runningRSESeriesFile = Paths.get("RSESeries.csv");
 
+  @Option(
+      description =
+          "Order pending block analyses by their predicted cost and by the number of other"
+              + " blocks that wait for them, instead of the order of their creation. The cost of a"
+              + " block is predicted from earlier analyses of the block or from its size.",
+      secure = true)
+  private boolean prioritizeBlocks = false;
+
+  @Option(
+      description =
+          "Execute the analyses of a block preferably on the thread that analyzed the block"
+              + " before, with idle threads stealing pending analyses from busy threads. This"
+              + " improves the cache locality of the data of a block. Cannot be combined with"
+              + " prioritizeBlocks, which is ignored if this option is enabled.",
+      secure = true)
+  private boolean blockAffinity = false;
+
+  @Option(
+      description =
+          "export number of threads waiting for the lock of the BAM data manager as CSV",
+      secure = true)
+  @FileOption(FileOption.Type.OUTPUT_FILE)
+  private Path waitingThreadsSeriesFile = Paths.get("RSEWaitingSeries.csv");
+
   private final ParallelBAMStatistics stats = new ParallelBAMStatistics();
   private final LogManager logger;
   private final LogManagerWithoutDuplicates oneTimeLogger;
@@ -130,7 +154,9 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
             .setDaemon(true) // for killing hanging threads at program exit
             .setNameFormat("ParallelBAM-thread-%d")
             .build();
-    final ExecutorService pool = Executors.newFixedThreadPool(numberOfCores, threadFactory);
+    final BlockScheduler scheduler =
+        new BlockScheduler(numberOfCores, threadFactory, prioritizeBlocks, blockAffinity);
+    final ExecutorService pool = scheduler.getPool();
     final List<Throwable> errors = Collections.synchronizedList(new ArrayList<>());
     final AtomicBoolean terminateAnalysis = new AtomicBoolean(false);
     final AtomicInteger scheduledJobs = new AtomicInteger(0);
@@ -148,7 +174,7 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
             bamcpa.getBlockPartitioning().getMainBlock(),
             true,
             reachedSetMapping,
-            pool,
+            scheduler,
             algorithmFactory,
             shutdownNotifier,
             stats,
@@ -324,8 +350,11 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
         new ThreadSafeTimerContainer("Time for adding states to RSE");
     final ThreadSafeTimerContainer terminationCheckTime =
         new ThreadSafeTimerContainer("Time for terminating RSE");
+    final ThreadSafeTimerContainer dataLockTime =
+        new ThreadSafeTimerContainer("Time for waiting for BAM data manager");
     final LongAccumulator numMaxRSE = new LongAccumulator(Math::max, 0);
     final AtomicInteger numActiveThreads = new AtomicInteger(0);
+    final AtomicInteger numWaitingThreads = new AtomicInteger(0);
     final StatHist histActiveThreads = new StatHist("Active threads");
     final StatHist executionCounter = new StatHist("RSE execution counter");
     private final StatCounter unfinishedRSEcounter = new StatCounter("unfinished reached-sets");
@@ -335,6 +364,11 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
             ? new NoopStatisticsSeries<>()
             : new StatisticsSeriesWithNumbers();
 
+    final StatisticsSeries<Integer> waitingThreadsSeries =
+        (waitingThreadsSeriesFile == null)
+            ? new NoopStatisticsSeries<>()
+            : new StatisticsSeriesWithNumbers();
+
     @Override
     public void printStatistics(PrintStream pOut, Result pResult, UnmodifiableReachedSet pReached) {
       StatisticsUtils.write(pOut, 0, 50, "max number of executors", numMaxRSE);
@@ -345,6 +379,19 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
       StatisticsUtils.write(pOut, 0, 50, threadTime);
       StatisticsUtils.write(pOut, 1, 50, addingStatesTime);
       StatisticsUtils.write(pOut, 1, 50, terminationCheckTime);
+      StatisticsUtils.write(pOut, 1, 50, dataLockTime);
+      if (bamcpa.getData() instanceof BAMDataManagerSynchronized) {
+        BAMDataManagerSynchronized data = (BAMDataManagerSynchronized) bamcpa.getData();
+        StatisticsUtils.write(
+            pOut,
+            1,
+            50,
+            "Number of accesses to BAM data manager",
+            String.format(
+                "%d (contended: %d)",
+                data.getNumberOfLockAcquisitions(),
+                data.getNumberOfContendedLockAcquisitions()));
+      }
       if (runningRSESeriesFile != null) {
         final StatisticsSeriesWithNumbers sswn = (StatisticsSeriesWithNumbers) runningRSESeries;
         StatisticsUtils.write(
@@ -352,6 +399,11 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
         StatisticsUtils.write(
             pOut, 1, 50, "Avg. number of parallel RSEs over time", sswn.getStatsOverTime());
       }
+      if (waitingThreadsSeriesFile != null) {
+        final StatisticsSeriesWithNumbers sswn = (StatisticsSeriesWithNumbers) waitingThreadsSeries;
+        StatisticsUtils.write(
+            pOut, 1, 50, "Avg. number of waiting threads w/o time", sswn.getStatsWithoutTime());
+      }
     }
 
     @Override
@@ -363,6 +415,14 @@ public class ParallelBAMAlgorithm implements Algorithm, StatisticsProvider {
           logger.logUserException(Level.WARNING, e, "Could not write data-series for RSEs to file");
         }
       }
+      if (waitingThreadsSeriesFile != null) {
+        try {
+          IO.writeFile(waitingThreadsSeriesFile, Charset.defaultCharset(), waitingThreadsSeries);
+        } catch (IOException e) {
+          logger.logUserException(
+              Level.WARNING, e, "Could not write data-series for waiting threads to file");
+        }
+      }
     }
 
     @Override
@@ -16,19 +16,18 @@ import com.google.common.collect.Collections2;
 import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
-import com.google.common.collect.LinkedHashMultimap;
 import com.google.common.collect.Lists;
-import com.google.common.collect.Multimap;
 import com.google.common.graph.Traverser;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.LinkedHashSet;
 import java.util.List;
-import java.util.Map.Entry;
 import java.util.Set;
 import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.Executor;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicInteger;
@@ -37,6 +36,7 @@ import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.cpachecker.cfa.blocks.Block;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.algorithm.Algorithm;
@@ -86,6 +86,10 @@ class ReachedSetExecutor {
   private final ConcurrentMap<ReachedSet, ReachedSetExecutor> reachedSetMapping;
 
   private final ExecutorService pool;
+  private final BlockScheduler scheduler;
+
+  /** executor for the jobs of this RSE, prioritized by the scheduler. */
+  private final Executor executor;
 
   private final BAMCPAWithBreakOnMissingBlock bamcpa;
   private final AlgorithmFactory algorithmFactory;
@@ -106,6 +110,7 @@ class ReachedSetExecutor {
   private final TimerWrapper threadTimer;
   private final TimerWrapper addingStatesTimer;
   private final TimerWrapper terminationCheckTimer;
+  private final TimerWrapper dataLockTimer;
 
   /**
    * This set contains all sub-reached-sets that have to be finished before the current one. The
@@ -120,12 +125,17 @@ class ReachedSetExecutor {
 
   /**
    * This mapping contains all {@link ReachedSetExecutor}s (known as parents) that wait for the
-   * current one. The abstract state is the non-reduced initial state of the parent reached-set, and
-   * it must be re-added when the child terminates. The current reached-set has to be finished
-   * before parent reached-set. The state is unique, RSE is not. Synchronized access needed!
+   * current one. The abstract states are the non-reduced initial states of the parent reached-set,
+   * and they must be re-added when the child terminates. The current reached-set has to be
+   * finished before parent reached-set. The state is unique, RSE is not.
+   *
+   * <p>Lock-free access: the sets of states are immutable and only replaced atomically, parents
+   * add dependencies concurrently, and the child removes each parent atomically when notifying it.
+   * A dependency that is added after the child removed its parents is handled at the next
+   * termination of the child, because the child is always scheduled again after a new dependency.
    */
-  private final Multimap<ReachedSetExecutor, AbstractState> dependingFrom =
-      LinkedHashMultimap.create();
+  private final ConcurrentMap<ReachedSetExecutor, ImmutableSet<AbstractState>> dependingFrom =
+      new ConcurrentHashMap<>();
 
   /** This future contains the list of tasks to be executed with this RSE. */
   private CompletableFuture<Void> waitingTask;
@@ -136,7 +146,7 @@ class ReachedSetExecutor {
       Block pBlock,
       boolean pIsMainReachedSet,
       ConcurrentMap<ReachedSet, ReachedSetExecutor> pReachedSetMapping,
-      ExecutorService pPool,
+      BlockScheduler pScheduler,
       AlgorithmFactory pAlgorithmFactory,
       ShutdownNotifier pShutdownNotifier,
       ParallelBAMStatistics pStats,
@@ -149,7 +159,8 @@ class ReachedSetExecutor {
     block = pBlock;
     isMainReachedSet = pIsMainReachedSet;
     reachedSetMapping = pReachedSetMapping;
-    pool = pPool;
+    scheduler = pScheduler;
+    pool = pScheduler.getPool();
     algorithmFactory = pAlgorithmFactory;
     shutdownNotifier = pShutdownNotifier;
     stats = pStats;
@@ -167,9 +178,12 @@ class ReachedSetExecutor {
     threadTimer = stats.threadTime.getNewTimer();
     addingStatesTimer = stats.addingStatesTime.getNewTimer();
     terminationCheckTimer = stats.terminationCheckTime.getNewTimer();
+    dataLockTimer = stats.dataLockTime.getNewTimer();
+
+    executor = scheduler.executorFor(block, this::getNumberOfWaitingExecutors);
 
     // initialization with a NOOP, more tasks are appended later
-    waitingTask = CompletableFuture.runAsync(() -> {}, pool);
+    waitingTask = CompletableFuture.runAsync(() -> {}, executor);
   }
 
   public Runnable asRunnable() {
@@ -188,7 +202,7 @@ class ReachedSetExecutor {
 
   synchronized void addNewTask(Runnable r) {
     scheduledJobs.incrementAndGet();
-    waitingTask = waitingTask.thenRunAsync(r, pool).exceptionally(new ExceptionHandler(this));
+    waitingTask = waitingTask.thenRunAsync(r, executor).exceptionally(new ExceptionHandler(this));
   }
 
   /** use only for debugging and exception handling */
@@ -198,6 +212,7 @@ class ReachedSetExecutor {
 
   private void apply0(Collection<AbstractState> pStatesToBeAdded) {
     threadTimer.start();
+    final long startTime = System.nanoTime();
     int running = stats.numActiveThreads.incrementAndGet();
     stats.histActiveThreads.insertValue(running);
     stats.numMaxRSE.accumulate(reachedSetMapping.size());
@@ -219,6 +234,9 @@ class ReachedSetExecutor {
     } finally {
       stats.numActiveThreads.decrementAndGet();
       threadTimer.stop();
+      long time = System.nanoTime() - startTime;
+      scheduler.recordTime(block, time);
+      bamcpa.addTimeForBlock(block, TimeSpan.ofNanos(time));
     }
   }
 
@@ -394,19 +412,13 @@ class ReachedSetExecutor {
   }
 
   private void reAddStatesToDependingReachedSets() {
-    // first lock is only against deadlock of locks for 'reachedSetMapping' and 'dependingFrom'.
-    // TODO optimize lock/unlock behavior if performance is too bad
-    synchronized (dependingFrom) {
-      logger.logf(
-          level,
-          "%s :: -> %s",
-          this,
-          Iterables.transform(dependingFrom.entries(), e -> e.getKey() + "#" + id(e.getValue())));
-      for (Entry<ReachedSetExecutor, Collection<AbstractState>> parent :
-          dependingFrom.asMap().entrySet()) {
-        registerJob(parent.getKey(), parent.getKey().asRunnable(parent.getValue()));
+    for (ReachedSetExecutor parent : dependingFrom.keySet()) {
+      // atomic removal, a concurrently added dependency is either removed here or remains
+      ImmutableSet<AbstractState> states = dependingFrom.remove(parent);
+      if (states != null) {
+        logger.logf(level, "%s :: -> %s#%s", this, parent, id(states));
+        registerJob(parent, parent.asRunnable(states));
       }
-      dependingFrom.clear();
     }
   }
 
@@ -414,9 +426,11 @@ class ReachedSetExecutor {
       MissingBlockAbstractionState pBsme, final ReachedSetExecutor subRse) {
     logger.logf(level, "%s :: %s -> %s", this, this, subRse);
     dependsOn.add(pBsme.getState());
-    synchronized (subRse.dependingFrom) {
-      subRse.dependingFrom.put(this, pBsme.getState());
-    }
+    subRse.dependingFrom.merge(
+        this,
+        ImmutableSet.of(pBsme.getState()),
+        (oldStates, newStates) ->
+            ImmutableSet.<AbstractState>builder().addAll(oldStates).addAll(newStates).build());
   }
 
   /**
@@ -472,11 +486,20 @@ class ReachedSetExecutor {
     registerJob(this, this.asRunnable());
   }
 
+  /** Return the number of RSEs that (transitively) wait for the current one. */
+  private int getNumberOfWaitingExecutors() {
+    return Iterables.size(
+            Traverser.<ReachedSetExecutor>forGraph(rse -> rse.dependingFrom.keySet())
+                .breadthFirst(this))
+        - 1;
+  }
+
   /** We need to traverse the RSEs whether there is a cyclic dependency. */
   private boolean hasRecursion(CFANode pEntryLocation) {
     // TODO do we need a lock? we need to avoid crossover RSE-creation during traversal.
     return Iterables.any(
-        Traverser.<ReachedSetExecutor>forGraph(rse -> rse.dependingFrom.keys()).breadthFirst(this),
+        Traverser.<ReachedSetExecutor>forGraph(rse -> rse.dependingFrom.keySet())
+            .breadthFirst(this),
         rse -> rse.block.getCallNodes().contains(pEntryLocation));
   }
 
@@ -491,7 +514,14 @@ class ReachedSetExecutor {
     ReachedSet newRs = pBsme.getReachedSet();
     BAMDataManager data = bamcpa.getData();
 
+    // the lock on the data manager is the only global lock, thus we measure its contention
+    int waiting = stats.numWaitingThreads.incrementAndGet();
+    stats.waitingThreadsSeries.add(waiting);
+    dataLockTimer.start();
     synchronized (data) {
+      dataLockTimer.stop();
+      stats.numWaitingThreads.decrementAndGet();
+
       if (newRs == null) {
         // We are only synchronized in the current method. Thus, we need to check
         // the cache again, maybe another thread already created the needed reached-set.
@@ -524,7 +554,7 @@ class ReachedSetExecutor {
                     pBsme.getBlock(),
                     false, // mainReachedSet is never nested in another reached-set
                     reachedSetMapping,
-                    pool,
+                    scheduler,
                     algorithmFactory,
                     shutdownNotifier,
                     stats,
@@ -561,7 +591,7 @@ class ReachedSetExecutor {
   String getDependenciesAsDot() {
     final List<String> dependencies = new ArrayList<>();
     for (ReachedSetExecutor rse : reachedSetMapping.values()) {
-      for (ReachedSetExecutor dependentRse : rse.dependingFrom.keys()) {
+      for (ReachedSetExecutor dependentRse : rse.dependingFrom.keySet()) {
         dependencies.add(String.format("\"%s\" -> \"%s\"", rse, dependentRse));
       }
     }
@@ -305,8 +305,8 @@ public class ResidualProgramConstructionAlgorithm implements Algorithm, Statisti
     }
   }
 
-  private String getResidualProgramText(
-      final ARGState pARGRoot, @Nullable final Set<ARGState> pAddPragma)
+  private void writeResidualProgramText(
+      final ARGState pARGRoot, @Nullable final Set<ARGState> pAddPragma, final Writer pWriter)
       throws CPAException, IOException {
     ARGState root = pARGRoot;
     if (constructionStrategy == ResidualGenStrategy.CONDITION_PLUS_FOLD) {
@@ -324,7 +324,7 @@ public class ResidualProgramConstructionAlgorithm implements Algorithm, Statisti
     }
     try {
       statistic.translationTimer.start();
-      return translator.translateARG(root, pAddPragma, hasDeclarationGotoProblem());
+      translator.translateARG(root, pAddPragma, hasDeclarationGotoProblem(), pWriter);
     } finally {
       statistic.translationTimer.stop();
     }
@@ -339,7 +339,7 @@ public class ResidualProgramConstructionAlgorithm implements Algorithm, Statisti
       @Nullable final Set<ARGState> pAddPragma) throws InterruptedException {
     logger.log(Level.INFO, "Generate residual program");
     try (Writer writer = IO.openOutputFile(residualProgram, Charset.defaultCharset())) {
-      writer.write(getResidualProgramText(pArgRoot, pAddPragma));
+      writeResidualProgramText(pArgRoot, pAddPragma, writer);
     } catch (IOException e) {
       logger.logUserException(Level.WARNING, e, "Could not write residual program to file");
       return false;
@@ -334,6 +334,9 @@ public class TerminationStatistics extends LassoAnalysisStatistics {
     pOut.println(
         "  Max number of lassos per iteration:               "
             + format(maxLassosPerIteration.get()));
+    pOut.println(
+        "  Number of reused lasso analysis results:          "
+            + format(reusedLassoResults.get()));
     pOut.println();
 
     pOut.println("Total time for lassos analysis:                     " + lassoTime);
@@ -11,8 +11,11 @@ package org.sosy_lab.cpachecker.core.algorithm.termination.lasso_analysis;
 import static com.google.common.base.Preconditions.checkNotNull;
 import static org.sosy_lab.java_smt.SolverContextFactory.Solvers.SMTINTERPOL;
 
+import com.google.common.base.Throwables;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
 import de.uni_freiburg.informatik.ultimate.core.lib.exceptions.ToolchainCanceledException;
 import de.uni_freiburg.informatik.ultimate.icfgtransformer.transformulatransformers.TermException;
 import de.uni_freiburg.informatik.ultimate.lassoranker.AnalysisType;
@@ -34,10 +37,25 @@ import de.uni_freiburg.informatik.ultimate.logic.SMTLIBException;
 import de.uni_freiburg.informatik.ultimate.logic.Script.LBool;
 import de.uni_freiburg.informatik.ultimate.logic.Term;
 import java.io.IOException;
+import java.util.ArrayList;
 import java.util.Collection;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.CompletionService;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorCompletionService;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.Classes.UnexpectedCheckedException;
 import org.sosy_lab.common.NativeLibraries;
+import org.sosy_lab.common.ShutdownManager;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.IntegerOption;
@@ -54,6 +72,7 @@ import org.sosy_lab.cpachecker.core.algorithm.termination.lasso_analysis.toolcha
 import org.sosy_lab.cpachecker.core.counterexample.CounterexampleInfo;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 import org.sosy_lab.cpachecker.util.LoopStructure.Loop;
+import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManager;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManagerImpl;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
@@ -162,6 +181,23 @@ public class LassoAnalysis {
   @IntegerOption(min = 1)
   private int maxTemplateFunctions = 3;
 
+  @Option(
+      secure = true,
+      description =
+          "Number of threads used to synthesize (non-)termination arguments for the lassos of a"
+              + " counterexample in parallel. The synthesis of non-termination arguments stops"
+              + " as soon as one lasso is proven non-terminating.")
+  @IntegerOption(min = 1)
+  private int threads = 1;
+
+  @Option(
+      secure = true,
+      description =
+          "Reuse the (non-)termination arguments synthesized for a lasso for identical lassos,"
+              + " which are common for repeated counterexamples and for loops created by"
+              + " macro expansion.")
+  private boolean cacheArguments = true;
+
   private final LogManager logger;
   private final ShutdownNotifier shutdownNotifier;
   private final LassoAnalysisStatistics statistics;
@@ -181,6 +217,17 @@ public class LassoAnalysis {
 
   private final ImmutableList<RankingTemplate> rankingTemplates;
 
+  private final @Nullable ExecutorService executor;
+
+  // Results of completed syntheses, keyed by the textual representation of the lasso.
+  // Empty values denote that no argument could be synthesized.
+  private final Map<String, Optional<NonTerminationArgument>> nonTerminationArgumentCache =
+      new HashMap<>();
+  private final Map<
+          Pair<String, Set<CVariableDeclaration>>,
+          Optional<Pair<TerminationArgument, RankingRelation>>>
+      terminationArgumentCache = new HashMap<>();
+
   @SuppressWarnings({"resource", "unchecked"})
   public static LassoAnalysis create(
       LassoBuilder pLassoBuilder,
@@ -366,6 +413,18 @@ public class LassoAnalysis {
     toolchainStorage = new LassoRankerToolchainStorage(pLogger, pShutdownNotifier);
 
     rankingTemplates = createTemplates(maxTemplateFunctions);
+
+    if (threads > 1) {
+      executor =
+          Executors.newFixedThreadPool(
+              threads,
+              new ThreadFactoryBuilder()
+                  .setNameFormat("lasso-analysis-%d")
+                  .setDaemon(true)
+                  .build());
+    } else {
+      executor = null;
+    }
   }
 
   private static ImmutableList<RankingTemplate> createTemplates(int pMaxTemplateFunctions) {
@@ -382,6 +441,9 @@ public class LassoAnalysis {
 
   /** Frees all created resources and the solver context. */
   public void close() {
+    if (executor != null) {
+      executor.shutdownNow();
+    }
     toolchainStorage.clear();
     solverContext.close();
   }
@@ -442,113 +504,308 @@ public class LassoAnalysis {
       Loop pLoop, Collection<Lasso> lassos, Set<CVariableDeclaration> pRelevantVariables)
       throws IOException, SMTLIBException, TermException, InterruptedException, SolverException {
 
-    LassoAnalysisResult result = LassoAnalysisResult.unknown();
-
     // Try to synthesize non-termination arguments first because it is much cheaper
     // than synthesizing termination arguments.
-    for (Lasso lasso : lassos) {
-      shutdownNotifier.shutdownIfNecessary();
-      logger.logf(Level.FINER, "Synthesizing non-termination argument for lasso:\n%s.", lasso);
-      LassoAnalysisResult resultFromLasso = synthesizeNonTerminationArgument(pLoop, lasso);
-      result = result.update(resultFromLasso);
-
-      // Stop and return result if non-termination could be proved.
-      if (result.hasNonTerminationArgument()) {
-        return result;
-      }
+    Optional<NonTerminationArgument> nonTerminationArgument = findNonTerminationArgument(lassos);
+    if (nonTerminationArgument.isPresent()) {
+      logger.logf(Level.FINE, "Proved non-termination: %s", nonTerminationArgument.orElseThrow());
+      statistics.synthesizedNonTerminationArgument(pLoop, nonTerminationArgument.orElseThrow());
+      return LassoAnalysisResult.fromNonTerminationArgument(nonTerminationArgument.orElseThrow());
     }
 
     // Synthesize termination arguments
+    LassoAnalysisResult result = LassoAnalysisResult.unknown();
+    List<Lasso> lassosToAnalyze = new ArrayList<>();
     for (Lasso lasso : lassos) {
-      shutdownNotifier.shutdownIfNecessary();
-      logger.logf(Level.FINER, "Synthesizing termination argument for lasso:\n%s.", lasso);
-      LassoAnalysisResult resultFromLasso =
-          synthesizeTerminationArgument(pLoop, lasso, pRelevantVariables);
-      result = result.update(resultFromLasso);
+      Optional<Pair<TerminationArgument, RankingRelation>> cached = null;
+      if (cacheArguments) {
+        cached = terminationArgumentCache.get(getCacheKey(lasso, pRelevantVariables));
+      }
+      if (cached == null) {
+        lassosToAnalyze.add(lasso);
+      } else {
+        statistics.reusedLassoAnalysisResult();
+        if (cached.isPresent()) {
+          statistics.synthesizedTerminationArgument(pLoop, cached.orElseThrow().getFirst());
+          result =
+              result.update(
+                  LassoAnalysisResult.fromTerminationArgument(cached.orElseThrow().getSecond()));
+        }
+      }
+    }
+
+    Map<Lasso, Optional<Pair<Integer, TerminationArgument>>> synthesized =
+        synthesize(
+            lassosToAnalyze,
+            (lasso, storage, notifier) ->
+                synthesizeTerminationArgument(lasso, 0, storage, notifier),
+            false,
+            statistics::terminationAnalysisOfLassoStarted,
+            statistics::terminationAnalysisOfLassoFinished);
+    for (Lasso lasso : lassosToAnalyze) {
+      Optional<Pair<TerminationArgument, RankingRelation>> terminationArgument =
+          checkTerminationArgument(pLoop, lasso, synthesized.get(lasso), pRelevantVariables);
+      if (cacheArguments) {
+        terminationArgumentCache.put(getCacheKey(lasso, pRelevantVariables), terminationArgument);
+      }
+      if (terminationArgument.isPresent()) {
+        result =
+            result.update(
+                LassoAnalysisResult.fromTerminationArgument(
+                    terminationArgument.orElseThrow().getSecond()));
+      }
     }
 
     return result;
   }
 
-  private LassoAnalysisResult synthesizeNonTerminationArgument(Loop pLoop, Lasso lasso)
-      throws IOException, SMTLIBException, TermException {
+  private Optional<NonTerminationArgument> findNonTerminationArgument(Collection<Lasso> pLassos)
+      throws IOException, SMTLIBException, TermException, InterruptedException {
+    List<Lasso> lassosToAnalyze = new ArrayList<>();
+    for (Lasso lasso : pLassos) {
+      Optional<NonTerminationArgument> cached = null;
+      if (cacheArguments) {
+        cached = nonTerminationArgumentCache.get(lasso.toString());
+      }
+      if (cached == null) {
+        lassosToAnalyze.add(lasso);
+      } else {
+        statistics.reusedLassoAnalysisResult();
+        if (cached.isPresent()) {
+          return cached;
+        }
+      }
+    }
+
+    Map<Lasso, Optional<NonTerminationArgument>> synthesized =
+        synthesize(
+            lassosToAnalyze,
+            this::synthesizeNonTerminationArgument,
+            true,
+            statistics::nonTerminationAnalysisOfLassoStarted,
+            statistics::nonTerminationAnalysisOfLassoFinished);
+
+    // use the argument of the first lasso to get deterministic results
+    Optional<NonTerminationArgument> result = Optional.empty();
+    for (Lasso lasso : lassosToAnalyze) {
+      Optional<NonTerminationArgument> argument = synthesized.get(lasso);
+      if (argument != null) {
+        if (cacheArguments) {
+          nonTerminationArgumentCache.put(lasso.toString(), argument);
+        }
+        if (!result.isPresent()) {
+          result = argument;
+        }
+      }
+    }
+    return result;
+  }
+
+  private static Pair<String, Set<CVariableDeclaration>> getCacheKey(
+      Lasso pLasso, Set<CVariableDeclaration> pRelevantVariables) {
+    // ranking relations are built over the relevant variables, so they are part of the key
+    return Pair.of(pLasso.toString(), pRelevantVariables);
+  }
+
+  /** Synthesis of an argument for a single lasso that may run on any thread. */
+  @FunctionalInterface
+  private interface LassoSynthesis<T> {
+    Optional<T> synthesize(
+        Lasso pLasso, LassoRankerToolchainStorage pStorage, ShutdownNotifier pShutdownNotifier)
+        throws IOException, SMTLIBException, TermException, InterruptedException;
+  }
+
+  /**
+   * Applies the given synthesis to all given lassos. With more than one thread, the lassos are
+   * analyzed in parallel. LassoRanker creates a separate SMT script for each synthesizer, so the
+   * only shared state is the toolchain storage, which is separate for each call of this method.
+   * Statistics are only updated on the calling thread, in parallel mode once for all lassos.
+   *
+   * @param pStopAtFirstArgument whether to stop the remaining synthesis tasks as soon as an
+   *     argument was found for one lasso
+   * @return the result for each lasso whose synthesis was completed
+   */
+  private <T> Map<Lasso, Optional<T>> synthesize(
+      List<Lasso> pLassos,
+      LassoSynthesis<T> pSynthesis,
+      boolean pStopAtFirstArgument,
+      Runnable pSynthesisStarted,
+      Runnable pSynthesisFinished)
+      throws IOException, SMTLIBException, TermException, InterruptedException {
+    Map<Lasso, Optional<T>> results = new HashMap<>();
+
+    if (executor == null || pLassos.size() < 2) {
+      for (Lasso lasso : pLassos) {
+        pSynthesisStarted.run();
+        Optional<T> argument;
+        try {
+          argument = pSynthesis.synthesize(lasso, toolchainStorage, shutdownNotifier);
+        } finally {
+          pSynthesisFinished.run();
+        }
+        results.put(lasso, argument);
+        if (pStopAtFirstArgument && argument.isPresent()) {
+          break;
+        }
+      }
+      return results;
+    }
+
+    ShutdownManager synthesisShutdown = ShutdownManager.createWithParent(shutdownNotifier);
+    LassoRankerToolchainStorage storage =
+        new LassoRankerToolchainStorage(logger, synthesisShutdown.getNotifier());
+    CompletionService<Pair<Lasso, Optional<T>>> completionService =
+        new ExecutorCompletionService<>(executor);
+    List<Future<Pair<Lasso, Optional<T>>>> futures = new ArrayList<>(pLassos.size());
+
+    pSynthesisStarted.run();
+    try {
+      for (Lasso lasso : pLassos) {
+        futures.add(
+            completionService.submit(
+                () ->
+                    Pair.of(
+                        lasso,
+                        pSynthesis.synthesize(lasso, storage, synthesisShutdown.getNotifier()))));
+      }
+
+      for (int i = 0; i < futures.size(); i++) {
+        Pair<Lasso, Optional<T>> result;
+        try {
+          result = completionService.take().get();
+        } catch (ExecutionException e) {
+          Throwable t = e.getCause();
+          Throwables.propagateIfPossible(t, IOException.class, TermException.class);
+          Throwables.propagateIfPossible(t, InterruptedException.class);
+          throw new UnexpectedCheckedException("synthesis of lasso arguments", t);
+        }
+        results.put(result.getFirstNotNull(), result.getSecondNotNull());
+        if (pStopAtFirstArgument && result.getSecondNotNull().isPresent()) {
+          break;
+        }
+      }
+
+    } finally {
+      synthesisShutdown.requestShutdown("Synthesis of lasso arguments finished");
+      futures.forEach(f -> f.cancel(true));
+      for (Future<?> future : futures) {
+        try {
+          Uninterruptibles.getUninterruptibly(future);
+        } catch (ExecutionException | CancellationException e) {
+          // results of stopped tasks are not needed
+        }
+      }
+      storage.clear();
+      pSynthesisFinished.run();
+    }
+    return results;
+  }
+
+  private Optional<NonTerminationArgument> synthesizeNonTerminationArgument(
+      Lasso pLasso, LassoRankerToolchainStorage pStorage, ShutdownNotifier pShutdownNotifier)
+      throws IOException, SMTLIBException, TermException, InterruptedException {
+    pShutdownNotifier.shutdownIfNecessary();
+    logger.logf(Level.FINER, "Synthesizing non-termination argument for lasso:\n%s.", pLasso);
 
-    statistics.nonTerminationAnalysisOfLassoStarted();
-    NonTerminationArgument nonTerminationArgument = null;
     try (NonTerminationArgumentSynthesizer nonTerminationArgumentSynthesizer =
-        createNonTerminationArgumentSynthesizer(lasso)) {
+        createNonTerminationArgumentSynthesizer(pLasso, pStorage)) {
 
       LBool result = nonTerminationArgumentSynthesizer.synthesize();
       if (result.equals(LBool.SAT) && nonTerminationArgumentSynthesizer.synthesisSuccessful()) {
-        nonTerminationArgument = nonTerminationArgumentSynthesizer.getArgument();
-        logger.logf(Level.FINE, "Proved non-termination: %s", nonTerminationArgument);
-        statistics.synthesizedNonTerminationArgument(pLoop, nonTerminationArgument);
-        return LassoAnalysisResult.fromNonTerminationArgument(nonTerminationArgument);
-
+        return Optional.of(nonTerminationArgumentSynthesizer.getArgument());
       } else {
-        return LassoAnalysisResult.unknown();
+        return Optional.empty();
       }
+    }
+  }
 
-    } finally {
-      statistics.nonTerminationAnalysisOfLassoFinished();
+  /**
+   * Tries the ranking templates starting with the given one and returns the first synthesized
+   * termination argument together with the index of its template.
+   */
+  private Optional<Pair<Integer, TerminationArgument>> synthesizeTerminationArgument(
+      Lasso pLasso,
+      int pFirstTemplate,
+      LassoRankerToolchainStorage pStorage,
+      ShutdownNotifier pShutdownNotifier)
+      throws IOException, SMTLIBException, TermException, InterruptedException {
+    logger.logf(Level.FINER, "Synthesizing termination argument for lasso:\n%s.", pLasso);
+
+    for (int i = pFirstTemplate; i < rankingTemplates.size(); i++) {
+      pShutdownNotifier.shutdownIfNecessary();
+
+      try (TerminationArgumentSynthesizer terminationArgumentSynthesizer =
+          createTerminationArgumentSynthesizer(pLasso, rankingTemplates.get(i), pStorage)) {
+        LBool result = null;
+        try {
+          result = terminationArgumentSynthesizer.synthesize();
+        } catch (AssertionError e) {
+          // Workaround for a bug in LassoRanker (terminationArgumentSynthesizer.synthesize()):
+          // An assertion is violated if the time limit is reached.
+          if ("not yet implemented".equals(e.getMessage())) {
+            pShutdownNotifier.shutdownIfNecessary();
+          }
+          throw e;
+        }
+        if (result.equals(LBool.SAT) && terminationArgumentSynthesizer.synthesisSuccessful()) {
+          return Optional.of(Pair.of(i, terminationArgumentSynthesizer.getArgument()));
+        }
+      }
     }
+    return Optional.empty();
   }
 
-  private LassoAnalysisResult synthesizeTerminationArgument(
-      Loop pLoop, Lasso lasso, Set<CVariableDeclaration> pRelevantVariables)
+  /**
+   * Creates the ranking relation for a synthesized termination argument and checks that it is
+   * satisfiable. If not, the remaining ranking templates are tried.
+   */
+  private Optional<Pair<TerminationArgument, RankingRelation>> checkTerminationArgument(
+      Loop pLoop,
+      Lasso pLasso,
+      Optional<Pair<Integer, TerminationArgument>> pSynthesized,
+      Set<CVariableDeclaration> pRelevantVariables)
       throws IOException, SMTLIBException, TermException, InterruptedException, SolverException {
+    Optional<Pair<Integer, TerminationArgument>> synthesized = pSynthesized;
 
-    statistics.terminationAnalysisOfLassoStarted();
-    try {
-      for (RankingTemplate rankingTemplate : rankingTemplates) {
-        shutdownNotifier.shutdownIfNecessary();
-
-        try (TerminationArgumentSynthesizer terminationArgumentSynthesizer =
-            createTerminationArgumentSynthesizer(lasso, rankingTemplate)) {
-          LBool result = null;
-          try {
-            result = terminationArgumentSynthesizer.synthesize();
-          } catch (AssertionError e) {
-            // Workaround for a bug in LassoRanker (terminationArgumentSynthesizer.synthesize()):
-            // An assertion is violated if the time limit is reached.
-            if ("not yet implemented".equals(e.getMessage())) {
-              shutdownNotifier.shutdownIfNecessary();
-            }
-            throw e;
-          }
-          if (result.equals(LBool.SAT) && terminationArgumentSynthesizer.synthesisSuccessful()) {
-            TerminationArgument terminationArgument = terminationArgumentSynthesizer.getArgument();
-            logger.logf(Level.FINE, "Found termination argument: %s", terminationArgument);
-
-            try (ProverEnvironment proverEnv = solverContext.newProverEnvironment()) {
-              RankingRelation rankingRelation =
-                  rankingRelationBuilder.fromTerminationArgument(
-                      terminationArgument, pRelevantVariables);
-
-              proverEnv.push(rankingRelation.asFormula());
-              if (!proverEnv.isUnsat()) {
-                statistics.synthesizedTerminationArgument(pLoop, terminationArgument);
-                return LassoAnalysisResult.fromTerminationArgument(rankingRelation);
-              }
+    while (synthesized.isPresent()) {
+      TerminationArgument terminationArgument = synthesized.orElseThrow().getSecondNotNull();
+      logger.logf(Level.FINE, "Found termination argument: %s", terminationArgument);
 
-            } catch (RankingRelationException e) {
-              logger.logUserException(
-                  Level.INFO, e, "Could not create ranking relation from " + terminationArgument);
-              return LassoAnalysisResult.unknown();
-            }
-          }
+      try (ProverEnvironment proverEnv = solverContext.newProverEnvironment()) {
+        RankingRelation rankingRelation =
+            rankingRelationBuilder.fromTerminationArgument(terminationArgument, pRelevantVariables);
+
+        proverEnv.push(rankingRelation.asFormula());
+        if (!proverEnv.isUnsat()) {
+          statistics.synthesizedTerminationArgument(pLoop, terminationArgument);
+          return Optional.of(Pair.of(terminationArgument, rankingRelation));
         }
+
+      } catch (RankingRelationException e) {
+        logger.logUserException(
+            Level.INFO, e, "Could not create ranking relation from " + terminationArgument);
+        return Optional.empty();
       }
 
-    } finally {
-      statistics.terminationAnalysisOfLassoFinished();
+      statistics.terminationAnalysisOfLassoStarted();
+      try {
+        synthesized =
+            synthesizeTerminationArgument(
+                pLasso,
+                synthesized.orElseThrow().getFirstNotNull() + 1,
+                toolchainStorage,
+                shutdownNotifier);
+      } finally {
+        statistics.terminationAnalysisOfLassoFinished();
+      }
     }
 
-    return LassoAnalysisResult.unknown();
+    return Optional.empty();
   }
 
   private TerminationArgumentSynthesizer createTerminationArgumentSynthesizer(
-      Lasso lasso, RankingTemplate template) throws IOException {
+      Lasso lasso, RankingTemplate template, LassoRankerToolchainStorage pStorage)
+      throws IOException {
     LassoRankerPreferences lassoRankerPreferences;
     TerminationAnalysisSettings terminationAnalysisSettings;
 
@@ -567,12 +824,12 @@ public class LassoAnalysis {
         lassoRankerPreferences,
         terminationAnalysisSettings,
         ImmutableSet.of(),
-        toolchainStorage);
+        pStorage);
   }
 
-  private NonTerminationArgumentSynthesizer createNonTerminationArgumentSynthesizer(Lasso lasso)
-      throws IOException {
+  private NonTerminationArgumentSynthesizer createNonTerminationArgumentSynthesizer(
+      Lasso lasso, LassoRankerToolchainStorage pStorage) throws IOException {
     return new NonTerminationArgumentSynthesizer(
-        lasso, nonlinearLassoRankerPreferences, nonTerminationAnalysisSettings, toolchainStorage);
+        lasso, nonlinearLassoRankerPreferences, nonTerminationAnalysisSettings, pStorage);
   }
 }
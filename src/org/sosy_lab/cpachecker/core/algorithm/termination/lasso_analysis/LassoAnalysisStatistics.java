@@ -41,6 +41,8 @@ public abstract class LassoAnalysisStatistics implements Statistics {
 
   protected final AtomicInteger lassosCurrentIteration = new AtomicInteger();
 
+  protected final AtomicInteger reusedLassoResults = new AtomicInteger();
+
   protected final Multimap<Loop, TerminationArgument> terminationArguments =
       MultimapBuilder.linkedHashKeys().arrayListValues().build();
 
@@ -74,6 +76,10 @@ public abstract class LassoAnalysisStatistics implements Statistics {
     lassosCurrentIteration.addAndGet(numberOfLassos);
   }
 
+  public void reusedLassoAnalysisResult() {
+    reusedLassoResults.incrementAndGet();
+  }
+
   public void nonTerminationAnalysisOfLassoStarted() {
     lassoNonTerminationTime.start();
   }
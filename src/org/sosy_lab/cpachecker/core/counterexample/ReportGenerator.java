@@ -22,6 +22,7 @@ import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.SetMultimap;
+import com.google.common.io.MoreFiles;
 import com.google.common.io.Resources;
 import java.io.BufferedReader;
 import java.io.FileInputStream;
@@ -90,6 +91,8 @@ public class ReportGenerator {
   private static final String HTML_TEMPLATE = "report.html";
   private static final String CSS_TEMPLATE = "report.css";
   private static final String JS_TEMPLATE = "report.js";
+  private static final String CFA_DATA_FILE = "cfa.js";
+  private static final String ARG_DATA_FILE = "arg.js";
 
   private final Configuration config;
   private final LogManager logger;
@@ -114,6 +117,15 @@ public class ReportGenerator {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private PathTemplate counterExampleFiles = PathTemplate.ofFormatString("Counterexample.%d.html");
 
+  @Option(
+    secure = true,
+    name = "report.externalData",
+    description =
+        "Write the CFA and ARG data of the HTML report into separate script files in a directory"
+            + " next to the report instead of embedding them into the HTML file."
+            + " This keeps the HTML file small for large programs.")
+  private boolean externalData = false;
+
   private final @Nullable Path logFile;
   private final ImmutableList<String> sourceFiles;
   private final Map<Integer, Object> argNodes;
@@ -258,6 +270,8 @@ public class ReportGenerator {
           insertConfiguration(writer);
         } else if (line.contains("REPORT_CSS")) {
           insertCss(writer);
+        } else if (line.contains("REPORT_DATA")) {
+          insertDataScripts(writer, reportPath, cfa, dotBuilder, counterExample);
         } else if (line.contains("REPORT_JS")) {
           insertJs(writer, cfa, dotBuilder, counterExample);
         } else if (line.contains("STATISTICS")) {
@@ -296,7 +310,11 @@ public class ReportGenerator {
             .openBufferedStream();) {
       String line;
       while (null != (line = reader.readLine())) {
-        if (line.contains("CFA_JSON_INPUT")) {
+        if (externalData && line.contains("CFA_JSON_INPUT")) {
+          writer.write("// cfaJson is loaded from a separate script file\n");
+        } else if (externalData && line.contains("ARG_JSON_INPUT")) {
+          writer.write("// argJson is loaded from a separate script file\n");
+        } else if (line.contains("CFA_JSON_INPUT")) {
           insertCfaJson(writer, cfa, dotBuilder, counterExample);
         } else if (line.contains("ARG_JSON_INPUT")) {
           insertArgJson(writer);
@@ -310,6 +328,39 @@ public class ReportGenerator {
     }
   }
 
+  /**
+   * If the report data should not be embedded, writes the CFA and ARG data as script files into a
+   * directory next to the report and references them from the report. The browser loads these
+   * files like any other script, so the report can still be opened directly from the file system.
+   */
+  private void insertDataScripts(
+      Writer writer,
+      Path reportPath,
+      CFA cfa,
+      DOTBuilder2 dotBuilder,
+      @Nullable CounterexampleInfo counterExample)
+      throws IOException {
+    if (!externalData) {
+      return;
+    }
+    Path dataDirectory =
+        reportPath.resolveSibling(MoreFiles.getNameWithoutExtension(reportPath) + "_data");
+    try (Writer cfaWriter =
+        IO.openOutputFile(dataDirectory.resolve(CFA_DATA_FILE), Charsets.UTF_8)) {
+      insertCfaJson(cfaWriter, cfa, dotBuilder, counterExample);
+    }
+    try (Writer argWriter =
+        IO.openOutputFile(dataDirectory.resolve(ARG_DATA_FILE), Charsets.UTF_8)) {
+      insertArgJson(argWriter);
+    }
+    for (String dataFile : ImmutableList.of(CFA_DATA_FILE, ARG_DATA_FILE)) {
+      writer.write(
+          String.format(
+              "  <script src=\"%s\"></script>%n",
+              htmlEscaper().escape(dataDirectory.getFileName() + "/" + dataFile)));
+    }
+  }
+
   private void insertCfaJson(
       Writer writer, CFA cfa, DOTBuilder2 dotBuilder, @Nullable CounterexampleInfo counterExample)
       throws IOException {
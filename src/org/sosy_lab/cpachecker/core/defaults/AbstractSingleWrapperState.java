@@ -12,11 +12,13 @@ import static com.google.common.base.Preconditions.checkState;
 
 import com.google.common.base.Function;
 import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
 import java.io.Serializable;
 import java.util.Set;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractWrapperState;
+import org.sosy_lab.cpachecker.core.interfaces.CoverageIndexable;
 import org.sosy_lab.cpachecker.core.interfaces.Partitionable;
 import org.sosy_lab.cpachecker.core.interfaces.Property;
 import org.sosy_lab.cpachecker.core.interfaces.PseudoPartitionable;
@@ -27,7 +29,12 @@ import org.sosy_lab.cpachecker.core.interfaces.Targetable;
  * one CPA.
  */
 public abstract class AbstractSingleWrapperState
-    implements AbstractWrapperState, Targetable, Partitionable, PseudoPartitionable, Serializable {
+    implements AbstractWrapperState,
+        Targetable,
+        Partitionable,
+        PseudoPartitionable,
+        CoverageIndexable,
+        Serializable {
 
   private static final long serialVersionUID = -332757795984736107L;
 
@@ -89,6 +96,15 @@ public abstract class AbstractSingleWrapperState
     }
   }
 
+  @Override
+  public Set<?> getCoverageIndexKeys() {
+    if (wrappedState instanceof CoverageIndexable) {
+      return ((CoverageIndexable) wrappedState).getCoverageIndexKeys();
+    } else {
+      return ImmutableSet.of();
+    }
+  }
+
   @Override
   public String toString() {
     return wrappedState.toString();
@@ -0,0 +1,35 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.interfaces;
+
+import java.util.Set;
+
+/**
+ * This interface can be implemented by abstract states that provide keys for a coverage index of
+ * the reached set. Such an index returns only those states from a partition that are candidates
+ * for covering a new state, such that the stop operator does not need to check all states of the
+ * partition.
+ *
+ * <p>The keys need to be a necessary condition for 'lessOrEqual': if a state s1 is 'lessOrEqual'
+ * to a state s2, then every key of s2 has to be a key of s1. Thus a state without keys is a
+ * candidate for covering any state, and a state can only be covered by states without keys if it
+ * has no keys itself.
+ *
+ * <p>For example, a state that maps variables to values is less or equal to another state only if
+ * it contains all variable assignments of the other state, so the variable assignments can be used
+ * as keys.
+ */
+public interface CoverageIndexable {
+
+  /**
+   * Return the keys of this state for the coverage index. The returned set should not change
+   * while the state is in the reached set.
+   */
+  Set<?> getCoverageIndexKeys();
+}
@@ -9,107 +9,157 @@
 package org.sosy_lab.cpachecker.core.reachedset;
 
 import static com.google.common.base.Preconditions.checkNotNull;
-import static com.google.common.collect.FluentIterable.from;
 
 import com.google.common.collect.ImmutableSet;
-import com.google.common.collect.Sets;
-import java.util.ArrayList;
 import java.util.List;
 import java.util.Set;
-import java.util.concurrent.ConcurrentHashMap;
-import java.util.concurrent.locks.ReentrantReadWriteLock;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.concurrent.atomic.AtomicReference;
+import org.sosy_lab.cpachecker.core.algorithm.invariants.SharedInvariantStore;
 
 public class AggregatedReachedSets {
-  protected final Set<UnmodifiableReachedSet> reachedSets;
+  protected final ImmutableSet<UnmodifiableReachedSet> reachedSets;
+
+  /** The invariants that analyses using these reached sets share while they are running. */
+  private final SharedInvariantStore sharedInvariants;
 
   public AggregatedReachedSets() {
-    reachedSets = ImmutableSet.of();
+    this(ImmutableSet.of());
   }
 
   public AggregatedReachedSets(Set<UnmodifiableReachedSet> pReachedSets) {
-    reachedSets = checkNotNull(pReachedSets);
+    this(pReachedSets, new SharedInvariantStore());
+  }
+
+  private AggregatedReachedSets(
+      Set<UnmodifiableReachedSet> pReachedSets, SharedInvariantStore pSharedInvariants) {
+    reachedSets = ImmutableSet.copyOf(pReachedSets);
+    sharedInvariants = checkNotNull(pSharedInvariants);
+  }
+
+  public SharedInvariantStore getSharedInvariants() {
+    return sharedInvariants;
   }
 
   public Set<UnmodifiableReachedSet> snapShot() {
-    synchronized (reachedSets) {
-      return ImmutableSet.copyOf(reachedSets);
-    }
+    return reachedSets;
+  }
+
+  /**
+   * Get a number that changes whenever the result of {@link #snapShot()} changes. This allows
+   * users to check cheaply whether they need to update information derived from the reached sets.
+   */
+  public long getVersion() {
+    return 0;
   }
 
+  /**
+   * The reached sets that are shared between analyses running in parallel. The reached sets of the
+   * manager are published as immutable sets, so taking a snapshot requires no locking.
+   */
   private static class AggregatedThreadedReachedSets extends AggregatedReachedSets {
-    private final ReentrantReadWriteLock lock;
-    private final List<AggregatedThreadedReachedSets> otherAggregators = new ArrayList<>();
+    private final AtomicReference<ReachedSetsVersion> ownReachedSets;
+    private final List<AggregatedReachedSets> otherAggregators = new CopyOnWriteArrayList<>();
 
     private AggregatedThreadedReachedSets(
-        final ReentrantReadWriteLock pLock, Set<UnmodifiableReachedSet> pReachedSets) {
-      super(pReachedSets);
-      lock = pLock;
+        AtomicReference<ReachedSetsVersion> pOwnReachedSets,
+        SharedInvariantStore pSharedInvariants) {
+      super(ImmutableSet.of(), pSharedInvariants);
+      ownReachedSets = pOwnReachedSets;
     }
 
     @Override
     public Set<UnmodifiableReachedSet> snapShot() {
-      lock.readLock().lock();
-      try {
-        return Sets.union(
-            super.snapShot(),
-            from(otherAggregators).transformAndConcat(AggregatedReachedSets::snapShot).toSet());
-      } finally {
-        lock.readLock().unlock();
+      ImmutableSet<UnmodifiableReachedSet> own = ownReachedSets.get().reachedSets;
+      if (otherAggregators.isEmpty()) {
+        return own;
       }
+      ImmutableSet.Builder<UnmodifiableReachedSet> result = ImmutableSet.builder();
+      result.addAll(own);
+      for (AggregatedReachedSets other : otherAggregators) {
+        result.addAll(other.snapShot());
+      }
+      return result.build();
     }
 
-    public void concat(AggregatedThreadedReachedSets other) {
+    @Override
+    public long getVersion() {
+      long version = ownReachedSets.get().version;
+      for (AggregatedReachedSets other : otherAggregators) {
+        // the versions only grow, so the sum changes whenever one of them changes
+        version += other.getVersion();
+      }
+      return version + otherAggregators.size();
+    }
+
+    public void concat(AggregatedReachedSets other) {
       otherAggregators.add(other);
     }
   }
 
+  private static final class ReachedSetsVersion {
+    private final ImmutableSet<UnmodifiableReachedSet> reachedSets;
+    private final long version;
+
+    private ReachedSetsVersion(ImmutableSet<UnmodifiableReachedSet> pReachedSets, long pVersion) {
+      reachedSets = pReachedSets;
+      version = pVersion;
+    }
+
+    private ReachedSetsVersion with(
+        Set<UnmodifiableReachedSet> pRemoved, Set<UnmodifiableReachedSet> pAdded) {
+      ImmutableSet.Builder<UnmodifiableReachedSet> builder = ImmutableSet.builder();
+      for (UnmodifiableReachedSet reached : reachedSets) {
+        if (!pRemoved.contains(reached)) {
+          builder.add(reached);
+        }
+      }
+      return new ReachedSetsVersion(builder.addAll(pAdded).build(), version + 1);
+    }
+  }
+
+  /**
+   * Manages the reached sets that analyses running in parallel provide to each other. Updates are
+   * rare compared to reads, so each update publishes a new immutable set.
+   */
   public static class AggregatedReachedSetManager {
 
-    private final ReentrantReadWriteLock lock = new ReentrantReadWriteLock();
+    private final AtomicReference<ReachedSetsVersion> reachedSets =
+        new AtomicReference<>(new ReachedSetsVersion(ImmutableSet.of(), 0));
     private final AggregatedThreadedReachedSets reachedView;
-    private final Set<UnmodifiableReachedSet> reachedSets = ConcurrentHashMap.newKeySet();
 
     public AggregatedReachedSetManager() {
-      reachedView = new AggregatedThreadedReachedSets(lock, reachedSets);
+      this(new SharedInvariantStore());
+    }
+
+    /**
+     * Create a manager whose view shares the given invariants, e.g., the shared invariants of the
+     * reached sets of an enclosing analysis.
+     */
+    public AggregatedReachedSetManager(SharedInvariantStore pSharedInvariants) {
+      reachedView = new AggregatedThreadedReachedSets(reachedSets, pSharedInvariants);
     }
 
     public void addReachedSet(UnmodifiableReachedSet reached) {
-      lock.writeLock().lock();
-      try {
-        reachedSets.add(reached);
-      } finally {
-        lock.writeLock().unlock();
-      }
+      reachedSets.updateAndGet(r -> r.with(ImmutableSet.of(), ImmutableSet.of(reached)));
     }
 
     public void updateReachedSet(
         UnmodifiableReachedSet oldReached, UnmodifiableReachedSet newReached) {
-      lock.writeLock().lock();
-      try {
-        reachedSets.remove(oldReached);
-        reachedSets.add(newReached);
-      } finally {
-        lock.writeLock().unlock();
-      }
+      reachedSets.updateAndGet(
+          r -> r.with(ImmutableSet.of(oldReached), ImmutableSet.of(newReached)));
     }
 
     public AggregatedReachedSets asView() {
       return reachedView;
     }
 
-    public synchronized void addAggregated(AggregatedReachedSets pAggregatedReachedSets) {
-      lock.writeLock().lock();
-
-      try {
-        if (pAggregatedReachedSets instanceof AggregatedThreadedReachedSets) {
-          reachedView.concat((AggregatedThreadedReachedSets) pAggregatedReachedSets);
-
-        } else {
-          reachedSets.addAll(pAggregatedReachedSets.reachedSets);
-        }
-
-      } finally {
-        lock.writeLock().unlock();
+    public void addAggregated(AggregatedReachedSets pAggregatedReachedSets) {
+      if (pAggregatedReachedSets instanceof AggregatedThreadedReachedSets) {
+        reachedView.concat(pAggregatedReachedSets);
+      } else {
+        reachedSets.updateAndGet(
+            r -> r.with(ImmutableSet.of(), pAggregatedReachedSets.reachedSets));
       }
     }
   }
@@ -0,0 +1,70 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import java.util.Set;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.core.reachedset.AggregatedReachedSets.AggregatedReachedSetManager;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.TraversalMethod;
+
+public class AggregatedReachedSetsTest {
+
+  private AggregatedReachedSetManager manager;
+  private AggregatedReachedSets view;
+
+  @Before
+  public void init() {
+    manager = new AggregatedReachedSetManager();
+    view = manager.asView();
+  }
+
+  @Test
+  public void testVersionChangesWithSnapshot() {
+    ReachedSet first = new DefaultReachedSet(TraversalMethod.DFS);
+    ReachedSet second = new DefaultReachedSet(TraversalMethod.DFS);
+    long initialVersion = view.getVersion();
+    assertThat(view.snapShot()).isEmpty();
+
+    manager.addReachedSet(first);
+    long versionAfterAdd = view.getVersion();
+    assertThat(versionAfterAdd).isNotEqualTo(initialVersion);
+    assertThat(view.snapShot()).containsExactly(first);
+    assertThat(view.getVersion()).isEqualTo(versionAfterAdd);
+
+    manager.updateReachedSet(first, second);
+    assertThat(view.getVersion()).isNotEqualTo(versionAfterAdd);
+    assertThat(view.snapShot()).containsExactly(second);
+  }
+
+  @Test
+  public void testSnapshotIsNotModifiedLater() {
+    ReachedSet first = new DefaultReachedSet(TraversalMethod.DFS);
+    manager.addReachedSet(first);
+    Set<UnmodifiableReachedSet> snapshot = view.snapShot();
+
+    manager.addReachedSet(new DefaultReachedSet(TraversalMethod.DFS));
+    assertThat(snapshot).containsExactly(first);
+    assertThat(view.snapShot()).hasSize(2);
+  }
+
+  @Test
+  public void testNestedManagers() {
+    AggregatedReachedSetManager outer = new AggregatedReachedSetManager();
+    manager.addAggregated(outer.asView());
+    long initialVersion = view.getVersion();
+
+    ReachedSet outerReached = new DefaultReachedSet(TraversalMethod.DFS);
+    outer.addReachedSet(outerReached);
+    assertThat(view.getVersion()).isNotEqualTo(initialVersion);
+    assertThat(view.snapShot()).containsExactly(outerReached);
+  }
+}
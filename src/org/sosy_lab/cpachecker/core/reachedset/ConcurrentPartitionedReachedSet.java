@@ -0,0 +1,221 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.util.concurrent.Striped;
+import java.io.IOException;
+import java.io.ObjectInputStream;
+import java.util.Collection;
+import java.util.Optional;
+import java.util.concurrent.locks.Lock;
+import java.util.concurrent.locks.ReadWriteLock;
+import java.util.concurrent.locks.ReentrantReadWriteLock;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.WaitlistFactory;
+import org.sosy_lab.cpachecker.util.Pair;
+
+/**
+ * Variant of {@link PartitionedReachedSet} that can be accessed concurrently by several threads.
+ *
+ * <p>All modifications and the point queries {@link #getReached(AbstractState)}, {@link
+ * #getPrecision(AbstractState)}, {@link #contains(AbstractState)} and {@link #size()} are
+ * synchronized. The collection returned by {@link #getReached(AbstractState)} is a snapshot and
+ * is not updated by later modifications. Iterating over the whole set (e.g., via {@link
+ * #asCollection()}) is only safe while no other thread modifies the reached set.
+ *
+ * <p>In addition to the internal synchronization, this class provides striped locks per partition
+ * key ({@link #getPartitionLock(AbstractState)}). Holding the lock of a partition while checking
+ * coverage and adding a state makes this sequence atomic with respect to other threads that use
+ * the same partition, which is sufficient for analyses using merge-sep.
+ */
+public class ConcurrentPartitionedReachedSet extends PartitionedReachedSet {
+
+  private static final long serialVersionUID = 1L;
+
+  private static final int NUMBER_OF_STRIPES = 1024;
+
+  private final ReadWriteLock lock = new ReentrantReadWriteLock();
+
+  private transient Striped<Lock> partitionLocks = Striped.lock(NUMBER_OF_STRIPES);
+
+  public ConcurrentPartitionedReachedSet(WaitlistFactory waitlistFactory) {
+    this(waitlistFactory, false);
+  }
+
+  public ConcurrentPartitionedReachedSet(
+      WaitlistFactory waitlistFactory, boolean useCoverageIndex) {
+    super(waitlistFactory, useCoverageIndex);
+  }
+
+  /**
+   * Return the lock that guards the partition of the given state. Different partitions may share
+   * the same lock.
+   */
+  public Lock getPartitionLock(AbstractState pState) {
+    return partitionLocks.get(Optional.ofNullable(getPartitionKey(pState)));
+  }
+
+  @Override
+  public void add(AbstractState pState, Precision pPrecision) {
+    lock.writeLock().lock();
+    try {
+      super.add(pState, pPrecision);
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public void addAll(Iterable<Pair<AbstractState, Precision>> pToAdd) {
+    lock.writeLock().lock();
+    try {
+      super.addAll(pToAdd);
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public void reAddToWaitlist(AbstractState pState) {
+    lock.writeLock().lock();
+    try {
+      super.reAddToWaitlist(pState);
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public void updatePrecision(AbstractState pState, Precision pNewPrecision) {
+    lock.writeLock().lock();
+    try {
+      super.updatePrecision(pState, pNewPrecision);
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public void remove(AbstractState pState) {
+    lock.writeLock().lock();
+    try {
+      super.remove(pState);
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public void removeAll(Iterable<? extends AbstractState> pToRemove) {
+    lock.writeLock().lock();
+    try {
+      super.removeAll(pToRemove);
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public void removeOnlyFromWaitlist(AbstractState pState) {
+    lock.writeLock().lock();
+    try {
+      super.removeOnlyFromWaitlist(pState);
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public void clear() {
+    lock.writeLock().lock();
+    try {
+      super.clear();
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public AbstractState popFromWaitlist() {
+    lock.writeLock().lock();
+    try {
+      return super.popFromWaitlist();
+    } finally {
+      lock.writeLock().unlock();
+    }
+  }
+
+  @Override
+  public boolean hasWaitingState() {
+    lock.readLock().lock();
+    try {
+      return super.hasWaitingState();
+    } finally {
+      lock.readLock().unlock();
+    }
+  }
+
+  @Override
+  public Collection<AbstractState> getReached(AbstractState pState) {
+    lock.readLock().lock();
+    try {
+      return ImmutableList.copyOf(super.getReached(pState));
+    } finally {
+      lock.readLock().unlock();
+    }
+  }
+
+  @Override
+  public Collection<AbstractState> getCoveringCandidates(AbstractState pState) {
+    lock.readLock().lock();
+    try {
+      return ImmutableList.copyOf(super.getCoveringCandidates(pState));
+    } finally {
+      lock.readLock().unlock();
+    }
+  }
+
+  @Override
+  public Precision getPrecision(AbstractState pState) {
+    lock.readLock().lock();
+    try {
+      return super.getPrecision(pState);
+    } finally {
+      lock.readLock().unlock();
+    }
+  }
+
+  @Override
+  public boolean contains(AbstractState pState) {
+    lock.readLock().lock();
+    try {
+      return super.contains(pState);
+    } finally {
+      lock.readLock().unlock();
+    }
+  }
+
+  @Override
+  public int size() {
+    lock.readLock().lock();
+    try {
+      return super.size();
+    } finally {
+      lock.readLock().unlock();
+    }
+  }
+
+  @SuppressWarnings("UnusedVariable") // parameter is required by API
+  private void readObject(ObjectInputStream s) throws IOException, ClassNotFoundException {
+    s.defaultReadObject();
+    partitionLocks = Striped.lock(NUMBER_OF_STRIPES);
+  }
+}
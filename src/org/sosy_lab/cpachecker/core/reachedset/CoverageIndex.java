@@ -0,0 +1,161 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import java.io.IOException;
+import java.io.ObjectInputStream;
+import java.io.Serializable;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.LinkedHashSet;
+import java.util.Map;
+import java.util.Map.Entry;
+import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.CoverageIndexable;
+import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.statistics.StatCounter;
+import org.sosy_lab.cpachecker.util.statistics.StatInt;
+import org.sosy_lab.cpachecker.util.statistics.StatKind;
+
+/**
+ * Secondary index for the states of a partitioned reached set, which is used to determine the
+ * candidates for covering a state (cf. {@link CoverageIndexable}).
+ *
+ * <p>The index is an inverted index from (partition key, coverage key) to the states having this
+ * key. A state s2 of the partition is a candidate for covering a state s1 iff all keys of s2 are
+ * keys of s1, which is determined by counting for each state how often it occurs in the posting
+ * lists of the keys of s1.
+ */
+final class CoverageIndex implements Serializable {
+
+  private static final long serialVersionUID = 1L;
+
+  /** Posting lists: (partition key, coverage key) to states. */
+  private final Map<Pair<Object, Object>, Set<AbstractState>> postings = new HashMap<>();
+
+  /** Per partition the states that have no keys and are thus candidates for every state. */
+  private final Map<Object, Set<AbstractState>> statesWithoutKeys = new HashMap<>();
+
+  /** The keys of each state at the time the state was added. */
+  private final Map<AbstractState, ImmutableSet<?>> keysOfStates = new HashMap<>();
+
+  private transient StatCounter lookups;
+  private transient StatInt candidates;
+
+  CoverageIndex() {
+    initStatistics();
+  }
+
+  private void initStatistics() {
+    lookups = new StatCounter("Number of coverage-index lookups");
+    candidates = new StatInt(StatKind.AVG, "Candidates per coverage-index lookup");
+  }
+
+  static ImmutableSet<?> getKeys(AbstractState pState) {
+    if (pState instanceof CoverageIndexable) {
+      return ImmutableSet.copyOf(((CoverageIndexable) pState).getCoverageIndexKeys());
+    }
+    return ImmutableSet.of();
+  }
+
+  void add(@Nullable Object pPartitionKey, AbstractState pState) {
+    ImmutableSet<?> keys = getKeys(pState);
+    if (keysOfStates.putIfAbsent(pState, keys) != null) {
+      return; // already contained
+    }
+    if (keys.isEmpty()) {
+      statesWithoutKeys.computeIfAbsent(pPartitionKey, k -> new LinkedHashSet<>()).add(pState);
+    }
+    for (Object key : keys) {
+      postings.computeIfAbsent(Pair.of(pPartitionKey, key), k -> new LinkedHashSet<>()).add(pState);
+    }
+  }
+
+  void remove(@Nullable Object pPartitionKey, AbstractState pState) {
+    ImmutableSet<?> keys = keysOfStates.remove(pState);
+    if (keys == null) {
+      return;
+    }
+    if (keys.isEmpty()) {
+      removeFrom(statesWithoutKeys, pPartitionKey, pState);
+    }
+    for (Object key : keys) {
+      removeFrom(postings, Pair.of(pPartitionKey, key), pState);
+    }
+  }
+
+  private static <K> void removeFrom(
+      Map<K, Set<AbstractState>> pMap, K pKey, AbstractState pState) {
+    Set<AbstractState> states = pMap.get(pKey);
+    if (states != null) {
+      states.remove(pState);
+      if (states.isEmpty()) {
+        pMap.remove(pKey);
+      }
+    }
+  }
+
+  void clear() {
+    postings.clear();
+    statesWithoutKeys.clear();
+    keysOfStates.clear();
+  }
+
+  /**
+   * Return all states of the given partition that could cover the given state. The given state
+   * does not need to be contained in the index.
+   */
+  ImmutableList<AbstractState> getCoveringCandidates(
+      @Nullable Object pPartitionKey, AbstractState pState) {
+    ImmutableSet<?> keys = getKeys(pState);
+    ImmutableList.Builder<AbstractState> result = ImmutableList.builder();
+    Set<AbstractState> alwaysCandidates = statesWithoutKeys.get(pPartitionKey);
+    if (alwaysCandidates != null) {
+      result.addAll(alwaysCandidates);
+    }
+
+    Map<AbstractState, Integer> hits = new LinkedHashMap<>();
+    for (Object key : keys) {
+      Set<AbstractState> states = postings.get(Pair.of(pPartitionKey, key));
+      if (states != null) {
+        for (AbstractState state : states) {
+          hits.merge(state, 1, Integer::sum);
+        }
+      }
+    }
+    for (Entry<AbstractState, Integer> hit : hits.entrySet()) {
+      if (keysOfStates.get(hit.getKey()).size() == hit.getValue()) {
+        result.add(hit.getKey());
+      }
+    }
+
+    ImmutableList<AbstractState> list = result.build();
+    lookups.inc();
+    candidates.setNextValue(list.size());
+    return list;
+  }
+
+  StatCounter getLookups() {
+    return lookups;
+  }
+
+  StatInt getCandidates() {
+    return candidates;
+  }
+
+  @SuppressWarnings("UnusedVariable") // parameter is required by API
+  private void readObject(ObjectInputStream s) throws IOException, ClassNotFoundException {
+    s.defaultReadObject();
+    initStatistics();
+  }
+}
@@ -0,0 +1,106 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableSet;
+import java.util.Set;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.CoverageIndexable;
+
+public class CoverageIndexTest {
+
+  private static final class IndexableState implements AbstractState, CoverageIndexable {
+
+    private final ImmutableSet<String> keys;
+
+    private IndexableState(String... pKeys) {
+      keys = ImmutableSet.copyOf(pKeys);
+    }
+
+    @Override
+    public Set<?> getCoverageIndexKeys() {
+      return keys;
+    }
+
+    @Override
+    public String toString() {
+      return keys.toString();
+    }
+  }
+
+  private static final Object PARTITION = "partition";
+  private static final Object OTHER_PARTITION = "other";
+
+  private CoverageIndex index;
+
+  @Before
+  public void init() {
+    index = new CoverageIndex();
+  }
+
+  @Test
+  public void testEmpty() {
+    assertThat(index.getCoveringCandidates(PARTITION, new IndexableState("a"))).isEmpty();
+  }
+
+  @Test
+  public void testSubsetsAreCandidates() {
+    IndexableState top = new IndexableState();
+    IndexableState a = new IndexableState("a");
+    IndexableState ab = new IndexableState("a", "b");
+    IndexableState bc = new IndexableState("b", "c");
+    index.add(PARTITION, top);
+    index.add(PARTITION, a);
+    index.add(PARTITION, ab);
+    index.add(PARTITION, bc);
+
+    assertThat(index.getCoveringCandidates(PARTITION, new IndexableState("a", "b", "d")))
+        .containsExactly(top, a, ab);
+    assertThat(index.getCoveringCandidates(PARTITION, new IndexableState("b", "c")))
+        .containsExactly(top, bc);
+    assertThat(index.getCoveringCandidates(PARTITION, new IndexableState())).containsExactly(top);
+  }
+
+  @Test
+  public void testPartitionsAreSeparated() {
+    IndexableState a = new IndexableState("a");
+    index.add(OTHER_PARTITION, a);
+    index.add(null, new IndexableState());
+
+    assertThat(index.getCoveringCandidates(PARTITION, new IndexableState("a"))).isEmpty();
+    assertThat(index.getCoveringCandidates(OTHER_PARTITION, new IndexableState("a")))
+        .containsExactly(a);
+  }
+
+  @Test
+  public void testRemove() {
+    IndexableState a = new IndexableState("a");
+    IndexableState top = new IndexableState();
+    index.add(PARTITION, a);
+    index.add(PARTITION, top);
+    index.remove(PARTITION, a);
+    index.remove(PARTITION, top);
+
+    assertThat(index.getCoveringCandidates(PARTITION, new IndexableState("a"))).isEmpty();
+  }
+
+  @Test
+  public void testStatistics() {
+    index.add(PARTITION, new IndexableState("a"));
+    index.getCoveringCandidates(PARTITION, new IndexableState("a"));
+    index.getCoveringCandidates(PARTITION, new IndexableState("b"));
+
+    assertThat(index.getLookups().getValue()).isEqualTo(2);
+    assertThat(index.getCandidates().getValueSum()).isEqualTo(1);
+  }
+}
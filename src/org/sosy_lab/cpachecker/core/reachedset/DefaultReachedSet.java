@@ -28,6 +28,7 @@ import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.waitlist.AbstractIntSortedWaitlist;
 import org.sosy_lab.cpachecker.core.waitlist.AbstractSortedWaitlist;
 import org.sosy_lab.cpachecker.core.waitlist.Waitlist;
 import org.sosy_lab.cpachecker.core.waitlist.Waitlist.WaitlistFactory;
@@ -281,6 +282,9 @@ class DefaultReachedSet implements ReachedSet, Serializable {
     if (waitlist instanceof AbstractSortedWaitlist) {
       return ImmutableMap.copyOf(((AbstractSortedWaitlist<?>) waitlist).getDelegationCounts());
 
+    } else if (waitlist instanceof AbstractIntSortedWaitlist) {
+      return ImmutableMap.copyOf(((AbstractIntSortedWaitlist) waitlist).getDelegationCounts());
+
     } else {
       return ImmutableMap.of();
     }
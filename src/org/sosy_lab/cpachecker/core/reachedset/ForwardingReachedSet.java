@@ -70,6 +70,11 @@ public class ForwardingReachedSet implements ReachedSet, StatisticsProvider {
     return delegate.getReached(pLocation);
   }
 
+  @Override
+  public Collection<AbstractState> getCoveringCandidates(AbstractState pState) {
+    return delegate.getCoveringCandidates(pState);
+  }
+
   @Override
   public AbstractState getFirstState() {
     return delegate.getFirstState();
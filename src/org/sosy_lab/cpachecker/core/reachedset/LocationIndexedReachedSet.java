@@ -0,0 +1,147 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.Maps;
+import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.Collections;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.WaitlistFactory;
+
+/**
+ * Variant of {@link LocationMappedReachedSet} that stores the partition of each location in an
+ * array indexed by the node number of the location, instead of a hash-based multimap. This avoids
+ * hashing the location for every access of a partition.
+ *
+ * <p>Node numbers are created by a global counter, so the array grows with the highest node number
+ * of a location that was reached, which is usually close to the number of nodes of the CFA.
+ */
+public class LocationIndexedReachedSet extends LocationMappedReachedSet {
+
+  private static final long serialVersionUID = 1L;
+
+  /** The partitions indexed by node number, null for locations without reached states. */
+  @SuppressFBWarnings("SE_BAD_FIELD")
+  private final List<@Nullable Set<AbstractState>> partitions = new ArrayList<>();
+
+  /** The location of each partition, with the same index as {@link #partitions}. */
+  private final List<@Nullable CFANode> locations = new ArrayList<>();
+
+  private int numberOfPartitions = 0;
+
+  public LocationIndexedReachedSet(WaitlistFactory waitlistFactory) {
+    super(waitlistFactory);
+  }
+
+  @Override
+  protected void addToPartition(Object pKey, AbstractState pState) {
+    CFANode location = (CFANode) pKey;
+    int index = location.getNodeNumber();
+    while (partitions.size() <= index) {
+      partitions.add(null);
+      locations.add(null);
+    }
+    Set<AbstractState> partition = partitions.get(index);
+    if (partition == null) {
+      partition = new LinkedHashSet<>(4);
+      partitions.set(index, partition);
+      locations.set(index, location);
+      numberOfPartitions++;
+    }
+    partition.add(pState);
+  }
+
+  @Override
+  protected void removeFromPartition(Object pKey, AbstractState pState) {
+    Set<AbstractState> partition = getPartition(pKey);
+    if (partition != null) {
+      partition.remove(pState);
+      removeIfEmpty(pKey, partition);
+    }
+  }
+
+  @Override
+  protected void removeAllFromPartition(Object pKey, Collection<AbstractState> pStates) {
+    Set<AbstractState> partition = getPartition(pKey);
+    if (partition != null) {
+      partition.removeAll(pStates);
+      removeIfEmpty(pKey, partition);
+    }
+  }
+
+  private void removeIfEmpty(Object pKey, Set<AbstractState> partition) {
+    if (partition.isEmpty()) {
+      int index = ((CFANode) pKey).getNodeNumber();
+      partitions.set(index, null);
+      locations.set(index, null);
+      numberOfPartitions--;
+    }
+  }
+
+  @Override
+  protected void clearPartitions() {
+    partitions.clear();
+    locations.clear();
+    numberOfPartitions = 0;
+  }
+
+  private @Nullable Set<AbstractState> getPartition(@Nullable Object pKey) {
+    if (!(pKey instanceof CFANode)) {
+      return null;
+    }
+    int index = ((CFANode) pKey).getNodeNumber();
+    return index < partitions.size() ? partitions.get(index) : null;
+  }
+
+  @Override
+  protected Collection<AbstractState> getReachedForKey(@Nullable Object pKey) {
+    Set<AbstractState> partition = getPartition(pKey);
+    return partition == null ? ImmutableSet.of() : Collections.unmodifiableSet(partition);
+  }
+
+  @Override
+  protected Set<?> getKeySet() {
+    ImmutableSet.Builder<CFANode> result = ImmutableSet.builderWithExpectedSize(numberOfPartitions);
+    for (CFANode location : locations) {
+      if (location != null) {
+        result.add(location);
+      }
+    }
+    return result.build();
+  }
+
+  @Override
+  public int getNumberOfPartitions() {
+    return numberOfPartitions;
+  }
+
+  @Override
+  public Map.Entry<Object, Collection<AbstractState>> getMaxPartition() {
+    int max = 0;
+    Map.Entry<Object, Collection<AbstractState>> maxPartition = null;
+    for (int i = 0; i < partitions.size(); i++) {
+      Set<AbstractState> partition = partitions.get(i);
+      if (partition != null && partition.size() > max) {
+        max = partition.size();
+        maxPartition =
+            Maps.immutableEntry(locations.get(i), Collections.unmodifiableSet(partition));
+      }
+    }
+    return maxPartition;
+  }
+}
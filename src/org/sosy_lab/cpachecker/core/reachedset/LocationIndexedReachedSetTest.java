@@ -0,0 +1,114 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionDeclaration;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.defaults.SingletonPrecision;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractStateWithLocation;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.TraversalMethod;
+
+public class LocationIndexedReachedSetTest {
+
+  private static final class StateWithLocation implements AbstractStateWithLocation {
+
+    private final CFANode location;
+
+    private StateWithLocation(CFANode pLocation) {
+      location = pLocation;
+    }
+
+    @Override
+    public CFANode getLocationNode() {
+      return location;
+    }
+
+    @Override
+    public Iterable<CFANode> getLocationNodes() {
+      return ImmutableList.of(location);
+    }
+
+    @Override
+    public Iterable<CFAEdge> getOutgoingEdges() {
+      return ImmutableList.of();
+    }
+
+    @Override
+    public Iterable<CFAEdge> getIngoingEdges() {
+      return ImmutableList.of();
+    }
+  }
+
+  private final CFANode node1 = new CFANode(CFunctionDeclaration.DUMMY);
+  private final CFANode node2 = new CFANode(CFunctionDeclaration.DUMMY);
+
+  private LocationIndexedReachedSet reached;
+
+  @Before
+  public void init() {
+    reached = new LocationIndexedReachedSet(TraversalMethod.DFS);
+  }
+
+  @Test
+  public void testEmpty() {
+    assertThat(reached.getReached(node1)).isEmpty();
+    assertThat(reached.getLocations()).isEmpty();
+    assertThat(reached.getNumberOfPartitions()).isEqualTo(0);
+  }
+
+  @Test
+  public void testPartitionsByLocation() {
+    StateWithLocation a = new StateWithLocation(node1);
+    StateWithLocation b = new StateWithLocation(node1);
+    StateWithLocation c = new StateWithLocation(node2);
+    reached.add(a, SingletonPrecision.getInstance());
+    reached.add(b, SingletonPrecision.getInstance());
+    reached.add(c, SingletonPrecision.getInstance());
+
+    assertThat(reached.getReached(node1)).containsExactly(a, b).inOrder();
+    assertThat(reached.getReached(c)).containsExactly(c);
+    assertThat(reached.getLocations()).containsExactly(node1, node2);
+    assertThat(reached.getNumberOfPartitions()).isEqualTo(2);
+    assertThat(reached.getMaxPartition().getKey()).isEqualTo(node1);
+    assertThat(reached.asCollection()).containsExactly(a, b, c).inOrder();
+  }
+
+  @Test
+  public void testRemove() {
+    StateWithLocation a = new StateWithLocation(node1);
+    StateWithLocation b = new StateWithLocation(node1);
+    StateWithLocation c = new StateWithLocation(node2);
+    reached.add(a, SingletonPrecision.getInstance());
+    reached.add(b, SingletonPrecision.getInstance());
+    reached.add(c, SingletonPrecision.getInstance());
+
+    reached.remove(a);
+    assertThat(reached.getReached(node1)).containsExactly(b);
+
+    reached.removeAll(ImmutableList.of(b, c));
+    assertThat(reached.getReached(node1)).isEmpty();
+    assertThat(reached.getReached(node2)).isEmpty();
+    assertThat(reached.getNumberOfPartitions()).isEqualTo(0);
+    assertThat(reached.isEmpty()).isTrue();
+  }
+
+  @Test
+  public void testClear() {
+    reached.add(new StateWithLocation(node2), SingletonPrecision.getInstance());
+    reached.clear();
+    assertThat(reached.getReached(node2)).isEmpty();
+    assertThat(reached.getLocations()).isEmpty();
+  }
+}
@@ -10,6 +10,7 @@ package org.sosy_lab.cpachecker.core.reachedset;
 
 import static com.google.common.base.Preconditions.checkNotNull;
 
+import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.LinkedHashMultimap;
 import com.google.common.collect.Multimap;
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
@@ -22,6 +23,7 @@ import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Partitionable;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.waitlist.Waitlist.WaitlistFactory;
+import org.sosy_lab.cpachecker.util.statistics.AbstractStatValue;
 
 /**
  * Special implementation of the reached set that partitions the set by keys that
@@ -37,6 +39,11 @@ import org.sosy_lab.cpachecker.core.waitlist.Waitlist.WaitlistFactory;
  * for merging and coverage checks), it will return a subset of the set of all
  * reached states. This subset contains exactly those states, whose partition
  * key is equal to the key of the state given as a parameter.
+ *
+ * Optionally, a {@link CoverageIndex} can be maintained for each partition,
+ * such that {@link #getCoveringCandidates(AbstractState)} returns only those states
+ * of the partition that might cover the given state
+ * (cf. {@link org.sosy_lab.cpachecker.core.interfaces.CoverageIndexable}).
  */
 public class PartitionedReachedSet extends DefaultReachedSet {
 
@@ -45,29 +52,77 @@ public class PartitionedReachedSet extends DefaultReachedSet {
   @SuppressFBWarnings("SE_BAD_FIELD")
   private final Multimap<Object, AbstractState> partitionedReached = LinkedHashMultimap.create(100, 1);
 
+  private final @Nullable CoverageIndex coverageIndex;
+
   public PartitionedReachedSet(WaitlistFactory waitlistFactory) {
+    this(waitlistFactory, false);
+  }
+
+  /**
+   * Create a partitioned reached set.
+   *
+   * @param waitlistFactory the factory for the waitlist
+   * @param useCoverageIndex whether to maintain a {@link CoverageIndex} for coverage checks
+   */
+  public PartitionedReachedSet(WaitlistFactory waitlistFactory, boolean useCoverageIndex) {
     super(waitlistFactory);
+    coverageIndex = useCoverageIndex ? new CoverageIndex() : null;
   }
 
   @Override
   public void add(AbstractState pState, Precision pPrecision) {
     super.add(pState, pPrecision);
 
-    partitionedReached.put(getPartitionKey(pState), pState);
+    Object key = getPartitionKey(pState);
+    addToPartition(key, pState);
+    if (coverageIndex != null) {
+      coverageIndex.add(key, pState);
+    }
   }
 
   @Override
   public void remove(AbstractState pState) {
     super.remove(pState);
 
-    partitionedReached.remove(getPartitionKey(pState), pState);
+    Object key = getPartitionKey(pState);
+    removeFromPartition(key, pState);
+    if (coverageIndex != null) {
+      coverageIndex.remove(key, pState);
+    }
+  }
+
+  /**
+   * Remove all given states, grouped by their partitions such that each partition is updated only
+   * once. Sub-classes that override {@link #remove(AbstractState)} need to override this method,
+   * too.
+   */
+  @Override
+  public void removeAll(Iterable<? extends AbstractState> pToRemove) {
+    Multimap<Object, AbstractState> statesByPartition = LinkedHashMultimap.create();
+    for (AbstractState state : pToRemove) {
+      super.remove(state);
+      statesByPartition.put(getPartitionKey(state), state);
+    }
+
+    for (Map.Entry<Object, Collection<AbstractState>> partition :
+        statesByPartition.asMap().entrySet()) {
+      removeAllFromPartition(partition.getKey(), partition.getValue());
+      if (coverageIndex != null) {
+        for (AbstractState state : partition.getValue()) {
+          coverageIndex.remove(partition.getKey(), state);
+        }
+      }
+    }
   }
 
   @Override
   public void clear() {
     super.clear();
 
-    partitionedReached.clear();
+    clearPartitions();
+    if (coverageIndex != null) {
+      coverageIndex.clear();
+    }
   }
 
   @Override
@@ -75,6 +130,26 @@ public class PartitionedReachedSet extends DefaultReachedSet {
     return getReachedForKey(getPartitionKey(pState));
   }
 
+  @Override
+  public Collection<AbstractState> getCoveringCandidates(AbstractState pState) {
+    if (coverageIndex == null) {
+      return getReached(pState);
+    }
+    return coverageIndex.getCoveringCandidates(getPartitionKey(pState), pState);
+  }
+
+  @Override
+  public ImmutableMap<String, AbstractStatValue> getStatistics() {
+    if (coverageIndex == null) {
+      return super.getStatistics();
+    }
+    return ImmutableMap.<String, AbstractStatValue>builder()
+        .putAll(super.getStatistics())
+        .put(coverageIndex.getLookups().getTitle(), coverageIndex.getLookups())
+        .put(coverageIndex.getCandidates().getTitle(), coverageIndex.getCandidates())
+        .build();
+  }
+
   public int getNumberOfPartitions() {
     return partitionedReached.keySet().size();
   }
@@ -93,6 +168,28 @@ public class PartitionedReachedSet extends DefaultReachedSet {
     return maxPartition;
   }
 
+  /*
+   * The following methods encapsulate how the partitions are stored. Sub-classes that use a
+   * different storage for the partitions need to override all of them together with
+   * getNumberOfPartitions(), getMaxPartition(), getReachedForKey(), and getKeySet().
+   */
+
+  protected void addToPartition(Object pKey, AbstractState pState) {
+    partitionedReached.put(pKey, pState);
+  }
+
+  protected void removeFromPartition(Object pKey, AbstractState pState) {
+    partitionedReached.remove(pKey, pState);
+  }
+
+  protected void removeAllFromPartition(Object pKey, Collection<AbstractState> pStates) {
+    partitionedReached.get(pKey).removeAll(pStates);
+  }
+
+  protected void clearPartitions() {
+    partitionedReached.clear();
+  }
+
   protected Object getPartitionKey(AbstractState pState) {
     checkNotNull(pState);
     assert pState instanceof Partitionable : "Partitionable states necessary for PartitionedReachedSet";
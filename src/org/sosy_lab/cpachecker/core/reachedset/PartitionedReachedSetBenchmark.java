@@ -0,0 +1,99 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.reachedset;
+
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Partitionable;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.waitlist.Waitlist.TraversalMethod;
+
+/**
+ * Micro benchmark for adding states to a {@link PartitionedReachedSet} and for querying the states
+ * of a partition, as done by the CPA algorithm for every successor.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(1)
+@Warmup(iterations = 3)
+@Measurement(iterations = 5)
+public class PartitionedReachedSetBenchmark {
+
+  private static final class PartitionedState implements AbstractState, Partitionable {
+
+    private final Integer partition;
+
+    private PartitionedState(int pPartition) {
+      partition = pPartition;
+    }
+
+    @Override
+    public Object getPartitionKey() {
+      return partition;
+    }
+  }
+
+  private static final Precision PRECISION = new Precision() {};
+
+  @Param({"1000", "100000"})
+  private int size;
+
+  @Param({"10", "1000"})
+  private int partitions;
+
+  private List<AbstractState> states;
+  private PartitionedReachedSet reached;
+  private AbstractState query;
+
+  @Setup(Level.Trial)
+  public void createStates() {
+    states = new ArrayList<>(size);
+    for (int i = 0; i < size; i++) {
+      states.add(new PartitionedState(i % partitions));
+    }
+    query = new PartitionedState(0);
+  }
+
+  @Setup(Level.Invocation)
+  public void createReachedSet() {
+    reached = new PartitionedReachedSet(TraversalMethod.DFS);
+  }
+
+  @Benchmark
+  public int addAll() {
+    for (AbstractState state : states) {
+      reached.add(state, PRECISION);
+    }
+    return reached.size();
+  }
+
+  @Benchmark
+  public Collection<AbstractState> addAllAndGetReached() {
+    for (AbstractState state : states) {
+      reached.add(state, PRECISION);
+    }
+    return reached.getReached(query);
+  }
+}
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.core.reachedset;
 
 import com.google.common.collect.ImmutableMap;
+import java.util.Collection;
 import java.util.Set;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
@@ -64,6 +65,19 @@ public interface ReachedSet extends UnmodifiableReachedSet {
 
   AbstractState popFromWaitlist();
 
+  /**
+   * Returns a subset of {@link #getReached(AbstractState)} that contains at least all states
+   * that might cover the given state, i.e., to which the given state might be 'lessOrEqual'. The
+   * returned collection is not necessarily a view, so it might not reflect later changes of the
+   * reached set.
+   *
+   * <p>This method is intended only for coverage checks that compare the given state with each
+   * reached state separately (such as stop-sep), it should not be used for merging.
+   */
+  default Collection<AbstractState> getCoveringCandidates(AbstractState state) {
+    return getReached(state);
+  }
+
   default ImmutableMap<String, AbstractStatValue> getStatistics() {
     return ImmutableMap.of();
   }
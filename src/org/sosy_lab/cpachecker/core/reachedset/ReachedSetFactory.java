@@ -41,7 +41,13 @@ import org.sosy_lab.cpachecker.cpa.usage.storage.UsageConfiguration;
 public class ReachedSetFactory {
 
   private enum ReachedSetType {
-    NORMAL, LOCATIONMAPPED, PARTITIONED, PSEUDOPARTITIONED, USAGE
+    NORMAL,
+    LOCATIONMAPPED,
+    LOCATIONINDEXED,
+    PARTITIONED,
+    PSEUDOPARTITIONED,
+    CONCURRENTPARTITIONED,
+    USAGE
   }
 
   @Option(
@@ -173,9 +179,13 @@ public class ReachedSetFactory {
             + "\nNORMAL: just a simple set"
             + "\nLOCATIONMAPPED: a different set per location "
             + "(faster, states with different locations cannot be merged)"
+            + "\nLOCATIONINDEXED: like LOCATIONMAPPED, but the sets are stored in an array "
+            + "indexed by node number instead of a hash map"
             + "\nPARTITIONED: partitioning depending on CPAs (e.g Location, Callstack etc.)"
             + "\nPSEUDOPARTITIONED: based on PARTITIONED, uses additional info about the states' lattice "
             + "(maybe faster for some special analyses which use merge_sep and stop_sep"
+            + "\nCONCURRENTPARTITIONED: based on PARTITIONED, but thread-safe "
+            + "(required for cpa.parallel.numberOfThreads)"
   )
   private ReachedSetType reachedSet = ReachedSetType.PARTITIONED;
 
@@ -185,6 +195,16 @@ public class ReachedSetFactory {
       description = "track more statistics about the reachedset")
   private boolean withStatistics = false;
 
+  @Option(
+      secure = true,
+      name = "reachedSet.coverageIndex",
+      description =
+          "maintain an index for coverage checks in partitioned reached sets, such that the "
+              + "stop operator only compares a new state with those states of its partition "
+              + "that might cover it (needs states that implement CoverageIndexable, "
+              + "and a stop operator that checks reached states separately, e.g., stop-sep)")
+  private boolean useCoverageIndex = false;
+
   private @Nullable BlockConfiguration blockConfig;
   private @Nullable UsageConfiguration usageConfig;
   private WeightedRandomWaitlist.@Nullable WaitlistOptions weightedWaitlistOptions;
@@ -269,14 +289,20 @@ public class ReachedSetFactory {
     ReachedSet reached;
     switch (reachedSet) {
     case PARTITIONED:
-        reached = new PartitionedReachedSet(waitlistFactory);
+        reached = new PartitionedReachedSet(waitlistFactory, useCoverageIndex);
         break;
     case PSEUDOPARTITIONED:
         reached = new PseudoPartitionedReachedSet(waitlistFactory);
         break;
+    case CONCURRENTPARTITIONED:
+        reached = new ConcurrentPartitionedReachedSet(waitlistFactory, useCoverageIndex);
+        break;
     case LOCATIONMAPPED:
         reached = new LocationMappedReachedSet(waitlistFactory);
         break;
+    case LOCATIONINDEXED:
+        reached = new LocationIndexedReachedSet(waitlistFactory);
+        break;
     case USAGE:
         reached = new UsageReachedSet(waitlistFactory, usageConfig, logger);
         break;
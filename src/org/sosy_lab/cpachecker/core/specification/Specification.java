@@ -10,17 +10,25 @@ package org.sosy_lab.cpachecker.core.specification;
 
 import static java.util.stream.Collectors.joining;
 
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableListMultimap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import com.google.common.collect.Sets;
+import com.google.common.hash.HashCode;
+import com.google.common.hash.Hashing;
+import com.google.common.io.MoreFiles;
 import java.io.IOException;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.List;
 import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.ExecutionException;
 import java.util.logging.Level;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
@@ -45,6 +53,15 @@ import org.sosy_lab.cpachecker.util.ltl.formulas.LabelledFormula;
  */
 public final class Specification {
 
+  /**
+   * Automata that were already parsed from specification files, per CFA (whose scope the C
+   * expressions in the automata refer to) and per content of the file and the configuration.
+   * Restarted and nested analyses on the same CFA thus do not parse the same files again. The CFAs
+   * are referenced weakly, such that the automata are released together with their CFA.
+   */
+  private static final Cache<CFA, ConcurrentMap<String, List<Automaton>>> parsedAutomata =
+      CacheBuilder.newBuilder().weakKeys().build();
+
   private final Set<SpecificationProperty> properties;
   private final ImmutableListMultimap<Path, Automaton> pathToSpecificationAutomata;
 
@@ -158,6 +175,19 @@ public final class Specification {
       automata = ImmutableList.of(graphmlParser.parseAutomatonFile(specFile));
 
     } else {
+      final ConcurrentMap<String, List<Automaton>> automataForCfa;
+      try {
+        automataForCfa = parsedAutomata.get(cfa, ConcurrentHashMap::new);
+      } catch (ExecutionException e) {
+        throw new AssertionError(e);
+      }
+      final String key = getParsedAutomataKey(specFile, config);
+      List<Automaton> cachedAutomata = automataForCfa.get(key);
+      if (cachedAutomata != null) {
+        logger.log(Level.FINE, "Reusing automata already parsed from", specFile);
+        return cachedAutomata;
+      }
+
       automata =
           AutomatonParser.parseAutomatonFile(
               specFile,
@@ -172,6 +202,8 @@ public final class Specification {
         throw new InvalidConfigurationException(
             "Specification file contains no automata: " + specFile);
       }
+      automata = ImmutableList.copyOf(automata);
+      automataForCfa.putIfAbsent(key, automata);
     }
 
     for (Automaton automaton : automata) {
@@ -185,6 +217,27 @@ public final class Specification {
     return automata;
   }
 
+  /**
+   * Key for the cache of parsed automata. It contains the hash of the file content in addition to
+   * its path, such that changed files are parsed again, and the complete configuration, which
+   * contains for example the options of the parser for C expressions.
+   */
+  private static String getParsedAutomataKey(Path pSpecFile, Configuration pConfig)
+      throws InvalidConfigurationException {
+    HashCode contentHash;
+    try {
+      contentHash = MoreFiles.asByteSource(pSpecFile).hash(Hashing.sha256());
+    } catch (IOException e) {
+      throw new InvalidConfigurationException(
+          "Could not load automaton from file " + e.getMessage(), e);
+    }
+    return pSpecFile.toAbsolutePath().normalize()
+        + "\n"
+        + contentHash
+        + "\n"
+        + pConfig.asPropertiesString();
+  }
+
   /**
    * Return a new specification instance that has everything that the current instance has, and
    * additionally some new specification files.
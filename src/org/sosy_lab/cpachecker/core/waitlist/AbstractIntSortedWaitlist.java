@@ -0,0 +1,247 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.waitlist;
+
+import com.google.common.base.Preconditions;
+import com.google.common.collect.FluentIterable;
+import com.google.errorprone.annotations.ForOverride;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.Map;
+import java.util.Objects;
+import java.util.StringJoiner;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.util.statistics.StatCounter;
+import org.sosy_lab.cpachecker.util.statistics.StatInt;
+import org.sosy_lab.cpachecker.util.statistics.StatKind;
+
+/**
+ * Variant of {@link AbstractSortedWaitlist} for sorting keys that are ints from a dense range,
+ * like reverse-postorder ids or callstack depths.
+ *
+ * <p>Instead of a tree map, the waitlists for the keys are stored in an array of buckets indexed
+ * by the key, which grows as necessary. Adding a state thus needs constant time and no boxing of
+ * the key, and popping a state only needs to search for the next non-empty bucket if the bucket
+ * with the highest key became empty (this search only skips empty buckets below it, so it is
+ * cheap as long as the keys are dense).
+ *
+ * <p>The iterators created by this class are unmodifiable.
+ */
+public abstract class AbstractIntSortedWaitlist implements Waitlist {
+
+  private static final int INITIAL_CAPACITY = 16;
+
+  private final WaitlistFactory wrappedWaitlist;
+
+  // buckets[i] contains the states with key i + offset, or is null if there are none
+  private Waitlist[] buckets = new Waitlist[0];
+  private int offset = 0;
+
+  // index of the highest non-empty bucket, or -1 if the waitlist is empty
+  private int highest = -1;
+
+  private int size = 0;
+
+  private final StatCounter popCount;
+  private final StatCounter delegationCount;
+  private final Map<String, StatInt> delegationCounts = new HashMap<>();
+
+  /**
+   * Constructor that needs a factory for the waitlist implementation that should be used to store
+   * states with the same sorting key.
+   */
+  protected AbstractIntSortedWaitlist(WaitlistFactory pSecondaryStrategy) {
+    wrappedWaitlist = Preconditions.checkNotNull(pSecondaryStrategy);
+    popCount = new StatCounter("Pop requests to waitlist (" + getClass().getSimpleName() + ")");
+    delegationCount =
+        new StatCounter(
+            "Pops delegated to wrapped waitlists ("
+                + wrappedWaitlist.getClass().getSimpleName()
+                + ")");
+  }
+
+  /**
+   * Method that generates the sorting key for any abstract state. States with largest key are
+   * considered first. If this method throws an exception, no guarantees about the state of the
+   * current instance of this class are made.
+   */
+  @ForOverride
+  protected abstract int getSortKey(AbstractState pState);
+
+  @Override
+  public void add(AbstractState pState) {
+    int index = ensureBucket(getSortKey(pState));
+    Waitlist localWaitlist = buckets[index];
+    if (localWaitlist == null) {
+      localWaitlist = wrappedWaitlist.createWaitlistInstance();
+      buckets[index] = localWaitlist;
+    } else {
+      assert !localWaitlist.isEmpty();
+    }
+    localWaitlist.add(pState);
+    highest = Math.max(highest, index);
+    size++;
+  }
+
+  /** Grow the bucket array such that it contains the given key, and return the index of it. */
+  private int ensureBucket(int key) {
+    if (buckets.length == 0) {
+      buckets = new Waitlist[INITIAL_CAPACITY];
+      offset = key;
+      return 0;
+    }
+    long index = (long) key - offset;
+    if (index < 0) {
+      int newLength = (int) Math.max(2L * buckets.length, buckets.length - index);
+      int shift = newLength - buckets.length;
+      Waitlist[] newBuckets = new Waitlist[newLength];
+      System.arraycopy(buckets, 0, newBuckets, shift, buckets.length);
+      buckets = newBuckets;
+      offset -= shift;
+      if (highest >= 0) {
+        highest += shift;
+      }
+    } else if (index >= buckets.length) {
+      buckets = Arrays.copyOf(buckets, (int) Math.max(2L * buckets.length, index + 1));
+    }
+    return key - offset;
+  }
+
+  private @Nullable Waitlist getBucket(int key) {
+    long index = (long) key - offset;
+    if (index < 0 || index >= buckets.length) {
+      return null;
+    }
+    return buckets[(int) index];
+  }
+
+  /** Remove the bucket at the given index and update the highest non-empty bucket. */
+  private void removeBucket(int index) {
+    buckets[index] = null;
+    while (highest >= 0 && buckets[highest] == null) {
+      highest--;
+    }
+  }
+
+  @Override
+  public boolean contains(AbstractState pState) {
+    Waitlist localWaitlist = getBucket(getSortKey(pState));
+    if (localWaitlist == null) {
+      return false;
+    }
+    assert !localWaitlist.isEmpty();
+    return localWaitlist.contains(pState);
+  }
+
+  @Override
+  public void clear() {
+    Arrays.fill(buckets, null);
+    highest = -1;
+    size = 0;
+  }
+
+  @Override
+  public boolean isEmpty() {
+    assert (highest < 0) == (size == 0);
+    return size == 0;
+  }
+
+  @Override
+  public Iterator<AbstractState> iterator() {
+    return FluentIterable.concat(
+            FluentIterable.from(Arrays.asList(buckets).subList(0, highest + 1))
+                .filter(Objects::nonNull))
+        .iterator();
+  }
+
+  @Override
+  public final AbstractState pop() {
+    popCount.inc();
+
+    Waitlist localWaitlist = buckets[highest];
+    assert !localWaitlist.isEmpty();
+    AbstractState result = localWaitlist.pop();
+    if (localWaitlist.isEmpty()) {
+      removeBucket(highest);
+      addStatistics(localWaitlist);
+    } else {
+      delegationCount.inc();
+    }
+    size--;
+    return result;
+  }
+
+  private void addStatistics(Waitlist pWaitlist) {
+    Map<String, StatInt> delegCount;
+    if (pWaitlist instanceof AbstractSortedWaitlist) {
+      delegCount = ((AbstractSortedWaitlist<?>) pWaitlist).getDelegationCounts();
+    } else if (pWaitlist instanceof AbstractIntSortedWaitlist) {
+      delegCount = ((AbstractIntSortedWaitlist) pWaitlist).getDelegationCounts();
+    } else {
+      return;
+    }
+    for (Map.Entry<String, StatInt> e : delegCount.entrySet()) {
+      String key = e.getKey();
+      if (!delegationCounts.containsKey(key)) {
+        delegationCounts.put(key, e.getValue());
+      } else {
+        delegationCounts.get(key).add(e.getValue());
+      }
+    }
+  }
+
+  /**
+   * Returns a map of delegation counts for this waitlist and all waitlists delegated to. The keys
+   * of the returned Map are the names of the waitlists, the values are the existing delegations.
+   */
+  public Map<String, StatInt> getDelegationCounts() {
+    String waitlistName = this.getClass().getSimpleName();
+    StatInt directDelegations = new StatInt(StatKind.AVG, waitlistName);
+    assert delegationCount.getValue() <= Integer.MAX_VALUE;
+    directDelegations.setNextValue((int) delegationCount.getValue());
+    delegationCounts.put(waitlistName, directDelegations);
+    return delegationCounts;
+  }
+
+  @Override
+  public boolean remove(AbstractState pState) {
+    int key = getSortKey(pState);
+    Waitlist localWaitlist = getBucket(key);
+    if (localWaitlist == null) {
+      return false;
+    }
+    assert !localWaitlist.isEmpty();
+    boolean result = localWaitlist.remove(pState);
+    if (result) {
+      if (localWaitlist.isEmpty()) {
+        removeBucket(key - offset);
+      }
+      size--;
+    }
+    return result;
+  }
+
+  @Override
+  public int size() {
+    return size;
+  }
+
+  @Override
+  public String toString() {
+    StringJoiner result = new StringJoiner(", ", "{", "}");
+    for (int i = 0; i <= highest; i++) {
+      if (buckets[i] != null) {
+        result.add((i + offset) + "=" + buckets[i]);
+      }
+    }
+    return result.toString();
+  }
+}
@@ -33,6 +33,8 @@ import org.sosy_lab.cpachecker.util.statistics.StatKind;
  * constructor.
  *
  * The iterators created by this class are unmodifiable.
+ *
+ * For keys that are ints from a dense range, {@link AbstractIntSortedWaitlist} is more efficient.
  */
 public abstract class AbstractSortedWaitlist<K extends Comparable<K>> implements Waitlist {
 
@@ -130,18 +132,22 @@ public abstract class AbstractSortedWaitlist<K extends Comparable<K>> implements
   }
 
   private void addStatistics(Waitlist pWaitlist) {
+    Map<String, StatInt> delegCount;
     if (pWaitlist instanceof AbstractSortedWaitlist) {
-      Map<String, StatInt> delegCount =
-          ((AbstractSortedWaitlist<?>) pWaitlist).getDelegationCounts();
+      delegCount = ((AbstractSortedWaitlist<?>) pWaitlist).getDelegationCounts();
+    } else if (pWaitlist instanceof AbstractIntSortedWaitlist) {
+      delegCount = ((AbstractIntSortedWaitlist) pWaitlist).getDelegationCounts();
+    } else {
+      return;
+    }
 
-      for (Entry<String, StatInt> e : delegCount.entrySet()) {
-        String key = e.getKey();
-        if (!delegationCounts.containsKey(key)) {
-          delegationCounts.put(key, e.getValue());
+    for (Entry<String, StatInt> e : delegCount.entrySet()) {
+      String key = e.getKey();
+      if (!delegationCounts.containsKey(key)) {
+        delegationCounts.put(key, e.getValue());
 
-        } else {
-          delegationCounts.get(key).add(e.getValue());
-        }
+      } else {
+        delegationCounts.get(key).add(e.getValue());
       }
     }
   }
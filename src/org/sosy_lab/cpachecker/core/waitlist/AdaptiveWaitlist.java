@@ -0,0 +1,149 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.core.waitlist;
+
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.Map;
+import java.util.NavigableMap;
+import java.util.Set;
+import java.util.TreeMap;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+
+/**
+ * Waitlist that chooses between depth-first and breadth-first order anew for every pop(), using
+ * the UCB1 strategy for multi-armed bandits. The reward of an order is the fraction of successors
+ * of the states it selected that reach a location for the first time, i.e., orders that produce
+ * new coverage are preferred, and the other order is still tried now and then.
+ *
+ * <p>The successors of a state are all states that are added between its pop() and the next one,
+ * which is how {@link org.sosy_lab.cpachecker.core.algorithm.CPAAlgorithm} uses the waitlist.
+ */
+public class AdaptiveWaitlist implements Waitlist {
+
+  private static final int DFS = 0;
+  private static final int BFS = 1;
+  private static final int NUMBER_OF_ORDERS = 2;
+
+  // all states ordered by the time they were added, such that both orders can pop in O(log n)
+  private final NavigableMap<Long, AbstractState> statesByAge = new TreeMap<>();
+  private final Map<AbstractState, Long> ageOfState = new HashMap<>();
+  private long nextAge = 0;
+
+  private final Set<CFANode> visitedLocations = new HashSet<>();
+
+  private final int[] pulls = new int[NUMBER_OF_ORDERS];
+  private final double[] rewards = new double[NUMBER_OF_ORDERS];
+  private int totalPulls = 0;
+
+  private int currentOrder = -1;
+  private int successorsOfCurrent = 0;
+  private int novelSuccessorsOfCurrent = 0;
+
+  protected AdaptiveWaitlist() {}
+
+  @Override
+  public Iterator<AbstractState> iterator() {
+    return Collections.unmodifiableCollection(statesByAge.values()).iterator();
+  }
+
+  @Override
+  public void add(AbstractState pState) {
+    if (ageOfState.containsKey(pState)) {
+      return;
+    }
+    long age = nextAge++;
+    statesByAge.put(age, pState);
+    ageOfState.put(pState, age);
+
+    successorsOfCurrent++;
+    CFANode location = AbstractStates.extractLocation(pState);
+    if (location != null && visitedLocations.add(location)) {
+      novelSuccessorsOfCurrent++;
+    }
+  }
+
+  @Override
+  public boolean contains(AbstractState pState) {
+    return ageOfState.containsKey(pState);
+  }
+
+  @Override
+  public boolean remove(AbstractState pState) {
+    Long age = ageOfState.remove(pState);
+    if (age == null) {
+      return false;
+    }
+    statesByAge.remove(age);
+    return true;
+  }
+
+  @Override
+  public AbstractState pop() {
+    rewardCurrentOrder();
+    currentOrder = chooseOrder();
+    pulls[currentOrder]++;
+    totalPulls++;
+
+    Map.Entry<Long, AbstractState> entry =
+        currentOrder == DFS ? statesByAge.pollLastEntry() : statesByAge.pollFirstEntry();
+    ageOfState.remove(entry.getValue());
+    return entry.getValue();
+  }
+
+  private void rewardCurrentOrder() {
+    if (currentOrder >= 0 && successorsOfCurrent > 0) {
+      rewards[currentOrder] += (double) novelSuccessorsOfCurrent / successorsOfCurrent;
+    }
+    successorsOfCurrent = 0;
+    novelSuccessorsOfCurrent = 0;
+  }
+
+  /** UCB1: try each order once, then pick the best upper confidence bound of the reward. */
+  private int chooseOrder() {
+    int best = 0;
+    double bestBound = Double.NEGATIVE_INFINITY;
+    for (int order = 0; order < NUMBER_OF_ORDERS; order++) {
+      if (pulls[order] == 0) {
+        return order;
+      }
+      double bound =
+          rewards[order] / pulls[order] + Math.sqrt(2 * Math.log(totalPulls) / pulls[order]);
+      if (bound > bestBound) {
+        bestBound = bound;
+        best = order;
+      }
+    }
+    return best;
+  }
+
+  @Override
+  public int size() {
+    return statesByAge.size();
+  }
+
+  @Override
+  public boolean isEmpty() {
+    return statesByAge.isEmpty();
+  }
+
+  @Override
+  public void clear() {
+    statesByAge.clear();
+    ageOfState.clear();
+    visitedLocations.clear();
+    currentOrder = -1;
+    successorsOfCurrent = 0;
+    novelSuccessorsOfCurrent = 0;
+  }
+}
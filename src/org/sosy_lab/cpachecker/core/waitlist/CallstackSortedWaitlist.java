@@ -18,14 +18,14 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
  * A secondary strategy needs to be given that decides what to do with states
  * of the same callstack depth.
  */
-public class CallstackSortedWaitlist extends AbstractSortedWaitlist<Integer> {
+public class CallstackSortedWaitlist extends AbstractIntSortedWaitlist {
 
   protected CallstackSortedWaitlist(WaitlistFactory pSecondaryStrategy) {
     super(pSecondaryStrategy);
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     CallstackState callstackState =
       AbstractStates.extractStateByType(pState, CallstackState.class);
 
@@ -19,14 +19,14 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
  * This states are expected to cover a bigger part of the state space,
  * so states with more variables will probably be covered later.
  */
-public class ExplicitSortedWaitlist extends AbstractSortedWaitlist<Integer> {
+public class ExplicitSortedWaitlist extends AbstractIntSortedWaitlist {
 
   protected ExplicitSortedWaitlist(WaitlistFactory pSecondaryStrategy) {
     super(pSecondaryStrategy);
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     ValueAnalysisState explicitState =
       AbstractStates.extractStateByType(pState, ValueAnalysisState.class);
 
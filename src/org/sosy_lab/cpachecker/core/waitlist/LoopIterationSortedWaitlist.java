@@ -17,7 +17,7 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
  * States with a more/less (depending on the used factory method) loop iterations are considered
  * first.
  */
-public class LoopIterationSortedWaitlist extends AbstractSortedWaitlist<Integer> {
+public class LoopIterationSortedWaitlist extends AbstractIntSortedWaitlist {
   private final int multiplier;
 
   private LoopIterationSortedWaitlist(WaitlistFactory pSecondaryStrategy,
@@ -27,7 +27,7 @@ public class LoopIterationSortedWaitlist extends AbstractSortedWaitlist<Integer>
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     LoopBoundState loopBoundState = AbstractStates.extractStateByType(pState, LoopBoundState.class);
     return (loopBoundState != null)
         ? (multiplier * loopBoundState.getMaxNumberOfIterationsInLoopstackFrame())
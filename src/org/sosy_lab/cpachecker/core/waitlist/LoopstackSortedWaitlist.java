@@ -18,7 +18,7 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
  * States with a larger/smaller (depending on the used factory method)
  * loopstack are considered first.
  */
-public class LoopstackSortedWaitlist extends AbstractSortedWaitlist<Integer>{
+public class LoopstackSortedWaitlist extends AbstractIntSortedWaitlist {
   private final int multiplier;
 
   private LoopstackSortedWaitlist(WaitlistFactory pSecondaryStrategy,
@@ -28,7 +28,7 @@ public class LoopstackSortedWaitlist extends AbstractSortedWaitlist<Integer>{
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     LoopBoundState loopstackState = AbstractStates.extractStateByType(pState, LoopBoundState.class);
     return (loopstackState != null) ? (multiplier * loopstackState.getDepth()) : 0;
   }
@@ -11,7 +11,7 @@ package org.sosy_lab.cpachecker.core.waitlist;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 
-public class PostorderSortedWaitlist extends AbstractSortedWaitlist<Integer> {
+public class PostorderSortedWaitlist extends AbstractIntSortedWaitlist {
 
   protected PostorderSortedWaitlist(WaitlistFactory pSecondaryStrategy) {
     super(pSecondaryStrategy);
@@ -24,7 +24,7 @@ public class PostorderSortedWaitlist extends AbstractSortedWaitlist<Integer> {
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     return 0 - AbstractStates.extractLocation(pState).getReversePostorderId();
   }
 
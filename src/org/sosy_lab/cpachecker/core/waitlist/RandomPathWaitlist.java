@@ -62,11 +62,12 @@ public class RandomPathWaitlist extends AbstractWaitlist<LinkedList<AbstractStat
   public AbstractState pop() {
     AbstractState state;
     if (waitlist.size() < 2 || successorsOfParent < 2) {
-      state = waitlist.getLast();
+      state = waitlist.removeLast();
     } else {
       // successorsOnLevelCount >= 2
-      int r = rand.nextInt(successorsOfParent) + 1;
-      state = waitlist.get(waitlist.size() - r);
+      // the chosen state is close to the end, which LinkedList reaches without traversing the list
+      int r = rand.nextInt(Math.min(successorsOfParent, waitlist.size())) + 1;
+      state = waitlist.remove(waitlist.size() - r);
     }
     if (successorsOfParent > 0) {
       successorsOfParent--;
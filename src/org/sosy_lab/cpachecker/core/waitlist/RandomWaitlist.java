@@ -9,7 +9,7 @@
 package org.sosy_lab.cpachecker.core.waitlist;
 
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
-import java.util.LinkedList;
+import java.util.ArrayList;
 import java.util.Random;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 
@@ -17,20 +17,26 @@ import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 @SuppressFBWarnings(
     value = "BC_BAD_CAST_TO_CONCRETE_COLLECTION",
     justification = "warnings is only because of casts introduced by generics")
-@SuppressWarnings({"checkstyle:IllegalType", "JdkObsolete"})
-public class RandomWaitlist extends AbstractWaitlist<LinkedList<AbstractState>> {
+@SuppressWarnings("checkstyle:IllegalType")
+public class RandomWaitlist extends AbstractWaitlist<ArrayList<AbstractState>> {
 
   private static final long serialVersionUID = 1L;
 
   private final Random rand = new Random(0);
 
   protected RandomWaitlist() {
-    super(new LinkedList<>());
+    super(new ArrayList<>());
   }
 
   @Override
   public AbstractState pop() {
+    // the order of the list is irrelevant, so move the last state to the chosen position
+    // instead of shifting all following states
     int r = rand.nextInt(waitlist.size());
-    return waitlist.remove(r);
+    AbstractState last = waitlist.remove(waitlist.size() - 1);
+    if (r == waitlist.size()) {
+      return last;
+    }
+    return waitlist.set(r, last);
   }
 }
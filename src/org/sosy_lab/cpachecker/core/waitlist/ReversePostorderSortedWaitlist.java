@@ -11,7 +11,7 @@ package org.sosy_lab.cpachecker.core.waitlist;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 
-public class ReversePostorderSortedWaitlist extends AbstractSortedWaitlist<Integer> {
+public class ReversePostorderSortedWaitlist extends AbstractIntSortedWaitlist {
 
   protected ReversePostorderSortedWaitlist(WaitlistFactory pSecondaryStrategy) {
     super(pSecondaryStrategy);
@@ -24,7 +24,7 @@ public class ReversePostorderSortedWaitlist extends AbstractSortedWaitlist<Integ
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     return AbstractStates.extractLocation(pState).getReversePostorderId();
   }
 
@@ -17,14 +17,14 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
  * on the number of SMG-objects (if there are any).
  * States with fewer objects are considered first.
  */
-public class SMGSortedWaitlist extends AbstractSortedWaitlist<Integer> {
+public class SMGSortedWaitlist extends AbstractIntSortedWaitlist {
 
   protected SMGSortedWaitlist(WaitlistFactory pSecondaryStrategy) {
     super(pSecondaryStrategy);
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     SMGState state = AbstractStates.extractStateByType(pState, SMGState.class);
 
     // negate size so that the highest key corresponds to the smallest map
@@ -19,14 +19,14 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
  * These states are expected to avoid state explosion,
  * as they have fewer successors due to the interleaving of threads.
  */
-public class ThreadingSortedWaitlist extends AbstractSortedWaitlist<Integer> {
+public class ThreadingSortedWaitlist extends AbstractIntSortedWaitlist {
 
   protected ThreadingSortedWaitlist(WaitlistFactory pSecondaryStrategy) {
     super(pSecondaryStrategy);
   }
 
   @Override
-  protected Integer getSortKey(AbstractState pState) {
+  protected int getSortKey(AbstractState pState) {
     ThreadingState state =
       AbstractStates.extractStateByType(pState, ThreadingState.class);
 
@@ -96,6 +96,12 @@ public interface Waitlist extends Iterable<AbstractState> {
       public Waitlist createWaitlistInstance() {
         return new RoundRobinWaitlist();
       }
+    },
+    ADAPTIVE {
+      @Override
+      public Waitlist createWaitlistInstance() {
+        return new AdaptiveWaitlist();
+      }
     }
   }
 }
@@ -9,18 +9,18 @@
 package org.sosy_lab.cpachecker.core.waitlist;
 
 import com.google.common.base.Preconditions;
+import java.util.ArrayList;
+import java.util.Collections;
 import java.util.Comparator;
 import java.util.Iterator;
+import java.util.List;
 import java.util.NoSuchElementException;
 import java.util.Random;
-import java.util.TreeMap;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
-import org.sosy_lab.cpachecker.util.OrderStatisticMap;
-import org.sosy_lab.cpachecker.util.OrderStatisticMap.OrderStatisticsMapProxy;
 
 public class WeightedRandomWaitlist implements Waitlist {
 
@@ -48,7 +48,17 @@ public class WeightedRandomWaitlist implements Waitlist {
   }
 
   private final double exponent;
-  private OrderStatisticMap<AbstractState, Waitlist> states;
+
+  /**
+   * One representative state per class of equal states (w.r.t. the comparator), in ascending
+   * order, such that classes can be found by binary search and selected by their rank in constant
+   * time. The waitlist of the states of each class is stored at the same index in {@link
+   * #waitlists}.
+   */
+  private final List<AbstractState> keys = new ArrayList<>();
+
+  private final List<Waitlist> waitlists = new ArrayList<>();
+  private int size = 0;
   private WaitlistFactory waitlistFactory;
   private Comparator<AbstractState> comparator;
   private Random random;
@@ -58,33 +68,40 @@ public class WeightedRandomWaitlist implements Waitlist {
     exponent = pConfig.exponent;
     random = new Random(pConfig.seed);
     comparator = pComparator;
-    states = new OrderStatisticsMapProxy<>(new TreeMap<>(comparator));
 
     waitlistFactory = pFactory;
   }
 
   @Override
   public void add(AbstractState state) {
-    if (!states.containsKey(state)) {
-      states.put(state, waitlistFactory.createWaitlistInstance());
+    int idx = Collections.binarySearch(keys, state, comparator);
+    if (idx < 0) {
+      idx = -idx - 1;
+      keys.add(idx, state);
+      waitlists.add(idx, waitlistFactory.createWaitlistInstance());
     }
-    Waitlist w = states.get(state);
+    Waitlist w = waitlists.get(idx);
+    int oldSize = w.size();
     w.add(state);
+    size += w.size() - oldSize;
   }
 
   @Override
   public void clear() {
-    states.clear();
+    keys.clear();
+    waitlists.clear();
+    size = 0;
   }
 
   @Override
   public boolean contains(AbstractState state) {
-    return states.containsKey(state) && states.get(state).contains(state);
+    int idx = Collections.binarySearch(keys, state, comparator);
+    return idx >= 0 && waitlists.get(idx).contains(state);
   }
 
   @Override
   public boolean isEmpty() {
-    return states.isEmpty();
+    return keys.isEmpty();
   }
 
   /**
@@ -94,7 +111,7 @@ public class WeightedRandomWaitlist implements Waitlist {
   private int getRandomIndex() {
     double r = random.nextDouble();
     double x = Math.pow(r, exponent);
-    int s = states.size() - 1;
+    int s = keys.size() - 1;
     return ((int) Math.round(s * x));
   }
 
@@ -102,22 +119,27 @@ public class WeightedRandomWaitlist implements Waitlist {
   public AbstractState pop() {
     assert size() > 0;
     int idx = getRandomIndex();
-    Preconditions.checkElementIndex(idx, states.size());
-    Waitlist chosenWaitlist = states.getEntryByRank(idx).getValue();
+    Preconditions.checkElementIndex(idx, keys.size());
+    Waitlist chosenWaitlist = waitlists.get(idx);
     AbstractState poppedState = chosenWaitlist.pop();
+    size--;
     if (chosenWaitlist.isEmpty()) {
-      states.removeByRank(idx);
+      removeClass(idx);
     }
     return poppedState;
   }
 
   @Override
   public boolean remove(AbstractState state) {
-    if (states.containsKey(state)) {
-      Waitlist containingWaitlist = states.get(state);
+    int idx = Collections.binarySearch(keys, state, comparator);
+    if (idx >= 0) {
+      Waitlist containingWaitlist = waitlists.get(idx);
       boolean removed = containingWaitlist.remove(state);
+      if (removed) {
+        size--;
+      }
       if (containingWaitlist.isEmpty()) {
-        states.remove(state);
+        removeClass(idx);
       }
       return removed;
     }
@@ -126,18 +148,19 @@ public class WeightedRandomWaitlist implements Waitlist {
     }
   }
 
+  private void removeClass(int idx) {
+    keys.remove(idx);
+    waitlists.remove(idx);
+  }
+
   @Override
   public int size() {
-    int sum = 0;
-    for (Waitlist w : states.values()) {
-      sum += w.size();
-    }
-    return sum;
+    return size;
   }
 
   @Override
   public Iterator<AbstractState> iterator() {
-    if(states.isEmpty()) {
+    if(keys.isEmpty()) {
       return new Iterator<>() {
 
         @Override
@@ -153,9 +176,9 @@ public class WeightedRandomWaitlist implements Waitlist {
     }
     return new Iterator<>() {
 
-      private Iterator<AbstractState> currIt = states.firstEntry().getValue().iterator();
+      private Iterator<AbstractState> currIt = waitlists.get(0).iterator();
       private int currRank = 0;
-      private int maxRank = states.size() - 1;
+      private int maxRank = waitlists.size() - 1;
 
       @Override
       public boolean hasNext() {
@@ -166,7 +189,7 @@ public class WeightedRandomWaitlist implements Waitlist {
       public AbstractState next() {
         if (!currIt.hasNext()) {
           currRank++;
-          currIt = states.getEntryByRank(currRank).getValue().iterator();
+          currIt = waitlists.get(currRank).iterator();
         }
         return currIt.next();
       }
@@ -174,6 +197,7 @@ public class WeightedRandomWaitlist implements Waitlist {
       @Override
       public void remove() {
         currIt.remove();
+        size--;
       }
     };
   }
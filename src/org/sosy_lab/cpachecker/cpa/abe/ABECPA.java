@@ -81,7 +81,7 @@ public final class ABECPA
         AnalysisDirection.FORWARD);
 
     if (useCachingPathFormulaManager) {
-      pathFormulaManager = new CachingPathFormulaManager(pathFormulaManager);
+      pathFormulaManager = new CachingPathFormulaManager(pathFormulaManager, pConfiguration);
     }
     manager = new ABEWrappingManager<>(clientManager, pathFormulaManager,
         formulaManager, pCFA, pLogger, pSolver, pConfiguration);
@@ -28,6 +28,7 @@ import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -56,6 +57,7 @@ import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 import org.sosy_lab.cpachecker.util.ApronManager;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
 
 @Options(prefix = "cpa.apron")
 public final class ApronCPA
@@ -77,6 +79,14 @@ public final class ApronCPA
       description="Use this to change the underlying abstract domain in the APRON library")
   private ApronManager.AbstractDomain domainType = ApronManager.AbstractDomain.OCTAGON;
 
+  @Option(
+      secure = true,
+      description =
+          "maximal number of results of isLessOrEqual and join, respectively, that are cached"
+              + " per pair of states (0 disables caching)")
+  @IntegerOption(min = 0)
+  private int resultCacheSize = 10000;
+
   @Option(secure=true, description="get an initial precision from file")
   @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
   private Path initialPrecisionFile = null;
@@ -95,6 +105,7 @@ public final class ApronCPA
   private final ShutdownNotifier shutdownNotifier;
   private final CFA cfa;
   private final ApronManager apronManager;
+  private final ApronDomain apronDomain;
 
   private ApronCPA(Configuration config, LogManager log,
                      ShutdownNotifier shutdownNotifier, CFA cfa)
@@ -104,7 +115,7 @@ public final class ApronCPA
     }
     config.inject(this);
     logger = log;
-    ApronDomain apronDomain = new ApronDomain(logger);
+    apronDomain = new ApronDomain(logger, resultCacheSize);
 
     apronManager = new ApronManager(domainType);
 
@@ -199,7 +210,9 @@ public final class ApronCPA
         if (precisionFile != null) {
           exportPrecision(pReached);
         }
-
+        StatisticsWriter.writingStatisticsTo(pOut)
+            .put(apronDomain.lessOrEqualCacheHits)
+            .put(apronDomain.joinCacheHits);
       }
 
       @Override
@@ -10,43 +10,121 @@ package org.sosy_lab.cpachecker.cpa.apron;
 
 import apron.Abstract0;
 import apron.ApronException;
-import java.util.HashMap;
-import java.util.Map;
-import java.util.Set;
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractDomain;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.statistics.StatCounter;
 
 class ApronDomain implements AbstractDomain {
 
   private final LogManager logger;
 
-  public ApronDomain(LogManager log) {
+  /**
+   * Results of isLessOrEqual and join for pairs of states, which are compared again in each
+   * iteration of a loop. The keys use the identity of the states, which are immutable, so we never
+   * need the (native) equality check. The caches are null if caching is disabled.
+   */
+  private final @Nullable Cache<StatePair, Boolean> lessOrEqualCache;
+
+  private final @Nullable Cache<StatePair, AbstractState> joinCache;
+
+  final StatCounter lessOrEqualCacheHits = new StatCounter("Number of cached leq results");
+  final StatCounter joinCacheHits = new StatCounter("Number of cached join results");
+
+  public ApronDomain(LogManager log, int pCacheSize) {
     logger = log;
+    if (pCacheSize > 0) {
+      lessOrEqualCache = CacheBuilder.newBuilder().maximumSize(pCacheSize).build();
+      joinCache = CacheBuilder.newBuilder().maximumSize(pCacheSize).build();
+    } else {
+      lessOrEqualCache = null;
+      joinCache = null;
+    }
   }
 
-  @Override
-  public boolean isLessOrEqual(AbstractState element1, AbstractState element2) {
+  /** Pair of states with identity semantics. */
+  private static final class StatePair {
+    private final ApronState first;
+    private final ApronState second;
 
-    Map<ApronState, Set<ApronState>> covers = new HashMap<>();
+    private StatePair(ApronState pFirst, ApronState pSecond) {
+      first = pFirst;
+      second = pSecond;
+    }
+
+    @Override
+    public boolean equals(Object pObj) {
+      if (!(pObj instanceof StatePair)) {
+        return false;
+      }
+      StatePair other = (StatePair) pObj;
+      return first == other.first && second == other.second;
+    }
+
+    @Override
+    public int hashCode() {
+      return 31 * System.identityHashCode(first) + System.identityHashCode(second);
+    }
+  }
 
+  @Override
+  public boolean isLessOrEqual(AbstractState element1, AbstractState element2) {
     ApronState apronState1 = (ApronState) element1;
     ApronState apronState2 = (ApronState) element2;
 
-    if (covers.containsKey(apronState2) && covers.get(apronState2).contains(apronState1)) {
+    if (apronState1 == apronState2) {
       return true;
     }
+    if (!apronState1.mayBeLessOrEqual(apronState2)) {
+      return false;
+    }
 
+    StatePair key = new StatePair(apronState1, apronState2);
+    if (lessOrEqualCache != null) {
+      Boolean cached = lessOrEqualCache.getIfPresent(key);
+      if (cached != null) {
+        lessOrEqualCacheHits.inc();
+        return cached;
+      }
+    }
+
+    boolean result;
     try {
-      return apronState1.isLessOrEquals(apronState2);
+      result = apronState1.isLessOrEquals(apronState2);
     } catch (ApronException e) {
       throw new RuntimeException("An error occured while operating with the apron library", e);
     }
+    if (lessOrEqualCache != null) {
+      lessOrEqualCache.put(key, result);
+    }
+    return result;
   }
 
   @Override
   public AbstractState join(AbstractState successor, AbstractState reached) {
+    if (successor == reached) {
+      return reached;
+    }
+    StatePair key = new StatePair((ApronState) successor, (ApronState) reached);
+    if (joinCache != null) {
+      AbstractState cached = joinCache.getIfPresent(key);
+      if (cached != null) {
+        joinCacheHits.inc();
+        return cached;
+      }
+    }
+    AbstractState result = join0(successor, reached);
+    if (joinCache != null) {
+      joinCache.put(key, result);
+    }
+    return result;
+  }
+
+  private AbstractState join0(AbstractState successor, AbstractState reached) {
     Pair<ApronState, ApronState> shrinkedStates;
     Abstract0 newApronState;
     ApronState firstState;
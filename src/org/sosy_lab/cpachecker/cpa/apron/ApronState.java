@@ -133,12 +133,25 @@ logger.log(Level.FINEST, "apron state: isEqual");
     return result;
   }
 
+  /**
+   * Cheap check without calling the Apron library. If this returns false, {@link
+   * #isLessOrEquals(ApronState)} returns false, too, because this state does not track all
+   * variables of the other state.
+   */
+  boolean mayBeLessOrEqual(ApronState state) {
+    return integerToIndexMap.size() >= state.integerToIndexMap.size()
+        && realToIndexMap.size() >= state.realToIndexMap.size();
+  }
+
   protected boolean isLessOrEquals(ApronState state) {
     assert !isEmpty() : "Empty states should not occur here!";
     // TODO loopstack
 
     if (Objects.equals(integerToIndexMap, state.integerToIndexMap)
         && Objects.equals(realToIndexMap, state.realToIndexMap)) {
+      if (apronState == state.apronState) {
+        return true;
+      }
       logger.log(Level.FINEST, "apron state: isIncluded");
       return apronState.isIncluded(apronManager.getManager(), state.apronState);
     } else {
@@ -0,0 +1,203 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.arg;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.cpa.arg.path.ARGPath;
+
+/**
+ * A snapshot of the parent relation of an ARG, stored in primitive arrays indexed by the position
+ * of each state in the id-sorted list of all indexed states.
+ *
+ * <p>Building the index costs one pass over the ARG, afterwards each path extraction only walks
+ * integer arrays and needs neither recursion nor hash-based collections. This pays off if many
+ * paths are extracted from the same ARG, e.g., for all target states of one refinement. The index
+ * does not track later changes of the ARG, so it needs to be recreated after the ARG was modified
+ * (cf. {@link ARGReachedSet#getParentIndex()}). If the index detects that it is outdated for a
+ * query (a destroyed state or a parent that was not indexed), it falls back to the respective
+ * method in {@link ARGUtils}.
+ *
+ * <p>Instances are not thread-safe.
+ */
+public final class ARGParentIndex {
+
+  private static final int NOT_INDEXED = -1;
+
+  /** All indexed states, sorted by their state id. */
+  private final ARGState[] states;
+
+  /** The state ids of {@link #states}, for binary search. */
+  private final int[] stateIds;
+
+  /**
+   * The parents of the state at position i are stored at positions parentStart[i] (inclusive) to
+   * parentStart[i+1] (exclusive) of {@link #parents}, in the order of {@link
+   * ARGState#getParents()}.
+   */
+  private final int[] parentStart;
+
+  private final int[] parents;
+
+  /** Marks for visited states, a state is visited in the current query iff its mark is stamp. */
+  private final int[] marks;
+
+  private int stamp = 0;
+  private int[] stack = new int[16];
+
+  private ARGParentIndex(ARGState[] pStates) {
+    states = pStates;
+    int size = states.length;
+    stateIds = new int[size];
+    for (int i = 0; i < size; i++) {
+      stateIds[i] = states[i].getStateId();
+    }
+
+    parentStart = new int[size + 1];
+    int parentCount = 0;
+    for (int i = 0; i < size; i++) {
+      parentStart[i] = parentCount;
+      parentCount += states[i].getParents().size();
+    }
+    parentStart[size] = parentCount;
+
+    parents = new int[parentCount];
+    for (int i = 0; i < size; i++) {
+      int pos = parentStart[i];
+      for (ARGState parent : states[i].getParents()) {
+        parents[pos++] = indexOf(parent);
+      }
+    }
+    marks = new int[size];
+  }
+
+  /**
+   * Create an index of the parent relation of the given states. All parents of the given states
+   * should be given as well, otherwise queries that reach the missing parents fall back to {@link
+   * ARGUtils}.
+   */
+  public static ARGParentIndex create(Iterable<? extends AbstractState> pStates) {
+    List<ARGState> argStates = new ArrayList<>();
+    for (AbstractState state : pStates) {
+      argStates.add((ARGState) state);
+    }
+    ARGState[] sorted = argStates.toArray(new ARGState[0]);
+    Arrays.sort(sorted);
+    return new ARGParentIndex(sorted);
+  }
+
+  public int size() {
+    return states.length;
+  }
+
+  private int indexOf(ARGState pState) {
+    int pos = Arrays.binarySearch(stateIds, pState.getStateId());
+    return pos >= 0 ? pos : NOT_INDEXED;
+  }
+
+  private void newQuery() {
+    stamp++;
+    if (stamp == 0) {
+      // overflow after 2^32 queries, reset all marks
+      Arrays.fill(marks, 0);
+      stamp = 1;
+    }
+  }
+
+  private void push(int pStackSize, int pValue) {
+    if (pStackSize == stack.length) {
+      stack = Arrays.copyOf(stack, 2 * stack.length);
+    }
+    stack[pStackSize] = pValue;
+  }
+
+  /**
+   * Equivalent to {@link ARGUtils#getOnePathTo(ARGState)}: follows the first parent of each state
+   * until a state without parents is reached.
+   */
+  public ARGPath getOnePathTo(ARGState pLastElement) {
+    checkNotNull(pLastElement);
+    int current = indexOf(pLastElement);
+    if (current == NOT_INDEXED) {
+      return ARGUtils.getOnePathTo(pLastElement);
+    }
+
+    newQuery();
+    int length = 0;
+    while (true) {
+      if (marks[current] == stamp || states[current].isDestroyed()) {
+        // cycle (needs backtracking) or outdated index
+        return ARGUtils.getOnePathTo(pLastElement);
+      }
+      marks[current] = stamp;
+      push(length++, current);
+
+      if (parentStart[current] == parentStart[current + 1]) {
+        break;
+      }
+      current = parents[parentStart[current]];
+      if (current == NOT_INDEXED) {
+        return ARGUtils.getOnePathTo(pLastElement);
+      }
+    }
+
+    ImmutableList.Builder<ARGState> path = ImmutableList.builderWithExpectedSize(length);
+    for (int i = length - 1; i >= 0; i--) {
+      path.add(states[stack[i]]);
+    }
+    return new ARGPath(path.build());
+  }
+
+  /**
+   * Equivalent to {@link ARGUtils#getAllStatesOnPathsTo(ARGState)}: returns all states that have
+   * the given state as (transitive) child, including the given state itself, in depth-first
+   * pre-order.
+   */
+  public ImmutableSet<ARGState> getAllStatesOnPathsTo(ARGState pLastElement) {
+    checkNotNull(pLastElement);
+    int start = indexOf(pLastElement);
+    if (start == NOT_INDEXED) {
+      return ARGUtils.getAllStatesOnPathsTo(pLastElement);
+    }
+
+    newQuery();
+    ImmutableSet.Builder<ARGState> result = ImmutableSet.builder();
+    int stackSize = 0;
+    push(stackSize++, start);
+    while (stackSize > 0) {
+      int current = stack[--stackSize];
+      if (marks[current] == stamp) {
+        continue;
+      }
+      if (states[current].isDestroyed()) {
+        return ARGUtils.getAllStatesOnPathsTo(pLastElement);
+      }
+      marks[current] = stamp;
+      result.add(states[current]);
+
+      // push in reverse order such that the first parent is visited first
+      for (int i = parentStart[current + 1] - 1; i >= parentStart[current]; i--) {
+        int parent = parents[i];
+        if (parent == NOT_INDEXED) {
+          return ARGUtils.getAllStatesOnPathsTo(pLastElement);
+        }
+        if (marks[parent] != stamp) {
+          push(stackSize++, parent);
+        }
+      }
+    }
+    return result.build();
+  }
+}
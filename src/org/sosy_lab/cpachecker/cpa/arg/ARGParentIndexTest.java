@@ -0,0 +1,70 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.arg;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import java.util.ArrayList;
+import java.util.List;
+import org.junit.Test;
+
+public class ARGParentIndexTest {
+
+  @Test
+  public void testDeepPath() {
+    List<ARGState> states = new ArrayList<>();
+    ARGState current = new ARGState(null, null);
+    states.add(current);
+    for (int i = 0; i < 100000; i++) {
+      current = new ARGState(null, current);
+      states.add(current);
+    }
+
+    ARGParentIndex index = ARGParentIndex.create(states);
+    assertThat(index.getOnePathTo(current).asStatesList())
+        .containsExactlyElementsIn(states)
+        .inOrder();
+    assertThat(index.getAllStatesOnPathsTo(current)).hasSize(states.size());
+  }
+
+  @Test
+  public void testSameResultAsARGUtils() {
+    ARGState root = new ARGState(null, null);
+    ARGState left = new ARGState(null, root);
+    ARGState right = new ARGState(null, root);
+    ARGState join = new ARGState(null, right);
+    join.addParent(left);
+    ARGState target = new ARGState(null, join);
+    ARGState other = new ARGState(null, left);
+
+    ARGParentIndex index =
+        ARGParentIndex.create(ImmutableList.of(target, other, join, right, left, root));
+
+    assertThat(index.getOnePathTo(target).asStatesList())
+        .containsExactlyElementsIn(ARGUtils.getOnePathTo(target).asStatesList())
+        .inOrder();
+    assertThat(index.getAllStatesOnPathsTo(target))
+        .containsExactlyElementsIn(ARGUtils.getAllStatesOnPathsTo(target))
+        .inOrder();
+    assertThat(index.getAllStatesOnPathsTo(other)).containsExactly(other, left, root);
+  }
+
+  @Test
+  public void testFallbackForUnindexedStates() {
+    ARGState root = new ARGState(null, null);
+    ARGState child = new ARGState(null, root);
+    ARGParentIndex index = ARGParentIndex.create(ImmutableList.of(root, child));
+
+    ARGState newChild = new ARGState(null, child);
+    assertThat(index.getOnePathTo(newChild).asStatesList())
+        .containsExactly(root, child, newChild)
+        .inOrder();
+  }
+}
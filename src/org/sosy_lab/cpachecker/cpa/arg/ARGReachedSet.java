@@ -21,17 +21,23 @@ import com.google.common.collect.SetMultimap;
 import java.io.IOException;
 import java.util.ArrayDeque;
 import java.util.ArrayList;
+import java.util.BitSet;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.Deque;
 import java.util.HashSet;
 import java.util.IdentityHashMap;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
+import java.util.NavigableMap;
 import java.util.NavigableSet;
 import java.util.Set;
+import java.util.TreeMap;
 import java.util.TreeSet;
 import java.util.function.Function;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
@@ -56,6 +62,8 @@ public class ARGReachedSet {
   private final ReachedSet mReached;
   private final UnmodifiableReachedSet mUnmodifiableReached;
 
+  private @Nullable ARGParentIndex parentIndex = null;
+
   /**
    * Constructor for ARGReachedSet as a simple wrapper around ReachedSet.
    * If possible, do not use this constructor but the other one that takes
@@ -88,6 +96,19 @@ public class ARGReachedSet {
     return mUnmodifiableReached;
   }
 
+  /**
+   * Get an index of the parent relation of the ARG for fast path extraction. The index is created
+   * lazily and cached until the ARG is modified through this instance, so all queries during one
+   * refinement share it. Callers that modify ARG states directly need to be aware that the index
+   * does not reflect these changes.
+   */
+  public ARGParentIndex getParentIndex() {
+    if (parentIndex == null) {
+      parentIndex = ARGParentIndex.create(mReached);
+    }
+    return parentIndex;
+  }
+
   /**
    * Remove an element and all elements below it from the tree. Re-add all those
    * elements to the waitlist which have children which are either removed or were
@@ -129,6 +150,7 @@ public class ARGReachedSet {
   private void removeUnReachableFrom(Collection<AbstractState> startStates,
       Function<? super ARGState, ? extends Iterable<ARGState>> successorFunction,
       Predicate<ARGState> allowedToRemove) {
+    parentIndex = null;
     Deque<AbstractState> toVisit = new ArrayDeque<>(startStates);
     Set<ARGState> reached = new HashSet<>();
     while (!toVisit.isEmpty()) {
@@ -214,6 +236,77 @@ public class ARGReachedSet {
     }
   }
 
+  /**
+   * Remove several subtrees at once. This is equivalent to calling {@link #removeSubtree(ARGState)}
+   * for each of the given roots in iteration order, but traverses each removed state only once,
+   * removes all states from the reached set in one batch, and re-adds each remaining parent to the
+   * waitlist only once. Roots that are already destroyed or that are part of the subtree of another
+   * given root are removed together with that subtree.
+   *
+   * @param pRoots The roots of the removed subtrees, may not contain the initial element.
+   * @throws InterruptedException can be thrown in subclass
+   */
+  public void removeSubtrees(Collection<ARGState> pRoots) throws InterruptedException {
+    Map<ARGState, List<Precision>> rootsWithoutPrecisions = new LinkedHashMap<>();
+    for (ARGState root : pRoots) {
+      rootsWithoutPrecisions.put(root, ImmutableList.of());
+    }
+    removeSubtrees(rootsWithoutPrecisions, ImmutableList.of());
+  }
+
+  /**
+   * Like {@link #removeSubtrees(Collection)}, but when re-adding elements to the waitlist adapts
+   * their precisions as {@link #removeSubtree(ARGState, List, List)} does, using the precisions
+   * given for the roots whose subtrees the elements were parents of. If an element was parent of
+   * several subtrees, the precisions of all respective roots are applied in iteration order.
+   *
+   * @param pRootsWithPrecisions The roots of the removed subtrees with their new precisions,
+   *     each list of precisions needs to match the types in pPrecTypes.
+   * @param pPrecTypes the types of the precisions.
+   * @throws InterruptedException can be thrown in subclass
+   */
+  public void removeSubtrees(
+      Map<ARGState, List<Precision>> pRootsWithPrecisions,
+      List<Predicate<? super Precision>> pPrecTypes)
+      throws InterruptedException {
+    Preconditions.checkNotNull(pRootsWithPrecisions);
+    Preconditions.checkNotNull(pPrecTypes);
+
+    List<ARGState> roots = new ArrayList<>(pRootsWithPrecisions.size());
+    for (Map.Entry<ARGState, List<Precision>> entry : pRootsWithPrecisions.entrySet()) {
+      Preconditions.checkArgument(
+          entry.getValue().isEmpty() || entry.getValue().size() == pPrecTypes.size());
+      if (!entry.getKey().isDestroyed()) {
+        roots.add(entry.getKey());
+      }
+    }
+
+    NavigableMap<ARGState, BitSet> toWaitlist = removeSubtrees0(roots);
+
+    for (Map.Entry<ARGState, BitSet> entry : toWaitlist.entrySet()) {
+      ARGState waitingState = entry.getKey();
+      Precision waitingStatePrec = mReached.getPrecision(waitingState);
+      Preconditions.checkState(waitingStatePrec != null);
+
+      BitSet rootIndices = entry.getValue();
+      for (int r = rootIndices.nextSetBit(0); r >= 0; r = rootIndices.nextSetBit(r + 1)) {
+        List<Precision> precisions = pRootsWithPrecisions.get(roots.get(r));
+        for (int i = 0; i < precisions.size(); i++) {
+          Precision adaptedPrec =
+              adaptPrecision(waitingStatePrec, precisions.get(i), pPrecTypes.get(i));
+
+          // adaptedPrec == null, if the precision component was not changed
+          if (adaptedPrec != null) {
+            waitingStatePrec = adaptedPrec;
+          }
+        }
+      }
+
+      mReached.updatePrecision(waitingState, waitingStatePrec);
+      mReached.reAddToWaitlist(waitingState);
+    }
+  }
+
   /**
    * Safely remove a part of the ARG which has been proved as completely unreachable. This method
    * takes care of the coverage relationships of the removed nodes, re-adding covered nodes to the
@@ -247,6 +340,7 @@ public class ARGReachedSet {
    * @param argState the state to be removed including its subtree
    */
   public void cutOffSubtree(ARGState argState) {
+    parentIndex = null;
     // copy whole subgraph before modifying ARG!
     ImmutableList<ARGState> subgraph = argState.getSubgraph().toList();
     mReached.removeAll(subgraph);
@@ -331,6 +425,69 @@ public class ARGReachedSet {
     return toWaitlist;
   }
 
+  /**
+   * Remove the subtrees of all given roots with a single traversal of the ARG.
+   *
+   * @return the elements to re-add to the waitlist (oldest-first), each mapped to the indices of
+   *     the roots whose subtrees contained one of its children
+   */
+  private NavigableMap<ARGState, BitSet> removeSubtrees0(List<ARGState> pRoots) {
+    // the index of the root whose subtree contains the state, in traversal order
+    Map<ARGState, Integer> owner = new LinkedHashMap<>();
+    Deque<ARGState> toVisit = new ArrayDeque<>();
+    for (int r = 0; r < pRoots.size(); r++) {
+      ARGState root = pRoots.get(r);
+      if (owner.containsKey(root)) {
+        // part of the subtree of an earlier root
+        continue;
+      }
+      Preconditions.checkArgument(
+          !root.getParents().isEmpty(),
+          "May not remove the initial state from the ARG/reached set.\n"
+              + "Trying to remove state '%s'.",
+          root);
+      dumpSubgraph(root);
+
+      toVisit.push(root);
+      while (!toVisit.isEmpty()) {
+        ARGState current = toVisit.pop();
+        if (owner.putIfAbsent(current, r) == null) {
+          for (ARGState child : current.getChildren()) {
+            if (!owner.containsKey(child)) {
+              toVisit.push(child);
+            }
+          }
+        }
+      }
+    }
+
+    // we remove the covered states completely, cf. removeSubtree0
+    List<Map.Entry<ARGState, Integer>> subtrees = new ArrayList<>(owner.entrySet());
+    for (Map.Entry<ARGState, Integer> entry : subtrees) {
+      for (ARGState covered : entry.getKey().getCoveredByThis()) {
+        owner.putIfAbsent(covered, entry.getValue());
+      }
+    }
+
+    parentIndex = null;
+    Set<ARGState> elements = owner.keySet();
+    mReached.removeAll(elements);
+
+    NavigableMap<ARGState, BitSet> toWaitlist = new TreeMap<>();
+    for (Map.Entry<ARGState, Integer> entry : owner.entrySet()) {
+      ARGState ae = entry.getKey();
+      for (ARGState parent : ae.getParents()) {
+        if (!elements.contains(parent)) {
+          toWaitlist.computeIfAbsent(parent, k -> new BitSet()).set(entry.getValue());
+        }
+      }
+    }
+    for (ARGState ae : elements) {
+      ae.removeFromARG();
+    }
+    return toWaitlist;
+  }
+
   private void dumpSubgraph(ARGState e) {
     if (!(cpa instanceof ARGCPA)) {
       return;
@@ -386,6 +543,7 @@ public class ARGReachedSet {
    * @return the elements to re-add to the waitlist
    */
   private NavigableSet<ARGState> removeSet(Set<ARGState> elements) {
+    parentIndex = null;
     mReached.removeAll(elements);
 
     NavigableSet<ARGState> toWaitlist = new TreeSet<>();
@@ -518,6 +676,26 @@ public class ARGReachedSet {
       super(pReached.mReached);
       delegate = pReached;
     }
+
+    /**
+     * Sub-classes may redefine the removal of single subtrees, thus we remove the subtrees one
+     * after another, skipping those that were already removed with an earlier subtree.
+     */
+    @Override
+    public void removeSubtrees(
+        Map<ARGState, List<Precision>> pRootsWithPrecisions,
+        List<Predicate<? super Precision>> pPrecTypes)
+        throws InterruptedException {
+      for (Map.Entry<ARGState, List<Precision>> entry : pRootsWithPrecisions.entrySet()) {
+        if (!entry.getKey().isDestroyed()) {
+          if (entry.getValue().isEmpty()) {
+            removeSubtree(entry.getKey());
+          } else {
+            removeSubtree(entry.getKey(), entry.getValue(), pPrecTypes);
+          }
+        }
+      }
+    }
   }
 
   /**
@@ -540,6 +718,7 @@ public class ARGReachedSet {
    * the state does not represent unreached concrete states, otherwise it will be unsound.
    */
   public void addForkedState(ARGState forkedState, ARGState originalState) {
+    parentIndex = null;
     mReached.add(forkedState, mReached.getPrecision(originalState));
     mReached.removeOnlyFromWaitlist(forkedState);
   }
@@ -19,13 +19,13 @@ import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Sets;
 import com.google.common.graph.Traverser;
-import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.LinkedHashSet;
 import java.util.List;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.atomic.AtomicReferenceFieldUpdater;
 import org.checkerframework.checker.nullness.qual.NonNull;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.UniqueIdGenerator;
@@ -44,12 +44,19 @@ public class ARGState extends AbstractSingleWrapperState
 
   private static final long serialVersionUID = 2608287648397165040L;
 
-  // We use a List here although we would like to have a Set
-  // because ArrayList is much more memory efficient than e.g. LinkedHashSet.
-  // Also these collections are small and so a slow contains() method won't hurt.
-  // To enforce set semantics, do not add elements except through addparent()!
-  private final Collection<ARGState> children = new ArrayList<>(1);
-  private final Collection<ARGState> parents = new ArrayList<>(1);
+  private static final AtomicReferenceFieldUpdater<ARGState, Object> CHILDREN =
+      AtomicReferenceFieldUpdater.newUpdater(ARGState.class, Object.class, "children");
+  private static final AtomicReferenceFieldUpdater<ARGState, Object> PARENTS =
+      AtomicReferenceFieldUpdater.newUpdater(ARGState.class, Object.class, "parents");
+
+  // Children and parents are stored in a compact form, cf. ARGStateLinks:
+  // null, a single ARGState, or a copy-on-write array of ARGStates (if branching).
+  // This is much more memory efficient than, e.g., an ArrayList per state,
+  // and allows to read them concurrently.
+  // These collections are small and so a slow contains() method won't hurt.
+  // To enforce set semantics, do not add elements except through addParent()!
+  private volatile @Nullable Object children = null;
+  private volatile @Nullable Object parents = null;
 
   private ARGState mCoveredBy = null;
   private Set<ARGState> mCoveredByThis = null; // lazy initialization because rarely needed
@@ -84,7 +91,7 @@ public class ARGState extends AbstractSingleWrapperState
    * @return A unmodifiable collection of ARGStates without duplicates.
    */
   public Collection<ARGState> getParents() {
-    return Collections.unmodifiableCollection(parents);
+    return new ARGStateLinks.LinksView(PARENTS, this);
   }
 
   public void addParent(ARGState pOtherParent) {
@@ -92,12 +99,11 @@ public class ARGState extends AbstractSingleWrapperState
     assert !destroyed : "Don't use destroyed ARGState " + this;
 
     // Manually enforce set semantics.
-    if (!parents.contains(pOtherParent)) {
-      assert !pOtherParent.children.contains(this);
-      parents.add(pOtherParent);
-      pOtherParent.children.add(this);
+    if (ARGStateLinks.add(PARENTS, this, pOtherParent)) {
+      boolean added = ARGStateLinks.add(CHILDREN, pOtherParent, this);
+      assert added;
     } else {
-      assert pOtherParent.children.contains(this);
+      assert ARGStateLinks.contains(pOtherParent.children, this);
     }
   }
 
@@ -107,7 +113,7 @@ public class ARGState extends AbstractSingleWrapperState
    */
   public Collection<ARGState> getChildren() {
     assert !destroyed : "Don't use destroyed ARGState " + this;
-    return Collections.unmodifiableCollection(children);
+    return new ARGStateLinks.LinksView(CHILDREN, this);
   }
 
   /**
@@ -292,10 +298,10 @@ public class ARGState extends AbstractSingleWrapperState
   }
 
   void deleteChild(ARGState child) {
-    assert (children.contains(child));
-    assert (child.parents.contains(this));
-    children.remove(child);
-    child.parents.remove(this);
+    assert ARGStateLinks.contains(children, child);
+    assert ARGStateLinks.contains(child.parents, this);
+    ARGStateLinks.remove(CHILDREN, this, child);
+    ARGStateLinks.remove(PARENTS, child, this);
   }
 
   // counterexample
@@ -383,9 +389,9 @@ public class ARGState extends AbstractSingleWrapperState
     sb.append(stateId);
     if (!destroyed) {
       sb.append(", Parents: ");
-      sb.append(stateIdsOf(parents));
+      sb.append(stateIdsOf(getParents()));
       sb.append(", Children: ");
-      sb.append(stateIdsOf(children));
+      sb.append(stateIdsOf(getChildren()));
 
       if (mCoveredBy != null) {
         sb.append(", Covered by: ");
@@ -470,18 +476,18 @@ public class ARGState extends AbstractSingleWrapperState
     assert !destroyed : "Don't use destroyed ARGState " + this;
 
     // clear children
-    for (ARGState child : children) {
-      assert (child.parents.contains(this));
-      child.parents.remove(this);
+    for (ARGState child : getChildren()) {
+      boolean removed = ARGStateLinks.remove(PARENTS, child, this);
+      assert removed;
     }
-    children.clear();
+    children = null;
 
     // clear parents
-    for (ARGState parent : parents) {
-      assert (parent.children.contains(this));
-      parent.children.remove(this);
+    for (ARGState parent : getParents()) {
+      boolean removed = ARGStateLinks.remove(CHILDREN, parent, this);
+      assert removed;
     }
-    parents.clear();
+    parents = null;
   }
 
   /**
@@ -501,19 +507,19 @@ public class ARGState extends AbstractSingleWrapperState
     assert !this.equals(replacement) : "Don't replace ARGState " + this + " with itself";
 
     // copy children
-    for (ARGState child : children) {
-      assert child.parents.contains(this) : "Inconsistent ARG at " + this;
-      child.parents.remove(this);
+    for (ARGState child : getChildren()) {
+      boolean removed = ARGStateLinks.remove(PARENTS, child, this);
+      assert removed : "Inconsistent ARG at " + this;
       child.addParent(replacement);
     }
-    children.clear();
+    children = null;
 
-    for (ARGState parent : parents) {
-      assert parent.children.contains(this) : "Inconsistent ARG at " + this;
-      parent.children.remove(this);
+    for (ARGState parent : getParents()) {
+      boolean removed = ARGStateLinks.remove(CHILDREN, parent, this);
+      assert removed : "Inconsistent ARG at " + this;
       replacement.addParent(parent);
     }
-    parents.clear();
+    parents = null;
 
     if (mCoveredByThis != null) {
       if (replacement.mCoveredByThis == null) {
@@ -567,12 +573,11 @@ public class ARGState extends AbstractSingleWrapperState
     assert !destroyed : "Don't use destroyed ARGState " + this;
 
     // Manually enforce set semantics.
-    if (parents.contains(pOtherParent)) {
-      assert pOtherParent.children.contains(this);
-      parents.remove(pOtherParent);
-      pOtherParent.children.remove(this);
+    if (ARGStateLinks.remove(PARENTS, this, pOtherParent)) {
+      boolean removed = ARGStateLinks.remove(CHILDREN, pOtherParent, this);
+      assert removed;
     } else {
-      assert !pOtherParent.children.contains(this) : "Problem detected!";
+      assert !ARGStateLinks.contains(pOtherParent.children, this) : "Problem detected!";
     }
   }
 }
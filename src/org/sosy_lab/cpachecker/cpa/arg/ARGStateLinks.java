@@ -0,0 +1,158 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.arg;
+
+import com.google.common.collect.Iterators;
+import java.util.AbstractCollection;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Iterator;
+import java.util.concurrent.atomic.AtomicReferenceFieldUpdater;
+import org.checkerframework.checker.nullness.qual.Nullable;
+
+/**
+ * Helper for the compact storage of the parents and children of {@link ARGState}s.
+ *
+ * <p>A set of linked states is stored in a single (volatile) field of the owning state, which
+ * contains either <code>null</code> (no linked state), a single {@link ARGState} (the common case
+ * of a non-branching ARG), or an array of ARGStates without duplicates. The arrays are never
+ * modified after they are stored in the field (copy-on-write), and updates are done with a
+ * compare-and-set on the field. Thus the links can be read concurrently without locking, and new
+ * links can be added concurrently without global locks.
+ */
+final class ARGStateLinks {
+
+  private ARGStateLinks() {}
+
+  /** Add the given state to the links stored in the given field, if not yet contained. */
+  static boolean add(
+      AtomicReferenceFieldUpdater<ARGState, Object> pField, ARGState pOwner, ARGState pState) {
+    while (true) {
+      Object current = pField.get(pOwner);
+      if (contains(current, pState)) {
+        return false;
+      }
+      if (pField.compareAndSet(pOwner, current, with(current, pState))) {
+        return true;
+      }
+    }
+  }
+
+  /** Remove the given state from the links stored in the given field, if contained. */
+  static boolean remove(
+      AtomicReferenceFieldUpdater<ARGState, Object> pField, ARGState pOwner, ARGState pState) {
+    while (true) {
+      Object current = pField.get(pOwner);
+      if (!contains(current, pState)) {
+        return false;
+      }
+      if (pField.compareAndSet(pOwner, current, without(current, pState))) {
+        return true;
+      }
+    }
+  }
+
+  static boolean contains(@Nullable Object pLinks, Object pState) {
+    if (pLinks == null) {
+      return false;
+    } else if (pLinks instanceof ARGState) {
+      return pLinks == pState;
+    }
+    for (ARGState state : (ARGState[]) pLinks) {
+      if (state == pState) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static int size(@Nullable Object pLinks) {
+    if (pLinks == null) {
+      return 0;
+    } else if (pLinks instanceof ARGState) {
+      return 1;
+    }
+    return ((ARGState[]) pLinks).length;
+  }
+
+  static Iterator<ARGState> iterator(@Nullable Object pLinks) {
+    if (pLinks == null) {
+      return Collections.emptyIterator();
+    } else if (pLinks instanceof ARGState) {
+      return Iterators.singletonIterator((ARGState) pLinks);
+    }
+    return Iterators.forArray((ARGState[]) pLinks);
+  }
+
+  private static Object with(@Nullable Object pLinks, ARGState pState) {
+    if (pLinks == null) {
+      return pState;
+    } else if (pLinks instanceof ARGState) {
+      return new ARGState[] {(ARGState) pLinks, pState};
+    }
+    ARGState[] old = (ARGState[]) pLinks;
+    ARGState[] result = Arrays.copyOf(old, old.length + 1);
+    result[old.length] = pState;
+    return result;
+  }
+
+  private static @Nullable Object without(Object pLinks, ARGState pState) {
+    if (pLinks instanceof ARGState) {
+      return null;
+    }
+    ARGState[] old = (ARGState[]) pLinks;
+    if (old.length == 2) {
+      // go back to the inlined representation
+      return old[0] == pState ? old[1] : old[0];
+    }
+    ARGState[] result = new ARGState[old.length - 1];
+    int i = 0;
+    for (ARGState state : old) {
+      if (state != pState) {
+        result[i++] = state;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * An unmodifiable view of the links stored in a field. Each iteration works on the snapshot of
+   * the links at its start and is thus not affected by concurrent modifications.
+   */
+  static final class LinksView extends AbstractCollection<ARGState> {
+
+    private final AtomicReferenceFieldUpdater<ARGState, Object> field;
+    private final ARGState owner;
+
+    LinksView(AtomicReferenceFieldUpdater<ARGState, Object> pField, ARGState pOwner) {
+      field = pField;
+      owner = pOwner;
+    }
+
+    @Override
+    public Iterator<ARGState> iterator() {
+      return ARGStateLinks.iterator(field.get(owner));
+    }
+
+    @Override
+    public int size() {
+      return ARGStateLinks.size(field.get(owner));
+    }
+
+    @Override
+    public boolean isEmpty() {
+      return field.get(owner) == null;
+    }
+
+    @Override
+    public boolean contains(Object pObj) {
+      return ARGStateLinks.contains(field.get(owner), pObj);
+    }
+  }
+}
@@ -0,0 +1,101 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.arg;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.List;
+import org.junit.Test;
+
+public class ARGStateTest {
+
+  @Test
+  public void testSingleParent() {
+    ARGState root = new ARGState(null, null);
+    ARGState child = new ARGState(null, root);
+
+    assertThat(root.getChildren()).containsExactly(child);
+    assertThat(root.getParents()).isEmpty();
+    assertThat(child.getParents()).containsExactly(root);
+    assertThat(child.getChildren()).isEmpty();
+  }
+
+  @Test
+  public void testSetSemantics() {
+    ARGState root = new ARGState(null, null);
+    ARGState child = new ARGState(null, root);
+    child.addParent(root);
+
+    assertThat(root.getChildren()).hasSize(1);
+    assertThat(child.getParents()).hasSize(1);
+  }
+
+  @Test
+  public void testBranching() {
+    ARGState root = new ARGState(null, null);
+    List<ARGState> children = new ArrayList<>();
+    for (int i = 0; i < 5; i++) {
+      children.add(new ARGState(null, root));
+    }
+    assertThat(root.getChildren()).containsExactlyElementsIn(children).inOrder();
+
+    children.get(2).removeFromARG();
+    children.remove(2);
+    assertThat(root.getChildren()).containsExactlyElementsIn(children).inOrder();
+
+    for (ARGState child : children.subList(1, children.size())) {
+      child.removeParent(root);
+    }
+    assertThat(root.getChildren()).containsExactly(children.get(0));
+  }
+
+  @Test
+  public void testViewReflectsChanges() {
+    ARGState root = new ARGState(null, null);
+    Collection<ARGState> view = root.getChildren();
+    ARGState child1 = new ARGState(null, root);
+    assertThat(view).containsExactly(child1);
+    ARGState child2 = new ARGState(null, root);
+    assertThat(view).containsExactly(child1, child2);
+  }
+
+  @Test
+  public void testIterationIsSnapshot() {
+    ARGState root = new ARGState(null, null);
+    ARGState child1 = new ARGState(null, root);
+    ARGState child2 = new ARGState(null, root);
+
+    // modification during iteration does not affect the iteration
+    List<ARGState> seen = new ArrayList<>();
+    for (ARGState child : root.getChildren()) {
+      seen.add(child);
+      child.removeParent(root);
+    }
+    assertThat(seen).containsExactly(child1, child2).inOrder();
+    assertThat(root.getChildren()).isEmpty();
+  }
+
+  @Test
+  public void testReplaceInARG() {
+    ARGState root = new ARGState(null, null);
+    ARGState middle = new ARGState(null, root);
+    ARGState leaf = new ARGState(null, middle);
+    ARGState replacement = new ARGState(null, null);
+
+    middle.replaceInARGWith(replacement);
+
+    assertThat(root.getChildren()).containsExactly(replacement);
+    assertThat(leaf.getParents()).containsExactly(replacement);
+    assertThat(replacement.getParents()).containsExactly(root);
+    assertThat(replacement.getChildren()).containsExactly(leaf);
+    assertThat(middle.isDestroyed()).isTrue();
+  }
+}
@@ -12,11 +12,14 @@ import static com.google.common.collect.FluentIterable.from;
 
 import com.google.common.base.Function;
 import com.google.common.base.Functions;
+import com.google.common.base.Predicate;
 import com.google.common.base.Predicates;
+import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Maps;
 import com.google.common.collect.SetMultimap;
+import com.google.common.graph.Traverser;
 import com.google.common.io.MoreFiles;
 import java.io.IOException;
 import java.io.PrintStream;
@@ -28,10 +31,12 @@ import java.nio.file.FileSystems;
 import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.EnumSet;
 import java.util.HashSet;
+import java.util.List;
 import java.util.Map;
 import java.util.Set;
 import java.util.function.BiPredicate;
@@ -46,6 +51,7 @@ import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.io.IO;
 import org.sosy_lab.common.io.PathTemplate;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
@@ -175,6 +181,23 @@ public class ARGStatistics implements Statistics {
       description = "export all automata into one zip-file, depends on 'automaton.export=true'")
   private boolean exportAutomatonZipped = true;
 
+  @Option(
+      secure = true,
+      name = "exportCompressed",
+      description =
+          "compress the exported ARG and simplified ARG using GZIP compression"
+              + " (a suffix '.gz' is appended to the file names)")
+  private boolean exportARGCompressed = false;
+
+  @Option(
+      secure = true,
+      name = "exportTargetNeighborhood",
+      description =
+          "export only the part of the ARG near target states to the ARG and simplified ARG files: "
+              + "all states on paths from the root to a target state, and all states within the "
+              + "given number of edges from those. A negative value exports the whole ARG.")
+  private int exportTargetNeighborhood = -1;
+
   protected final ConfigurableProgramAnalysis cpa;
 
   private final CEXExportOptions counterexampleOptions;
@@ -309,7 +332,7 @@ public class ARGStatistics implements Statistics {
 
     if (translateARG) {
       try (Writer writer = IO.openOutputFile(argCFile, Charset.defaultCharset())) {
-        writer.write(argToCExporter.translateARG((ARGState) pReached.getFirstState(), true));
+        argToCExporter.translateARG((ARGState) pReached.getFirstState(), null, true, writer);
       } catch (IOException | CPAException e) {
         logger.logUserException(Level.WARNING, e, "Could not write C translation of ARG to file");
       }
@@ -397,15 +420,18 @@ public class ARGStatistics implements Statistics {
       }
     }
 
+    final Predicate<? super ARGState> displayedStates = getDisplayedStates(rootState);
+
     if (argFile != null) {
-      try (Writer w =
-          IO.openOutputFile(
-              adjustPathNameForPartitioning(rootState, argFile), Charset.defaultCharset())) {
-        ARGToDotWriter.write(
-            w, rootState, ARGState::getChildren, Predicates.alwaysTrue(), isTargetPathEdge);
-      } catch (IOException e) {
-        logger.logUserException(Level.WARNING, e, "Could not write ARG to file");
-      }
+      writeDotExport(
+          adjustPathNameForPartitioning(rootState, argFile),
+          pAppendable ->
+              ARGToDotWriter.write(
+                  pAppendable,
+                  rootState,
+                  ARGState::getChildren,
+                  displayedStates,
+                  isTargetPathEdge));
     }
 
     if (pixelGraphicFile != null) {
@@ -418,19 +444,15 @@ public class ARGStatistics implements Statistics {
     }
 
     if (simplifiedArgFile != null) {
-      try (Writer w =
-          IO.openOutputFile(
-              adjustPathNameForPartitioning(rootState, simplifiedArgFile),
-              Charset.defaultCharset())) {
-        ARGToDotWriter.write(
-            w,
-            rootState,
-            relevantSuccessorFunction,
-            Predicates.alwaysTrue(),
-            BiPredicates.alwaysFalse());
-      } catch (IOException e) {
-        logger.logUserException(Level.WARNING, e, "Could not write ARG to file");
-      }
+      writeDotExport(
+          adjustPathNameForPartitioning(rootState, simplifiedArgFile),
+          pAppendable ->
+              ARGToDotWriter.write(
+                  pAppendable,
+                  rootState,
+                  relevantSuccessorFunction,
+                  displayedStates,
+                  BiPredicates.alwaysFalse()));
     }
 
     assert (refinementGraphUnderlyingWriter == null) == (refinementGraphWriter == null);
@@ -472,6 +494,58 @@ public class ARGStatistics implements Statistics {
     }
   }
 
+  /**
+   * Get the states that should be shown in the exported ARG, cf. option
+   * 'exportTargetNeighborhood'.
+   */
+  private Predicate<? super ARGState> getDisplayedStates(ARGState pRootState) {
+    if (exportTargetNeighborhood < 0) {
+      return Predicates.alwaysTrue();
+    }
+
+    Set<ARGState> displayed = new HashSet<>();
+    displayed.add(pRootState);
+    Traverser.forGraph(ARGState::getParents)
+        .depthFirstPreOrder(pRootState.getSubgraph().filter(ARGState::isTarget))
+        .forEach(displayed::add);
+
+    Collection<ARGState> frontier = ImmutableList.copyOf(displayed);
+    for (int distance = 0; distance < exportTargetNeighborhood && !frontier.isEmpty(); distance++) {
+      List<ARGState> next = new ArrayList<>();
+      for (ARGState state : frontier) {
+        for (ARGState child : state.getChildren()) {
+          if (displayed.add(child)) {
+            next.add(child);
+          }
+        }
+      }
+      frontier = next;
+    }
+    return Predicates.in(displayed);
+  }
+
+  /**
+   * Write a dot export of the ARG. The content is streamed into a buffered (and optionally
+   * compressed) file while it is generated, and the time needed for the export is logged.
+   */
+  private void writeDotExport(Path pPath, Appender pContent) {
+    Timer exportTime = new Timer();
+    exportTime.start();
+    Path file = pPath;
+    try {
+      if (exportARGCompressed) {
+        file = pPath.resolveSibling(pPath.getFileName() + ".gz");
+        IO.writeGZIPFile(file, Charset.defaultCharset(), pContent);
+      } else {
+        IO.writeFile(file, Charset.defaultCharset(), pContent);
+      }
+      exportTime.stop();
+      logger.logf(Level.FINE, "Exported ARG to %s in %s.", file, exportTime);
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write ARG to file");
+    }
+  }
+
   private void writeAutomaton(int counterId, Automaton automaton) throws IOException {
     if (automatonSpcFile != null) {
       writeFile(automatonSpcFile.getPath(counterId), automaton);
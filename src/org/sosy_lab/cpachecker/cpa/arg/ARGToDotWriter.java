@@ -82,10 +82,10 @@ public class ARGToDotWriter {
       if (state.isDestroyed()) {
         continue;
       }
-      sb.append(determineNode(state));
+      appendNode(sb, state);
       sb.append(determineStateHint(state));
       for (ARGState child: state.getChildren()) {
-        sb.append(determineEdge(BiPredicates.alwaysFalse(), state, child));
+        appendEdge(sb, BiPredicates.alwaysFalse(), state, child);
       }
     }
     label = String.format("label=\"%s\";%nlabelloc=top;%nlabeljust=left;%n", label);
@@ -134,7 +134,8 @@ public class ARGToDotWriter {
 
   /**
    * Create String with ARG in the DOT format of Graphviz. Only the states and edges are written, no
-   * surrounding graph definition.
+   * surrounding graph definition. States and edges are written directly while traversing the ARG,
+   * so the output is never kept in memory.
    *
    * @param rootState the root element of the ARG
    * @param successorFunction A function giving all successors of an ARGState. Only states reachable
@@ -152,7 +153,6 @@ public class ARGToDotWriter {
 
     Deque<ARGState> worklist = new ArrayDeque<>();
     Set<ARGState> processed = new HashSet<>();
-    StringBuilder edges = new StringBuilder();
 
     worklist.add(rootState);
 
@@ -165,30 +165,31 @@ public class ARGToDotWriter {
         continue;
       }
 
-      sb.append(determineNode(currentElement));
+      appendNode(sb, currentElement);
       sb.append(determineStateHint(currentElement));
 
       for (ARGState covered : currentElement.getCoveredByThis()) {
         if (displayedElements.apply(covered)) {
-          edges.append(covered.getStateId());
-          edges.append(" -> ");
-          edges.append(currentElement.getStateId());
-          edges.append(" [style=\"dashed\" weight=\"0\" label=\"covered by\"]\n");
+          sb.append(Integer.toString(covered.getStateId()));
+          sb.append(" -> ");
+          sb.append(Integer.toString(currentElement.getStateId()));
+          sb.append(" [style=\"dashed\" weight=\"0\" label=\"covered by\"]\n");
         }
       }
 
       for (ARGState child : successorFunction.apply(currentElement)) {
-        edges.append(determineEdge(highlightEdge, currentElement, child));
+        appendEdge(sb, highlightEdge, currentElement, child);
         worklist.add(child);
       }
     }
-    sb.append(edges);
   }
 
-  private static String determineEdge(
+  private static void appendEdge(
+      final Appendable pOut,
       final BiPredicate<ARGState, ARGState> highlightEdge,
       final ARGState state,
-      final ARGState successorState) {
+      final ARGState successorState)
+      throws IOException {
     final StringBuilder builder = new StringBuilder();
     builder.append(state.getStateId()).append(" -> ").append(successorState.getStateId());
     builder.append(" [");
@@ -236,7 +237,7 @@ public class ARGToDotWriter {
     }
 
     builder.append("]\n");
-    return builder.toString();
+    pOut.append(builder);
   }
 
   void writeEdge(ARGState start, ARGState end) throws IOException {
@@ -312,7 +313,8 @@ public class ARGToDotWriter {
     return builder.toString();
   }
 
-  private static String determineNode(final ARGState currentElement) {
+  private static void appendNode(final Appendable pOut, final ARGState currentElement)
+      throws IOException {
     final StringBuilder builder = new StringBuilder();
     builder.append(currentElement.getStateId());
     builder.append(" [");
@@ -322,7 +324,7 @@ public class ARGToDotWriter {
     }
     builder.append("label=\"").append(determineLabel(currentElement)).append("\" ");
     builder.append("id=\"").append(currentElement.getStateId()).append("\"]\n");
-    return builder.toString();
+    pOut.append(builder);
   }
 
   private static String determineLabel(ARGState currentElement) {
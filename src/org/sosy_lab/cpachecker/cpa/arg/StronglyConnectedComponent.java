@@ -11,6 +11,8 @@ package org.sosy_lab.cpachecker.cpa.arg;
 import com.google.common.collect.ImmutableList;
 import java.util.ArrayDeque;
 import java.util.Deque;
+import java.util.HashSet;
+import java.util.Set;
 import java.util.stream.Collectors;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 
@@ -18,6 +20,7 @@ public class StronglyConnectedComponent {
 
   private final ARGState rootNode;
   private final Deque<ARGState> nodes = new ArrayDeque<>();
+  private final Set<ARGState> nodeSet = new HashSet<>();
 
   public StronglyConnectedComponent(ARGState pRootnode) {
     rootNode = pRootnode;
@@ -32,7 +35,7 @@ public class StronglyConnectedComponent {
   }
 
   public void addNode(ARGState pState) {
-    if (nodes.contains(pState)) {
+    if (!nodeSet.add(pState)) {
       throw new UnsupportedOperationException("nodes must not be added twice");
     }
     nodes.push(pState);
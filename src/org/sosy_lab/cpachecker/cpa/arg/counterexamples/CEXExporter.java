@@ -326,6 +326,8 @@ public class CEXExporter {
 
     if (options.exportToTest() && testExporter != null) {
       testExporter.writeTestCaseFiles(counterexample, Optional.empty());
+      // counterexamples are exported one by one, there is no point where a batch would end
+      testExporter.flush();
     }
   }
 
@@ -75,6 +75,13 @@ public class WitnessOptions {
   @Option(secure = true, description = "Always export source file name, even default")
   private boolean exportSourceFileName = false;
 
+  @Option(
+      secure = true,
+      description =
+          "Verification witness: Write GraphML directly to the output while traversing the"
+              + " witness instead of building an XML document in memory first?")
+  private boolean streamGraphMl = false;
+
   boolean exportFunctionCallsAndReturns() {
     return exportFunctionCallsAndReturns;
   }
@@ -122,4 +129,8 @@ public class WitnessOptions {
   boolean exportSourceFileName() {
     return exportSourceFileName;
   }
+
+  boolean streamGraphMl() {
+    return streamGraphMl;
+  }
 }
@@ -9,11 +9,13 @@
 package org.sosy_lab.cpachecker.cpa.arg.witnessexport;
 
 import static com.google.common.base.Strings.isNullOrEmpty;
+import static java.util.logging.Level.FINE;
 import static java.util.logging.Level.WARNING;
 
 import com.google.common.collect.ImmutableList;
 import java.io.IOException;
 import java.nio.charset.Charset;
+import java.nio.file.Files;
 import java.nio.file.Path;
 import java.util.ArrayDeque;
 import java.util.Collection;
@@ -26,11 +28,13 @@ import java.util.Set;
 import org.sosy_lab.common.Appender;
 import org.sosy_lab.common.io.IO;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
 import org.sosy_lab.cpachecker.core.counterexample.ReportGenerator;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.cpa.arg.witnessexport.formatter.WitnessToDotFormatter;
 import org.sosy_lab.cpachecker.cpa.arg.witnessexport.formatter.WitnessToGraphMLFormatter;
+import org.sosy_lab.cpachecker.cpa.arg.witnessexport.formatter.WitnessToStreamingGraphMLFormatter;
 import org.sosy_lab.cpachecker.cpa.slab.SLARGToDotWriter;
 import org.sosy_lab.cpachecker.util.NumericIdProvider;
 import org.sosy_lab.cpachecker.util.automaton.AutomatonGraphmlCommon.KeyDef;
@@ -39,16 +43,22 @@ import org.sosy_lab.cpachecker.util.expressions.ExpressionTrees;
 
 public class WitnessToOutputFormatsUtils {
 
-  /** utility method */
+  /** utility method, logs the time needed for the export and the size of the written file */
   public static void writeWitness(
       Path filename, boolean compressFile, Appender content, LogManager logger) {
+    Timer exportTime = new Timer();
+    exportTime.start();
     try {
+      Path file = filename;
       if (compressFile) {
-        Path file = filename.resolveSibling(filename.getFileName() + ".gz");
+        file = filename.resolveSibling(filename.getFileName() + ".gz");
         IO.writeGZIPFile(file, Charset.defaultCharset(), content);
       } else {
-        IO.writeFile(filename, Charset.defaultCharset(), content);
+        IO.writeFile(file, Charset.defaultCharset(), content);
       }
+      exportTime.stop();
+      logger.logf(
+          FINE, "Exported witness to %s (%d bytes) in %s.", file, Files.size(file), exportTime);
     } catch (IOException e) {
       logger.logfException(WARNING, e, "Violation witness export to %s failed.", filename);
     }
@@ -61,7 +71,11 @@ public class WitnessToOutputFormatsUtils {
    * @param pTarget where to append the GraphML
    */
   public static void writeToGraphMl(Witness witness, Appendable pTarget) throws IOException {
-    new WitnessToGraphMLFormatter(witness).appendTo(pTarget);
+    if (witness.getWitnessOptions().streamGraphMl()) {
+      new WitnessToStreamingGraphMLFormatter(witness).appendTo(pTarget);
+    } else {
+      new WitnessToGraphMLFormatter(witness).appendTo(pTarget);
+    }
   }
 
   /** Appends the witness as Dot/Graphviz to the supplied {@link Appendable}. */
@@ -0,0 +1,300 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.arg.witnessexport.formatter;
+
+import static com.google.common.base.Strings.isNullOrEmpty;
+
+import com.google.common.collect.Maps;
+import com.google.common.escape.Escaper;
+import com.google.common.xml.XmlEscapers;
+import java.io.IOException;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Deque;
+import java.util.EnumSet;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.core.interfaces.Property;
+import org.sosy_lab.cpachecker.cpa.arg.witnessexport.Edge;
+import org.sosy_lab.cpachecker.cpa.arg.witnessexport.Witness;
+import org.sosy_lab.cpachecker.util.automaton.AutomatonGraphmlCommon;
+import org.sosy_lab.cpachecker.util.automaton.AutomatonGraphmlCommon.ElementType;
+import org.sosy_lab.cpachecker.util.automaton.AutomatonGraphmlCommon.GraphMLTag;
+import org.sosy_lab.cpachecker.util.automaton.AutomatonGraphmlCommon.KeyDef;
+import org.sosy_lab.cpachecker.util.automaton.AutomatonGraphmlCommon.NodeFlag;
+import org.sosy_lab.cpachecker.util.expressions.ExpressionTree;
+import org.sosy_lab.cpachecker.util.expressions.ExpressionTrees;
+
+/**
+ * Writes a witness as GraphML directly to an {@link Appendable}, without building an intermediate
+ * DOM document like {@link WitnessToGraphMLFormatter} does. Each node and edge is written as soon
+ * as it is reached while traversing the witness, so apart from the identifiers of the visited
+ * nodes no additional memory that grows with the witness is needed.
+ *
+ * <p>GraphML requires the key definitions in front of the graph, so the witness is traversed
+ * twice: first to determine the used keys and the nodes whose leaving edges are exported, then to
+ * write the graph. The data that the edges entering a node contribute to it are taken from {@link
+ * Witness#getEnteringEdges()} when the node is written, such that each element can be closed
+ * immediately. The produced document is equivalent to the one of {@link
+ * WitnessToGraphMLFormatter}.
+ */
+public class WitnessToStreamingGraphMLFormatter {
+
+  private static final Escaper CONTENT_ESCAPER = XmlEscapers.xmlContentEscaper();
+  private static final Escaper ATTRIBUTE_ESCAPER = XmlEscapers.xmlAttributeEscaper();
+
+  private final Witness witness;
+
+  public WitnessToStreamingGraphMLFormatter(Witness pWitness) {
+    witness = pWitness;
+  }
+
+  /**
+   * Appends the formatted witness to the supplied {@link Appendable}.
+   *
+   * <p>Calling this method several times provides an identical output, apart from the creation
+   * time of the witness.
+   */
+  public void appendTo(Appendable pTarget) throws IOException {
+    Set<KeyDef> usedKeys = EnumSet.of(KeyDef.ORIGINFILE);
+    for (KeyDef keyDef : KeyDef.values()) {
+      if (keyDef.keyFor == ElementType.GRAPH) {
+        usedKeys.add(keyDef);
+      }
+    }
+    Set<String> expandedNodes = new HashSet<>();
+    traverse(expandedNodes, usedKeys, null);
+
+    pTarget.append("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n");
+    pTarget.append(
+        "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\""
+            + " xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\">\n");
+    for (KeyDef keyDef : usedKeys) {
+      appendKeyDef(keyDef, pTarget);
+    }
+    pTarget.append(" <").append(GraphMLTag.GRAPH.toString());
+    appendAttribute("edgedefault", "directed", pTarget);
+    pTarget.append(">\n");
+    for (Map.Entry<KeyDef, String> graphData :
+        AutomatonGraphmlCommon.getGraphDataEntries(
+            witness.getWitnessType(), witness.getCfa(), witness.getMetaData())) {
+      appendData(graphData.getKey(), graphData.getValue(), "  ", pTarget);
+    }
+    traverse(expandedNodes, usedKeys, pTarget);
+    pTarget.append(" </").append(GraphMLTag.GRAPH.toString()).append(">\n");
+    pTarget.append("</graphml>\n");
+  }
+
+  /**
+   * Traverses the witness graph in the same order as {@link WitnessToOutputFormatter}. Without a
+   * target, the nodes whose leaving edges are exported are added to the given set and the used
+   * keys are collected. With a target, the nodes and edges are written to it.
+   */
+  private void traverse(
+      Set<String> pExpandedNodes, Set<KeyDef> pUsedKeys, @Nullable Appendable pTarget)
+      throws IOException {
+    String entryStateNodeId = witness.getEntryStateNodeId();
+    Set<String> visited = new HashSet<>();
+    Deque<String> waitlist = new ArrayDeque<>();
+    // the leaving edges of the entry node are exported regardless of its invariant
+    pExpandedNodes.add(entryStateNodeId);
+    visitNode(entryStateNodeId, pExpandedNodes, pUsedKeys, pTarget);
+    visited.add(entryStateNodeId);
+    waitlist.push(entryStateNodeId);
+    while (!waitlist.isEmpty()) {
+      String source = waitlist.pop();
+      for (Edge edge : witness.getLeavingEdges().get(source)) {
+        String target = edge.getTarget();
+        if (visited.add(target)) {
+          if (visitNode(target, pExpandedNodes, pUsedKeys, pTarget)) {
+            waitlist.push(target);
+          }
+        }
+        if (pTarget == null) {
+          for (KeyDef keyDef : edge.getLabel().getMapping().keySet()) {
+            if (keyDef.keyFor.equals(ElementType.NODE) || keyDef.keyFor.equals(ElementType.EDGE)) {
+              pUsedKeys.add(keyDef);
+            }
+          }
+        } else {
+          appendEdge(edge, pTarget);
+        }
+      }
+    }
+  }
+
+  /** Handles a newly reached node and returns whether its leaving edges are exported. */
+  private boolean visitNode(
+      String pNodeId,
+      Set<String> pExpandedNodes,
+      Set<KeyDef> pUsedKeys,
+      @Nullable Appendable pTarget)
+      throws IOException {
+    ExpressionTree<Object> invariant = ExpressionTrees.getTrue();
+    if (witness.getInvariantExportStates().contains(pNodeId)) {
+      invariant = witness.getStateInvariant(pNodeId);
+    }
+    boolean expand = !ExpressionTrees.getFalse().equals(invariant);
+    if (pTarget == null) {
+      if (expand) {
+        pExpandedNodes.add(pNodeId);
+      }
+      collectNodeKeys(pNodeId, invariant, pUsedKeys);
+    } else {
+      appendNode(pNodeId, invariant, pExpandedNodes, pTarget);
+    }
+    return expand;
+  }
+
+  private void collectNodeKeys(
+      String pNodeId, ExpressionTree<Object> pInvariant, Set<KeyDef> pUsedKeys) {
+    if (witness.getWitnessOptions().exportNodeLabel()) {
+      pUsedKeys.add(KeyDef.LABEL);
+    }
+    for (NodeFlag f : witness.getNodeFlags().get(pNodeId)) {
+      pUsedKeys.add(f.key);
+    }
+    if (!witness.getViolatedProperties().get(pNodeId).isEmpty()) {
+      pUsedKeys.add(KeyDef.VIOLATEDPROPERTY);
+    }
+    if (witness.hasQuasiInvariant(pNodeId) || !ExpressionTrees.getTrue().equals(pInvariant)) {
+      pUsedKeys.add(KeyDef.INVARIANT);
+    }
+    if (!ExpressionTrees.getTrue().equals(pInvariant)
+        && !ExpressionTrees.getFalse().equals(pInvariant)
+        && !isNullOrEmpty(witness.getStateScopes().get(pNodeId))) {
+      pUsedKeys.add(KeyDef.INVARIANTSCOPE);
+    }
+  }
+
+  private void appendNode(
+      String pNodeId,
+      ExpressionTree<Object> pInvariant,
+      Set<String> pExpandedNodes,
+      Appendable pTarget)
+      throws IOException {
+    List<Map.Entry<KeyDef, String>> data = new ArrayList<>();
+    if (witness.getWitnessOptions().exportNodeLabel()) {
+      // add a printable label that for example is shown in yEd
+      data.add(Maps.immutableEntry(KeyDef.LABEL, pNodeId));
+    }
+    for (NodeFlag f : witness.getNodeFlags().get(pNodeId)) {
+      data.add(Maps.immutableEntry(f.key, "true"));
+    }
+    for (Property violation : witness.getViolatedProperties().get(pNodeId)) {
+      data.add(Maps.immutableEntry(KeyDef.VIOLATEDPROPERTY, violation.toString()));
+    }
+    if (witness.hasQuasiInvariant(pNodeId)) {
+      data.add(
+          Maps.immutableEntry(KeyDef.INVARIANT, witness.getQuasiInvariant(pNodeId).toString()));
+    }
+    if (!ExpressionTrees.getTrue().equals(pInvariant)) {
+      data.add(Maps.immutableEntry(KeyDef.INVARIANT, pInvariant.toString()));
+      String scope = witness.getStateScopes().get(pNodeId);
+      if (!isNullOrEmpty(scope) && !ExpressionTrees.getFalse().equals(pInvariant)) {
+        data.add(Maps.immutableEntry(KeyDef.INVARIANTSCOPE, scope));
+      }
+    }
+    // node data attached to the exported edges that enter this node
+    for (Edge edge : witness.getEnteringEdges().get(pNodeId)) {
+      if (pExpandedNodes.contains(edge.getSource())) {
+        for (Map.Entry<KeyDef, String> entry : edge.getLabel().getMapping().entrySet()) {
+          if (entry.getKey().keyFor.equals(ElementType.NODE)) {
+            data.add(entry);
+          }
+        }
+      }
+    }
+
+    pTarget.append("  <").append(GraphMLTag.NODE.toString());
+    appendAttribute("id", pNodeId, pTarget);
+    appendChildren(GraphMLTag.NODE, data, pTarget);
+  }
+
+  private void appendEdge(Edge pEdge, Appendable pTarget) throws IOException {
+    List<Map.Entry<KeyDef, String>> data = new ArrayList<>();
+    for (Map.Entry<KeyDef, String> entry : pEdge.getLabel().getMapping().entrySet()) {
+      if (entry.getKey().keyFor.equals(ElementType.EDGE)) {
+        data.add(entry);
+      }
+    }
+
+    pTarget.append("  <").append(GraphMLTag.EDGE.toString());
+    appendAttribute("source", pEdge.getSource(), pTarget);
+    appendAttribute("target", pEdge.getTarget(), pTarget);
+    appendChildren(GraphMLTag.EDGE, data, pTarget);
+  }
+
+  private void appendKeyDef(KeyDef pKeyDef, Appendable pTarget) throws IOException {
+    String defaultValue = pKeyDef.defaultValue;
+    if (pKeyDef == KeyDef.ORIGINFILE && witness.getOriginFile() != null) {
+      defaultValue = witness.getOriginFile();
+    }
+
+    pTarget.append(" <").append(GraphMLTag.KEY.toString());
+    appendAttribute("attr.name", pKeyDef.attrName, pTarget);
+    appendAttribute("attr.type", pKeyDef.attrType, pTarget);
+    appendAttribute("for", pKeyDef.keyFor.toString(), pTarget);
+    appendAttribute("id", pKeyDef.id, pTarget);
+    if (defaultValue == null) {
+      pTarget.append("/>\n");
+    } else {
+      pTarget
+          .append(">\n  <")
+          .append(GraphMLTag.DEFAULT.toString())
+          .append('>')
+          .append(CONTENT_ESCAPER.escape(defaultValue))
+          .append("</")
+          .append(GraphMLTag.DEFAULT.toString())
+          .append(">\n </")
+          .append(GraphMLTag.KEY.toString())
+          .append(">\n");
+    }
+  }
+
+  /** Closes the start tag of a node or edge, appends its data elements and closes it. */
+  private static void appendChildren(
+      GraphMLTag pTag, List<Map.Entry<KeyDef, String>> pData, Appendable pTarget)
+      throws IOException {
+    if (pData.isEmpty()) {
+      pTarget.append("/>\n");
+      return;
+    }
+    pTarget.append(">\n");
+    for (Map.Entry<KeyDef, String> entry : pData) {
+      appendData(entry.getKey(), entry.getValue(), "   ", pTarget);
+    }
+    pTarget.append("  </").append(pTag.toString()).append(">\n");
+  }
+
+  private static void appendData(KeyDef pKey, String pValue, String pIndent, Appendable pTarget)
+      throws IOException {
+    pTarget.append(pIndent).append('<').append(GraphMLTag.DATA.toString());
+    appendAttribute("key", pKey.id, pTarget);
+    pTarget
+        .append('>')
+        .append(CONTENT_ESCAPER.escape(pValue))
+        .append("</")
+        .append(GraphMLTag.DATA.toString())
+        .append(">\n");
+  }
+
+  private static void appendAttribute(String pName, String pValue, Appendable pTarget)
+      throws IOException {
+    pTarget
+        .append(' ')
+        .append(pName)
+        .append("=\"")
+        .append(ATTRIBUTE_ESCAPER.escape(pValue))
+        .append('"');
+  }
+}
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.cpa.automaton;
 
 import static com.google.common.base.Preconditions.checkNotNull;
+import static org.sosy_lab.common.collect.Collections3.transformedImmutableSetCopy;
 
 import com.google.common.base.Joiner;
 import com.google.common.base.Optional;
@@ -72,6 +73,15 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
   abstract ResultValue<Boolean> eval(AutomatonExpressionArguments pArgs)
       throws CPATransferException;
 
+  /**
+   * Returns whether the result of {@link #eval} only depends on the CFA edge of the arguments, and
+   * not on the automaton state, the automaton variables, or the abstract states of other CPAs.
+   * Negative results of such expressions can be reused for every state that sees the same edge.
+   */
+  default boolean dependsOnlyOnEdge() {
+    return false;
+  }
+
   static enum MatchProgramExit implements AutomatonBoolExpr {
     INSTANCE;
 
@@ -84,6 +94,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "PROGRAM-EXIT";
@@ -143,6 +158,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "PROGRAM-ENTRY";
@@ -160,6 +180,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "LOOP-START";
@@ -182,6 +207,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "SUCCESSOR IN " + acceptedNodes;
@@ -292,6 +322,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return epsilonMatchVisitor.evaluation;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return expr.dependsOnlyOnEdge();
+    }
+
     @Override
     public String toString() {
       if (!continueAtBranching) {
@@ -363,6 +398,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH FUNCTION CALL STATEMENT \"" + functionName + "\"";
@@ -402,6 +442,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH FUNCTIONCALL \"" + functionName + "\"";
@@ -477,6 +522,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return Objects.hash(matchAssumeCase, matchFunctionCall);
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH FP-CALL("
@@ -519,6 +569,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH FUNCTION EXIT \"" + functionName + "\"";
@@ -559,6 +614,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
         }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH LABEL \"" + label + "\"";
@@ -604,6 +664,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH LABEL [" + pattern + "]";
@@ -661,6 +726,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH {"
@@ -686,6 +756,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH [" + pattern + "]";
@@ -726,6 +801,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH TRANSITION [" + predecessorNodeNumber + " -> " + successorNodeNumber + "]";
@@ -744,6 +824,52 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
     }
   }
 
+  /**
+   * Matches all CFA edges between the same nodes as one of the given edges, like a disjunction of
+   * {@link MatchCFAEdgeNodes} but with a constant-time lookup.
+   */
+  static class MatchAnyCFAEdgeNodes implements AutomatonBoolExpr {
+
+    private final ImmutableSet<Long> nodeNumberPairs;
+
+    MatchAnyCFAEdgeNodes(Collection<CFAEdge> pEdges) {
+      nodeNumberPairs = transformedImmutableSetCopy(pEdges, MatchAnyCFAEdgeNodes::nodeNumberPair);
+    }
+
+    private static long nodeNumberPair(CFAEdge pEdge) {
+      return ((long) pEdge.getPredecessor().getNodeNumber() << 32)
+          | (pEdge.getSuccessor().getNodeNumber() & 0xFFFFFFFFL);
+    }
+
+    @Override
+    public ResultValue<Boolean> eval(AutomatonExpressionArguments pArgs) {
+      return nodeNumberPairs.contains(nodeNumberPair(pArgs.getCfaEdge()))
+          ? CONST_TRUE
+          : CONST_FALSE;
+    }
+
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
+    @Override
+    public String toString() {
+      return "MATCH ANY OF " + nodeNumberPairs.size() + " TRANSITIONS";
+    }
+
+    @Override
+    public int hashCode() {
+      return nodeNumberPairs.hashCode();
+    }
+
+    @Override
+    public boolean equals(Object o) {
+      return o instanceof MatchAnyCFAEdgeNodes
+          && nodeNumberPairs.equals(((MatchAnyCFAEdgeNodes) o).nodeNumberPairs);
+    }
+  }
+
   static class MatchCFAEdgeExact implements AutomatonBoolExpr {
 
     private final String pattern;
@@ -761,6 +887,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH \"" + pattern + "\"";
@@ -790,6 +921,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH ASSERT";
@@ -804,6 +940,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return pArgs.getCfaEdge() instanceof AssumeEdge ? CONST_TRUE : CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH ASSUME EDGE";
@@ -835,6 +976,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH ASSUME CASE " + matchPositiveCase;
@@ -885,6 +1031,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return result;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return operandExpression.dependsOnlyOnEdge();
+    }
+
     @Override
     public String toString() {
       return String.format("MATCH FORALL SUCCESSOR EDGES (%s)", operandExpression);
@@ -975,6 +1126,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return edges;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return operandExpression.dependsOnlyOnEdge();
+    }
+
     @Override
     public String toString() {
       return String.format("MATCH EXISTS SUCCESSOR EDGE (%s)", operandExpression);
@@ -1001,6 +1157,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       return AutomatonGraphmlCommon.isSplitDeclaration(edge) ? CONST_TRUE : CONST_FALSE;
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH SPLIT DECLARATION";
@@ -1032,6 +1193,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
           .anyMatch(matchDescriptor);
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return true;
+    }
+
     @Override
     public String toString() {
       return "MATCH " + matchDescriptor;
@@ -1250,6 +1416,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
           return CONST_TRUE;
         }
 
+        @Override
+        public boolean dependsOnlyOnEdge() {
+          return true;
+        }
+
         @Override
         public String toString() {
           return "TRUE";
@@ -1264,6 +1435,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
           return CONST_FALSE;
         }
 
+        @Override
+        public boolean dependsOnlyOnEdge() {
+          return true;
+        }
+
         @Override
         public String toString() {
           return "FALSE";
@@ -1450,6 +1626,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return a.dependsOnlyOnEdge();
+    }
+
     @Override
     public String toString() {
       return "!" + a;
@@ -1508,6 +1689,11 @@ interface AutomatonBoolExpr extends AutomatonExpression<Boolean> {
       }
     }
 
+    @Override
+    public boolean dependsOnlyOnEdge() {
+      return a.dependsOnlyOnEdge() && b.dependsOnlyOnEdge();
+    }
+
     @Override
     public String toString() {
       return "(" + a + " " + repr + " " + b + ")";
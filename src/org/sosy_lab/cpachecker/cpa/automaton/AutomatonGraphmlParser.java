@@ -55,6 +55,10 @@ import javax.xml.parsers.DocumentBuilderFactory;
 import javax.xml.parsers.ParserConfigurationException;
 import javax.xml.parsers.SAXParser;
 import javax.xml.parsers.SAXParserFactory;
+import javax.xml.stream.XMLInputFactory;
+import javax.xml.stream.XMLStreamConstants;
+import javax.xml.stream.XMLStreamException;
+import javax.xml.stream.XMLStreamReader;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.collect.Collections3;
@@ -225,6 +229,14 @@ public class AutomatonGraphmlParser {
 
   private final Map<GraphMLState, ExpressionTree<AExpression>> stateInvariantsMap;
 
+  /**
+   * Matchers for the CFA edges that can or cannot change the data state, which are needed for
+   * every transition of an optimized ISA. They are computed on first use.
+   */
+  private @Nullable AutomatonBoolExpr stateChangingEdgesMatcher = null;
+
+  private @Nullable AutomatonBoolExpr nonStateChangingEdgesMatcher = null;
+
   public AutomatonGraphmlParser(
       Configuration pConfig,
       LogManager pLogger,
@@ -1851,23 +1863,27 @@ public class AutomatonGraphmlParser {
     List<AExpression> assumptionWithCExpr = Collections.singletonList(cExpr);
 
     if (optimizeISA) {
-      List<CFAEdge> stateChangingEdges = new ArrayList<>();
-      List<CFAEdge> nonStateChangingEdges = new ArrayList<>();
-      for (CFANode node : cfa.getAllNodes()) {
-        for (int i = 0; i < node.getNumLeavingEdges(); i++) {
-          CFAEdge edge = node.getLeavingEdge(i);
-          if (EnumSet.of(CFAEdgeType.BlankEdge, CFAEdgeType.AssumeEdge)
-              .contains(edge.getEdgeType())) {
-            nonStateChangingEdges.add(edge);
-          } else {
-            stateChangingEdges.add(edge);
+      if (stateChangingEdgesMatcher == null) {
+        List<CFAEdge> stateChangingEdges = new ArrayList<>();
+        List<CFAEdge> nonStateChangingEdges = new ArrayList<>();
+        for (CFANode node : cfa.getAllNodes()) {
+          for (int i = 0; i < node.getNumLeavingEdges(); i++) {
+            CFAEdge edge = node.getLeavingEdge(i);
+            if (EnumSet.of(CFAEdgeType.BlankEdge, CFAEdgeType.AssumeEdge)
+                .contains(edge.getEdgeType())) {
+              nonStateChangingEdges.add(edge);
+            } else {
+              stateChangingEdges.add(edge);
+            }
           }
         }
+        stateChangingEdgesMatcher = new AutomatonBoolExpr.MatchAnyCFAEdgeNodes(stateChangingEdges);
+        nonStateChangingEdgesMatcher =
+            new AutomatonBoolExpr.MatchAnyCFAEdgeNodes(nonStateChangingEdges);
       }
-      AutomatonBoolExpr changingTransition =
-          and(pTransitionCondition, matchAnyEdgeOf(stateChangingEdges));
+      AutomatonBoolExpr changingTransition = and(pTransitionCondition, stateChangingEdgesMatcher);
       AutomatonBoolExpr nonChangingTransition =
-          and(pTransitionCondition, matchAnyEdgeOf(nonStateChangingEdges));
+          and(pTransitionCondition, nonStateChangingEdgesMatcher);
 
       if (checkInvariantViolations) {
         // only transition to the error state if an edge matches that can change the data state,
@@ -1922,15 +1938,6 @@ public class AutomatonGraphmlParser {
     }
   }
 
-  private AutomatonBoolExpr matchAnyEdgeOf(List<CFAEdge> stateChangingEdges) {
-    AutomatonBoolExpr result = null;
-    for (CFAEdge edge : stateChangingEdges) {
-      AutomatonBoolExpr edgeTransition = new AutomatonBoolExpr.MatchCFAEdgeNodes(edge);
-      result = (result == null) ? edgeTransition : or(result, edgeTransition);
-    }
-    return result;
-  }
-
   private static class ViolationCopyingAutomatonTransition extends AutomatonTransition {
 
     private ViolationCopyingAutomatonTransition(Builder pBuilder) {
@@ -2126,30 +2133,73 @@ public class AutomatonGraphmlParser {
         e -> new WitnessParseException(e));
   }
 
+  /**
+   * Determines the witness type by streaming through the document instead of building a DOM,
+   * because only the data elements of the graph are needed.
+   */
   private static AutomatonGraphmlCommon.WitnessType getWitnessType(InputStream pInputStream)
       throws InvalidConfigurationException, IOException {
-    // Parse the XML document ----
-    DocumentBuilderFactory docFactory = DocumentBuilderFactory.newInstance();
-    Document doc;
+    Set<String> graphTypeText = new LinkedHashSet<>();
+    // Backwards-compatibility: type/graph-type
+    Optional<String> alternativeGraphTypeText = Optional.empty();
+    int graphs = 0;
     try {
-      DocumentBuilder docBuilder = docFactory.newDocumentBuilder();
-      doc = docBuilder.parse(pInputStream);
-    } catch (ParserConfigurationException | SAXException e) {
+      XMLInputFactory factory = XMLInputFactory.newInstance();
+      factory.setProperty(XMLInputFactory.SUPPORT_DTD, false);
+      factory.setProperty(XMLInputFactory.IS_SUPPORTING_EXTERNAL_ENTITIES, false);
+      XMLStreamReader reader = factory.createXMLStreamReader(pInputStream);
+      try {
+        int depth = 0;
+        int graphDepth = -1;
+        while (reader.hasNext()) {
+          int event = reader.next();
+          if (event == XMLStreamConstants.END_ELEMENT) {
+            depth--;
+          } else if (event == XMLStreamConstants.START_ELEMENT) {
+            String tag = reader.getLocalName();
+            if (tag.equals(GraphMLTag.GRAPH.toString())) {
+              graphs++;
+              graphDepth = depth;
+            } else if (tag.equals(GraphMLTag.DATA.toString()) && depth == graphDepth + 1) {
+              String key = reader.getAttributeValue(null, "key");
+              checkParsable(key != null, "Every data element must have a key attribute!");
+              // reads the text and consumes the end element
+              String text = reader.getElementText();
+              if (key.equals(KeyDef.WITNESS_TYPE.id)) {
+                graphTypeText.add(text);
+              } else if (key.equals("type") && alternativeGraphTypeText.isEmpty()) {
+                alternativeGraphTypeText = Optional.of(text);
+              }
+              continue;
+            }
+            depth++;
+          }
+        }
+      } finally {
+        reader.close();
+      }
+    } catch (XMLStreamException e) {
+      if (e.getNestedException() instanceof IOException) {
+        throw (IOException) e.getNestedException();
+      }
       throw new WitnessParseException(e);
     }
+    checkParsable(graphs == 1, TOO_MANY_GRAPHS_ERROR_MESSAGE);
 
-    // (The one) root node of the graph ----
-    NodeList graphs = doc.getElementsByTagName(GraphMLTag.GRAPH.toString());
-    checkParsable(graphs.getLength() == 1, TOO_MANY_GRAPHS_ERROR_MESSAGE);
-    Node graphNode = graphs.item(0);
-
-    checkRequiredField(graphNode, KeyDef.WITNESS_TYPE);
-
-    Set<String> graphTypeText = GraphMLDocumentData.getDataOnNode(graphNode, KeyDef.WITNESS_TYPE);
+    if (graphTypeText.isEmpty() && alternativeGraphTypeText.isPresent()) {
+      graphTypeText.add(alternativeGraphTypeText.orElseThrow());
+    }
+    checkParsable(
+        !graphTypeText.isEmpty(),
+        String.format(
+            "The witness does not contain the required field '%s'", KeyDef.WITNESS_TYPE.id));
+    checkParsable(
+        graphTypeText.stream().anyMatch(text -> !text.trim().isEmpty()),
+        String.format(
+            "The witness does not contain a non-empty entry for the required field '%s'",
+            KeyDef.WITNESS_TYPE.id));
     final WitnessType graphType;
-    if (graphTypeText.isEmpty()) {
-      graphType = WitnessType.VIOLATION_WITNESS;
-    } else if (graphTypeText.size() > 1) {
+    if (graphTypeText.size() > 1) {
       throw new WitnessParseException(AMBIGUOUS_TYPE_ERROR_MESSAGE);
     } else {
       String witnessTypeToParse = graphTypeText.iterator().next().trim();
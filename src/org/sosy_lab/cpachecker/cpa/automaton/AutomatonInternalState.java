@@ -9,13 +9,18 @@
 package org.sosy_lab.cpachecker.cpa.automaton;
 
 import com.google.common.collect.ImmutableList;
+import java.util.BitSet;
 import java.util.Collections;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.UniqueIdGenerator;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cpa.automaton.AutomatonExpression.ResultValue;
 import org.sosy_lab.cpachecker.cpa.automaton.AutomatonExpression.StringExpression;
+import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 
 /** Represents a State in the automaton.
  */
@@ -24,6 +29,9 @@ public class AutomatonInternalState {
   private static final UniqueIdGenerator idGenerator = new UniqueIdGenerator();
   private final int stateId = idGenerator.getFreshId();
 
+  /** Shared empty result of {@link #getTransitionsNotMatching}, must not be modified. */
+  private static final BitSet NO_TRANSITIONS = new BitSet(0);
+
   /** State representing BOTTOM */
   static final AutomatonInternalState BOTTOM =
       new AutomatonInternalState("_predefinedState_BOTTOM", ImmutableList.of()) {
@@ -75,6 +83,13 @@ public class AutomatonInternalState {
 
   private final boolean isCycleStart;
 
+  /**
+   * Caches for each CFA edge the indices of the transitions whose trigger only depends on the edge
+   * and does not match it, see {@link #getTransitionsNotMatching(CFAEdge, LogManager)}. This is
+   * only allocated if there is at least one such transition.
+   */
+  private final @Nullable Map<CFAEdge, BitSet> transitionsNotMatchingEdge;
+
   public AutomatonInternalState(
       String pName,
       List<AutomatonTransition> pTransitions,
@@ -86,6 +101,14 @@ public class AutomatonInternalState {
     this.mIsTarget = pIsTarget;
     this.mAllTransitions = pAllTransitions;
     this.isCycleStart = pIsCycleStart;
+    this.transitionsNotMatchingEdge =
+        transitions.stream()
+                .anyMatch(
+                    t ->
+                        t.getTrigger() != AutomatonBoolExpr.TRUE
+                            && t.getTrigger().dependsOnlyOnEdge())
+            ? new ConcurrentHashMap<>()
+            : null;
   }
 
   public AutomatonInternalState(
@@ -150,6 +173,38 @@ public class AutomatonInternalState {
     return this.name;
   }
 
+  /**
+   * Returns the indices of those transitions of this state whose trigger only depends on the CFA
+   * edge and does not match the given edge. These transitions can be skipped when computing the
+   * successors for this edge. The result is computed once per edge and then reused.
+   */
+  BitSet getTransitionsNotMatching(final CFAEdge pEdge, final LogManager pLogger) {
+    if (transitionsNotMatchingEdge == null) {
+      return NO_TRANSITIONS;
+    }
+    return transitionsNotMatchingEdge.computeIfAbsent(
+        pEdge, edge -> computeTransitionsNotMatching(edge, pLogger));
+  }
+
+  private BitSet computeTransitionsNotMatching(final CFAEdge pEdge, final LogManager pLogger) {
+    BitSet result = new BitSet(transitions.size());
+    for (int i = 0; i < transitions.size(); i++) {
+      AutomatonBoolExpr trigger = transitions.get(i).getTrigger();
+      if (trigger.dependsOnlyOnEdge()) {
+        try {
+          ResultValue<Boolean> match =
+              trigger.eval(new AutomatonExpressionArguments(null, null, null, pEdge, pLogger));
+          if (!match.canNotEvaluate() && !match.getValue()) {
+            result.set(i);
+          }
+        } catch (CPATransferException e) {
+          // the transfer relation evaluates this trigger again and reports the problem
+        }
+      }
+    }
+    return result.isEmpty() ? NO_TRANSITIONS : result;
+  }
+
   public boolean nontriviallyMatches(final CFAEdge pEdge, final LogManager pLogger) {
     for(AutomatonTransition trans : transitions) {
       if (trans.nontriviallyMatches(pEdge, pLogger)) {
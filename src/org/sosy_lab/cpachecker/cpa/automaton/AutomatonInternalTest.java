@@ -168,6 +168,19 @@ public class AutomatonInternalTest {
     assertThat(ex.eval(args).canNotEvaluate()).isTrue();
   }
 
+  @Test
+  public void testDependsOnlyOnEdge() {
+    AutomatonBoolExpr edgeMatch = new AutomatonBoolExpr.MatchCFAEdgeExact("x = 1;");
+    AutomatonBoolExpr query = new AutomatonBoolExpr.CPAQuery("none", "none");
+
+    assertThat(edgeMatch.dependsOnlyOnEdge()).isTrue();
+    assertThat(query.dependsOnlyOnEdge()).isFalse();
+    assertThat(new AutomatonBoolExpr.Negation(edgeMatch).dependsOnlyOnEdge()).isTrue();
+    assertThat(new AutomatonBoolExpr.And(edgeMatch, AutomatonBoolExpr.TRUE).dependsOnlyOnEdge())
+        .isTrue();
+    assertThat(new AutomatonBoolExpr.Or(edgeMatch, query).dependsOnlyOnEdge()).isFalse();
+  }
+
   @Test
   public void testJokerReplacementInPattern() {
     // tests the replacement of Joker expressions in the AST comparison
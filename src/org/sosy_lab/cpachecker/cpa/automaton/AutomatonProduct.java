@@ -0,0 +1,234 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.automaton;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableMap;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import java.util.Queue;
+import java.util.stream.Collectors;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cpa.automaton.AutomatonExpression.StringExpression;
+
+/**
+ * Builds the synchronous product of several specification automata, such that a single {@link
+ * ControlAutomatonCPA} can track all of them instead of one CPA per automaton.
+ *
+ * <p>Only automata for which {@link #isSupported(Automaton)} holds can be combined: they must be
+ * deterministic, must not have variables, and their transitions must only consist of a trigger
+ * that depends on nothing but the CFA edge, a follow state, and a violated-property description.
+ * For such automata the product is equivalent to running them side by side, except that only one
+ * property is reported if several automata reach their error state on the same edge.
+ */
+public final class AutomatonProduct {
+
+  private AutomatonProduct() {}
+
+  /** Returns whether the given automaton can be part of a product built by this class. */
+  public static boolean isSupported(Automaton pAutomaton) {
+    if (!pAutomaton.getInitialVariables().isEmpty() || pAutomaton.getInitialState().isTarget()) {
+      return false;
+    }
+    for (AutomatonInternalState state : pAutomaton.getStates()) {
+      if (state.isNonDetState() || state.isNontrivialCycleStart()) {
+        return false;
+      }
+      for (AutomatonTransition t : state.getTransitions()) {
+        AutomatonInternalState followState = t.getFollowState();
+        if (!t.hasOnlyTriggerAndFollowState()
+            || !t.getTrigger().dependsOnlyOnEdge()
+            || followState.equals(AutomatonInternalState.BREAK)
+            || (followState.isTarget() && !followState.equals(AutomatonInternalState.ERROR))) {
+          return false;
+        }
+        StringExpression description = t.getViolatedPropertyDescriptionExpression();
+        if (description != null && refersToVariables(description.toString())) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  private static boolean refersToVariables(String pDescription) {
+    return pDescription.contains("$$")
+        || AutomatonExpressionArguments.TRANSITION_VARS_PATTERN.matcher(pDescription).find();
+  }
+
+  /**
+   * Builds the product of the given automata, which all need to be {@link #isSupported(Automaton)
+   * supported}.
+   *
+   * @param pName the name of the product automaton
+   * @param pAutomata the automata to combine
+   * @param pMaxStates the maximal number of states of the product automaton
+   * @return the product automaton, or an empty optional if it would have more than the given
+   *     number of states
+   */
+  public static Optional<Automaton> build(String pName, List<Automaton> pAutomata, int pMaxStates)
+      throws InvalidAutomatonException {
+    if (pAutomata.isEmpty()) {
+      throw new IllegalArgumentException("Cannot build the product of zero automata");
+    }
+    Automaton product = pAutomata.get(0);
+    for (Automaton automaton : pAutomata.subList(1, pAutomata.size())) {
+      Optional<Automaton> next = buildProduct(pName, product, automaton, pMaxStates);
+      if (!next.isPresent()) {
+        return Optional.empty();
+      }
+      product = next.orElseThrow();
+    }
+    return Optional.of(product);
+  }
+
+  private static Optional<Automaton> buildProduct(
+      String pName, Automaton pFirst, Automaton pSecond, int pMaxStates)
+      throws InvalidAutomatonException {
+    Map<List<AutomatonInternalState>, String> stateNames = new HashMap<>();
+    Queue<List<AutomatonInternalState>> waitlist = new ArrayDeque<>();
+    List<AutomatonInternalState> states = new ArrayList<>();
+
+    List<AutomatonInternalState> initialState =
+        ImmutableList.of(pFirst.getInitialState(), pSecond.getInitialState());
+    stateNames.put(initialState, getStateName(initialState));
+    waitlist.add(initialState);
+
+    while (!waitlist.isEmpty()) {
+      if (stateNames.size() > pMaxStates) {
+        return Optional.empty();
+      }
+      List<AutomatonInternalState> current = waitlist.poll();
+      List<AutomatonTransition> transitions = new ArrayList<>();
+
+      for (Choice first : getChoices(pFirst, current.get(0))) {
+        for (Choice second : getChoices(pSecond, current.get(1))) {
+          if (first.isStay && second.isStay) {
+            // no transition matches in either automaton, so the product does not match either
+            continue;
+          }
+          AutomatonBoolExpr trigger = and(first.condition, second.condition);
+          AutomatonTransition.Builder builder;
+          if (first.followState.equals(AutomatonInternalState.BOTTOM)
+              || second.followState.equals(AutomatonInternalState.BOTTOM)) {
+            // a composite state with a bottom component has no successor, even if another
+            // component reaches its error state
+            builder = new AutomatonTransition.Builder(trigger, AutomatonInternalState.BOTTOM);
+          } else if (first.followState.equals(AutomatonInternalState.ERROR)) {
+            builder =
+                new AutomatonTransition.Builder(trigger, AutomatonInternalState.ERROR)
+                    .withViolatedPropertyDescription(first.description);
+          } else if (second.followState.equals(AutomatonInternalState.ERROR)) {
+            builder =
+                new AutomatonTransition.Builder(trigger, AutomatonInternalState.ERROR)
+                    .withViolatedPropertyDescription(second.description);
+          } else {
+            List<AutomatonInternalState> successor =
+                ImmutableList.of(first.followState, second.followState);
+            String successorName = stateNames.get(successor);
+            if (successorName == null) {
+              successorName = getStateName(successor);
+              stateNames.put(successor, successorName);
+              waitlist.add(successor);
+            }
+            builder = new AutomatonTransition.Builder(trigger, successorName);
+          }
+          transitions.add(builder.build());
+        }
+      }
+      states.add(new AutomatonInternalState(stateNames.get(current), transitions));
+    }
+
+    return Optional.of(
+        new Automaton(pName, ImmutableMap.of(), states, stateNames.get(initialState)));
+  }
+
+  private static String getStateName(List<AutomatonInternalState> pStates) {
+    return pStates.stream()
+        .map(AutomatonInternalState::getName)
+        .collect(Collectors.joining(", ", "(", ")"));
+  }
+
+  /**
+   * Returns the possible moves of the given automaton in the given state. Because the state is
+   * deterministic, the first matching transition is taken, so the condition of each choice
+   * includes that all previous triggers do not match. The last choice (if present) is to stay in
+   * the state because no trigger matches.
+   */
+  private static List<Choice> getChoices(Automaton pAutomaton, AutomatonInternalState pState) {
+    List<Choice> choices = new ArrayList<>(pState.getTransitions().size() + 1);
+    AutomatonBoolExpr noneMatched = AutomatonBoolExpr.TRUE;
+    for (AutomatonTransition t : pState.getTransitions()) {
+      AutomatonBoolExpr trigger = t.getTrigger();
+      choices.add(
+          new Choice(
+              and(noneMatched, trigger),
+              t.getFollowState(),
+              getViolatedPropertyDescription(pAutomaton, t),
+              false));
+      if (trigger == AutomatonBoolExpr.TRUE) {
+        // all later transitions are unreachable
+        return choices;
+      }
+      noneMatched = and(noneMatched, new AutomatonBoolExpr.Negation(trigger));
+    }
+    choices.add(new Choice(noneMatched, pState, null, true));
+    return choices;
+  }
+
+  /**
+   * Returns the description that makes the product report the same property as the given
+   * automaton would (cf. {@link AutomatonTransition#getViolatedPropertyDescription} and {@link
+   * AutomatonSafetyProperty#toString()}).
+   */
+  private static @Nullable StringExpression getViolatedPropertyDescription(
+      Automaton pAutomaton, AutomatonTransition pTransition) {
+    if (!pTransition.getFollowState().equals(AutomatonInternalState.ERROR)) {
+      return null;
+    }
+    StringExpression description = pTransition.getViolatedPropertyDescriptionExpression();
+    if (description == null) {
+      return new StringExpression(AutomatonInternalState.ERROR.getName());
+    } else if (description.toString().isEmpty()) {
+      return new StringExpression(pAutomaton.getName());
+    }
+    return description;
+  }
+
+  private static AutomatonBoolExpr and(AutomatonBoolExpr pA, AutomatonBoolExpr pB) {
+    if (pA == AutomatonBoolExpr.TRUE) {
+      return pB;
+    } else if (pB == AutomatonBoolExpr.TRUE) {
+      return pA;
+    }
+    return new AutomatonBoolExpr.And(pA, pB);
+  }
+
+  private static final class Choice {
+    private final AutomatonBoolExpr condition;
+    private final AutomatonInternalState followState;
+    private final @Nullable StringExpression description;
+    private final boolean isStay;
+
+    private Choice(
+        AutomatonBoolExpr pCondition,
+        AutomatonInternalState pFollowState,
+        @Nullable StringExpression pDescription,
+        boolean pIsStay) {
+      condition = pCondition;
+      followState = pFollowState;
+      description = pDescription;
+      isStay = pIsStay;
+    }
+  }
+}
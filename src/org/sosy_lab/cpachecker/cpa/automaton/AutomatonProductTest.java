@@ -0,0 +1,103 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.automaton;
+
+import static com.google.common.truth.Truth.assertThat;
+import static com.google.common.truth.Truth8.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableMap;
+import java.util.Optional;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cpa.automaton.AutomatonExpression.StringExpression;
+
+public class AutomatonProductTest {
+
+  private static AutomatonTransition transition(String pStatement, String pFollowState) {
+    return new AutomatonTransition.Builder(
+            new AutomatonBoolExpr.MatchCFAEdgeExact(pStatement), pFollowState)
+        .build();
+  }
+
+  private static AutomatonTransition error(AutomatonBoolExpr pTrigger, String pDescription) {
+    return new AutomatonTransition.Builder(pTrigger, AutomatonInternalState.ERROR)
+        .withViolatedPropertyDescription(new StringExpression(pDescription))
+        .build();
+  }
+
+  private static AutomatonBoolExpr matchFree() {
+    return new AutomatonBoolExpr.MatchCFAEdgeExact("free(p);");
+  }
+
+  private static Automaton lockAutomaton() throws InvalidAutomatonException {
+    return new Automaton(
+        "Lock",
+        ImmutableMap.of(),
+        ImmutableList.of(
+            new AutomatonInternalState(
+                "Unlocked", ImmutableList.of(transition("lock();", "Locked"))),
+            new AutomatonInternalState(
+                "Locked",
+                ImmutableList.of(
+                    error(new AutomatonBoolExpr.MatchCFAEdgeExact("lock();"), "double lock"),
+                    transition("unlock();", "Unlocked")))),
+        "Unlocked");
+  }
+
+  private static Automaton freeAutomaton(AutomatonBoolExpr pTrigger)
+      throws InvalidAutomatonException {
+    return new Automaton(
+        "Free",
+        ImmutableMap.of(),
+        ImmutableList.of(
+            new AutomatonInternalState("Init", ImmutableList.of(error(pTrigger, "")))),
+        "Init");
+  }
+
+  @Test
+  public void testIsSupported() throws InvalidAutomatonException {
+    assertThat(AutomatonProduct.isSupported(lockAutomaton())).isTrue();
+    assertThat(
+            AutomatonProduct.isSupported(
+                freeAutomaton(matchFree())))
+        .isTrue();
+    assertThat(
+            AutomatonProduct.isSupported(
+                freeAutomaton(new AutomatonBoolExpr.CPAQuery("none", "none"))))
+        .isFalse();
+  }
+
+  @Test
+  public void testProduct() throws InvalidAutomatonException {
+    Optional<Automaton> product =
+        AutomatonProduct.build(
+            "Product",
+            ImmutableList.of(lockAutomaton(), freeAutomaton(matchFree())),
+            10);
+
+    assertThat(product).isPresent();
+    Automaton automaton = product.orElseThrow();
+    assertThat(automaton.getNumberOfStates()).isEqualTo(2);
+    assertThat(automaton.getInitialState().getName()).isEqualTo("(Unlocked, Init)");
+    // lock or free in the unlocked state
+    assertThat(automaton.getInitialState().getTransitions()).hasSize(3);
+    assertThat(AutomatonProduct.isSupported(automaton)).isTrue();
+  }
+
+  @Test
+  public void testProductTooLarge() throws InvalidAutomatonException {
+    Optional<Automaton> product =
+        AutomatonProduct.build(
+            "Product",
+            ImmutableList.of(lockAutomaton(), freeAutomaton(matchFree())),
+            1);
+
+    assertThat(product).isEmpty();
+  }
+}
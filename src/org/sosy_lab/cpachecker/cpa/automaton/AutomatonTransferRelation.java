@@ -19,6 +19,7 @@ import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import com.google.common.collect.Maps;
 import java.util.ArrayList;
+import java.util.BitSet;
 import java.util.Collection;
 import java.util.Iterator;
 import java.util.LinkedHashSet;
@@ -175,7 +176,19 @@ public class AutomatonTransferRelation implements TransferRelation {
     List<Pair<AutomatonTransition, Map<Integer, AAstNode>>> transitionsToBeTaken =
         new ArrayList<>(2);
 
-    for (AutomatonTransition t : state.getInternalState().getTransitions()) {
+    ImmutableList<AutomatonTransition> transitions = state.getInternalState().getTransitions();
+    BitSet transitionsNotMatching =
+        cpa.isCachingNonMatchingTransitions()
+            ? state.getInternalState().getTransitionsNotMatching(edge, logger)
+            : new BitSet(0);
+
+    for (int i = 0; i < transitions.size(); i++) {
+      AutomatonTransition t = transitions.get(i);
+      if (transitionsNotMatching.get(i)) {
+        // the trigger only depends on the edge and is known not to match it
+        failedMatches++;
+        continue;
+      }
       exprArgs.clearTransitionVariables();
 
       matchTime.start();
@@ -308,6 +308,21 @@ class AutomatonTransition {
     return trigger;
   }
 
+  @Nullable StringExpression getViolatedPropertyDescriptionExpression() {
+    return violatedPropertyDescription;
+  }
+
+  /**
+   * Returns whether this transition does nothing except for moving to its follow state, i.e., it
+   * has no assertions, assumptions, actions, or candidate invariants.
+   */
+  boolean hasOnlyTriggerAndFollowState() {
+    return assertion == AutomatonBoolExpr.TRUE
+        && assumptions.isEmpty()
+        && actions.isEmpty()
+        && ExpressionTrees.getTrue().equals(candidateInvariants);
+  }
+
   public String getViolatedPropertyDescription(AutomatonExpressionArguments pArgs) {
     if (violatedPropertyDescription == null) {
       if (getFollowState().isTarget()) {
@@ -134,6 +134,15 @@ public class ControlAutomatonCPA
   )
   private boolean topOnFinalSelfLoopingState = false;
 
+  @Option(
+      secure = true,
+      description =
+          "Remember for each automaton state and CFA edge which transitions can not match the"
+              + " edge regardless of the automaton variables and other CPAs, such that their"
+              + " triggers are not evaluated again for the same edge. This trades memory for time"
+              + " in automata with many transitions per state.")
+  private boolean cacheNonMatchingTransitions = true;
+
   private final Automaton automaton;
   private final AutomatonState topState;
   private final AutomatonState bottomState;
@@ -330,6 +339,10 @@ public class ControlAutomatonCPA
     return successors.equals(actualSuccessors);
   }
 
+  boolean isCachingNonMatchingTransitions() {
+    return cacheNonMatchingTransitions;
+  }
+
   boolean isTreatingErrorsAsTargets() {
     return treatErrorsAsTargets;
   }
@@ -39,6 +39,7 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.Precisions;
 import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer.TimerWrapper;
+import org.sosy_lab.cpachecker.util.statistics.TraceEvents.ARGSubtreeRemovalEvent;
 
 public class ARGCopyOnWriteSubtreeRemover extends ARGSubtreeRemover {
 
@@ -59,6 +60,9 @@ public class ARGCopyOnWriteSubtreeRemover extends ARGSubtreeRemover {
       List<Predicate<? super Precision>> pNewPrecisionTypes)
       throws InterruptedException {
 
+    ARGSubtreeRemovalEvent event = new ARGSubtreeRemovalEvent(pPath.size());
+    event.begin();
+
     final BackwardARGState cutState = (BackwardARGState) pState;
     final ARGState cutPointAsArgState = getReachedState(cutState);
     Preconditions.checkArgument(pNewPrecisions.size() == pNewPrecisionTypes.size());
@@ -70,6 +74,7 @@ public class ARGCopyOnWriteSubtreeRemover extends ARGSubtreeRemover {
         getBlockInitAndExitStates(pPath.asStatesList());
     List<BackwardARGState> relevantCallStates =
         getRelevantCallStates(pPath.asStatesList(), cutState);
+    event.setAffectedBlocks(relevantCallStates.size());
     //  assert relevantCallStates.peekLast() == path.getFirstState()
     //      : "root should be relevant: " + relevantCallStates.peekLast() + " + " +
     // path.getFirstState();
@@ -129,6 +134,8 @@ public class ARGCopyOnWriteSubtreeRemover extends ARGSubtreeRemover {
         }
       }
     }
+
+    event.commit();
   }
 
   private boolean mustUpdatePrecision(
@@ -229,14 +229,17 @@ public class ARGInPlaceSubtreeRemover extends ARGSubtreeRemover {
     }
 
     ARGReachedSet argReachedSet = new ARGReachedSet(reachedSet);
-    if (pNewPrecisions.isEmpty()) {
-      // no new precision needed, simply remove the subtree
+    final Precision oldPrecision = reachedSet.getPrecision(removeElement);
+    final Pair<Precision, Predicate<? super Precision>> newPrecision =
+        pNewPrecisions.isEmpty()
+            ? null
+            : getUpdatedPrecision(oldPrecision, pNewPrecisions, pPrecisionTypes);
+    if (newPrecision == null || oldPrecision.equals(newPrecision.getFirst())) {
+      // no new precision needed (or the refinement did not change the precision of this block),
+      // simply remove the subtree and keep the rest of the cached reached-set.
       removeSubtree(argReachedSet, removeElement);
 
     } else {
-      final Pair<Precision, Predicate<? super Precision>> newPrecision =
-          getUpdatedPrecision(
-              reachedSet.getPrecision(removeElement), pNewPrecisions, pPrecisionTypes);
       if (removeElement.getParents().contains(reachedSet.getFirstState())) {
         // after removing the state, only the root-state (and maybe other branches
         // starting at root) would remain, with a new precision for root.
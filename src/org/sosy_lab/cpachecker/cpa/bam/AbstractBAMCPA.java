@@ -22,8 +22,10 @@ import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
 import org.sosy_lab.cpachecker.cfa.blocks.BlockPartitioning;
 import org.sosy_lab.cpachecker.cfa.blocks.BlockToDotWriter;
 import org.sosy_lab.cpachecker.cfa.blocks.builder.BlockPartitioningBuilder;
@@ -127,7 +129,7 @@ public abstract class AbstractBAMCPA extends AbstractSingleWrapperCPA {
     blockPartitioningTimer.stop();
 
     argStats = new BAMARGStatistics(pConfig, pLogger, this, pCpa, pSpecification, pCfa);
-    exporter = new BAMReachedSetExporter(pConfig, pLogger, this);
+    exporter = new BAMReachedSetExporter(pConfig, pLogger, this, pCfa);
     stats = new BAMCPAStatistics(pConfig, pLogger, this);
 
     reducerStatistics = new TimedReducer.ReducerStatistics();
@@ -192,6 +194,11 @@ public abstract class AbstractBAMCPA extends AbstractSingleWrapperCPA {
     return stats;
   }
 
+  /** Register the time of a (partial) analysis of a block, e.g., from parallel BAM. */
+  public void addTimeForBlock(Block pBlock, TimeSpan pTime) {
+    stats.addTimeForBlock(pBlock, pTime);
+  }
+
   /** only public for statistics */
   public abstract BAMDataManager getData();
 
@@ -10,9 +10,12 @@ package org.sosy_lab.cpachecker.cpa.bam;
 
 import com.google.common.base.Function;
 import com.google.common.base.Preconditions;
+import com.google.common.collect.Iterables;
 import java.util.Collection;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -31,6 +34,7 @@ import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.pcc.ProofChecker;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
 import org.sosy_lab.cpachecker.core.specification.Specification;
+import org.sosy_lab.cpachecker.cpa.arg.ARGCPA;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCache;
 import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCacheAggressiveImpl;
@@ -68,6 +72,17 @@ public class BAMCPA extends AbstractBAMCPA implements StatisticsProvider, ProofC
       description = "Should the nested CPA-algorithm be wrapped with CEGAR within BAM?")
   private boolean useCEGAR = false;
 
+  @Option(
+      secure = true,
+      description =
+          "maximum number of cache entries per block and precision (0 for no limit). If the limit"
+              + " is reached, new block entries reuse the summary of a covering entry or are"
+              + " generalized with the merge operator of the wrapped analysis, if possible.")
+  @IntegerOption(min = 0)
+  private int maxEntriesPerBlock = 0;
+
+  private final @Nullable BlockSummaryGeneralizer summaryGeneralizer;
+
   private BAMCPA(
       ConfigurableProgramAnalysis pCpa,
       Configuration config,
@@ -102,6 +117,27 @@ public class BAMCPA extends AbstractBAMCPA implements StatisticsProvider, ProofC
         this,
         data);
 
+    if (maxEntriesPerBlock > 0) {
+      if (handleRecursiveProcedures) {
+        throw new InvalidConfigurationException(
+            "Limiting the number of entries per block is not supported for recursive procedures.");
+      }
+      if (!(getWrappedCpa() instanceof ARGCPA)) {
+        throw new InvalidConfigurationException(
+            "Limiting the number of entries per block requires ARGCPA as wrapped CPA.");
+      }
+      ConfigurableProgramAnalysis analysis =
+          Iterables.getOnlyElement(((ARGCPA) getWrappedCpa()).getWrappedCPAs());
+      summaryGeneralizer =
+          new BlockSummaryGeneralizer(
+              maxEntriesPerBlock,
+              analysis.getAbstractDomain(),
+              analysis.getMergeOperator(),
+              getStatistics());
+    } else {
+      summaryGeneralizer = null;
+    }
+
     AlgorithmFactory factory = new CPAAlgorithmFactory(this, logger, config, pShutdownNotifier);
     if (useCEGAR) {
       // We will use this single instance of CEGARAlgFactory for the whole analysis.
@@ -151,6 +187,10 @@ public class BAMCPA extends AbstractBAMCPA implements StatisticsProvider, ProofC
     return data;
   }
 
+  @Nullable BlockSummaryGeneralizer getBlockSummaryGeneralizer() {
+    return summaryGeneralizer;
+  }
+
   public BAMPCCManager getBamPccManager() {
     return bamPccManager;
   }
@@ -57,6 +57,10 @@ class BAMCPAStatistics implements Statistics {
   final StatCounter preciseCex = new StatCounter("Number of precise counterexamples");
 
   final StatCounter algorithmInstances = new StatCounter("Number of created nested algortihms");
+  final StatCounter coveredBlockEntries =
+      new StatCounter("Number of block entries with a covering summary");
+  final StatCounter mergedBlockEntries =
+      new StatCounter("Number of block entries with a merged summary");
   final StatHist depthsOfTargetStates =
       new StatHist("Nesting level of target states with caching") {
         @Override
@@ -86,6 +90,9 @@ class BAMCPAStatistics implements Statistics {
   private int maxRecursiveDepth = 0;
   private final Map<Block, Timer> timeForBlock = new LinkedHashMap<>();
 
+  /** times measured by parallel BAM, where several threads analyze blocks at the same time */
+  private final Map<Block, TimeSpan> parallelTimeForBlock = new LinkedHashMap<>();
+
   public BAMCPAStatistics(Configuration pConfig, LogManager pLogger, AbstractBAMCPA pCpa)
       throws InvalidConfigurationException {
     pConfig.inject(this);
@@ -109,6 +116,11 @@ class BAMCPAStatistics implements Statistics {
     // TODO how and when can we start and stop the timer of the main-block?
   }
 
+  /** to be called after a (partial) analysis of a block in parallel BAM, thread-safe. */
+  synchronized void addTimeForBlock(Block block, TimeSpan time) {
+    parallelTimeForBlock.merge(block, time, (t1, t2) -> TimeSpan.sum(t1, t2));
+  }
+
   @Override
   public void printStatistics(PrintStream out, Result result, UnmodifiableReachedSet reached) {
 
@@ -120,6 +132,10 @@ class BAMCPAStatistics implements Statistics {
     put(out, 0, cpa.reducerStatistics.reducePrecisionTime);
     put(out, 0, cpa.reducerStatistics.expandPrecisionTime);
     put(out, 0, algorithmInstances);
+    if (coveredBlockEntries.getValue() > 0 || mergedBlockEntries.getValue() > 0) {
+      put(out, 0, coveredBlockEntries);
+      put(out, 0, mergedBlockEntries);
+    }
     if (depthsOfTargetStates.getUpdateCount() > 0) {
       put(out, 0, depthsOfTargetStates);
       put(out, 0, depthsOfFoundTargetStates);
@@ -138,29 +154,41 @@ class BAMCPAStatistics implements Statistics {
     writeBlockStatistics(out);
   }
 
-  private void writeBlockStatistics(PrintStream out) {
+  private synchronized void writeBlockStatistics(PrintStream out) {
 
-    if (timeForBlock.isEmpty()) {
+    if (timeForBlock.isEmpty() && parallelTimeForBlock.isEmpty()) {
       return;
     }
 
     out.println("\nBlock statistics:");
 
     // collect data
+    Map<Block, TimeSpan> times = new LinkedHashMap<>();
+    for (Entry<Block, Timer> entry : timeForBlock.entrySet()) {
+      entry.getValue().stopIfRunning();
+      times.put(entry.getKey(), entry.getValue().getSumTime());
+    }
+    parallelTimeForBlock.forEach(
+        (block, time) -> times.merge(block, time, (t1, t2) -> TimeSpan.sum(t1, t2)));
+
     StatHist allTimers = new StatHist("time for block");
-    for (Timer timer : timeForBlock.values()) {
-      timer.stopIfRunning();
-      allTimers.insertValue(timer.getSumTime().asMillis());
+    // ranges of powers of two, such that the histogram stays readable
+    StatHist histogram = new StatHist("Histogram of time for block analysis (ms, rounded down)");
+    for (TimeSpan time : times.values()) {
+      long millis = time.asMillis();
+      allTimers.insertValue(millis);
+      histogram.insertValue(Long.highestOneBit(millis));
     }
 
     // write data
-    put(out, 1, "Analyzed blocks", timeForBlock.size());
+    put(out, 1, "Analyzed blocks", times.size());
     put(out, 1, "Avg. time for block analysis", ofMillis((long) allTimers.getAvg()));
     put(out, 1, "Mean time for block analysis", ofMillis(allTimers.getMean()));
     put(out, 1, "Min time for block analysis", ofMillis(allTimers.getMin()));
     put(out, 1, "Max time for block analysis", ofMillis(allTimers.getMax()));
     put(out, 1, "StdDev time for block analysis", ofMillis((long) allTimers.getStdDeviation()));
     put(out, 1, "Total time for block analysis", ofMillis((long) allTimers.getSum()));
+    put(out, 1, histogram);
 
     if (timeForBlock.containsKey(cpa.getBlockPartitioning().getMainBlock())) {
       put(
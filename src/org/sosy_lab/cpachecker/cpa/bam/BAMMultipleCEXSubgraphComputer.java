@@ -79,8 +79,9 @@ public class BAMMultipleCEXSubgraphComputer extends BAMSubgraphComputer{
       for (final ARGState child : currentState.getChildren()) {
         // if a child is not in the subgraph, it does not lead to the target, so ignore it.
         // Because of the ordering, all important children should be finished already.
-        if (elementsMap.containsKey(child)) {
-          childrenInSubgraph.add(elementsMap.get(child));
+        final BackwardARGState newChild = elementsMap.get(child);
+        if (newChild != null) {
+          childrenInSubgraph.add(newChild);
         }
       }
 
@@ -166,7 +167,7 @@ public class BAMMultipleCEXSubgraphComputer extends BAMSubgraphComputer{
   }
 
   private boolean checkRepeatitionOfState(ARGState currentElement) {
-    if (currentElement != null && getStateId != null) {
+    if (currentElement != null && getStateId != null && !remainingStates.isEmpty()) {
       Integer currentId = getStateId.apply(currentElement);
       for (ArrayDeque<Integer> rest : remainingStates) {
         if (rest.getLast().equals(currentId)) {
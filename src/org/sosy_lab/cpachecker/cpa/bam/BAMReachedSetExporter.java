@@ -33,6 +33,9 @@ import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.io.IO;
 import org.sosy_lab.common.io.PathTemplate;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.cfa.model.FunctionSummaryEdge;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
@@ -42,6 +45,8 @@ import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.cpa.arg.ARGToDotWriter;
 import org.sosy_lab.cpachecker.cpa.bam.cache.BAMDataManager;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.CFAFingerprints;
 
 @Options(prefix = "cpa.bam")
 class BAMReachedSetExporter implements Statistics {
@@ -61,15 +66,27 @@ class BAMReachedSetExporter implements Statistics {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private Path simplifiedArgFile = Paths.get("BlockedARGSimplified.dot");
 
+  @Option(
+      secure = true,
+      description =
+          "export the summaries of all cached blocks, i.e., the reduced input state and the "
+              + "output states of each block, together with the fingerprints of the functions "
+              + "of the block. This allows to match the summaries with the blocks of another "
+              + "version of the program.")
+  @FileOption(FileOption.Type.OUTPUT_FILE)
+  private @Nullable Path blockSummaryFile = null;
+
   private final LogManager logger;
   private final AbstractBAMCPA bamcpa;
+  private final CFA cfa;
 
-
-  BAMReachedSetExporter(Configuration pConfig, LogManager pLogger, AbstractBAMCPA pCpa)
+  BAMReachedSetExporter(
+      Configuration pConfig, LogManager pLogger, AbstractBAMCPA pCpa, CFA pCfa)
       throws InvalidConfigurationException {
     pConfig.inject(this);
     logger = pLogger;
     bamcpa = pCpa;
+    cfa = pCfa;
   }
 
   private static boolean highlightSummaryEdge(ARGState firstState, ARGState secondState) {
@@ -85,6 +102,46 @@ class BAMReachedSetExporter implements Statistics {
   public void printStatistics(PrintStream pOut, Result pResult, UnmodifiableReachedSet pReached) {
     exportAllReachedSets(argFile, indexedArgFile, pReached);
     exportUsedReachedSets(simplifiedArgFile, pReached);
+    exportBlockSummaries(blockSummaryFile);
+  }
+
+  /**
+   * Write one entry per cached reached-set: a line with the function of the block entry and the
+   * fingerprints of all functions of the block, a line with the reduced input state, and one line
+   * per output state, i.e., per state at a return node of the block without successors.
+   */
+  private void exportBlockSummaries(final @Nullable Path file) {
+    if (file == null) {
+      return;
+    }
+    final CFAFingerprints fingerprints = CFAFingerprints.of(cfa);
+    try (Writer w = IO.openOutputFile(file, Charset.defaultCharset())) {
+      for (ReachedSet reachedSet : bamcpa.getData().getCache().getAllCachedReachedStates()) {
+        final ARGState rootState = (ARGState) reachedSet.getFirstState();
+        final CFANode rootNode = AbstractStates.extractLocation(rootState);
+        final Block block = bamcpa.getBlockPartitioning().getBlockForCallNode(rootNode);
+        w.append("block ").append(rootNode.getFunctionName());
+        for (String function : block.getFunctions()) {
+          w.append(' ').append(function).append('=').append(fingerprints.getHash(function));
+        }
+        w.append("\n  input ").append(toLine(rootState.getWrappedState())).append('\n');
+        for (AbstractState state : reachedSet) {
+          ARGState argState = (ARGState) state;
+          if (argState.getChildren().isEmpty()
+              && !argState.isCovered()
+              && block.getReturnNodes().contains(AbstractStates.extractLocation(argState))) {
+            w.append("  output ").append(toLine(argState.getWrappedState())).append('\n');
+          }
+        }
+      }
+    } catch (IOException e) {
+      logger.logUserException(
+          Level.WARNING, e, String.format("Could not write block summaries to file: %s", file));
+    }
+  }
+
+  private static String toLine(AbstractState pState) {
+    return pState.toString().replace('\n', ' ');
   }
 
   private void exportAllReachedSets(
@@ -146,8 +146,9 @@ public class BAMSubgraphComputer {
       for (final ARGState child : currentState.getChildren()) {
         // if a child is not in the subgraph, it does not lead to the target, so ignore it.
         // Because of the ordering, all important children should be finished already.
-        if (finishedStates.containsKey(child)) {
-          childrenInSubgraph.add(finishedStates.get(child));
+        final BackwardARGState newChild = finishedStates.get(child);
+        if (newChild != null) {
+          childrenInSubgraph.add(newChild);
         }
       }
 
@@ -253,9 +254,11 @@ public class BAMSubgraphComputer {
     for (final ReachedSet reachedSet : reachedSets.keySet()) {
       final BackwardARGState newInnerRoot;
       try {
+        // only copy the paths towards the targets of this reached set,
+        // the targets in other reached sets are handled in their own iteration.
         newInnerRoot =
             computeCounterexampleSubgraph(
-                new ARGReachedSet(reachedSet), newExpandedToNewInnerTargets.values());
+                new ARGReachedSet(reachedSet), reachedSets.get(reachedSet));
       } catch (MissingBlockException e) {
         // enforce recomputation to update cached subtree
         logger.log(
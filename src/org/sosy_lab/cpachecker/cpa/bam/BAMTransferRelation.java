@@ -43,6 +43,7 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.CFAUtils;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.Triple;
+import org.sosy_lab.cpachecker.util.statistics.TraceEvents.BAMBlockEvent;
 
 public class BAMTransferRelation extends AbstractBAMTransferRelation<CPAException> {
 
@@ -57,6 +58,7 @@ public class BAMTransferRelation extends AbstractBAMTransferRelation<CPAExceptio
   private final BAMCPAStatistics stats;
 
   private final boolean searchTargetStatesOnExit;
+  private final @Nullable BlockSummaryGeneralizer summaryGeneralizer;
 
   public BAMTransferRelation(
       BAMCPA bamCpa,
@@ -73,6 +75,7 @@ public class BAMTransferRelation extends AbstractBAMTransferRelation<CPAExceptio
     bamPccManager = pBamPccManager;
     stats = bamCpa.getStatistics();
     searchTargetStatesOnExit = pSearchTargetStatesOnExit;
+    summaryGeneralizer = bamCpa.getBlockSummaryGeneralizer();
   }
 
   @Override
@@ -180,10 +183,15 @@ public class BAMTransferRelation extends AbstractBAMTransferRelation<CPAExceptio
     assert innerSubtree.getCallNodes().contains(node);
 
     logger.log(Level.FINEST, "Reducing state", initialState);
-    final AbstractState reducedInitialState =
-        wrappedReducer.getVariableReducedState(initialState, innerSubtree, node);
     final Precision reducedInitialPrecision =
         wrappedReducer.getVariableReducedPrecision(pPrecision, innerSubtree);
+    AbstractState reducedInitialState =
+        wrappedReducer.getVariableReducedState(initialState, innerSubtree, node);
+    if (summaryGeneralizer != null) {
+      reducedInitialState =
+          summaryGeneralizer.generalize(
+              reducedInitialState, reducedInitialPrecision, innerSubtree, data.getCache());
+    }
 
     final Triple<AbstractState, Precision, Block> currentLevel =
         Triple.of(reducedInitialState, reducedInitialPrecision, innerSubtree);
@@ -196,6 +204,9 @@ public class BAMTransferRelation extends AbstractBAMTransferRelation<CPAExceptio
         stack);
     stats.updateBlockNestingLevel(stack.size());
     stats.switchBlock(outerSubtree, innerSubtree);
+    BAMBlockEvent event =
+        new BAMBlockEvent(node.toString(), node.getFunctionName(), stack.size());
+    event.begin();
 
     try {
       return analyseBlockAndExpand(
@@ -207,6 +218,7 @@ public class BAMTransferRelation extends AbstractBAMTransferRelation<CPAExceptio
           reducedInitialPrecision);
 
     } finally {
+      event.commit();
       logger.log(Level.FINEST, "Finished recursive analysis of depth", stack.size());
       stats.switchBlock(innerSubtree, outerSubtree);
       final Triple<AbstractState, Precision, Block> lastLevel = stack.pop();
@@ -15,8 +15,10 @@ import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.HashMap;
 import java.util.LinkedHashSet;
 import java.util.List;
+import java.util.Map;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.NonNull;
 import org.sosy_lab.common.ShutdownNotifier;
@@ -57,6 +59,14 @@ public class BAMTransferRelationWithFixPointForRecursion extends BAMTransferRela
   private boolean targetFound = false;
   private final Collection<AbstractState> potentialRecursionUpdateStates = new LinkedHashSet<>();
 
+  /**
+   * The cached reached set that contains a state of {@link #potentialRecursionUpdateStates}. The
+   * same states need to be re-added in most iterations of the fixpoint algorithm, and the reached
+   * sets of the previous iteration are reused, so we remember where each state was found instead
+   * of searching all cached reached sets again in every iteration.
+   */
+  private final Map<AbstractState, ReachedSet> reachedSetOfUpdateState = new HashMap<>();
+
   public BAMTransferRelationWithFixPointForRecursion(
       Configuration pConfig,
       BAMCPA pBamCpa,
@@ -121,6 +131,7 @@ public class BAMTransferRelationWithFixPointForRecursion extends BAMTransferRela
 
     Collection<AbstractState> resultStates;
     int iterationCounter = 0;
+    reachedSetOfUpdateState.clear();
     while (true) { // fixpoint-iteration to handle recursive functions
 
       if (!targetFound) {
@@ -182,10 +193,17 @@ public class BAMTransferRelationWithFixPointForRecursion extends BAMTransferRela
   /** update waitlists of all reachedsets to re-explore the previously found recursive function-call. */
   private void reAddStatesForFixPointIteration() {
     for (final AbstractState recursionUpdateState : potentialRecursionUpdateStates) {
+      ReachedSet knownReachedSet = reachedSetOfUpdateState.get(recursionUpdateState);
+      if (knownReachedSet != null && knownReachedSet.contains(recursionUpdateState)) {
+        logger.log(Level.FINEST, "re-adding state", recursionUpdateState);
+        knownReachedSet.reAddToWaitlist(recursionUpdateState);
+        continue;
+      }
       for (final ReachedSet reachedSet : data.getCache().getAllCachedReachedStates()) {
         if (reachedSet.contains(recursionUpdateState)) {
           logger.log(Level.FINEST, "re-adding state", recursionUpdateState);
           reachedSet.reAddToWaitlist(recursionUpdateState);
+          reachedSetOfUpdateState.put(recursionUpdateState, reachedSet);
         }
         // else if (pHeadOfMainFunctionState == recursionUpdateState) {
           // special case: this is the root-state of the whole program, it is in the main-reachedset.
@@ -0,0 +1,121 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.bam;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.ListIterator;
+import java.util.Map;
+import org.sosy_lab.cpachecker.cfa.blocks.Block;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractDomain;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.MergeOperator;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.cpa.arg.ARGState;
+import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCache;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.Pair;
+
+/**
+ * Bounds the number of cache entries per block and precision. As long as the bound is not
+ * reached, each reduced initial state gets its own entry. Afterwards, a new reduced initial state
+ * is replaced by the initial state of an existing entry that covers it, or by the merge of the new
+ * state with the most recent existing initial state, if the merge operator of the analysis
+ * generalizes the state. Each block entry is then analyzed with a more general initial state,
+ * which over-approximates the precise summary.
+ *
+ * <p>If the wrapped analysis does not merge (e.g., with merge-sep), only the coverage by existing
+ * entries is used, and the bound can be exceeded.
+ */
+class BlockSummaryGeneralizer {
+
+  private final int maxEntriesPerBlock;
+  private final AbstractDomain domain;
+  private final MergeOperator merge;
+  private final BAMCPAStatistics stats;
+
+  /** initial states (and their precisions) of the cache entries of each block. */
+  private final Map<Block, List<Pair<ARGState, Precision>>> entriesOfBlock = new HashMap<>();
+
+  /**
+   * @param pDomain domain of the analysis wrapped by the ARG
+   * @param pMerge merge operator of the analysis wrapped by the ARG
+   */
+  BlockSummaryGeneralizer(
+      int pMaxEntriesPerBlock,
+      AbstractDomain pDomain,
+      MergeOperator pMerge,
+      BAMCPAStatistics pStats) {
+    maxEntriesPerBlock = pMaxEntriesPerBlock;
+    domain = pDomain;
+    merge = pMerge;
+    stats = pStats;
+  }
+
+  /**
+   * Return the reduced initial state to be used for the analysis of the block, i.e., either the
+   * given state or a more general one.
+   */
+  AbstractState generalize(
+      AbstractState pReducedState, Precision pReducedPrecision, Block pBlock, BAMCache pCache)
+      throws CPAException, InterruptedException {
+    if (pCache.containsPreciseKey(pReducedState, pReducedPrecision, pBlock)) {
+      return pReducedState;
+    }
+    final ARGState reducedState = (ARGState) pReducedState;
+    final List<Pair<ARGState, Precision>> entries =
+        entriesOfBlock.computeIfAbsent(pBlock, b -> new ArrayList<>());
+
+    // only entries with the same precision are relevant, stale precisions are removed
+    ListIterator<Pair<ARGState, Precision>> it = entries.listIterator(entries.size());
+    int sameEntries = 0;
+    Pair<ARGState, Precision> mostRecent = null;
+    while (it.hasPrevious()) {
+      Pair<ARGState, Precision> entry = it.previous();
+      if (!pCache.containsPreciseKey(entry.getFirst(), entry.getSecond(), pBlock)) {
+        it.remove();
+      } else if (entry.getSecond().equals(pReducedPrecision)) {
+        sameEntries++;
+        if (mostRecent == null) {
+          mostRecent = entry;
+        }
+      }
+    }
+
+    if (sameEntries < maxEntriesPerBlock) {
+      entries.add(Pair.of(reducedState, pReducedPrecision));
+      return reducedState;
+    }
+
+    final AbstractState wrappedState = reducedState.getWrappedState();
+    for (Pair<ARGState, Precision> entry : entries) {
+      if (entry.getSecond().equals(pReducedPrecision)
+          && domain.isLessOrEqual(wrappedState, entry.getFirst().getWrappedState())) {
+        stats.coveredBlockEntries.inc();
+        return entry.getFirst();
+      }
+    }
+
+    final AbstractState wrappedRecent = mostRecent.getFirst().getWrappedState();
+    final AbstractState merged = merge.merge(wrappedState, wrappedRecent, pReducedPrecision);
+    if (merged != wrappedRecent && domain.isLessOrEqual(wrappedState, merged)) {
+      // the merged state replaces the most recent entry as candidate for further merges
+      final ARGState generalizedState = new ARGState(merged, null);
+      entries.remove(mostRecent);
+      entries.add(Pair.of(generalizedState, pReducedPrecision));
+      stats.mergedBlockEntries.inc();
+      return generalizedState;
+    }
+
+    // no generalization possible, fall back to a precise entry
+    entries.add(Pair.of(reducedState, pReducedPrecision));
+    return reducedState;
+  }
+}
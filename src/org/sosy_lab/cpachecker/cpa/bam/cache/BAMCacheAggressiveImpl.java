@@ -8,8 +8,11 @@
 
 package org.sosy_lab.cpachecker.cpa.bam.cache;
 
+import com.google.common.collect.ImmutableSet;
 import java.util.LinkedHashMap;
+import java.util.LinkedHashSet;
 import java.util.Map;
+import java.util.Set;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
@@ -19,6 +22,7 @@ import org.sosy_lab.cpachecker.cfa.blocks.Block;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.Reducer;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
 
 /**
  * This implementation of BAMCache uses an heuristic to improve the cache-hit-rate. Whenever
@@ -30,11 +34,24 @@ public class BAMCacheAggressiveImpl extends BAMCacheImpl {
 
   private final Map<AbstractStateHash, BAMCacheEntry> impreciseReachedCache = new LinkedHashMap<>();
 
+  /**
+   * The distinct precisions of the cached entries of each block. Searching for a similar entry
+   * needs one lookup per precision of the block instead of a scan over all cache entries.
+   */
+  private final Map<Block, Set<Precision>> precisionsOfBlock = new LinkedHashMap<>();
+
   public BAMCacheAggressiveImpl(Configuration config, Reducer reducer, LogManager logger)
       throws InvalidConfigurationException {
     super(config, reducer, logger);
   }
 
+  @Override
+  public BAMCacheEntry put(
+      AbstractState stateKey, Precision precisionKey, Block context, ReachedSet rs) {
+    precisionsOfBlock.computeIfAbsent(context, k -> new LinkedHashSet<>()).add(precisionKey);
+    return super.put(stateKey, precisionKey, context, rs);
+  }
+
   @Override
   protected @Nullable BAMCacheEntry getIfNotExistant(
       final AbstractState stateKey,
@@ -44,6 +61,7 @@ public class BAMCacheAggressiveImpl extends BAMCacheImpl {
     BAMCacheEntry result = impreciseReachedCache.get(hash);
     if (result != null) {
       lastAnalyzedEntry = result;
+      impreciseCacheHits++;
       logger.log(Level.FINEST, "CACHE_ACCESS: imprecise entry, directly from cache");
       return result;
     }
@@ -55,6 +73,7 @@ public class BAMCacheAggressiveImpl extends BAMCacheImpl {
       // found similar element, use this
       impreciseReachedCache.put(hash, result);
       lastAnalyzedEntry = result;
+      impreciseCacheHits++;
       logger.log(Level.FINEST, "CACHE_ACCESS: imprecise entry, searched in cache");
       return result;
     }
@@ -68,19 +87,25 @@ public class BAMCacheAggressiveImpl extends BAMCacheImpl {
     int min = Integer.MAX_VALUE;
     BAMCacheEntry result = null;
 
-    for (AbstractStateHash cacheKey : preciseReachedCache.keySet()) {
-      //searchKey != cacheKey, check whether it is the same if we ignore the precision
-      AbstractStateHash ignorePrecisionSearchKey =
-          getHashCode(pStateKey, cacheKey.precisionKey, pContext);
-      if (ignorePrecisionSearchKey.equals(cacheKey)) {
-        int distance = reducer.measurePrecisionDifference(pPrecisionKey, cacheKey.precisionKey);
+    for (Precision precision : precisionsOfBlock.getOrDefault(pContext, ImmutableSet.of())) {
+      // check whether there is an entry for the same state if we ignore the precision
+      BAMCacheEntry entry = preciseReachedCache.get(getHashCode(pStateKey, precision, pContext));
+      if (entry != null) {
+        int distance = reducer.measurePrecisionDifference(pPrecisionKey, precision);
         if (distance < min) { //prefer similar precisions
           min = distance;
-          result = preciseReachedCache.get(ignorePrecisionSearchKey);
+          result = entry;
         }
       }
     }
 
     return result;
   }
+
+  @Override
+  public void clear() {
+    super.clear();
+    impreciseReachedCache.clear();
+    precisionsOfBlock.clear();
+  }
 }
@@ -12,16 +12,19 @@ import static com.google.common.base.Preconditions.checkNotNull;
 import static org.sosy_lab.cpachecker.util.statistics.StatisticsUtils.toPercent;
 
 import com.google.common.collect.Collections2;
+import com.google.common.collect.ImmutableList;
 import java.io.PrintStream;
 import java.util.Collection;
 import java.util.LinkedHashMap;
 import java.util.Map;
+import java.util.concurrent.TimeUnit;
 import java.util.logging.Level;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.blocks.Block;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
@@ -46,6 +49,8 @@ public class BAMCacheImpl implements BAMCache {
   private int cacheMisses = 0;
   private int partialCacheHits = 0;
   private int fullCacheHits = 0;
+  /** hits (partial or full) that used an entry with a different precision, see subclasses */
+  protected int impreciseCacheHits = 0;
 
   private int abstractionCausedMisses = 0;
   private int precisionCausedMisses = 0;
@@ -226,8 +231,24 @@ public class BAMCacheImpl implements BAMCache {
 
   @Override
   public void printStatistics(PrintStream out, Result pResult, UnmodifiableReachedSet pReached) {
+    printStatistics(out, ImmutableList.of(this));
+  }
 
-    int sumCalls = cacheMisses + partialCacheHits + fullCacheHits;
+  /** Print the summed-up statistics of several caches, e.g., of the partitions of one cache. */
+  static void printStatistics(PrintStream out, Collection<? extends BAMCacheImpl> caches) {
+
+    int cacheMisses = 0;
+    int partialCacheHits = 0;
+    int fullCacheHits = 0;
+    int impreciseCacheHits = 0;
+    int abstractionCausedMisses = 0;
+    int precisionCausedMisses = 0;
+    int noSimilarCausedMisses = 0;
+    TimeSpan equalsTime = TimeSpan.empty();
+    int equalsCalls = 0;
+    TimeSpan hashingTime = TimeSpan.empty();
+    int hashingCalls = 0;
+    boolean gatherCacheMissStatistics = false;
 
     StatHist argStats = new StatHist("") {
           @Override
@@ -237,23 +258,47 @@ public class BAMCacheImpl implements BAMCache {
                 getSum(), getUpdateCount(), getAvg(), getStdDeviation(), getMin(), getMax());
           }
         };
-    for (UnmodifiableReachedSet subreached : getAllCachedReachedStates()) {
-      argStats.insertValue(subreached.size());
+    for (BAMCacheImpl cache : caches) {
+      for (UnmodifiableReachedSet subreached : cache.getAllCachedReachedStates()) {
+        argStats.insertValue(subreached.size());
+      }
+      cacheMisses += cache.cacheMisses;
+      partialCacheHits += cache.partialCacheHits;
+      fullCacheHits += cache.fullCacheHits;
+      impreciseCacheHits += cache.impreciseCacheHits;
+      abstractionCausedMisses += cache.abstractionCausedMisses;
+      precisionCausedMisses += cache.precisionCausedMisses;
+      noSimilarCausedMisses += cache.noSimilarCausedMisses;
+      equalsTime = TimeSpan.sum(equalsTime, cache.equalsTimer.getSumTime());
+      equalsCalls += cache.equalsTimer.getNumberOfIntervals();
+      hashingTime = TimeSpan.sum(hashingTime, cache.hashingTimer.getSumTime());
+      hashingCalls += cache.hashingTimer.getNumberOfIntervals();
+      gatherCacheMissStatistics |= cache.gatherCacheMissStatistics;
     }
 
+    int sumCalls = cacheMisses + partialCacheHits + fullCacheHits;
+
     out.println("Total size of all ARGs:                              " + argStats);
     out.println("Total number of recursive CPA calls:                 " + sumCalls);
     out.println("  Number of cache misses:                            " + cacheMisses + " (" + toPercent(cacheMisses, sumCalls) + " of all calls)");
     out.println("  Number of partial cache hits:                      " + partialCacheHits + " (" + toPercent(partialCacheHits, sumCalls) + " of all calls)");
     out.println("  Number of full cache hits:                         " + fullCacheHits + " (" + toPercent(fullCacheHits, sumCalls) + " of all calls)");
+    if (impreciseCacheHits > 0) {
+      out.println(
+          "  Number of hits with a different precision:         "
+              + impreciseCacheHits
+              + " ("
+              + toPercent(impreciseCacheHits, sumCalls)
+              + " of all calls)");
+    }
     if (gatherCacheMissStatistics) {
       out.println("Cause for cache misses:                              ");
       out.println("  Number of abstraction caused misses:               " + abstractionCausedMisses + " (" + toPercent(abstractionCausedMisses, cacheMisses) + " of all misses)");
       out.println("  Number of precision caused misses:                 " + precisionCausedMisses + " (" + toPercent(precisionCausedMisses, cacheMisses) + " of all misses)");
       out.println("  Number of misses with no similar elements:         " + noSimilarCausedMisses + " (" + toPercent(noSimilarCausedMisses, cacheMisses) + " of all misses)");
     }
-    out.println("Time for checking equality of abstract states:       " + equalsTimer + " (Calls: " + equalsTimer.getNumberOfIntervals() + ")");
-    out.println("Time for computing the hashCode of abstract states:  " + hashingTimer + " (Calls: " + hashingTimer.getNumberOfIntervals() + ")");
+    out.println("Time for checking equality of abstract states:       " + equalsTime.formatAs(TimeUnit.SECONDS) + " (Calls: " + equalsCalls + ")");
+    out.println("Time for computing the hashCode of abstract states:  " + hashingTime.formatAs(TimeUnit.SECONDS) + " (Calls: " + hashingCalls + ")");
   }
 
   @Override
@@ -8,12 +8,20 @@
 
 package org.sosy_lab.cpachecker.cpa.bam.cache;
 
+import com.google.common.collect.ImmutableList;
 import java.io.PrintStream;
+import java.util.ArrayList;
 import java.util.Collection;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.cpachecker.cfa.blocks.Block;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
@@ -24,42 +32,84 @@ import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.util.statistics.StatTimer;
 
-/** A wrapper for a fully synchronized cache access. */
-// TODO we should use more fine-grained locking implementation
+/**
+ * A wrapper for a synchronized cache access.
+ *
+ * <p>The cache is split into several partitions (lock stripes) by the block of the cache key, and
+ * each partition is a separate cache with its own lock. Thus threads that access the cache for
+ * different blocks do not block each other. With a single partition, all accesses are fully
+ * synchronized.
+ */
+@Options(prefix = "cpa.bam")
 public class BAMCacheSynchronized implements BAMCache {
 
-  private final BAMCache cache;
-  private final StatTimer timer = new StatTimer("Time for cache-access");
+  @Option(
+      secure = true,
+      description =
+          "number of independently locked partitions of the BAM cache in parallel analyses."
+              + " Cache entries are partitioned by their block.")
+  @IntegerOption(min = 1)
+  private int cacheLockStripes = 1;
+
+  private final List<BAMCacheImpl> caches;
+  private final List<StatTimer> timers;
+
+  // only for the deprecated method getLastAnalyzedBlock()
+  private volatile BAMCacheImpl lastAccessedCache;
 
   public BAMCacheSynchronized(Configuration pConfig, Reducer pReducer, LogManager pLogger)
       throws InvalidConfigurationException {
-    cache = new BAMCacheImpl(pConfig, pReducer, pLogger);
+    pConfig.inject(this);
+    List<BAMCacheImpl> cacheList = new ArrayList<>(cacheLockStripes);
+    List<StatTimer> timerList = new ArrayList<>(cacheLockStripes);
+    for (int i = 0; i < cacheLockStripes; i++) {
+      cacheList.add(new BAMCacheImpl(pConfig, pReducer, pLogger));
+      timerList.add(new StatTimer("Time for cache-access"));
+    }
+    caches = ImmutableList.copyOf(cacheList);
+    timers = ImmutableList.copyOf(timerList);
+    lastAccessedCache = caches.get(0);
+  }
+
+  private int getStripe(Block pContext) {
+    return Math.floorMod(pContext.hashCode(), caches.size());
   }
 
   @Override
   public void printStatistics(PrintStream pOut, Result pResult, UnmodifiableReachedSet pReached) {
-    synchronized (this) {
-      cache.printStatistics(pOut, pResult, pReached);
-      pOut.println(timer.getTitle() + ":                           " + timer + " (count=" + timer.getUpdateCount() + ")");
+    // statistics are printed after the analysis, so there are no concurrent accesses
+    BAMCacheImpl.printStatistics(pOut, caches);
+
+    TimeSpan time = TimeSpan.empty();
+    int count = 0;
+    for (StatTimer timer : timers) {
+      time = TimeSpan.sum(time, timer.getConsumedTime());
+      count += timer.getUpdateCount();
     }
+    pOut.println(timers.get(0).getTitle() + ":                           " + time.formatAs(TimeUnit.SECONDS) + " (count=" + count + ")");
   }
 
   @Override
   public void writeOutputFiles(Result pResult, UnmodifiableReachedSet pReached) {
-    synchronized (this) {
-      cache.writeOutputFiles(pResult, pReached);
+    for (BAMCacheImpl cache : caches) {
+      synchronized (cache) {
+        cache.writeOutputFiles(pResult, pReached);
+      }
     }
   }
 
   @Override
   public @Nullable String getName() {
-    return cache.getName();
+    return caches.get(0).getName();
   }
 
   @Override
   public BAMCacheEntry put(
       AbstractState pStateKey, Precision pPrecisionKey, Block pContext, ReachedSet pItem) {
-    synchronized (this) {
+    int stripe = getStripe(pContext);
+    BAMCacheImpl cache = caches.get(stripe);
+    StatTimer timer = timers.get(stripe);
+    synchronized (cache) {
       timer.start();
       try {
         return cache.put(pStateKey, pPrecisionKey, pContext, pItem);
@@ -71,9 +121,13 @@ public class BAMCacheSynchronized implements BAMCache {
 
   @Override
   public BAMCacheEntry get(AbstractState pStateKey, Precision pPrecisionKey, Block pContext) {
-    synchronized (this) {
+    int stripe = getStripe(pContext);
+    BAMCacheImpl cache = caches.get(stripe);
+    StatTimer timer = timers.get(stripe);
+    synchronized (cache) {
       try {
         timer.start();
+        lastAccessedCache = cache;
         return cache.get(pStateKey, pPrecisionKey, pContext);
       } finally {
         timer.stop();
@@ -84,20 +138,19 @@ public class BAMCacheSynchronized implements BAMCache {
   @Override
   @Deprecated
   public ARGState getLastAnalyzedBlock() {
-    synchronized (this) {
-      try {
-        timer.start();
-        return cache.getLastAnalyzedBlock();
-      } finally {
-        timer.stop();
-      }
+    BAMCacheImpl cache = lastAccessedCache;
+    synchronized (cache) {
+      return cache.getLastAnalyzedBlock();
     }
   }
 
   @Override
   public boolean containsPreciseKey(AbstractState pStateKey, Precision pPrecisionKey,
       Block pContext) {
-    synchronized (this) {
+    int stripe = getStripe(pContext);
+    BAMCacheImpl cache = caches.get(stripe);
+    StatTimer timer = timers.get(stripe);
+    synchronized (cache) {
       try {
         timer.start();
         return cache.containsPreciseKey(pStateKey, pPrecisionKey, pContext);
@@ -109,15 +162,21 @@ public class BAMCacheSynchronized implements BAMCache {
 
   @Override
   public Collection<ReachedSet> getAllCachedReachedStates() {
-    synchronized (this) {
-      return cache.getAllCachedReachedStates();
+    List<ReachedSet> result = new ArrayList<>();
+    for (BAMCacheImpl cache : caches) {
+      synchronized (cache) {
+        result.addAll(cache.getAllCachedReachedStates());
+      }
     }
+    return result;
   }
 
   @Override
   public void clear() {
-    synchronized (this) {
-      cache.clear();
+    for (BAMCacheImpl cache : caches) {
+      synchronized (cache) {
+        cache.clear();
+      }
     }
   }
 }
@@ -10,6 +10,10 @@ package org.sosy_lab.cpachecker.cpa.bam.cache;
 
 import com.google.common.collect.ImmutableSet;
 import java.util.List;
+import java.util.concurrent.atomic.LongAdder;
+import java.util.concurrent.locks.Lock;
+import java.util.concurrent.locks.ReadWriteLock;
+import java.util.concurrent.locks.ReentrantReadWriteLock;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cfa.blocks.Block;
@@ -20,36 +24,70 @@ import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
 import org.sosy_lab.cpachecker.cpa.bam.cache.BAMCache.BAMCacheEntry;
 
+/**
+ * A wrapper for a synchronized access to the BAM data manager.
+ *
+ * <p>Most accesses only look up the mappings between expanded and reduced states, thus we use a
+ * read-write lock, such that several threads can read the data concurrently and only the
+ * registration of new states and reached-sets is exclusive.
+ */
 public class BAMDataManagerSynchronized implements BAMDataManager {
 
   private final BAMDataManager manager;
+  private final ReadWriteLock rwLock = new ReentrantReadWriteLock();
+
+  /** number of lock acquisitions for which a thread had to wait for another thread. */
+  private final LongAdder contendedLockAcquisitions = new LongAdder();
+  private final LongAdder lockAcquisitions = new LongAdder();
 
   public BAMDataManagerSynchronized(
       BAMCache pCache, ReachedSetFactory pReachedsetFactory, LogManager pLogger) {
     manager = new BAMDataManagerImpl(pCache, pReachedsetFactory, pLogger);
   }
 
+  private Lock acquire(Lock pLock) {
+    lockAcquisitions.increment();
+    if (!pLock.tryLock()) {
+      contendedLockAcquisitions.increment();
+      pLock.lock();
+    }
+    return pLock;
+  }
+
+  public long getNumberOfLockAcquisitions() {
+    return lockAcquisitions.sum();
+  }
+
+  public long getNumberOfContendedLockAcquisitions() {
+    return contendedLockAcquisitions.sum();
+  }
+
   @Override
   public void replaceStateInCaches(
       AbstractState pOldState, AbstractState pNewState, boolean pOldStateMustExist) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.writeLock());
+    try {
       manager.replaceStateInCaches(pOldState, pNewState, pOldStateMustExist);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public BAMCacheEntry createAndRegisterNewReachedSet(
       AbstractState pInitialState, Precision pInitialPrecision, Block pContext) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.writeLock());
+    try {
       return manager.createAndRegisterNewReachedSet(pInitialState, pInitialPrecision, pContext);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public ReachedSetFactory getReachedSetFactory() {
-    synchronized (this) {
-      return manager.getReachedSetFactory();
-    }
+    // the field is final in the wrapped manager, no lock needed
+    return manager.getReachedSetFactory();
   }
 
   @Override
@@ -58,101 +96,139 @@ public class BAMDataManagerSynchronized implements BAMDataManager {
       Precision pExpandedPrecision,
       AbstractState pReducedState,
       Block pInnerBlock) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.writeLock());
+    try {
       manager.registerExpandedState(pExpandedState, pExpandedPrecision, pReducedState, pInnerBlock);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public boolean alreadyReturnedFromSameBlock(AbstractState pState, Block pBlock) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.alreadyReturnedFromSameBlock(pState, pBlock);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public AbstractState getInnermostState(AbstractState pState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.getInnermostState(pState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public List<AbstractState> getExpandedStatesList(AbstractState pState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.getExpandedStatesList(pState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public void registerInitialState(
       AbstractState pState, AbstractState pExitState, ReachedSet pReachedSet) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.writeLock());
+    try {
       manager.registerInitialState(pState, pExitState, pReachedSet);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public ReachedSet getReachedSetForInitialState(AbstractState pState, AbstractState pExitState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.getReachedSetForInitialState(pState, pExitState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public boolean hasInitialState(AbstractState pState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.hasInitialState(pState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public ImmutableSet<AbstractState> getNonReducedInitialStates(AbstractState pReducedState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.getNonReducedInitialStates(pReducedState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public AbstractState getReducedStateForExpandedState(AbstractState pState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.getReducedStateForExpandedState(pState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public Block getInnerBlockForExpandedState(AbstractState pState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.getInnerBlockForExpandedState(pState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public boolean hasExpandedState(AbstractState pState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.hasExpandedState(pState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public BAMCache getCache() {
-    synchronized (this) {
-      return manager.getCache();
-    }
+    // the field is final in the wrapped manager, no lock needed
+    return manager.getCache();
   }
 
   @Override
   @Nullable
   public Precision getExpandedPrecisionForState(AbstractState pState) {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.getExpandedPrecisionForState(pState);
+    } finally {
+      lock.unlock();
     }
   }
 
   @Override
   public void clear() {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.writeLock());
+    try {
       manager.clear();
+    } finally {
+      lock.unlock();
     }
   }
 
@@ -170,8 +246,11 @@ public class BAMDataManagerSynchronized implements BAMDataManager {
 
   @Override
   public String toString() {
-    synchronized (this) {
+    final Lock lock = acquire(rwLock.readLock());
+    try {
       return manager.toString();
+    } finally {
+      lock.unlock();
     }
   }
 }
@@ -8,10 +8,20 @@
 
 package org.sosy_lab.cpachecker.cpa.cache;
 
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
+import com.google.common.cache.CacheStats;
 import com.google.common.collect.ImmutableList;
-import java.util.HashMap;
+import java.io.PrintStream;
+import java.util.Collection;
 import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.defaults.AutomaticCPAFactory;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractDomain;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
@@ -21,15 +31,28 @@ import org.sosy_lab.cpachecker.core.interfaces.MergeOperator;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustment;
 import org.sosy_lab.cpachecker.core.interfaces.StateSpacePartition;
+import org.sosy_lab.cpachecker.core.interfaces.Statistics;
+import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
 import org.sosy_lab.cpachecker.core.interfaces.WrapperCPA;
+import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 
 /*
  * CAUTION: The cache for precision adjustment is only correct for CPAs that do
  * _NOT_ depend on the reached set when performing prec.
  */
-public class CacheCPA implements ConfigurableProgramAnalysis, WrapperCPA {
+@Options(prefix = "cpa.cache")
+public class CacheCPA
+    implements ConfigurableProgramAnalysis, WrapperCPA, StatisticsProvider, Statistics {
+
+  @Option(
+      secure = true,
+      description =
+          "maximal number of entries in each of the caches for successors, precision"
+              + " adjustments, and merges; the least recently used entries are evicted"
+              + " (-1 for unbounded caches)")
+  private long maximumSize = 100000;
 
   private final ConfigurableProgramAnalysis mCachedCPA;
   private final Map<CFANode, AbstractState> mInitialStatesCache;
@@ -42,13 +65,29 @@ public class CacheCPA implements ConfigurableProgramAnalysis, WrapperCPA {
     return AutomaticCPAFactory.forType(CacheCPA.class);
   }
 
-  public CacheCPA(ConfigurableProgramAnalysis pCachedCPA) {
+  public CacheCPA(ConfigurableProgramAnalysis pCachedCPA, Configuration pConfig)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
     mCachedCPA = pCachedCPA;
-    mInitialStatesCache = new HashMap<>();
-    mInitialPrecisionsCache = new HashMap<>();
-    mCacheTransferRelation = new CacheTransferRelation(mCachedCPA.getTransferRelation());
-    mCachePrecisionAdjustment = new CachePrecisionAdjustment(mCachedCPA.getPrecisionAdjustment());
-    mCacheMergeOperator = new CacheMergeOperator(mCachedCPA.getMergeOperator());
+    mInitialStatesCache = new ConcurrentHashMap<>();
+    mInitialPrecisionsCache = new ConcurrentHashMap<>();
+    mCacheTransferRelation =
+        new CacheTransferRelation(mCachedCPA.getTransferRelation(), maximumSize);
+    mCachePrecisionAdjustment =
+        new CachePrecisionAdjustment(mCachedCPA.getPrecisionAdjustment(), maximumSize);
+    mCacheMergeOperator = new CacheMergeOperator(mCachedCPA.getMergeOperator(), maximumSize);
+  }
+
+  /**
+   * Create a thread-safe cache that records statistics and evicts the least recently used entries
+   * if it has more than the given number of entries.
+   */
+  static <K, V> Cache<K, V> newCache(long pMaximumSize) {
+    CacheBuilder<Object, Object> builder = CacheBuilder.newBuilder().recordStats();
+    if (pMaximumSize >= 0) {
+      builder.maximumSize(pMaximumSize);
+    }
+    return builder.build();
   }
 
   @Override
@@ -120,4 +159,32 @@ public class CacheCPA implements ConfigurableProgramAnalysis, WrapperCPA {
   public ImmutableList<ConfigurableProgramAnalysis> getWrappedCPAs() {
     return ImmutableList.of(mCachedCPA);
   }
+
+  @Override
+  public void collectStatistics(Collection<Statistics> pStatsCollection) {
+    pStatsCollection.add(this);
+    if (mCachedCPA instanceof StatisticsProvider) {
+      ((StatisticsProvider) mCachedCPA).collectStatistics(pStatsCollection);
+    }
+  }
+
+  @Override
+  public String getName() {
+    return "CacheCPA";
+  }
+
+  @Override
+  public void printStatistics(PrintStream pOut, Result pResult, UnmodifiableReachedSet pReached) {
+    printCacheStatistics(pOut, "successor", mCacheTransferRelation.getCache());
+    printCacheStatistics(pOut, "precision adjustment", mCachePrecisionAdjustment.getCache());
+    printCacheStatistics(pOut, "merge", mCacheMergeOperator.getCache());
+  }
+
+  private void printCacheStatistics(PrintStream pOut, String pName, Cache<?, ?> pCache) {
+    CacheStats stats = pCache.stats();
+    put(pOut, "Size of " + pName + " cache", pCache.size());
+    put(pOut, "Number of " + pName + " cache hits", stats.hitCount());
+    put(pOut, "Number of " + pName + " cache misses", stats.missCount());
+    put(pOut, "Number of " + pName + " cache evictions", stats.evictionCount());
+  }
 }
@@ -8,47 +8,38 @@
 
 package org.sosy_lab.cpachecker.cpa.cache;
 
-import java.util.HashMap;
-import java.util.Map;
-
+import com.google.common.cache.Cache;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.MergeOperator;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.Triple;
 
 public class CacheMergeOperator implements MergeOperator {
 
   private final MergeOperator mCachedMergeOperator;
-  private final Map<Precision, Map<AbstractState, Map<AbstractState, AbstractState>>> mCache;
+  private final Cache<Triple<Precision, AbstractState, AbstractState>, AbstractState> mCache;
 
-  public CacheMergeOperator(MergeOperator pCachedMergeOperator) {
+  public CacheMergeOperator(MergeOperator pCachedMergeOperator, long pMaximumSize) {
     mCachedMergeOperator = pCachedMergeOperator;
-    mCache = new HashMap<>();
+    mCache = CacheCPA.newCache(pMaximumSize);
+  }
+
+  Cache<?, ?> getCache() {
+    return mCache;
   }
 
   @Override
   public AbstractState merge(AbstractState pElement1,
       AbstractState pElement2, Precision pPrecision) throws CPAException, InterruptedException {
 
-    Map<AbstractState, Map<AbstractState, AbstractState>> lCache1 = mCache.get(pPrecision);
-
-    if (lCache1 == null) {
-      lCache1 = new HashMap<>();
-      mCache.put(pPrecision, lCache1);
-    }
-
-    Map<AbstractState, AbstractState> lCache2 = lCache1.get(pElement2);
-
-    if (lCache2 == null) {
-      lCache2 = new HashMap<>();
-      lCache1.put(pElement2, lCache2);
-    }
-
-    AbstractState lMergedElement = lCache2.get(pElement1);
+    Triple<Precision, AbstractState, AbstractState> key =
+        Triple.of(pPrecision, pElement2, pElement1);
+    AbstractState lMergedElement = mCache.getIfPresent(key);
 
     if (lMergedElement == null) {
       lMergedElement = mCachedMergeOperator.merge(pElement1, pElement2, pPrecision);
-      lCache2.put(pElement1, lMergedElement);
+      mCache.put(key, lMergedElement);
     }
 
     return lMergedElement;
@@ -8,18 +8,16 @@
 
 package org.sosy_lab.cpachecker.cpa.cache;
 
-import java.util.HashMap;
-import java.util.Map;
-
+import com.google.common.base.Function;
+import com.google.common.cache.Cache;
+import java.util.Optional;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustment;
 import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustmentResult;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
-
-import com.google.common.base.Function;
-import java.util.Optional;
+import org.sosy_lab.cpachecker.util.Pair;
 
 /*
  * CAUTION: The cache for precision adjustment is only correct for CPAs that do
@@ -29,12 +27,16 @@ public class CachePrecisionAdjustment implements PrecisionAdjustment {
 
   private final PrecisionAdjustment mCachedPrecisionAdjustment;
 
-  private final Map<Precision, Map<AbstractState, Optional<PrecisionAdjustmentResult>>> mCache;
+  private final Cache<Pair<Precision, AbstractState>, Optional<PrecisionAdjustmentResult>> mCache;
 
-  public CachePrecisionAdjustment(PrecisionAdjustment pCachedPrecisionAdjustment) {
+  public CachePrecisionAdjustment(
+      PrecisionAdjustment pCachedPrecisionAdjustment, long pMaximumSize) {
     mCachedPrecisionAdjustment = pCachedPrecisionAdjustment;
-    //mCache = new HashMap<AbstractState, Map<Precision, Triple<AbstractState, Precision, Action>>>();
-    mCache = new HashMap<>();
+    mCache = CacheCPA.newCache(pMaximumSize);
+  }
+
+  Cache<?, ?> getCache() {
+    return mCache;
   }
 
   @Override
@@ -44,19 +46,13 @@ public class CachePrecisionAdjustment implements PrecisionAdjustment {
       Function<AbstractState, AbstractState> projection,
       AbstractState fullState) throws CPAException, InterruptedException {
 
-    Map<AbstractState, Optional<PrecisionAdjustmentResult>> lCache = mCache.get(pPrecision);
-
-    if (lCache == null) {
-      lCache = new HashMap<>();
-      mCache.put(pPrecision, lCache);
-    }
-
-    Optional<PrecisionAdjustmentResult> lResult = lCache.get(pElement);
+    Pair<Precision, AbstractState> key = Pair.of(pPrecision, pElement);
+    Optional<PrecisionAdjustmentResult> lResult = mCache.getIfPresent(key);
 
     if (lResult == null) {
       lResult = mCachedPrecisionAdjustment.prec(
               pElement, pPrecision, pElements, projection, fullState);
-      lCache.put(pElement, lResult);
+      mCache.put(key, lResult);
     }
 
     return lResult;
@@ -8,92 +8,57 @@
 
 package org.sosy_lab.cpachecker.cpa.cache;
 
+import com.google.common.cache.Cache;
 import java.util.Collection;
-import java.util.HashMap;
-import java.util.Map;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
 import org.sosy_lab.cpachecker.core.defaults.SingleEdgeTransferRelation;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
-
+import org.sosy_lab.cpachecker.util.Triple;
+
+/**
+ * Transfer relation that caches the successors of the wrapped transfer relation for each
+ * combination of precision, edge, and state. The cache is thread-safe and bounded: if it is full,
+ * the least recently used entries are evicted. Concurrent misses for the same key may compute the
+ * successors more than once, which is harmless because the wrapped transfer relation has to be
+ * deterministic for caching to be correct anyway.
+ */
 public class CacheTransferRelation extends SingleEdgeTransferRelation {
 
   private final TransferRelation mCachedTransferRelation;
-  //private Map<CFAEdge, Map<AbstractState, Map<Precision, Collection<? extends AbstractState>>>> mSuccessorsCache;
-  private Map<Precision, Map<CFAEdge, Map<AbstractState, Collection<? extends AbstractState>>>> mSuccessorsCache;
-
-  //private int lCacheMisses = 0;
-  //private int lCacheHits = 0;
-
-
-  //private Set<CFAEdge> mHitEdges;
-
-
-  public CacheTransferRelation(TransferRelation pCachedTransferRelation) {
+  private final Cache<
+          Triple<Precision, CFAEdge, AbstractState>, Collection<? extends AbstractState>>
+      mSuccessorsCache;
+
+  /**
+   * Create a caching transfer relation.
+   *
+   * @param pCachedTransferRelation the transfer relation whose successors are cached
+   * @param pMaximumSize the maximal number of cached successor computations, or a negative number
+   *     for an unbounded cache
+   */
+  public CacheTransferRelation(TransferRelation pCachedTransferRelation, long pMaximumSize) {
     mCachedTransferRelation = pCachedTransferRelation;
-    //mSuccessorsCache = new HashMap<CFAEdge, Map<AbstractState, Map<Precision, Collection<? extends AbstractState>>>>();
-    mSuccessorsCache = new HashMap<>();
+    mSuccessorsCache = CacheCPA.newCache(pMaximumSize);
+  }
 
-    //mHitEdges = new HashSet<>();
+  Cache<?, ?> getCache() {
+    return mSuccessorsCache;
   }
 
   @Override
   public Collection<? extends AbstractState> getAbstractSuccessorsForEdge(
       AbstractState pElement, Precision pPrecision, CFAEdge pCfaEdge)
       throws CPATransferException, InterruptedException {
-
-    /*Map<AbstractState, Map<Precision, Collection<? extends AbstractState>>> lLevel1Cache = mSuccessorsCache.get(pCfaEdge);
-
-    if (lLevel1Cache == null) {
-      lLevel1Cache = new HashMap<AbstractState, Map<Precision, Collection<? extends AbstractState>>>();
-      mSuccessorsCache.put(pCfaEdge, lLevel1Cache);
-    }
-
-    Map<Precision, Collection<? extends AbstractState>> lLevel2Cache = lLevel1Cache.get(pElement);
-
-    if (lLevel2Cache == null) {
-      lLevel2Cache = new HashMap<>();
-      lLevel1Cache.put(pElement, lLevel2Cache);
-    }
-
-    Collection<? extends AbstractState> lSuccessors = lLevel2Cache.get(pPrecision);
+    Triple<Precision, CFAEdge, AbstractState> key = Triple.of(pPrecision, pCfaEdge, pElement);
+    Collection<? extends AbstractState> lSuccessors = mSuccessorsCache.getIfPresent(key);
 
     if (lSuccessors == null) {
-      lSuccessors = mCachedTransferRelation.getAbstractSuccessors(pElement, pPrecision, pCfaEdge);
-      lLevel2Cache.put(pPrecision, lSuccessors);
-
-      lCacheMisses++;
-    } else {
-      lCacheHits++;
-    }
-
-    return lSuccessors;*/
-
-    Map<CFAEdge, Map<AbstractState, Collection<? extends AbstractState>>> lLevel1Cache = mSuccessorsCache.get(pPrecision);
-
-    if (lLevel1Cache == null) {
-      lLevel1Cache = new HashMap<>();
-      mSuccessorsCache.put(pPrecision, lLevel1Cache);
-    }
-
-    Map<AbstractState, Collection<? extends AbstractState>> lLevel2Cache = lLevel1Cache.get(pCfaEdge);
-
-    if (lLevel2Cache == null) {
-      lLevel2Cache = new HashMap<>();
-      lLevel1Cache.put(pCfaEdge, lLevel2Cache);
-    }
-
-    Collection<? extends AbstractState> lSuccessors = lLevel2Cache.get(pElement);
-
-    if (lSuccessors == null) {
-      lSuccessors = mCachedTransferRelation.getAbstractSuccessorsForEdge(pElement, pPrecision, pCfaEdge);
-      lLevel2Cache.put(pElement, lSuccessors);
-
-      //lCacheMisses++;
-    } else {
-      //lCacheHits++;
+      lSuccessors =
+          mCachedTransferRelation.getAbstractSuccessorsForEdge(pElement, pPrecision, pCfaEdge);
+      mSuccessorsCache.put(key, lSuccessors);
     }
 
     return lSuccessors;
@@ -111,5 +76,4 @@ public class CacheTransferRelation extends SingleEdgeTransferRelation {
 
     return mCachedTransferRelation.strengthen(pElement, pOtherElements, pCfaEdge, pPrecision);
   }
-
 }
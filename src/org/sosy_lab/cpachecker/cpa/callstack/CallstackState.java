@@ -10,6 +10,8 @@ package org.sosy_lab.cpachecker.cpa.callstack;
 
 import static com.google.common.base.Preconditions.checkNotNull;
 
+import com.google.common.collect.Interner;
+import com.google.common.collect.Interners;
 import com.google.common.collect.Lists;
 import java.io.IOException;
 import java.io.Serializable;
@@ -34,6 +36,9 @@ import org.sosy_lab.cpachecker.util.globalinfo.GlobalInfo;
  * Cf. {@link CallstackTest#testCallstackPreventsUndesiredCoverage()} for an example.
  * (Because of this this class must inherit the identity-based
  * {@link #equals(Object)} and {@link #hashCode()} from Object.)
+ *
+ * <p>For comparing the content of callstacks, each state has a hash-consed {@link StackContent},
+ * so two callstacks have the same content if and only if their content objects are identical.
  */
 public class CallstackState
     implements AbstractState, Partitionable, AbstractQueryableState, Serializable {
@@ -44,6 +49,7 @@ public class CallstackState
   protected final String currentFunction;
   protected transient CFANode callerNode;
   private final int depth;
+  private transient StackContent content;
 
   public CallstackState(
       @Nullable CallstackState pPreviousElement,
@@ -59,6 +65,7 @@ public class CallstackState
     } else {
       depth = pPreviousElement.getDepth() + 1;
     }
+    content = StackContent.of(pPreviousElement, currentFunction, callerNode);
   }
 
   public CallstackState getPreviousState() {
@@ -77,6 +84,11 @@ public class CallstackState
     return depth;
   }
 
+  /** The canonical representation of the functions and call nodes on this stack. */
+  StackContent getContent() {
+    return content;
+  }
+
   /** for logging and debugging */
   private List<String> getStack() {
     final List<String> stack = new ArrayList<>();
@@ -103,16 +115,7 @@ public class CallstackState
   }
 
   public boolean sameStateInProofChecking(CallstackState pOther) {
-    if (pOther.callerNode.equals(callerNode)
-        && pOther.depth == depth
-        && pOther.currentFunction.equals(currentFunction)
-        && (pOther.previousState == previousState
-            || (previousState != null
-                && pOther.previousState != null
-                && previousState.sameStateInProofChecking(pOther.previousState)))) {
-      return true;
-    }
-    return false;
+    return pOther.content == content;
   }
 
   @Override
@@ -145,5 +148,57 @@ public class CallstackState
     int nodeNumber = in.readInt();
     callerNode =
         GlobalInfo.getInstance().getCFAInfo().orElseThrow().getNodeByNodeNumber(nodeNumber);
+    content = StackContent.of(previousState, currentFunction, callerNode);
+  }
+
+  /**
+   * The functions and call nodes of all frames of a callstack. Instances are hash-consed: equal
+   * contents are always represented by the same instance, so they can be compared by identity,
+   * and the hash code is computed only once.
+   */
+  static final class StackContent {
+
+    private static final Interner<StackContent> INTERNER = Interners.newWeakInterner();
+
+    private final @Nullable StackContent previous;
+    private final String function;
+    private final CFANode callNode;
+    private final int hashCode;
+
+    private StackContent(@Nullable StackContent pPrevious, String pFunction, CFANode pCallNode) {
+      previous = pPrevious;
+      function = pFunction;
+      callNode = pCallNode;
+      hashCode =
+          31 * (31 * (previous == null ? 0 : previous.hashCode) + function.hashCode())
+              + callNode.hashCode();
+    }
+
+    private static StackContent of(
+        @Nullable CallstackState pPrevious, String pFunction, CFANode pCallNode) {
+      return INTERNER.intern(
+          new StackContent(pPrevious == null ? null : pPrevious.content, pFunction, pCallNode));
+    }
+
+    @Override
+    public boolean equals(Object pObj) {
+      if (pObj == this) {
+        return true;
+      }
+      if (!(pObj instanceof StackContent)) {
+        return false;
+      }
+      StackContent other = (StackContent) pObj;
+      // previous contents are canonical, so identity is enough
+      return hashCode == other.hashCode
+          && previous == other.previous
+          && function.equals(other.function)
+          && callNode.equals(other.callNode);
+    }
+
+    @Override
+    public int hashCode() {
+      return hashCode;
+    }
   }
 }
@@ -8,8 +8,6 @@
 
 package org.sosy_lab.cpachecker.cpa.callstack;
 
-import java.util.Objects;
-
 import com.google.common.base.Preconditions;
 
 /**
@@ -35,25 +33,13 @@ public class CallstackStateEqualsWrapper {
   public boolean equals(Object o) {
     if (o == this) { return true; }
     if (!(o instanceof CallstackStateEqualsWrapper)) { return false; }
-    CallstackState other = ((CallstackStateEqualsWrapper) o).getState();
-    CallstackState tmp = state;
-    if (other.getDepth() != tmp.getDepth()) { return false; }
-
-    // check the whole stack
-    while (tmp != null) {
-      if (other == tmp) { return true; }
-      if (!other.getCallNode().equals(tmp.getCallNode())
-          || !other.getCurrentFunction().equals(tmp.getCurrentFunction())) { return false; }
-      other = other.getPreviousState();
-      tmp = tmp.getPreviousState();
-    }
-
-    return true;
+    // the contents of callstacks are hash-consed
+    return state.getContent() == ((CallstackStateEqualsWrapper) o).getState().getContent();
   }
 
   @Override
   public int hashCode() {
-    return Objects.hash(state.getCallNode(), state.getCurrentFunction(), state.getDepth());
+    return state.getContent().hashCode();
   }
 
   @Override
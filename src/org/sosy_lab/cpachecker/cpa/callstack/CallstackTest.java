@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.cpa.callstack;
 
 import static com.google.common.collect.FluentIterable.from;
+import static com.google.common.truth.Truth.assertThat;
 import static com.google.common.truth.Truth.assert_;
 
 import com.google.common.collect.FluentIterable;
@@ -28,6 +29,32 @@ import org.sosy_lab.cpachecker.util.test.TestResults;
 
 public class CallstackTest {
 
+  @Test
+  public void testStackContentIsHashConsed() {
+    CFANode mainNode = CFANode.newDummyCFANode("main");
+    CFANode callNode = CFANode.newDummyCFANode("main");
+    CFANode otherCallNode = CFANode.newDummyCFANode("main");
+
+    CallstackState main = new CallstackState(null, "main", mainNode);
+    CallstackState f1 = new CallstackState(main, "f", callNode);
+    CallstackState otherMain = new CallstackState(null, "main", mainNode);
+    CallstackState f2 = new CallstackState(otherMain, "f", callNode);
+    CallstackState f3 = new CallstackState(main, "f", otherCallNode);
+
+    // separate entries of the same function are different states, but have the same content
+    assertThat(f1).isNotEqualTo(f2);
+    assertThat(f1.getContent()).isSameInstanceAs(f2.getContent());
+    assertThat(f1.sameStateInProofChecking(f2)).isTrue();
+    assertThat(new CallstackStateEqualsWrapper(f1))
+        .isEqualTo(new CallstackStateEqualsWrapper(f2));
+
+    assertThat(f1.getContent()).isNotSameInstanceAs(f3.getContent());
+    assertThat(new CallstackStateEqualsWrapper(f1))
+        .isNotEqualTo(new CallstackStateEqualsWrapper(f3));
+    assertThat(new CallstackStateEqualsWrapper(f1))
+        .isNotEqualTo(new CallstackStateEqualsWrapper(main));
+  }
+
   /**
    * Test that CallstackCPA prevents coverage of two states inside a function
    * if the paths of these two states entered the current function separately.
@@ -0,0 +1,64 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.composite;
+
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.stream.IntStream;
+
+/**
+ * Order in which the components of a composite operator are checked when the operator can stop
+ * as soon as one component disagrees (e.g., the component stop operators of {@link
+ * CompositeStopOperator}). Components that disagree often are moved to the front, so that the
+ * remaining (often more expensive) components need not be checked for most candidates.
+ *
+ * <p>The counts are updated without synchronization. Lost updates only make the order less
+ * accurate, and each published order is a complete permutation of the component indices.
+ */
+final class ComponentOrder {
+
+  /** Number of recorded rejections after which the order is recomputed. */
+  private static final int REORDER_INTERVAL = 1000;
+
+  private final boolean adaptive;
+  private final long[] rejections;
+  private int rejectionsSinceReorder = 0;
+  private volatile int[] order;
+
+  /**
+   * @param pSize the number of components
+   * @param pAdaptive whether the order should adapt, otherwise components are always checked in
+   *     their original order
+   */
+  ComponentOrder(int pSize, boolean pAdaptive) {
+    adaptive = pAdaptive;
+    rejections = new long[pSize];
+    order = IntStream.range(0, pSize).toArray();
+  }
+
+  /** Returns the component indices in the order they should be checked. Must not be modified. */
+  int[] get() {
+    return order;
+  }
+
+  /** Records that the component with the given index disagreed. */
+  void recordRejection(int pIndex) {
+    if (!adaptive) {
+      return;
+    }
+    rejections[pIndex]++;
+    if (++rejectionsSinceReorder >= REORDER_INTERVAL) {
+      rejectionsSinceReorder = 0;
+      // stable sort, so components that never disagreed keep their original order
+      Integer[] newOrder = IntStream.range(0, rejections.length).boxed().toArray(Integer[]::new);
+      Arrays.sort(newOrder, Comparator.comparingLong((Integer i) -> rejections[i]).reversed());
+      order = Arrays.stream(newOrder).mapToInt(Integer::intValue).toArray();
+    }
+  }
+}
@@ -75,6 +75,15 @@ public class CompositeCPA implements StatisticsProvider, WrapperCPA, Configurabl
               + " be a list."
     )
     private boolean aggregateBasicBlocks = false;
+
+    @Option(
+        secure = true,
+        description =
+            "Check the components in the stop and agree-merge operators in an adaptive order:"
+                + " components that most often prevent covering or merging are checked first,"
+                + " such that the remaining components need not be checked for most candidates."
+                + " This does not change the result, only the order of the component checks.")
+    private boolean adaptiveComponentOrder = false;
   }
 
   private static class CompositeCPAFactory extends AbstractCPAFactory {
@@ -192,7 +201,9 @@ public class CompositeCPA implements StatisticsProvider, WrapperCPA, Configurabl
       } else {
         if (options.merge.equals("AGREE")) {
           return new CompositeMergeAgreeOperator(
-              mergeOperators.build(), getStopOperator().getStopOperators());
+              mergeOperators.build(),
+              getStopOperator().getStopOperators(),
+              options.adaptiveComponentOrder);
         } else if (options.merge.equals("PLAIN")) {
           return new CompositeMergePlainOperator(mergeOperators.build());
         } else {
@@ -208,7 +219,7 @@ public class CompositeCPA implements StatisticsProvider, WrapperCPA, Configurabl
     for (ConfigurableProgramAnalysis cpa : cpas) {
       stopOps.add(cpa.getStopOperator());
     }
-    return new CompositeStopOperator(stopOps.build());
+    return new CompositeStopOperator(stopOps.build(), options.adaptiveComponentOrder);
   }
 
   @Override
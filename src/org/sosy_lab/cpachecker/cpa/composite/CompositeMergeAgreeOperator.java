@@ -22,7 +22,7 @@ import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 
 import java.util.Collections;
-import java.util.Iterator;
+import java.util.List;
 
 /**
  * Provides a MergeOperator implementation that delegates to the component CPA.
@@ -43,11 +43,15 @@ class CompositeMergeAgreeOperator implements MergeOperator {
 
   private final ImmutableList<MergeOperator> mergeOperators;
   private final ImmutableList<StopOperator> stopOperators;
+  private final ComponentOrder order;
 
   CompositeMergeAgreeOperator(
-      ImmutableList<MergeOperator> mergeOperators, ImmutableList<StopOperator> stopOperators) {
+      ImmutableList<MergeOperator> mergeOperators,
+      ImmutableList<StopOperator> stopOperators,
+      boolean adaptiveOrder) {
     this.mergeOperators = mergeOperators;
     this.stopOperators  = stopOperators;
+    order = new ComponentOrder(mergeOperators.size(), adaptiveOrder);
   }
 
   @Override
@@ -68,19 +72,21 @@ class CompositeMergeAgreeOperator implements MergeOperator {
       return reachedState;
     }
 
-    ImmutableList.Builder<AbstractState> mergedStates = ImmutableList.builder();
-    Iterator<StopOperator> stopIter   = stopOperators.iterator();
-    Iterator<AbstractState> comp1Iter = compSuccessorState.getWrappedStates().iterator();
-    Iterator<AbstractState> comp2Iter = compReachedState.getWrappedStates().iterator();
-    Iterator<Precision> precIter = compPrecision.getWrappedPrecisions().iterator();
+    List<AbstractState> successorStates = compSuccessorState.getWrappedStates();
+    List<AbstractState> reachedStates = compReachedState.getWrappedStates();
+    List<Precision> precisions = compPrecision.getWrappedPrecisions();
+
+    // components may be merged in any order, but the result keeps the order of the components
+    AbstractState[] mergedStates = new AbstractState[mergeOperators.size()];
 
     boolean identicalStates = true;
-    for (MergeOperator mergeOp : mergeOperators) {
-      AbstractState absSuccessorState = comp1Iter.next();
-      AbstractState absReachedState   = comp2Iter.next();
+    for (int idx : order.get()) {
+      AbstractState absSuccessorState = successorStates.get(idx);
+      AbstractState absReachedState   = reachedStates.get(idx);
 
-      Precision prec      = precIter.next();
-      StopOperator stopOp = stopIter.next();
+      Precision prec      = precisions.get(idx);
+      MergeOperator mergeOp = mergeOperators.get(idx);
+      StopOperator stopOp = stopOperators.get(idx);
 
       AbstractState mergedState = mergeOp.merge(absSuccessorState, absReachedState, prec);
 
@@ -91,6 +97,7 @@ class CompositeMergeAgreeOperator implements MergeOperator {
         // (which is the successor state currently considered by the CPAAlgorithm
         // We prevent merging for all CPAs in this case, because the current successor
         // state would not be covered anyway, so widening other states is just a loss of precision.
+        order.recordRejection(idx);
         return reachedState;
       }
 
@@ -98,13 +105,13 @@ class CompositeMergeAgreeOperator implements MergeOperator {
         identicalStates = false;
       }
 
-      mergedStates.add(mergedState);
+      mergedStates[idx] = mergedState;
     }
 
     if (identicalStates) {
       return reachedState;
     } else {
-      return new CompositeState(mergedStates.build());
+      return new CompositeState(ImmutableList.copyOf(mergedStates));
     }
   }
 }
@@ -11,8 +11,10 @@ package org.sosy_lab.cpachecker.cpa.composite;
 import com.google.common.base.Function;
 import com.google.common.base.Functions;
 import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import java.util.Optional;
+import org.sosy_lab.cpachecker.core.defaults.StaticPrecisionAdjustment;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustment;
@@ -25,15 +27,47 @@ class CompositePrecisionAdjustment implements PrecisionAdjustment {
   private final ImmutableList<PrecisionAdjustment> precisionAdjustments;
   private final ImmutableList<Function<AbstractState, AbstractState>> stateProjectionFunctions;
 
+  /**
+   * Indices of the components whose precision adjustment never changes anything, and of the
+   * components that implement a strengthening after precision adjustment. The others do not need
+   * to be called for each successor.
+   */
+  private final ImmutableSet<Integer> staticComponents;
+
+  private final ImmutableSet<Integer> strengtheningComponents;
+
   CompositePrecisionAdjustment(ImmutableList<PrecisionAdjustment> precisionAdjustments) {
     this.precisionAdjustments = precisionAdjustments;
 
     ImmutableList.Builder<Function<AbstractState, AbstractState>> stateProjections =
         ImmutableList.builder();
+    ImmutableSet.Builder<Integer> staticIndices = ImmutableSet.builder();
+    ImmutableSet.Builder<Integer> strengtheningIndices = ImmutableSet.builder();
     for (int i = 0; i < precisionAdjustments.size(); i++) {
       stateProjections.add(getStateProjectionFunction(i));
+      PrecisionAdjustment precisionAdjustment = precisionAdjustments.get(i);
+      if (precisionAdjustment == StaticPrecisionAdjustment.getInstance()) {
+        staticIndices.add(i);
+      }
+      if (overridesStrengthen(precisionAdjustment)) {
+        strengtheningIndices.add(i);
+      }
     }
     this.stateProjectionFunctions = stateProjections.build();
+    staticComponents = staticIndices.build();
+    strengtheningComponents = strengtheningIndices.build();
+  }
+
+  private static boolean overridesStrengthen(PrecisionAdjustment pPrecisionAdjustment) {
+    try {
+      return pPrecisionAdjustment
+              .getClass()
+              .getMethod("strengthen", AbstractState.class, Precision.class, Iterable.class)
+              .getDeclaringClass()
+          != PrecisionAdjustment.class;
+    } catch (NoSuchMethodException e) {
+      throw new AssertionError(e);
+    }
   }
 
   private Function<AbstractState, AbstractState> getStateProjectionFunction(int i) {
@@ -64,6 +98,11 @@ class CompositePrecisionAdjustment implements PrecisionAdjustment {
       PrecisionAdjustment precisionAdjustment = precisionAdjustments.get(i);
       AbstractState oldElement = comp.get(i);
       Precision oldPrecision = prec.get(i);
+      if (staticComponents.contains(i)) {
+        outElements.add(oldElement);
+        outPrecisions.add(oldPrecision);
+        continue;
+      }
       Optional<PrecisionAdjustmentResult> out = precisionAdjustment.prec(
           oldElement, oldPrecision, pElements,
           Functions.compose(stateProjectionFunctions.get(i), projection),
@@ -112,6 +151,9 @@ class CompositePrecisionAdjustment implements PrecisionAdjustment {
   private Optional<CompositeState> callStrengthen(
       CompositeState pCompositeState, CompositePrecision pCompositePrecision)
       throws CPAException, InterruptedException {
+    if (strengtheningComponents.isEmpty()) {
+      return Optional.of(pCompositeState);
+    }
     ImmutableList<AbstractState> wrappedStates = pCompositeState.getWrappedStates();
     ImmutableList<Precision> wrappedPrecisions = pCompositePrecision.getWrappedPrecisions();
     int dim = wrappedStates.size();
@@ -121,6 +163,11 @@ class CompositePrecisionAdjustment implements PrecisionAdjustment {
     for (int i = 0; i < dim; i++) {
       PrecisionAdjustment precisionAdjustment = precisionAdjustments.get(i);
       AbstractState oldElement = wrappedStates.get(i);
+      if (!strengtheningComponents.contains(i)) {
+        // the default implementation of strengthen returns the state itself
+        newElements.add(oldElement);
+        continue;
+      }
       Precision oldPrecision = wrappedPrecisions.get(i);
       Iterable<AbstractState> otherStates =
           Iterables.concat(wrappedStates.subList(0, i), wrappedStates.subList(i + 1, dim));
@@ -22,23 +22,28 @@ import java.util.Arrays;
 import java.util.Collection;
 import java.util.List;
 import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractWrapperState;
+import org.sosy_lab.cpachecker.core.interfaces.CoverageIndexable;
 import org.sosy_lab.cpachecker.core.interfaces.Graphable;
 import org.sosy_lab.cpachecker.core.interfaces.Partitionable;
 import org.sosy_lab.cpachecker.core.interfaces.Property;
 import org.sosy_lab.cpachecker.core.interfaces.PseudoPartitionable;
 import org.sosy_lab.cpachecker.core.interfaces.Targetable;
 import org.sosy_lab.cpachecker.cpa.arg.Splitable;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.Pair;
 
 public class CompositeState
-    implements AbstractWrapperState, Targetable, Partitionable, PseudoPartitionable, Serializable,
-        Graphable, Splitable {
+    implements AbstractWrapperState, Targetable, Partitionable, PseudoPartitionable,
+        CoverageIndexable, Serializable, Graphable, Splitable {
   private static final long serialVersionUID = -5143296331663510680L;
   private final ImmutableList<AbstractState> states;
   private transient Object partitionKey; // lazily initialized
   private transient Comparable<?> pseudoPartitionKey; // lazily initialized
   private transient Object pseudoHashCode; // lazily initialized
+  private transient CompositeStateLayout layout; // lazily initialized
 
   public CompositeState(List<AbstractState> elements) {
     this.states = ImmutableList.copyOf(elements);
@@ -124,6 +129,36 @@ public class CompositeState
     return states;
   }
 
+  /**
+   * Get the first component (or state wrapped in a component) of the given type, like {@link
+   * AbstractStates#extractStateByType(AbstractState, Class)} applied to the components in order.
+   * The index of the component is looked up in a table shared by all composite states with the
+   * same classes of components, so usually no component needs to be checked.
+   */
+  public <T extends AbstractState> @Nullable T getComponentByType(Class<T> pType) {
+    CompositeStateLayout currentLayout = layout;
+    if (currentLayout == null) {
+      currentLayout = CompositeStateLayout.of(states);
+      layout = currentLayout;
+    }
+
+    int index = currentLayout.getIndex(pType);
+    if (index >= 0) {
+      return pType.cast(states.get(index));
+    } else if (index == CompositeStateLayout.NOT_PRESENT) {
+      return null;
+    }
+
+    assert index == CompositeStateLayout.SEARCH_NEEDED;
+    for (AbstractState element : states) {
+      T result = AbstractStates.extractStateByType(element, pType);
+      if (result != null) {
+        return result;
+      }
+    }
+    return null;
+  }
+
 
   @Override
   public Object getPartitionKey() {
@@ -185,6 +220,25 @@ public class CompositeState
     return pseudoHashCode;
   }
 
+  /**
+   * The keys are the keys of the component states, tagged with the index of the component: a
+   * composite state is less or equal to another one only if this holds for all components.
+   */
+  @Override
+  public Set<?> getCoverageIndexKeys() {
+    ImmutableSet.Builder<Object> keys = ImmutableSet.builder();
+    int i = 0;
+    for (AbstractState element : states) {
+      if (element instanceof CoverageIndexable) {
+        for (Object key : ((CoverageIndexable) element).getCoverageIndexKeys()) {
+          keys.add(Pair.of(i, key));
+        }
+      }
+      i++;
+    }
+    return keys.build();
+  }
+
   private static final class CompositePartitionKey implements Serializable {
 
     private static final long serialVersionUID = 1L;
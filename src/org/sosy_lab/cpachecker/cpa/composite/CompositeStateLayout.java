@@ -0,0 +1,75 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.composite;
+
+import com.google.common.collect.ImmutableList;
+import java.util.List;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import org.sosy_lab.cpachecker.core.defaults.AbstractSingleWrapperState;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractWrapperState;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+
+/**
+ * The classes of the components of a {@link CompositeState}. All composite states with the same
+ * component classes share one instance of this class, which caches for every requested type at
+ * which index {@link AbstractStates#extractStateByType(AbstractState, Class)} finds the component
+ * of this type. Thus looking up a component by type is usually a single array access.
+ */
+final class CompositeStateLayout {
+
+  /** Index for types of which there is no component. */
+  static final int NOT_PRESENT = -1;
+
+  /** Index for types that might be found inside of a wrapper component. */
+  static final int SEARCH_NEEDED = -2;
+
+  private static final ConcurrentMap<ImmutableList<Class<?>>, CompositeStateLayout> layouts =
+      new ConcurrentHashMap<>();
+
+  private final ImmutableList<Class<?>> componentClasses;
+  private final ConcurrentMap<Class<?>, Integer> indexByType = new ConcurrentHashMap<>();
+
+  private CompositeStateLayout(ImmutableList<Class<?>> pComponentClasses) {
+    componentClasses = pComponentClasses;
+  }
+
+  static CompositeStateLayout of(List<AbstractState> pComponents) {
+    ImmutableList.Builder<Class<?>> classes =
+        ImmutableList.builderWithExpectedSize(pComponents.size());
+    for (AbstractState component : pComponents) {
+      classes.add(component.getClass());
+    }
+    return layouts.computeIfAbsent(classes.build(), CompositeStateLayout::new);
+  }
+
+  /**
+   * Return the index of the first component that is an instance of the given type, or {@link
+   * #NOT_PRESENT}, or {@link #SEARCH_NEEDED} if a wrapper component comes before any matching
+   * component (such that the components need to be searched recursively).
+   */
+  int getIndex(Class<?> pType) {
+    return indexByType.computeIfAbsent(pType, this::computeIndex);
+  }
+
+  private int computeIndex(Class<?> pType) {
+    for (int i = 0; i < componentClasses.size(); i++) {
+      Class<?> componentClass = componentClasses.get(i);
+      if (pType.isAssignableFrom(componentClass)) {
+        return i;
+      }
+      if (AbstractSingleWrapperState.class.isAssignableFrom(componentClass)
+          || AbstractWrapperState.class.isAssignableFrom(componentClass)) {
+        return SEARCH_NEEDED;
+      }
+    }
+    return NOT_PRESENT;
+  }
+}
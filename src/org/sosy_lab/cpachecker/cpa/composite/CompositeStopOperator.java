@@ -25,9 +25,11 @@ import org.sosy_lab.cpachecker.exceptions.CPAException;
 class CompositeStopOperator implements StopOperator, ForcedCoveringStopOperator {
 
   private final ImmutableList<StopOperator> stopOperators;
+  private final ComponentOrder order;
 
-  CompositeStopOperator(ImmutableList<StopOperator> stopOperators) {
+  CompositeStopOperator(ImmutableList<StopOperator> stopOperators, boolean adaptiveOrder) {
     this.stopOperators = stopOperators;
+    order = new ComponentOrder(stopOperators.size(), adaptiveOrder);
   }
 
   @Override
@@ -50,7 +52,7 @@ class CompositeStopOperator implements StopOperator, ForcedCoveringStopOperator
 
     List<Precision> compositePrecisions = compositePrecision.getWrappedPrecisions();
 
-    for (int idx = 0; idx < compositeElements.size(); idx++) {
+    for (int idx : order.get()) {
       StopOperator stopOp = stopOperators.get(idx);
 
       AbstractState absElem1 = compositeElements.get(idx);
@@ -58,6 +60,7 @@ class CompositeStopOperator implements StopOperator, ForcedCoveringStopOperator
       Precision prec = compositePrecisions.get(idx);
 
       if (!stopOp.stop(absElem1, Collections.singleton(absElem2), prec)) {
+        order.recordRejection(idx);
         return false;
       }
     }
@@ -73,7 +73,7 @@ public class CongruenceCPA
         AnalysisDirection.FORWARD);
 
     if (useCachingPathFormulaManager) {
-      pathFormulaManager = new CachingPathFormulaManager(pathFormulaManager);
+      pathFormulaManager = new CachingPathFormulaManager(pathFormulaManager, pConfiguration);
     }
     TemplateToFormulaConversionManager templateToFormulaConversionManager =
         new TemplateToFormulaConversionManager(pCFA, pLogger);
@@ -158,6 +158,11 @@ public class CongruenceManager implements
 
     Map<Template, Congruence> abstraction = new HashMap<>();
 
+    // The congruences of the previous abstraction are the most likely result,
+    // so the corresponding query is asked first.
+    Map<Template, Congruence> previousAbstraction =
+        generatingState.getBackpointerState().cast().getAbstraction();
+
     statistics.congruenceTimer.start();
     try (ProverEnvironment env = solver.newProverEnvironment()) {
       env.push(p.getFormula());
@@ -170,29 +175,15 @@ public class CongruenceManager implements
 
         Formula formula = templateToFormulaConversionManager.toFormula(pfmgr, fmgr, template, p);
 
-        // Test odd <=> isEven is UNSAT.
-        try {
-          env.push(
-              fmgr.makeModularCongruence(
-                  formula, makeBv(bvfmgr, formula, 0), 2, !template.isUnsigned()));
-          if (env.isUnsat()) {
-            abstraction.put(template, Congruence.ODD);
-            continue;
-          }
-        } finally {
-          env.pop();
-        }
-
-        // Test even <=> isOdd is UNSAT.
-        try {
-          env.push(
-              fmgr.makeModularCongruence(
-                  formula, makeBv(bvfmgr, formula, 1), 2, !template.isUnsigned()));
-          if (env.isUnsat()) {
-            abstraction.put(template, Congruence.EVEN);
-          }
-        } finally {
-          env.pop();
+        Congruence first =
+            previousAbstraction.get(template) == Congruence.EVEN
+                ? Congruence.EVEN
+                : Congruence.ODD;
+        Congruence second = first == Congruence.ODD ? Congruence.EVEN : Congruence.ODD;
+        if (holds(env, template, formula, first)) {
+          abstraction.put(template, first);
+        } else if (holds(env, template, formula, second)) {
+          abstraction.put(template, second);
         }
       }
     } catch (SolverException ex) {
@@ -211,6 +202,25 @@ public class CongruenceManager implements
     return out;
   }
 
+  /**
+   * Test whether the congruence holds for the template, i.e., whether the opposite congruence is
+   * unsatisfiable together with the constraints already pushed on the environment.
+   */
+  private boolean holds(
+      ProverEnvironment env, Template template, Formula formula, Congruence congruence)
+      throws SolverException, InterruptedException {
+    // ODD <=> isEven is UNSAT, EVEN <=> isOdd is UNSAT.
+    int remainder = congruence == Congruence.ODD ? 0 : 1;
+    try {
+      env.push(
+          fmgr.makeModularCongruence(
+              formula, makeBv(bvfmgr, formula, remainder), 2, !template.isUnsigned()));
+      return env.isUnsat();
+    } finally {
+      env.pop();
+    }
+  }
+
   public BooleanFormula toFormula(CongruenceState state) {
     return toFormula(pfmgr, fmgr, state, new PathFormula(
         bfmgr.makeTrue(),
@@ -96,7 +96,9 @@ public class ConstraintsCPA
     CtoFormulaConverter converter =
         initializeCToFormulaConverter(formulaManager, pLogger, pConfig, pShutdownNotifier,
             pCfa.getMachineModel());
-    constraintsSolver = new ConstraintsSolver(pConfig, solver, formulaManager, converter, stats);
+    constraintsSolver =
+        new ConstraintsSolver(
+            pConfig, solver, formulaManager, converter, pCfa.getMachineModel(), stats);
 
     SymbolicValues.initialize();
     abstractDomain = initializeAbstractDomain();
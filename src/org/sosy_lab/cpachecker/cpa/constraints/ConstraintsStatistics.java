@@ -39,7 +39,10 @@ public class ConstraintsStatistics implements Statistics {
   public final StatTimer timeForModelReuse =
       new StatTimer(StatKind.SUM, "Time for model re-use attempts");
   public final StatTimer timeForSatCheck = new StatTimer(StatKind.SUM, "Time for SMT check");
+  public final StatCounter modelReuseAttempts = new StatCounter("Model re-use attempts");
   public final StatCounter modelReuseSuccesses = new StatCounter("Successful model re-uses");
+  public final StatCounter constraintsEvaluatedWithoutSolver =
+      new StatCounter("Constraints evaluated for re-used model without solver");
 
   public StatCounter cacheLookups = new StatCounter("Cache lookups");
   public StatTimer directCacheLookupTime = new StatTimer(StatKind.SUM, "Direct cache lookup time");
@@ -89,7 +92,9 @@ public class ConstraintsStatistics implements Statistics {
         .putIfUpdatedAtLeastOnce(timeForSatCheck)
         .putIfUpdatedAtLeastOnce(timeForDefinitesComputation)
         .endLevel()
+        .putIfUpdatedAtLeastOnce(modelReuseAttempts)
         .putIfUpdatedAtLeastOnce(modelReuseSuccesses)
+        .putIfUpdatedAtLeastOnce(constraintsEvaluatedWithoutSolver)
         .spacer() // Direct constraints solver cache
         .putIf(cacheLookups.getUpdateCount() > 0, cacheLookups)
         .putIf(cacheLookups.getUpdateCount() > 0, directCacheHits)
@@ -17,6 +17,7 @@ import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Multimap;
 import com.google.common.collect.Sets;
+import java.math.BigInteger;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
@@ -27,16 +28,19 @@ import java.util.List;
 import java.util.Map;
 import java.util.Optional;
 import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
 import org.sosy_lab.cpachecker.cpa.constraints.ConstraintsStatistics;
 import org.sosy_lab.cpachecker.cpa.constraints.FormulaCreator;
 import org.sosy_lab.cpachecker.cpa.constraints.FormulaCreatorUsingCConverter;
 import org.sosy_lab.cpachecker.cpa.constraints.constraint.Constraint;
 import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicIdentifier;
 import org.sosy_lab.cpachecker.cpa.value.symbolic.util.SymbolicIdentifierLocator;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.util.SymbolicValueEvaluator;
 import org.sosy_lab.cpachecker.cpa.value.symbolic.util.SymbolicValues;
 import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.ctoformula.CtoFormulaConverter;
@@ -44,6 +48,7 @@ import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
 import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.Formula;
 import org.sosy_lab.java_smt.api.Model.ValueAssignment;
 import org.sosy_lab.java_smt.api.ProverEnvironment;
 import org.sosy_lab.java_smt.api.SolverContext.ProverOptions;
@@ -79,14 +84,37 @@ public class ConstraintsSolver {
   )
   private boolean resolveDefinites = true;
 
+  @Option(
+      secure = true,
+      description =
+          "Keep one prover environment across SAT checks and only push and pop the constraints"
+              + " that differ from the previous check")
+  private boolean incrementalSolving = false;
+
+  @Option(
+      secure = true,
+      description =
+          "Before calling the solver, check whether the model of the predecessor state already"
+              + " satisfies all constraints. Constraints are evaluated directly for the model if"
+              + " possible. Definite assignments are not resolved again in this case.")
+  private boolean reuseModels = false;
+
   private ConstraintsCache cache;
   private Solver solver;
   private ProverEnvironment prover;
+
+  /** Prover that is kept open if {@link #incrementalSolving} is enabled. */
+  private @Nullable ProverEnvironment incrementalProver;
+
+  /** The constraint formulas on the stack of {@link #incrementalProver}, one per level. */
+  private final List<BooleanFormula> pushedFormulas = new ArrayList<>();
+
   private FormulaManagerView formulaManager;
   private BooleanFormulaManagerView booleanFormulaManager;
 
   private CtoFormulaConverter converter;
   private SymbolicIdentifierLocator locator;
+  private final MachineModel machineModel;
 
   /** Table of id constraints set, id identifier assignment, formula * */
   private Map<Constraint, BooleanFormula> constraintFormulas = new HashMap<>();
@@ -100,6 +128,7 @@ public class ConstraintsSolver {
       final Solver pSolver,
       final FormulaManagerView pFormulaManager,
       final CtoFormulaConverter pConverter,
+      final MachineModel pMachineModel,
       final ConstraintsStatistics pStats)
       throws InvalidConfigurationException {
     pConfig.inject(this);
@@ -109,6 +138,7 @@ public class ConstraintsSolver {
     booleanFormulaManager = formulaManager.getBooleanFormulaManager();
     literalForSingleAssignment = booleanFormulaManager.makeVariable("__A");
     converter = pConverter;
+    machineModel = pMachineModel;
     locator = SymbolicIdentifierLocator.getInstance();
     stats = pStats;
 
@@ -152,8 +182,15 @@ public class ConstraintsSolver {
       Boolean unsat = null; // assign null to fail fast if assignment is missed
       Set<Constraint> relevantConstraints = getRelevantConstraints(pConstraints);
 
-      Collection<BooleanFormula> constraintsAsFormulas =
-          getFullFormula(relevantConstraints, pFunctionName);
+      // keep the order of the state, such that the formulas of successive states share prefixes
+      List<Constraint> orderedConstraints = new ArrayList<>(relevantConstraints.size());
+      for (Constraint c : pConstraints) {
+        if (relevantConstraints.contains(c)) {
+          orderedConstraints.add(c);
+        }
+      }
+      List<BooleanFormula> constraintsAsFormulas =
+          getFullFormula(orderedConstraints, pFunctionName);
       CacheResult res = cache.getCachedResult(constraintsAsFormulas);
 
       if (res.isUnsat()) {
@@ -163,11 +200,22 @@ public class ConstraintsSolver {
         unsat = false;
         pConstraints.setModel(res.getModelAssignment());
 
+      } else if (reuseModels
+          && isSatisfiedByModel(orderedConstraints, constraintsAsFormulas, pConstraints)) {
+        unsat = false;
+        cache.addSat(constraintsAsFormulas, pConstraints.getModel());
+
       } else {
-        prover = solver.newProverEnvironment(ProverOptions.GENERATE_MODELS);
-        BooleanFormula definitesAndConstraints =
-            combineWithDefinites(constraintsAsFormulas, pConstraints);
-        prover.push(definitesAndConstraints);
+        BooleanFormula definites = getDefAssignmentsFormula(pConstraints);
+        if (incrementalSolving) {
+          prover = getIncrementalProver(constraintsAsFormulas);
+          prover.push(definites);
+        } else {
+          prover = solver.newProverEnvironment(ProverOptions.GENERATE_MODELS);
+          prover.push(
+              booleanFormulaManager.and(
+                  definites, booleanFormulaManager.and(constraintsAsFormulas)));
+        }
 
         try {
           stats.timeForSatCheck.start();
@@ -199,6 +247,12 @@ public class ConstraintsSolver {
 
           cache.addUnsat(constraintsAsFormulas);
         }
+
+        if (incrementalSolving) {
+          // remove the definites again, they are specific for this state
+          prover.pop();
+          prover = null;
+        }
       }
 
       return unsat;
@@ -209,13 +263,86 @@ public class ConstraintsSolver {
     }
   }
 
-  private BooleanFormula combineWithDefinites(
-      Collection<BooleanFormula> pConstraintsAsFormulas,
-      ConstraintsState pConstraints) {
+  /**
+   * Return the prover that is kept between SAT checks, with exactly the given formulas on its
+   * stack. As successive checks mostly follow the exploration of the state space, the stack
+   * usually has to be changed only by a few levels.
+   */
+  private ProverEnvironment getIncrementalProver(List<BooleanFormula> pFormulas)
+      throws InterruptedException {
+    if (incrementalProver == null) {
+      incrementalProver = solver.newProverEnvironment(ProverOptions.GENERATE_MODELS);
+      pushedFormulas.clear();
+    }
+    int commonPrefix = 0;
+    while (commonPrefix < pushedFormulas.size()
+        && commonPrefix < pFormulas.size()
+        && pushedFormulas.get(commonPrefix).equals(pFormulas.get(commonPrefix))) {
+      commonPrefix++;
+    }
+    while (pushedFormulas.size() > commonPrefix) {
+      incrementalProver.pop();
+      pushedFormulas.remove(pushedFormulas.size() - 1);
+    }
+    for (BooleanFormula formula : pFormulas.subList(commonPrefix, pFormulas.size())) {
+      incrementalProver.push(formula);
+      pushedFormulas.add(formula);
+    }
+    return incrementalProver;
+  }
+
+  /**
+   * Check whether the current model of the given state (usually inherited from its predecessor)
+   * satisfies the given constraints and the definite assignments of the state. Constraints are
+   * evaluated directly for the model if possible. Otherwise the model is substituted into the
+   * formula of the constraint, and the constraint is only considered satisfied if the solver can
+   * simplify the result to <code>true</code>.
+   */
+  private boolean isSatisfiedByModel(
+      List<Constraint> pConstraints,
+      List<BooleanFormula> pFormulas,
+      ConstraintsState pConstraintsState)
+      throws InterruptedException {
+    ImmutableList<ValueAssignment> model = pConstraintsState.getModel();
+    if (model.isEmpty() || !model.containsAll(pConstraintsState.getDefiniteAssignment())) {
+      return false;
+    }
+    stats.modelReuseAttempts.inc();
+    stats.timeForModelReuse.start();
+    try {
+      Map<SymbolicIdentifier, BigInteger> identifierValues = new HashMap<>();
+      Map<Formula, Formula> substitution = new HashMap<>();
+      for (ValueAssignment assignment : model) {
+        substitution.put(assignment.getKey(), assignment.getValueAsFormula());
+        if (SymbolicValues.isSymbolicTerm(assignment.getName())
+            && assignment.getValue() instanceof BigInteger) {
+          identifierValues.put(
+              SymbolicValues.convertTermToSymbolicIdentifier(assignment.getName()),
+              (BigInteger) assignment.getValue());
+        }
+      }
+      SymbolicValueEvaluator evaluator = new SymbolicValueEvaluator(machineModel, identifierValues);
 
-    BooleanFormula singleConstraintFormula = booleanFormulaManager.and(pConstraintsAsFormulas);
-    BooleanFormula definites = getDefAssignmentsFormula(pConstraints);
-    return booleanFormulaManager.and(definites, singleConstraintFormula);
+      for (int i = 0; i < pConstraints.size(); i++) {
+        Optional<Boolean> result = evaluator.evaluateCondition(pConstraints.get(i));
+        if (result.isPresent()) {
+          if (!result.orElseThrow()) {
+            return false;
+          }
+          stats.constraintsEvaluatedWithoutSolver.inc();
+        } else {
+          BooleanFormula evaluated =
+              formulaManager.simplify(formulaManager.substitute(pFormulas.get(i), substitution));
+          if (!booleanFormulaManager.isTrue(evaluated)) {
+            return false;
+          }
+        }
+      }
+      stats.modelReuseSuccesses.inc();
+      return true;
+    } finally {
+      stats.timeForModelReuse.stop();
+    }
   }
 
   private BooleanFormula getDefAssignmentsFormula(ConstraintsState pConstraints) {
@@ -272,6 +399,11 @@ public class ConstraintsSolver {
 
   private void closeProver() {
     if (prover != null) {
+      if (prover == incrementalProver) {
+        // only reached if the check was not completed, the stack is not in a known state anymore
+        incrementalProver = null;
+        pushedFormulas.clear();
+      }
       prover.close();
       prover = null;
     }
@@ -334,8 +466,8 @@ public class ConstraintsSolver {
    * @throws UnrecognizedCodeException see {@link FormulaCreator#createFormula(Constraint)}
    * @throws InterruptedException see {@link FormulaCreator#createFormula(Constraint)}
    */
-  private Collection<BooleanFormula> getFullFormula(
-      Collection<Constraint> pConstraints, String pFunctionName)
+  private List<BooleanFormula> getFullFormula(
+      List<Constraint> pConstraints, String pFunctionName)
       throws UnrecognizedCodeException, InterruptedException {
 
     List<BooleanFormula> formulas = new ArrayList<>(pConstraints.size());
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.cpa.coverage;
 
 import java.util.Collection;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.log.LogManager;
@@ -30,6 +31,7 @@ import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
 import org.sosy_lab.cpachecker.util.coverage.CoverageData;
+import org.sosy_lab.cpachecker.util.coverage.EdgeCoverageRecorder;
 
 public class CoverageCPA implements ConfigurableProgramAnalysis, StatisticsProvider {
 
@@ -42,17 +44,34 @@ public class CoverageCPA implements ConfigurableProgramAnalysis, StatisticsProvi
   private final StopOperator stop;
   private final Statistics stats;
 
-  // STATIC!! only one instance for CPAchecker
-  private static final CoverageData cov = new CoverageData();
+  // STATIC!! only one instance for CPAchecker (per CFA)
+  private static @Nullable EdgeCoverageRecorder sharedRecorder = null;
+
+  private final EdgeCoverageRecorder recorder;
 
   public CoverageCPA(Configuration pConfig, LogManager pLogger, CFA pCFA) throws InvalidConfigurationException {
-    cov.putCFA(pCFA);
+    recorder = getSharedRecorder(pCFA);
 
     domain = new FlatLatticeDomain(SingletonAbstractState.INSTANCE);
     stop = new StopSepOperator(domain);
-    transfer = new CoverageTransferRelation(cov);
+    transfer = new CoverageTransferRelation(recorder);
+
+    stats = new CoverageStatistics(pConfig, pLogger, recorder);
+  }
+
+  private static synchronized EdgeCoverageRecorder getSharedRecorder(CFA pCFA) {
+    if (sharedRecorder == null || sharedRecorder.getCFA() != pCFA) {
+      sharedRecorder = new EdgeCoverageRecorder(pCFA);
+    }
+    return sharedRecorder;
+  }
 
-    stats = new CoverageStatistics(pConfig, pLogger, cov);
+  /**
+   * Return the coverage of all edges that were handled by the transfer relation so far. This is
+   * computed from the recorded edges and does not need to traverse the reached set.
+   */
+  public CoverageData getCoverageData() {
+    return recorder.toCoverageData();
   }
 
   @Override
@@ -26,6 +26,7 @@ import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.util.coverage.CoverageData;
+import org.sosy_lab.cpachecker.util.coverage.EdgeCoverageRecorder;
 import org.sosy_lab.cpachecker.util.coverage.CoverageReportGcov;
 import org.sosy_lab.cpachecker.util.coverage.CoverageReportStdoutSummary;
 
@@ -38,19 +39,21 @@ public class CoverageStatistics implements Statistics {
   private Path outputCoverageFile = Paths.get("coverage.info");
 
   private final LogManager logger;
-  private final CoverageData cov;
+  private final EdgeCoverageRecorder recorder;
 
-  public CoverageStatistics(Configuration pConfig, LogManager pLogger, CoverageData pCov)
+  public CoverageStatistics(
+      Configuration pConfig, LogManager pLogger, EdgeCoverageRecorder pRecorder)
       throws InvalidConfigurationException {
 
     pConfig.inject(this);
 
     this.logger = pLogger;
-    this.cov = pCov;
+    this.recorder = pRecorder;
   }
 
   @Override
   public void printStatistics(PrintStream pOut, Result pResult, UnmodifiableReachedSet pReached) {
+    CoverageData cov = recorder.toCoverageData();
     CoverageReportStdoutSummary.write(cov, pOut);
 
     if (outputCoverageFile != null) {
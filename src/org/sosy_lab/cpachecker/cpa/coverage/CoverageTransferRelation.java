@@ -12,19 +12,18 @@ import com.google.common.base.Preconditions;
 import java.util.Collection;
 import java.util.Collections;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
-import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
 import org.sosy_lab.cpachecker.core.defaults.SingleEdgeTransferRelation;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
-import org.sosy_lab.cpachecker.util.coverage.CoverageData;
+import org.sosy_lab.cpachecker.util.coverage.EdgeCoverageRecorder;
 
 public class CoverageTransferRelation extends SingleEdgeTransferRelation {
 
-  private final CoverageData cov;
+  private final EdgeCoverageRecorder recorder;
 
-  public CoverageTransferRelation(CoverageData pCov) {
-    cov = Preconditions.checkNotNull(pCov);
+  public CoverageTransferRelation(EdgeCoverageRecorder pRecorder) {
+    recorder = Preconditions.checkNotNull(pRecorder);
   }
 
   @Override
@@ -32,16 +31,8 @@ public class CoverageTransferRelation extends SingleEdgeTransferRelation {
       AbstractState pElement, Precision pPrecision, CFAEdge pCfaEdge)
       throws CPATransferException {
 
-    handleEdge(pCfaEdge);
+    // only a bit is set here, the coverage data is computed when statistics are printed
+    recorder.recordEdge(pCfaEdge);
     return Collections.singleton(pElement);
   }
-
-  private void handleEdge(CFAEdge pEdge) {
-
-    cov.addVisitedEdge(pEdge);
-
-    if (pEdge.getPredecessor() instanceof FunctionEntryNode) {
-      cov.addVisitedFunction((FunctionEntryNode) pEdge.getPredecessor());
-    }
-  }
 }
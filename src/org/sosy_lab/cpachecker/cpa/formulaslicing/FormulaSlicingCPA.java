@@ -77,7 +77,7 @@ public class FormulaSlicingCPA extends SingleEdgeTransferRelation
         AnalysisDirection.FORWARD);
 
     CachingPathFormulaManager pathFormulaManager = new CachingPathFormulaManager
-        (origPathFormulaManager);
+        (origPathFormulaManager, pConfiguration);
 
     inductiveWeakeningManager =
         new InductiveWeakeningManager(
@@ -175,6 +175,7 @@ public class FormulaSlicingCPA extends SingleEdgeTransferRelation
 
   @Override
   public void close() {
+    inductiveWeakeningManager.close();
     solver.close();
   }
 }
@@ -12,14 +12,18 @@ import static com.google.common.base.Preconditions.checkArgument;
 
 import com.google.common.base.Splitter;
 import com.google.common.collect.ComparisonChain;
+import com.google.common.collect.Iterators;
+import com.google.common.collect.PeekingIterator;
 import java.io.Serializable;
 import java.math.BigInteger;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.Map;
 import java.util.Map.Entry;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.collect.PathCopyingPersistentTreeMap;
 import org.sosy_lab.common.collect.PersistentMap;
+import org.sosy_lab.common.collect.PersistentSortedMap;
 import org.sosy_lab.cpachecker.cfa.model.FunctionExitNode;
 import org.sosy_lab.cpachecker.core.defaults.LatticeAbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractQueryableState;
@@ -46,9 +50,10 @@ public class IntervalAnalysisState
   private static final Splitter propertySplitter = Splitter.on("<=").trimResults();
 
   /**
-   * the intervals of the element
+   * the intervals of the element, sorted by variable name such that two states can be compared in
+   * a single pass over both maps
    */
-  private final PersistentMap<String, Interval> intervals;
+  private final PersistentSortedMap<String, Interval> intervals;
 
   /**
    * the reference counts of the element
@@ -69,7 +74,9 @@ public class IntervalAnalysisState
    * @param intervals the intervals
    * @param referencesMap the reference counts
    */
-  public IntervalAnalysisState(PersistentMap<String, Interval> intervals, PersistentMap<String, Integer> referencesMap) {
+  public IntervalAnalysisState(
+      PersistentSortedMap<String, Interval> intervals,
+      PersistentMap<String, Integer> referencesMap) {
     this.intervals        = intervals;
     this.referenceCounts  = referencesMap;
   }
@@ -167,21 +174,27 @@ public class IntervalAnalysisState
   @Override
   public IntervalAnalysisState join(IntervalAnalysisState reachedState) {
     boolean changed = false;
-    PersistentMap<String, Interval> newIntervals = PathCopyingPersistentTreeMap.of();
+    // start with the intervals of the reached state and apply only the differences
+    PersistentSortedMap<String, Interval> newIntervals = reachedState.intervals;
     PersistentMap<String, Integer> newReferences = referenceCounts;
 
-    for (String variableName : reachedState.intervals.keySet()) {
+    PeekingIterator<Entry<String, Interval>> thisEntries =
+        Iterators.peekingIterator(intervals.entrySet().iterator());
+    for (Entry<String, Interval> otherEntry : reachedState.intervals.entrySet()) {
+      String variableName = otherEntry.getKey();
       Integer otherRefCount = reachedState.getReferenceCount(variableName);
-      Interval otherInterval = reachedState.getInterval(variableName);
-      if (intervals.containsKey(variableName)) {
+      Interval otherInterval = otherEntry.getValue();
+      Interval thisInterval = advanceTo(thisEntries, variableName);
+      if (thisInterval != null) {
         // update the interval
-        Interval mergedInterval = getInterval(variableName).union(otherInterval);
+        Interval mergedInterval = thisInterval.union(otherInterval);
         if (mergedInterval != otherInterval) {
           changed = true;
-        }
-
-        if (!mergedInterval.isUnbound()) {
-          newIntervals = newIntervals.putAndCopy(variableName, mergedInterval);
+          if (mergedInterval.isUnbound()) {
+            newIntervals = newIntervals.removeAndCopy(variableName);
+          } else {
+            newIntervals = newIntervals.putAndCopy(variableName, mergedInterval);
+          }
         }
 
         // update the references
@@ -194,6 +207,7 @@ public class IntervalAnalysisState
         }
 
       } else {
+        newIntervals = newIntervals.removeAndCopy(variableName);
         newReferences = newReferences.putAndCopy(variableName, otherRefCount);
         changed = true;
       }
@@ -214,7 +228,7 @@ public class IntervalAnalysisState
    */
   @Override
   public boolean isLessOrEqual(IntervalAnalysisState reachedState) {
-    if (intervals.equals(reachedState.intervals)) { return true; }
+    if (intervals == reachedState.intervals) { return true; }
     // this element is not less or equal than the reached state, if it contains less intervals
     if (intervals.size() < reachedState.intervals.size()) {
       return false;
@@ -222,8 +236,11 @@ public class IntervalAnalysisState
 
     // also, this element is not less or equal than the reached state, if any one interval of the reached state is not contained in this element,
     // or if the interval of the reached state is not wider than the respective interval of this element
-    for (String variableName : reachedState.intervals.keySet()) {
-      if (!intervals.containsKey(variableName) || !reachedState.getInterval(variableName).contains(getInterval(variableName))) {
+    PeekingIterator<Entry<String, Interval>> thisEntries =
+        Iterators.peekingIterator(intervals.entrySet().iterator());
+    for (Entry<String, Interval> otherEntry : reachedState.intervals.entrySet()) {
+      Interval thisInterval = advanceTo(thisEntries, otherEntry.getKey());
+      if (thisInterval == null || !otherEntry.getValue().contains(thisInterval)) {
         return false;
       }
     }
@@ -232,6 +249,26 @@ public class IntervalAnalysisState
     return true;
   }
 
+  /**
+   * Advance the given iterator over entries sorted by variable name up to the given variable, and
+   * return its interval, or null if the variable has no entry. As the variables are requested in
+   * ascending order, comparing two states needs only a single pass over both.
+   */
+  private static @Nullable Interval advanceTo(
+      PeekingIterator<Entry<String, Interval>> pEntries, String pVariableName) {
+    while (pEntries.hasNext()) {
+      int comparison = pEntries.peek().getKey().compareTo(pVariableName);
+      if (comparison > 0) {
+        return null;
+      }
+      Entry<String, Interval> entry = pEntries.next();
+      if (comparison == 0) {
+        return entry.getValue();
+      }
+    }
+    return null;
+  }
+
   /** Returns the set of tracked variables by this state. */
   public Map<String, Interval> getIntervalMap() {
     return intervals;
@@ -55,6 +55,25 @@ public class IntervalAnalysisStateTest {
     checkLess(csa1b23, csa1b3);
   }
 
+  @Test
+  public void joinAndLessOrEqual() {
+    IntervalAnalysisState s = new IntervalAnalysisState();
+    IntervalAnalysisState sa1b2 =
+        s.addInterval("a", new Interval(1L, 1L), 10).addInterval("b", new Interval(2L, 2L), 10);
+    IntervalAnalysisState sa3c4 =
+        s.addInterval("a", new Interval(3L, 3L), 10).addInterval("c", new Interval(4L, 4L), 10);
+
+    IntervalAnalysisState joined = sa1b2.join(sa3c4);
+    assertThat(joined.getIntervalMap()).containsExactly("a", new Interval(1L, 3L));
+    assertThat(sa1b2.isLessOrEqual(joined)).isTrue();
+    assertThat(sa3c4.isLessOrEqual(joined)).isTrue();
+    assertThat(joined.isLessOrEqual(sa1b2)).isFalse();
+    assertThat(sa1b2.isLessOrEqual(sa3c4)).isFalse();
+
+    // joining with a greater state returns the greater state itself
+    assertThat(sa1b2.join(joined)).isSameInstanceAs(joined);
+  }
+
   private void checkLess(Comparable c1, Comparable c2) {
     assertThat(c1.compareTo(c2) < 0).isTrue();
     assertThat(c2.compareTo(c1) > 0).isTrue();
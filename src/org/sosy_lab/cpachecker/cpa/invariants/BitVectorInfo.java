@@ -30,12 +30,29 @@ public class BitVectorInfo implements TypeInfo {
 
   private final BigInteger maxValue;
 
+  /**
+   * The interval of all values representable by bit vectors of this size and signedness, which is
+   * needed by almost every interval operation and therefore only created once.
+   */
+  private final BitVectorInterval range;
+
+  /**
+   * Cache for the most common bit-vector sizes; the instances are immutable, so they can be shared
+   * instead of recomputing the bounds for every evaluated expression.
+   */
+  private static final int MAX_CACHED_SIZE = 128;
+
+  private static final BitVectorInfo[] CACHE_SIGNED = new BitVectorInfo[MAX_CACHED_SIZE + 1];
+
+  private static final BitVectorInfo[] CACHE_UNSIGNED = new BitVectorInfo[MAX_CACHED_SIZE + 1];
+
   private BitVectorInfo(int pSize, boolean pSigned) {
     Preconditions.checkArgument(pSize >= 0, "bit vector size must not be negative");
     size = pSize;
     signed = pSigned;
     minValue = !signed ? BigInteger.ZERO : BigInteger.valueOf(2).pow(size - 1).negate();
     maxValue = !signed ? BigInteger.valueOf(2).pow(size).subtract(BigInteger.ONE) : BigInteger.valueOf(2).pow(size - 1).subtract(BigInteger.ONE);
+    range = BitVectorInterval.of(this, minValue, maxValue);
   }
 
   public int getSize() {
@@ -58,7 +75,7 @@ public class BitVectorInfo implements TypeInfo {
   }
 
   public BitVectorInterval getRange() {
-    return BitVectorInterval.of(this, minValue, maxValue);
+    return range;
   }
 
   @Override
@@ -89,7 +106,17 @@ public class BitVectorInfo implements TypeInfo {
   }
 
   public static BitVectorInfo from(int pSize, boolean pSigned) {
-    return new BitVectorInfo(pSize, pSigned);
+    if (pSize < 0 || pSize > MAX_CACHED_SIZE) {
+      return new BitVectorInfo(pSize, pSigned);
+    }
+    BitVectorInfo[] cache = pSigned ? CACHE_SIGNED : CACHE_UNSIGNED;
+    // benign race: all fields are final, so at worst an equal instance is created twice
+    BitVectorInfo result = cache[pSize];
+    if (result == null) {
+      result = new BitVectorInfo(pSize, pSigned);
+      cache[pSize] = result;
+    }
+    return result;
   }
 
   public static TypeInfo from(MachineModel pMachineModel, Type pType) {
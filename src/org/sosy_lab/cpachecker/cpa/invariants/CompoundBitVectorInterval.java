@@ -28,6 +28,9 @@ import org.sosy_lab.cpachecker.cpa.invariants.operators.bitvector.ISCOperatorFac
 @SuppressWarnings("AmbiguousMethodReference")
 public class CompoundBitVectorInterval implements CompoundIntegralInterval, BitVectorType {
 
+  /** Shared interval array of all bottom states. */
+  private static final BitVectorInterval[] NO_INTERVALS = new BitVectorInterval[0];
+
   private final BitVectorInfo info;
 
   /**
@@ -43,7 +46,7 @@ public class CompoundBitVectorInterval implements CompoundIntegralInterval, BitV
   private CompoundBitVectorInterval(BitVectorInfo pInfo) {
     Preconditions.checkNotNull(pInfo);
     this.info = pInfo;
-    this.intervals = new BitVectorInterval[0];
+    this.intervals = NO_INTERVALS;
   }
 
   /**
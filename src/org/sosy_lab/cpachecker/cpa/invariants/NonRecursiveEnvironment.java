@@ -14,6 +14,7 @@ import java.util.Collections;
 import java.util.Map;
 import java.util.NavigableSet;
 import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.collect.PathCopyingPersistentTreeMap;
 import org.sosy_lab.common.collect.PersistentSortedMap;
 import org.sosy_lab.cpachecker.cpa.invariants.formula.CollectVarsVisitor;
@@ -32,7 +33,12 @@ public class NonRecursiveEnvironment implements Map<MemoryLocation, NumeralFormu
 
   private final PersistentSortedMap<MemoryLocation, NumeralFormula<CompoundInterval>> inner;
 
-  private final FormulaEvaluationVisitor<CompoundInterval> formulaEvaluationVisitor;
+  /**
+   * The visitor used to evaluate formulas that would make the environment recursive. It is only
+   * needed rarely, so it is created on demand instead of for each of the many environments that
+   * are created during the analysis.
+   */
+  private @Nullable FormulaEvaluationVisitor<CompoundInterval> formulaEvaluationVisitor = null;
 
   private final CompoundIntervalManagerFactory compoundIntervalManagerFactory;
 
@@ -47,7 +53,14 @@ public class NonRecursiveEnvironment implements Map<MemoryLocation, NumeralFormu
       PersistentSortedMap<MemoryLocation, NumeralFormula<CompoundInterval>> pInner) {
     this.inner = pInner;
     this.compoundIntervalManagerFactory = pCompoundIntervalManagerFactory;
-    this.formulaEvaluationVisitor = new FormulaCompoundStateEvaluationVisitor(compoundIntervalManagerFactory);
+  }
+
+  private FormulaEvaluationVisitor<CompoundInterval> getFormulaEvaluationVisitor() {
+    if (formulaEvaluationVisitor == null) {
+      formulaEvaluationVisitor =
+          new FormulaCompoundStateEvaluationVisitor(compoundIntervalManagerFactory);
+    }
+    return formulaEvaluationVisitor;
   }
 
   @Override
@@ -121,7 +134,7 @@ public class NonRecursiveEnvironment implements Map<MemoryLocation, NumeralFormu
           pTarget,
           pMemoryLocation,
           InvariantsFormulaManager.INSTANCE.asConstant(
-              typeInfo, pValue.accept(formulaEvaluationVisitor, this)));
+              typeInfo, pValue.accept(getFormulaEvaluationVisitor(), this)));
     }
     NumeralFormula<CompoundInterval> variable =
         InvariantsFormulaManager.INSTANCE.asVariable(typeInfo, pMemoryLocation);
@@ -131,7 +144,7 @@ public class NonRecursiveEnvironment implements Map<MemoryLocation, NumeralFormu
             pTarget,
             pMemoryLocation,
             InvariantsFormulaManager.INSTANCE.asConstant(
-                typeInfo, pValue.accept(formulaEvaluationVisitor, this)));
+                typeInfo, pValue.accept(getFormulaEvaluationVisitor(), this)));
       }
     }
     return sanitizedInnerPutAndCopyInternal(pTarget, pMemoryLocation, pValue);
@@ -176,6 +189,9 @@ public class NonRecursiveEnvironment implements Map<MemoryLocation, NumeralFormu
     for (java.util.Map.Entry<? extends MemoryLocation, ? extends NumeralFormula<CompoundInterval>> entry : pM.entrySet()) {
       resultInner = sanitizedInnerPutAndCopy(resultInner, entry.getKey(), entry.getValue());
     }
+    if (this.inner == resultInner) {
+      return this;
+    }
     return new NonRecursiveEnvironment(this.compoundIntervalManagerFactory, resultInner);
   }
 
@@ -249,8 +265,15 @@ public class NonRecursiveEnvironment implements Map<MemoryLocation, NumeralFormu
         && ((NonRecursiveEnvironment) pInner).compoundIntervalManagerFactory.equals(pCompoundIntervalManagerFactory)) {
       return (NonRecursiveEnvironment) pInner;
     }
+    if (pInner instanceof NonRecursiveEnvironment) {
+      // share the persistent map of the other environment instead of copying it
+      return new NonRecursiveEnvironment(
+          pCompoundIntervalManagerFactory, ((NonRecursiveEnvironment) pInner).inner);
+    }
     if (pInner instanceof PersistentSortedMap) {
-      return new NonRecursiveEnvironment(pCompoundIntervalManagerFactory, pInner);
+      return new NonRecursiveEnvironment(
+          pCompoundIntervalManagerFactory,
+          (PersistentSortedMap<MemoryLocation, NumeralFormula<CompoundInterval>>) pInner);
     }
     return new NonRecursiveEnvironment(pCompoundIntervalManagerFactory, pInner);
   }
@@ -0,0 +1,108 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.livevar;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import java.util.BitSet;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.NavigableSet;
+import java.util.TreeSet;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionCallEdge;
+import org.sosy_lab.cpachecker.cfa.model.FunctionReturnEdge;
+import org.sosy_lab.cpachecker.core.defaults.SingletonPrecision;
+import org.sosy_lab.cpachecker.exceptions.CPATransferException;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+
+/**
+ * Computes the function-wise live variables by solving the backward dataflow equations directly
+ * on the CFA instead of running a CPA over it. The transfer relation of the {@link
+ * LiveVariablesCPA} is reused for the semantics of single edges, but there is no reached set,
+ * no merge and no stop operator: each node holds exactly one bit set, which only grows.
+ *
+ * <p>Nodes are processed in postorder of the CFA (successors before their predecessors), so
+ * most nodes outside of loops need to be visited only once.
+ */
+public class LiveVariablesDataflowSolver {
+
+  /** Check for shutdown requests after this many processed nodes. */
+  private static final int SHUTDOWN_CHECK_INTERVAL = 1000;
+
+  private static final Comparator<CFANode> POSTORDER =
+      Comparator.comparingInt(CFANode::getReversePostorderId)
+          .thenComparingInt(CFANode::getNodeNumber);
+
+  private final LiveVariablesTransferRelation transfer;
+  private final ShutdownNotifier shutdownNotifier;
+
+  private final Map<CFANode, BitSet> liveAtNode = new HashMap<>();
+  private final NavigableSet<CFANode> worklist = new TreeSet<>(POSTORDER);
+
+  public LiveVariablesDataflowSolver(
+      LiveVariablesCPA pCpa, ShutdownNotifier pShutdownNotifier) {
+    transfer = (LiveVariablesTransferRelation) pCpa.getTransferRelation();
+    shutdownNotifier = checkNotNull(pShutdownNotifier);
+  }
+
+  /**
+   * Add a node at which the analysis starts, e.g., a function exit node or the head of a loop
+   * that is never left.
+   */
+  public void addStartNode(CFANode pNode) {
+    LiveVariablesState initial = transfer.getInitialState(pNode);
+    BitSet live = liveAtNode.computeIfAbsent(pNode, n -> new BitSet());
+    live.or(initial.getDataCopy());
+    worklist.add(pNode);
+  }
+
+  /**
+   * Compute the fixed point for all start nodes. Afterwards, the result is available from
+   * {@link LiveVariablesCPA#getLiveVariables()}.
+   */
+  public void solve() throws CPATransferException, InterruptedException {
+    int processed = 0;
+    while (!worklist.isEmpty()) {
+      if (++processed % SHUTDOWN_CHECK_INTERVAL == 0) {
+        shutdownNotifier.shutdownIfNecessary();
+      }
+
+      CFANode node = worklist.pollFirst();
+      BitSet live = liveAtNode.get(node);
+
+      for (CFAEdge edge : CFAUtils.allEnteringEdges(node)) {
+        // the function-wise analysis does not follow function calls,
+        // they are handled by the summary edges
+        if (edge instanceof FunctionCallEdge || edge instanceof FunctionReturnEdge) {
+          continue;
+        }
+
+        Collection<LiveVariablesState> successors =
+            transfer.getAbstractSuccessorsForEdge(
+                LiveVariablesState.of(live, transfer), SingletonPrecision.getInstance(), edge);
+
+        CFANode predecessor = edge.getPredecessor();
+        BitSet livePredecessor = liveAtNode.computeIfAbsent(predecessor, n -> new BitSet());
+        for (LiveVariablesState successor : successors) {
+          BitSet data = successor.getDataCopy();
+          data.andNot(livePredecessor);
+          if (!data.isEmpty()) {
+            livePredecessor.or(data);
+            worklist.add(predecessor);
+          }
+        }
+      }
+    }
+  }
+}
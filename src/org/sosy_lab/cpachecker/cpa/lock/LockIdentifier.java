@@ -8,9 +8,9 @@
 
 package org.sosy_lab.cpachecker.cpa.lock;
 
-import java.util.HashSet;
+import java.util.HashMap;
+import java.util.Map;
 import java.util.Objects;
-import java.util.Set;
 
 public class LockIdentifier implements Comparable<LockIdentifier> {
 
@@ -25,11 +25,15 @@ public class LockIdentifier implements Comparable<LockIdentifier> {
     }
   }
 
-  private static Set<LockIdentifier> createdIds;
+  /** interner for all identifiers, each identifier gets the number of previous identifiers */
+  private static final Map<LockIdentifier, LockIdentifier> createdIds = new HashMap<>();
 
   private final String name;
   private final LockType type;
 
+  /** unique index of an interned identifier, used for bitset-based locksets */
+  private int index = -1;
+
   LockIdentifier(String pName, LockType pType) {
     name = pName;
     type = pType;
@@ -43,10 +47,7 @@ public class LockIdentifier implements Comparable<LockIdentifier> {
     return LockIdentifier.of(name, var, LockType.GLOBAL_LOCK);
   }
 
-  public static LockIdentifier of(String name, String var, LockType type) {
-    if (createdIds == null) {
-      createdIds = new HashSet<>();
-    }
+  public static synchronized LockIdentifier of(String name, String var, LockType type) {
     LockIdentifier newId;
     if (var.isEmpty()) {
       newId = new LockIdentifier(name, type);
@@ -55,16 +56,20 @@ public class LockIdentifier implements Comparable<LockIdentifier> {
       newId = new LockIdentifierWithVariable(name, varName, type);
     }
 
-    for (LockIdentifier id : createdIds) {
-      if (id.equals(newId)) {
-        return id;
-      }
+    LockIdentifier id = createdIds.get(newId);
+    if (id != null) {
+      return id;
     }
 
-    createdIds.add(newId);
+    newId.index = createdIds.size();
+    createdIds.put(newId, newId);
     return newId;
   }
 
+  int getIndex() {
+    return index;
+  }
+
   public String getName() {
     return name;
   }
@@ -12,8 +12,12 @@ import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
 import com.google.common.collect.HashMultiset;
 import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableSortedSet;
+import com.google.common.collect.Interner;
+import com.google.common.collect.Interners;
 import com.google.common.collect.Multiset;
 import com.google.common.collect.Sets;
+import java.util.Arrays;
 import java.util.Iterator;
 import java.util.Map;
 import java.util.Map.Entry;
@@ -29,31 +33,62 @@ import org.sosy_lab.cpachecker.cpa.usage.CompatibleState;
 
 public final class LockState extends AbstractLockState {
 
-  @SuppressWarnings("checkstyle:IllegalType") // TODO: use composition instead of inheritance
-  public static class LockTreeNode extends TreeSet<LockIdentifier> implements CompatibleNode {
+  /**
+   * The set of locks of a usage. The locks are stored as a bitset over the indices of the interned
+   * {@link LockIdentifier}s, so that the checks for compatibility and coverage of usages are
+   * word-level operations. Nodes are interned, because many usages share the same lockset.
+   */
+  public static final class LockTreeNode implements CompatibleNode {
+
+    private static final Interner<LockTreeNode> INTERNER = Interners.newWeakInterner();
 
-    private static final long serialVersionUID = 5757759799394605077L;
+    private static final LockTreeNode EMPTY = new LockTreeNode(ImmutableSortedSet.of());
+
+    // sorted set for iteration order in compareTo and toString
+    private final ImmutableSortedSet<LockIdentifier> locks;
+    private final long[] bits;
+
+    private LockTreeNode(ImmutableSortedSet<LockIdentifier> pLocks) {
+      locks = pLocks;
+      int maxIndex = -1;
+      for (LockIdentifier lock : pLocks) {
+        maxIndex = Math.max(maxIndex, lock.getIndex());
+      }
+      bits = new long[(maxIndex >> 6) + 1];
+      for (LockIdentifier lock : pLocks) {
+        bits[lock.getIndex() >> 6] |= 1L << lock.getIndex();
+      }
+    }
 
-    public LockTreeNode(Set<LockIdentifier> locks) {
-      super(locks);
+    public static LockTreeNode of(Set<LockIdentifier> pLocks) {
+      if (pLocks.isEmpty()) {
+        return EMPTY;
+      }
+      return INTERNER.intern(new LockTreeNode(ImmutableSortedSet.copyOf(pLocks)));
     }
 
     @Override
     public boolean isCompatibleWith(CompatibleState pState) {
       Preconditions.checkArgument(pState instanceof LockTreeNode);
-      return Sets.intersection(this, (LockTreeNode) pState).isEmpty();
+      long[] otherBits = ((LockTreeNode) pState).bits;
+      for (int i = 0; i < Math.min(bits.length, otherBits.length); i++) {
+        if ((bits[i] & otherBits[i]) != 0) {
+          return false;
+        }
+      }
+      return true;
     }
 
     @Override
     public int compareTo(CompatibleState pArg0) {
       Preconditions.checkArgument(pArg0 instanceof LockTreeNode);
       LockTreeNode o = (LockTreeNode) pArg0;
-      int result = size() - o.size();
+      int result = locks.size() - o.locks.size();
       if (result != 0) {
         return result;
       }
-      Iterator<LockIdentifier> lockIterator = iterator();
-      Iterator<LockIdentifier> lockIterator2 = o.iterator();
+      Iterator<LockIdentifier> lockIterator = locks.iterator();
+      Iterator<LockIdentifier> lockIterator2 = o.locks.iterator();
       while (lockIterator.hasNext()) {
         result = lockIterator.next().compareTo(lockIterator2.next());
         if (result != 0) {
@@ -69,16 +104,38 @@ public final class LockState extends AbstractLockState {
       LockTreeNode o = (LockTreeNode) pNode;
 
       // empty locks do not cover all others (special case
-      if (this.isEmpty()) {
-        return o.isEmpty();
+      if (locks.isEmpty()) {
+        return o.locks.isEmpty();
       } else {
-        return o.containsAll(this);
+        for (int i = 0; i < bits.length; i++) {
+          long otherBits = i < o.bits.length ? o.bits[i] : 0;
+          if ((bits[i] & ~otherBits) != 0) {
+            return false;
+          }
+        }
+        return true;
       }
     }
 
     @Override
     public boolean hasEmptyLockSet() {
-      return isEmpty();
+      return locks.isEmpty();
+    }
+
+    @Override
+    public boolean equals(Object pObj) {
+      return this == pObj
+          || (pObj instanceof LockTreeNode && Arrays.equals(bits, ((LockTreeNode) pObj).bits));
+    }
+
+    @Override
+    public int hashCode() {
+      return Arrays.hashCode(bits);
+    }
+
+    @Override
+    public String toString() {
+      return locks.toString();
     }
   }
 
@@ -384,7 +441,7 @@ public final class LockState extends AbstractLockState {
 
   @Override
   public CompatibleNode getCompatibleNode() {
-    return new LockTreeNode(locks.keySet());
+    return LockTreeNode.of(locks.keySet());
   }
 
   @Override
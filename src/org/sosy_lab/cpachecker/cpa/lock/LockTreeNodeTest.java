@@ -0,0 +1,70 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.lock;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableSet;
+import java.util.ArrayList;
+import java.util.List;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cpa.lock.LockState.LockTreeNode;
+
+public class LockTreeNodeTest {
+
+  private static List<LockIdentifier> createLocks(int pNumber) {
+    List<LockIdentifier> locks = new ArrayList<>();
+    for (int i = 0; i < pNumber; i++) {
+      locks.add(LockIdentifier.of("LockTreeNodeTest_lock_" + i));
+    }
+    return locks;
+  }
+
+  @Test
+  public void compatibility() {
+    List<LockIdentifier> locks = createLocks(130);
+    LockTreeNode first = LockTreeNode.of(ImmutableSet.of(locks.get(0), locks.get(129)));
+    LockTreeNode second = LockTreeNode.of(ImmutableSet.of(locks.get(1), locks.get(65)));
+    LockTreeNode third = LockTreeNode.of(ImmutableSet.of(locks.get(65), locks.get(129)));
+    LockTreeNode empty = LockTreeNode.of(ImmutableSet.of());
+
+    assertThat(first.isCompatibleWith(second)).isTrue();
+    assertThat(second.isCompatibleWith(first)).isTrue();
+    assertThat(first.isCompatibleWith(third)).isFalse();
+    assertThat(second.isCompatibleWith(third)).isFalse();
+    assertThat(empty.isCompatibleWith(first)).isTrue();
+    assertThat(first.isCompatibleWith(first)).isFalse();
+  }
+
+  @Test
+  public void cover() {
+    List<LockIdentifier> locks = createLocks(100);
+    LockTreeNode small = LockTreeNode.of(ImmutableSet.of(locks.get(3)));
+    LockTreeNode large = LockTreeNode.of(ImmutableSet.of(locks.get(3), locks.get(99)));
+    LockTreeNode empty = LockTreeNode.of(ImmutableSet.of());
+
+    assertThat(small.cover(large)).isTrue();
+    assertThat(large.cover(small)).isFalse();
+    assertThat(empty.cover(small)).isFalse();
+    assertThat(empty.cover(empty)).isTrue();
+    assertThat(small.cover(empty)).isFalse();
+  }
+
+  @Test
+  public void interning() {
+    List<LockIdentifier> locks = createLocks(2);
+    LockTreeNode node = LockTreeNode.of(ImmutableSet.of(locks.get(0), locks.get(1)));
+    LockTreeNode sameNode = LockTreeNode.of(ImmutableSet.of(locks.get(1), locks.get(0)));
+
+    assertThat(sameNode).isSameInstanceAs(node);
+    assertThat(node.compareTo(sameNode)).isEqualTo(0);
+    assertThat(node.toString())
+        .isEqualTo("[LockTreeNodeTest_lock_0, LockTreeNodeTest_lock_1]");
+  }
+}
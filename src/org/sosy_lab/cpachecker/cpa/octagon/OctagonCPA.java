@@ -8,14 +8,18 @@
 
 package org.sosy_lab.cpachecker.cpa.octagon;
 
+import java.io.PrintStream;
+import java.util.Collection;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.defaults.AutomaticCPAFactory;
 import org.sosy_lab.cpachecker.core.defaults.StopSepOperator;
 import org.sosy_lab.cpachecker.core.defaults.precision.VariableTrackingPrecision;
@@ -26,29 +30,56 @@ import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
 import org.sosy_lab.cpachecker.core.interfaces.MergeOperator;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.StateSpacePartition;
+import org.sosy_lab.cpachecker.core.interfaces.Statistics;
+import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
+import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.octagon.Octagon;
 import org.sosy_lab.cpachecker.util.octagon.OctagonFloatManager;
 import org.sosy_lab.cpachecker.util.octagon.OctagonIntManager;
+import org.sosy_lab.cpachecker.util.octagon.OctagonJavaManager;
 import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
+import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
 
 @Options(prefix="cpa.octagon")
-public final class OctagonCPA implements ConfigurableProgramAnalysis {
+public final class OctagonCPA implements ConfigurableProgramAnalysis, StatisticsProvider {
 
   public static CPAFactory factory() {
     return AutomaticCPAFactory.forType(OctagonCPA.class);
   }
 
-  @Option(secure=true, name="octagonLibrary", toUppercase=true, values={"INT", "FLOAT"},
+  @Option(secure=true, name="octagonLibrary", toUppercase=true,
+      values={"INT", "FLOAT", "JAVA_INT", "JAVA_FLOAT"},
       description="with this option the number representation in the"
-          + " library will be changed between floats and ints.")
+          + " library will be changed between floats and ints."
+          + " The JAVA variants use a pure-Java implementation of octagons"
+          + " instead of the native library.")
   private String octagonLibrary = "INT";
 
   @Option(secure=true, name="initialPrecisionType", toUppercase=true, values={"STATIC_FULL", "REFINEABLE_EMPTY"},
       description="this option determines which initial precision should be used")
   private String precisionType = "STATIC_FULL";
 
+  @Option(
+      secure = true,
+      description =
+          "free the native memory of octagons that are created during a transfer but are not"
+              + " part of a successor state directly after the transfer, instead of waiting for"
+              + " the garbage collector")
+  private boolean releaseIntermediateOctagons = true;
+
+  @Option(
+      secure = true,
+      description =
+          "number of octagons of the native library that may be alive before a garbage"
+              + " collection is requested to free the native memory of unreachable octagons"
+              + " (0 to disable). The Java garbage collector does not see the native memory,"
+              + " so without a limit the native heap can grow until the process is killed.")
+  @IntegerOption(min = 0)
+  private int nativeOctagonLimit = 0;
+
   private final AbstractDomain abstractDomain;
   private final TransferRelation transferRelation;
   private final MergeOperator mergeOperator;
@@ -72,12 +103,18 @@ public final class OctagonCPA implements ConfigurableProgramAnalysis {
 
     if (octagonLibrary.equals("FLOAT")) {
       octagonManager = new OctagonFloatManager();
+    } else if (octagonLibrary.equals("JAVA_INT")) {
+      octagonManager = new OctagonJavaManager(true);
+    } else if (octagonLibrary.equals("JAVA_FLOAT")) {
+      octagonManager = new OctagonJavaManager(false);
     } else {
       octagonManager = new OctagonIntManager();
     }
+    Octagon.setNativeOctagonLimit(nativeOctagonLimit);
 
     this.transferRelation =
-        new OctagonTransferRelation(logger, cfa.getLoopStructure().orElseThrow());
+        new OctagonTransferRelation(
+            logger, cfa.getLoopStructure().orElseThrow(), releaseIntermediateOctagons);
     this.abstractDomain = octagonDomain;
     this.mergeOperator = OctagonMergeOperator.getInstance(octagonDomain, config);
     this.stopOperator = new StopSepOperator(octagonDomain);
@@ -145,4 +182,24 @@ public final class OctagonCPA implements ConfigurableProgramAnalysis {
   public CFA getCFA() {
     return cfa;
   }
+
+  @Override
+  public void collectStatistics(Collection<Statistics> pStatsCollection) {
+    pStatsCollection.add(
+        new Statistics() {
+
+          @Override
+          public void printStatistics(
+              PrintStream pOut, Result pResult, UnmodifiableReachedSet pReached) {
+            StatisticsWriter.writingStatisticsTo(pOut)
+                .put("Native octagons alive at end", Octagon.getLiveNativeOctagons())
+                .put("Max. native octagons alive", Octagon.getPeakNativeOctagons());
+          }
+
+          @Override
+          public String getName() {
+            return OctagonCPA.class.getSimpleName();
+          }
+        });
+  }
 }
@@ -32,6 +32,7 @@ import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.octagon.NumArray;
+import org.sosy_lab.cpachecker.util.octagon.NumArrayValues;
 import org.sosy_lab.cpachecker.util.octagon.Octagon;
 import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
@@ -393,15 +394,14 @@ public class OctagonState implements AbstractState {
    * Helper method for all addXXXXConstraint methods
    */
   private OctagonState addConstraint(BinaryConstraints cons, int leftIndex, int rightIndex, OctagonNumericValue constantValue) {
-    NumArray arr = octagonManager.init_num_t(4);
-    octagonManager.num_set_int(arr, 0, cons.getNumber());
-    octagonManager.num_set_int(arr, 1, leftIndex);
-    octagonManager.num_set_int(arr, 2, rightIndex);
+    NumArrayValues values =
+        new NumArrayValues(4).setInt(0, cons.getNumber()).setInt(1, leftIndex).setInt(2, rightIndex);
     if (constantValue instanceof OctagonDoubleValue) {
-      octagonManager.num_set_float(arr, 3, constantValue.getValue().doubleValue());
+      values.setFloat(3, constantValue.getValue().doubleValue());
     } else {
-      octagonManager.num_set_int(arr, 3, constantValue.getValue().longValue());
+      values.setInt(3, constantValue.getValue().longValue());
     }
+    NumArray arr = octagonManager.init_num_t(values);
 
     OctagonState newState =
         new OctagonState(
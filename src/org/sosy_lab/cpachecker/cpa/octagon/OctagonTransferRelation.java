@@ -77,6 +77,8 @@ import org.sosy_lab.cpachecker.cfa.types.c.CTypedefType;
 import org.sosy_lab.cpachecker.cfa.types.c.CVoidType;
 import org.sosy_lab.cpachecker.core.defaults.ForwardingTransferRelation;
 import org.sosy_lab.cpachecker.core.defaults.precision.VariableTrackingPrecision;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.cpa.octagon.OctagonState.Type;
 import org.sosy_lab.cpachecker.cpa.octagon.coefficients.IOctagonCoefficients;
 import org.sosy_lab.cpachecker.cpa.octagon.coefficients.OctagonIntervalCoefficients;
@@ -91,6 +93,7 @@ import org.sosy_lab.cpachecker.exceptions.UnsupportedCodeException;
 import org.sosy_lab.cpachecker.util.LoopStructure;
 import org.sosy_lab.cpachecker.util.LoopStructure.Loop;
 import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.octagon.OctagonArena;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 
 @SuppressWarnings("rawtypes")
@@ -114,8 +117,13 @@ public class OctagonTransferRelation extends ForwardingTransferRelation<Collecti
 
   private final ImmutableSet<CFANode> loopHeads;
 
-  public OctagonTransferRelation(LogManager log, LoopStructure loops) {
+  /** whether octagons created during a transfer and not part of a successor are freed directly */
+  private final boolean releaseIntermediateOctagons;
+
+  public OctagonTransferRelation(
+      LogManager log, LoopStructure loops, boolean pReleaseIntermediateOctagons) {
     logger = log;
+    releaseIntermediateOctagons = pReleaseIntermediateOctagons;
 
     ImmutableSet.Builder<CFANode> builder = new ImmutableSet.Builder<>();
     for (Loop l : loops.getAllLoops()) {
@@ -125,6 +133,26 @@ public class OctagonTransferRelation extends ForwardingTransferRelation<Collecti
     loopHeads = builder.build();
   }
 
+  @Override
+  public Collection<OctagonState> getAbstractSuccessorsForEdge(
+      AbstractState pState, Precision pPrecision, CFAEdge pCfaEdge)
+      throws CPATransferException, InterruptedException {
+    if (!releaseIntermediateOctagons) {
+      return super.getAbstractSuccessorsForEdge(pState, pPrecision, pCfaEdge);
+    }
+
+    // a single transfer creates many temporary octagons, free them
+    // directly instead of waiting for the garbage collector
+    try (OctagonArena arena = ((OctagonState) pState).getOctagon().getManager().openArena()) {
+      Collection<OctagonState> successors =
+          super.getAbstractSuccessorsForEdge(pState, pPrecision, pCfaEdge);
+      for (OctagonState successor : successors) {
+        arena.keep(successor.getOctagon());
+      }
+      return successors;
+    }
+  }
+
   @Override
   protected Collection<OctagonState> postProcessing(Collection<OctagonState> successors, CFAEdge edge) {
     assert !successors.contains(null); // TODO is this assertion equal to next line?
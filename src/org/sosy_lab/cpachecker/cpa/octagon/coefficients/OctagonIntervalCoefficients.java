@@ -17,6 +17,7 @@ import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonIntValue;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
 import org.sosy_lab.cpachecker.util.octagon.NumArray;
+import org.sosy_lab.cpachecker.util.octagon.NumArrayValues;
 import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
 
 @SuppressWarnings("rawtypes")
@@ -410,31 +411,31 @@ public class OctagonIntervalCoefficients extends AOctagonCoefficients {
 
   @Override
   public NumArray getNumArray(OctagonManager manager) {
-    NumArray arr = manager.init_num_t(coefficients.length * 2);
+    NumArrayValues values = new NumArrayValues(coefficients.length * 2);
     for (int i = 0; i < coefficients.length; i++) {
       OctagonNumericValue low = coefficients[i].getLow();
       OctagonNumericValue high = coefficients[i].getHigh();
 
       if (low.isInfinite()) {
-        manager.num_set_inf(arr, i*2+1);
+        values.setInfinite(i*2+1);
       } else {
         if (low instanceof OctagonDoubleValue) {
-          manager.num_set_float(arr, i*2+1, low.getValue().doubleValue()*-1);
+          values.setFloat(i*2+1, low.getValue().doubleValue()*-1);
         } else {
-          manager.num_set_int(arr, i*2+1, low.getValue().longValue()*-1);
+          values.setInt(i*2+1, low.getValue().longValue()*-1);
         }
       }
 
       if (high.isInfinite()) {
-        manager.num_set_inf(arr, i*2);
+        values.setInfinite(i*2);
       } else {
         if (high instanceof OctagonDoubleValue) {
-          manager.num_set_float(arr, i*2, high.getValue().doubleValue());
+          values.setFloat(i*2, high.getValue().doubleValue());
         } else {
-          manager.num_set_int(arr, i*2, high.getValue().longValue());
+          values.setInt(i*2, high.getValue().longValue());
         }
       }
     }
-    return arr;
+    return manager.init_num_t(values);
   }
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonIntValue;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonNumericValue;
 import org.sosy_lab.cpachecker.util.octagon.NumArray;
+import org.sosy_lab.cpachecker.util.octagon.NumArrayValues;
 import org.sosy_lab.cpachecker.util.octagon.OctagonManager;
 
 @SuppressWarnings("rawtypes")
@@ -424,15 +425,15 @@ public class OctagonSimpleCoefficients extends AOctagonCoefficients {
    */
   @Override
   public NumArray getNumArray(OctagonManager manager) {
-    NumArray arr = manager.init_num_t(coefficients.length);
+    NumArrayValues values = new NumArrayValues(coefficients.length);
     for (int i = 0; i < coefficients.length; i++) {
       if (coefficients[i] instanceof OctagonDoubleValue) {
-        manager.num_set_float(arr, i, coefficients[i].getValue().doubleValue());
+        values.setFloat(i, coefficients[i].getValue().doubleValue());
       } else {
-        manager.num_set_int(arr, i, coefficients[i].getValue().longValue());
+        values.setInt(i, coefficients[i].getValue().longValue());
       }
     }
-    return arr;
+    return manager.init_num_t(values);
   }
 
 }
@@ -0,0 +1,874 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.pointer2;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import com.google.common.collect.ImmutableList;
+import java.math.BigInteger;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.BitSet;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import java.util.Set;
+import java.util.function.Function;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.ast.c.CAddressOfLabelExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CArraySubscriptExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CAssignment;
+import org.sosy_lab.cpachecker.cfa.ast.c.CBinaryExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CCastExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CCharLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CComplexCastExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFieldReference;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFloatLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCall;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallAssignmentStatement;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIdExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CImaginaryLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CInitializer;
+import org.sosy_lab.cpachecker.cfa.ast.c.CInitializerExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CInitializerList;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIntegerLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CParameterDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.CPointerExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CRightHandSide;
+import org.sosy_lab.cpachecker.cfa.ast.c.CRightHandSideVisitor;
+import org.sosy_lab.cpachecker.cfa.ast.c.CSimpleDeclaration;
+import org.sosy_lab.cpachecker.cfa.ast.c.CStringLiteralExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CTypeIdExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CUnaryExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CUnaryExpression.UnaryOperator;
+import org.sosy_lab.cpachecker.cfa.ast.c.CVariableDeclaration;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.c.CDeclarationEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CFunctionCallEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CFunctionEntryNode;
+import org.sosy_lab.cpachecker.cfa.model.c.CFunctionReturnEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CFunctionSummaryEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CReturnStatementEdge;
+import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
+import org.sosy_lab.cpachecker.cfa.types.Type;
+import org.sosy_lab.cpachecker.cfa.types.c.CComplexType.ComplexTypeKind;
+import org.sosy_lab.cpachecker.cfa.types.c.CCompositeType;
+import org.sosy_lab.cpachecker.cfa.types.c.CCompositeType.CCompositeTypeMemberDeclaration;
+import org.sosy_lab.cpachecker.cfa.types.c.CPointerType;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.cpa.pointer2.util.LocationSetTop;
+import org.sosy_lab.cpachecker.exceptions.CPATransferException;
+import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+
+/**
+ * Flow-insensitive, inclusion-based (Andersen-style) pointer analysis that uses the same memory
+ * locations as the {@link PointerCPA}, but does not run a CPA.
+ *
+ * <p>Each edge of the CFA is translated once into constraints between points-to sets (address-of,
+ * copy, load and store). The constraints are solved with a worklist on the constraint graph, and
+ * cycles of copy edges, whose points-to sets are necessarily equal, are detected lazily and
+ * collapsed into a single node. The result is returned as a single {@link PointerState} that
+ * over-approximates the points-to information of all program locations.
+ *
+ * <p>Without field sensitivity, all fields of a composite type share the location of the type.
+ */
+public final class AndersenPointerAnalysis {
+
+  /** Check for shutdown requests after this many processed nodes. */
+  private static final int SHUTDOWN_CHECK_INTERVAL = 1000;
+
+  private final boolean fieldSensitive;
+  private final ShutdownNotifier shutdownNotifier;
+
+  /**
+   * The possible callees of call statements, or null if the CFA already contains function call
+   * edges and call statements are calls of undefined functions.
+   */
+  private final @Nullable Function<CFunctionCallExpression, ? extends Iterable<CFunctionEntryNode>>
+      callees;
+
+  private final Map<MemoryLocation, Integer> locationNodes = new HashMap<>();
+
+  /** The memory location of each node, or null for temporary nodes. */
+  private final List<MemoryLocation> locations = new ArrayList<>();
+
+  private final List<Node> nodes = new ArrayList<>();
+
+  /** Nodes that are assigned to all locations (e.g., because of an unknown array index). */
+  private final List<Integer> assignedToAll = new ArrayList<>();
+
+  /** Nodes whose points-to set is already copied into the points-to sets of all locations. */
+  private final Set<Integer> storedToAll = new HashSet<>();
+
+  /** Copy edges (as pairs of node ids) that already triggered a cycle detection. */
+  private final Set<Long> checkedCopyEdges = new HashSet<>();
+
+  private final Deque<Integer> worklist = new ArrayDeque<>();
+  private final BitSet inWorklist = new BitSet();
+
+  private AndersenPointerAnalysis(
+      boolean pFieldSensitive,
+      @Nullable Function<CFunctionCallExpression, ? extends Iterable<CFunctionEntryNode>>
+          pCallees,
+      ShutdownNotifier pShutdownNotifier) {
+    fieldSensitive = pFieldSensitive;
+    callees = pCallees;
+    shutdownNotifier = checkNotNull(pShutdownNotifier);
+  }
+
+  /**
+   * Compute the flow-insensitive points-to information for all edges of the given CFA.
+   *
+   * @param pCfa the CFA to analyze.
+   * @param pFieldSensitive whether fields of composite types are distinguished.
+   * @param pShutdownNotifier the notifier for shutdown requests.
+   * @return a pointer state that contains the points-to sets of all memory locations.
+   */
+  public static PointerState computePointsToInformation(
+      CFA pCfa, boolean pFieldSensitive, ShutdownNotifier pShutdownNotifier)
+      throws CPATransferException, InterruptedException {
+    return computePointsToInformation(
+        new AndersenPointerAnalysis(pFieldSensitive, null, pShutdownNotifier), pCfa);
+  }
+
+  /**
+   * Compute the flow-insensitive points-to information for a CFA whose function calls are still
+   * call statements, i.e., before function call and return edges are created. For each call
+   * statement, the arguments are bound to the parameters and the return value is bound to the
+   * left-hand side for every callee given by the callee function.
+   *
+   * @param pCfa the CFA to analyze.
+   * @param pFieldSensitive whether fields of composite types are distinguished.
+   * @param pCallees the possible callees of a call expression (empty for undefined functions).
+   * @param pShutdownNotifier the notifier for shutdown requests.
+   * @return a pointer state that contains the points-to sets of all memory locations.
+   */
+  public static PointerState computePointsToInformationForCallStatements(
+      CFA pCfa,
+      boolean pFieldSensitive,
+      Function<CFunctionCallExpression, ? extends Iterable<CFunctionEntryNode>> pCallees,
+      ShutdownNotifier pShutdownNotifier)
+      throws CPATransferException, InterruptedException {
+    return computePointsToInformation(
+        new AndersenPointerAnalysis(pFieldSensitive, checkNotNull(pCallees), pShutdownNotifier),
+        pCfa);
+  }
+
+  private static PointerState computePointsToInformation(
+      AndersenPointerAnalysis pAnalysis, CFA pCfa)
+      throws CPATransferException, InterruptedException {
+    for (CFANode node : pCfa.getAllNodes()) {
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        pAnalysis.addConstraints(edge);
+      }
+    }
+    pAnalysis.solve();
+    return pAnalysis.toPointerState();
+  }
+
+  /**
+   * A set of memory locations, each of them dereferenced the given number of times. A location
+   * that is dereferenced zero times stands for its own address.
+   */
+  private static final class Term {
+
+    private static final Term NONE = new Term(false, ImmutableList.of());
+    private static final Term ALL = new Term(true, ImmutableList.of());
+
+    private final boolean all;
+    private final ImmutableList<Pair<MemoryLocation, Integer>> dereferencedLocations;
+
+    private Term(boolean pAll, ImmutableList<Pair<MemoryLocation, Integer>> pLocations) {
+      all = pAll;
+      dereferencedLocations = pLocations;
+    }
+
+    private static Term of(MemoryLocation pLocation, int pDereferences) {
+      return new Term(false, ImmutableList.of(Pair.of(pLocation, pDereferences)));
+    }
+
+    private Term union(Term pOther) {
+      if (all || pOther.all) {
+        return ALL;
+      }
+      return new Term(
+          false,
+          ImmutableList.<Pair<MemoryLocation, Integer>>builder()
+              .addAll(dereferencedLocations)
+              .addAll(pOther.dereferencedLocations)
+              .build());
+    }
+
+    private Term dereference() {
+      if (all) {
+        return ALL;
+      }
+      ImmutableList.Builder<Pair<MemoryLocation, Integer>> result = ImmutableList.builder();
+      for (Pair<MemoryLocation, Integer> location : dereferencedLocations) {
+        result.add(Pair.of(location.getFirstNotNull(), location.getSecondNotNull() + 1));
+      }
+      return new Term(false, result.build());
+    }
+
+    private boolean isEmpty() {
+      return !all && dereferencedLocations.isEmpty();
+    }
+  }
+
+  private static final class Node {
+
+    private int representative;
+
+    private final BitSet pointsTo = new BitSet();
+
+    /** Whether this node may point to any location. */
+    private boolean pointsToAll = false;
+
+    /** Copy edges: the points-to sets of these nodes include the one of this node. */
+    private Set<Integer> successors = new HashSet<>();
+
+    /** Load constraints: the points-to sets of these nodes include the ones of all pointees. */
+    private List<Integer> loads = new ArrayList<>();
+
+    /** Store constraints: the points-to sets of all pointees include the ones of these nodes. */
+    private List<Integer> stores = new ArrayList<>();
+
+    /** The pointees for which the load and store constraints were already resolved. */
+    private BitSet handledPointees = new BitSet();
+
+    private boolean handledPointsToAll = false;
+
+    private Node(int pId) {
+      representative = pId;
+    }
+  }
+
+  // constraint generation
+
+  private void addConstraints(CFAEdge pEdge) throws CPATransferException {
+    switch (pEdge.getEdgeType()) {
+      case AssumeEdge:
+      case BlankEdge:
+      case CallToReturnEdge:
+        break;
+      case DeclarationEdge:
+        addDeclarationConstraints((CDeclarationEdge) pEdge);
+        break;
+      case FunctionCallEdge:
+        addFunctionCallConstraints((CFunctionCallEdge) pEdge);
+        break;
+      case FunctionReturnEdge:
+        addFunctionReturnConstraints((CFunctionReturnEdge) pEdge);
+        break;
+      case ReturnStatementEdge:
+        CReturnStatementEdge returnEdge = (CReturnStatementEdge) pEdge;
+        Optional<MemoryLocation> returnVariable =
+            PointerTransferRelation.getFunctionReturnVariable(
+                returnEdge.getSuccessor().getEntryNode());
+        if (returnEdge.getExpression().isPresent() && returnVariable.isPresent()) {
+          addAssignment(
+              Term.of(returnVariable.orElseThrow(), 0),
+              toTerm(returnEdge.getExpression().get(), 1));
+        }
+        break;
+      case StatementEdge:
+        addStatementConstraints((CStatementEdge) pEdge);
+        break;
+      default:
+        throw new UnrecognizedCodeException("Unrecognized CFA edge.", pEdge);
+    }
+  }
+
+  private void addDeclarationConstraints(CDeclarationEdge pEdge)
+      throws UnrecognizedCodeException {
+    if (pEdge.getDeclaration() instanceof CVariableDeclaration) {
+      CVariableDeclaration declaration = (CVariableDeclaration) pEdge.getDeclaration();
+      CInitializer initializer = declaration.getInitializer();
+      if (initializer != null) {
+        addInitializerConstraints(
+            PointerTransferRelation.toLocation(declaration), declaration.getType(), initializer);
+      }
+    }
+  }
+
+  private void addInitializerConstraints(
+      MemoryLocation pLocation, CType pType, CInitializer pInitializer)
+      throws UnrecognizedCodeException {
+    CType type = pType.getCanonicalType();
+    if (pInitializer instanceof CInitializerList
+        && type instanceof CCompositeType
+        && ((CCompositeType) type).getKind() == ComplexTypeKind.STRUCT) {
+      CCompositeType compositeType = (CCompositeType) type;
+      Iterator<CCompositeTypeMemberDeclaration> memberDecls =
+          compositeType.getMembers().iterator();
+      Iterator<CInitializer> initializers =
+          ((CInitializerList) pInitializer).getInitializers().iterator();
+      while (memberDecls.hasNext() && initializers.hasNext()) {
+        CCompositeTypeMemberDeclaration memberDecl = memberDecls.next();
+        CInitializer initializer = initializers.next();
+        if (initializer != null) {
+          addInitializerConstraints(
+              toMemberLocation(compositeType, memberDecl), memberDecl.getType(), initializer);
+        }
+      }
+    } else if (pInitializer instanceof CInitializerExpression) {
+      addAssignment(
+          Term.of(pLocation, 0),
+          toTerm(((CInitializerExpression) pInitializer).getExpression(), 1));
+    } else {
+      addAssignment(Term.of(pLocation, 0), Term.ALL);
+    }
+  }
+
+  private void addFunctionCallConstraints(CFunctionCallEdge pEdge)
+      throws UnrecognizedCodeException {
+    addParameterConstraints(pEdge.getSuccessor().getFunctionParameters(), pEdge.getArguments());
+  }
+
+  private void addParameterConstraints(
+      List<CParameterDeclaration> formalParams, List<CExpression> actualParams)
+      throws UnrecognizedCodeException {
+    int limit = Math.min(formalParams.size(), actualParams.size());
+    for (int i = 0; i < limit; i++) {
+      addAssignment(
+          Term.of(PointerTransferRelation.toLocation(formalParams.get(i)), 0),
+          toTerm(actualParams.get(i), 1));
+    }
+  }
+
+  private void addFunctionReturnConstraints(CFunctionReturnEdge pEdge)
+      throws UnrecognizedCodeException {
+    CFunctionSummaryEdge summaryEdge = pEdge.getSummaryEdge();
+    CFunctionCall call = summaryEdge.getExpression();
+    if (call instanceof CFunctionCallAssignmentStatement) {
+      Optional<MemoryLocation> returnVariable =
+          PointerTransferRelation.getFunctionReturnVariable(summaryEdge.getFunctionEntry());
+      assert returnVariable.isPresent()
+          : "Return edge with assignment, but no return variable: " + summaryEdge;
+      addAssignment(
+          toTerm(((CFunctionCallAssignmentStatement) call).getLeftHandSide(), 0),
+          Term.of(returnVariable.orElseThrow(), 1));
+    }
+  }
+
+  private void addCallStatementConstraints(CFunctionCall pCall)
+      throws UnrecognizedCodeException {
+    CFunctionCallExpression callExpression = pCall.getFunctionCallExpression();
+    for (CFunctionEntryNode callee : callees.apply(callExpression)) {
+      addParameterConstraints(
+          callee.getFunctionParameters(), callExpression.getParameterExpressions());
+      if (pCall instanceof CFunctionCallAssignmentStatement) {
+        Optional<MemoryLocation> returnVariable =
+            PointerTransferRelation.getFunctionReturnVariable(callee);
+        if (returnVariable.isPresent()) {
+          addAssignment(
+              toTerm(((CFunctionCallAssignmentStatement) pCall).getLeftHandSide(), 0),
+              Term.of(returnVariable.orElseThrow(), 1));
+        }
+      }
+    }
+  }
+
+  private void addStatementConstraints(CStatementEdge pEdge) throws UnrecognizedCodeException {
+    if (callees != null && pEdge.getStatement() instanceof CFunctionCall) {
+      addCallStatementConstraints((CFunctionCall) pEdge.getStatement());
+    }
+    if (pEdge.getStatement() instanceof CAssignment) {
+      CAssignment assignment = (CAssignment) pEdge.getStatement();
+      Term leftHandSide = toTerm(assignment.getLeftHandSide(), 0);
+      if (assignment instanceof CFunctionCallAssignmentStatement) {
+        // as in PointerTransferRelation, this is a call of an undefined function
+        if (PointerTransferRelation.isNondetPointerReturn(
+            ((CFunctionCallAssignmentStatement) assignment)
+                .getFunctionCallExpression()
+                .getFunctionNameExpression())) {
+          addAssignment(leftHandSide, Term.ALL);
+        }
+      } else {
+        addAssignment(leftHandSide, toTerm(assignment.getRightHandSide(), 1));
+      }
+    }
+  }
+
+  /**
+   * Add the constraints for an assignment: the points-to sets of all locations described by the
+   * left-hand side include all locations described by the right-hand side.
+   */
+  private void addAssignment(Term pLeftHandSide, Term pRightHandSide) {
+    if (pLeftHandSide.isEmpty() || pRightHandSide.isEmpty()) {
+      return;
+    }
+    int value = toNode(pRightHandSide);
+    if (pLeftHandSide.all) {
+      assignedToAll.add(value);
+      return;
+    }
+    for (Pair<MemoryLocation, Integer> target : pLeftHandSide.dereferencedLocations) {
+      int dereferences = target.getSecondNotNull();
+      if (dereferences == 0) {
+        getNode(value).successors.add(getLocationNode(target.getFirstNotNull()));
+      } else {
+        getNode(toNode(target.getFirstNotNull(), dereferences)).stores.add(value);
+      }
+    }
+  }
+
+  /** Return a node whose points-to set consists of the locations described by the given term. */
+  private int toNode(Term pTerm) {
+    if (!pTerm.all && pTerm.dereferencedLocations.size() == 1) {
+      Pair<MemoryLocation, Integer> location = pTerm.dereferencedLocations.get(0);
+      if (location.getSecondNotNull() > 0) {
+        return toNode(location.getFirstNotNull(), location.getSecondNotNull());
+      }
+    }
+    int result = createNode(null);
+    Node node = getNode(result);
+    node.pointsToAll = pTerm.all;
+    for (Pair<MemoryLocation, Integer> location : pTerm.dereferencedLocations) {
+      int dereferences = location.getSecondNotNull();
+      if (dereferences == 0) {
+        node.pointsTo.set(getLocationNode(location.getFirstNotNull()));
+      } else {
+        getNode(toNode(location.getFirstNotNull(), dereferences)).successors.add(result);
+      }
+    }
+    return result;
+  }
+
+  /**
+   * Return a node whose points-to set consists of the locations reached from the given location
+   * by the given positive number of dereferences.
+   */
+  private int toNode(MemoryLocation pLocation, int pDereferences) {
+    int result = getLocationNode(pLocation);
+    for (int i = 1; i < pDereferences; i++) {
+      int loaded = createNode(null);
+      getNode(result).loads.add(loaded);
+      result = loaded;
+    }
+    return result;
+  }
+
+  private MemoryLocation toMemberLocation(
+      CCompositeType pParent, CCompositeTypeMemberDeclaration pMemberDecl) {
+    if (fieldSensitive || pMemberDecl.getType().getCanonicalType() instanceof CCompositeType) {
+      return PointerTransferRelation.toLocation(pParent, pMemberDecl);
+    }
+    return MemoryLocation.valueOf(pParent.toString());
+  }
+
+  private MemoryLocation toFieldLocation(CFieldReference pFieldReference) {
+    if (fieldSensitive) {
+      return PointerTransferRelation.fieldReferenceToMemoryLocation(pFieldReference);
+    }
+    CType ownerType = pFieldReference.getFieldOwner().getExpressionType().getCanonicalType();
+    if (pFieldReference.isPointerDereference()) {
+      ownerType = ((CPointerType) ownerType).getType().getCanonicalType();
+    }
+    return MemoryLocation.valueOf(ownerType.toString());
+  }
+
+  /**
+   * Translate an expression into the term for the locations that the expression describes after
+   * the given number of dereferences, following {@link PointerTransferRelation#asLocations}.
+   */
+  private Term toTerm(CRightHandSide pExpression, int pDereferences)
+      throws UnrecognizedCodeException {
+    return pExpression.accept(new TermVisitor(pDereferences));
+  }
+
+  private final class TermVisitor
+      implements CRightHandSideVisitor<Term, UnrecognizedCodeException> {
+
+    private final int dereferences;
+
+    private TermVisitor(int pDereferences) {
+      dereferences = pDereferences;
+    }
+
+    @Override
+    public Term visit(CArraySubscriptExpression pExpression) throws UnrecognizedCodeException {
+      CExpression subscript = pExpression.getSubscriptExpression();
+      if (subscript instanceof CIntegerLiteralExpression
+          && ((CIntegerLiteralExpression) subscript).getValue().equals(BigInteger.ZERO)) {
+        return pExpression.getArrayExpression().accept(this).dereference();
+      }
+      return Term.ALL;
+    }
+
+    @Override
+    public Term visit(CFieldReference pExpression) {
+      return Term.of(toFieldLocation(pExpression), dereferences);
+    }
+
+    @Override
+    public Term visit(CIdExpression pExpression) {
+      Type type = pExpression.getExpressionType();
+      if (PointerTransferRelation.isStructOrUnion(type)) {
+        return Term.of(MemoryLocation.valueOf(type.toString()), dereferences);
+      }
+      CSimpleDeclaration declaration = pExpression.getDeclaration();
+      String name = declaration != null ? declaration.getQualifiedName() : pExpression.getName();
+      return Term.of(MemoryLocation.valueOf(name), dereferences);
+    }
+
+    @Override
+    public Term visit(CPointerExpression pExpression) throws UnrecognizedCodeException {
+      return toTerm(pExpression.getOperand(), dereferences + 1);
+    }
+
+    @Override
+    public Term visit(CComplexCastExpression pExpression) throws UnrecognizedCodeException {
+      return pExpression.getOperand().accept(this);
+    }
+
+    @Override
+    public Term visit(CBinaryExpression pExpression) throws UnrecognizedCodeException {
+      return pExpression
+          .getOperand1()
+          .accept(this)
+          .union(pExpression.getOperand2().accept(this));
+    }
+
+    @Override
+    public Term visit(CCastExpression pExpression) throws UnrecognizedCodeException {
+      return pExpression.getOperand().accept(this);
+    }
+
+    @Override
+    public Term visit(CCharLiteralExpression pExpression) {
+      return Term.NONE;
+    }
+
+    @Override
+    public Term visit(CFloatLiteralExpression pExpression) {
+      return Term.NONE;
+    }
+
+    @Override
+    public Term visit(CIntegerLiteralExpression pExpression) {
+      return Term.NONE;
+    }
+
+    @Override
+    public Term visit(CStringLiteralExpression pExpression) {
+      return Term.NONE;
+    }
+
+    @Override
+    public Term visit(CTypeIdExpression pExpression) {
+      return Term.NONE;
+    }
+
+    @Override
+    public Term visit(CImaginaryLiteralExpression pExpression) {
+      return Term.NONE;
+    }
+
+    @Override
+    public Term visit(CUnaryExpression pExpression) throws UnrecognizedCodeException {
+      if (dereferences > 0 && pExpression.getOperator() == UnaryOperator.AMPER) {
+        return toTerm(pExpression.getOperand(), dereferences - 1);
+      }
+      return Term.NONE;
+    }
+
+    @Override
+    public Term visit(CFunctionCallExpression pExpression) throws UnrecognizedCodeException {
+      CFunctionDeclaration declaration = pExpression.getDeclaration();
+      if (declaration == null) {
+        return pExpression.getFunctionNameExpression().accept(this);
+      }
+      return Term.of(MemoryLocation.valueOf(declaration.getQualifiedName()), dereferences);
+    }
+
+    @Override
+    public Term visit(CAddressOfLabelExpression pExpression) throws UnrecognizedCodeException {
+      throw new UnrecognizedCodeException(
+          "Address of labels not supported by pointer analysis", pExpression);
+    }
+  }
+
+  // constraint graph
+
+  private int createNode(MemoryLocation pLocation) {
+    int id = nodes.size();
+    nodes.add(new Node(id));
+    locations.add(pLocation);
+    return id;
+  }
+
+  private int getLocationNode(MemoryLocation pLocation) {
+    Integer id = locationNodes.get(pLocation);
+    if (id == null) {
+      id = createNode(pLocation);
+      locationNodes.put(pLocation, id);
+    }
+    return id;
+  }
+
+  private Node getNode(int pId) {
+    return nodes.get(pId);
+  }
+
+  /** Return the representative of the collapsed cycle that contains the given node. */
+  private int find(int pId) {
+    int root = pId;
+    while (getNode(root).representative != root) {
+      root = getNode(root).representative;
+    }
+    int current = pId;
+    while (current != root) {
+      Node node = getNode(current);
+      current = node.representative;
+      node.representative = root;
+    }
+    return root;
+  }
+
+  // solving
+
+  private void solve() throws InterruptedException {
+    for (int id = 0; id < nodes.size(); id++) {
+      Node node = getNode(id);
+      if (node.pointsToAll || !node.pointsTo.isEmpty()) {
+        enqueue(id);
+      }
+    }
+    for (int value : assignedToAll) {
+      storeToAll(value);
+    }
+
+    int processed = 0;
+    while (!worklist.isEmpty()) {
+      if (++processed % SHUTDOWN_CHECK_INTERVAL == 0) {
+        shutdownNotifier.shutdownIfNecessary();
+      }
+      int id = worklist.poll();
+      inWorklist.clear(id);
+      if (find(id) != id) {
+        continue; // collapsed into another node, which is enqueued itself
+      }
+      process(id);
+    }
+  }
+
+  private void process(int pId) {
+    Node node = getNode(pId);
+
+    if (node.pointsToAll) {
+      if (!node.handledPointsToAll) {
+        node.handledPointsToAll = true;
+        for (int loaded : ImmutableList.copyOf(node.loads)) {
+          int target = find(loaded);
+          if (!getNode(target).pointsToAll) {
+            getNode(target).pointsToAll = true;
+            enqueue(target);
+          }
+        }
+        for (int stored : ImmutableList.copyOf(node.stores)) {
+          storeToAll(stored);
+        }
+      }
+    } else {
+      BitSet newPointees = (BitSet) node.pointsTo.clone();
+      newPointees.andNot(node.handledPointees);
+      node.handledPointees.or(newPointees);
+      for (int pointee = newPointees.nextSetBit(0);
+          pointee >= 0;
+          pointee = newPointees.nextSetBit(pointee + 1)) {
+        for (int loaded : ImmutableList.copyOf(node.loads)) {
+          addCopyEdge(pointee, loaded);
+        }
+        for (int stored : ImmutableList.copyOf(node.stores)) {
+          addCopyEdge(stored, pointee);
+        }
+      }
+    }
+
+    // resolving the constraints does not collapse cycles, so pId is still a representative
+    int current = pId;
+    for (int successor : ImmutableList.copyOf(node.successors)) {
+      int target = find(successor);
+      if (target == current) {
+        continue;
+      }
+      if (propagate(current, target)) {
+        enqueue(target);
+      } else if (hasSamePointsToSet(current, target)
+          && checkedCopyEdges.add(((long) current << 32) | target)) {
+        collapseCycles(target);
+        current = find(current);
+      }
+    }
+  }
+
+  private void storeToAll(int pValue) {
+    if (storedToAll.add(pValue)) {
+      for (int location : locationNodes.values()) {
+        addCopyEdge(pValue, location);
+      }
+    }
+  }
+
+  private void addCopyEdge(int pFrom, int pTo) {
+    int from = find(pFrom);
+    int to = find(pTo);
+    if (from != to && getNode(from).successors.add(to) && propagate(from, to)) {
+      enqueue(to);
+    }
+  }
+
+  /** Copy the points-to set of the first node into that of the second, return whether it grew. */
+  private boolean propagate(int pFrom, int pTo) {
+    Node from = getNode(pFrom);
+    Node to = getNode(pTo);
+    if (to.pointsToAll) {
+      return false;
+    }
+    if (from.pointsToAll) {
+      to.pointsToAll = true;
+      return true;
+    }
+    BitSet added = (BitSet) from.pointsTo.clone();
+    added.andNot(to.pointsTo);
+    if (added.isEmpty()) {
+      return false;
+    }
+    to.pointsTo.or(added);
+    return true;
+  }
+
+  private boolean hasSamePointsToSet(int pFirst, int pSecond) {
+    Node first = getNode(pFirst);
+    Node second = getNode(pSecond);
+    return first.pointsToAll == second.pointsToAll && first.pointsTo.equals(second.pointsTo);
+  }
+
+  /**
+   * Find all cycles of copy edges that are reachable from the given node (with Tarjan's algorithm
+   * for strongly connected components) and collapse each of them into a single node.
+   */
+  private void collapseCycles(int pStart) {
+    Map<Integer, Integer> index = new HashMap<>();
+    Map<Integer, Integer> lowLink = new HashMap<>();
+    Deque<Integer> stack = new ArrayDeque<>();
+    Set<Integer> onStack = new HashSet<>();
+    Deque<Pair<Integer, Iterator<Integer>>> callStack = new ArrayDeque<>();
+    List<List<Integer>> components = new ArrayList<>();
+
+    int start = find(pStart);
+    index.put(start, 0);
+    lowLink.put(start, 0);
+    stack.push(start);
+    onStack.add(start);
+    callStack.push(Pair.of(start, ImmutableList.copyOf(getNode(start).successors).iterator()));
+
+    while (!callStack.isEmpty()) {
+      int current = callStack.peek().getFirstNotNull();
+      Iterator<Integer> successors = callStack.peek().getSecondNotNull();
+      if (successors.hasNext()) {
+        int successor = find(successors.next());
+        if (!index.containsKey(successor)) {
+          index.put(successor, index.size());
+          lowLink.put(successor, index.get(successor));
+          stack.push(successor);
+          onStack.add(successor);
+          callStack.push(
+              Pair.of(successor, ImmutableList.copyOf(getNode(successor).successors).iterator()));
+        } else if (onStack.contains(successor)) {
+          lowLink.put(current, Math.min(lowLink.get(current), index.get(successor)));
+        }
+      } else {
+        callStack.pop();
+        if (!callStack.isEmpty()) {
+          int parent = callStack.peek().getFirstNotNull();
+          lowLink.put(parent, Math.min(lowLink.get(parent), lowLink.get(current)));
+        }
+        if (lowLink.get(current).equals(index.get(current))) {
+          List<Integer> component = new ArrayList<>();
+          int member;
+          do {
+            member = stack.pop();
+            onStack.remove(member);
+            component.add(member);
+          } while (member != current);
+          if (component.size() > 1) {
+            components.add(component);
+          }
+        }
+      }
+    }
+
+    for (List<Integer> component : components) {
+      int representative = component.get(0);
+      for (int member : component.subList(1, component.size())) {
+        merge(representative, member);
+      }
+      enqueue(representative);
+    }
+  }
+
+  private void merge(int pRepresentative, int pMember) {
+    Node representative = getNode(pRepresentative);
+    Node member = getNode(pMember);
+    member.representative = pRepresentative;
+    representative.pointsTo.or(member.pointsTo);
+    representative.pointsToAll |= member.pointsToAll;
+    representative.successors.addAll(member.successors);
+    representative.loads.addAll(member.loads);
+    representative.stores.addAll(member.stores);
+    // constraints of the member need to be resolved also for the pointees of the representative
+    representative.handledPointees.and(member.handledPointees);
+    representative.handledPointsToAll &= member.handledPointsToAll;
+    member.successors = null;
+    member.loads = null;
+    member.stores = null;
+    member.handledPointees = null;
+  }
+
+  private void enqueue(int pId) {
+    if (!inWorklist.get(pId)) {
+      inWorklist.set(pId);
+      worklist.add(pId);
+    }
+  }
+
+  private PointerState toPointerState() {
+    PointerState result = PointerState.INITIAL_STATE;
+    for (Map.Entry<MemoryLocation, Integer> entry : locationNodes.entrySet()) {
+      Node node = getNode(find(entry.getValue()));
+      if (node.pointsToAll) {
+        result = result.addPointsToInformation(entry.getKey(), LocationSetTop.INSTANCE);
+      } else if (!node.pointsTo.isEmpty()) {
+        List<MemoryLocation> pointees = new ArrayList<>(node.pointsTo.cardinality());
+        for (int pointee = node.pointsTo.nextSetBit(0);
+            pointee >= 0;
+            pointee = node.pointsTo.nextSetBit(pointee + 1)) {
+          pointees.add(locations.get(pointee));
+        }
+        result = result.addPointsToInformation(entry.getKey(), pointees);
+      }
+    }
+    return result;
+  }
+}
@@ -0,0 +1,83 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.pointer2;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cpa.pointer2.util.ExplicitLocationSet;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+
+public class AndersenPointerAnalysisTest {
+
+  private CFA cfa;
+
+  @Before
+  public void setUp() throws Exception {
+    cfa =
+        TestDataTools.makeCFA(
+            "int main() {",
+            "  int a;",
+            "  int b;",
+            "  int *p = &a;",
+            "  int *q;",
+            "  int *x;",
+            "  int *y;",
+            "  q = p;",
+            "  x = q;",
+            "  y = x;",
+            "  x = y;",
+            "  int **r = &q;",
+            "  *r = &b;",
+            "  int *s = *r;",
+            "  return 0;",
+            "}");
+  }
+
+  private static MemoryLocation location(String pName) {
+    return MemoryLocation.valueOf("main::" + pName);
+  }
+
+  private static void assertPointsTo(PointerState pState, String pPointer, String... pPointees) {
+    ImmutableList.Builder<MemoryLocation> pointees = ImmutableList.builder();
+    for (String pointee : pPointees) {
+      pointees.add(location(pointee));
+    }
+    assertThat(pState.getPointsToSet(location(pPointer)))
+        .isEqualTo(ExplicitLocationSet.from(pointees.build()));
+  }
+
+  @Test
+  public void testCopyLoadAndStore() throws Exception {
+    PointerState state =
+        AndersenPointerAnalysis.computePointsToInformation(
+            cfa, true, ShutdownNotifier.createDummy());
+
+    assertPointsTo(state, "p", "a");
+    assertPointsTo(state, "r", "q");
+    // the store through r adds b to q, which flows into everything assigned from q
+    assertPointsTo(state, "q", "a", "b");
+    assertPointsTo(state, "s", "a", "b");
+  }
+
+  @Test
+  public void testCycle() throws Exception {
+    PointerState state =
+        AndersenPointerAnalysis.computePointsToInformation(
+            cfa, true, ShutdownNotifier.createDummy());
+
+    assertPointsTo(state, "x", "a", "b");
+    assertPointsTo(state, "y", "a", "b");
+  }
+}
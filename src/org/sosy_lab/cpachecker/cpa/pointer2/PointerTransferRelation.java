@@ -287,7 +287,7 @@ public class PointerTransferRelation extends SingleEdgeTransferRelation {
     return handleAssignment(pState, returnVariable.orElseThrow(), pCfaEdge.getExpression().get());
   }
 
-  private Optional<MemoryLocation> getFunctionReturnVariable(FunctionEntryNode pFunctionEntryNode) {
+  static Optional<MemoryLocation> getFunctionReturnVariable(FunctionEntryNode pFunctionEntryNode) {
     com.google.common.base.Optional<? extends AVariableDeclaration> returnVariable =
         pFunctionEntryNode.getReturnVariable();
     if (!returnVariable.isPresent()) {
@@ -323,11 +323,11 @@ public class PointerTransferRelation extends SingleEdgeTransferRelation {
     return newState;
   }
 
-  private MemoryLocation toLocation(AbstractSimpleDeclaration pDeclaration) {
+  static MemoryLocation toLocation(AbstractSimpleDeclaration pDeclaration) {
     return toLocation(pDeclaration.getType(), pDeclaration.getQualifiedName());
   }
 
-  private MemoryLocation toLocation(
+  static MemoryLocation toLocation(
       CCompositeType pParent, CCompositeTypeMemberDeclaration pMemberDecl) {
     CType memberType = pMemberDecl.getType().getCanonicalType();
     if (memberType instanceof CCompositeType) {
@@ -336,7 +336,7 @@ public class PointerTransferRelation extends SingleEdgeTransferRelation {
     return fieldReferenceToMemoryLocation(pParent, false, pMemberDecl.getName());
   }
 
-  private MemoryLocation toLocation(Type pType, String name) {
+  static MemoryLocation toLocation(Type pType, String name) {
     Type type = pType;
     if (type instanceof CType) {
       type = ((CType) type).getCanonicalType();
@@ -347,7 +347,7 @@ public class PointerTransferRelation extends SingleEdgeTransferRelation {
     return MemoryLocation.valueOf(name);
   }
 
-  private static boolean isStructOrUnion(Type pType) {
+  static boolean isStructOrUnion(Type pType) {
     Type type = pType instanceof CType ? ((CType) pType).getCanonicalType() : pType;
     if (type instanceof CComplexType) {
       return EnumSet.of(ComplexTypeKind.STRUCT, ComplexTypeKind.UNION)
@@ -381,7 +381,7 @@ public class PointerTransferRelation extends SingleEdgeTransferRelation {
     return pState;
   }
 
-  private boolean isNondetPointerReturn(CExpression pFunctionNameExpression) {
+  static boolean isNondetPointerReturn(CExpression pFunctionNameExpression) {
     if (pFunctionNameExpression instanceof CIdExpression) {
       String functionName = ((CIdExpression) pFunctionNameExpression).getName();
       return functionName.equals("__VERIFIER_nondet_pointer");
@@ -511,7 +511,7 @@ public class PointerTransferRelation extends SingleEdgeTransferRelation {
         pFieldReference.getFieldName());
   }
 
-  private static MemoryLocation fieldReferenceToMemoryLocation(
+  static MemoryLocation fieldReferenceToMemoryLocation(
       CType pFieldOwnerType, boolean pIsPointerDeref, String pFieldName) {
     CType type = pFieldOwnerType.getCanonicalType();
     final String prefix;
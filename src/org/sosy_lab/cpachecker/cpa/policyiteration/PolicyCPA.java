@@ -106,7 +106,7 @@ public class PolicyCPA extends SingleEdgeTransferRelation
         fmgr, pConfig, pLogger, shutdownNotifier, cfa,
         AnalysisDirection.FORWARD);
     if (useCachingPathFormulaManager) {
-      pathFormulaManager = new CachingPathFormulaManager(pathFormulaManager);
+      pathFormulaManager = new CachingPathFormulaManager(pathFormulaManager, pConfig);
     }
     pfmgr = pathFormulaManager;
 
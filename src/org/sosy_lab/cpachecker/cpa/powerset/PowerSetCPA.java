@@ -9,6 +9,10 @@
 package org.sosy_lab.cpachecker.cpa.powerset;
 
 import java.util.Collections;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.defaults.AbstractSingleWrapperCPA;
 import org.sosy_lab.cpachecker.core.defaults.AutomaticCPAFactory;
@@ -25,8 +29,18 @@ import org.sosy_lab.cpachecker.core.interfaces.StateSpacePartition;
 import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
 
+@Options(prefix = "cpa.powerset")
 public class PowerSetCPA extends AbstractSingleWrapperCPA {
 
+  @Option(
+      secure = true,
+      description =
+          "When checking whether a wrapped state is covered by a set, only compare it with the"
+              + " members of the set at the same locations. This is only sound if the wrapped"
+              + " analysis never covers states at other locations, e.g., if it includes the"
+              + " LocationCPA.")
+  private boolean partitionByLocation = false;
+
   public static CPAFactory factory() {
     return AutomaticCPAFactory.forType(PowerSetCPA.class);
   }
@@ -34,9 +48,11 @@ public class PowerSetCPA extends AbstractSingleWrapperCPA {
   private final PowerSetDomain domain;
   // TODO: domain depends on current initial precision. This might be wrong!
 
-  public PowerSetCPA(final ConfigurableProgramAnalysis pCpa) {
+  public PowerSetCPA(final ConfigurableProgramAnalysis pCpa, final Configuration pConfig)
+      throws InvalidConfigurationException {
     super(pCpa);
-    domain = new PowerSetDomain(pCpa.getStopOperator());
+    pConfig.inject(this);
+    domain = new PowerSetDomain(pCpa.getStopOperator(), partitionByLocation);
   }
 
   @Override
@@ -18,13 +18,25 @@ import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 
+/**
+ * Domain of sets of wrapped states. A wrapped state is covered by a set if it is contained in the
+ * set (checked by hashing) or if the wrapped stop operator says so. Results of the stop operator
+ * are cached in the covering set. Optionally, the stop operator is only asked about the members
+ * of the covering set at the same locations as the covered state.
+ */
 public class PowerSetDomain implements AbstractDomain {
 
   private final StopOperator stop;
+  private final boolean partitionByLocation;
   private Precision prec;
 
   public PowerSetDomain(final StopOperator pStop) {
+    this(pStop, false);
+  }
+
+  public PowerSetDomain(final StopOperator pStop, final boolean pPartitionByLocation) {
     stop = pStop;
+    partitionByLocation = pPartitionByLocation;
   }
 
   @Override
@@ -34,6 +46,9 @@ public class PowerSetDomain implements AbstractDomain {
 
     PowerSetState state1 = (PowerSetState) pState1;
     PowerSetState state2 = (PowerSetState) pState2;
+    if (state2.containsAll(state1)) {
+      return pState2;
+    }
 
     Collection<AbstractState> coverSet = state2.getWrappedStates();
 
@@ -42,7 +57,7 @@ public class PowerSetDomain implements AbstractDomain {
 
     for (AbstractState state : state1.getWrappedStates()) {
 
-      if (!coverSet.contains(state) && !stop.stop(state, coverSet, prec)) {
+      if (!isCovered(state, state2)) {
         stateSet.add(state);
       }
 
@@ -68,12 +83,14 @@ public class PowerSetDomain implements AbstractDomain {
   }
 
   private boolean isCoverage(final PowerSetState pCovered, final PowerSetState pCovering) {
+    if (pCovering.containsAll(pCovered)) {
+      return true;
+    }
     if (prec == null) { return false; }
-    Collection<AbstractState> coverSet = pCovering.getWrappedStates();
     try {
       for (AbstractState state : pCovered.getWrappedStates()) {
 
-        if (!coverSet.contains(state) && !stop.stop(state, coverSet, prec)) {
+        if (!isCovered(state, pCovering)) {
           return false;
         }
       }
@@ -83,6 +100,22 @@ public class PowerSetDomain implements AbstractDomain {
     return true;
   }
 
+  private boolean isCovered(final AbstractState pState, final PowerSetState pCovering)
+      throws CPAException, InterruptedException {
+    if (pCovering.isKnownToCover(pState)) {
+      return true;
+    }
+    Collection<AbstractState> coverSet =
+        partitionByLocation
+            ? pCovering.getStatesAtLocations(PowerSetState.getLocations(pState))
+            : pCovering.getWrappedStates();
+    if (stop.stop(pState, coverSet, prec)) {
+      pCovering.addCoveredState(pState);
+      return true;
+    }
+    return false;
+  }
+
   public void setPrecision(final Precision pPrec) {
     prec = pPrec;
   }
@@ -0,0 +1,89 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.powerset;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableSet;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.core.defaults.SingletonPrecision;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+
+public class PowerSetDomainTest {
+
+  private static final class NamedState implements AbstractState {
+    private final String name;
+
+    private NamedState(String pName) {
+      name = pName;
+    }
+
+    @Override
+    public boolean equals(Object pObj) {
+      return pObj instanceof NamedState && name.equals(((NamedState) pObj).name);
+    }
+
+    @Override
+    public int hashCode() {
+      return name.hashCode();
+    }
+
+    @Override
+    public String toString() {
+      return name;
+    }
+  }
+
+  private int stopCalls;
+  private PowerSetDomain domain;
+
+  @Before
+  public void setUp() {
+    stopCalls = 0;
+    // every state is covered by any non-empty set
+    domain =
+        new PowerSetDomain(
+            (state, reached, precision) -> {
+              stopCalls++;
+              return !reached.isEmpty();
+            });
+    domain.setPrecision(SingletonPrecision.getInstance());
+  }
+
+  private static PowerSetState powerSet(String... pNames) {
+    ImmutableSet.Builder<AbstractState> states = ImmutableSet.builder();
+    for (String name : pNames) {
+      states.add(new NamedState(name));
+    }
+    return new PowerSetState(states.build());
+  }
+
+  @Test
+  public void testSubsetNeedsNoStopOperator() throws Exception {
+    PowerSetState subset = powerSet("a", "b");
+    PowerSetState superset = powerSet("a", "b", "c");
+
+    assertThat(domain.join(subset, superset)).isSameInstanceAs(superset);
+    assertThat(domain.isLessOrEqual(subset, superset)).isTrue();
+    assertThat(stopCalls).isEqualTo(0);
+  }
+
+  @Test
+  public void testCoverageIsCached() throws Exception {
+    PowerSetState covered = powerSet("a", "d");
+    PowerSetState covering = powerSet("a", "b");
+
+    assertThat(domain.isLessOrEqual(covered, covering)).isTrue();
+    assertThat(stopCalls).isEqualTo(1);
+    assertThat(domain.isLessOrEqual(covered, covering)).isTrue();
+    assertThat(domain.join(covered, covering)).isSameInstanceAs(covering);
+    assertThat(stopCalls).isEqualTo(1);
+  }
+}
@@ -10,10 +10,14 @@ package org.sosy_lab.cpachecker.cpa.powerset;
 
 import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.ImmutableSetMultimap;
 import com.google.common.collect.Iterables;
+import java.util.HashSet;
 import java.util.Objects;
 import java.util.Set;
 import org.checkerframework.checker.nullness.qual.NonNull;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractWrapperState;
 import org.sosy_lab.cpachecker.core.interfaces.Property;
@@ -27,21 +31,69 @@ public class PowerSetState implements AbstractWrapperState, Targetable {
 
   private final ImmutableSet<AbstractState> setOfStates;
 
+  /**
+   * States that are not contained in this set, but are known to be covered by it. This is only a
+   * cache for coverage checks and not part of the abstract state.
+   */
+  private final transient Set<AbstractState> coveredStates;
+
+  /** The wrapped states grouped by their locations, computed lazily. */
+  private transient @Nullable ImmutableSetMultimap<ImmutableSet<CFANode>, AbstractState>
+      statesByLocations = null;
+
   public PowerSetState(final Set<AbstractState> states) {
     merged1 = merged2 = null;
     setOfStates = ImmutableSet.copyOf(states);
+    coveredStates = new HashSet<>();
   }
 
   public PowerSetState(final Set<AbstractState> states, final PowerSetState state1, final PowerSetState state2) {
     merged1 = state1;
     merged2 = state2;
     setOfStates = ImmutableSet.copyOf(states);
+    // the merged set includes all states of state2, so it covers everything state2 covers
+    coveredStates = new HashSet<>(state2.coveredStates);
   }
 
   public boolean isMergedInto(final PowerSetState pState) {
     return pState == merged1 || pState == merged2;
   }
 
+  /**
+   * Check whether the given state is contained in this set or is already known to be covered by
+   * it, without calling the stop operator.
+   */
+  boolean isKnownToCover(final AbstractState pState) {
+    return setOfStates.contains(pState) || coveredStates.contains(pState);
+  }
+
+  void addCoveredState(final AbstractState pState) {
+    coveredStates.add(pState);
+  }
+
+  /** Check with hash lookups whether all states of the given set are contained in this set. */
+  boolean containsAll(final PowerSetState pOther) {
+    return pOther.setOfStates.size() <= setOfStates.size()
+        && setOfStates.containsAll(pOther.setOfStates);
+  }
+
+  /** Return the wrapped states that are at exactly the given locations. */
+  ImmutableSet<AbstractState> getStatesAtLocations(final ImmutableSet<CFANode> pLocations) {
+    if (statesByLocations == null) {
+      ImmutableSetMultimap.Builder<ImmutableSet<CFANode>, AbstractState> builder =
+          ImmutableSetMultimap.builder();
+      for (AbstractState state : setOfStates) {
+        builder.put(getLocations(state), state);
+      }
+      statesByLocations = builder.build();
+    }
+    return statesByLocations.get(pLocations);
+  }
+
+  static ImmutableSet<CFANode> getLocations(final AbstractState pState) {
+    return ImmutableSet.copyOf(AbstractStates.extractLocations(pState));
+  }
+
   @Override
   public int hashCode() {
     return Objects.hash(setOfStates);
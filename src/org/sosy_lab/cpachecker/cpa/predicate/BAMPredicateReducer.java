@@ -11,6 +11,8 @@ package org.sosy_lab.cpachecker.cpa.predicate;
 import static org.sosy_lab.cpachecker.util.predicates.pathformula.ctoformula.CtoFormulaConverter.PARAM_VARIABLE_NAME;
 
 import com.google.common.base.Preconditions;
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
 import com.google.common.collect.ImmutableSetMultimap;
 import com.google.common.collect.Sets;
 import java.util.Collection;
@@ -64,6 +66,18 @@ public class BAMPredicateReducer
 
   private final Map<BooleanFormula, Set<String>> variableCache = new HashMap<>();
 
+  /** whether a predicate references any variable of a block (or an addressed variable) */
+  private final Map<Pair<Block, AbstractionPredicate>, Boolean> directRelevanceCache =
+      new HashMap<>();
+
+  /**
+   * Results of {@link #splitAbstractionForReduction(Region, Block)}. The same abstraction is split
+   * at the block entry (for reduction) and again at the block exit (for expansion), and the same
+   * abstractions often enter a block several times.
+   */
+  private final Cache<Pair<Region, Block>, Pair<Region, Region>> splitCache =
+      CacheBuilder.newBuilder().maximumSize(10000).build();
+
   /** A meaning of the following options is a number of problems in BAM:
    *  sometimes it is more efficient not to reduce precision, than to have a
    *  RepeatedCounterexampleException.
@@ -125,6 +139,17 @@ public class BAMPredicateReducer
    */
   private Pair<Region, Region> splitAbstractionForReduction(Region abstraction, final Block context)
       throws InterruptedException {
+    final Pair<Region, Block> key = Pair.of(abstraction, context);
+    Pair<Region, Region> result = splitCache.getIfPresent(key);
+    if (result == null) {
+      result = splitAbstractionForReduction0(abstraction, context);
+      splitCache.put(key, result);
+    }
+    return result;
+  }
+
+  private Pair<Region, Region> splitAbstractionForReduction0(Region abstraction, Block context)
+      throws InterruptedException {
 
     final Set<AbstractionPredicate> predicates = pamgr.extractPredicates(abstraction);
     final Set<AbstractionPredicate> irrelevantPredicates =
@@ -175,7 +200,7 @@ public class BAMPredicateReducer
     // get predicates that are directly relevant
     for (AbstractionPredicate predicate : predicates) {
       Set<String> variables = getVariables(predicate);
-      if (isAnyVariableRelevant(pContext.getVariables(), variables)) {
+      if (isDirectlyRelevant(pContext, predicate, variables)) {
         relevantPredicates.add(predicate);
         relevantVariables.addAll(variables);
       } else {
@@ -205,6 +230,13 @@ public class BAMPredicateReducer
     return relevantPredicates;
   }
 
+  private boolean isDirectlyRelevant(
+      Block pContext, AbstractionPredicate pPredicate, Set<String> pVariables) {
+    return directRelevanceCache.computeIfAbsent(
+        Pair.of(pContext, pPredicate),
+        k -> isAnyVariableRelevant(pContext.getVariables(), pVariables));
+  }
+
   private Set<String> getVariables(AbstractionPredicate predicate) {
     BooleanFormula atom = predicate.getSymbolicAtom();
     Set<String> variables = variableCache.get(atom);
@@ -0,0 +1,300 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.predicate;
+
+import com.google.common.base.Throwables;
+import com.google.common.collect.ImmutableList;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Optional;
+import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.stream.IntStream;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.Classes.UnexpectedCheckedException;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.Timer;
+import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool.PooledSolver;
+import org.sosy_lab.java_smt.api.BasicProverEnvironment.AllSatCallback;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.ProverEnvironment;
+import org.sosy_lab.java_smt.api.SolverContext.ProverOptions;
+import org.sosy_lab.java_smt.api.SolverException;
+
+/**
+ * Parallel model enumeration for Boolean predicate abstraction.
+ *
+ * <p>The space of predicate assignments is split into cubes over a few predicates, and the models
+ * within each cube are enumerated independently by separate solver instances. The models are
+ * returned as truth-value arrays, such that the region can be built by the caller in the main
+ * solver context without translating formulas back.
+ *
+ * <p>Each worker has its own solver instance from a {@link SolverPool}, and all formulas are
+ * translated into the worker contexts by the calling thread before the workers are started. The
+ * pool caches the translations, which helps because the same predicates occur in many
+ * abstractions.
+ */
+@Options(prefix = "cpa.predicate.abs.parallel")
+final class ParallelBooleanAbstraction implements AutoCloseable {
+
+  static final byte TRUE = 1;
+  static final byte FALSE = -1;
+  static final byte UNSPECIFIED = 0;
+
+  @Option(
+      secure = true,
+      description =
+          "number of solver instances to use for Boolean abstraction in parallel"
+              + " (1 disables parallel abstraction)")
+  @IntegerOption(min = 1)
+  private int threads = 1;
+
+  @Option(
+      secure = true,
+      description =
+          "number of predicates over which the predicate space is split into cubes"
+              + " for parallel Boolean abstraction (creates 2^n cubes)")
+  @IntegerOption(min = 1, max = 16)
+  private int splitPredicates = 3;
+
+  @Option(
+      secure = true,
+      description =
+          "minimal number of predicates for which parallel Boolean abstraction is used,"
+              + " abstractions with less predicates are computed sequentially")
+  @IntegerOption(min = 1)
+  private int minPredicates = 20;
+
+  private final FormulaManagerView fmgr;
+  private final SolverPool workers;
+  private final List<Timer> workerTimes;
+  private final @Nullable ExecutorService executor;
+
+  ParallelBooleanAbstraction(
+      Configuration pConfig,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier,
+      FormulaManagerView pFmgr,
+      PredicateAbstractionStatistics pStats)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    fmgr = pFmgr;
+
+    if (threads > 1) {
+      workers = new SolverPool(pConfig, pLogger, pShutdownNotifier, fmgr, threads);
+      ImmutableList.Builder<Timer> timers = ImmutableList.builderWithExpectedSize(threads);
+      for (int i = 0; i < threads; i++) {
+        timers.add(new Timer());
+      }
+      workerTimes = timers.build();
+      pStats.booleanAbstractionWorkerTimes.addAll(workerTimes);
+      executor =
+          Executors.newFixedThreadPool(
+              threads,
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("boolean-abstraction-%d")
+                  .build());
+    } else {
+      workers = new SolverPool(pConfig, pLogger, pShutdownNotifier, fmgr, 0);
+      workerTimes = ImmutableList.of();
+      executor = null;
+    }
+  }
+
+  /** Check whether an abstraction with the given number of predicates should be parallelized. */
+  boolean isApplicable(int pNumberOfPredicates) {
+    return workers.size() > 0
+        && pNumberOfPredicates >= minPredicates
+        && pNumberOfPredicates > splitPredicates;
+  }
+
+  /**
+   * Enumerate all assignments of the given predicate variables that are consistent with the given
+   * formula and the predicate definitions.
+   *
+   * @param pFormula The (instantiated) formula to abstract.
+   * @param pPredicateVars The propositional variables of the predicates.
+   * @param pPredicateDefs The (instantiated) definitions of the predicates, in the same order.
+   * @return A list of models, each one an array with the values {@link #TRUE}, {@link #FALSE}, or
+   *     {@link #UNSPECIFIED} for each predicate (in the given order).
+   */
+  List<byte[]> enumerateModels(
+      BooleanFormula pFormula,
+      List<BooleanFormula> pPredicateVars,
+      List<BooleanFormula> pPredicateDefs)
+      throws SolverException, InterruptedException {
+    int numPredicates = pPredicateVars.size();
+    List<Integer> splitIndices = selectSplitPredicates(pFormula, pPredicateDefs);
+    int numCubes = 1 << splitIndices.size();
+
+    List<Future<List<byte[]>>> results = new ArrayList<>(workers.size());
+    List<PooledSolver> acquired = new ArrayList<>(workers.size());
+    try {
+      // there may be less cubes than workers
+      int numWorkers = Math.min(workers.size(), numCubes);
+      for (int w = 0; w < numWorkers; w++) {
+        PooledSolver pooled = workers.acquire();
+        acquired.add(pooled);
+        FormulaManagerView wfmgr = pooled.getFormulaManager();
+        BooleanFormulaManagerView wbfmgr = wfmgr.getBooleanFormulaManager();
+
+        // translate on this thread, the main solver context must not be used by the workers
+        BooleanFormula formula = pooled.translateFromMain(pFormula);
+        List<BooleanFormula> vars = new ArrayList<>(numPredicates);
+        List<BooleanFormula> defs = new ArrayList<>(numPredicates);
+        for (int i = 0; i < numPredicates; i++) {
+          BooleanFormula var = pooled.translateFromMain(pPredicateVars.get(i));
+          vars.add(var);
+          defs.add(wbfmgr.equivalence(var, pooled.translateFromMain(pPredicateDefs.get(i))));
+        }
+        List<BooleanFormula> cubes = new ArrayList<>();
+        for (int cube = w; cube < numCubes; cube += numWorkers) {
+          List<BooleanFormula> literals = new ArrayList<>(splitIndices.size());
+          for (int bit = 0; bit < splitIndices.size(); bit++) {
+            BooleanFormula var = vars.get(splitIndices.get(bit));
+            literals.add((cube & (1 << bit)) != 0 ? var : wbfmgr.not(var));
+          }
+          cubes.add(wbfmgr.and(literals));
+        }
+
+        Solver worker = pooled.getSolver();
+        Timer workerTime = workerTimes.get(w);
+        BooleanFormula predDef = wbfmgr.and(defs);
+        results.add(
+            executor.submit(
+                () -> enumerateCubes(worker, workerTime, formula, predDef, vars, cubes)));
+      }
+
+      List<byte[]> models = new ArrayList<>();
+      for (Future<List<byte[]>> result : results) {
+        models.addAll(result.get());
+      }
+      return models;
+
+    } catch (ExecutionException e) {
+      Throwable t = e.getCause();
+      Throwables.propagateIfPossible(t, SolverException.class, InterruptedException.class);
+      throw new UnexpectedCheckedException("parallel boolean abstraction", t);
+    } finally {
+      for (Future<?> result : results) {
+        result.cancel(true);
+      }
+      for (PooledSolver pooled : acquired) {
+        pooled.close();
+      }
+    }
+  }
+
+  /**
+   * Select the predicates over which the cubes are built: those predicates that share the most
+   * variables with the formula, as these are most likely to split the models evenly.
+   */
+  private List<Integer> selectSplitPredicates(
+      BooleanFormula pFormula, List<BooleanFormula> pPredicateDefs) {
+    Set<String> formulaVars = fmgr.extractVariableNames(pFormula);
+    int[] relevance = new int[pPredicateDefs.size()];
+    for (int i = 0; i < pPredicateDefs.size(); i++) {
+      for (String var : fmgr.extractVariableNames(pPredicateDefs.get(i))) {
+        if (formulaVars.contains(var)) {
+          relevance[i]++;
+        }
+      }
+    }
+    return IntStream.range(0, pPredicateDefs.size())
+        .boxed()
+        .sorted(Comparator.comparingInt((Integer i) -> relevance[i]).reversed())
+        .limit(splitPredicates)
+        .collect(ImmutableList.toImmutableList());
+  }
+
+  static List<byte[]> enumerateCubes(
+      Solver pWorker,
+      Timer pWorkerTime,
+      BooleanFormula pFormula,
+      BooleanFormula pPredDef,
+      List<BooleanFormula> pVars,
+      List<BooleanFormula> pCubes)
+      throws SolverException, InterruptedException {
+    FormulaManagerView wfmgr = pWorker.getFormulaManager();
+    Map<BooleanFormula, Integer> indices = new HashMap<>();
+    for (int i = 0; i < pVars.size(); i++) {
+      indices.put(pVars.get(i), i);
+    }
+    ModelCollector collector = new ModelCollector(wfmgr, indices);
+
+    pWorkerTime.start();
+    try (ProverEnvironment prover =
+        pWorker.newProverEnvironment(ProverOptions.GENERATE_ALL_SAT)) {
+      prover.push(pFormula);
+      prover.push(pPredDef);
+      for (BooleanFormula cube : pCubes) {
+        prover.push(cube);
+        prover.allSat(collector, pVars);
+        prover.pop();
+      }
+    } finally {
+      pWorkerTime.stop();
+    }
+    return collector.models;
+  }
+
+  private static class ModelCollector implements AllSatCallback<List<byte[]>> {
+
+    private final FormulaManagerView wfmgr;
+    private final Map<BooleanFormula, Integer> indices;
+    private final List<byte[]> models = new ArrayList<>();
+
+    private ModelCollector(FormulaManagerView pFmgr, Map<BooleanFormula, Integer> pIndices) {
+      wfmgr = pFmgr;
+      indices = pIndices;
+    }
+
+    @Override
+    public void apply(List<BooleanFormula> pModel) {
+      byte[] model = new byte[indices.size()];
+      for (BooleanFormula literal : pModel) {
+        Optional<BooleanFormula> inner = wfmgr.stripNegation(literal);
+        int index = indices.get(inner.orElse(literal));
+        model[index] = inner.isPresent() ? FALSE : TRUE;
+      }
+      models.add(model);
+    }
+
+    @Override
+    public List<byte[]> getResult() {
+      return models;
+    }
+  }
+
+  @Override
+  public void close() {
+    if (executor != null) {
+      executor.shutdownNow();
+    }
+    workers.close();
+  }
+}
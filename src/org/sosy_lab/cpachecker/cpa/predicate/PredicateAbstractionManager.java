@@ -48,6 +48,7 @@ import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.algorithm.invariants.InvariantSupplier;
 import org.sosy_lab.cpachecker.core.algorithm.invariants.InvariantSupplier.TrivialInvariantSupplier;
 import org.sosy_lab.cpachecker.cpa.callstack.CallstackStateEqualsWrapper;
+import org.sosy_lab.cpachecker.cpa.predicate.persistence.PersistentAbstractionCache;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicateAbstractionsStorage;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicateAbstractionsStorage.AbstractionNode;
 import org.sosy_lab.cpachecker.util.Pair;
@@ -66,7 +67,9 @@ import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
 import org.sosy_lab.cpachecker.util.predicates.weakening.InductiveWeakeningManager;
 import org.sosy_lab.cpachecker.util.predicates.weakening.WeakeningOptions;
+import org.sosy_lab.cpachecker.util.resources.MemoryPressureMonitor;
 import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer.TimerWrapper;
+import org.sosy_lab.cpachecker.util.statistics.TraceEvents.PredicateAbstractionEvent;
 import org.sosy_lab.java_smt.api.BasicProverEnvironment.AllSatCallback;
 import org.sosy_lab.java_smt.api.BooleanFormula;
 import org.sosy_lab.java_smt.api.ProverEnvironment;
@@ -88,6 +91,8 @@ public class PredicateAbstractionManager {
   private final InvariantSupplier invariantSupplier;
   private final @Nullable InductiveWeakeningManager weakeningManager;
   private final ShutdownNotifier shutdownNotifier;
+  private final @Nullable ParallelBooleanAbstraction parallelBooleanAbstraction;
+  private final @Nullable SpeculativeAbstraction speculativeAbstraction;
 
   private static final Set<Integer> noAbstractionReuse = ImmutableSet.of();
 
@@ -114,6 +119,9 @@ public class PredicateAbstractionManager {
   // 1: predicate is true
   private final Map<Pair<BooleanFormula, AbstractionPredicate>, Byte> cartesianAbstractionCache;
 
+  // cache for abstractions that is shared between runs, null if disabled
+  private final @Nullable PersistentAbstractionCache persistentCache;
+
   // Statistics
   private final TimerWrapper trivialPredicatesTimer;
   private final TimerWrapper quantifierEliminationTimer;
@@ -136,6 +144,34 @@ public class PredicateAbstractionManager {
       ShutdownNotifier pShutdownNotifier,
       PredicateAbstractionStatistics pAbstractionStats,
       InvariantSupplier pInvariantsSupplier) {
+    this(
+        pAmgr,
+        pPfmgr,
+        pSolver,
+        pOptions,
+        weakeningOptions,
+        pAbstractionStorage,
+        pLogger,
+        pShutdownNotifier,
+        pAbstractionStats,
+        pInvariantsSupplier,
+        null,
+        null);
+  }
+
+  PredicateAbstractionManager(
+      AbstractionManager pAmgr,
+      PathFormulaManager pPfmgr,
+      Solver pSolver,
+      PredicateAbstractionManagerOptions pOptions,
+      WeakeningOptions weakeningOptions,
+      PredicateAbstractionsStorage pAbstractionStorage,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier,
+      PredicateAbstractionStatistics pAbstractionStats,
+      InvariantSupplier pInvariantsSupplier,
+      @Nullable ParallelBooleanAbstraction pParallelBooleanAbstraction,
+      @Nullable SpeculativeAbstraction pSpeculativeAbstraction) {
     shutdownNotifier = pShutdownNotifier;
 
     options = pOptions;
@@ -148,6 +184,11 @@ public class PredicateAbstractionManager {
     solver = pSolver;
     invariantSupplier = pInvariantsSupplier;
     stats = pAbstractionStats;
+    parallelBooleanAbstraction = pParallelBooleanAbstraction;
+    speculativeAbstraction =
+        pSpeculativeAbstraction != null && pSpeculativeAbstraction.isEnabled()
+            ? pSpeculativeAbstraction
+            : null;
 
     if (options.isCartesianAbstraction()) {
       options.setAbstractionType(AbstractionType.CARTESIAN);
@@ -165,6 +206,11 @@ public class PredicateAbstractionManager {
     if (options.isUseCache()) {
       abstractionCache = new HashMap<>();
       unsatisfiabilityCache = new HashSet<>();
+      MemoryPressureMonitor.registerCache(
+          this,
+          "predicate abstractions",
+          MemoryPressureMonitor.Priority.LAST,
+          PredicateAbstractionManager::clear);
     } else {
       abstractionCache = null;
       unsatisfiabilityCache = null;
@@ -176,6 +222,8 @@ public class PredicateAbstractionManager {
       cartesianAbstractionCache = null;
     }
 
+    persistentCache = createPersistentCache(pSolver);
+
     abstractionStorage = pAbstractionStorage;
 
     trivialPredicatesTimer = stats.trivialPredicatesTime.getNewTimer();
@@ -189,6 +237,29 @@ public class PredicateAbstractionManager {
     abstractionBddConstructionTimer = stats.abstractionBddConstructionTime.getNewTimer();
   }
 
+  private @Nullable PersistentAbstractionCache createPersistentCache(Solver pSolver) {
+    Path directory = options.getPersistentCacheDirectory();
+    if (directory == null) {
+      return null;
+    }
+    // everything that influences the result for a given formula and set of predicates
+    String solverIdentifier =
+        Joiner.on(' ')
+            .join(
+                pSolver.getVersion(),
+                options.getAbstractionType(),
+                options.isIdentifyTrivialPredicates(),
+                options.isSimplifyAbstractionFormula(),
+                invariantSupplier != TrivialInvariantSupplier.INSTANCE);
+    try {
+      return new PersistentAbstractionCache(directory, solverIdentifier, fmgr, logger);
+    } catch (IOException e) {
+      logger.logUserException(
+          Level.WARNING, e, "Could not create persistent abstraction cache, disabling it");
+      return null;
+    }
+  }
+
   /**
    * Compute an abstraction of a single boolean formula.
    * @param f The formula to be abstracted. Needs to be instantiated
@@ -255,6 +326,74 @@ public class PredicateAbstractionManager {
 
     int currentAbstractionId = stats.numCallsAbstraction.getAndIncrement();
 
+    PredicateAbstractionEvent event =
+        new PredicateAbstractionEvent(
+            currentAbstractionId, pPredicates.size(), pathFormula.getLength());
+    event.begin();
+    try {
+      return buildAbstraction(
+          currentAbstractionId,
+          locations,
+          callstackInformation,
+          abstractionFormula,
+          pathFormula,
+          pPredicates);
+    } finally {
+      event.commit();
+    }
+  }
+
+  boolean isSpeculativeAbstractionEnabled() {
+    return speculativeAbstraction != null;
+  }
+
+  /**
+   * Start computing the Boolean abstraction that {@link #buildAbstraction(Collection, Optional,
+   * AbstractionFormula, PathFormula, Collection)} will need for the given inputs in the background,
+   * if speculative abstraction is enabled (cf. {@link SpeculativeAbstraction}). The result is used
+   * automatically if the later abstraction computation matches.
+   */
+  void speculateAbstraction(
+      final AbstractionFormula abstractionFormula,
+      final PathFormula pathFormula,
+      final Collection<AbstractionPredicate> pPredicates) {
+    if (speculativeAbstraction == null
+        || pPredicates.isEmpty()
+        || options.getAbstractionType() != AbstractionType.BOOLEAN
+        || options.getReuseAbstractionsFrom() != null) {
+      return;
+    }
+
+    // this needs to compute the same formula as buildAbstraction
+    final BooleanFormula absFormula = abstractionFormula.asInstantiatedFormula();
+    final BooleanFormula symbFormula = getFormulaFromPathFormula(pathFormula);
+    BooleanFormula primaryFormula = bfmgr.and(absFormula, symbFormula);
+    final SSAMap ssa = pathFormula.getSsa();
+    final Function<BooleanFormula, BooleanFormula> instantiator =
+        pred -> fmgr.instantiate(pred, ssa);
+
+    final Collection<AbstractionPredicate> relevantPredicates =
+        getRelevantPredicates(pPredicates, primaryFormula, instantiator);
+    if (fmgr.useBitwiseAxioms()) {
+      for (AbstractionPredicate predicate : relevantPredicates) {
+        primaryFormula =
+            pfmgr.addBitwiseAxiomsIfNeeded(primaryFormula, predicate.getSymbolicAtom());
+      }
+    }
+
+    speculativeAbstraction.submit(
+        primaryFormula, new ArrayList<>(relevantPredicates), instantiator);
+  }
+
+  private AbstractionFormula buildAbstraction(
+      final int currentAbstractionId,
+      final Collection<CFANode> locations,
+      Optional<CallstackStateEqualsWrapper> callstackInformation,
+      final AbstractionFormula abstractionFormula,
+      final PathFormula pathFormula,
+      final Collection<AbstractionPredicate> pPredicates)
+      throws SolverException, InterruptedException {
+
     logger.log(
         Level.FINEST,
         "Computing abstraction",
@@ -298,6 +437,9 @@ public class PredicateAbstractionManager {
     // and should remove those from this set afterwards.
     final Collection<AbstractionPredicate> remainingPredicates =
         getRelevantPredicates(pPredicates, primaryFormula, instantiator);
+    stats.numTotalPredicates.addAndGet(pPredicates.size());
+    stats.maxPredicates.accumulateAndGet(pPredicates.size(), Math::max);
+    stats.numIrrelevantPredicates.addAndGet(pPredicates.size() - remainingPredicates.size());
 
     if (fmgr.useBitwiseAxioms()) {
       for (AbstractionPredicate predicate : remainingPredicates) {
@@ -309,10 +451,13 @@ public class PredicateAbstractionManager {
 
     // caching
     Pair<BooleanFormula, ImmutableSet<BooleanFormula>> absKey = null;
-    if (options.isUseCache()) {
-      ImmutableSet<BooleanFormula> instantiatedPreds =
+    ImmutableSet<BooleanFormula> instantiatedPreds = null;
+    if (options.isUseCache() || persistentCache != null) {
+      instantiatedPreds =
           Collections3.transformedImmutableSetCopy(
               remainingPredicates, pred -> instantiator.apply(pred.getSymbolicAtom()));
+    }
+    if (options.isUseCache()) {
       absKey = Pair.of(f, instantiatedPreds);
       AbstractionFormula result = abstractionCache.get(absKey);
 
@@ -347,6 +492,30 @@ public class PredicateAbstractionManager {
       }
     }
 
+    String persistentKey = null;
+    if (persistentCache != null) {
+      persistentKey = persistentCache.computeKey(f, instantiatedPreds);
+      BooleanFormula cachedAbs = persistentCache.get(persistentKey);
+      if (cachedAbs != null) {
+        AbstractionFormula result =
+            new AbstractionFormula(
+                fmgr,
+                amgr.convertFormulaToRegion(cachedAbs),
+                cachedAbs,
+                fmgr.instantiate(cachedAbs, ssa),
+                pathFormula,
+                noAbstractionReuse);
+        if (options.isUseCache()) {
+          abstractionCache.put(absKey, result);
+        }
+        logger.log(Level.FINEST, "Abstraction", currentAbstractionId, "was cached on disk");
+        logger.log(Level.ALL, "Abstraction result is", result.asFormula());
+        stats.numCallsAbstractionCached.incrementAndGet();
+        stats.numCallsAbstractionPersistentlyCached.incrementAndGet();
+        return result;
+      }
+    }
+
 
     // Compute result for those predicates
     // where we can trivially identify their truthness in the result
@@ -399,6 +568,9 @@ public class PredicateAbstractionManager {
         unsatisfiabilityCache.add(f);
       }
     }
+    if (persistentCache != null) {
+      persistentCache.put(persistentKey, result.asFormula());
+    }
 
     long abstractionTime =
         TimeSpan.sum(
@@ -449,6 +621,9 @@ public class PredicateAbstractionManager {
 
     final Collection<AbstractionPredicate> predicates =
         getRelevantPredicates(pPredicates, pF, dummyInstantiator);
+    stats.numTotalPredicates.addAndGet(pPredicates.size());
+    stats.maxPredicates.accumulateAndGet(pPredicates.size(), Math::max);
+    stats.numIrrelevantPredicates.addAndGet(pPredicates.size() - predicates.size());
 
     Region abs = computeAbstraction(pF, predicates, dummyInstantiator);
 
@@ -626,10 +801,6 @@ public class PredicateAbstractionManager {
       }
     }
 
-    stats.numTotalPredicates.addAndGet(pPredicates.size());
-    stats.maxPredicates.accumulateAndGet(pPredicates.size(), Math::max);
-    stats.numIrrelevantPredicates.addAndGet(pPredicates.size() - relevantPredicates.size());
-
     return relevantPredicates;
   }
 
@@ -770,7 +941,8 @@ public class PredicateAbstractionManager {
           try {
             abs =
                 rmgr.makeAnd(
-                    abs, computeBooleanAbstraction(thmProver, remainingPredicates, instantiator));
+                    abs,
+                    computeBooleanAbstraction(f, thmProver, remainingPredicates, instantiator));
           } finally {
             booleanAbstractionTimer.stop();
           }
@@ -966,11 +1138,28 @@ public class PredicateAbstractionManager {
    * @return A over-approximation of f.
    */
   private Region computeBooleanAbstraction(
+      final BooleanFormula f,
       final ProverEnvironment thmProver,
       final Collection<AbstractionPredicate> predicates,
       final Function<BooleanFormula, BooleanFormula> instantiator)
       throws InterruptedException, SolverException {
 
+    if (speculativeAbstraction != null) {
+      List<AbstractionPredicate> predicateList = new ArrayList<>(predicates);
+      List<byte[]> models = speculativeAbstraction.takeModels(f, predicateList);
+      if (models != null) {
+        predicates.clear();
+        return buildRegionFromModels(models, predicateList);
+      }
+    }
+
+    if (parallelBooleanAbstraction != null
+        && parallelBooleanAbstraction.isApplicable(predicates.size())) {
+      Region result = computeBooleanAbstractionInParallel(f, predicates, instantiator);
+      predicates.clear();
+      return result;
+    }
+
     // build the definition of the predicates, and instantiate them
     // also collect all predicate variables so that the solver knows for which
     // variables we want to have the satisfying assignments
@@ -1011,6 +1200,64 @@ public class PredicateAbstractionManager {
     return result;
   }
 
+  /**
+   * Compute a Boolean abstraction of a formula by enumerating the models of several cubes of the
+   * predicate space in parallel, cf. {@link ParallelBooleanAbstraction}.
+   */
+  private Region computeBooleanAbstractionInParallel(
+      final BooleanFormula f,
+      final Collection<AbstractionPredicate> predicates,
+      final Function<BooleanFormula, BooleanFormula> instantiator)
+      throws InterruptedException, SolverException {
+    List<AbstractionPredicate> predicateList = new ArrayList<>(predicates);
+    List<BooleanFormula> predVars = new ArrayList<>(predicateList.size());
+    List<BooleanFormula> predDefs = new ArrayList<>(predicateList.size());
+    for (AbstractionPredicate p : predicateList) {
+      predVars.add(p.getSymbolicVariable());
+      predDefs.add(instantiator.apply(p.getSymbolicAtom()));
+    }
+
+    List<byte[]> models;
+    abstractionSolveTimer.start();
+    try {
+      models = parallelBooleanAbstraction.enumerateModels(f, predVars, predDefs);
+    } finally {
+      abstractionSolveTimer.stop();
+    }
+    return buildRegionFromModels(models, predicateList);
+  }
+
+  /**
+   * Build the region for models in the format of {@link
+   * ParallelBooleanAbstraction#enumerateModels}.
+   */
+  private Region buildRegionFromModels(
+      List<byte[]> models, List<AbstractionPredicate> predicateList) throws InterruptedException {
+    Region result;
+    abstractionBddConstructionTimer.start();
+    try (RegionBuilder builder = rmgr.builder(shutdownNotifier)) {
+      for (byte[] model : models) {
+        builder.startNewConjunction();
+        for (int i = 0; i < model.length; i++) {
+          Region region = predicateList.get(i).getAbstractVariable();
+          if (model[i] == ParallelBooleanAbstraction.TRUE) {
+            builder.addPositiveRegion(region);
+          } else if (model[i] == ParallelBooleanAbstraction.FALSE) {
+            builder.addNegativeRegion(region);
+          }
+        }
+        builder.finishConjunction();
+      }
+      result = builder.getResult();
+    } finally {
+      abstractionBddConstructionTimer.stop();
+    }
+
+    stats.maxAllSatCount = Math.max(models.size(), stats.maxAllSatCount);
+    stats.allSatCount += models.size();
+    return result;
+  }
+
   private class AllSatCallbackImpl implements AllSatCallback<Region> {
 
     private final RegionBuilder builder;
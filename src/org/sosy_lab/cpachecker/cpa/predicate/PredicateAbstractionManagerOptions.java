@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.cpa.predicate;
 
 import java.nio.file.Path;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -53,6 +54,16 @@ public class PredicateAbstractionManagerOptions {
   @Option(secure = true, name = "abs.useCache", description = "use caching of abstractions")
   private boolean useCache = true;
 
+  @FileOption(FileOption.Type.OUTPUT_DIRECTORY)
+  @Option(
+      name = "abs.persistentCache",
+      description =
+          "directory for a cache of abstractions that is kept on disk and can be shared"
+              + " between several (also concurrent) runs of CPAchecker"
+              + " (use an absolute path for this);"
+              + " no persistent cache is used if not set")
+  private @Nullable Path persistentCacheDirectory = null;
+
   @Option(
       secure = true,
       name = "refinement.splitItpAtoms",
@@ -110,6 +121,10 @@ public class PredicateAbstractionManagerOptions {
     return useCache;
   }
 
+  @Nullable Path getPersistentCacheDirectory() {
+    return persistentCacheDirectory;
+  }
+
   boolean isSplitItpAtoms() {
     return splitItpAtoms;
   }
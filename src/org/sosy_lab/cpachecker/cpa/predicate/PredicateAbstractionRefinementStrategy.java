@@ -29,14 +29,19 @@ import java.io.IOException;
 import java.io.PrintStream;
 import java.io.Writer;
 import java.nio.charset.Charset;
+import java.nio.file.AtomicMoveNotSupportedException;
+import java.nio.file.Files;
 import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.HashSet;
+import java.util.LinkedHashSet;
 import java.util.List;
 import java.util.Map;
 import java.util.Set;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
 import org.sosy_lab.common.configuration.FileOption.Type;
@@ -142,6 +147,20 @@ public class PredicateAbstractionRefinementStrategy extends RefinementStrategy
   @FileOption(Type.OUTPUT_FILE)
   private PathTemplate dumpPredicatesFile = PathTemplate.ofFormatString("refinement%04d-predicates.prec");
 
+  @Option(
+      secure = true,
+      name = "refinement.checkpointPredicatesFile",
+      description =
+          "After each refinement, write all predicates found so far to this file. The file is"
+              + " replaced atomically, such that it always contains a complete predicate map,"
+              + " even if the analysis is killed. It can be used as"
+              + " cpa.predicate.abstraction.initialPredicates to resume an interrupted analysis.")
+  @FileOption(Type.OUTPUT_FILE)
+  private @Nullable Path checkpointPredicatesFile = null;
+
+  /** union of all precisions computed by refinements, used for the checkpoint */
+  private PredicatePrecision checkpointPrecision = PredicatePrecision.empty();
+
   private int refinementCount = 0; // this is modulo restartAfterRefinements
 
   private boolean atomicPredicates = false;
@@ -221,7 +240,7 @@ public class PredicateAbstractionRefinementStrategy extends RefinementStrategy
     predAbsMgr = pPredAbsMgr;
     formulaMeasuring = new FormulaMeasuring(fmgr);
 
-    if (dumpPredicates && dumpPredicatesFile != null) {
+    if ((dumpPredicates && dumpPredicatesFile != null) || checkpointPredicatesFile != null) {
       precisionWriter = new PredicateMapWriter(config, fmgr);
     } else {
       precisionWriter = null;
@@ -413,6 +432,10 @@ public class PredicateAbstractionRefinementStrategy extends RefinementStrategy
     if (dumpPredicates && dumpPredicatesFile != null) {
       dumpNewPredicates();
     }
+    if (checkpointPredicatesFile != null) {
+      checkpointPrecision = checkpointPrecision.mergeWith(newPrecision);
+      writeCheckpoint(checkpointPredicatesFile, checkpointPrecision);
+    }
 
     precisionUpdate.stop();
 
@@ -606,6 +629,34 @@ public class PredicateAbstractionRefinementStrategy extends RefinementStrategy
     }
   }
 
+  private void writeCheckpoint(Path pFile, PredicatePrecision pPrecision) {
+    Set<AbstractionPredicate> allPredicates = new LinkedHashSet<>(pPrecision.getGlobalPredicates());
+    allPredicates.addAll(pPrecision.getFunctionPredicates().values());
+    allPredicates.addAll(pPrecision.getLocalPredicates().values());
+    allPredicates.addAll(pPrecision.getLocationInstancePredicates().values());
+
+    Path tmpFile = pFile.resolveSibling(pFile.getFileName() + ".tmp");
+    try {
+      try (Writer w = IO.openOutputFile(tmpFile, Charset.defaultCharset())) {
+        precisionWriter.writePredicateMap(
+            pPrecision.getLocationInstancePredicates(),
+            pPrecision.getLocalPredicates(),
+            pPrecision.getFunctionPredicates(),
+            pPrecision.getGlobalPredicates(),
+            allPredicates,
+            w);
+      }
+      try {
+        Files.move(
+            tmpFile, pFile, StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING);
+      } catch (AtomicMoveNotSupportedException e) {
+        Files.move(tmpFile, pFile, StandardCopyOption.REPLACE_EXISTING);
+      }
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write predicate checkpoint to file");
+    }
+  }
+
   private boolean isValuePrecisionAvailable(final ARGReachedSet pReached, ARGState root) {
     if(!pReached.asReachedSet().contains(root)) {
       return false;
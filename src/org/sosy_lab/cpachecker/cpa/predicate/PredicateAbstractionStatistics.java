@@ -8,7 +8,10 @@
 
 package org.sosy_lab.cpachecker.cpa.predicate;
 
+import java.util.List;
+import java.util.concurrent.CopyOnWriteArrayList;
 import java.util.concurrent.atomic.AtomicInteger;
+import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer;
 
 public class PredicateAbstractionStatistics {
@@ -25,6 +28,9 @@ public class PredicateAbstractionStatistics {
   // result was cached, no computation
   final AtomicInteger numCallsAbstractionCached = new AtomicInteger(0);
 
+  // result was in the persistent cache (also counted in numCallsAbstractionCached)
+  final AtomicInteger numCallsAbstractionPersistentlyCached = new AtomicInteger(0);
+
   // loop was cached, no new computation
   final AtomicInteger numInductivePathFormulaCacheUsed = new AtomicInteger(0);
 
@@ -61,6 +67,17 @@ public class PredicateAbstractionStatistics {
   final ThreadSafeTimerContainer abstractionSolveTime =
       new ThreadSafeTimerContainer("Time for abstraction solving");
 
+  // one timer for each solver instance used for parallel boolean abstraction
+  final List<Timer> booleanAbstractionWorkerTimes = new CopyOnWriteArrayList<>();
+
+  // one timer for each solver instance used for speculative abstraction
+  final List<Timer> speculativeAbstractionWorkerTimes = new CopyOnWriteArrayList<>();
+
+  // only updated by the thread of the analysis, cf. SpeculativeAbstraction
+  int numSpeculativeAbstractions = 0;
+  int numSpeculativeAbstractionsUsed = 0;
+  int numSpeculativeAbstractionsDiscarded = 0;
+
   long allSatCount = 0;
   int maxAllSatCount = 0;
 
@@ -133,6 +133,8 @@ public class PredicateCPA
   private final PredicateAbstractionsStorage abstractionStorage;
   private final PredicateAbstractionStatistics abstractionStats =
       new PredicateAbstractionStatistics();
+  private final ParallelBooleanAbstraction parallelBooleanAbstraction;
+  private final SpeculativeAbstraction speculativeAbstraction;
 
   // path formulas for PCC
   private final Map<PredicateAbstractState, PathFormula> computedPathFormulaePcc = new HashMap<>();
@@ -160,6 +162,7 @@ public class PredicateCPA
       blk.setExplicitAbstractionNodes(blockComputer.computeAbstractionNodes(cfa));
     }
     blk.setCFA(cfa);
+    blk.setLogger(logger);
 
     solver = Solver.create(config, logger, pShutdownNotifier);
     formulaManager = solver.getFormulaManager();
@@ -167,7 +170,7 @@ public class PredicateCPA
 
     PathFormulaManager pfMgr = new PathFormulaManagerImpl(formulaManager, config, logger, shutdownNotifier, cfa, direction);
     if (useCache) {
-      pfMgr = new CachingPathFormulaManager(pfMgr);
+      pfMgr = new CachingPathFormulaManager(pfMgr, config);
     }
     pathFormulaManager = pfMgr;
 
@@ -196,6 +199,12 @@ public class PredicateCPA
             solver.getFormulaManager(),
             null);
     weakeningOptions = new WeakeningOptions(config);
+    parallelBooleanAbstraction =
+        new ParallelBooleanAbstraction(
+            config, logger, shutdownNotifier, formulaManager, abstractionStats);
+    speculativeAbstraction =
+        new SpeculativeAbstraction(
+            config, logger, shutdownNotifier, formulaManager, abstractionStats);
 
     statistics = new PredicateStatistics();
     options = new PredicateCpaOptions(config);
@@ -287,7 +296,9 @@ public class PredicateCPA
         abstractionStats,
         invariantsManager.appendToAbstractionFormula()
             ? invariantsManager
-            : TrivialInvariantSupplier.INSTANCE);
+            : TrivialInvariantSupplier.INSTANCE,
+        parallelBooleanAbstraction,
+        speculativeAbstraction);
   }
 
   public PathFormulaManager getPathFormulaManager() {
@@ -345,6 +356,8 @@ public class PredicateCPA
 
   @Override
   public void close() {
+    speculativeAbstraction.close();
+    parallelBooleanAbstraction.close();
     solver.close();
   }
 
@@ -12,9 +12,14 @@ import static java.util.Collections.unmodifiableList;
 import static org.sosy_lab.cpachecker.cpa.predicate.PredicateAbstractState.getPredicateState;
 import static org.sosy_lab.cpachecker.util.statistics.StatisticsWriter.writingStatisticsTo;
 
+import com.google.common.base.Throwables;
 import com.google.common.collect.FluentIterable;
-import com.google.common.collect.HashMultimap;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.LinkedHashMultimap;
+import com.google.common.collect.Lists;
 import com.google.common.collect.SetMultimap;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
 import java.io.PrintStream;
 import java.util.ArrayDeque;
 import java.util.ArrayList;
@@ -24,7 +29,16 @@ import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Optional;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.function.Function;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.Classes.UnexpectedCheckedException;
+import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -45,6 +59,8 @@ import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool.PooledSolver;
 import org.sosy_lab.cpachecker.util.statistics.StatTimer;
 import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
 import org.sosy_lab.java_smt.api.BooleanFormula;
@@ -68,10 +84,19 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
   @IntegerOption(min = 0)
   private int stopAfterNRefinements = 0;
 
+  @Option(
+      secure = true,
+      description =
+          "Number of threads for analyzing the independent subtrees below the root of the ARG"
+              + " in parallel, each one with its own solver instance (1 disables parallelism).")
+  @IntegerOption(min = 1)
+  private int threads = 1;
+
   // statistics
   private final StatTimer totalTime = new StatTimer("Time for refinement");
   private final StatTimer interpolationTime = new StatTimer("Time for interpolation");
   private final StatTimer satCheckTime = new StatTimer("Time for sat-checks");
+  private final StatTimer parallelTime = new StatTimer("Time for parallel subtree analysis");
 
   private final LogManager logger;
   private final GlobalRefinementStrategy strategy;
@@ -79,8 +104,13 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
   private final BooleanFormulaManager bfmgr;
   private final ARGCPA argCPA;
 
+  // only present if threads > 1
+  private final @Nullable SolverPool solverPool;
+  private final @Nullable ExecutorService executor;
+
   public PredicateCPAGlobalRefiner(
       final LogManager pLogger,
+      final ShutdownNotifier pShutdownNotifier,
       final FormulaManagerView pFmgr,
       final GlobalRefinementStrategy pStrategy,
       final Solver pSolver,
@@ -94,6 +124,20 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
     strategy = pStrategy;
     argCPA = pArgcpa;
 
+    if (threads > 1) {
+      solverPool = new SolverPool(pConfig, pLogger, pShutdownNotifier, pFmgr, threads);
+      executor =
+          Executors.newFixedThreadPool(
+              threads,
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("global-refinement-%d")
+                  .build());
+    } else {
+      solverPool = null;
+      executor = null;
+    }
+
     logger.log(
         Level.INFO,
         "Using refinement for predicate analysis with "
@@ -137,8 +181,11 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
    *
    * The strategy is to first build the predecessor/successor relations for all
    * abstraction states on the paths to the target states, and then call
-   * {@link #performRefinementOnPath(List, ARGState, List, ARGReachedSet, InterpolatingProverEnvironment)}
-   * on the root state of the ARG.
+   * {@link #step} on the root state of the ARG.
+   * If the root has several successors and more than one thread is configured,
+   * the subtrees below these successors are independent
+   * and are analyzed in parallel, each one with its own solver instance.
+   * Afterwards, the infeasible paths are handed to the strategy in DFS order.
    */
   private Optional<ARGState> doPathWiseRefinement(
       ARGReachedSet pReached, List<AbstractState> targets)
@@ -146,7 +193,7 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
     logger.log(Level.FINE, "Starting refinement for", targets.size(), "elements.");
 
     Map<ARGState, ARGState> predecessors = new HashMap<>();
-    SetMultimap<ARGState, ARGState> successors = HashMultimap.create();
+    SetMultimap<ARGState, ARGState> successors = LinkedHashMultimap.create();
 
     Deque<AbstractState> todo = new ArrayDeque<>(targets);
 
@@ -177,30 +224,182 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
     // We do not descend beyond unreachable states,
     // but instead perform refinement on them.
 
-    try (InterpolatingProverEnvironment<?> itpProver =
-        solver.newProverEnvironmentWithInterpolation()) {
-      return doPathWiseRefinement(root, successors, predecessors, pReached, targets, itpProver);
+    List<InfeasiblePath> infeasiblePaths = new ArrayList<>();
+    Optional<ARGState> errorState;
+    if (solverPool != null && successors.get(root).size() > 1) {
+      errorState = doParallelRefinement(root, successors, targets, infeasiblePaths);
+    } else {
+      try (InterpolatingProverEnvironment<?> itpProver =
+          solver.newProverEnvironmentWithInterpolation()) {
+        errorState =
+            doPathWiseRefinement(
+                root,
+                successors::get,
+                targets,
+                itpProver,
+                bfmgr,
+                PredicateCPAGlobalRefiner::getBlockFormula,
+                true,
+                infeasiblePaths);
+      }
+    }
+
+    for (InfeasiblePath path : infeasiblePaths) {
+      // TODO repeated counterexample is always false currently, we also ignore the return value
+      strategy.performRefinement(pReached, path.abstractionStatesTrace, path.interpolants, false);
     }
+    return errorState;
+  }
+
+  private static BooleanFormula getBlockFormula(ARGState pState) {
+    return getPredicateState(pState).getAbstractionFormula().getBlockFormula().getFormula();
   }
 
   // This is just a separate method to get the generics right.
   // (The arguments of the list and the prover need to match.)
   private <T> Optional<ARGState> doPathWiseRefinement(
       ARGState current,
-      SetMultimap<ARGState, ARGState> successors,
-      Map<ARGState, ARGState> predecessors,
-      ARGReachedSet pReached,
+      Function<ARGState, Collection<ARGState>> successors,
       List<AbstractState> targets,
-      InterpolatingProverEnvironment<T> itpProver)
-      throws InterruptedException, SolverException, CPAException {
+      InterpolatingProverEnvironment<T> itpProver,
+      BooleanFormulaManager pBfmgr,
+      Function<ARGState, BooleanFormula> blockFormulas,
+      boolean measureTime,
+      List<InfeasiblePath> infeasiblePaths)
+      throws InterruptedException, SolverException {
     List<T> itpStack = new ArrayList<>();
     Deque<ARGState> currentPath = new ArrayDeque<>();
     currentPath.add(current);
     Optional<ARGState> errorState =
-        step(currentPath, itpStack, successors, predecessors, pReached, targets, itpProver);
+        step(
+            currentPath,
+            itpStack,
+            successors,
+            targets,
+            itpProver,
+            pBfmgr,
+            blockFormulas,
+            measureTime,
+            infeasiblePaths);
     return errorState;
   }
 
+  /**
+   * Analyze the subtrees below the successors of the root in parallel. The block formulas of each
+   * subtree are translated into the context of a solver from {@link #solverPool} by this thread,
+   * and the interpolants are translated back afterwards. The result is the same as for the
+   * sequential analysis: infeasible paths are collected in DFS order until the first subtree with a
+   * reachable target state.
+   */
+  private Optional<ARGState> doParallelRefinement(
+      final ARGState root,
+      final SetMultimap<ARGState, ARGState> successors,
+      final List<AbstractState> targets,
+      final List<InfeasiblePath> infeasiblePaths)
+      throws InterruptedException, SolverException {
+    assert solverPool != null && executor != null;
+    parallelTime.start();
+    try {
+      List<ARGState> subtrees = ImmutableList.copyOf(successors.get(root));
+      for (List<ARGState> batch : Lists.partition(subtrees, solverPool.size())) {
+        Optional<ARGState> errorState =
+            doParallelRefinement(root, batch, successors, targets, infeasiblePaths);
+        if (errorState.isPresent()) {
+          return errorState;
+        }
+      }
+      return Optional.empty();
+    } finally {
+      parallelTime.stop();
+    }
+  }
+
+  private Optional<ARGState> doParallelRefinement(
+      final ARGState root,
+      final List<ARGState> batch,
+      final SetMultimap<ARGState, ARGState> successors,
+      final List<AbstractState> targets,
+      final List<InfeasiblePath> infeasiblePaths)
+      throws InterruptedException, SolverException {
+    List<PooledSolver> acquired = new ArrayList<>(batch.size());
+    List<Future<SubtreeResult>> futures = new ArrayList<>(batch.size());
+    try {
+      for (ARGState subtree : batch) {
+        PooledSolver pooled = solverPool.acquire();
+        acquired.add(pooled);
+
+        // translate on this thread, our solver context must not be used by the workers
+        Map<ARGState, BooleanFormula> blockFormulas = new HashMap<>();
+        Deque<ARGState> waitlist = new ArrayDeque<>();
+        waitlist.add(subtree);
+        while (!waitlist.isEmpty()) {
+          ARGState state = waitlist.pop();
+          blockFormulas.put(state, pooled.translateFromMain(getBlockFormula(state)));
+          waitlist.addAll(successors.get(state));
+        }
+        ImmutableList<ARGState> subtreeOnly = ImmutableList.of(subtree);
+        Function<ARGState, Collection<ARGState>> subtreeSuccessors =
+            state -> state == root ? subtreeOnly : successors.get(state);
+
+        futures.add(
+            executor.submit(
+                () -> {
+                  List<InfeasiblePath> paths = new ArrayList<>();
+                  try (InterpolatingProverEnvironment<?> itpProver =
+                      pooled.getSolver().newProverEnvironmentWithInterpolation()) {
+                    Optional<ARGState> errorState =
+                        doPathWiseRefinement(
+                            root,
+                            subtreeSuccessors,
+                            targets,
+                            itpProver,
+                            pooled.getFormulaManager().getBooleanFormulaManager(),
+                            blockFormulas::get,
+                            false,
+                            paths);
+                    return new SubtreeResult(errorState, paths);
+                  }
+                }));
+      }
+
+      for (int i = 0; i < futures.size(); i++) {
+        SubtreeResult result;
+        try {
+          result = futures.get(i).get();
+        } catch (ExecutionException e) {
+          Throwable t = e.getCause();
+          Throwables.propagateIfPossible(t, SolverException.class, InterruptedException.class);
+          throw new UnexpectedCheckedException("parallel global refinement", t);
+        }
+        PooledSolver pooled = acquired.get(i);
+        for (InfeasiblePath path : result.infeasiblePaths) {
+          infeasiblePaths.add(
+              new InfeasiblePath(
+                  path.abstractionStatesTrace,
+                  Lists.transform(path.interpolants, pooled::translateToMain)));
+        }
+        if (result.errorState.isPresent()) {
+          return result.errorState;
+        }
+      }
+      return Optional.empty();
+
+    } finally {
+      // the solvers can only be released after the workers have finished
+      for (Future<?> future : futures) {
+        future.cancel(true);
+        try {
+          Uninterruptibles.getUninterruptibly(future);
+        } catch (ExecutionException | CancellationException e) {
+          // ignore, the exception was already handled above or the result is not relevant
+        }
+      }
+      for (PooledSolver pooled : acquired) {
+        pooled.close();
+      }
+    }
+  }
+
   /**
    * Recursively perform refinement on the subgraph of the ARG starting with a given state.
    * Each recursion step corresponds to one "block" of the ARG. As one block
@@ -210,8 +409,7 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
    * (so we do refinement as soon as possible) or a target state is reached
    * (then we found a feasible counterexample).
    * When an infeasible state was found, we call
-   * {@link #performRefinementOnPath(List, ARGState, List, ARGReachedSet, InterpolatingProverEnvironment)}
-   * to do the actual refinement.
+   * {@link #interpolatePath} to compute the interpolants for the refinement.
    *
    * Note that the successor and predecessor relation contains only states
    * that belong to paths to a target state, so we refine only such paths,
@@ -220,50 +418,64 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
    * @param currentPath The list of ARG states from the root to the current element.
    * @param itpStack The stack of interpolation groups added to the solver environment so far.
    * @param successors The successor relation between abstraction states.
-   * @param predecessors The predecessor relation between abstraction states.
-   * @param pReached The complete reached set.
    * @param targets The set of target states.
+   * @param blockFormulas The block formulas of the abstraction states in the solver context of
+   *     itpProver.
+   * @param measureTime Whether to update the timers (not thread-safe).
+   * @param infeasiblePaths The list where infeasible paths for refinement are added.
    * @return The feasible error location or absent
    */
   private <T> Optional<ARGState> step(
       final Deque<ARGState> currentPath,
       final List<T> itpStack,
-      final SetMultimap<ARGState, ARGState> successors,
-      final Map<ARGState, ARGState> predecessors,
-      final ARGReachedSet pReached,
+      final Function<ARGState, Collection<ARGState>> successors,
       final List<AbstractState> targets,
-      InterpolatingProverEnvironment<T> itpProver)
-      throws InterruptedException, SolverException, CPAException {
-
-    for (final ARGState succ : successors.get(currentPath.getLast())) {
+      final InterpolatingProverEnvironment<T> itpProver,
+      final BooleanFormulaManager pBfmgr,
+      final Function<ARGState, BooleanFormula> blockFormulas,
+      final boolean measureTime,
+      final List<InfeasiblePath> infeasiblePaths)
+      throws InterruptedException, SolverException {
+
+    for (final ARGState succ : successors.apply(currentPath.getLast())) {
       assert succ.getChildren().isEmpty() == targets.contains(succ);
       assert succ.mayCover();
 
-      BooleanFormula blockFormula =
-          getPredicateState(succ).getAbstractionFormula().getBlockFormula().getFormula();
+      BooleanFormula blockFormula = blockFormulas.apply(succ);
       itpStack.add(itpProver.push(blockFormula));
       currentPath.add(succ);
       try {
-        satCheckTime.start();
+        if (measureTime) {
+          satCheckTime.start();
+        }
         boolean isUnsat = itpProver.isUnsat();
-        satCheckTime.stop();
+        if (measureTime) {
+          satCheckTime.stop();
+        }
         if (isUnsat) {
           logger.log(Level.FINE, "Found unreachable state", succ);
           List<ARGState> abstractionStatesTrace = new ArrayList<>(currentPath);
 
           ARGState cur = succ;
-          while (successors.containsKey(cur)) {
+          Collection<ARGState> children;
+          while (!(children = successors.apply(cur)).isEmpty()) {
             // we just always use the first child, as every interpolant
             // below the unreacheable state will be false anyway we don't need
             // to have all paths to all reachable error states
-            ARGState tmp = successors.get(cur).iterator().next();
+            ARGState tmp = children.iterator().next();
             abstractionStatesTrace.add(tmp);
             cur = tmp;
           }
           assert cur.isTarget() : "Last state in path has to be a target state";
 
-          performRefinementOnPath(
-              unmodifiableList(itpStack), succ, abstractionStatesTrace, pReached, itpProver);
+          infeasiblePaths.add(
+              interpolatePath(
+                  unmodifiableList(itpStack),
+                  succ,
+                  abstractionStatesTrace,
+                  itpProver,
+                  pBfmgr,
+                  measureTime));
 
         } else if (targets.contains(succ)) {
           // We have found a reachable target state, immediately abort refinement.
@@ -274,7 +486,16 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
           // Not yet infeasible, but path is longer,
           // so descend recursively.
           Optional<ARGState> tmp =
-              step(currentPath, itpStack, successors, predecessors, pReached, targets, itpProver);
+              step(
+                  currentPath,
+                  itpStack,
+                  successors,
+                  targets,
+                  itpProver,
+                  pBfmgr,
+                  blockFormulas,
+                  measureTime,
+                  infeasiblePaths);
 
           if (tmp.isPresent()) {
             return tmp;
@@ -291,23 +512,23 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
   }
 
   /**
-   * Actually perform refinement on one path. We compute the interpolants from
-   * the first state to the unreachable one.
+   * Compute the interpolants for one infeasible path, from the first state to the unreachable
+   * one. The refinement itself is done later by the strategy.
    *
    * @param itpStack The list with the interpolation groups.
    * @param unreachableState The first state in the path which is infeasible (this identifies the path).
    * @param pAbstractionStatesTrace The complete trace of abstraction states including the unreachable state
-   * @param reached The reached set.
    */
-  private <T> void performRefinementOnPath(
+  private <T> InfeasiblePath interpolatePath(
       List<T> itpStack,
       final ARGState unreachableState,
       List<ARGState> pAbstractionStatesTrace,
-      ARGReachedSet reached,
-      InterpolatingProverEnvironment<T> itpProver)
-      throws CPAException, SolverException, InterruptedException {
+      InterpolatingProverEnvironment<T> itpProver,
+      BooleanFormulaManager pBfmgr,
+      boolean measureTime)
+      throws SolverException, InterruptedException {
     assert !itpStack.isEmpty();
-    assert bfmgr.isFalse(itpProver.getInterpolant(itpStack)); // last interpolant is False
+    assert pBfmgr.isFalse(itpProver.getInterpolant(itpStack)); // last interpolant is False
 
     pAbstractionStatesTrace = FluentIterable.from(pAbstractionStatesTrace).skip(1).toList();
     List<BooleanFormula> interpolants = new ArrayList<>();
@@ -315,25 +536,50 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
     boolean visitedUnreachable = false;
     int sublistCounter = 1;
     for (ARGState state : pAbstractionStatesTrace) {
-      interpolationTime.start();
+      if (measureTime) {
+        interpolationTime.start();
+      }
       visitedUnreachable = visitedUnreachable || state.equals(unreachableState);
 
       if (visitedUnreachable) {
         // fill up interpolants with false as the states are unreachable.
-        interpolants.add(bfmgr.makeFalse());
+        interpolants.add(pBfmgr.makeFalse());
       } else {
         interpolants.add(itpProver.getInterpolant(itpStack.subList(0, sublistCounter)));
         sublistCounter++;
       }
-      interpolationTime.stop();
+      if (measureTime) {
+        interpolationTime.stop();
+      }
     }
 
     // last interpolant will always be false and therefore it is required
     // to remove it, for having proper arguments to call performRefinement
     interpolants.remove(interpolants.size() - 1);
 
-    // TODO repeated counterexample is always false currently, we also ignore the return value
-    strategy.performRefinement(reached, pAbstractionStatesTrace, interpolants, false);
+    return new InfeasiblePath(pAbstractionStatesTrace, interpolants);
+  }
+
+  /** An infeasible path with its interpolants, ready for the refinement strategy. */
+  private static final class InfeasiblePath {
+    private final List<ARGState> abstractionStatesTrace;
+    private final List<BooleanFormula> interpolants;
+
+    private InfeasiblePath(
+        List<ARGState> pAbstractionStatesTrace, List<BooleanFormula> pInterpolants) {
+      abstractionStatesTrace = pAbstractionStatesTrace;
+      interpolants = pInterpolants;
+    }
+  }
+
+  private static final class SubtreeResult {
+    private final Optional<ARGState> errorState;
+    private final List<InfeasiblePath> infeasiblePaths;
+
+    private SubtreeResult(Optional<ARGState> pErrorState, List<InfeasiblePath> pInfeasiblePaths) {
+      errorState = pErrorState;
+      infeasiblePaths = pInfeasiblePaths;
+    }
   }
 
   @Override
@@ -350,6 +596,9 @@ public class PredicateCPAGlobalRefiner implements Refiner, StatisticsProvider {
       w0.put("Number of predicate refinements", numberOfRefinements);
       if (numberOfRefinements > 0) {
         w0.put(totalTime).put(interpolationTime).put(satCheckTime);
+        if (parallelTime.getUpdateCount() > 0) {
+          w0.put(parallelTime);
+        }
       }
     }
 
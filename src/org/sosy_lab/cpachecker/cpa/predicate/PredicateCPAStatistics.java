@@ -20,6 +20,7 @@ import java.io.IOException;
 import java.io.PrintStream;
 import java.io.Writer;
 import java.nio.charset.Charset;
+import java.nio.charset.StandardCharsets;
 import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.Collection;
@@ -28,6 +29,7 @@ import java.util.IdentityHashMap;
 import java.util.LinkedHashSet;
 import java.util.Set;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -36,6 +38,7 @@ import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.io.IO;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.common.time.TimeSpan;
+import org.sosy_lab.common.time.Timer;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
@@ -45,6 +48,7 @@ import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.LoopInvariantsWriter;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicateAbstractionsWriter;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicateMapWriter;
+import org.sosy_lab.cpachecker.util.CFAFingerprints;
 import org.sosy_lab.cpachecker.util.Precisions;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionManager;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionPredicate;
@@ -69,6 +73,16 @@ class PredicateCPAStatistics implements Statistics {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private Path predmapFile = Paths.get("predmap.txt");
 
+  @Option(
+      secure = true,
+      description =
+          "file for exporting the CFA fingerprints of the program together with the predicate map,"
+              + " such that the predicate map can be reused for later versions of the program"
+              + " (cf. option cpa.predicate.abstraction.initialPredicates.fingerprintFile)",
+      name = "predmap.fingerprintFile")
+  @FileOption(FileOption.Type.OUTPUT_FILE)
+  private @Nullable Path predmapFingerprintFile = null;
+
   @Option(secure=true, description="export final loop invariants",
           name="invariants.export")
   private boolean exportInvariants = true;
@@ -96,6 +110,7 @@ class PredicateCPAStatistics implements Statistics {
   private Path abstractionsFile = Paths.get("abstractions.txt");
 
   private final LogManager logger;
+  private final CFA cfa;
 
   private final Solver solver;
   private final PathFormulaManager pfmgr;
@@ -124,6 +139,7 @@ class PredicateCPAStatistics implements Statistics {
     pConfig.inject(this, PredicateCPAStatistics.class);
 
     logger = pLogger;
+    cfa = pCfa;
     solver = pSolver;
     pfmgr = pPfmgr;
     blk = pBlk;
@@ -186,6 +202,14 @@ class PredicateCPAStatistics implements Statistics {
     } catch (IOException e) {
       logger.logUserException(Level.WARNING, e, "Could not write predicate map to file");
     }
+
+    if (predmapFingerprintFile != null) {
+      try (Writer w = IO.openOutputFile(predmapFingerprintFile, StandardCharsets.UTF_8)) {
+        CFAFingerprints.of(cfa).write(w);
+      } catch (IOException e) {
+        logger.logUserException(Level.WARNING, e, "Could not write CFA fingerprints to file");
+      }
+    }
   }
 
 
@@ -250,10 +274,17 @@ class PredicateCPAStatistics implements Statistics {
       out.println("  Because of loop head:            " + valueWithPercentage(blk.numBlkLoops.getValue(), numAbstractions));
       out.println("  Because of join nodes:           " + valueWithPercentage(blk.numBlkJoins.getValue(), numAbstractions));
       out.println("  Because of threshold:            " + valueWithPercentage(blk.numBlkThreshold.getValue(), numAbstractions));
+      if (blk.isAdaptive()) {
+        out.println("    Changes of adaptive threshold: " + blk.numThresholdChanges.getValue());
+        out.println("    Final threshold:               " + blk.getCurrentThreshold());
+      }
       out.println("  Because of target state:         " + valueWithPercentage(statistics.numTargetAbstractions.getUpdateCount(), numAbstractions));
       out.println("  Times precision was empty:       " + valueWithPercentage(as.numSymbolicAbstractions, as.numCallsAbstraction));
       out.println("  Times precision was {false}:     " + valueWithPercentage(as.numSatCheckAbstractions, as.numCallsAbstraction));
       out.println("  Times result was cached:         " + valueWithPercentage(as.numCallsAbstractionCached, as.numCallsAbstraction));
+      if (as.numCallsAbstractionPersistentlyCached.get() > 0) {
+        out.println("    Times result was on disk:      " + valueWithPercentage(as.numCallsAbstractionPersistentlyCached, as.numCallsAbstraction));
+      }
       out.println("  Times cartesian abs was used:    " + valueWithPercentage(as.cartesianAbstractionTime.getNumberOfIntervals(), as.numCallsAbstraction));
       out.println("  Times boolean abs was used:      " + valueWithPercentage(as.booleanAbstractionTime.getNumberOfIntervals(), as.numCallsAbstraction));
       out.println("  Times result was 'false':        " + valueWithPercentage(statistics.numAbstractionsFalse.getUpdateCount(), numAbstractions));
@@ -313,6 +344,15 @@ class PredicateCPAStatistics implements Statistics {
         out.println("  Max number of models for allsat:        " + as.maxAllSatCount);
         out.println("  Avg number of models for allsat:        " + div(as.allSatCount, as.booleanAbstractionTime.getNumberOfIntervals()));
       }
+      if (as.numSpeculativeAbstractions > 0) {
+        out.println(
+            "Number of speculative abstractions:       " + as.numSpeculativeAbstractions);
+        out.println(
+            "  Times used:                             " + as.numSpeculativeAbstractionsUsed);
+        out.println(
+            "  Times discarded:                        "
+                + as.numSpeculativeAbstractionsDiscarded);
+      }
     }
     out.println();
 
@@ -339,6 +379,24 @@ class PredicateCPAStatistics implements Statistics {
       }
       if (as.booleanAbstractionTime.getNumberOfIntervals() > 0) {
         out.println("    Boolean abstraction:             " + as.booleanAbstractionTime);
+        for (int i = 0; i < as.booleanAbstractionWorkerTimes.size(); i++) {
+          Timer workerTime = as.booleanAbstractionWorkerTimes.get(i);
+          out.println(
+              String.format("      Parallel worker %-3d          ", i)
+                  + workerTime
+                  + " (Max: "
+                  + workerTime.getMaxTime().formatAs(SECONDS)
+                  + ")");
+        }
+        for (int i = 0; i < as.speculativeAbstractionWorkerTimes.size(); i++) {
+          Timer workerTime = as.speculativeAbstractionWorkerTimes.get(i);
+          out.println(
+              String.format("      Speculative worker %-3d       ", i)
+                  + workerTime
+                  + " (Max: "
+                  + workerTime.getMaxTime().formatAs(SECONDS)
+                  + ")");
+        }
       }
       if (as.abstractionReuseTime.getNumberOfIntervals() > 0) {
         out.println("    Abstraction reuse:              " + as.abstractionReuseTime);
@@ -13,16 +13,24 @@ import static org.sosy_lab.cpachecker.cpa.predicate.PredicateAbstractState.getPr
 import static org.sosy_lab.cpachecker.util.statistics.StatisticsUtils.toPercent;
 
 import com.google.common.collect.ImmutableList;
+import com.google.common.collect.Iterables;
+import com.google.common.collect.ListMultimap;
+import com.google.common.collect.Lists;
+import com.google.common.collect.MultimapBuilder;
 import java.io.PrintStream;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
+import java.util.HashMap;
 import java.util.Iterator;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 import java.util.logging.Level;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
@@ -48,8 +56,12 @@ import org.sosy_lab.cpachecker.util.predicates.interpolation.CounterexampleTrace
 import org.sosy_lab.cpachecker.util.predicates.interpolation.InterpolationManager;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
 import org.sosy_lab.java_smt.api.BooleanFormula;
 import org.sosy_lab.java_smt.api.BooleanFormulaManager;
+import org.sosy_lab.java_smt.api.Model.ValueAssignment;
+import org.sosy_lab.java_smt.api.ProverEnvironment;
+import org.sosy_lab.java_smt.api.SolverContext.ProverOptions;
 import org.sosy_lab.java_smt.api.SolverException;
 
 /**
@@ -57,13 +69,24 @@ import org.sosy_lab.java_smt.api.SolverException;
  * {@link PredicateAbstractState}s and tries to strengthen them the
  * necessary amount by using interpolation.
  */
+@Options(prefix = "cpa.predicate.forcedCovering")
 public class PredicateForcedCovering implements ForcedCovering, StatisticsProvider {
 
+  @Option(
+      secure = true,
+      description =
+          "Check with an incremental satisfiability check whether forced covering is possible"
+              + " before computing interpolants, and reuse the models of failed checks"
+              + " for rejecting further covering candidates of the same state.")
+  private boolean checkSatisfiabilityFirst = true;
+
   private static final class FCStatistics implements Statistics {
 
     private int attemptedForcedCoverings = 0;
     private int successfulForcedCoverings = 0;
     private int wasAlreadyCovered = 0;
+    private int refutedBySatCheck = 0;
+    private int refutedByModel = 0;
 
     @Override
     public String getName() {
@@ -77,6 +100,10 @@ public class PredicateForcedCovering implements ForcedCovering, StatisticsProvid
         out.println("Successful forced coverings:            " + successfulForcedCoverings + " (" + toPercent(successfulForcedCoverings, attemptedForcedCoverings) + ")");
       }
       out.println("No of times elment was already covered: " + wasAlreadyCovered);
+      if (refutedBySatCheck + refutedByModel > 0) {
+        out.println("Failed coverings found by sat check:    " + refutedBySatCheck);
+        out.println("Failed coverings found by known models: " + refutedByModel);
+      }
     }
   }
 
@@ -87,12 +114,14 @@ public class PredicateForcedCovering implements ForcedCovering, StatisticsProvid
   private final ForcedCoveringStopOperator stop;
 
   private final FormulaManagerView fmgr;
+  private final Solver solver;
   private final InterpolationManager imgr;
   private final PredicateAbstractionManager predAbsMgr;
   private final ImpactUtility impact;
 
   public PredicateForcedCovering(Configuration config, LogManager pLogger,
       ConfigurableProgramAnalysis pCpa) throws InvalidConfigurationException {
+    config.inject(this);
     logger = pLogger;
 
     if (!(pCpa instanceof ARGCPA)) {
@@ -112,7 +141,8 @@ public class PredicateForcedCovering implements ForcedCovering, StatisticsProvid
                                                    config,
                                                    predicateCpa.getShutdownNotifier(),
                                                    pLogger);
-    fmgr = predicateCpa.getSolver().getFormulaManager();
+    solver = predicateCpa.getSolver();
+    fmgr = solver.getFormulaManager();
     predAbsMgr = predicateCpa.getPredicateManager();
     impact = new ImpactUtility(config, fmgr, predAbsMgr);
   }
@@ -135,13 +165,38 @@ public class PredicateForcedCovering implements ForcedCovering, StatisticsProvid
       return false;
     }
 
-    BooleanFormulaManager bfmgr = fmgr.getBooleanFormulaManager();
     logger.log(Level.FINER, "Starting interpolation-based forced covering.");
     logger.log(Level.ALL, "Attempting to force-cover", argState);
 
     ARGReachedSet arg = new ARGReachedSet(pReached, argCpa);
 
     List<ARGState> parentList = getAbstractionPathTo(argState);
+
+    // one incremental prover for each common parent, cf. mayBeCovered()
+    Map<ARGState, ProverEnvironment> provers = new HashMap<>();
+    ListMultimap<ARGState, BooleanFormula> refutingModels =
+        MultimapBuilder.hashKeys().arrayListValues().build();
+    try {
+      return tryForcedCovering(
+          argState, pPrecision, pReached, arg, parentList, provers, refutingModels);
+    } finally {
+      for (ProverEnvironment prover : provers.values()) {
+        prover.close();
+      }
+    }
+  }
+
+  private boolean tryForcedCovering(
+      final ARGState argState,
+      final Precision pPrecision,
+      final ReachedSet pReached,
+      final ARGReachedSet arg,
+      final List<ARGState> parentList,
+      final Map<ARGState, ProverEnvironment> provers,
+      final ListMultimap<ARGState, BooleanFormula> refutingModels)
+      throws CPAException, InterruptedException {
+    final AbstractState pState = argState;
+    BooleanFormulaManager bfmgr = fmgr.getBooleanFormulaManager();
     for (final AbstractState coveringCandidate : pReached.getReached(pState)) {
       if (pState == coveringCandidate) {
         continue;
@@ -192,6 +247,16 @@ public class PredicateForcedCovering implements ForcedCovering, StatisticsProvid
         }
         assert formulas.size() == path.size() + 2;
 
+        try {
+          if (checkSatisfiabilityFirst
+              && !mayBeCovered(commonParent, formulas, provers, refutingModels)) {
+            logger.log(Level.FINER, "Forced covering unsuccessful.");
+            continue; // forced covering not possible
+          }
+        } catch (SolverException e) {
+          throw new CPAException("Solver failure", e);
+        }
+
         // C) Compute interpolants
         CounterexampleTraceInfo interpolantInfo =
             imgr.buildCounterexampleTrace(new BlockFormulas(formulas));
@@ -255,6 +320,60 @@ public class PredicateForcedCovering implements ForcedCovering, StatisticsProvid
     return false;
   }
 
+  /**
+   * Check whether forced covering is possible, i.e., whether the conjunction of the given formulas
+   * (the path from the common parent, and the negated state formula of the candidate) is
+   * unsatisfiable. All candidates with the same common parent have the same path formulas, so
+   * these are pushed only once onto a shared prover. The models of failed checks are kept: if one
+   * of them is consistent with the negated state formula of a later candidate, this candidate
+   * cannot be covered either, and because the model fixes most variables this check is cheap.
+   */
+  private boolean mayBeCovered(
+      ARGState commonParent,
+      List<BooleanFormula> formulas,
+      Map<ARGState, ProverEnvironment> provers,
+      ListMultimap<ARGState, BooleanFormula> refutingModels)
+      throws SolverException, InterruptedException {
+    BooleanFormulaManager bfmgr = fmgr.getBooleanFormulaManager();
+    ProverEnvironment prover = provers.get(commonParent);
+    if (prover == null) {
+      prover = solver.newProverEnvironment(ProverOptions.GENERATE_MODELS);
+      provers.put(commonParent, prover);
+      for (BooleanFormula pathFormula : formulas.subList(0, formulas.size() - 1)) {
+        prover.push(pathFormula);
+      }
+    }
+    BooleanFormula negatedStateFormula = Iterables.getLast(formulas);
+
+    for (BooleanFormula model : refutingModels.get(commonParent)) {
+      prover.push(bfmgr.and(model, negatedStateFormula));
+      try {
+        if (!prover.isUnsat()) {
+          stats.refutedByModel++;
+          return false;
+        }
+      } finally {
+        prover.pop();
+      }
+    }
+
+    prover.push(negatedStateFormula);
+    try {
+      if (prover.isUnsat()) {
+        return true;
+      }
+      refutingModels.put(
+          commonParent,
+          bfmgr.and(
+              Lists.transform(
+                  prover.getModelAssignments(), ValueAssignment::getAssignmentAsFormula)));
+      stats.refutedBySatCheck++;
+      return false;
+    } finally {
+      prover.pop();
+    }
+  }
+
   /**
    * Return a list with all abstraction states on the path from the ARG root
    * to the given element.
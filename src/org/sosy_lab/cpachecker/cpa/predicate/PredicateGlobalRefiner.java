@@ -37,6 +37,7 @@ public abstract class PredicateGlobalRefiner implements Refiner {
 
     return new PredicateCPAGlobalRefiner(
         logger,
+        predicateCpa.getShutdownNotifier(),
         fmgr,
         strategy,
         solver,
@@ -11,6 +11,7 @@ package org.sosy_lab.cpachecker.cpa.predicate;
 import static com.google.common.base.Preconditions.checkArgument;
 import static com.google.common.base.Preconditions.checkNotNull;
 import static com.google.common.collect.FluentIterable.from;
+import static java.util.Comparator.comparingInt;
 
 import com.google.common.base.MoreObjects;
 import com.google.common.base.Preconditions;
@@ -24,6 +25,7 @@ import com.google.common.collect.MultimapBuilder;
 import com.google.common.collect.Sets;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.Collections;
 import java.util.List;
 import java.util.Map;
 import java.util.Objects;
@@ -207,6 +209,14 @@ public final class PredicatePrecision implements AdjustablePrecision {
       return Iterables.getOnlyElement(precisions);
     }
 
+    // Often one of the precisions already contains all others (e.g., in a reached set after
+    // refinement), then we can avoid rebuilding the precision.
+    PredicatePrecision largest =
+        Collections.max(precisions, comparingInt(PredicatePrecision::size));
+    if (from(precisions).allMatch(prec -> prec.isSubsetOf(largest))) {
+      return largest;
+    }
+
     return new PredicatePrecision(
         from(precisions).transformAndConcat(prec -> prec.getLocationInstancePredicates().entries()),
         from(precisions).transformAndConcat(prec -> prec.getLocalPredicates().entries()),
@@ -305,6 +315,9 @@ public final class PredicatePrecision implements AdjustablePrecision {
    * additional global predicates.
    */
   public PredicatePrecision addGlobalPredicates(Collection<AbstractionPredicate> newPredicates) {
+    if (getGlobalPredicates().containsAll(newPredicates)) {
+      return this;
+    }
     return new PredicatePrecision(
         getLocationInstancePredicates(),
         getLocalPredicates(),
@@ -318,7 +331,7 @@ public final class PredicatePrecision implements AdjustablePrecision {
    */
   public PredicatePrecision addFunctionPredicates(
       Iterable<Map.Entry<String, AbstractionPredicate>> newPredicates) {
-    if (Iterables.isEmpty(newPredicates)) {
+    if (Iterables.all(newPredicates, e -> containsEntry(getFunctionPredicates(), e))) {
       return this;
     }
     return new PredicatePrecision(
@@ -334,7 +347,7 @@ public final class PredicatePrecision implements AdjustablePrecision {
    */
   public PredicatePrecision addLocalPredicates(
       Iterable<Map.Entry<CFANode, AbstractionPredicate>> newPredicates) {
-    if (Iterables.isEmpty(newPredicates)) {
+    if (Iterables.all(newPredicates, e -> containsEntry(getLocalPredicates(), e))) {
       return this;
     }
     return new PredicatePrecision(
@@ -350,7 +363,7 @@ public final class PredicatePrecision implements AdjustablePrecision {
    */
   public PredicatePrecision addLocationInstancePredicates(
       Iterable<Map.Entry<LocationInstance, AbstractionPredicate>> newPredicates) {
-    if (Iterables.isEmpty(newPredicates)) {
+    if (Iterables.all(newPredicates, e -> containsEntry(getLocationInstancePredicates(), e))) {
       return this;
     }
     return new PredicatePrecision(
@@ -368,9 +381,12 @@ public final class PredicatePrecision implements AdjustablePrecision {
     if (this == prec || this.isEmpty()) {
       return prec;
     }
-    if (prec.isEmpty()) {
+    if (prec.isEmpty() || prec.isSubsetOf(this)) {
       return this;
     }
+    if (isSubsetOf(prec)) {
+      return prec;
+    }
     return new PredicatePrecision(
         Iterables.concat(
             getLocationInstancePredicates().entries(),
@@ -380,6 +396,42 @@ public final class PredicatePrecision implements AdjustablePrecision {
         Iterables.concat(getGlobalPredicates(), prec.getGlobalPredicates()));
   }
 
+  private static <K, V> boolean containsEntry(
+      ImmutableSetMultimap<K, V> map, Map.Entry<K, V> entry) {
+    return map.containsEntry(entry.getKey(), entry.getValue());
+  }
+
+  /**
+   * Check whether all predicates of this precision are also present in the other precision for the
+   * same locations. Because the union over global, function, and local predicates is computed
+   * eagerly in the constructor, the union of both precisions is then equal to the other precision.
+   * This check is cheap compared to building the union, as it needs only hash lookups of the
+   * (interned) predicates.
+   */
+  private boolean isSubsetOf(PredicatePrecision other) {
+    if (this == other) {
+      return true;
+    }
+    return size() <= other.size()
+        && other.getGlobalPredicates().containsAll(getGlobalPredicates())
+        && Iterables.all(
+            getFunctionPredicates().entries(),
+            e -> containsEntry(other.getFunctionPredicates(), e))
+        && Iterables.all(
+            getLocalPredicates().entries(), e -> containsEntry(other.getLocalPredicates(), e))
+        && Iterables.all(
+            getLocationInstancePredicates().entries(),
+            e -> containsEntry(other.getLocationInstancePredicates(), e));
+  }
+
+  /** The total number of entries in this precision. */
+  private int size() {
+    return getGlobalPredicates().size()
+        + getFunctionPredicates().size()
+        + getLocalPredicates().size()
+        + getLocationInstancePredicates().size();
+  }
+
   /**
    * Calculates a "difference" from this precision to another precision.
    * The difference is the number of predicates which are present in this precision,
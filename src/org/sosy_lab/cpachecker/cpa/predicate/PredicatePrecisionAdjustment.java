@@ -31,6 +31,7 @@ import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionFormula;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionPredicate;
 import org.sosy_lab.cpachecker.util.predicates.BlockOperator;
+import org.sosy_lab.cpachecker.util.predicates.FormulaMeasuring;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormula;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManager;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
@@ -51,6 +52,7 @@ public class PredicatePrecisionAdjustment implements PrecisionAdjustment {
   private final PredicateStatistics statistics;
   private final TimerWrapper totalPrecTime;
   private final TimerWrapper computingAbstractionTime;
+  private final FormulaMeasuring formulaMeasuring;
 
   public PredicatePrecisionAdjustment(
       LogManager pLogger,
@@ -73,6 +75,7 @@ public class PredicatePrecisionAdjustment implements PrecisionAdjustment {
     statistics = pPredicateStatistics;
     totalPrecTime = statistics.totalPrecTime.getNewTimer();
     computingAbstractionTime = statistics.computingAbstractionTime.getNewTimer();
+    formulaMeasuring = new FormulaMeasuring(fmgr);
   }
 
   @Override
@@ -193,6 +196,13 @@ public class PredicatePrecisionAdjustment implements PrecisionAdjustment {
       computingAbstractionTime.stop();
     }
 
+    if (blk.isAdaptive()) {
+      blk.reportAbstraction(
+          pathFormula.getLength(),
+          formulaMeasuring.measure(pathFormula.getFormula()).getAtoms(),
+          computingAbstractionTime.getLengthOfLastInterval());
+    }
+
     // if the abstraction is false, return bottom (represented by empty set)
     if (newAbstractionFormula.isFalse()) {
       statistics.numAbstractionsFalse.inc();
@@ -20,6 +20,7 @@ import java.util.HashSet;
 import java.util.List;
 import java.util.Set;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
@@ -37,6 +38,8 @@ import org.sosy_lab.cpachecker.cpa.automaton.AutomatonGraphmlParser;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicateMapParser;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicatePersistenceUtils.PredicateParsingFailedException;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.CFAFingerprints;
+import org.sosy_lab.cpachecker.util.CFAFingerprints.NodeMapping;
 import org.sosy_lab.cpachecker.util.WitnessInvariantsExtractor;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionManager;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionPredicate;
@@ -53,6 +56,17 @@ public class PredicatePrecisionBootstrapper implements StatisticsProvider {
   @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
   private List<Path> predicatesFiles = ImmutableList.of();
 
+  @Option(
+      secure = true,
+      name = "abstraction.initialPredicates.fingerprintFile",
+      description =
+          "file with the CFA fingerprints of the program version for which the initial predicates"
+              + " were computed (cf. option cpa.predicate.predmap.fingerprintFile)."
+              + " If given, predicates for modified functions are ignored and the CFA nodes"
+              + " of unmodified functions are mapped to the current program version.")
+  @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
+  private @Nullable Path fingerprintFile = null;
+
   @Option(secure=true, description="always check satisfiability at end of block, even if precision is empty")
   private boolean checkBlockFeasibility = false;
 
@@ -147,7 +161,8 @@ public class PredicatePrecisionBootstrapper implements StatisticsProvider {
 
     if (!predicatesFiles.isEmpty()) {
       PredicateMapParser parser =
-          new PredicateMapParser(cfa, logger, formulaManagerView, abstractionManager, options);
+          new PredicateMapParser(
+              cfa, logger, formulaManagerView, abstractionManager, options, readNodeMapping());
 
       for (Path predicatesFile : predicatesFiles) {
         try {
@@ -179,6 +194,26 @@ public class PredicatePrecisionBootstrapper implements StatisticsProvider {
     return result;
   }
 
+  /**
+   * Create the mapping from the program version of the initial predicates to the current program,
+   * or return null if the initial predicates are for the current program.
+   */
+  private @Nullable NodeMapping readNodeMapping() {
+    if (fingerprintFile == null) {
+      return null;
+    }
+    try {
+      CFAFingerprints previous = CFAFingerprints.read(fingerprintFile);
+      return CFAFingerprints.of(cfa).mapFrom(previous, cfa);
+    } catch (IOException | IllegalArgumentException e) {
+      logger.logUserException(
+          Level.WARNING,
+          e,
+          "Could not read CFA fingerprints, assuming initial predicates are for current program");
+      return null;
+    }
+  }
+
   private PredicatePrecision parseInvariantsFromCorrectnessWitnessAsPredicates(Path pWitnessFile)
       throws InterruptedException {
     PredicatePrecision result = PredicatePrecision.empty();
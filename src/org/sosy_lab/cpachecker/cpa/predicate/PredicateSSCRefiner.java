@@ -0,0 +1,27 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.predicate;
+
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
+import org.sosy_lab.cpachecker.core.interfaces.Refiner;
+import org.sosy_lab.cpachecker.cpa.singleSuccessorCompactor.SSCBasedRefiner;
+
+/**
+ * Refiner for predicate analysis with the SingleSuccessorCompactorCPA, which needs to run with
+ * cpa.singleSuccessorCompactor.adjustPrecisionInChains=true such that no abstraction state
+ * disappears within a compacted chain.
+ */
+public abstract class PredicateSSCRefiner implements Refiner {
+
+  public static Refiner create(ConfigurableProgramAnalysis pCpa)
+      throws InvalidConfigurationException {
+    return SSCBasedRefiner.forARGBasedRefiner(PredicateRefiner.create0(pCpa), pCpa);
+  }
+}
@@ -10,6 +10,7 @@ package org.sosy_lab.cpachecker.cpa.predicate;
 
 import static org.sosy_lab.cpachecker.cpa.arg.ARGUtils.getAllStatesOnPathsTo;
 
+import com.google.common.base.Predicate;
 import com.google.common.base.Predicates;
 import com.google.common.collect.ArrayListMultimap;
 import com.google.common.collect.ImmutableList;
@@ -28,8 +29,10 @@ import java.util.Collection;
 import java.util.Collections;
 import java.util.Deque;
 import java.util.HashSet;
+import java.util.LinkedHashMap;
 import java.util.LinkedHashSet;
 import java.util.List;
+import java.util.Map;
 import java.util.Set;
 import java.util.logging.Level;
 import org.sosy_lab.common.ShutdownNotifier;
@@ -55,6 +58,7 @@ import org.sosy_lab.cpachecker.cfa.model.c.CStatementEdge;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.counterexample.CounterexampleInfo;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
@@ -243,10 +247,14 @@ public class PredicateStaticRefiner extends StaticRefiner
 
       shutdownNotifier.shutdownIfNecessary();
       argUpdateTime.start();
-      for (ARGState refinementRoot : ImmutableList.copyOf(root.getChildren())) {
-        pReached.removeSubtree(
-            refinementRoot, newPrecision, Predicates.instanceOf(PredicatePrecision.class));
+      Map<ARGState, List<Precision>> refinementRoots = new LinkedHashMap<>();
+      for (ARGState refinementRoot : root.getChildren()) {
+        refinementRoots.put(refinementRoot, ImmutableList.<Precision>of(newPrecision));
       }
+      pReached.removeSubtrees(
+          refinementRoots,
+          ImmutableList.<Predicate<? super Precision>>of(
+              Predicates.instanceOf(PredicatePrecision.class)));
       argUpdateTime.stop();
 
       return CounterexampleInfo.spurious();
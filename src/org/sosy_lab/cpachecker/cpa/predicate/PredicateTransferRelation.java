@@ -113,12 +113,18 @@ public final class PredicateTransferRelation extends SingleEdgeTransferRelation
 
       // calculate strongest post
       PathFormula pathFormula = convertEdgeToPathFormula(element.getPathFormula(), edge);
-      logger.log(Level.ALL, "New path formula is", pathFormula);
+      if (logger.wouldBeLogged(Level.ALL)) {
+        logger.log(Level.ALL, "New path formula is", pathFormula);
+      }
 
       // Check whether we should do a SAT check.s
       boolean satCheck = shouldDoSatCheck(edge, pathFormula);
-      logger.log(Level.FINEST, "Handling non-abstraction location",
-          (satCheck ? "with satisfiability check" : ""));
+      if (logger.wouldBeLogged(Level.FINEST)) {
+        logger.log(
+            Level.FINEST,
+            "Handling non-abstraction location",
+            (satCheck ? "with satisfiability check" : ""));
+      }
 
       try {
         if (satCheck && unsatCheck(element.getAbstractionFormula(), pathFormula)) {
@@ -138,6 +144,19 @@ public final class PredicateTransferRelation extends SingleEdgeTransferRelation
                 element,
                 element.getPreviousAbstractionState());
       }
+
+      CFANode loc = getAnalysisSuccessor(edge);
+      if (formulaManager.isSpeculativeAbstractionEnabled()
+          && pPrecision instanceof PredicatePrecision
+          && blk.isBlockEnd(loc, pathFormula.getLength())) {
+        // the precision adjustment will compute an abstraction for this state,
+        // this can already start now in the background
+        int locInstance = successor.getAbstractionLocationsOnPath().getOrDefault(loc, 0) + 1;
+        formulaManager.speculateAbstraction(
+            successor.getAbstractionFormula(),
+            pathFormula,
+            ((PredicatePrecision) pPrecision).getPredicates(loc, locInstance));
+      }
       return Collections.singleton(successor);
 
     } finally {
@@ -31,6 +31,7 @@ import java.util.Objects;
 import java.util.Set;
 import java.util.logging.Level;
 import java.util.stream.Collectors;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.collect.PersistentList;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -51,7 +52,11 @@ import org.sosy_lab.cpachecker.cpa.predicate.SlicingAbstractionsUtils.Abstractio
 import org.sosy_lab.cpachecker.cpa.slab.EdgeSet;
 import org.sosy_lab.cpachecker.cpa.slab.SLARGState;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.exceptions.CPATransferException;
+import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.Triple;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionFormula;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormula;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManager;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing.PointerTargetSet;
@@ -59,7 +64,6 @@ import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
 import org.sosy_lab.java_smt.api.BooleanFormula;
 import org.sosy_lab.java_smt.api.ProverEnvironment;
-import org.sosy_lab.java_smt.api.SolverContext.ProverOptions;
 import org.sosy_lab.java_smt.api.SolverException;
 
 /**
@@ -79,6 +83,7 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
     private final Timer calcReached = new Timer();
     private int refinementCount = 0;
     private int solverCallCount = 0;
+    private int segmentFormulaCacheHits = 0;
 
     @Override
     public String getName() {
@@ -95,6 +100,7 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
       out.println("    Copy edges:                       " + copyEdges);
       out.println("    Slice edges:                      " + sliceEdges);
       out.println("      Solver calls:                       " + solverCallCount);
+      out.println("      Segment formulas from cache:        " + segmentFormulaCacheHits);
       out.println("    Recalculate ReachedSet:           " + calcReached);
       out.println();
       out.println("Number of abstractions during refinements:  " + impact.abstractionTime.getNumberOfIntervals());
@@ -132,6 +138,25 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
   )
   private boolean dynamicBlockEncoding = false;
 
+  @Option(
+    secure = true,
+    description =
+        "Check all segments leaving an abstraction state on one prover, such that the abstraction"
+            + " formula of the start state is asserted only once and each segment is checked"
+            + " with push/pop on top of it"
+  )
+  private boolean incrementalSolving = true;
+
+  @Option(
+    secure = true,
+    description =
+        "Cache the path formulas of segments across refinements for as long as the ARG edges of"
+            + " the segment do not change"
+  )
+  private boolean cacheSegmentFormulas = true;
+
+  private static final SSAMap START_SSA_MAP = SSAMap.emptySSAMap().withDefault(1);
+
   private final Stats stats = new Stats();
 
   private final BooleanFormulaManagerView bfmgr;
@@ -155,6 +180,14 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
 
   private Map<ARGState, ARGState> forkedStateMap;
 
+  // Path formulas of segments without the abstraction formulas of start and stop,
+  // keyed by the stop state and the ARG edges of the segment
+  // (cf. SlicingAbstractionsUtils#getSegmentStructure).
+  private final Map<
+          Pair<ARGState, ImmutableList<Triple<ARGState, ARGState, ImmutableList<CFAEdge>>>>,
+          PathFormula>
+      segmentFormulaCache = new HashMap<>();
+
   public SlicingAbstractionsStrategy(final PredicateCPA pPredicateCpa, final Configuration config)
       throws InvalidConfigurationException {
     super(pPredicateCpa.getSolver());
@@ -323,6 +356,15 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
       pReached.removeSafeRegions();
     }
 
+    // forget formulas of segments that are no longer part of the ARG
+    segmentFormulaCache
+        .keySet()
+        .removeIf(
+            key ->
+                key.getFirst().isDestroyed()
+                    || from(key.getSecond())
+                        .anyMatch(t -> t.getFirst().isDestroyed() || t.getSecond().isDestroyed()));
+
     argLogger.log("in refinement after pruning!", pReached.asReachedSet().asCollection());
 
     stats.argUpdate.stop();
@@ -395,25 +437,28 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
       Map<ARGState, PersistentList<ARGState>> segmentMap =
           SlicingAbstractionsUtils.calculateOutgoingSegments(currentState);
       Map<ARGState, Boolean> infeasibleMap = new HashMap<>();
-      for (Map.Entry<ARGState, PersistentList<ARGState>> entry : segmentMap.entrySet()) {
-        ARGState key = entry.getKey();
-        List<ARGState> segment = entry.getValue();
-        boolean infeasible;
-        if (currentState instanceof SLARGState) {
-          infeasible = checkSymbolicEdge(currentState, key, segment);
-        } else {
-          infeasible =
-              checkEdge(
-                  currentState,
-                  key,
-                  segment,
-                  pAbstractionStatesTrace,
-                  rootState,
-                  pInfeasiblePartOfART,
-                  pChangedElements);
-        }
+      try (SegmentChecker checker = new SegmentChecker(currentState)) {
+        for (Map.Entry<ARGState, PersistentList<ARGState>> entry : segmentMap.entrySet()) {
+          ARGState key = entry.getKey();
+          List<ARGState> segment = entry.getValue();
+          boolean infeasible;
+          if (currentState instanceof SLARGState) {
+            infeasible = checkSymbolicEdge(checker, currentState, key, segment);
+          } else {
+            infeasible =
+                checkEdge(
+                    checker,
+                    currentState,
+                    key,
+                    segment,
+                    pAbstractionStatesTrace,
+                    rootState,
+                    pInfeasiblePartOfART,
+                    pChangedElements);
+          }
 
-        infeasibleMap.put(key, infeasible);
+          infeasibleMap.put(key, infeasible);
+        }
       }
       slice0(currentState, segmentMap, infeasibleMap);
     }
@@ -469,7 +514,8 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
     }
   }
 
-  private boolean checkEdgeSet(SLARGState startState, SLARGState endState)
+  private boolean checkEdgeSet(
+      SegmentChecker checker, SLARGState startState, SLARGState endState)
       throws InterruptedException, CPAException {
     assert startState.getChildren().contains(endState);
     EdgeSet edgeSet = startState.getEdgeSetToChild(endState);
@@ -478,7 +524,7 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
     for (Iterator<CFAEdge> it = edgeSet.iterator(); it.hasNext(); ) {
       CFAEdge cfaEdge = it.next();
       edgeSet.select(cfaEdge);
-      if (isInfeasibleEdge(startState, endState, ImmutableList.of())) {
+      if (checker.isInfeasible(endState, ImmutableList.of())) {
         it.remove();
       } else {
         infeasible = false;
@@ -490,7 +536,7 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
     return infeasible;
   }
 
-  private boolean checkEdge(ARGState startState, ARGState endState,
+  private boolean checkEdge(SegmentChecker checker, ARGState startState, ARGState endState,
       List<ARGState> segmentList, final List<ARGState> abstractionStatesTrace, ARGState rootState,
       ARGState pInfeasiblePartOfART, List<ARGState> pChangedElements)
           throws InterruptedException, CPAException {
@@ -502,12 +548,12 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
       infeasible = true;
     } else if (minimalSlicing) {
       if (!optimizeSlicing) {
-        assert (!mustBeInfeasible || isInfeasibleEdge(startState, endState, segmentList)) : "Edge "
+        assert (!mustBeInfeasible || checker.isInfeasible(endState, segmentList)) : "Edge "
             + startState.getStateId() + " -> " + endState.getStateId() + " must be infeasible!";
       }
       infeasible = mustBeInfeasible;
     } else {
-      infeasible = isInfeasibleEdge(startState, endState, segmentList);
+      infeasible = checker.isInfeasible(endState, segmentList);
       // Assert that mustBeInfeasible => infeasible holds:
       assert (!mustBeInfeasible || infeasible) : "Edge " + startState.getStateId() + " -> "
           + endState.getStateId() + " must be infeasible!";
@@ -521,55 +567,122 @@ public class SlicingAbstractionsStrategy extends RefinementStrategy implements S
   }
 
   private boolean checkSymbolicEdge(
-      ARGState pStartState, ARGState pEndState, List<ARGState> pSegmentList)
+      SegmentChecker pChecker,
+      ARGState pStartState,
+      ARGState pEndState,
+      List<ARGState> pSegmentList)
       throws InterruptedException, CPAException {
     boolean edgeSetExists = pStartState.getChildren().contains(pEndState);
     boolean segmentExists = !pSegmentList.isEmpty();
     if (segmentExists && !edgeSetExists) {
-      return isInfeasibleEdge(pStartState, pEndState, pSegmentList);
+      return pChecker.isInfeasible(pEndState, pSegmentList);
     } else if (!segmentExists && edgeSetExists) {
-      return checkEdgeSet((SLARGState) pStartState, (SLARGState) pEndState);
+      return checkEdgeSet(pChecker, (SLARGState) pStartState, (SLARGState) pEndState);
     } else if (segmentExists && edgeSetExists) {
-      boolean edgeSetInfeasible = checkEdgeSet((SLARGState) pStartState, (SLARGState) pEndState);
+      boolean edgeSetInfeasible =
+          checkEdgeSet(pChecker, (SLARGState) pStartState, (SLARGState) pEndState);
       if (edgeSetInfeasible) {
         pEndState.removeParent(pStartState);
       }
-      boolean segmentInfeasible = isInfeasibleEdge(pStartState, pEndState, pSegmentList);
+      boolean segmentInfeasible = pChecker.isInfeasible(pEndState, pSegmentList);
       return edgeSetInfeasible && segmentInfeasible;
     } else {
       throw new RuntimeException("Checking a nonexisting transition in the ARG!");
     }
   }
 
-  private boolean isInfeasibleEdge(ARGState start, ARGState stop, List<ARGState> segmentList)
-      throws InterruptedException, CPAException {
-    boolean infeasible = false;
+  /**
+   * Get the path formula of a segment without the abstraction formulas of start and stop, starting
+   * with SSA index 1 for all variables.
+   */
+  private PathFormula getSegmentFormula(ARGState start, ARGState stop, List<ARGState> segmentList)
+      throws CPATransferException, InterruptedException {
+    if (!cacheSegmentFormulas) {
+      return buildSegmentFormula(start, stop, segmentList);
+    }
+    Pair<ARGState, ImmutableList<Triple<ARGState, ARGState, ImmutableList<CFAEdge>>>> key =
+        Pair.of(stop, SlicingAbstractionsUtils.getSegmentStructure(start, stop, segmentList));
+    PathFormula segmentFormula = segmentFormulaCache.get(key);
+    if (segmentFormula == null) {
+      segmentFormula = buildSegmentFormula(start, stop, segmentList);
+      segmentFormulaCache.put(key, segmentFormula);
+    } else {
+      stats.segmentFormulaCacheHits++;
+    }
+    return segmentFormula;
+  }
 
-    SSAMap startSSAMap = SSAMap.emptySSAMap().withDefault(1);
-    PointerTargetSet startPts = PointerTargetSet.emptyPointerTargetSet();
-    BooleanFormula formula =
-        buildPathFormula(
-                start,
-                stop,
-                segmentList,
-                startSSAMap,
-                startPts,
-                solver.getFormulaManager(),
-                pfmgr,
-                AbstractionPosition.BOTH)
-            .getFormula();
-    try (ProverEnvironment thmProver = solver.newProverEnvironment(ProverOptions.GENERATE_MODELS)) {
-      thmProver.push(formula);
+  private PathFormula buildSegmentFormula(ARGState start, ARGState stop, List<ARGState> segmentList)
+      throws CPATransferException, InterruptedException {
+    return buildPathFormula(
+        start,
+        stop,
+        segmentList,
+        START_SSA_MAP,
+        PointerTargetSet.emptyPointerTargetSet(),
+        solver.getFormulaManager(),
+        pfmgr,
+        AbstractionPosition.NONE);
+  }
+
+  /**
+   * Checks the infeasibility of the segments leaving one abstraction state. With {@link
+   * #incrementalSolving}, all checks share one prover on which the abstraction formula of the start
+   * state is asserted only once.
+   */
+  private class SegmentChecker implements AutoCloseable {
+
+    private final ARGState start;
+    private @Nullable ProverEnvironment prover = null;
+
+    private SegmentChecker(ARGState pStart) {
+      start = pStart;
+    }
+
+    private boolean isInfeasible(ARGState stop, List<ARGState> segmentList)
+        throws InterruptedException, CPAException {
+      BooleanFormula segmentFormula =
+          pfmgr
+              .makeAnd(
+                  getSegmentFormula(start, stop, segmentList),
+                  getPredicateState(stop).getAbstractionFormula().asFormula())
+              .getFormula();
       stats.increaseSolverCallCounter();
-      if (thmProver.isUnsat()) {
-        infeasible = true;
-      } else {
-        infeasible = false;
+      try {
+        if (!incrementalSolving) {
+          try (ProverEnvironment thmProver = solver.newProverEnvironment()) {
+            thmProver.push(getStartFormula());
+            thmProver.push(segmentFormula);
+            return thmProver.isUnsat();
+          }
+        }
+        if (prover == null) {
+          prover = solver.newProverEnvironment();
+          prover.push(getStartFormula());
+        }
+        prover.push(segmentFormula);
+        try {
+          return prover.isUnsat();
+        } finally {
+          prover.pop();
+        }
+      } catch (SolverException e) {
+        throw new CPAException("Solver Failure", e);
+      }
+    }
+
+    private BooleanFormula getStartFormula() {
+      return solver
+          .getFormulaManager()
+          .instantiate(getPredicateState(start).getAbstractionFormula().asFormula(), START_SSA_MAP);
+    }
+
+    @Override
+    public void close() {
+      if (prover != null) {
+        prover.close();
       }
-    } catch (SolverException  e){
-         throw new CPAException("Solver Failure", e);
     }
-    return infeasible;
   }
 
   private boolean mustBeInfeasible(ARGState parent, ARGState child,
@@ -50,6 +50,7 @@ import org.sosy_lab.cpachecker.cpa.slab.EdgeSet;
 import org.sosy_lab.cpachecker.cpa.slab.SLARGState;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.Triple;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormula;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaBuilder;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormulaManager;
@@ -421,6 +422,35 @@ public class SlicingAbstractionsUtils {
     return finishedBuilders.get(stop);
   }
 
+  /**
+   * Get the ARG edges that {@link #buildPathFormula(ARGState, ARGState, List, SSAMap,
+   * PointerTargetSet, FormulaManagerView, PathFormulaManager, ImmutableSet)} encodes for a
+   * segment, as triples of parent state, child state, and the CFA edges between them. As long as
+   * this structure does not change, neither does the path formula of the segment (without the
+   * abstraction formulas of start and stop), so it can be used as key for caching such formulas.
+   */
+  static ImmutableList<Triple<ARGState, ARGState, ImmutableList<CFAEdge>>> getSegmentStructure(
+      ARGState start, ARGState stop, List<ARGState> segmentList) {
+    ImmutableList.Builder<Triple<ARGState, ARGState, ImmutableList<CFAEdge>>> structure =
+        ImmutableList.builder();
+    Set<ARGState> finished = new HashSet<>();
+    List<ARGState> allList = new ArrayList<>(segmentList);
+    allList.add(0, start);
+    allList.add(stop);
+
+    // same iteration order as in buildFormulaBuilder
+    for (ARGState currentState : allList) {
+      for (ARGState parent : currentState.getParents()) {
+        if (finished.contains(parent)) {
+          ImmutableList<CFAEdge> edges = ImmutableList.copyOf(parent.getEdgesToChild(currentState));
+          structure.add(Triple.of(parent, currentState, edges));
+        }
+      }
+      finished.add(currentState);
+    }
+    return structure.build();
+  }
+
   private static PathFormula invariantPathFormulaFromState(
       ARGState state, SSAMap pSSAMap, PointerTargetSet pPts, FormulaManagerView fmgr) {
     BooleanFormula initFormula = getPredicateState(state).getAbstractionFormula().asFormula();
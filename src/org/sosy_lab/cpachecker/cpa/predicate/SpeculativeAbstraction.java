@@ -0,0 +1,269 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.predicate;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import java.util.ArrayList;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.function.Function;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.Timer;
+import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.SolverException;
+
+/**
+ * Speculative computation of Boolean abstractions on a pool of background solvers.
+ *
+ * <p>When the transfer relation creates a successor at a block end, the abstraction that the
+ * precision adjustment will compute for it is already known except for invariants and additional
+ * predicates. The models of this abstraction are enumerated in the background while the analysis
+ * continues, and handed to {@link PredicateAbstractionManager} when it computes the abstraction.
+ * The speculative models are used only if the formula to abstract is exactly the same and the
+ * predicates are a subset of the speculated predicates (then the models are projected). Otherwise,
+ * or if the background computation has not started yet, the abstraction is computed as usual.
+ *
+ * <p>Each worker has its own solver instance and executes its computations sequentially. Formulas
+ * are dumped in the main solver context by the calling thread and parsed by the worker, such that
+ * no solver context is ever used by two threads. All methods of this class except the background
+ * computations are called by the thread of the analysis, so there is no further synchronization.
+ */
+@Options(prefix = "cpa.predicate.abs.speculative")
+final class SpeculativeAbstraction implements AutoCloseable {
+
+  @Option(
+      secure = true,
+      description =
+          "number of solver instances that speculatively compute Boolean abstractions at block"
+              + " ends in the background (0 disables speculative abstraction)")
+  @IntegerOption(min = 0)
+  private int threads = 0;
+
+  @Option(
+      secure = true,
+      description =
+          "maximal number of speculative abstractions that are pending at the same time,"
+              + " the oldest ones are discarded")
+  @IntegerOption(min = 1)
+  private int maxPending = 16;
+
+  private static final class Speculation {
+    private final ImmutableList<AbstractionPredicate> predicates;
+    private final AtomicBoolean started;
+    private final Future<List<byte[]>> models;
+
+    private Speculation(
+        ImmutableList<AbstractionPredicate> pPredicates,
+        AtomicBoolean pStarted,
+        Future<List<byte[]>> pModels) {
+      predicates = pPredicates;
+      started = pStarted;
+      models = pModels;
+    }
+  }
+
+  private final LogManager logger;
+  private final FormulaManagerView fmgr;
+  private final PredicateAbstractionStatistics stats;
+  private final List<Solver> workers;
+  private final List<Timer> workerTimes;
+  private final List<ExecutorService> executors;
+
+  // insertion order is used for discarding the oldest speculations
+  private final Map<BooleanFormula, Speculation> pending = new LinkedHashMap<>();
+  private int nextWorker = 0;
+
+  SpeculativeAbstraction(
+      Configuration pConfig,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier,
+      FormulaManagerView pFmgr,
+      PredicateAbstractionStatistics pStats)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+    fmgr = pFmgr;
+    stats = pStats;
+
+    ImmutableList.Builder<Solver> solvers = ImmutableList.builderWithExpectedSize(threads);
+    ImmutableList.Builder<Timer> timers = ImmutableList.builderWithExpectedSize(threads);
+    ImmutableList.Builder<ExecutorService> pools = ImmutableList.builderWithExpectedSize(threads);
+    for (int i = 0; i < threads; i++) {
+      solvers.add(Solver.create(pConfig, pLogger, pShutdownNotifier));
+      timers.add(new Timer());
+      pools.add(
+          Executors.newSingleThreadExecutor(
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("speculative-abstraction-" + i)
+                  .build()));
+    }
+    workers = solvers.build();
+    workerTimes = timers.build();
+    executors = pools.build();
+    stats.speculativeAbstractionWorkerTimes.addAll(workerTimes);
+  }
+
+  boolean isEnabled() {
+    return !workers.isEmpty();
+  }
+
+  /**
+   * Start the enumeration of the models of the given formula over the given predicates in the
+   * background.
+   *
+   * @param pFormula The (instantiated) formula to abstract, in the main solver context.
+   * @param pPredicates The predicates for the abstraction.
+   * @param pInstantiator The function that instantiates the predicates for the formula.
+   */
+  void submit(
+      BooleanFormula pFormula,
+      List<AbstractionPredicate> pPredicates,
+      Function<BooleanFormula, BooleanFormula> pInstantiator) {
+    if (pPredicates.isEmpty() || pending.containsKey(pFormula)) {
+      return;
+    }
+    if (pending.size() >= maxPending) {
+      Iterator<Speculation> oldest = pending.values().iterator();
+      // a running computation cannot be interrupted without breaking the solver context,
+      // but it will finish soon and its result is simply ignored
+      oldest.next().models.cancel(false);
+      oldest.remove();
+      stats.numSpeculativeAbstractionsDiscarded++;
+    }
+
+    String formula = fmgr.dumpFormula(pFormula).toString();
+    List<String> vars = new ArrayList<>(pPredicates.size());
+    List<String> defs = new ArrayList<>(pPredicates.size());
+    for (AbstractionPredicate p : pPredicates) {
+      vars.add(fmgr.dumpFormula(p.getSymbolicVariable()).toString());
+      defs.add(fmgr.dumpFormula(pInstantiator.apply(p.getSymbolicAtom())).toString());
+    }
+
+    Solver worker = workers.get(nextWorker);
+    Timer workerTime = workerTimes.get(nextWorker);
+    AtomicBoolean started = new AtomicBoolean(false);
+    Future<List<byte[]>> models =
+        executors
+            .get(nextWorker)
+            .submit(
+                () -> {
+                  started.set(true);
+                  return enumerateModels(worker, workerTime, formula, vars, defs);
+                });
+    nextWorker = (nextWorker + 1) % workers.size();
+
+    pending.put(pFormula, new Speculation(ImmutableList.copyOf(pPredicates), started, models));
+    stats.numSpeculativeAbstractions++;
+  }
+
+  private static List<byte[]> enumerateModels(
+      Solver pWorker, Timer pWorkerTime, String pFormula, List<String> pVars, List<String> pDefs)
+      throws SolverException, InterruptedException {
+    FormulaManagerView wfmgr = pWorker.getFormulaManager();
+    BooleanFormulaManagerView wbfmgr = wfmgr.getBooleanFormulaManager();
+    BooleanFormula formula = wfmgr.parse(pFormula);
+    List<BooleanFormula> vars = new ArrayList<>(pVars.size());
+    List<BooleanFormula> defs = new ArrayList<>(pVars.size());
+    for (int i = 0; i < pVars.size(); i++) {
+      BooleanFormula var = wfmgr.parse(pVars.get(i));
+      vars.add(var);
+      defs.add(wbfmgr.equivalence(var, wfmgr.parse(pDefs.get(i))));
+    }
+    return ParallelBooleanAbstraction.enumerateCubes(
+        pWorker,
+        pWorkerTime,
+        formula,
+        wbfmgr.and(defs),
+        vars,
+        ImmutableList.of(wbfmgr.makeTrue()));
+  }
+
+  /**
+   * Get the models of a speculative abstraction of the given formula, projected to the given
+   * predicates, in the format of {@link ParallelBooleanAbstraction#enumerateModels}. This waits for
+   * the background computation if it is already running.
+   *
+   * @return The models, or null if there is no matching speculation and the abstraction has to be
+   *     computed as usual.
+   */
+  @Nullable List<byte[]> takeModels(BooleanFormula pFormula, List<AbstractionPredicate> pPredicates)
+      throws InterruptedException {
+    Speculation speculation = pending.remove(pFormula);
+    if (speculation == null) {
+      return null;
+    }
+
+    int[] indices = new int[pPredicates.size()];
+    for (int i = 0; i < indices.length; i++) {
+      indices[i] = speculation.predicates.indexOf(pPredicates.get(i));
+      if (indices[i] < 0) {
+        speculation.models.cancel(false);
+        stats.numSpeculativeAbstractionsDiscarded++;
+        return null;
+      }
+    }
+    if (!speculation.started.get() && speculation.models.cancel(false)) {
+      // still queued, computing it directly is faster than waiting
+      stats.numSpeculativeAbstractionsDiscarded++;
+      return null;
+    }
+
+    List<byte[]> models;
+    try {
+      models = speculation.models.get();
+    } catch (ExecutionException e) {
+      logger.logDebugException(e.getCause(), "Speculative abstraction failed");
+      stats.numSpeculativeAbstractionsDiscarded++;
+      return null;
+    }
+
+    List<byte[]> result = new ArrayList<>(models.size());
+    for (byte[] model : models) {
+      byte[] projected = new byte[indices.length];
+      for (int i = 0; i < indices.length; i++) {
+        projected[i] = model[indices[i]];
+      }
+      result.add(projected);
+    }
+    logger.log(Level.ALL, "Using speculative abstraction with", result.size(), "models");
+    stats.numSpeculativeAbstractionsUsed++;
+    return result;
+  }
+
+  @Override
+  public void close() {
+    pending.clear();
+    for (ExecutorService executor : executors) {
+      executor.shutdownNow();
+    }
+    for (Solver worker : workers) {
+      worker.close();
+    }
+  }
+}
@@ -0,0 +1,145 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.predicate.persistence;
+
+import static java.nio.charset.StandardCharsets.UTF_8;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import java.io.IOException;
+import java.nio.file.AtomicMoveNotSupportedException;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.Collection;
+import java.util.List;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.collect.Collections3;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+
+/**
+ * On-disk cache for abstraction results that can be shared between several runs of CPAchecker.
+ *
+ * <p>The cache is content-addressed: the key of an entry is a hash of the block formula, the
+ * predicates used for the abstraction, and an identifier of the solver configuration. Each entry
+ * is stored in its own file, named after the key, that contains the abstraction formula in
+ * SMT-LIB2 format. Entries are never modified after they are written, and they are written to a
+ * temporary file first and then atomically moved to their final name. Thus several processes can
+ * read and write the same cache directory concurrently without locking. Nothing is read at
+ * startup; entries are loaded only on lookup.
+ */
+public class PersistentAbstractionCache {
+
+  private static final String FILE_SUFFIX = ".smt2";
+
+  private final Path directory;
+  private final String solverIdentifier;
+  private final FormulaManagerView fmgr;
+  private final LogManager logger;
+
+  /**
+   * Create a cache that is stored in the given directory.
+   *
+   * @param pSolverIdentifier A string that identifies the solver and all settings that influence
+   *     the result of the abstraction computation. Entries are only shared between instances with
+   *     equal identifiers.
+   */
+  public PersistentAbstractionCache(
+      Path pDirectory, String pSolverIdentifier, FormulaManagerView pFmgr, LogManager pLogger)
+      throws IOException {
+    directory = pDirectory;
+    solverIdentifier = pSolverIdentifier;
+    fmgr = pFmgr;
+    logger = pLogger;
+    Files.createDirectories(directory);
+  }
+
+  /**
+   * Compute the key for an abstraction of the given formula with the given predicates. Both the
+   * formula and the predicates need to be instantiated with the same SSA indices.
+   */
+  public String computeKey(BooleanFormula pFormula, Collection<BooleanFormula> pPredicates) {
+    List<String> predicates =
+        ImmutableList.sortedCopyOf(
+            Collections3.transformedImmutableSetCopy(pPredicates, this::dump));
+    Hasher hasher = Hashing.sha256().newHasher();
+    hasher.putString(solverIdentifier, UTF_8).putChar('\0');
+    hasher.putString(dump(pFormula), UTF_8).putChar('\0');
+    for (String predicate : predicates) {
+      hasher.putString(predicate, UTF_8).putChar('\0');
+    }
+    return hasher.hash().toString();
+  }
+
+  private String dump(BooleanFormula pFormula) {
+    return fmgr.dumpFormula(pFormula).toString();
+  }
+
+  /** Return the uninstantiated abstraction stored for the given key, or null if not present. */
+  public @Nullable BooleanFormula get(String pKey) {
+    Path file = getFile(pKey);
+    String content;
+    try {
+      content = Files.readString(file, UTF_8);
+    } catch (NoSuchFileException e) {
+      return null;
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not read persistent abstraction cache");
+      return null;
+    }
+    try {
+      return fmgr.parse(content);
+    } catch (IllegalArgumentException e) {
+      logger.logfDebugException(e, "Ignoring invalid entry %s of abstraction cache", file);
+      return null;
+    }
+  }
+
+  /** Store the given uninstantiated abstraction for the given key. */
+  public void put(String pKey, BooleanFormula pAbstraction) {
+    Path file = getFile(pKey);
+    if (Files.exists(file)) {
+      // content-addressed, so the existing entry is equivalent
+      return;
+    }
+    Path tmpFile = null;
+    try {
+      Files.createDirectories(file.getParent());
+      tmpFile = Files.createTempFile(file.getParent(), pKey, ".tmp");
+      Files.writeString(tmpFile, dump(pAbstraction), UTF_8);
+      try {
+        Files.move(
+            tmpFile, file, StandardCopyOption.ATOMIC_MOVE, StandardCopyOption.REPLACE_EXISTING);
+      } catch (AtomicMoveNotSupportedException e) {
+        Files.move(tmpFile, file, StandardCopyOption.REPLACE_EXISTING);
+      }
+      tmpFile = null;
+    } catch (IOException e) {
+      logger.logUserException(Level.WARNING, e, "Could not write persistent abstraction cache");
+    } finally {
+      if (tmpFile != null) {
+        try {
+          Files.deleteIfExists(tmpFile);
+        } catch (IOException e) {
+          logger.logDebugException(e);
+        }
+      }
+    }
+  }
+
+  private Path getFile(String pKey) {
+    // use subdirectories to avoid too many files in a single directory
+    return directory.resolve(pKey.substring(0, 2)).resolve(pKey + FILE_SUFFIX);
+  }
+}
@@ -35,6 +35,7 @@ import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.cpa.predicate.PredicatePrecision;
 import org.sosy_lab.cpachecker.cpa.predicate.PredicatePrecisionBootstrapper;
 import org.sosy_lab.cpachecker.cpa.predicate.persistence.PredicatePersistenceUtils.PredicateParsingFailedException;
+import org.sosy_lab.cpachecker.util.CFAFingerprints.NodeMapping;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionManager;
 import org.sosy_lab.cpachecker.util.predicates.AbstractionPredicate;
@@ -84,17 +85,36 @@ public class PredicateMapParser {
 
   private final PredicatePrecisionBootstrapper.InitialPredicatesOptions options;
 
+  /** mapping from a previous program version, null if the file is for the current program */
+  private final @Nullable NodeMapping nodeMapping;
+
   public PredicateMapParser(
       CFA pCfa,
       LogManager pLogger,
       FormulaManagerView pFmgr,
       AbstractionManager pAmgr,
       PredicatePrecisionBootstrapper.InitialPredicatesOptions pOptions) {
+    this(pCfa, pLogger, pFmgr, pAmgr, pOptions, null);
+  }
+
+  /**
+   * Create a parser for a file that was written for a previous version of the program. Predicates
+   * for functions that were modified are ignored, and the CFA nodes of the unmodified functions
+   * are mapped to the current CFA with the given mapping.
+   */
+  public PredicateMapParser(
+      CFA pCfa,
+      LogManager pLogger,
+      FormulaManagerView pFmgr,
+      AbstractionManager pAmgr,
+      PredicatePrecisionBootstrapper.InitialPredicatesOptions pOptions,
+      @Nullable NodeMapping pNodeMapping) {
     cfa = pCfa;
     logger = new LogManagerWithoutDuplicates(pLogger);
     fmgr = pFmgr;
     amgr = pAmgr;
     options = pOptions;
+    nodeMapping = pNodeMapping;
   }
 
   /**
@@ -181,6 +201,9 @@ public class PredicateMapParser {
             logger.log(Level.WARNING, "Cannot use predicates for function", currentLine + ", this function does not exist.");
             currentSet = new ArrayList<>(); // temporary list which will be thrown away and ignored
 
+          } else if (isModified(currentLine)) {
+            currentSet = new ArrayList<>(); // temporary list which will be thrown away and ignored
+
           } else {
             currentSet = functionPredicates.get(currentLine);
           }
@@ -197,10 +220,28 @@ public class PredicateMapParser {
               if (!cfa.getAllFunctionNames().contains(function)) {
                 logger.log(Level.WARNING, "Cannot use predicates for function", function + ", this function does not exist.");
                 currentSet = new ArrayList<>(); // temporary list which will be thrown away and ignored
+              } else if (isModified(function)) {
+                currentSet = new ArrayList<>(); // temporary list which will be thrown away and ignored
               } else {
                 currentSet = functionPredicates.get(function);
               }
 
+            } else if (nodeMapping != null) {
+              CFANode node = nodeMapping.getNode(nodeId);
+              if (node == null) {
+                // function was modified or does not exist anymore
+                logger.log(
+                    Level.FINE,
+                    "Ignoring predicates for CFANode",
+                    nodeId,
+                    "of previous program version, function",
+                    function,
+                    "was modified.");
+                currentSet = new ArrayList<>(); // temporary list which will be thrown away and ignored
+              } else {
+                currentSet = localPredicates.get(node);
+              }
+
             } else {
               CFANode node = getCFANodeWithId(nodeId);
               if (node == null) {
@@ -249,6 +290,19 @@ public class PredicateMapParser {
         ImmutableSetMultimap.of(), localPredicates, functionPredicates, globalPredicates);
   }
 
+  /** Check whether the given function was modified since the previous program version. */
+  private boolean isModified(String pFunction) {
+    if (nodeMapping == null || nodeMapping.isUnchanged(pFunction)) {
+      return false;
+    }
+    logger.log(
+        Level.FINE,
+        "Ignoring predicates for function",
+        pFunction,
+        "of previous program version, this function was modified.");
+    return true;
+  }
+
   private @Nullable String convertFormula(final Converter converter, final String line) {
     return FormulaParser.convertFormula(checkNotNull(converter), line, logger);
   }
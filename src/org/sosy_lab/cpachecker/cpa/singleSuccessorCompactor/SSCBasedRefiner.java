@@ -86,7 +86,8 @@ public class SSCBasedRefiner extends AbstractARGBasedRefiner {
         : "targetState must be in mainReachedSet.";
 
     ARGPath shortPath = ARGUtils.getOnePathTo(pLastElement);
-    // info: never access fullPath from shortPath
-    return new SSCPath(sscCpa, pMainReachedSet, shortPath.asStatesList());
+    // info: never access fullPath from shortPath,
+    // the intermediate states of the compacted chains are re-computed on demand.
+    return SSCPath.create(sscCpa, pMainReachedSet, shortPath.asStatesList());
   }
 }
@@ -22,6 +22,7 @@ import java.util.Objects;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.cpa.arg.path.ARGPath;
@@ -30,23 +31,61 @@ import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.CFAUtils;
 
+/**
+ * A path through an ARG whose chains of single successors were compacted by the {@link
+ * SingleSuccessorCompactorCPA}. The states of the path are {@link SSCARGState}s: the states of
+ * the ARG (branching points and abstraction states) are extended with the intermediate states of
+ * each chain, which are re-computed from the stored states when the path is created.
+ */
 public class SSCPath extends ARGPath {
 
   /** the reached-set determines the precision for states. */
-  // TODO if we ever want to use SSCPath for more than "instant reporting",
-  // we might need to extract precisions on SSCPath-creation.
   private final ARGReachedSet reachedSet;
 
-  /** transfer needed to re-compute the missing states of SSC-chains. */
-  private final SingleSuccessorCompactorTransferRelation transfer;
+  private SSCPath(ARGReachedSet pMainReachedSet, ImmutableList<ARGState> pStates) {
+    super(pStates);
+    reachedSet = pMainReachedSet;
+  }
 
-  public SSCPath(
+  /**
+   * Create a path along the given states of the ARG, including all intermediate states of the
+   * compacted chains between them.
+   */
+  public static SSCPath create(
       SingleSuccessorCompactorCPA pSscCpa,
       ARGReachedSet pMainReachedSet,
-      ImmutableList<ARGState> pStates) {
-    super(pStates);
-    reachedSet = pMainReachedSet;
-    transfer = pSscCpa.getTransferRelation();
+      List<ARGState> pStates)
+      throws CPATransferException, InterruptedException {
+    SingleSuccessorCompactorTransferRelation transfer = pSscCpa.getTransferRelation();
+    UnmodifiableReachedSet reached = pMainReachedSet.asReachedSet();
+    ImmutableList.Builder<ARGState> states = ImmutableList.builder();
+
+    Iterator<ARGState> it = pStates.iterator();
+    ARGState prev = it.next();
+    SSCARGState last = new SSCARGState(prev, prev.getWrappedState());
+    states.add(last);
+    while (it.hasNext()) {
+      ARGState succ = it.next();
+      final List<AbstractState> innerStates = new ArrayList<>();
+      @SuppressWarnings("unused") // only inner states are important
+      Collection<? extends AbstractState> successors =
+          transfer.getAbstractSuccessorsWithList(
+              prev.getWrappedState(), reached.getPrecision(prev), reached, innerStates);
+      assert !innerStates.isEmpty();
+
+      // the first inner state is the wrapped state of prev itself.
+      // The intermediate states use the precision of prev, i.e., the start of their chain.
+      for (AbstractState innerState : Iterables.skip(innerStates, 1)) {
+        last = new SSCARGState(prev, innerState, last);
+        states.add(last);
+      }
+
+      // we ignore the new successor states and simply use the previously computed successor.
+      last = new SSCARGState(succ, succ.getWrappedState(), last);
+      states.add(last);
+      prev = succ;
+    }
+    return new SSCPath(pMainReachedSet, states.build());
   }
 
   @Override
@@ -54,7 +93,7 @@ public class SSCPath extends ARGPath {
     List<CFAEdge> newFullPath = new ArrayList<>();
     PathIterator it = pathIterator();
     while (it.hasNext()) {
-      getInnerEdgesFromTo(newFullPath, it.getAbstractState(), it.getNextAbstractState());
+      getEdgesFromTo(newFullPath, it.getAbstractState(), it.getNextAbstractState());
       it.advance();
     }
 
@@ -78,35 +117,6 @@ public class SSCPath extends ARGPath {
     return true;
   }
 
-  /**
-   * unroll SSC-chains, get edges (at least one edge) from parent state to child state.
-   *
-   * @param newFullPath where the resulting edges are added to.
-   */
-  private void getInnerEdgesFromTo(List<CFAEdge> newFullPath, ARGState prev, ARGState succ) {
-    final List<AbstractState> innerStates = new ArrayList<>();
-    try {
-      @SuppressWarnings("unused") // only inner states are important
-      Collection<? extends AbstractState> successors =
-          transfer.getAbstractSuccessorsWithList(
-              prev.getWrappedState(), reachedSet.asReachedSet().getPrecision(prev), innerStates);
-    } catch (CPATransferException | InterruptedException e) {
-      throw new AssertionError("should not happen");
-    }
-    assert !innerStates.isEmpty();
-
-    Iterator<AbstractState> innerIt = innerStates.iterator();
-    AbstractState parent = innerIt.next();
-    while (innerIt.hasNext()) {
-      AbstractState child = innerIt.next();
-      getEdgesFromTo(newFullPath, parent, child);
-      parent = child;
-    }
-
-    // we ignore the new successor states and simply use the previously computed successor.
-    getEdgesFromTo(newFullPath, parent, succ);
-  }
-
   /**
    * unroll multi-edges, get edges (at least one edge) from parent state to child state.
    *
@@ -8,8 +8,10 @@
 
 package org.sosy_lab.cpachecker.cpa.singleSuccessorCompactor;
 
+import com.google.common.base.Function;
 import java.io.PrintStream;
 import java.util.Collection;
+import java.util.Optional;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -20,12 +22,17 @@ import org.sosy_lab.cpachecker.cfa.blocks.BlockPartitioning;
 import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.defaults.AbstractSingleWrapperCPA;
 import org.sosy_lab.cpachecker.core.defaults.AutomaticCPAFactory;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.CPAFactory;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysisWithBAM;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustment;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustmentResult;
 import org.sosy_lab.cpachecker.core.interfaces.Reducer;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.util.statistics.StatHist;
 import org.sosy_lab.cpachecker.util.statistics.StatisticsUtils;
 
@@ -36,6 +43,21 @@ public class SingleSuccessorCompactorCPA extends AbstractSingleWrapperCPA
   @Option(description = "max length of a chain of states, -1 for infinity")
   private int maxChainLength = -1;
 
+  @Option(
+      description =
+          "apply the precision adjustment of the wrapped analysis to each state within a chain,"
+              + " and end the chain at states that are changed by it, e.g., abstraction states"
+              + " of predicate analysis. This keeps only branching points and abstraction states"
+              + " in the ARG and allows to use this CPA also for analyses that rely on their"
+              + " precision adjustment.")
+  private boolean adjustPrecisionInChains = false;
+
+  /**
+   * the reached set that was last given to the precision adjustment, it is used for the
+   * precision adjustment within chains.
+   */
+  @Nullable private UnmodifiableReachedSet lastReachedSet = null;
+
   /** if BAM is used, break chains of edges at block entry and exit. */
   @Nullable private BlockPartitioning partitioning = null;
 
@@ -65,7 +87,42 @@ public class SingleSuccessorCompactorCPA extends AbstractSingleWrapperCPA
   @Override
   public SingleSuccessorCompactorTransferRelation getTransferRelation() {
     return new SingleSuccessorCompactorTransferRelation(
-        getWrappedCpa().getTransferRelation(), partitioning, chainSizes, maxChainLength);
+        getWrappedCpa().getTransferRelation(),
+        partitioning,
+        chainSizes,
+        maxChainLength,
+        adjustPrecisionInChains ? getWrappedCpa().getPrecisionAdjustment() : null,
+        () -> lastReachedSet);
+  }
+
+  @Override
+  public PrecisionAdjustment getPrecisionAdjustment() {
+    final PrecisionAdjustment wrappedPrecisionAdjustment = super.getPrecisionAdjustment();
+    if (!adjustPrecisionInChains) {
+      return wrappedPrecisionAdjustment;
+    }
+    return new PrecisionAdjustment() {
+
+      @Override
+      public Optional<PrecisionAdjustmentResult> prec(
+          AbstractState pState,
+          Precision pPrecision,
+          UnmodifiableReachedSet pStates,
+          Function<AbstractState, AbstractState> pStateProjection,
+          AbstractState pFullState)
+          throws CPAException, InterruptedException {
+        lastReachedSet = pStates;
+        return wrappedPrecisionAdjustment.prec(
+            pState, pPrecision, pStates, pStateProjection, pFullState);
+      }
+
+      @Override
+      public Optional<? extends AbstractState> strengthen(
+          AbstractState pState, Precision pPrecision, Iterable<AbstractState> pOtherStates)
+          throws CPAException, InterruptedException {
+        return wrappedPrecisionAdjustment.strengthen(pState, pPrecision, pOtherStates);
+      }
+    };
   }
 
   @Override
@@ -8,9 +8,15 @@
 
 package org.sosy_lab.cpachecker.cpa.singleSuccessorCompactor;
 
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import com.google.common.base.Functions;
+import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import java.util.Collection;
 import java.util.List;
+import java.util.Optional;
+import java.util.function.Supplier;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.cpachecker.cfa.blocks.BlockPartitioning;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
@@ -18,7 +24,12 @@ import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.defaults.AbstractSingleWrapperTransferRelation;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustment;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustmentResult;
+import org.sosy_lab.cpachecker.core.interfaces.PrecisionAdjustmentResult.Action;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
+import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.statistics.StatHist;
@@ -30,31 +41,47 @@ public class SingleSuccessorCompactorTransferRelation
   private final StatHist chainSizes;
   private final int maxChainLength;
 
+  /** if not null, the precision adjustment is applied to each state of a chain. */
+  @Nullable private final PrecisionAdjustment precisionAdjustment;
+
+  /** provides the reached set of the analysis for the precision adjustment within chains. */
+  private final Supplier<@Nullable UnmodifiableReachedSet> reachedSet;
+
   SingleSuccessorCompactorTransferRelation(
       TransferRelation pDelegate,
       BlockPartitioning pPartitioning,
       StatHist pChainSizes,
-      int pMaxChainLength) {
+      int pMaxChainLength,
+      @Nullable PrecisionAdjustment pPrecisionAdjustment,
+      Supplier<@Nullable UnmodifiableReachedSet> pReachedSet) {
     super(pDelegate);
     partitioning = pPartitioning;
     chainSizes = pChainSizes;
     maxChainLength = pMaxChainLength;
+    precisionAdjustment = pPrecisionAdjustment;
+    reachedSet = pReachedSet;
   }
 
   @Override
   public Collection<? extends AbstractState> getAbstractSuccessors(
       final AbstractState state, final Precision precision)
       throws CPATransferException, InterruptedException {
-    return getAbstractSuccessorsWithList(state, precision, null);
+    return getAbstractSuccessorsWithList(state, precision, reachedSet.get(), null);
   }
 
   /**
    * Computes successors and optionally adds all intermediate states to the given list. The list
    * includes the first state (given as parameter) until (exclusive) the last states that are
    * returned directly.
+   *
+   * @param pReached the reached set for applying the precision adjustment within chains, if
+   *     null, no chain is built when the precision adjustment needs to be applied.
    */
   Collection<? extends AbstractState> getAbstractSuccessorsWithList(
-      AbstractState state, final Precision precision, final @Nullable List<AbstractState> lst)
+      AbstractState state,
+      final Precision precision,
+      final @Nullable UnmodifiableReachedSet pReached,
+      final @Nullable List<AbstractState> lst)
       throws CPATransferException, InterruptedException {
 
     // this is the main core of this CPA:
@@ -62,18 +89,52 @@ public class SingleSuccessorCompactorTransferRelation
 
     Collection<? extends AbstractState> states;
     int chainSize = 0;
+    boolean isChainEnd = false;
     do {
       chainSize++;
       if (lst != null) {
         lst.add(state);
       }
       states = transferRelation.getAbstractSuccessors(state, precision);
+      if (precisionAdjustment != null && states.size() == 1) {
+        AbstractState successor = Iterables.getOnlyElement(states);
+        if (pReached == null) {
+          isChainEnd = true;
+        } else {
+          Optional<PrecisionAdjustmentResult> result =
+              adjustPrecision(successor, precision, pReached);
+          if (!result.isPresent()) {
+            states = ImmutableSet.of();
+          } else if (result.orElseThrow().action() == Action.BREAK
+              || result.orElseThrow().precision() != precision) {
+            // the analysis applies the precision adjustment to this state again
+            isChainEnd = true;
+          } else if (result.orElseThrow().abstractState() != successor) {
+            // this is an abstraction state, which needs to be part of the ARG
+            states = ImmutableSet.of(result.orElseThrow().abstractState());
+            isChainEnd = true;
+          }
+        }
+      }
       state = Iterables.getFirst(states, null);
-    } while (canExpandChain(state, states, chainSize));
+    } while (!isChainEnd && canExpandChain(state, states, chainSize));
     chainSizes.insertValue(chainSize);
     return states;
   }
 
+  private Optional<PrecisionAdjustmentResult> adjustPrecision(
+      AbstractState pState, Precision pPrecision, UnmodifiableReachedSet pReached)
+      throws CPATransferException, InterruptedException {
+    try {
+      return checkNotNull(precisionAdjustment)
+          .prec(pState, pPrecision, pReached, Functions.identity(), pState);
+    } catch (CPATransferException e) {
+      throw e;
+    } catch (CPAException e) {
+      throw new CPATransferException("Precision adjustment within chain failed", e);
+    }
+  }
+
   private boolean canExpandChain(
       AbstractState state, Collection<? extends AbstractState> states, int chainSize) {
     return states.size() == 1
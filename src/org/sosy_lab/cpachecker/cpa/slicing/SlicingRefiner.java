@@ -10,14 +10,18 @@ package org.sosy_lab.cpachecker.cpa.slicing;
 
 import static com.google.common.collect.FluentIterable.from;
 
+import com.google.common.base.Predicate;
 import com.google.common.base.Predicates;
+import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import com.google.common.collect.Sets;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.HashSet;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Set;
 import org.sosy_lab.common.configuration.ClassOption;
 import org.sosy_lab.common.configuration.Configuration;
@@ -505,13 +509,15 @@ public class SlicingRefiner implements Refiner, StatisticsProvider {
   private void updatePrecision(
       final ARGReachedSet argReached, final RefinedSlicingPrecision refRootsAndPrecision)
       throws InterruptedException {
+    Map<ARGState, List<Precision>> refinementRoots = new LinkedHashMap<>();
     for (StateSlicingPrecision prec : refRootsAndPrecision.getStatePrecisions()) {
-      ARGState state = prec.getState();
-      if (!state.isDestroyed()) {
-        argReached.removeSubtree(
-            state, prec.getPrecision(), Predicates.instanceOf(SlicingPrecision.class));
-      }
+      refinementRoots.putIfAbsent(
+          prec.getState(), ImmutableList.<Precision>of(prec.getPrecision()));
     }
+    argReached.removeSubtrees(
+        refinementRoots,
+        ImmutableList.<Predicate<? super Precision>>of(
+            Predicates.instanceOf(SlicingPrecision.class)));
   }
 
   private ARGState getRefinementRoot(final ARGPath pPath, final Collection<CFAEdge> relevantEdges) {
@@ -9,12 +9,16 @@
 package org.sosy_lab.cpachecker.cpa.smg;
 
 import com.google.common.annotations.VisibleForTesting;
+import com.google.common.base.Throwables;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import java.util.Collections;
 import java.util.Comparator;
 import java.util.List;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinTask;
 import java.util.logging.Level;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.CLangSMG;
@@ -30,6 +34,7 @@ public class SMGAbstractionManager {
   private final Set<SMGAbstractionBlock> blocks;
   private final SMGDoublyLinkedListFinder dllCandidateFinder;
   private final SMGSingleLinkedListFinder sllCandidateFinder;
+  private final boolean parallelSearch;
 
   @VisibleForTesting
   public SMGAbstractionManager(LogManager pLogger, CLangSMG pSMG, SMGState pSMGstate) {
@@ -39,25 +44,64 @@ public class SMGAbstractionManager {
     blocks = ImmutableSet.of();
     dllCandidateFinder = new SMGDoublyLinkedListFinder();
     sllCandidateFinder = new SMGSingleLinkedListFinder();
+    parallelSearch = false;
   }
 
+  /**
+   * Create a manager for the abstraction of the given SMG.
+   *
+   * @param pParallelSearch whether the search for candidates of doubly and singly linked lists is
+   *     done in parallel. The search only reads the SMG, so both finders are independent.
+   */
   public SMGAbstractionManager(LogManager pLogger, CLangSMG pSMG, SMGState pSMGstate,
-      Set<SMGAbstractionBlock> pBlocks, int equalSeq, int entailSeq, int incSeq) {
+      Set<SMGAbstractionBlock> pBlocks, int equalSeq, int entailSeq, int incSeq,
+      boolean pParallelSearch) {
     smg = pSMG;
     smgState = pSMGstate;
     logger = pLogger;
     blocks = pBlocks;
     dllCandidateFinder = new SMGDoublyLinkedListFinder(equalSeq, entailSeq, incSeq);
     sllCandidateFinder = new SMGSingleLinkedListFinder(equalSeq, entailSeq, incSeq);
+    parallelSearch = pParallelSearch;
   }
 
   private List<SMGAbstractionCandidate> getCandidates() throws SMGInconsistentException {
+    if (parallelSearch) {
+      return getCandidatesInParallel();
+    }
     return ImmutableList.<SMGAbstractionCandidate>builder()
         .addAll(dllCandidateFinder.traverse(smg, smgState, blocks))
         .addAll(sllCandidateFinder.traverse(smg, smgState, blocks))
         .build();
   }
 
+  private List<SMGAbstractionCandidate> getCandidatesInParallel()
+      throws SMGInconsistentException {
+    ForkJoinTask<Set<SMGAbstractionCandidate>> dllCandidates =
+        ForkJoinPool.commonPool().submit(() -> dllCandidateFinder.traverse(smg, smgState, blocks));
+    Set<SMGAbstractionCandidate> sllCandidates;
+    try {
+      sllCandidates = sllCandidateFinder.traverse(smg, smgState, blocks);
+    } finally {
+      // the SMG must not be modified while the other search is still running
+      dllCandidates.quietlyJoin();
+    }
+    try {
+      return ImmutableList.<SMGAbstractionCandidate>builder()
+          .addAll(dllCandidates.get())
+          .addAll(sllCandidates)
+          .build();
+    } catch (ExecutionException e) {
+      Throwables.throwIfInstanceOf(e.getCause(), SMGInconsistentException.class);
+      Throwables.throwIfUnchecked(e.getCause());
+      throw new AssertionError(e);
+    } catch (InterruptedException e) {
+      // cannot happen, the task is already finished
+      Thread.currentThread().interrupt();
+      throw new AssertionError(e);
+    }
+  }
+
   private SMGAbstractionCandidate getBestCandidate(
       List<SMGAbstractionCandidate> abstractionCandidates) {
     return Collections.max(
@@ -10,6 +10,7 @@ package org.sosy_lab.cpachecker.cpa.smg;
 
 import static com.google.common.truth.Truth.assertThat;
 
+import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import org.junit.Before;
 import org.junit.Test;
@@ -88,4 +89,19 @@ public class SMGAbstractionManagerTest {
     SMGObject segment = pt.getObject();
     assertThat(segment.isAbstract()).isTrue();
   }
+
+  @Test
+  public void testExecuteWithParallelSearch()
+      throws SMGInconsistentException, InvalidConfigurationException {
+    SMGState dummyState = new SMGState(LogManager.createTestLogManager(), MachineModel.LINUX32, new SMGOptions(Configuration.defaultConfiguration()));
+    SMGAbstractionManager manager =
+        new SMGAbstractionManager(
+            LogManager.createTestLogManager(), smg, dummyState, ImmutableSet.of(), 2, 2, 2, true);
+    manager.execute();
+
+    SMGRegion globalVar = smg.getObjectForVisibleVariable("pointer");
+    SMGEdgeHasValue hv =
+        Iterables.getOnlyElement(smg.getHVEdges(SMGEdgeHasValueFilter.objectFilter(globalVar)));
+    assertThat(smg.getPointer(hv.getValue()).getObject().isAbstract()).isTrue();
+  }
 }
@@ -153,6 +153,12 @@ public class SMGOptions {
       description = "with this option enabled, heap abstraction will be enabled.")
   private boolean enableHeapAbstraction = false;
 
+  @Option(
+      secure = true,
+      description =
+          "search for abstraction candidates of doubly and singly linked lists in parallel")
+  private boolean parallelAbstractionSearch = false;
+
   @Option(
       secure = true,
       name = "memoryErrors",
@@ -293,6 +299,10 @@ public class SMGOptions {
     return enableHeapAbstraction;
   }
 
+  public boolean isParallelAbstractionSearchEnabled() {
+    return parallelAbstractionSearch;
+  }
+
   public boolean isMemoryErrorTarget() {
     return memoryErrors;
   }
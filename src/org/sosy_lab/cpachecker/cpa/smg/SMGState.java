@@ -98,8 +98,12 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
   private final int predecessorId;
   private final int id;
 
-  private final BiMap<SMGKnownSymbolicValue, SMGKnownExpValue> explicitValues =
-      HashBiMap.create(ImmutableMap.of(SMGZeroValue.INSTANCE, SMGZeroValue.INSTANCE));
+  /**
+   * Copies of a state share the map of explicit values until one of them modifies it, use {@link
+   * #getModifiableExplicitValues()} for all modifications.
+   */
+  private BiMap<SMGKnownSymbolicValue, SMGKnownExpValue> explicitValues;
+  private boolean explicitValuesShared = false;
   private final CLangSMG heap;
 
   private final boolean blockEnded;
@@ -128,13 +132,7 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
   @Override
   public SMGState withErrorDescription(String pErrorDescription) {
     return new SMGState(
-        logger,
-        options,
-        heap.copyOf(),
-        id,
-        explicitValues,
-        errorInfo.withErrorMessage(pErrorDescription),
-        blockEnded);
+        this, heap.copyOf(), id, errorInfo.withErrorMessage(pErrorDescription), blockEnded);
   }
 
   /**
@@ -179,6 +177,8 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
     id = ID_COUNTER.getFreshId();
     Preconditions.checkArgument(!pExplicitValues.containsKey(null));
     Preconditions.checkArgument(!pExplicitValues.containsValue(null));
+    explicitValues =
+        HashBiMap.create(ImmutableMap.of(SMGZeroValue.INSTANCE, SMGZeroValue.INSTANCE));
     explicitValues.putAll(pExplicitValues);
     errorInfo = pErrorInfo;
     blockEnded = pBlockEnded;
@@ -186,21 +186,38 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
         heap.getMachineModel().getSizeofInBits(CPointerType.POINTER_TO_VOID).longValueExact();
   }
 
-  private SMGState(SMGState pOriginalState, Property pProperty) {
-    heap = pOriginalState.heap.copyOf();
+  /** Copy constructor that shares the explicit values with the original state. */
+  private SMGState(
+      SMGState pOriginalState,
+      CLangSMG pHeap,
+      int pPredId,
+      SMGErrorInfo pErrorInfo,
+      boolean pBlockEnded) {
+    heap = pHeap;
     logger = pOriginalState.logger;
     options = pOriginalState.options;
-    predecessorId = pOriginalState.getId();
+    predecessorId = pPredId;
     id = ID_COUNTER.getFreshId();
-    explicitValues.putAll(pOriginalState.explicitValues);
-    blockEnded = pOriginalState.blockEnded;
-    errorInfo = pOriginalState.errorInfo.withProperty(pProperty);
+    explicitValues = pOriginalState.explicitValues;
+    explicitValuesShared = true;
+    pOriginalState.explicitValuesShared = true;
+    blockEnded = pBlockEnded;
+    errorInfo = pErrorInfo;
     sizeOfVoidPointerInBits = pOriginalState.sizeOfVoidPointerInBits;
   }
 
+  private SMGState(SMGState pOriginalState, Property pProperty) {
+    this(
+        pOriginalState,
+        pOriginalState.heap.copyOf(),
+        pOriginalState.getId(),
+        pOriginalState.errorInfo.withProperty(pProperty),
+        pOriginalState.blockEnded);
+  }
+
   @Override
   public SMGState copyOf() {
-    return new SMGState(logger, options, heap.copyOf(), id, explicitValues, errorInfo, blockEnded);
+    return new SMGState(this, heap.copyOf(), id, errorInfo, blockEnded);
   }
 
   @Override
@@ -210,7 +227,7 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
 
   @Override
   public SMGState copyWithBlockEnd(boolean isBlockEnd) {
-    return new SMGState(logger, options, heap.copyOf(), id, explicitValues, errorInfo, isBlockEnd);
+    return new SMGState(this, heap.copyOf(), id, errorInfo, isBlockEnd);
   }
 
   @Override
@@ -218,9 +235,8 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
     if (errorInfo.equals(pOther.errorInfo)) {
       return this;
     }
-    SMGState result = new SMGState(logger, options, heap, ID_COUNTER.getFreshId(), explicitValues);
-    result.errorInfo = result.errorInfo.mergeWith(pOther.errorInfo);
-    return result;
+    return new SMGState(
+        this, heap, ID_COUNTER.getFreshId(), SMGErrorInfo.of().mergeWith(pOther.errorInfo), false);
   }
 
   /**
@@ -1442,6 +1458,11 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
     }
 
     if (options.isHeapAbstractionEnabled()) {
+      // cheap pre-filter, the join would be incomparable anyway
+      if (!SMGIsLessOrEqual.haveSameStackFunctions(heap, reachedState.getHeap())) {
+        return false;
+      }
+
       SMGJoin join = new SMGJoin(heap, reachedState.getHeap(), this, reachedState);
 
       if (!join.isDefined()) {
@@ -1877,9 +1898,9 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
 
     heap.replaceValue(pKnownVal1, pKnownVal2);
     Preconditions.checkArgument(!pKnownVal2.isZero());
-    SMGKnownExpValue expVal = explicitValues.remove(pKnownVal2);
-    if (expVal != null) {
-      explicitValues.put(pKnownVal1, expVal);
+    if (explicitValues.containsKey(pKnownVal2)) {
+      BiMap<SMGKnownSymbolicValue, SMGKnownExpValue> values = getModifiableExplicitValues();
+      values.put(pKnownVal1, values.remove(pKnownVal2));
     }
   }
 
@@ -1908,7 +1929,7 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
     }
       logger.logf(
           Level.FINER, "SymValue1 %s %s SymValue2 %s AddPredicate: %s", pV1, temp, pV2, pEdge);
-      getPathPredicateRelation().addRelation(pV1, pSMGType1, pV2, pSMGType2, temp);
+      heap.getModifiablePathPredicateRelation().addRelation(pV1, pSMGType1, pV2, pSMGType2, temp);
   }
 }
 
@@ -1923,7 +1944,7 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
       }
       logger.logf(
           Level.FINER, "SymValue %s %s; ExplValue %s; AddPredicate: %s", pV1, temp, pV2, pEdge);
-      getPathPredicateRelation().addExplicitRelation(pV1, pSMGType1, pV2, temp);
+      heap.getModifiablePathPredicateRelation().addExplicitRelation(pV1, pSMGType1, pV2, temp);
     }
   }
 
@@ -1941,7 +1962,7 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
       logger.log(Level.FINER, "Add Error Predicate: SymValue  ",
           pSymbolicValue, " ; ExplValue", " ",
           pExplicitValue, "; on edge: ", pEdge);
-      getErrorPredicateRelation()
+      heap.getModifiableErrorPredicateRelation()
           .addExplicitRelation(
               pSymbolicValue, pSymbolicSMGType, pExplicitValue, BinaryOperator.GREATER_THAN);
     }
@@ -1976,9 +1997,9 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
           heap.replaceValue(symValue, pKey);
         } else {
           Preconditions.checkArgument(!symValue.isZero());
-          explicitValues.remove(symValue);
+          getModifiableExplicitValues().remove(symValue);
           heap.replaceValue(pKey, symValue);
-          explicitValues.put(pKey, pValue);
+          getModifiableExplicitValues().put(pKey, pValue);
           return symValue;
         }
       }
@@ -1986,14 +2007,22 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
       return null;
     }
 
-    explicitValues.put(pKey, pValue);
+    getModifiableExplicitValues().put(pKey, pValue);
     return null;
   }
 
+  private BiMap<SMGKnownSymbolicValue, SMGKnownExpValue> getModifiableExplicitValues() {
+    if (explicitValuesShared) {
+      explicitValues = HashBiMap.create(explicitValues);
+      explicitValuesShared = false;
+    }
+    return explicitValues;
+  }
+
   @Deprecated // unused
   public void clearExplicit(SMGKnownSymbolicValue pKey) {
     Preconditions.checkArgument(!pKey.isZero());
-    explicitValues.remove(pKey);
+    getModifiableExplicitValues().remove(pKey);
   }
 
   @Override
@@ -2088,9 +2117,11 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
     final SMGAbstractionManager manager;
     boolean usesHeapInterpolation = true; // TODO do we need this flag?
     if (usesHeapInterpolation) {
-      manager = new SMGAbstractionManager(logger, heap, this, blocks, 2, 2, 2);
+      manager = new SMGAbstractionManager(
+              logger, heap, this, blocks, 2, 2, 2, options.isParallelAbstractionSearchEnabled());
     } else {
-      manager = new SMGAbstractionManager(logger, heap, this, blocks, 2, 2, 3);
+      manager = new SMGAbstractionManager(
+              logger, heap, this, blocks, 2, 2, 3, options.isParallelAbstractionSearchEnabled());
     }
     boolean change = manager.execute();
     performConsistencyCheck(SMGRuntimeCheck.HALF);
@@ -2115,7 +2146,9 @@ public class SMGState implements UnmodifiableSMGState, AbstractQueryableState, G
 
   public SMGAbstractionCandidate executeHeapAbstractionOneStep(Set<SMGAbstractionBlock> pResult)
       throws SMGInconsistentException {
-    SMGAbstractionManager manager = new SMGAbstractionManager(logger, heap, this, pResult, 2, 2, 2);
+    SMGAbstractionManager manager =
+        new SMGAbstractionManager(
+            logger, heap, this, pResult, 2, 2, 2, options.isParallelAbstractionSearchEnabled());
     SMGAbstractionCandidate result = manager.executeOneStep();
     performConsistencyCheck(SMGRuntimeCheck.HALF);
     return result;
@@ -31,6 +31,9 @@ class CSizeOfVisitor extends BaseSizeofVisitor {
   private final Optional<CExpression> expression;
   private final SMGExpressionEvaluator eval;
 
+  /** Whether the computed size depends on the state, i.e., on the length of a variable array. */
+  private boolean dependsOnState = false;
+
   public CSizeOfVisitor(SMGExpressionEvaluator pSmgExpressionEvaluator, CFAEdge pEdge,
       SMGState pState, Optional<CExpression> pExpression) {
     super(pSmgExpressionEvaluator.machineModel);
@@ -60,6 +63,7 @@ class CSizeOfVisitor extends BaseSizeofVisitor {
     } else if (arrayLength instanceof CIntegerLiteralExpression) {
       length = ((CIntegerLiteralExpression) arrayLength).getValue();
     } else if (edge instanceof CDeclarationEdge) {
+      dependsOnState = true;
 
       /* If we currently declare the array of this type,
        * we simply need to calculate the current length of the array
@@ -81,6 +85,7 @@ class CSizeOfVisitor extends BaseSizeofVisitor {
       }
 
     } else {
+      dependsOnState = true;
 
       /*
        * If we are not at the declaration of the variable array type, we try to get the
@@ -118,6 +123,14 @@ class CSizeOfVisitor extends BaseSizeofVisitor {
     return length.multiply(sizeOfType);
   }
 
+  /**
+   * Returns whether the sizes computed so far depend on the state, otherwise they depend only on
+   * the types and the machine model.
+   */
+  boolean dependsOnState() {
+    return dependsOnState;
+  }
+
   BigInteger handleUnkownArrayLengthValue(CArrayType pArrayType) {
     throw new IllegalArgumentException(
         "Can't calculate array length of type " + pArrayType.toASTString("") + ".");
@@ -14,7 +14,9 @@ import com.google.common.collect.ImmutableList;
 import java.math.BigInteger;
 import java.util.ArrayList;
 import java.util.List;
+import java.util.Map;
 import java.util.Optional;
+import java.util.concurrent.ConcurrentHashMap;
 import java.util.logging.Level;
 import org.sosy_lab.common.log.LogManagerWithoutDuplicates;
 import org.sosy_lab.cpachecker.cfa.ast.c.CArraySubscriptExpression;
@@ -62,6 +64,7 @@ import org.sosy_lab.cpachecker.cpa.smg.graphs.value.SMGZeroValue;
 import org.sosy_lab.cpachecker.cpa.value.type.Value;
 import org.sosy_lab.cpachecker.exceptions.CPATransferException;
 import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
+import org.sosy_lab.cpachecker.util.Pair;
 
 /**
  * This class evaluates expressions using {@link SMGState}.
@@ -74,6 +77,15 @@ public class SMGExpressionEvaluator {
   final LogManagerWithoutDuplicates logger;
   final MachineModel machineModel;
 
+  /**
+   * Memo tables for results that depend only on types and the machine model. Sizes of variable
+   * length arrays depend on the state and are never stored.
+   */
+  private final Map<CType, Integer> bitSizeofCache = new ConcurrentHashMap<>();
+
+  private final Map<Pair<CCompositeType, String>, SMGField> fieldCache =
+      new ConcurrentHashMap<>();
+
   public SMGExpressionEvaluator(LogManagerWithoutDuplicates pLogger, MachineModel pMachineModel) {
     logger = pLogger;
     machineModel = pMachineModel;
@@ -131,13 +143,23 @@ public class SMGExpressionEvaluator {
       return ((CBitFieldType) pType).getBitFieldSize();
     }
 
+    Integer cachedSize = bitSizeofCache.get(pType);
+    if (cachedSize != null) {
+      return cachedSize;
+    }
+
     CSizeOfVisitor v = getSizeOfVisitor(edge, pState, pExpression);
 
     try {
-      return pType
-          .accept(v)
-          .multiply(BigInteger.valueOf(machineModel.getSizeofCharInBits()))
-          .intValueExact();
+      int size =
+          pType
+              .accept(v)
+              .multiply(BigInteger.valueOf(machineModel.getSizeofCharInBits()))
+              .intValueExact();
+      if (!v.dependsOnState()) {
+        bitSizeofCache.put(pType, size);
+      }
+      return size;
     } catch (IllegalArgumentException e) {
       logger.logDebugException(e);
       throw new UnrecognizedCodeException("Could not resolve type.", edge);
@@ -246,6 +268,11 @@ public class SMGExpressionEvaluator {
   }
 
   private SMGField getField(CCompositeType pOwnerType, String pFieldName) {
+    return fieldCache.computeIfAbsent(
+        Pair.of(pOwnerType, pFieldName), key -> computeField(pOwnerType, pFieldName));
+  }
+
+  private SMGField computeField(CCompositeType pOwnerType, String pFieldName) {
     CType resultType = pOwnerType;
 
     BigInteger offset = machineModel.getFieldOffsetInBits(pOwnerType, pFieldName);
@@ -61,6 +61,12 @@ public class CLangSMG extends SMG implements UnmodifiableCLangSMG {
    */
   private PersistentSet<SMGObject> heap_objects;
 
+  /**
+   * Sum of the ids of {@link #heap_objects}, maintained incrementally. SMGs with a
+   * different fingerprint can not have the same heap objects.
+   */
+  private int heapObjectsFingerprint;
+
   /**
    * A container for global objects
    */
@@ -99,6 +105,7 @@ public class CLangSMG extends SMG implements UnmodifiableCLangSMG {
     global_objects = PathCopyingPersistentTreeMap.of();
     heap_objects = PersistentSet.of();
     heap_objects = heap_objects.addAndCopy(SMGNullObject.INSTANCE);
+    heapObjectsFingerprint = SMGNullObject.INSTANCE.getId();
   }
 
   /**
@@ -113,6 +120,7 @@ public class CLangSMG extends SMG implements UnmodifiableCLangSMG {
 
     stack_objects = pHeap.stack_objects;
     heap_objects = pHeap.heap_objects;
+    heapObjectsFingerprint = pHeap.heapObjectsFingerprint;
     global_objects = pHeap.global_objects;
   }
 
@@ -135,6 +143,9 @@ public class CLangSMG extends SMG implements UnmodifiableCLangSMG {
     if (CLangSMG.performChecks() && heap_objects.contains(pObject)) {
       throw new IllegalArgumentException("Heap object already in the SMG: [" + pObject + "]");
     }
+    if (!heap_objects.contains(pObject)) {
+      heapObjectsFingerprint += pObject.getId();
+    }
     heap_objects = heap_objects.addAndCopy(pObject);
     addObject(pObject);
   }
@@ -414,6 +425,11 @@ public class CLangSMG extends SMG implements UnmodifiableCLangSMG {
     return heap_objects;
   }
 
+  @Override
+  public int getHeapObjectsFingerprint() {
+    return heapObjectsFingerprint;
+  }
+
   /**
    * Constant.
    *
@@ -459,6 +475,9 @@ public class CLangSMG extends SMG implements UnmodifiableCLangSMG {
   }
 
   public final void markHeapObjectDeletedAndRemoveEdges(SMGObject pObject) {
+    if (heap_objects.contains(pObject)) {
+      heapObjectsFingerprint -= pObject.getId();
+    }
     heap_objects = heap_objects.removeAndCopy(pObject);
     markObjectDeletedAndRemoveEdges(pObject);
   }
@@ -622,6 +641,7 @@ public class CLangSMG extends SMG implements UnmodifiableCLangSMG {
 
     /*May not remove null object.*/
     heap_objects = heap_objects.addAndCopy(SMGNullObject.INSTANCE);
+    heapObjectsFingerprint = SMGNullObject.INSTANCE.getId();
   }
 
   public void removeGlobalVariableAndEdges(String pVariable) {
@@ -123,6 +123,23 @@ public class CLangSMGTest {
     assertThat(heap_objs).hasSize(3);
   }
 
+  @Test
+  public void CLangSMGheapObjectsFingerprintTest() {
+    CLangSMG smg = getNewCLangSMG64();
+    int emptyFingerprint = smg.getHeapObjectsFingerprint();
+    SMGRegion obj = new SMGRegion(64, "label");
+
+    smg.addHeapObject(obj);
+    CLangSMG copy = smg.copyOf();
+    assertThat(copy.getHeapObjectsFingerprint()).isEqualTo(smg.getHeapObjectsFingerprint());
+
+    copy.markHeapObjectDeletedAndRemoveEdges(obj);
+    assertThat(copy.getHeapObjectsFingerprint()).isEqualTo(emptyFingerprint);
+
+    smg.clearObjects();
+    assertThat(smg.getHeapObjectsFingerprint()).isEqualTo(emptyFingerprint);
+  }
+
   @Test(expected=IllegalArgumentException.class)
   public void CLangSMGaddHeapObjectTwiceTest() {
     CLangSMG smg = getNewCLangSMG64();
@@ -49,8 +49,14 @@ public class SMG implements UnmodifiableSMG {
   private NeqRelation neq = new NeqRelation();
   private PersistentMultimap<SMGObject, SMGObject> possibleEquals;
 
-  private final SMGPredicateRelation pathPredicate = new SMGPredicateRelation();
+  /**
+   * The predicate relations are mutable, so copies of an SMG share them until one side modifies
+   * them. A shared relation is copied before the first modification (copy-on-write).
+   */
+  private SMGPredicateRelation pathPredicate = new SMGPredicateRelation();
   private SMGPredicateRelation errorPredicate = new SMGPredicateRelation();
+  private boolean pathPredicateShared = false;
+  private boolean errorPredicateShared = false;
 
   private final MachineModel machine_model;
 
@@ -90,8 +96,12 @@ public class SMG implements UnmodifiableSMG {
     hv_edges = pHeap.hv_edges;
     pt_edges = pHeap.pt_edges;
     neq = pHeap.neq;
-    pathPredicate.putAll(pHeap.pathPredicate);
-    errorPredicate.putAll(pHeap.errorPredicate);
+    pathPredicate = pHeap.pathPredicate;
+    errorPredicate = pHeap.errorPredicate;
+    pathPredicateShared = true;
+    errorPredicateShared = true;
+    pHeap.pathPredicateShared = true;
+    pHeap.errorPredicateShared = true;
     validObjects = pHeap.validObjects;
     externalObjectAllocation = pHeap.externalObjectAllocation;
     objects = pHeap.objects;
@@ -159,8 +169,12 @@ public class SMG implements UnmodifiableSMG {
     Preconditions.checkArgument(!pValue.isZero(), "Can not remove NULL from SMG");
     values = values.removeAndCopy(pValue);
     neq = neq.removeValueAndCopy(pValue);
-    pathPredicate.removeValue(pValue);
-    errorPredicate.removeValue(pValue);
+    if (pathPredicate.containsValue(pValue)) {
+      getModifiablePathPredicateRelation().removeValue(pValue);
+    }
+    if (errorPredicate.containsValue(pValue)) {
+      getModifiableErrorPredicateRelation().removeValue(pValue);
+    }
     assert hv_edges.filter(SMGEdgeHasValueFilter.valueFilter(pValue)).isEmpty();
   }
   /**
@@ -332,8 +346,31 @@ public class SMG implements UnmodifiableSMG {
     return errorPredicate;
   }
 
+  /** Returns the path predicate relation of this SMG for modification. */
+  public SMGPredicateRelation getModifiablePathPredicateRelation() {
+    if (pathPredicateShared) {
+      SMGPredicateRelation copy = new SMGPredicateRelation();
+      copy.putAll(pathPredicate);
+      pathPredicate = copy;
+      pathPredicateShared = false;
+    }
+    return pathPredicate;
+  }
+
+  /** Returns the error predicate relation of this SMG for modification. */
+  public SMGPredicateRelation getModifiableErrorPredicateRelation() {
+    if (errorPredicateShared) {
+      SMGPredicateRelation copy = new SMGPredicateRelation();
+      copy.putAll(errorPredicate);
+      errorPredicate = copy;
+      errorPredicateShared = false;
+    }
+    return errorPredicate;
+  }
+
   public void resetErrorRelation() {
     errorPredicate = new SMGPredicateRelation();
+    errorPredicateShared = false;
   }
 
   /* ********************************************* */
@@ -550,8 +587,12 @@ public class SMG implements UnmodifiableSMG {
     addValue(fresh);
 
     neq = neq.replaceValueAndCopy(fresh, old);
-    pathPredicate.replace(fresh, old);
-    errorPredicate.replace(fresh, old);
+    if (pathPredicate.containsValue(old)) {
+      getModifiablePathPredicateRelation().replace(fresh, old);
+    }
+    if (errorPredicate.containsValue(old)) {
+      getModifiableErrorPredicateRelation().replace(fresh, old);
+    }
 
     for (SMGEdgeHasValue old_hve : getHVEdges(SMGEdgeHasValueFilter.valueFilter(old))) {
       SMGEdgeHasValue newHvEdge =
@@ -601,7 +642,8 @@ public class SMG implements UnmodifiableSMG {
     hv_edges = new SMGHasValueEdgeSet();
     pt_edges = new SMGPointsToMap();
     neq = new NeqRelation();
-    pathPredicate.clear();
+    pathPredicate = new SMGPredicateRelation();
+    pathPredicateShared = false;
     initializeNullAddress();
   }
 
@@ -23,11 +23,18 @@ import org.sosy_lab.cpachecker.cpa.smg.graphs.edge.SMGEdgeHasValueFilter;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.object.SMGObject;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.value.SMGValue;
 
+/**
+ * Persistent implementation of {@link SMGHasValueEdges}. The edges of each object are stored in a
+ * separate persistent map, which is shared between all copies of the set that did not modify the
+ * edges of this object. Comparing the edges of such an object is therefore possible in constant
+ * time by comparing the maps by identity.
+ */
 public class SMGHasValueEdgeSet implements SMGHasValueEdges {
 
   private final PersistentSortedMap<SMGObject, PersistentSortedMap<Long, SMGEdgeHasValue>> map;
   private final PersistentSortedMap<SMGObject, Integer> sizesMap;
   private int size = 0;
+  private int hashCode = 0; // lazily computed, 0 if not yet computed
 
   public SMGHasValueEdgeSet() {
     map = PathCopyingPersistentTreeMap.of();
@@ -353,18 +360,49 @@ public class SMGHasValueEdgeSet implements SMGHasValueEdges {
     return size == 0;
   }
 
+  /**
+   * Check whether the given set contains the same edges for the given object. This is a constant
+   * time check if the edges of the object are shared between both sets.
+   */
+  public boolean hasSameEdgesForObject(SMGObject pObject, SMGHasValueEdgeSet pOther) {
+    PersistentSortedMap<Long, SMGEdgeHasValue> edges = map.get(pObject);
+    PersistentSortedMap<Long, SMGEdgeHasValue> otherEdges = pOther.map.get(pObject);
+    return edges == otherEdges || (edges != null && edges.equals(otherEdges));
+  }
+
   @Override
   public int hashCode() {
-    return map.hashCode();
+    int result = hashCode;
+    if (result == 0) {
+      result = map.hashCode();
+      hashCode = result;
+    }
+    return result;
   }
 
   @Override
   public boolean equals(Object pObj) {
-    if (pObj instanceof SMGHasValueEdgeSet) {
-      SMGHasValueEdgeSet other = (SMGHasValueEdgeSet) pObj;
-      return map.equals(other.map);
+    if (this == pObj) {
+      return true;
+    }
+    if (!(pObj instanceof SMGHasValueEdgeSet)) {
+      return false;
+    }
+    SMGHasValueEdgeSet other = (SMGHasValueEdgeSet) pObj;
+    if (map == other.map) {
+      return true;
+    }
+    if (size != other.size
+        || (hashCode != 0 && other.hashCode != 0 && hashCode != other.hashCode)) {
+      return false;
+    }
+    // with the same number of edges, the other set can not contain edges for other objects
+    for (SMGObject object : map.keySet()) {
+      if (!hasSameEdgesForObject(object, other)) {
+        return false;
+      }
     }
-    return false;
+    return true;
   }
 
   @Override
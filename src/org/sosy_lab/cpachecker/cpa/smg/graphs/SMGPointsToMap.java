@@ -16,6 +16,10 @@ import org.sosy_lab.cpachecker.cpa.smg.graphs.edge.SMGEdgePointsToFilter;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.object.SMGObject;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.value.SMGValue;
 
+/**
+ * Persistent implementation of {@link SMGPointsToEdges}. Modifications that do not change the
+ * edges return the same instance, such that copies of an SMG keep sharing it.
+ */
 public class SMGPointsToMap implements SMGPointsToEdges {
 
   private final PersistentMap<SMGValue, SMGEdgePointsTo> map;
@@ -28,8 +32,15 @@ public class SMGPointsToMap implements SMGPointsToEdges {
     map = pMap;
   }
 
+  private SMGPointsToMap withMap(PersistentMap<SMGValue, SMGEdgePointsTo> pMap) {
+    return pMap == map ? this : new SMGPointsToMap(pMap);
+  }
+
   @Override
   public SMGPointsToMap addAndCopy(SMGEdgePointsTo pEdge) {
+    if (pEdge.equals(map.get(pEdge.getValue()))) {
+      return this;
+    }
     return new SMGPointsToMap(map.putAndCopy(pEdge.getValue(), pEdge));
   }
 
@@ -44,11 +55,14 @@ public class SMGPointsToMap implements SMGPointsToEdges {
     for (SMGEdgePointsTo edge : SMGEdgePointsToFilter.targetObjectFilter(pObj).filter(this)) {
       tmp = tmp.removeAndCopy(edge.getValue());
     }
-    return new SMGPointsToMap(tmp);
+    return withMap(tmp);
   }
 
   @Override
   public SMGPointsToMap removeEdgeWithValueAndCopy(SMGValue pValue) {
+    if (!map.containsKey(pValue)) {
+      return this;
+    }
     return new SMGPointsToMap(map.removeAndCopy(pValue));
   }
 
@@ -69,7 +83,7 @@ public class SMGPointsToMap implements SMGPointsToEdges {
 
   @Override
   public boolean equals(Object o) {
-    return o instanceof SMGPointsToMap && map.equals(((SMGPointsToMap)o).map);
+    return o == this || (o instanceof SMGPointsToMap && map.equals(((SMGPointsToMap) o).map));
   }
 
   @Override
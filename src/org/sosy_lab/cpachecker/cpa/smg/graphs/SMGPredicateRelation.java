@@ -213,6 +213,11 @@ public final class SMGPredicateRelation {
     return smgValuesDependency.containsKey(pSymbolicValue);
   }
 
+  /** Returns whether the value occurs in any symbolic or explicit relation. */
+  public boolean containsValue(SMGValue pValue) {
+    return smgValuesDependency.containsKey(pValue) || smgExplicitValueRelation.containsKey(pValue);
+  }
+
   static public class SymbolicRelation {
     private SMGValue valueOne;
     private SMGType firstValSMGType;
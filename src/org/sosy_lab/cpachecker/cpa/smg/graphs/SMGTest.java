@@ -14,6 +14,7 @@ import java.util.TreeMap;
 import org.junit.Before;
 import org.junit.Test;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.ast.c.CBinaryExpression.BinaryOperator;
 import org.sosy_lab.cpachecker.cfa.types.MachineModel;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.edge.SMGEdgeHasValue;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.edge.SMGEdgePointsTo;
@@ -68,6 +69,26 @@ public class SMGTest {
     smg.addHasValueEdge(hv2has1at4);
   }
 
+  @Test
+  public void copyOnWritePredicateRelationTest() {
+    SMGValue sym = SMGKnownSymValue.of();
+    smg.addValue(sym);
+    SMG copy = smg.copyOf();
+    assertThat(copy.getPathPredicateRelation()).isSameInstanceAs(smg.getPathPredicateRelation());
+
+    SMGType type = new SMGType(mockTypeSize, true);
+    copy.getModifiablePathPredicateRelation()
+        .addExplicitRelation(sym, type, SMGKnownExpValue.valueOf(5), BinaryOperator.EQUALS);
+    assertThat(copy.getPathPredicateRelation().isEmpty()).isFalse();
+    assertThat(smg.getPathPredicateRelation().isEmpty()).isTrue();
+
+    // the original is shared as well and must not modify the relation of the copy
+    SMG copy2 = copy.copyOf();
+    copy.removeValue(sym);
+    assertThat(copy.getPathPredicateRelation().isEmpty()).isTrue();
+    assertThat(copy2.getPathPredicateRelation().isEmpty()).isFalse();
+  }
+
   @Test
   public void getNullBytesForObjectTest() {
     SMG smg1 = getNewSMG64();
@@ -484,4 +505,28 @@ public class SMGTest {
     assertThat(nr.neq_exists(one, three)).isFalse();
     assertThat(nr.neq_exists(two, three)).isFalse();
   }
+
+  @Test
+  public void copySharesEdgesTest() {
+    SMG smg_copy = smg.copyOf();
+    SMGHasValueEdgeSet edges = (SMGHasValueEdgeSet) smg.getHVEdges();
+
+    smg_copy.addHasValueEdge(new SMGEdgeHasValue(mockTypeSize, 0, obj1, val2));
+    SMGHasValueEdgeSet copyEdges = (SMGHasValueEdgeSet) smg_copy.getHVEdges();
+    assertThat(copyEdges.hasSameEdgesForObject(obj2, edges)).isTrue();
+    assertThat(copyEdges.hasSameEdgesForObject(obj1, edges)).isFalse();
+    assertThat(copyEdges).isNotEqualTo(edges);
+
+    smg_copy.removeHasValueEdge(new SMGEdgeHasValue(mockTypeSize, 0, obj1, val2));
+    assertThat(smg_copy.getHVEdges()).isEqualTo(edges);
+  }
+
+  @Test
+  public void unchangedPointsToEdgesAreSharedTest() {
+    SMGPointsToEdges ptEdges = smg.getPTEdges();
+    assertThat(ptEdges.addAndCopy(pt1to1)).isSameInstanceAs(ptEdges);
+    assertThat(ptEdges.removeEdgeWithValueAndCopy(val2)).isSameInstanceAs(ptEdges);
+    assertThat(ptEdges.removeAllEdgesOfObjectAndCopy(obj2)).isSameInstanceAs(ptEdges);
+    assertThat(ptEdges.removeAllEdgesOfObjectAndCopy(obj1).size()).isEqualTo(0);
+  }
 }
@@ -39,6 +39,11 @@ public interface UnmodifiableCLangSMG extends UnmodifiableSMG {
   /** return a unmodifiable view on all SMG-objects on the heap. */
   PersistentSet<SMGObject> getHeapObjects();
 
+  /**
+   * return a fingerprint of the heap objects, which is equal for SMGs with the same heap objects.
+   */
+  int getHeapObjectsFingerprint();
+
   /** check whether an object is part of the heap. */
   boolean isHeapObject(SMGObject object);
 
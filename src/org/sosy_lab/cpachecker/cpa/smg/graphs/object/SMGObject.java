@@ -8,6 +8,7 @@
 
 package org.sosy_lab.cpachecker.cpa.smg.graphs.object;
 
+import org.sosy_lab.common.UniqueIdGenerator;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.object.dll.SMGDoublyLinkedList;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.value.SMGValue;
 
@@ -22,7 +23,8 @@ public abstract class SMGObject implements Comparable<SMGObject> {
   private final String label;
   private final int level;
   private final SMGObjectKind kind;
-  private static int count;
+  /** every object gets its own ID, also if objects are created by parallel abstraction. */
+  private static final UniqueIdGenerator idGenerator = new UniqueIdGenerator();
   private final int id;
 
   public SMGObjectKind getKind() {
@@ -87,8 +89,7 @@ public abstract class SMGObject implements Comparable<SMGObject> {
   }
 
   private static int getNewId() {
-    count++;
-    return count;
+    return idGenerator.getFreshId() + 1;
   }
 
   public int getId() {
@@ -16,6 +16,7 @@ import java.util.Map;
 import java.util.Map.Entry;
 import org.sosy_lab.cpachecker.cfa.types.c.CVoidType;
 import org.sosy_lab.cpachecker.cpa.smg.CLangStackFrame;
+import org.sosy_lab.cpachecker.cpa.smg.graphs.SMGHasValueEdgeSet;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.SMGHasValueEdges;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.UnmodifiableCLangSMG;
 import org.sosy_lab.cpachecker.cpa.smg.graphs.edge.SMGEdgeHasValue;
@@ -70,6 +71,15 @@ public class SMGIsLessOrEqual {
         return false;
       }
 
+      // the heaps have to contain exactly the same objects
+      if (pSMG1.getHeapObjectsFingerprint() != pSMG2.getHeapObjectsFingerprint()) {
+        return false;
+      }
+
+      if (!haveSameStackFunctions(pSMG1, pSMG2)) {
+        return false;
+      }
+
       TimerWrapper gt = globalsTimer.getNewTimer();
       gt.start();
       try {
@@ -107,6 +117,29 @@ public class SMGIsLessOrEqual {
     }
   }
 
+  /**
+   * Cheap check whether the stack frames of both SMGs belong to the same functions, as far as both
+   * stacks reach. Neither {@link #isLessOrEqual} nor {@link SMGJoin} can succeed otherwise.
+   */
+  public static boolean haveSameStackFunctions(
+      UnmodifiableCLangSMG pSMG1, UnmodifiableCLangSMG pSMG2) {
+    if (pSMG1.getStackFrames() == pSMG2.getStackFrames()) {
+      return true;
+    }
+    Iterator<CLangStackFrame> smg1stackIterator = pSMG1.getStackFrames().iterator();
+    Iterator<CLangStackFrame> smg2stackIterator = pSMG2.getStackFrames().iterator();
+    while (smg1stackIterator.hasNext() && smg2stackIterator.hasNext()) {
+      if (!smg1stackIterator
+          .next()
+          .getFunctionDeclaration()
+          .getOrigName()
+          .equals(smg2stackIterator.next().getFunctionDeclaration().getOrigName())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   /** returns whether globals variables are "maybe LEQ" or "definitely not LEQ". */
   private static boolean maybeGlobalsLessOrEqual(
       UnmodifiableCLangSMG pSMG1, UnmodifiableCLangSMG pSMG2) {
@@ -225,6 +258,16 @@ public class SMGIsLessOrEqual {
         (pSMG1.getObjects().contains(pSMGObject1) && pSMG2.getObjects().contains(pSMGObject2)),
         "SMGJoinFields object arguments need to be included in parameter SMGs");
 
+    // copies of an SMG share the edges of all unmodified objects, which can be skipped
+    if (pSMGObject1 == pSMGObject2
+        && pSMG1.getPTEdges() == pSMG2.getPTEdges()
+        && pSMG1.getHVEdges() instanceof SMGHasValueEdgeSet
+        && pSMG2.getHVEdges() instanceof SMGHasValueEdgeSet
+        && ((SMGHasValueEdgeSet) pSMG1.getHVEdges())
+            .hasSameEdgesForObject(pSMGObject1, (SMGHasValueEdgeSet) pSMG2.getHVEdges())) {
+      return true;
+    }
+
     SMGEdgeHasValueFilter filterForSMG1 = SMGEdgeHasValueFilter.objectFilter(pSMGObject1);
     SMGEdgeHasValueFilter filterForSMG2 = SMGEdgeHasValueFilter.objectFilter(pSMGObject2);
 
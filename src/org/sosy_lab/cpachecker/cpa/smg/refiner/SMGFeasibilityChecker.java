@@ -10,14 +10,17 @@ package org.sosy_lab.cpachecker.cpa.smg.refiner;
 
 import com.google.common.base.Preconditions;
 import com.google.common.collect.FluentIterable;
+import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.Deque;
+import java.util.HashMap;
 import java.util.HashSet;
 import java.util.List;
+import java.util.Map;
 import java.util.Set;
 import java.util.logging.Level;
 import org.sosy_lab.common.log.LogManager;
@@ -103,6 +106,83 @@ public class SMGFeasibilityChecker implements FeasibilityChecker<UnmodifiableSMG
     }
   }
 
+  /**
+   * This method returns the feasible paths among the given paths, which all start in the initial
+   * state. Paths to different targets of the same ARG usually share long prefixes, so the
+   * successors along each prefix are computed only once for all paths.
+   */
+  public List<ARGPath> getFeasiblePaths(Collection<ARGPath> pPaths)
+      throws CPAException, InterruptedException {
+    PrefixNode root = new PrefixNode(ImmutableList.of(initialState.copyOf()));
+    List<ARGPath> feasiblePaths = new ArrayList<>();
+    for (ARGPath path : pPaths) {
+      Preconditions.checkArgument(!path.getInnerEdges().isEmpty());
+      ReachabilityResult result = isReachable(path, root);
+      if (result.isReachable()
+          && isTarget(result.getLastState(), result.getLastEdge(), path.getLastState(), false)) {
+        feasiblePaths.add(path);
+      }
+    }
+    return feasiblePaths;
+  }
+
+  /**
+   * Like {@link #isReachable(ARGPath, UnmodifiableSMGState, SMGPrecision)} from the initial state
+   * with the static precision, but reusing and extending the successors of the prefixes that are
+   * stored in the given tree.
+   */
+  private ReachabilityResult isReachable(ARGPath pPath, PrefixNode pRoot)
+      throws CPAException, InterruptedException {
+    PrefixNode current = pRoot;
+    CFAEdge edge = null;
+    PathIterator iterator = pPath.pathIterator();
+    try {
+      while (iterator.hasNext()) {
+        edge = iterator.getOutgoingEdge();
+        ARGState nextState = iterator.getNextAbstractState();
+        PrefixNode next = current.children.get(nextState);
+        if (next == null) {
+          // the transfer relation may modify the states, so never pass the stored ones
+          next =
+              new PrefixNode(
+                  strongestPostOp.getStrongestPost(copyStates(current.states), precision, edge));
+          current.children.put(nextState, next);
+        }
+
+        // no successors => path is infeasible
+        if (next.states.isEmpty()) {
+          logger.log(Level.FINE, "found path to be infeasible: ", edge,
+              " did not yield a successor");
+          return ReachabilityResult.isNotReachable(iterator.getPosition());
+        }
+
+        iterator.advance();
+        current = next;
+      }
+    } catch (CPATransferException e) {
+      throw new CPAException(
+          "Computation of successor failed for checking path: " + e.getMessage(), e);
+    }
+
+    // checking the target prunes the states, so return copies
+    return ReachabilityResult.isReachable(copyStates(current.states), edge, iterator.getPosition());
+  }
+
+  private static List<SMGState> copyStates(Collection<SMGState> pStates) {
+    return FluentIterable.from(pStates).transform(SMGState::copyOf).toList();
+  }
+
+  /** A node in the tree of path prefixes, with the states reached at the end of the prefix. */
+  private static class PrefixNode {
+
+    private final Collection<SMGState> states;
+    private final Map<ARGState, PrefixNode> children = new HashMap<>();
+
+    private PrefixNode(Collection<SMGState> pStates) {
+      states = ImmutableList.copyOf(pStates);
+    }
+  }
+
   private boolean isTarget(Collection<SMGState> pLastStates, CFAEdge pLastEdge, ARGState pLastState,
       boolean allTargets) throws CPATransferException, InterruptedException {
 
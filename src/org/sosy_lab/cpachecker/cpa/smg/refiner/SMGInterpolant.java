@@ -11,10 +11,13 @@ package org.sosy_lab.cpachecker.cpa.smg.refiner;
 import static com.google.common.base.Preconditions.checkArgument;
 
 import com.google.common.collect.Collections2;
+import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Sets;
 import java.util.Collection;
+import java.util.HashMap;
 import java.util.HashSet;
+import java.util.Map;
 import java.util.Objects;
 import java.util.Set;
 import org.sosy_lab.common.log.LogManager;
@@ -40,11 +43,18 @@ public class SMGInterpolant implements Interpolant<Collection<SMGState>, SMGInte
   private final ImmutableSet<MemoryLocation> trackedStackVariables;
   private final ImmutableSet<UnmodifiableSMGState> smgStates;
 
+  /**
+   * the memory paths of each state, kept such that joined interpolants do not need to collect them
+   * again for the states they take over unchanged
+   */
+  private final ImmutableMap<UnmodifiableSMGState, ImmutableSet<SMGMemoryPath>> memoryPathsOfStates;
+
   private SMGInterpolant() {
     abstractionBlock = ImmutableSet.of();
     trackedMemoryPaths = ImmutableSet.of();
     trackedStackVariables = ImmutableSet.of();
     smgStates = ImmutableSet.of();
+    memoryPathsOfStates = ImmutableMap.of();
   }
 
   public SMGInterpolant(Collection<? extends UnmodifiableSMGState> pStates) {
@@ -54,16 +64,31 @@ public class SMGInterpolant implements Interpolant<Collection<SMGState>, SMGInte
   public SMGInterpolant(
       Collection<? extends UnmodifiableSMGState> pStates,
       Collection<SMGAbstractionBlock> pAbstractionBlock) {
+    this(pStates, pAbstractionBlock, ImmutableMap.of());
+  }
+
+  private SMGInterpolant(
+      Collection<? extends UnmodifiableSMGState> pStates,
+      Collection<SMGAbstractionBlock> pAbstractionBlock,
+      Map<UnmodifiableSMGState, ImmutableSet<SMGMemoryPath>> pKnownMemoryPaths) {
     smgStates = ImmutableSet.copyOf(pStates);
     abstractionBlock = ImmutableSet.copyOf(pAbstractionBlock);
 
+    ImmutableMap.Builder<UnmodifiableSMGState, ImmutableSet<SMGMemoryPath>> memoryPathsOfState =
+        ImmutableMap.builder();
     ImmutableSet.Builder<SMGMemoryPath> memoryPaths = ImmutableSet.builder();
     ImmutableSet.Builder<MemoryLocation> stackVariables = ImmutableSet.builder();
     for (UnmodifiableSMGState state : smgStates) {
-      memoryPaths.addAll(new SMGMemoryPathCollector(state.getHeap()).getMemoryPaths());
+      ImmutableSet<SMGMemoryPath> paths = pKnownMemoryPaths.get(state);
+      if (paths == null) {
+        paths = ImmutableSet.copyOf(new SMGMemoryPathCollector(state.getHeap()).getMemoryPaths());
+      }
+      memoryPathsOfState.put(state, paths);
+      memoryPaths.addAll(paths);
       stackVariables.addAll(state.getStackVariables().keySet());
     }
 
+    memoryPathsOfStates = memoryPathsOfState.build();
     trackedMemoryPaths = memoryPaths.build();
     trackedStackVariables = stackVariables.build();
   }
@@ -137,7 +162,10 @@ public class SMGInterpolant implements Interpolant<Collection<SMGState>, SMGInte
 
     Set<SMGAbstractionBlock> jointAbstractionBlock =
         Sets.union(abstractionBlock, pOtherInterpolant.abstractionBlock);
-    return new SMGInterpolant(joinResult, jointAbstractionBlock);
+    Map<UnmodifiableSMGState, ImmutableSet<SMGMemoryPath>> knownMemoryPaths =
+        new HashMap<>(memoryPathsOfStates);
+    knownMemoryPaths.putAll(pOtherInterpolant.memoryPathsOfStates);
+    return new SMGInterpolant(joinResult, jointAbstractionBlock, knownMemoryPaths);
   }
 
   public static SMGInterpolant createInitial(
@@ -257,6 +257,16 @@ public class SMGInterpolationTree {
    * @param errorPath the path for which to obtain the initial interpolant
    * @return the initial interpolant for the given path
    */
+  /**
+   * This method checks whether the paths for interpolation are independent of each other, i.e.,
+   * whether they can be interpolated in parallel.
+   *
+   * @return true if the paths for interpolation are independent of each other, else false
+   */
+  public boolean hasIndependentPaths() {
+    return strategy.hasIndependentPaths();
+  }
+
   public SMGInterpolant getInitialInterpolantForPath(ARGPath errorPath) {
     return strategy.getInitialInterpolantForRoot(errorPath.getFirstState());
   }
@@ -304,6 +314,8 @@ public class SMGInterpolationTree {
 
     boolean hasNextPathForInterpolation();
 
+    boolean hasIndependentPaths();
+
     SMGInterpolant getInitialInterpolantForRoot(ARGState root);
   }
 
@@ -376,6 +388,12 @@ public class SMGInterpolationTree {
     public boolean hasNextPathForInterpolation() {
       return !sources.isEmpty();
     }
+
+    @Override
+    public boolean hasIndependentPaths() {
+      // paths start at the states where the previous paths branched off
+      return false;
+    }
   }
 
   private class BottomUpInterpolationStrategy implements SMGInterpolationStrategy {
@@ -427,6 +445,12 @@ public class SMGInterpolationTree {
     public boolean hasNextPathForInterpolation() {
       return !sources.isEmpty();
     }
+
+    @Override
+    public boolean hasIndependentPaths() {
+      // all paths start at the root with the initial interpolant
+      return true;
+    }
   }
 
   /**
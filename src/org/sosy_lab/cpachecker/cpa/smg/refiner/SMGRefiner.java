@@ -13,20 +13,27 @@ import static org.sosy_lab.cpachecker.util.Precisions.extractPrecisionByType;
 import com.google.common.base.Preconditions;
 import com.google.common.base.Predicate;
 import com.google.common.base.Predicates;
+import com.google.common.base.Throwables;
 import com.google.common.collect.Iterables;
 import com.google.common.collect.Lists;
 import com.google.common.collect.Sets;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
-import java.util.Map.Entry;
 import java.util.Objects;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -95,14 +102,40 @@ public class SMGRefiner implements Refiner {
       values = { "NEVER", "FINAL", "ALWAYS" })
   private String exportInterpolationTree = "NEVER";
 
-  private SMGRefiner(SMGCPA pSmgCpa, ARGCPA pArgCpa, Set<ControlAutomatonCPA> automatonCpas)
+  @Option(
+      secure = true,
+      description =
+          "whether to use the top-down interpolation strategy or the bottom-up interpolation"
+              + " strategy")
+  private boolean useTopDownInterpolationStrategy = true;
+
+  @Option(
+      secure = true,
+      description =
+          "number of threads for interpolating the paths of an interpolation tree in parallel."
+              + " This only has an effect for the bottom-up interpolation strategy,"
+              + " whose paths are independent of each other.")
+  @IntegerOption(min = 1)
+  private int interpolationThreads = 1;
+
+  private final CFA cfa;
+  private final UnmodifiableSMGState initialState;
+  private final Set<ControlAutomatonCPA> automatonCpas;
+
+  /** one interpolator per thread, created lazily for parallel interpolation */
+  private @Nullable List<SMGPathInterpolator> threadInterpolators = null;
+
+  private @Nullable ExecutorService interpolationExecutor = null;
+
+  private SMGRefiner(SMGCPA pSmgCpa, ARGCPA pArgCpa, Set<ControlAutomatonCPA> pAutomatonCpas)
       throws InvalidConfigurationException, SMGInconsistentException {
     pSmgCpa.getConfiguration().inject(this);
 
     argCpa = pArgCpa;
     smgCpa = pSmgCpa;
     logger = pSmgCpa.getLogger();
-    CFA cfa = pSmgCpa.getCFA();
+    cfa = pSmgCpa.getCFA();
+    automatonCpas = pAutomatonCpas;
     shutdownNotifier = pSmgCpa.getShutdownNotifier();
 
     smgCpa.enableRefinement(exportRefinementSMGs);
@@ -119,19 +152,26 @@ public class SMGRefiner implements Refiner {
             SMGTransferRelationKind.STATIC,
             shutdownNotifier);
 
-    UnmodifiableSMGState initialState =
+    initialState =
         smgCpa.getInitialState(cfa.getMainFunction(), StateSpacePartition.getDefaultPartition());
 
     checker =
         new SMGFeasibilityChecker(strongestPostOpForCEX, logger, cfa, initialState, automatonCpas);
 
     interpolantManager = new SMGInterpolantManager(logger, cfa, smgCpa.getOptions());
+    interpolator = createPathInterpolator(predicateManager);
+  }
 
+  /**
+   * This method creates a path interpolator with its own strongest-post operator and feasibility
+   * checker, because the transfer relation of the operator is not thread-safe.
+   */
+  private SMGPathInterpolator createPathInterpolator(SMGPredicateManager pPredicateManager) {
     SMGStrongestPostOperator strongestPostOpForInterpolation =
         new SMGStrongestPostOperator(
             logger,
             cfa,
-            predicateManager,
+            pPredicateManager,
             smgCpa.getOptions(),
             SMGTransferRelationKind.REFINEMENT,
             shutdownNotifier);
@@ -149,15 +189,14 @@ public class SMGRefiner implements Refiner {
             logger,
             smgCpa.getBlockOperator());
 
-    interpolator =
-        new SMGPathInterpolator(
-            shutdownNotifier,
-            interpolantManager,
-            edgeInterpolator,
-            logger,
-            exportInterpolantSMGs,
-            smgCpa.getOptions().getExportSMGLevel(),
-            checkerForInterpolation);
+    return new SMGPathInterpolator(
+        shutdownNotifier,
+        interpolantManager,
+        edgeInterpolator,
+        logger,
+        exportInterpolantSMGs,
+        smgCpa.getOptions().getExportSMGLevel(),
+        checkerForInterpolation);
   }
 
   public static final SMGRefiner create(ConfigurableProgramAnalysis pCpa)
@@ -207,13 +246,8 @@ public class SMGRefiner implements Refiner {
 
   private List<ARGPath> getFeasibleErrorPaths(Collection<ARGPath> pErrorPaths)
       throws CPAException, InterruptedException {
-    List<ARGPath> lst = new ArrayList<>();
-    for (ARGPath currentPath : pErrorPaths) {
-      if (checker.isFeasible(currentPath)) {
-        lst.add(currentPath);
-      }
-    }
-    return lst;
+    // the target paths share their prefixes, so the checker computes each prefix only once
+    return checker.getFeasiblePaths(pErrorPaths);
   }
 
   private CounterexampleInfo isAnyPathFeasible(
@@ -268,8 +302,14 @@ public class SMGRefiner implements Refiner {
 
     SMGInterpolationTree interpolationTree = createInterpolationTree(pTargetPaths);
 
-    while (interpolationTree.hasNextPathForInterpolation()) {
-      performPathInterpolation(interpolationTree, pReachedSet);
+    if (interpolationTree.hasIndependentPaths() && isParallelInterpolationAvailable()) {
+      while (interpolationTree.hasNextPathForInterpolation()) {
+        performParallelPathInterpolation(interpolationTree, pReachedSet);
+      }
+    } else {
+      while (interpolationTree.hasNextPathForInterpolation()) {
+        performPathInterpolation(interpolationTree, pReachedSet);
+      }
     }
 
     exportTree(interpolationTree, "FINAL");
@@ -301,6 +341,81 @@ public class SMGRefiner implements Refiner {
     exportTree(interpolationTree, "ALWAYS");
   }
 
+  /**
+   * This method interpolates the next paths of the given interpolation tree in parallel, at most
+   * one path per thread. The interpolants are added to the tree in the order of the paths, so the
+   * result does not depend on the scheduling of the threads.
+   */
+  private void performParallelPathInterpolation(
+      SMGInterpolationTree interpolationTree, ARGReachedSet pReachedSet)
+      throws CPAException, InterruptedException {
+    List<ARGPath> errorPaths = new ArrayList<>(threadInterpolators.size());
+    do {
+      ARGPath errorPath = interpolationTree.getNextPathForInterpolation();
+      if (errorPath == InterpolationTree.EMPTY_PATH) {
+        logger.log(Level.FINEST, "skipping interpolation,"
+            + " because false interpolant on path to target state");
+      } else {
+        errorPaths.add(errorPath);
+      }
+    } while (errorPaths.size() < threadInterpolators.size()
+        && interpolationTree.hasNextPathForInterpolation());
+
+    List<Future<Map<ARGState, SMGInterpolant>>> interpolants = new ArrayList<>(errorPaths.size());
+    try {
+      for (int i = 0; i < errorPaths.size(); i++) {
+        // independent paths start at the root, so the initial interpolant is never too weak
+        ARGPath errorPath = errorPaths.get(i);
+        SMGInterpolant initialItp = interpolationTree.getInitialInterpolantForPath(errorPath);
+        SMGPathInterpolator threadInterpolator = threadInterpolators.get(i);
+        interpolants.add(
+            interpolationExecutor.submit(
+                () -> threadInterpolator.performInterpolation(errorPath, initialItp, pReachedSet)));
+      }
+      for (Future<Map<ARGState, SMGInterpolant>> pathInterpolants : interpolants) {
+        interpolationTree.addInterpolants(pathInterpolants.get());
+      }
+    } catch (ExecutionException e) {
+      Throwables.throwIfInstanceOf(e.getCause(), CPAException.class);
+      Throwables.throwIfInstanceOf(e.getCause(), InterruptedException.class);
+      Throwables.throwIfUnchecked(e.getCause());
+      throw new AssertionError(e);
+    } finally {
+      for (Future<?> pathInterpolants : interpolants) {
+        pathInterpolants.cancel(true);
+      }
+    }
+    exportTree(interpolationTree, "ALWAYS");
+  }
+
+  private boolean isParallelInterpolationAvailable() throws CPAException {
+    if (interpolationThreads <= 1) {
+      return false;
+    }
+    if (threadInterpolators == null) {
+      List<SMGPathInterpolator> interpolators = new ArrayList<>(interpolationThreads);
+      try {
+        for (int i = 0; i < interpolationThreads; i++) {
+          // the solver of the predicate manager is not thread-safe either
+          SMGPredicateManager predicateManager =
+              new SMGPredicateManager(smgCpa.getConfiguration(), logger, shutdownNotifier);
+          interpolators.add(createPathInterpolator(predicateManager));
+        }
+      } catch (InvalidConfigurationException e) {
+        throw new CPAException("Could not create interpolator for parallel interpolation", e);
+      }
+      threadInterpolators = interpolators;
+      interpolationExecutor =
+          Executors.newFixedThreadPool(
+              interpolationThreads,
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("smg-interpolation-%d")
+                  .build());
+    }
+    return true;
+  }
+
   private boolean isInitialInterpolantTooWeak(ARGState root, SMGInterpolant initialItp, ARGPath errorPath)
       throws CPAException, InterruptedException {
 
@@ -320,7 +435,8 @@ public class SMGRefiner implements Refiner {
   }
 
   private SMGInterpolationTree createInterpolationTree(List<ARGPath> pTargetPaths) {
-    return new SMGInterpolationTree(interpolantManager, logger, pTargetPaths, true);
+    return new SMGInterpolationTree(
+        interpolantManager, logger, pTargetPaths, useTopDownInterpolationStrategy);
   }
 
   private void refineUsingInterpolants(ARGReachedSet pReached, SMGInterpolationTree pInterpolationTree) throws InterruptedException {
@@ -338,12 +454,10 @@ public class SMGRefiner implements Refiner {
       refinementInformation.put(root, precisions);
     }
 
-    for (Entry<ARGState, List<Precision>> info : refinementInformation.entrySet()) {
-      shutdownNotifier.shutdownIfNecessary();
-      List<Predicate<? super Precision>> precisionTypes =
-          Lists.newArrayList(Predicates.instanceOf(SMGPrecision.class));
-      pReached.removeSubtree(info.getKey(), info.getValue(), precisionTypes);
-    }
+    shutdownNotifier.shutdownIfNecessary();
+    List<Predicate<? super Precision>> precisionTypes =
+        Lists.newArrayList(Predicates.instanceOf(SMGPrecision.class));
+    pReached.removeSubtrees(refinementInformation, precisionTypes);
   }
 
   private SMGPrecision mergeSMGPrecisionsForSubgraph(
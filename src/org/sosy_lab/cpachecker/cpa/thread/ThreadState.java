@@ -60,6 +60,8 @@ public class ThreadState implements LatticeAbstractState<ThreadState>, Compatibl
   // Do not remove it now
   private final ImmutableMap<ThreadLabel, ThreadStatus> removedSet;
   private final List<ThreadLabel> order;
+  // ThreadState is a part of BAM cache keys, so the hash code is computed only once
+  private final int hashCode;
 
   public ThreadState(
       Map<String, ThreadStatus> Tset,
@@ -68,11 +70,12 @@ public class ThreadState implements LatticeAbstractState<ThreadState>, Compatibl
     threadSet = Tset;
     removedSet = Rset;
     order = ImmutableList.copyOf(pOrder);
+    hashCode = Objects.hash(removedSet, threadSet);
   }
 
   @Override
   public final int hashCode() {
-    return Objects.hash(removedSet, threadSet);
+    return hashCode;
   }
 
   @Override
@@ -87,7 +90,8 @@ public class ThreadState implements LatticeAbstractState<ThreadState>, Compatibl
       return false;
     }
     ThreadState other = (ThreadState) obj;
-    return Objects.equals(removedSet, other.removedSet)
+    return hashCode == other.hashCode
+        && Objects.equals(removedSet, other.removedSet)
         && Objects.equals(threadSet, other.threadSet);
   }
 
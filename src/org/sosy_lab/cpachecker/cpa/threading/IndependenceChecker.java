@@ -0,0 +1,115 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.threading;
+
+import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.Sets;
+import java.util.IdentityHashMap;
+import org.sosy_lab.cpachecker.cfa.ast.c.CArraySubscriptExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CAstNode;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.types.c.CArrayType;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.dependencegraph.EdgeDefUseData;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+
+/**
+ * This static analyzer for pairs of edges of different threads checks whether the edges commute,
+ * i.e., whether executing them in any order leads to the same state and neither of them can
+ * enable or disable the other one. This is the independence relation used for partial-order
+ * reduction.
+ *
+ * <p>Edges that are relevant for the threading itself (thread creation, locks, atomic sections,
+ * program termination, visible function calls) have to be excluded by the caller, they are never
+ * independent of any other edge. For all other edges, independence is decided based on the
+ * variables that are read and written along the edges. Any access via a pointer is treated like an
+ * access to all variables.
+ */
+class IndependenceChecker {
+
+  /** cache elements, edges and their content never change. */
+  private final IdentityHashMap<CFAEdge, Accesses> accessCache = new IdentityHashMap<>();
+
+  private final GlobalAccessChecker globalAccessChecker;
+
+  /**
+   * With local-access locks, local edges acquire a lock that blocks all other threads, so only
+   * edges with access to global variables can be independent.
+   */
+  private final boolean useLocalAccessLocks;
+
+  IndependenceChecker(GlobalAccessChecker pGlobalAccessChecker, boolean pUseLocalAccessLocks) {
+    globalAccessChecker = pGlobalAccessChecker;
+    useLocalAccessLocks = pUseLocalAccessLocks;
+  }
+
+  /** check, whether the given edges of two different threads are independent. */
+  boolean areIndependent(CFAEdge pEdge1, CFAEdge pEdge2) {
+    if (useLocalAccessLocks
+        && (!globalAccessChecker.hasGlobalAccess(pEdge1)
+            || !globalAccessChecker.hasGlobalAccess(pEdge2))) {
+      return false;
+    }
+
+    Accesses accesses1 = getAccesses(pEdge1);
+    Accesses accesses2 = getAccesses(pEdge2);
+    return !accesses1.conflictsWith(accesses2) && !accesses2.conflictsWith(accesses1);
+  }
+
+  private Accesses getAccesses(CFAEdge pEdge) {
+    return accessCache.computeIfAbsent(pEdge, Accesses::new);
+  }
+
+  /** The variables accessed along an edge. */
+  private static final class Accesses {
+
+    private final ImmutableSet<MemoryLocation> writes;
+    private final ImmutableSet<MemoryLocation> reads;
+
+    /** whether the edge might write or read memory via a pointer, i.e., any variable. */
+    private final boolean writesAll;
+    private final boolean readsAll;
+
+    private Accesses(CFAEdge pEdge) {
+      EdgeDefUseData defUseData = EdgeDefUseData.extract(pEdge);
+      // an array subscript on a pointer is not reported as pointee access
+      boolean hasPointerSubscript =
+          pEdge.getRawAST().isPresent()
+              && pEdge.getRawAST().get() instanceof CAstNode
+              && CFAUtils.traverseRecursively((CAstNode) pEdge.getRawAST().get())
+                  .filter(CArraySubscriptExpression.class)
+                  .anyMatch(
+                      e ->
+                          !(e.getArrayExpression().getExpressionType().getCanonicalType()
+                              instanceof CArrayType));
+      writes = defUseData.getDefs();
+      reads = defUseData.getUses();
+      writesAll = hasPointerSubscript || !defUseData.getPointeeDefs().isEmpty();
+      readsAll = hasPointerSubscript || !defUseData.getPointeeUses().isEmpty();
+    }
+
+    private boolean accessesAnything() {
+      return writesAll || readsAll || !writes.isEmpty() || !reads.isEmpty();
+    }
+
+    /** check, whether this edge writes a variable that the other edge reads or writes. */
+    private boolean conflictsWith(Accesses pOther) {
+      if (writesAll) {
+        return pOther.accessesAnything();
+      }
+      if (writes.isEmpty()) {
+        return false;
+      }
+      return pOther.writesAll
+          || pOther.readsAll
+          || !Sets.intersection(writes, pOther.writes).isEmpty()
+          || !Sets.intersection(writes, pOther.reads).isEmpty();
+    }
+  }
+}
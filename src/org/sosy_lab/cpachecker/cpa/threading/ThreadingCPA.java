@@ -16,6 +16,7 @@ import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.defaults.AbstractCPA;
 import org.sosy_lab.cpachecker.core.defaults.AutomaticCPAFactory;
+import org.sosy_lab.cpachecker.core.defaults.DelegateAbstractDomain;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.CPAFactory;
 import org.sosy_lab.cpachecker.core.interfaces.StateSpacePartition;
@@ -27,7 +28,11 @@ public class ThreadingCPA extends AbstractCPA {
   }
 
   public ThreadingCPA(Configuration config, LogManager pLogger, CFA pCfa) throws InvalidConfigurationException {
-    super("sep", "sep", new ThreadingTransferRelation(config, pCfa, pLogger));
+    super(
+        "sep",
+        "sep",
+        DelegateAbstractDomain.<ThreadingState>getInstance(),
+        new ThreadingTransferRelation(config, pCfa, pLogger));
   }
 
   @Override
@@ -18,6 +18,7 @@ import static org.sosy_lab.cpachecker.cpa.threading.ThreadingTransferRelation.is
 import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
 import com.google.common.collect.FluentIterable;
+import com.google.common.collect.ImmutableSet;
 import java.util.LinkedHashSet;
 import java.util.Objects;
 import java.util.Set;
@@ -33,6 +34,7 @@ import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdgeType;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.cfa.model.FunctionCallEdge;
+import org.sosy_lab.cpachecker.core.defaults.LatticeAbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractQueryableState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractStateWithLocations;
@@ -45,7 +47,13 @@ import org.sosy_lab.cpachecker.exceptions.InvalidQueryException;
 import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
 
 /** This immutable state represents a location state combined with a callstack state. */
-public class ThreadingState implements AbstractState, AbstractStateWithLocations, Graphable, Partitionable, AbstractQueryableState {
+public class ThreadingState
+    implements AbstractState,
+        AbstractStateWithLocations,
+        Graphable,
+        Partitionable,
+        AbstractQueryableState,
+        LatticeAbstractState<ThreadingState> {
 
   private static final String PROPERTY_DEADLOCK = "deadlock";
 
@@ -53,6 +61,13 @@ public class ThreadingState implements AbstractState, AbstractStateWithLocations
 
   // String :: identifier for the thread TODO change to object or memory-location
   // CallstackState +  LocationState :: thread-position
+  //
+  // Note that we do not canonicalize this map modulo symmetric threads (i.e., threads executing
+  // the same function): with cloned functions, each such thread runs in its own copy of the
+  // function, so its locations and the variables in the states of all other CPAs differ from the
+  // ones of the symmetric threads. Permuting only the threads here would merge states that differ
+  // in the other components and is thus unsound. Without cloned functions, several threads in the
+  // same function are not supported at all, cf. ThreadingTransferRelation#getActiveThread.
   private final PersistentMap<String, ThreadState> threads;
 
   // String :: lock-id  -->  String :: thread-id
@@ -85,12 +100,20 @@ public class ThreadingState implements AbstractState, AbstractStateWithLocations
    */
   private final PersistentMap<String, Integer> threadIdsForWitness;
 
+  /**
+   * The sleep set of this state for partial-order reduction, i.e., the edges of other threads that
+   * need not be explored from this state, because an equivalent interleaving is explored from
+   * one of its predecessors. Without partial-order reduction, it is always empty.
+   */
+  private final ImmutableSet<CFAEdge> sleepSet;
+
   public ThreadingState() {
     this.threads = PathCopyingPersistentTreeMap.of();
     this.locks = PathCopyingPersistentTreeMap.of();
     this.activeThread = null;
     this.entryFunction = null;
     this.threadIdsForWitness = PathCopyingPersistentTreeMap.of();
+    this.sleepSet = ImmutableSet.of();
   }
 
   private ThreadingState(
@@ -98,25 +121,30 @@ public class ThreadingState implements AbstractState, AbstractStateWithLocations
       PersistentMap<String, String> pLocks,
       String pActiveThread,
       FunctionCallEdge entryFunction,
-      PersistentMap<String, Integer> pThreadIdsForWitness) {
+      PersistentMap<String, Integer> pThreadIdsForWitness,
+      ImmutableSet<CFAEdge> pSleepSet) {
     this.threads = pThreads;
     this.locks = pLocks;
     this.activeThread = pActiveThread;
     this.entryFunction = entryFunction;
     this.threadIdsForWitness = pThreadIdsForWitness;
+    this.sleepSet = pSleepSet;
   }
 
   private ThreadingState withThreads(PersistentMap<String, ThreadState> pThreads) {
-    return new ThreadingState(pThreads, locks, activeThread, entryFunction, threadIdsForWitness);
+    return new ThreadingState(
+        pThreads, locks, activeThread, entryFunction, threadIdsForWitness, sleepSet);
   }
 
   private ThreadingState withLocks(PersistentMap<String, String> pLocks) {
-    return new ThreadingState(threads, pLocks, activeThread, entryFunction, threadIdsForWitness);
+    return new ThreadingState(
+        threads, pLocks, activeThread, entryFunction, threadIdsForWitness, sleepSet);
   }
 
   private ThreadingState withThreadIdsForWitness(
       PersistentMap<String, Integer> pThreadIdsForWitness) {
-    return new ThreadingState(threads, locks, activeThread, entryFunction, pThreadIdsForWitness);
+    return new ThreadingState(
+        threads, locks, activeThread, entryFunction, pThreadIdsForWitness, sleepSet);
   }
 
   public ThreadingState addThreadAndCopy(String id, int num, AbstractState stack, AbstractState loc) {
@@ -216,6 +244,7 @@ public class ThreadingState implements AbstractState, AbstractStateWithLocations
         + (activeThread == null ? "" : ("\n produced from thread " + activeThread))
         + " \n"
         + Joiner.on(",\n ").withKeyValueSeparator("=").join(threadIdsForWitness)
+        + (sleepSet.isEmpty() ? "" : ("\n sleeping edges " + sleepSet))
         + ")";
   }
 
@@ -228,12 +257,38 @@ public class ThreadingState implements AbstractState, AbstractStateWithLocations
     return threads.equals(ts.threads)
         && locks.equals(ts.locks)
         && Objects.equals(activeThread, ts.activeThread)
-        && threadIdsForWitness.equals(ts.threadIdsForWitness);
+        && threadIdsForWitness.equals(ts.threadIdsForWitness)
+        && sleepSet.equals(ts.sleepSet);
   }
 
   @Override
   public int hashCode() {
-    return Objects.hash(threads, locks, activeThread, threadIdsForWitness);
+    return Objects.hash(threads, locks, activeThread, threadIdsForWitness, sleepSet);
+  }
+
+  /**
+   * A state is covered by another state with the same threads and locks if the other state
+   * explores at least the same edges, i.e., if its sleep set is a subset of the sleep set of this
+   * state. Covering a state by another with a larger sleep set would be unsound, because edges in
+   * the sleep set of the other state would not be explored from any of the two states.
+   */
+  @Override
+  public boolean isLessOrEqual(ThreadingState pOther) {
+    return threads.equals(pOther.threads)
+        && locks.equals(pOther.locks)
+        && Objects.equals(activeThread, pOther.activeThread)
+        && threadIdsForWitness.equals(pOther.threadIdsForWitness)
+        && sleepSet.containsAll(pOther.sleepSet);
+  }
+
+  @Override
+  public ThreadingState join(ThreadingState pOther) {
+    if (isLessOrEqual(pOther)) {
+      return pOther;
+    } else if (pOther.isLessOrEqual(this)) {
+      return this;
+    }
+    throw new UnsupportedOperationException("ThreadingCPA only supports merge-sep");
   }
 
   private FluentIterable<AbstractStateWithLocations> getLocations() {
@@ -410,7 +465,8 @@ public class ThreadingState implements AbstractState, AbstractStateWithLocations
 
   /** See {@link #activeThread}. */
   public ThreadingState withActiveThread(@Nullable String pActiveThread) {
-    return new ThreadingState(threads, locks, pActiveThread, entryFunction, threadIdsForWitness);
+    return new ThreadingState(
+        threads, locks, pActiveThread, entryFunction, threadIdsForWitness, sleepSet);
   }
 
   String getActiveThread() {
@@ -419,7 +475,19 @@ public class ThreadingState implements AbstractState, AbstractStateWithLocations
 
   /** See {@link #entryFunction}. */
   public ThreadingState withEntryFunction(@Nullable FunctionCallEdge pEntryFunction) {
-    return new ThreadingState(threads, locks, activeThread, pEntryFunction, threadIdsForWitness);
+    return new ThreadingState(
+        threads, locks, activeThread, pEntryFunction, threadIdsForWitness, sleepSet);
+  }
+
+  /** See {@link #sleepSet}. */
+  ThreadingState withSleepSet(ImmutableSet<CFAEdge> pSleepSet) {
+    return new ThreadingState(
+        threads, locks, activeThread, entryFunction, threadIdsForWitness, pSleepSet);
+  }
+
+  /** See {@link #sleepSet}. */
+  ImmutableSet<CFAEdge> getSleepSet() {
+    return sleepSet;
   }
 
   /** See {@link #entryFunction}. */
@@ -35,6 +35,7 @@ import org.sosy_lab.common.log.LogManagerWithoutDuplicates;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.ast.AExpression;
 import org.sosy_lab.cpachecker.cfa.ast.AFunctionCall;
+import org.sosy_lab.cpachecker.cfa.ast.AFunctionCallAssignmentStatement;
 import org.sosy_lab.cpachecker.cfa.ast.AIdExpression;
 import org.sosy_lab.cpachecker.cfa.ast.AStatement;
 import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
@@ -49,6 +50,7 @@ import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdgeType;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.cfa.model.CFATerminationNode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionReturnEdge;
 import org.sosy_lab.cpachecker.cfa.model.c.CFunctionCallEdge;
 import org.sosy_lab.cpachecker.cfa.model.c.CFunctionEntryNode;
 import org.sosy_lab.cpachecker.cfa.postprocessing.global.CFACloner;
@@ -102,6 +104,17 @@ public final class ThreadingTransferRelation extends SingleEdgeTransferRelation
   )
   private boolean useAllPossibleClones = false;
 
+  @Option(
+    description =
+        "use partial-order reduction with sleep sets to avoid exploring interleavings of "
+            + "independent edges of different threads more than once. Edges are independent "
+            + "if they do not access the same variables (with at least one write), accesses via "
+            + "pointers are considered to access all variables. Edges of thread functions, "
+            + "locks, atomic sections, and calls to external functions are never independent.",
+    secure = true
+  )
+  private boolean usePartialOrderReduction = false;
+
   public static final String THREAD_START = "pthread_create";
   public static final String THREAD_JOIN = "pthread_join";
   private static final String THREAD_EXIT = "pthread_exit";
@@ -110,6 +123,7 @@ public final class ThreadingTransferRelation extends SingleEdgeTransferRelation
   private static final String VERIFIER_ATOMIC = "__VERIFIER_atomic_";
   private static final String VERIFIER_ATOMIC_BEGIN = "__VERIFIER_atomic_begin";
   private static final String VERIFIER_ATOMIC_END = "__VERIFIER_atomic_end";
+  private static final String VERIFIER_NONDET = "__VERIFIER_nondet_";
   private static final String ATOMIC_LOCK = "__CPAchecker_atomic_lock__";
   private static final String LOCAL_ACCESS_LOCK = "__CPAchecker_local_access_lock__";
   private static final String THREAD_ID_SEPARATOR = "__CPAchecker__";
@@ -124,10 +138,12 @@ public final class ThreadingTransferRelation extends SingleEdgeTransferRelation
   private final ConfigurableProgramAnalysis locationCPA;
 
   private final GlobalAccessChecker globalAccessChecker = new GlobalAccessChecker();
+  private final IndependenceChecker independenceChecker;
 
   public ThreadingTransferRelation(Configuration pConfig, CFA pCfa, LogManager pLogger)
       throws InvalidConfigurationException {
     pConfig.inject(this);
+    independenceChecker = new IndependenceChecker(globalAccessChecker, useLocalAccessLocks);
     cfa = pCfa;
     locationCPA = LocationCPA.create(pCfa, pConfig);
     callstackCPA = new CallstackCPA(pConfig, pLogger);
@@ -149,6 +165,12 @@ public final class ThreadingTransferRelation extends SingleEdgeTransferRelation
       return ImmutableSet.of();
     }
 
+    // an equivalent interleaving is explored from a predecessor of the current state
+    if (usePartialOrderReduction && threadingState.getSleepSet().contains(cfaEdge)) {
+      return ImmutableSet.of();
+    }
+    final ThreadingState stateBeforeEdge = threadingState;
+
     // check if atomic lock exists and is set for current thread
     if (useAtomicLocks && threadingState.hasLock(ATOMIC_LOCK)
         && !threadingState.hasLock(activeThread, ATOMIC_LOCK)) {
@@ -175,12 +197,97 @@ public final class ThreadingTransferRelation extends SingleEdgeTransferRelation
 
     results = getAbstractSuccessorsForEdge0(cfaEdge, threadingState, activeThread, results);
 
+    if (usePartialOrderReduction) {
+      final ImmutableSet<CFAEdge> sleepSet =
+          getSleepSetAfterEdge(cfaEdge, stateBeforeEdge, activeThread);
+      results = Collections2.transform(results, ts -> ts.withSleepSet(sleepSet));
+    }
+
     // Store the active thread in the given states, cf. JavaDoc of activeThread
     results = Collections2.transform(results, ts -> ts.withActiveThread(activeThread));
 
     return ImmutableList.copyOf(results);
   }
 
+  /**
+   * Compute the sleep set for the successors of the given state for the given edge of the active
+   * thread. The sleep set contains all edges of the sleep set of the state and all edges of other
+   * threads that are explored from the state before the given edge (in the order of the thread
+   * ids), as long as they are independent of the given edge. Interleavings starting with these
+   * edges are already covered by the successors for the earlier edges.
+   */
+  private ImmutableSet<CFAEdge> getSleepSetAfterEdge(
+      final CFAEdge cfaEdge, final ThreadingState threadingState, final String activeThread) {
+    if (isVisibleForPartialOrderReduction(cfaEdge)) {
+      return ImmutableSet.of();
+    }
+    ImmutableSet.Builder<CFAEdge> sleepSet = ImmutableSet.builder();
+    for (CFAEdge sleepingEdge : threadingState.getSleepSet()) {
+      if (areIndependent(cfaEdge, sleepingEdge)) {
+        sleepSet.add(sleepingEdge);
+      }
+    }
+    for (String id : threadingState.getThreadIds()) {
+      if (id.compareTo(activeThread) < 0 && isEnabledByLocks(threadingState, id)) {
+        for (CFAEdge edge : threadingState.getThreadLocation(id).getOutgoingEdges()) {
+          if (areIndependent(cfaEdge, edge)) {
+            sleepSet.add(edge);
+          }
+        }
+      }
+    }
+    return sleepSet.build();
+  }
+
+  /** check, whether the thread is not blocked by internal locks of another thread. */
+  private boolean isEnabledByLocks(final ThreadingState threadingState, final String threadId) {
+    return !(useAtomicLocks
+            && threadingState.hasLock(ATOMIC_LOCK)
+            && !threadingState.hasLock(threadId, ATOMIC_LOCK))
+        && !(useLocalAccessLocks
+            && threadingState.hasLock(LOCAL_ACCESS_LOCK)
+            && !threadingState.hasLock(threadId, LOCAL_ACCESS_LOCK));
+  }
+
+  private boolean areIndependent(final CFAEdge edge1, final CFAEdge edge2) {
+    return !isVisibleForPartialOrderReduction(edge2)
+        && independenceChecker.areIndependent(edge1, edge2);
+  }
+
+  /**
+   * Edges that influence the threading, terminate the program, or might be observed by the
+   * specification are dependent on all other edges and are never part of a sleep set.
+   */
+  private boolean isVisibleForPartialOrderReduction(final CFAEdge cfaEdge) {
+    if (useAllPossibleClones
+        || isImporantForThreading(cfaEdge)
+        || isEndOfMainFunction(cfaEdge)
+        || isTerminatingEdge(cfaEdge)) {
+      return true;
+    }
+    switch (cfaEdge.getEdgeType()) {
+      case StatementEdge: {
+        AStatement statement = ((AStatementEdge) cfaEdge).getStatement();
+        if (statement instanceof AFunctionCall) {
+          AExpression functionNameExp =
+              ((AFunctionCall) statement).getFunctionCallExpression().getFunctionNameExpression();
+          return !(functionNameExp instanceof AIdExpression
+              && ((AIdExpression) functionNameExp).getName().startsWith(VERIFIER_NONDET));
+        }
+        return false;
+      }
+      case FunctionCallEdge:
+        return cfaEdge.getSuccessor().getFunctionName().startsWith(VERIFIER_ATOMIC);
+      case FunctionReturnEdge:
+        // the assignment of the returned value is not visible in the AST of the edge
+        return cfaEdge.getPredecessor().getFunctionName().startsWith(VERIFIER_ATOMIC)
+            || ((FunctionReturnEdge) cfaEdge).getSummaryEdge().getExpression()
+                instanceof AFunctionCallAssignmentStatement;
+      default:
+        return false;
+    }
+  }
+
   /** Search for the thread, where the current edge is available.
    * The result should be exactly one thread, that is denoted as 'active',
    * or NULL, if no active thread is available.
@@ -97,6 +97,10 @@ public final class UsageInfo implements Comparable<UsageInfo> {
     return core.node;
   }
 
+  public @NonNull Access getAccess() {
+    return core.accessType;
+  }
+
   public @NonNull SingleIdentifier getId() {
     assert (core.id != null);
     return core.id;
@@ -55,6 +55,16 @@ public class UsageReachedSet extends PartitionedReachedSet {
     }
   }
 
+  @Override
+  public void removeAll(Iterable<? extends AbstractState> pToRemove) {
+    super.removeAll(pToRemove);
+    if (container != null) {
+      for (AbstractState state : pToRemove) {
+        container.removeState(UsageState.get(state));
+      }
+    }
+  }
+
   @Override
   public void add(AbstractState pState, Precision pPrecision) {
     super.add(pState, pPrecision);
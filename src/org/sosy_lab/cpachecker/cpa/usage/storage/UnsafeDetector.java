@@ -53,6 +53,15 @@ public class UnsafeDetector {
     return isUnsafe(set.getTopUsages());
   }
 
+  /**
+   * Check whether the given usage can be part of an unsafe at all. An identifier without such a
+   * usage can never be unsafe, independent of the other usages.
+   */
+  public boolean mayBePartOfUnsafe(UsageInfo usage) {
+    // a race requires at least one write access, other modes are not restricted
+    return config.getUnsafeMode() != UnsafeMode.RACE || usage.getAccess() == Access.WRITE;
+  }
+
   public Pair<UsageInfo, UsageInfo> getUnsafePair(AbstractUsagePointSet set) {
     assert isUnsafe(set);
 
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.cpa.usage.storage;
 
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -35,6 +36,16 @@ public final class UsageConfiguration {
       secure = true)
   private String intLockName = null;
 
+  @Option(
+      name = "unsafedetector.threads",
+      description =
+          "Number of threads for checking which identifiers have unsafe usages."
+              + " The identifiers are independent of each other, so with more than one thread"
+              + " they are checked in parallel.",
+      secure = true)
+  @IntegerOption(min = 1)
+  private int detectorThreads = 1;
+
   public UsageConfiguration(Configuration config) throws InvalidConfigurationException {
     config.inject(this);
   }
@@ -54,4 +65,8 @@ public final class UsageConfiguration {
   String getIntLockName() {
     return intLockName;
   }
+
+  int getDetectorThreads() {
+    return detectorThreads;
+  }
 }
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.cpa.usage.storage;
 
 import static com.google.common.base.Preconditions.checkArgument;
+import static com.google.common.collect.ImmutableSet.toImmutableSet;
 
 import com.google.common.base.Preconditions;
 import com.google.common.collect.HashMultiset;
@@ -26,6 +27,9 @@ import java.util.NavigableSet;
 import java.util.Set;
 import java.util.TreeMap;
 import java.util.TreeSet;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinTask;
+import java.util.concurrent.ForkJoinWorkerThread;
 import java.util.logging.Level;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cpa.lock.LockState;
@@ -97,6 +101,7 @@ public class UsageContainer {
   public void initContainerIfNecessary(FunctionContainer storage) {
     if (unsafeUsages == -1) {
       copyTimer.start();
+      markIdsWithoutPossibleUnsafes(storage);
       Set<Pair<FunctionContainer, Multiset<LockEffect>>> processedContainers = new HashSet<>();
       Deque<Pair<FunctionContainer, Multiset<LockEffect>>> waitlist = new ArrayDeque<>();
       Pair<FunctionContainer, Multiset<LockEffect>> first = Pair.of(storage, HashMultiset.create());
@@ -130,6 +135,43 @@ public class UsageContainer {
     }
   }
 
+  /**
+   * Mark all identifiers as false unsafes that do not have a single usage that may be part of an
+   * unsafe in any of the reachable containers. The usages of these identifiers are then never
+   * copied into point sets, which would be expensive for large programs with many identifiers
+   * that are, e.g., only read.
+   */
+  private void markIdsWithoutPossibleUnsafes(FunctionContainer storage) {
+    Set<FunctionContainer> processedContainers = new HashSet<>();
+    Deque<FunctionContainer> waitlist = new ArrayDeque<>();
+    Set<SingleIdentifier> allIds = new HashSet<>();
+    Set<SingleIdentifier> possibleUnsafes = new HashSet<>();
+    waitlist.add(storage);
+
+    while (!waitlist.isEmpty()) {
+      FunctionContainer currentContainer = waitlist.pollFirst();
+      if (processedContainers.add(currentContainer)) {
+        for (Entry<SingleIdentifier, NavigableSet<UsageInfo>> entry :
+            currentContainer.entrySet()) {
+          SingleIdentifier id = entry.getKey();
+          allIds.add(id);
+          if (!possibleUnsafes.contains(id)
+              && entry.getValue().stream().anyMatch(detector::mayBePartOfUnsafe)) {
+            possibleUnsafes.add(id);
+          }
+        }
+        waitlist.addAll(currentContainer.getContainers());
+      }
+    }
+
+    for (SingleIdentifier id : Sets.difference(allIds, possibleUnsafes)) {
+      // usages that were added before (e.g., for abort functions) are checked as usual
+      if (!refinedIds.containsKey(id) && !unrefinedIds.containsKey(id)) {
+        falseUnsafes.add(id);
+      }
+    }
+  }
+
   public void forceAddNewUsages(TemporaryUsageStorage storage) {
     //This is a case of 'abort'-functions
     assert (unsafeUsages == -1);
@@ -207,18 +249,14 @@ public class UsageContainer {
     if (unsafeUsages == -1) {
       processedUnsafes.clear();
       unsafeUsages = 0;
-      Set<SingleIdentifier> toDelete = new HashSet<>();
+      Set<SingleIdentifier> toDelete = findSafeIds();
 
       for (Entry<SingleIdentifier, UnrefinedUsagePointSet> entry : unrefinedIds.entrySet()) {
-        UnrefinedUsagePointSet tmpList = entry.getValue();
-        if (detector.isUnsafe(tmpList)) {
-          unsafeUsages += tmpList.size();
-        } else {
-          SingleIdentifier id = entry.getKey();
-          toDelete.add(id);
-          falseUnsafes.add(id);
+        if (!toDelete.contains(entry.getKey())) {
+          unsafeUsages += entry.getValue().size();
         }
       }
+      falseUnsafes.addAll(toDelete);
       toDelete.forEach(this::removeIdFromCaches);
 
       refinedIds.forEach((id, list) -> unsafeUsages += list.size());
@@ -231,6 +269,43 @@ public class UsageContainer {
     }
   }
 
+  /**
+   * Return the unrefined identifiers without unsafe usages, in the order of the identifiers. The
+   * check only reads the usage points of each identifier, so it can be done in parallel.
+   */
+  private Set<SingleIdentifier> findSafeIds() {
+    if (config.getDetectorThreads() == 1 || unrefinedIds.size() < 2) {
+      return unrefinedIds.entrySet().stream()
+          .filter(e -> !detector.isUnsafe(e.getValue()))
+          .map(Entry::getKey)
+          .collect(toImmutableSet());
+    }
+
+    ForkJoinPool pool =
+        new ForkJoinPool(
+            config.getDetectorThreads(),
+            p -> {
+              ForkJoinWorkerThread thread =
+                  ForkJoinPool.defaultForkJoinWorkerThreadFactory.newThread(p);
+              thread.setName("UnsafeDetector-worker-" + thread.getPoolIndex());
+              thread.setDaemon(true); // do not block termination of CPAchecker
+              return thread;
+            },
+            null,
+            false);
+    try {
+      return pool.invoke(
+          ForkJoinTask.adapt(
+              () ->
+                  unrefinedIds.entrySet().parallelStream()
+                      .filter(e -> !detector.isUnsafe(e.getValue()))
+                      .map(Entry::getKey)
+                      .collect(toImmutableSet())));
+    } finally {
+      pool.shutdownNow();
+    }
+  }
+
   private void removeIdFromCaches(SingleIdentifier id) {
     unrefinedIds.remove(id);
     processedUnsafes.add(id);
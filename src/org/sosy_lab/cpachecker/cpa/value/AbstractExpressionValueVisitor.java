@@ -626,7 +626,7 @@ public abstract class AbstractExpressionValueVisitor
         long lVal = lNum.getNumber().longValue();
         long rVal = rNum.getNumber().longValue();
         long result = arithmeticOperation(lVal, rVal, op, calculationType, machineModel, logger);
-        return new NumericValue(result);
+        return NumericValue.valueOf(result);
       }
         case INT128: {
           BigInteger lVal = lNum.bigInteger();
@@ -713,7 +713,7 @@ public abstract class AbstractExpressionValueVisitor
         float rVal = r.floatValue();
 
         if (Float.isNaN(lVal) || Float.isNaN(rVal)) {
-          return new NumericValue(op == BinaryOperator.NOT_EQUALS ? 1L : 0L);
+          return NumericValue.valueOf(op == BinaryOperator.NOT_EQUALS ? 1L : 0L);
         }
         if (lVal == 0 && rVal == 0) {
           cmp = 0;
@@ -727,7 +727,7 @@ public abstract class AbstractExpressionValueVisitor
         double rVal = r.doubleValue();
 
         if (Double.isNaN(lVal) || Double.isNaN(rVal)) {
-          return new NumericValue(op == BinaryOperator.NOT_EQUALS ? 1L : 0L);
+          return NumericValue.valueOf(op == BinaryOperator.NOT_EQUALS ? 1L : 0L);
         }
 
         if (lVal == 0 && rVal == 0) {
@@ -744,7 +744,7 @@ public abstract class AbstractExpressionValueVisitor
     }
 
     // return 1 if expression holds, 0 otherwise
-    return new NumericValue(matchBooleanOperation(op, cmp) ? 1L : 0L);
+    return NumericValue.valueOf(matchBooleanOperation(op, cmp) ? 1L : 0L);
   }
 
   /** returns True, iff cmp fulfills the boolean operation. */
@@ -1436,7 +1436,7 @@ public abstract class AbstractExpressionValueVisitor
 
   @Override
   public Value visit(CCharLiteralExpression pE) throws UnrecognizedCodeException {
-    return new NumericValue((long) pE.getCharacter());
+    return NumericValue.valueOf(pE.getCharacter());
   }
 
   @Override
@@ -1566,7 +1566,7 @@ public abstract class AbstractExpressionValueVisitor
 
   @Override
   public Value visit(JCharLiteralExpression pE) {
-    return new NumericValue((long) pE.getCharacter());
+    return NumericValue.valueOf(pE.getCharacter());
   }
 
   @Override
@@ -2378,6 +2378,16 @@ public abstract class AbstractExpressionValueVisitor
             return UnknownValue.getInstance();
         }
 
+          final boolean targetIsSigned = machineModel.isSigned(st);
+
+          if (isSmallIntegral(numericValue.getNumber())
+              && (size < SIZE_OF_JAVA_LONG || (size == SIZE_OF_JAVA_LONG && targetIsSigned))) {
+            // fast path without BigInteger: the cast only keeps the lowest 'size' bits
+            // and sign-extends them for signed targets, which is what the code below computes
+            return NumericValue.valueOf(
+                castToBits(numericValue.getNumber().longValue(), size, targetIsSigned));
+          }
+
         final BigInteger valueToCastAsInt;
         if (numericValue.getNumber() instanceof BigInteger) {
           valueToCastAsInt = numericValue.bigInteger();
@@ -2386,7 +2396,6 @@ public abstract class AbstractExpressionValueVisitor
         } else {
           valueToCastAsInt = BigInteger.valueOf(numericValue.longValue());
         }
-          final boolean targetIsSigned = machineModel.isSigned(st);
 
           final BigInteger maxValue = BigInteger.ONE.shiftLeft(size); // 2^size
           BigInteger result = valueToCastAsInt.remainder(maxValue); // shrink to number of bits
@@ -2465,6 +2474,23 @@ public abstract class AbstractExpressionValueVisitor
     }
   }
 
+  private static boolean isSmallIntegral(final Number n) {
+    return n instanceof Long || n instanceof Integer || n instanceof Short || n instanceof Byte;
+  }
+
+  /**
+   * Truncate the given value to its lowest <code>pSize</code> bits, interpreted as signed or
+   * unsigned number. <code>pSize</code> must not exceed 64, and must be less than 64 for unsigned
+   * interpretation.
+   */
+  private static long castToBits(final long pValue, final int pSize, final boolean pSigned) {
+    if (pSize >= SIZE_OF_JAVA_LONG) {
+      return pValue;
+    }
+    final int unusedBits = SIZE_OF_JAVA_LONG - pSize;
+    return pSigned ? (pValue << unusedBits) >> unusedBits : (pValue << unusedBits) >>> unusedBits;
+  }
+
   private static Value convertToBool(final NumericValue pValue) {
     Number n = pValue.getNumber();
     if (isBooleanFalseRepresentation(n)) {
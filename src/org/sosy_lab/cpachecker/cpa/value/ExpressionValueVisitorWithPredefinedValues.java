@@ -119,7 +119,12 @@ public class ExpressionValueVisitorWithPredefinedValues extends ExpressionValueV
       // } else if (type.isUnsigned()) {
       // return new NumericValue(Integer.parseUnsignedInt(pStringValueForNumber));
       // } else {
-      return new NumericValue(Integer.parseInt(pStringValueForNumber));
+      try {
+        return new NumericValue(Integer.parseInt(pStringValueForNumber));
+      } catch (NumberFormatException e) {
+        this.logger.log(
+            Level.WARNING, "Cannot parse value", pStringValueForNumber, ", returning unknown");
+      }
       // }
 
     } else {
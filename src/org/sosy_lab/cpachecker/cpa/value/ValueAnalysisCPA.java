@@ -22,6 +22,7 @@ import java.util.Map;
 import java.util.logging.Level;
 import java.util.regex.Matcher;
 import java.util.regex.Pattern;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
@@ -59,6 +60,8 @@ import org.sosy_lab.cpachecker.cpa.value.symbolic.SymbolicValueAnalysisPrecision
 import org.sosy_lab.cpachecker.cpa.value.symbolic.SymbolicValueAnalysisPrecisionAdjustment.SymbolicStatistics;
 import org.sosy_lab.cpachecker.cpa.value.symbolic.SymbolicValueAssigner;
 import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicValue;
+import org.sosy_lab.cpachecker.util.CFAFingerprints;
+import org.sosy_lab.cpachecker.util.CFAFingerprints.NodeMapping;
 import org.sosy_lab.cpachecker.util.StateToFormulaWriter;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 import org.sosy_lab.cpachecker.util.states.MemoryLocationValueHandler;
@@ -97,6 +100,16 @@ public class ValueAnalysisCPA extends AbstractCPA
   @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
   private Path initialPrecisionFile = null;
 
+  @Option(
+      secure = true,
+      description =
+          "file with the CFA fingerprints of the program version for which the initial precision"
+              + " was computed (cf. option cpa.value.precisionFingerprintFile). If given, the"
+              + " locations of the initial precision are mapped to the current program, and the"
+              + " precision of functions that were modified is ignored.")
+  @FileOption(FileOption.Type.OPTIONAL_INPUT_FILE)
+  private @Nullable Path initialPrecisionFingerprintFile = null;
+
   @Option(
       secure = true,
       name = "unknownValueHandling",
@@ -192,6 +205,7 @@ public class ValueAnalysisCPA extends AbstractCPA
     }
 
     Map<Integer, CFANode> idToCfaNode = createMappingForCFANodes(pCfa);
+    NodeMapping nodeMapping = readNodeMapping(pCfa);
     final Pattern CFA_NODE_PATTERN = Pattern.compile("N([0-9][0-9]*)");
 
     CFANode location = getDefaultLocation(idToCfaNode);
@@ -203,10 +217,13 @@ public class ValueAnalysisCPA extends AbstractCPA
         String scopeSelectors = currentLine.substring(0, currentLine.indexOf(":"));
         Matcher matcher = CFA_NODE_PATTERN.matcher(scopeSelectors);
         if (matcher.matches()) {
-          location = idToCfaNode.get(Integer.parseInt(matcher.group(1)));
+          int nodeNumber = Integer.parseInt(matcher.group(1));
+          // null for locations in modified functions, whose precision is skipped
+          location =
+              nodeMapping == null ? idToCfaNode.get(nodeNumber) : nodeMapping.getNode(nodeNumber);
         }
 
-      } else {
+      } else if (location != null) {
         mapping.put(location, MemoryLocation.valueOf(currentLine));
       }
     }
@@ -214,6 +231,26 @@ public class ValueAnalysisCPA extends AbstractCPA
     return mapping;
   }
 
+  /**
+   * Create the mapping from the program version of the initial precision to the current program,
+   * or return null if the initial precision is for the current program.
+   */
+  private @Nullable NodeMapping readNodeMapping(CFA pCfa) {
+    if (initialPrecisionFingerprintFile == null) {
+      return null;
+    }
+    try {
+      CFAFingerprints previous = CFAFingerprints.read(initialPrecisionFingerprintFile);
+      return CFAFingerprints.of(pCfa).mapFrom(previous, pCfa);
+    } catch (IOException | IllegalArgumentException e) {
+      logger.logUserException(
+          Level.WARNING,
+          e,
+          "Could not read CFA fingerprints, assuming initial precision is for current program");
+      return null;
+    }
+  }
+
   private CFANode getDefaultLocation(Map<Integer, CFANode> idToCfaNode) {
     return idToCfaNode.values().iterator().next();
   }
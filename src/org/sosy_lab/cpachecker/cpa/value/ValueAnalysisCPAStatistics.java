@@ -12,9 +12,11 @@ import java.io.IOException;
 import java.io.PrintStream;
 import java.io.Writer;
 import java.nio.charset.Charset;
+import java.nio.charset.StandardCharsets;
 import java.nio.file.Path;
 import java.util.concurrent.atomic.LongAdder;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -27,6 +29,7 @@ import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.CFAFingerprints;
 import org.sosy_lab.cpachecker.util.statistics.StatCounter;
 import org.sosy_lab.cpachecker.util.statistics.StatInt;
 import org.sosy_lab.cpachecker.util.statistics.StatKind;
@@ -39,6 +42,15 @@ public class ValueAnalysisCPAStatistics implements Statistics {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private Path precisionFile = null;
 
+  @Option(
+      secure = true,
+      description =
+          "file for exporting the CFA fingerprints of the program together with the precision,"
+              + " such that the precision can be reused for later versions of the program"
+              + " (cf. option cpa.value.initialPrecisionFingerprintFile)")
+  @FileOption(FileOption.Type.OUTPUT_FILE)
+  private @Nullable Path precisionFingerprintFile = null;
+
   private LongAdder iterations = new LongAdder();
   private StatCounter assumptions = new StatCounter("Number of assumptions");
   private StatCounter deterministicAssumptions =
@@ -96,6 +108,15 @@ public class ValueAnalysisCPAStatistics implements Statistics {
     } catch (IOException e) {
       cpa.getLogger().logUserException(Level.WARNING, e, "Could not write value-analysis precision to file");
     }
+
+    if (precisionFingerprintFile != null) {
+      try (Writer writer = IO.openOutputFile(precisionFingerprintFile, StandardCharsets.UTF_8)) {
+        CFAFingerprints.of(cpa.getCFA()).write(writer);
+      } catch (IOException e) {
+        cpa.getLogger()
+            .logUserException(Level.WARNING, e, "Could not write CFA fingerprints to file");
+      }
+    }
   }
 
 
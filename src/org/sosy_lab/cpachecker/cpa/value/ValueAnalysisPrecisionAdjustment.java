@@ -14,7 +14,6 @@ import com.google.common.base.Function;
 import com.google.common.collect.ImmutableSet;
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 import java.io.PrintStream;
-import java.util.Map.Entry;
 import java.util.Optional;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.IntegerOption;
@@ -36,11 +35,9 @@ import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.conditions.path.AssignmentsInPathCondition.UniqueAssignmentsInPathConditionState;
 import org.sosy_lab.cpachecker.cpa.location.LocationState;
-import org.sosy_lab.cpachecker.cpa.value.ValueAnalysisState.ValueAndType;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.LiveVariables;
-import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 import org.sosy_lab.cpachecker.util.statistics.StatCounter;
 import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
 import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer;
@@ -209,28 +206,30 @@ public class ValueAnalysisPrecisionAdjustment implements PrecisionAdjustment {
       LocationState location,
       UniqueAssignmentsInPathConditionState assignments) {
     ValueAnalysisState resultState = ValueAnalysisState.copyOf(pState);
+    boolean changed = false;
 
     if (options.doLivenessAbstraction && liveVariables.isPresent()) {
       totalLiveness.start();
-      enforceLiveness(pState, location, resultState);
+      changed |= enforceLiveness(location, resultState);
       totalLiveness.stop();
     }
 
     // compute the abstraction based on the value-analysis precision
     totalAbstraction.start();
     if (performPrecisionBasedAbstraction()) {
-      enforcePrecision(resultState, location, pPrecision);
+      changed |= enforcePrecision(resultState, location, pPrecision);
     }
     totalAbstraction.stop();
 
     // compute the abstraction for assignment thresholds
     if (assignments != null) {
       totalEnforcePath.start();
-      enforcePathThreshold(resultState, assignments);
+      changed |= enforcePathThreshold(resultState, assignments);
       totalEnforcePath.stop();
     }
 
-    resultState = resultState.equals(pState) ? pState : resultState;
+    // return the original instance if nothing was removed
+    resultState = changed ? resultState : pState;
 
     return Optional.of(PrecisionAdjustmentResult.create(resultState, pPrecision, Action.CONTINUE));
   }
@@ -265,7 +264,7 @@ public class ValueAnalysisPrecisionAdjustment implements PrecisionAdjustment {
     return performPrecisionBasedAbstraction;
   }
 
-  private void enforceLiveness(ValueAnalysisState pState, LocationState location, ValueAnalysisState resultState) {
+  private boolean enforceLiveness(LocationState location, ValueAnalysisState resultState) {
     CFANode actNode = location.getLocationNode();
 
     boolean hasMoreThanOneEnteringLeavingEdge = actNode.getNumEnteringEdges() > 1 || actNode.getNumLeavingEdges() > 1;
@@ -280,15 +279,14 @@ public class ValueAnalysisPrecisionAdjustment implements PrecisionAdjustment {
       // skip the abstraction, after a blank edge there cannot be a variable
       // less live
       if (!onlyBlankEdgesEntering) {
-        for (MemoryLocation variable : pState.getTrackedMemoryLocations()) {
-          if (!liveVariables
-              .orElseThrow()
-              .isVariableLive(variable.getAsSimpleString(), location.getLocationNode())) {
-            resultState.forget(variable);
-          }
-        }
+        return resultState.retainAll(
+            (variable, value) ->
+                liveVariables
+                    .orElseThrow()
+                    .isVariableLive(variable.getAsSimpleString(), location.getLocationNode()));
       }
     }
+    return false;
   }
 
   /**
@@ -297,25 +295,25 @@ public class ValueAnalysisPrecisionAdjustment implements PrecisionAdjustment {
    * @param location the current location
    * @param state the current state
    * @param precision the current precision
+   * @return whether any variable was removed from the state
    */
-  private void enforcePrecision(ValueAnalysisState state, LocationState location, VariableTrackingPrecision precision) {
+  private boolean enforcePrecision(
+      ValueAnalysisState state, LocationState location, VariableTrackingPrecision precision) {
     if (options.abstractAtEachLocation()
         || options.abstractAtBranch(location)
         || options.abstractAtJoin(location)
         || options.abstractAtFunction(location)
         || options.abstractAtLoop(location)) {
 
-      for (Entry<MemoryLocation, ValueAndType> e : state.getConstants()) {
-        MemoryLocation memoryLocation = e.getKey();
-        if (location != null
-            && !precision.isTracking(
-                memoryLocation, e.getValue().getType(), location.getLocationNode())) {
-          state.forget(memoryLocation);
-        }
-      }
-
       abstractions.inc();
+
+      if (location != null) {
+        return state.retainAll(
+            (memoryLocation, value) ->
+                precision.isTracking(memoryLocation, value.getType(), location.getLocationNode()));
+      }
     }
+    return false;
   }
 
   /**
@@ -323,18 +321,16 @@ public class ValueAnalysisPrecisionAdjustment implements PrecisionAdjustment {
    *
    * @param state the state to abstract
    * @param assignments the assignment information
+   * @return whether any variable was removed from the state
    */
-  private void enforcePathThreshold(ValueAnalysisState state,
+  private boolean enforcePathThreshold(ValueAnalysisState state,
       UniqueAssignmentsInPathConditionState assignments) {
 
     // forget the value for all variables that exceed their threshold
-    for (Entry<MemoryLocation, ValueAndType> e : state.getConstants()) {
-      MemoryLocation memoryLocation = e.getKey();
-      assignments.updateAssignmentInformation(memoryLocation, e.getValue().getValue());
-
-      if (assignments.exceedsThreshold(memoryLocation)) {
-        state.forget(memoryLocation);
-      }
-    }
+    return state.retainAll(
+        (memoryLocation, value) -> {
+          assignments.updateAssignmentInformation(memoryLocation, value.getValue());
+          return !assignments.exceedsThreshold(memoryLocation);
+        });
   }
 }
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.cpa.value;
 
 import static com.google.common.base.Preconditions.checkNotNull;
+import static org.sosy_lab.common.collect.Collections3.transformedImmutableSetCopy;
 
 import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
@@ -19,11 +20,14 @@ import java.math.BigInteger;
 import java.util.ArrayList;
 import java.util.Collections;
 import java.util.HashSet;
+import java.util.Iterator;
 import java.util.List;
+import java.util.Map;
 import java.util.Map.Entry;
 import java.util.Objects;
 import java.util.Optional;
 import java.util.Set;
+import java.util.function.BiPredicate;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.collect.PathCopyingPersistentTreeMap;
 import org.sosy_lab.common.collect.PersistentMap;
@@ -53,6 +57,7 @@ import org.sosy_lab.cpachecker.cfa.types.c.CType;
 import org.sosy_lab.cpachecker.cfa.types.c.CTypes;
 import org.sosy_lab.cpachecker.core.defaults.LatticeAbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractQueryableState;
+import org.sosy_lab.cpachecker.core.interfaces.CoverageIndexable;
 import org.sosy_lab.cpachecker.core.interfaces.ExpressionTreeReportingState;
 import org.sosy_lab.cpachecker.core.interfaces.FormulaReportingState;
 import org.sosy_lab.cpachecker.core.interfaces.Graphable;
@@ -65,6 +70,7 @@ import org.sosy_lab.cpachecker.cpa.value.type.NumericValue;
 import org.sosy_lab.cpachecker.cpa.value.type.Value;
 import org.sosy_lab.cpachecker.exceptions.InvalidQueryException;
 import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
+import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.expressions.ExpressionTree;
 import org.sosy_lab.cpachecker.util.expressions.ExpressionTreeFactory;
 import org.sosy_lab.cpachecker.util.expressions.ExpressionTrees;
@@ -84,7 +90,7 @@ import org.sosy_lab.java_smt.api.FormulaType.FloatingPointType;
 public final class ValueAnalysisState
     implements AbstractQueryableState, FormulaReportingState, ExpressionTreeReportingState,
         ForgetfulState<ValueAnalysisInformation>, Serializable, Graphable,
-        LatticeAbstractState<ValueAnalysisState>, PseudoPartitionable {
+        LatticeAbstractState<ValueAnalysisState>, PseudoPartitionable, CoverageIndexable {
 
   private static final long serialVersionUID = -3152134511524554358L;
 
@@ -107,6 +113,18 @@ public final class ValueAnalysisState
    */
   private int hashCode = 0;
 
+  /** Number of bits of {@link #fingerprint}, must be a multiple of 64. */
+  private static final int FINGERPRINT_BITS = 256;
+
+  /**
+   * Bloom filter over the pairs of memory location and value (ignoring types) in {@link
+   * #constantsMap}, used by {@link #isLessOrEqual(ValueAnalysisState)} to reject most non-covering
+   * states without iterating over the map. It is computed lazily and reset with every change of
+   * {@link #constantsMap}, so it is computed only once for states in the reached set, and copies of
+   * a state share it. A computed array is never modified.
+   */
+  private transient volatile long @Nullable [] fingerprint = null;
+
   private final @Nullable MachineModel machineModel;
 
   public ValueAnalysisState(MachineModel pMachineModel) {
@@ -133,6 +151,7 @@ public final class ValueAnalysisState
     machineModel = state.machineModel;
     constantsMap = checkNotNull(state.constantsMap);
     hashCode = state.hashCode;
+    fingerprint = state.fingerprint;
     assert hashCode == constantsMap.hashCode();
   }
 
@@ -171,6 +190,7 @@ public final class ValueAnalysisState
     }
     constantsMap = constantsMap.putAndCopy(pMemLoc, valueAndType);
     hashCode += (pMemLoc.hashCode() ^ valueAndType.hashCode());
+    fingerprint = null;
   }
 
   /**
@@ -240,6 +260,7 @@ public final class ValueAnalysisState
     ValueAndType value = constantsMap.get(pMemoryLocation);
     constantsMap = constantsMap.removeAndCopy(pMemoryLocation);
     hashCode -= (pMemoryLocation.hashCode() ^ value.hashCode());
+    fingerprint = null;
 
     PersistentMap<MemoryLocation, ValueAndType> valueAssignment = PathCopyingPersistentTreeMap.of();
     valueAssignment = valueAssignment.putAndCopy(pMemoryLocation, value);
@@ -247,6 +268,31 @@ public final class ValueAnalysisState
     return new ValueAnalysisInformation(valueAssignment);
   }
 
+  /**
+   * Removes all memory locations for which the given predicate does not hold. In contrast to
+   * repeated calls of {@link #forget(MemoryLocation)}, this needs one traversal of the map and does
+   * not collect information about the removed values. The predicate is evaluated exactly once for
+   * each memory location, in the order of the map.
+   *
+   * @param pKeep the predicate that decides whether a memory location and its value are kept
+   * @return whether any memory location was removed
+   */
+  public boolean retainAll(BiPredicate<MemoryLocation, ValueAndType> pKeep) {
+    PersistentMap<MemoryLocation, ValueAndType> newConstantsMap = constantsMap;
+    for (Entry<MemoryLocation, ValueAndType> entry : constantsMap.entrySet()) {
+      if (!pKeep.test(entry.getKey(), entry.getValue())) {
+        newConstantsMap = newConstantsMap.removeAndCopy(entry.getKey());
+        hashCode -= (entry.getKey().hashCode() ^ entry.getValue().hashCode());
+      }
+    }
+    if (newConstantsMap == constantsMap) {
+      return false;
+    }
+    constantsMap = newConstantsMap;
+    fingerprint = null;
+    return true;
+  }
+
   @Override
   public void remember(final MemoryLocation pLocation, final ValueAnalysisInformation pValueAndType) {
     final ValueAndType value = pValueAndType.getAssignments().get(pLocation);
@@ -397,6 +443,11 @@ public final class ValueAnalysisState
       return false;
     }
 
+    // if any entry of the other state is definitely missing in this state, it is not covered
+    if (!mayContainAllValues(getFingerprint(), other.getFingerprint())) {
+      return false;
+    }
+
     // also, this element is not less or equal than the other element,
     // if any one constant's value of the other element differs from the constant's value in this
     // element
@@ -407,6 +458,9 @@ public final class ValueAnalysisState
     // }
 
     // the tolerant way: ignore all type information. TODO really correct?
+    if (isSortedNaturally(constantsMap) && isSortedNaturally(other.constantsMap)) {
+      return containsAllValuesInOrder(other);
+    }
     for (Entry<MemoryLocation, ValueAndType> otherEntry : other.constantsMap.entrySet()) {
       MemoryLocation key = otherEntry.getKey();
       Value otherValue = otherEntry.getValue().getValue();
@@ -419,6 +473,72 @@ public final class ValueAnalysisState
     return true;
   }
 
+  private long[] getFingerprint() {
+    long[] result = fingerprint;
+    if (result == null) {
+      result = new long[FINGERPRINT_BITS / Long.SIZE];
+      for (Entry<MemoryLocation, ValueAndType> entry : constantsMap.entrySet()) {
+        int hash = 31 * entry.getKey().hashCode() + entry.getValue().getValue().hashCode();
+        // two bits per entry, taken from the well-mixed upper bits of the hash
+        hash *= 0x9E3779B9;
+        setBit(result, hash >>> 24);
+        setBit(result, hash >>> 16);
+      }
+      fingerprint = result;
+    }
+    return result;
+  }
+
+  private static void setBit(long[] pBits, int pHash) {
+    int bit = pHash & (FINGERPRINT_BITS - 1);
+    pBits[bit / Long.SIZE] |= 1L << bit;
+  }
+
+  /** Returns false if the fingerprints show that an entry of pContained is not in pContaining. */
+  private static boolean mayContainAllValues(long[] pContaining, long[] pContained) {
+    for (int i = 0; i < pContaining.length; i++) {
+      if ((pContained[i] & ~pContaining[i]) != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  private static boolean isSortedNaturally(Map<MemoryLocation, ValueAndType> pMap) {
+    // PathCopyingPersistentTreeMap always uses the natural ordering
+    return pMap instanceof PathCopyingPersistentTreeMap;
+  }
+
+  /**
+   * Check whether this state contains all values of the other state (ignoring types) by iterating
+   * over both sorted maps simultaneously. This needs linear time instead of one tree lookup per
+   * entry of the other state, and comparing equal memory locations is cheap because they are
+   * interned.
+   */
+  private boolean containsAllValuesInOrder(ValueAnalysisState other) {
+    Iterator<Entry<MemoryLocation, ValueAndType>> thisEntries = constantsMap.entrySet().iterator();
+    for (Entry<MemoryLocation, ValueAndType> otherEntry : other.constantsMap.entrySet()) {
+      MemoryLocation key = otherEntry.getKey();
+      while (true) {
+        if (!thisEntries.hasNext()) {
+          return false;
+        }
+        Entry<MemoryLocation, ValueAndType> thisEntry = thisEntries.next();
+        int cmp = thisEntry.getKey().compareTo(key);
+        if (cmp == 0) {
+          if (!otherEntry.getValue().getValue().equals(thisEntry.getValue().getValue())) {
+            return false;
+          }
+          break;
+        } else if (cmp > 0) {
+          // key is missing in this state
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
   @Override
   public boolean equals(Object other) {
     if (this == other) {
@@ -759,6 +879,17 @@ public final class ValueAnalysisState
     return this;
   }
 
+  /**
+   * The keys are the assignments of this state, because a state can only be less or equal to
+   * another state if it contains all assignments of the other state (cf. {@link
+   * #isLessOrEqual(ValueAnalysisState)}, where types are ignored).
+   */
+  @Override
+  public Set<?> getCoverageIndexKeys() {
+    return transformedImmutableSetCopy(
+        constantsMap.entrySet(), e -> Pair.of(e.getKey(), e.getValue().getValue()));
+  }
+
   @Override
   public ExpressionTree<Object> getFormulaApproximation(
       FunctionEntryNode pFunctionScope, CFANode pLocation) {
@@ -0,0 +1,67 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.value;
+
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
+import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
+import org.sosy_lab.cpachecker.cpa.value.type.NumericValue;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+
+/**
+ * Micro benchmark for the operators of {@link ValueAnalysisState} that are used by merge and stop,
+ * on two states that differ in the value of one of their variables.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(1)
+@Warmup(iterations = 3)
+@Measurement(iterations = 5)
+public class ValueAnalysisStateBenchmark {
+
+  @Param({"10", "1000"})
+  private int size;
+
+  private ValueAnalysisState first;
+  private ValueAnalysisState second;
+
+  @Setup
+  public void setUp() {
+    first = new ValueAnalysisState(MachineModel.LINUX32);
+    second = new ValueAnalysisState(MachineModel.LINUX32);
+    for (int i = 0; i < size; i++) {
+      MemoryLocation variable = MemoryLocation.valueOf("main::x" + i);
+      first.assignConstant(variable, new NumericValue(i), CNumericTypes.INT);
+      second.assignConstant(
+          variable, new NumericValue(i == size / 2 ? -1 : i), CNumericTypes.INT);
+    }
+  }
+
+  @Benchmark
+  public boolean isLessOrEqual() {
+    return first.isLessOrEqual(second);
+  }
+
+  @Benchmark
+  public ValueAnalysisState join() {
+    return first.join(second);
+  }
+}
@@ -138,7 +138,8 @@ public class ValueAnalysisTransferRelation
   // the value of the map entry is the explanation for the user
   private static final ImmutableMap<String, String> UNSUPPORTED_FUNCTIONS = ImmutableMap.of();
 
-  private static final AtomicInteger indexForNextRandomValue = new AtomicInteger();
+  // per instance, such that several analyses can replay their own inputs
+  private final AtomicInteger indexForNextRandomValue = new AtomicInteger();
 
   @Options(prefix = "cpa.value")
   public static class ValueTransferOptions {
@@ -1742,7 +1743,7 @@ public class ValueAnalysisTransferRelation
       return new ExpressionValueVisitorWithPredefinedValues(
           pState,
           pFunctionName,
-          ValueAnalysisTransferRelation.indexForNextRandomValue,
+          indexForNextRandomValue,
           machineModel,
           logger,
           valuesFromFile);
@@ -19,6 +19,7 @@ import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
 import org.sosy_lab.cpachecker.core.interfaces.Refiner;
 import org.sosy_lab.cpachecker.cpa.arg.ARGBasedRefiner;
+import org.sosy_lab.cpachecker.cpa.arg.ARGReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.AbstractARGBasedRefiner;
 import org.sosy_lab.cpachecker.cpa.arg.path.ARGPath;
 import org.sosy_lab.cpachecker.cpa.value.ValueAnalysisCPA;
@@ -27,6 +28,7 @@ import org.sosy_lab.cpachecker.cpa.value.refiner.utils.SortingPathExtractor;
 import org.sosy_lab.cpachecker.cpa.value.refiner.utils.ValueAnalysisFeasibilityChecker;
 import org.sosy_lab.cpachecker.cpa.value.refiner.utils.ValueAnalysisInterpolantManager;
 import org.sosy_lab.cpachecker.cpa.value.refiner.utils.ValueAnalysisPrefixProvider;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.util.CPAs;
 import org.sosy_lab.cpachecker.util.refinement.GenericPrefixProvider;
 import org.sosy_lab.cpachecker.util.refinement.InterpolationTree;
@@ -41,6 +43,8 @@ public class ValueAnalysisGlobalRefiner extends ValueAnalysisRefiner {
       description = "whether to use the top-down interpolation strategy or the bottom-up interpolation strategy")
   private boolean useTopDownInterpolationStrategy = true;
 
+  private final CFA cfa;
+
   public static Refiner create(final ConfigurableProgramAnalysis pCpa)
       throws InvalidConfigurationException {
     return AbstractARGBasedRefiner.forARGBasedRefiner(create0(pCpa), pCpa);
@@ -99,6 +103,25 @@ public class ValueAnalysisGlobalRefiner extends ValueAnalysisRefiner {
         pCfa);
 
     pConfig.inject(this, ValueAnalysisGlobalRefiner.class);
+    cfa = pCfa;
+  }
+
+  @Override
+  protected StrongestPostOperator<ValueAnalysisState> createStrongestPostOperator()
+      throws InvalidConfigurationException {
+    return new ValueAnalysisStrongestPostOperator(
+        logger, Configuration.defaultConfiguration(), cfa);
+  }
+
+  /**
+   * This method returns the given path together with the infeasible paths to all other targets,
+   * such that all infeasible targets are refined at once.
+   */
+  @Override
+  protected List<ARGPath> getPathsForInterpolation(
+      final ARGReachedSet pReached, final ARGPath pInfeasibleTargetPath)
+      throws CPAException, InterruptedException {
+    return getInfeasibleTargetPaths(pReached, pInfeasibleTargetPath);
   }
 
   /**
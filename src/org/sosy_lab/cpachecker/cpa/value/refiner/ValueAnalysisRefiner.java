@@ -28,7 +28,6 @@ import java.util.HashSet;
 import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
-import java.util.Map.Entry;
 import java.util.Objects;
 import java.util.Set;
 import java.util.TreeSet;
@@ -69,6 +68,7 @@ import org.sosy_lab.cpachecker.util.refinement.GenericPrefixProvider;
 import org.sosy_lab.cpachecker.util.refinement.GenericRefiner;
 import org.sosy_lab.cpachecker.util.refinement.InterpolationTree;
 import org.sosy_lab.cpachecker.util.refinement.PathExtractor;
+import org.sosy_lab.cpachecker.util.refinement.PathInterpolator;
 import org.sosy_lab.cpachecker.util.refinement.StrongestPostOperator;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
 import org.sosy_lab.cpachecker.util.statistics.StatCounter;
@@ -125,6 +125,10 @@ public class ValueAnalysisRefiner
 
   private final ShutdownNotifier shutdownNotifier;
 
+  private final Configuration config;
+
+  private final CFA cfa;
+
   // Statistics
   private final StatCounter rootRelocations = new StatCounter("Number of root relocations");
   private final StatCounter repeatedRefinements = new StatCounter("Number of similar, repeated refinements");
@@ -189,6 +193,32 @@ public class ValueAnalysisRefiner
     checker = pFeasibilityChecker;
     concreteErrorPathAllocator = new ValueAnalysisConcreteErrorPathAllocator(pConfig, logger, pCfa.getMachineModel());
     shutdownNotifier = pShutdownNotifier;
+    config = pConfig;
+    cfa = pCfa;
+  }
+
+  /**
+   * This method creates a new strongest-post operator like the one this refiner was created with.
+   */
+  protected StrongestPostOperator<ValueAnalysisState> createStrongestPostOperator()
+      throws InvalidConfigurationException {
+    return new ValueAnalysisStrongestPostOperator(logger, config, cfa);
+  }
+
+  @Override
+  protected PathInterpolator<ValueAnalysisInterpolant> createPathInterpolatorForThread()
+      throws InvalidConfigurationException {
+    // the transfer relation of the strongest-post operator is not thread-safe,
+    // so each interpolator needs its own operator, feasibility checker, and prefix provider
+    final StrongestPostOperator<ValueAnalysisState> strongestPostOp = createStrongestPostOperator();
+    return new ValueAnalysisPathInterpolator(
+        new ValueAnalysisFeasibilityChecker(strongestPostOp, logger, cfa, config),
+        strongestPostOp,
+        new ValueAnalysisPrefixProvider(logger, cfa, config, shutdownNotifier),
+        config,
+        logger,
+        shutdownNotifier,
+        cfa);
   }
 
   @Override
@@ -243,17 +273,15 @@ public class ValueAnalysisRefiner
       refinementInformation.put(root, precisions);
     }
 
-    for (Entry<ARGState, List<Precision>> info : refinementInformation.entrySet()) {
-      shutdownNotifier.shutdownIfNecessary();
-      List<Predicate<? super Precision>> precisionTypes = new ArrayList<>(2);
-
-      precisionTypes.add(VariableTrackingPrecision.isMatchingCPAClass(ValueAnalysisCPA.class));
-      if (predicatePrecisionIsAvailable) {
-        precisionTypes.add(Predicates.instanceOf(PredicatePrecision.class));
-      }
+    shutdownNotifier.shutdownIfNecessary();
+    List<Predicate<? super Precision>> precisionTypes = new ArrayList<>(2);
 
-      pReached.removeSubtree(info.getKey(), info.getValue(), precisionTypes);
+    precisionTypes.add(VariableTrackingPrecision.isMatchingCPAClass(ValueAnalysisCPA.class));
+    if (predicatePrecisionIsAvailable) {
+      precisionTypes.add(Predicates.instanceOf(PredicatePrecision.class));
     }
+
+    pReached.removeSubtrees(refinementInformation, precisionTypes);
   }
 
   private boolean isPredicatePrecisionAvailable(final UnmodifiableReachedSet pReached) {
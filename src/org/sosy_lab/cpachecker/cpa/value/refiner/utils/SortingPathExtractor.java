@@ -19,9 +19,9 @@ import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cpa.arg.ARGParentIndex;
 import org.sosy_lab.cpachecker.cpa.arg.ARGReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
-import org.sosy_lab.cpachecker.cpa.arg.ARGUtils;
 import org.sosy_lab.cpachecker.cpa.arg.path.ARGPath;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.exceptions.RefinementFailedException;
@@ -71,13 +71,14 @@ public class SortingPathExtractor extends PathExtractor {
   @Override
   public Collection<ARGState> getTargetStates(final ARGReachedSet pReached) throws RefinementFailedException {
     final Collection<ARGState> targetStates = super.getTargetStates(pReached);
-    final Map<ARGState, Integer> targetsWithScores = Maps.toMap(targetStates, this::getScore);
+    final ARGParentIndex parentIndex = pReached.getParentIndex();
+    final Map<ARGState, Integer> targetsWithScores =
+        Maps.toMap(targetStates, target -> getScore(parentIndex.getOnePathTo(target)));
     // sort keys by their values
     return ImmutableList.sortedCopyOf(Comparator.comparing(targetsWithScores::get), targetStates);
   }
 
-  private int getScore(ARGState target) {
-    ARGPath path = ARGUtils.getOnePathTo(target);
+  private int getScore(ARGPath path) {
     if (itpSortedTargets) {
       List<InfeasiblePrefix> prefixes;
       try {
@@ -13,10 +13,13 @@ import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cpa.arg.path.ARGPath;
+import org.sosy_lab.cpachecker.cpa.conditions.path.AssignmentsInPathCondition.UniqueAssignmentsInPathConditionState;
 import org.sosy_lab.cpachecker.cpa.value.ValueAnalysisCPA;
 import org.sosy_lab.cpachecker.cpa.value.ValueAnalysisInformation;
 import org.sosy_lab.cpachecker.cpa.value.ValueAnalysisState;
 import org.sosy_lab.cpachecker.cpa.value.refiner.ValueAnalysisInterpolant;
+import org.sosy_lab.cpachecker.util.AbstractStates;
 import org.sosy_lab.cpachecker.util.refinement.FeasibilityChecker;
 import org.sosy_lab.cpachecker.util.refinement.GenericEdgeInterpolator;
 import org.sosy_lab.cpachecker.util.refinement.StrongestPostOperator;
@@ -46,4 +49,15 @@ public class ValueAnalysisEdgeInterpolator
         pShutdownNotifier,
         pCfa);
   }
+
+  /**
+   * The strongest-post operator forgets the values of memory locations that exceed the thresholds
+   * of the path-condition state of the target, so caching is only possible without it.
+   */
+  @Override
+  protected boolean isCachingPossible(final ARGPath pErrorPath) {
+    return AbstractStates.extractStateByType(
+            pErrorPath.getLastState(), UniqueAssignmentsInPathConditionState.class)
+        == null;
+  }
 }
@@ -31,7 +31,10 @@ public abstract class BinarySymbolicExpression extends SymbolicExpression {
   /**
    * {@link Type} of the binary expression
    */
-  private Type expressionType;
+  private final Type expressionType;
+
+  /** Cached, because hash-consing and constraint caches hash complete expression trees often. */
+  private transient int hashCode = 0;
 
   BinarySymbolicExpression(
       SymbolicExpression pOperand1,
@@ -99,7 +102,10 @@ public abstract class BinarySymbolicExpression extends SymbolicExpression {
 
   @Override
   public final int hashCode() {
-    return super.hashCode() + Objects.hash(getClass(), operand1, operand2, expressionType);
+    if (hashCode == 0) {
+      hashCode = super.hashCode() + Objects.hash(getClass(), operand1, operand2, expressionType);
+    }
+    return hashCode;
   }
 
   @Override
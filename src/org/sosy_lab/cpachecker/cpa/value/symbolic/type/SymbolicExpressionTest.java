@@ -60,4 +60,27 @@ public class SymbolicExpressionTest {
     assertThat(neg1).isEqualTo(neg2);
     assertThat(neg1).isNotEqualTo(ptr);
   }
+
+  @Test
+  public void testFactory_sharesEqualExpressions() {
+    SymbolicValueFactory factory = SymbolicValueFactory.getInstance();
+    SymbolicExpression add1 =
+        factory.add(
+            factory.asConstant(new NumericValue(1), OP_TYPE),
+            factory.asConstant(new NumericValue(5), OP_TYPE),
+            PROMOTED_OP_TYPE,
+            PROMOTED_OP_TYPE);
+    SymbolicExpression add2 =
+        factory.add(
+            factory.asConstant(new NumericValue(1), OP_TYPE),
+            factory.asConstant(new NumericValue(5), OP_TYPE),
+            PROMOTED_OP_TYPE,
+            PROMOTED_OP_TYPE);
+
+    assertThat(add1).isSameInstanceAs(add2);
+    assertThat(add1).isEqualTo(new AdditionExpression(CONSTANT_OP1,
+        CONSTANT_OP2,
+        PROMOTED_OP_TYPE,
+        PROMOTED_OP_TYPE));
+  }
 }
@@ -10,6 +10,8 @@ package org.sosy_lab.cpachecker.cpa.value.symbolic.type;
 
 import static com.google.common.base.Preconditions.checkNotNull;
 
+import com.google.common.collect.Interner;
+import com.google.common.collect.Interners;
 import java.util.Optional;
 import org.sosy_lab.cpachecker.cfa.types.MachineModel;
 import org.sosy_lab.cpachecker.cfa.types.Type;
@@ -23,10 +25,18 @@ import org.sosy_lab.cpachecker.util.states.MemoryLocation;
  * Factory for creating {@link SymbolicValue}s.
  * All {@link SymbolicExpression}s created with this factory use canonical C types, as provided by
  * {@link CType#getCanonicalType()}.
+ *
+ * <p>Created expressions are hash-consed: equal expressions created along different paths are the
+ * same object, so their (sub-)trees are shared, and equality checks and lookups in caches keyed by
+ * expressions or constraints (e.g., the formula cache of the constraints solver) are cheap.
  */
 public class SymbolicValueFactory {
 
   private static final SymbolicValueFactory SINGLETON = new SymbolicValueFactory();
+
+  /** Weak, so expressions that are no longer referenced by any state can be collected. */
+  private static final Interner<SymbolicExpression> EXPRESSIONS = Interners.newWeakInterner();
+
   private int idCounter = 0;
 
   private SymbolicValueFactory() {
@@ -41,6 +51,11 @@ public class SymbolicValueFactory {
     SINGLETON.idCounter = 0;
   }
 
+  @SuppressWarnings("unchecked") // equal expressions are always of the same class
+  private static <T extends SymbolicExpression> T intern(T pExpression) {
+    return (T) EXPRESSIONS.intern(pExpression);
+  }
+
   public SymbolicIdentifier newIdentifier(MemoryLocation pMemoryLocation) {
     return new SymbolicIdentifier(idCounter++, pMemoryLocation);
   }
@@ -52,18 +67,22 @@ public class SymbolicValueFactory {
       return ((SymbolicExpression) pValue);
 
     } else {
-      return new ConstantSymbolicExpression(pValue, getCanonicalType(pType));
+      return intern(new ConstantSymbolicExpression(pValue, getCanonicalType(pType)));
     }
   }
 
   public SymbolicExpression multiply(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new MultiplicationExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new MultiplicationExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression add(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new AdditionExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new AdditionExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression minus(SymbolicExpression pOperand1, SymbolicExpression pOperand2,
@@ -71,7 +90,9 @@ public class SymbolicValueFactory {
 
     Type canonicalCalcType = getCanonicalType(pCalculationType);
 
-    return new SubtractionExpression(pOperand1, pOperand2, getCanonicalType(pType), canonicalCalcType);
+    return intern(
+        new SubtractionExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), canonicalCalcType));
   }
 
   public SymbolicExpression negate(SymbolicExpression pFormula, Type pType) {
@@ -80,66 +101,94 @@ public class SymbolicValueFactory {
       return ((NegationExpression) pFormula).getOperand();
 
     } else {
-      return new NegationExpression(pFormula, pType);
+      return intern(new NegationExpression(pFormula, pType));
     }
   }
 
   public SymbolicExpression divide(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new DivisionExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new DivisionExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
 
   }
 
   public SymbolicExpression modulo(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new ModuloExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new ModuloExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression shiftLeft(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new ShiftLeftExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new ShiftLeftExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression shiftRightSigned(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new ShiftRightExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType),
-        ShiftRightExpression.ShiftType.SIGNED);
+    return intern(
+        new ShiftRightExpression(
+            pOperand1,
+            pOperand2,
+            getCanonicalType(pType),
+            getCanonicalType(pCalculationType),
+            ShiftRightExpression.ShiftType.SIGNED));
   }
 
   public SymbolicExpression shiftRightUnsigned(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new ShiftRightExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType),
-        ShiftRightExpression.ShiftType.UNSIGNED);
+    return intern(
+        new ShiftRightExpression(
+            pOperand1,
+            pOperand2,
+            getCanonicalType(pType),
+            getCanonicalType(pCalculationType),
+            ShiftRightExpression.ShiftType.UNSIGNED));
   }
 
   public SymbolicExpression binaryAnd(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new BinaryAndExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new BinaryAndExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression binaryOr(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new BinaryOrExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new BinaryOrExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression binaryXor(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new BinaryXorExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new BinaryXorExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public EqualsExpression equal(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new EqualsExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new EqualsExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression lessThan(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new LessThanExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new LessThanExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression lessThanOrEqual(SymbolicExpression pOperand1, SymbolicExpression pOperand2,
       Type pType, Type pCalculationType) {
-    return new LessThanOrEqualExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new LessThanOrEqualExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression notEqual(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
@@ -149,12 +198,16 @@ public class SymbolicValueFactory {
 
   public SymbolicExpression logicalAnd(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new LogicalAndExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new LogicalAndExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression logicalOr(SymbolicExpression pOperand1, SymbolicExpression pOperand2, Type pType,
       Type pCalculationType) {
-    return new LogicalOrExpression(pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new LogicalOrExpression(
+            pOperand1, pOperand2, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression logicalNot(SymbolicExpression pOperand, Type pType) {
@@ -163,7 +216,7 @@ public class SymbolicValueFactory {
       return ((LogicalNotExpression) pOperand).getOperand();
 
     } else {
-      return new LogicalNotExpression(pOperand, getCanonicalType(pType));
+      return intern(new LogicalNotExpression(pOperand, getCanonicalType(pType)));
     }
   }
 
@@ -173,7 +226,7 @@ public class SymbolicValueFactory {
       return ((BinaryNotExpression) pOperand).getOperand();
 
     } else {
-      return new BinaryNotExpression(pOperand, getCanonicalType(pType));
+      return intern(new BinaryNotExpression(pOperand, getCanonicalType(pType)));
     }
   }
 
@@ -181,14 +234,18 @@ public class SymbolicValueFactory {
       Type pCalculationType) {
 
     // represent 'a > b' as 'b < a' so we do need less classes
-    return new LessThanExpression(pOperand2, pOperand1, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new LessThanExpression(
+            pOperand2, pOperand1, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   public SymbolicExpression greaterThanOrEqual(SymbolicExpression pOperand1, SymbolicExpression pOperand2,
       Type pType, Type pCalculationType) {
 
     // represent 'a >= b' as 'b <= a' so we do need less classes
-    return new LessThanOrEqualExpression(pOperand2, pOperand1, getCanonicalType(pType), getCanonicalType(pCalculationType));
+    return intern(
+        new LessThanOrEqualExpression(
+            pOperand2, pOperand1, getCanonicalType(pType), getCanonicalType(pCalculationType)));
   }
 
   /**
@@ -218,7 +275,7 @@ public class SymbolicValueFactory {
     } else {
       boolean isCast = operand instanceof CastExpression;
 
-      operand = new CastExpression(operand, canonicalTargetType);
+      operand = intern(new CastExpression(operand, canonicalTargetType));
 
       if (isCast) {
         operand = simplifyCasts((CastExpression) operand, pMachineModel);
@@ -284,7 +341,7 @@ public class SymbolicValueFactory {
 
   public PointerExpression pointer(SymbolicExpression pOperand, Type pType) {
     checkNotNull(pOperand);
-    return new PointerExpression(pOperand, getCanonicalType(pType));
+    return intern(new PointerExpression(pOperand, getCanonicalType(pType)));
   }
 
   public SymbolicExpression addressOf(SymbolicExpression pOperand, Type pType) {
@@ -295,7 +352,7 @@ public class SymbolicValueFactory {
       return ((PointerExpression) pOperand).getOperand();
 
     } else {
-      return new AddressOfExpression(pOperand, getCanonicalType(pType));
+      return intern(new AddressOfExpression(pOperand, getCanonicalType(pType)));
     }
   }
 
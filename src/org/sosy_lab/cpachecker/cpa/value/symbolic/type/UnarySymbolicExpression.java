@@ -24,6 +24,9 @@ public abstract class UnarySymbolicExpression extends SymbolicExpression {
   private final SymbolicExpression operand;
   private final Type type;
 
+  /** Cached, because hash-consing and constraint caches hash complete expression trees often. */
+  private transient int hashCode = 0;
+
   UnarySymbolicExpression(SymbolicExpression pOperand, Type pType) {
     operand = pOperand;
     type = pType;
@@ -70,7 +73,10 @@ public abstract class UnarySymbolicExpression extends SymbolicExpression {
 
   @Override
   public final int hashCode() {
-    return super.hashCode() + Objects.hash(getClass(), operand, type);
+    if (hashCode == 0) {
+      hashCode = super.hashCode() + Objects.hash(getClass(), operand, type);
+    }
+    return hashCode;
   }
 
   @Override
@@ -0,0 +1,333 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.value.symbolic.util;
+
+import com.google.common.collect.ImmutableMap;
+import java.math.BigInteger;
+import java.util.Map;
+import java.util.Optional;
+import java.util.function.BinaryOperator;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
+import org.sosy_lab.cpachecker.cfa.types.Type;
+import org.sosy_lab.cpachecker.cfa.types.c.CBasicType;
+import org.sosy_lab.cpachecker.cfa.types.c.CSimpleType;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.AdditionExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.AddressOfExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.BinaryAndExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.BinaryNotExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.BinaryOrExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.BinarySymbolicExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.BinaryXorExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.CastExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.ConstantSymbolicExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.DivisionExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.EqualsExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.LessThanExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.LessThanOrEqualExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.LogicalAndExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.LogicalNotExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.LogicalOrExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.ModuloExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.MultiplicationExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.NegationExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.PointerExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.ShiftLeftExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.ShiftRightExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SubtractionExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicIdentifier;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicValue;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicValueVisitor;
+import org.sosy_lab.cpachecker.cpa.value.type.NumericValue;
+import org.sosy_lab.cpachecker.cpa.value.type.Value;
+
+/**
+ * Evaluates {@link SymbolicValue}s of C integer types for a concrete assignment of their {@link
+ * SymbolicIdentifier}s.
+ *
+ * <p>The evaluation is exact, but incomplete: whenever the result would depend on the semantics of
+ * overflows, implementation-defined behavior, floating-point or pointer arithmetic, or on an
+ * identifier without assignment, the result is empty. A present result is thus the value of the
+ * expression in C for the given assignment.
+ */
+public class SymbolicValueEvaluator implements SymbolicValueVisitor<Optional<BigInteger>> {
+
+  private final MachineModel machineModel;
+  private final ImmutableMap<SymbolicIdentifier, BigInteger> assignment;
+
+  public SymbolicValueEvaluator(
+      MachineModel pMachineModel, Map<SymbolicIdentifier, BigInteger> pAssignment) {
+    machineModel = pMachineModel;
+    assignment = ImmutableMap.copyOf(pAssignment);
+  }
+
+  /**
+   * Evaluate the given value as condition.
+   *
+   * @return whether the condition holds, or empty if it can not be evaluated
+   */
+  public Optional<Boolean> evaluateCondition(SymbolicValue pValue) {
+    return pValue.accept(this).map(v -> v.signum() != 0);
+  }
+
+  private Optional<CSimpleType> getIntegerType(Type pType) {
+    if (pType instanceof CType) {
+      CType type = ((CType) pType).getCanonicalType();
+      if (type instanceof CSimpleType && ((CSimpleType) type).getType().isIntegerType()) {
+        return Optional.of((CSimpleType) type);
+      }
+    }
+    return Optional.empty();
+  }
+
+  /** Return the value if it is representable in the given type without conversion. */
+  private Optional<BigInteger> inRange(Optional<BigInteger> pValue, Type pType) {
+    if (!pValue.isPresent()) {
+      return pValue;
+    }
+    Optional<CSimpleType> type = getIntegerType(pType);
+    if (!type.isPresent()) {
+      return Optional.empty();
+    }
+    BigInteger value = pValue.orElseThrow();
+    if (value.compareTo(machineModel.getMinimalIntegerValue(type.orElseThrow())) < 0
+        || value.compareTo(machineModel.getMaximalIntegerValue(type.orElseThrow())) > 0) {
+      return Optional.empty();
+    }
+    return pValue;
+  }
+
+  private static BigInteger toBigInteger(boolean pValue) {
+    return pValue ? BigInteger.ONE : BigInteger.ZERO;
+  }
+
+  private static Optional<BigInteger> ofBoolean(boolean pValue) {
+    return Optional.of(toBigInteger(pValue));
+  }
+
+  private Optional<BigInteger> evaluateOperand(
+      SymbolicExpression pOperand, BinarySymbolicExpression pExpression) {
+    return inRange(pOperand.accept(this), pExpression.getCalculationType());
+  }
+
+  private Optional<BigInteger> handleBinaryExpression(
+      BinarySymbolicExpression pExpression, BinaryOperator<BigInteger> pOperation) {
+    Optional<BigInteger> operand1 = evaluateOperand(pExpression.getOperand1(), pExpression);
+    if (!operand1.isPresent()) {
+      return operand1;
+    }
+    Optional<BigInteger> operand2 = evaluateOperand(pExpression.getOperand2(), pExpression);
+    if (!operand2.isPresent()) {
+      return operand2;
+    }
+    Optional<BigInteger> result =
+        Optional.ofNullable(pOperation.apply(operand1.orElseThrow(), operand2.orElseThrow()));
+    return inRange(inRange(result, pExpression.getCalculationType()), pExpression.getType());
+  }
+
+  /** For comparisons, the result type differs from the calculation type. */
+  private Optional<BigInteger> handleComparison(
+      BinarySymbolicExpression pExpression, BinaryOperator<BigInteger> pComparison) {
+    Optional<BigInteger> operand1 = evaluateOperand(pExpression.getOperand1(), pExpression);
+    if (!operand1.isPresent()) {
+      return operand1;
+    }
+    Optional<BigInteger> operand2 = evaluateOperand(pExpression.getOperand2(), pExpression);
+    if (!operand2.isPresent()) {
+      return operand2;
+    }
+    return Optional.of(pComparison.apply(operand1.orElseThrow(), operand2.orElseThrow()));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(SymbolicIdentifier pValue) {
+    return Optional.ofNullable(assignment.get(pValue));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(ConstantSymbolicExpression pExpression) {
+    Value value = pExpression.getValue();
+    Optional<BigInteger> result;
+    if (value instanceof SymbolicValue) {
+      result = ((SymbolicValue) value).accept(this);
+    } else if (value instanceof NumericValue) {
+      Number number = ((NumericValue) value).getNumber();
+      if (number instanceof BigInteger
+          || number instanceof Long
+          || number instanceof Integer
+          || number instanceof Short
+          || number instanceof Byte) {
+        result = Optional.of(((NumericValue) value).bigInteger());
+      } else {
+        result = Optional.empty();
+      }
+    } else {
+      result = Optional.empty();
+    }
+    return inRange(result, pExpression.getType());
+  }
+
+  @Override
+  public Optional<BigInteger> visit(AdditionExpression pExpression) {
+    return handleBinaryExpression(pExpression, BigInteger::add);
+  }
+
+  @Override
+  public Optional<BigInteger> visit(SubtractionExpression pExpression) {
+    return handleBinaryExpression(pExpression, BigInteger::subtract);
+  }
+
+  @Override
+  public Optional<BigInteger> visit(MultiplicationExpression pExpression) {
+    return handleBinaryExpression(pExpression, BigInteger::multiply);
+  }
+
+  @Override
+  public Optional<BigInteger> visit(DivisionExpression pExpression) {
+    // BigInteger rounds towards zero, like C
+    return handleBinaryExpression(pExpression, (a, b) -> b.signum() == 0 ? null : a.divide(b));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(ModuloExpression pExpression) {
+    // the sign of the remainder is the sign of the dividend, like in C
+    return handleBinaryExpression(pExpression, (a, b) -> b.signum() == 0 ? null : a.remainder(b));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(BinaryAndExpression pExpression) {
+    return handleBinaryExpression(pExpression, BigInteger::and);
+  }
+
+  @Override
+  public Optional<BigInteger> visit(BinaryNotExpression pExpression) {
+    // the result of ~ on unsigned values is negative and thus out of range
+    return inRange(
+        pExpression.getOperand().accept(this).map(BigInteger::not), pExpression.getType());
+  }
+
+  @Override
+  public Optional<BigInteger> visit(BinaryOrExpression pExpression) {
+    return handleBinaryExpression(pExpression, BigInteger::or);
+  }
+
+  @Override
+  public Optional<BigInteger> visit(BinaryXorExpression pExpression) {
+    return handleBinaryExpression(pExpression, BigInteger::xor);
+  }
+
+  private boolean isValidShift(BigInteger pValue, BigInteger pAmount, Type pType) {
+    Optional<CSimpleType> type = getIntegerType(pType);
+    return type.isPresent()
+        && pValue.signum() >= 0
+        && pAmount.signum() >= 0
+        && pAmount.compareTo(BigInteger.valueOf(machineModel.getSizeofInBits(type.orElseThrow())))
+            < 0;
+  }
+
+  @Override
+  public Optional<BigInteger> visit(ShiftRightExpression pExpression) {
+    return handleBinaryExpression(
+        pExpression,
+        (a, b) ->
+            isValidShift(a, b, pExpression.getCalculationType())
+                ? a.shiftRight(b.intValueExact())
+                : null);
+  }
+
+  @Override
+  public Optional<BigInteger> visit(ShiftLeftExpression pExpression) {
+    return handleBinaryExpression(
+        pExpression,
+        (a, b) ->
+            isValidShift(a, b, pExpression.getCalculationType())
+                ? a.shiftLeft(b.intValueExact())
+                : null);
+  }
+
+  @Override
+  public Optional<BigInteger> visit(LogicalNotExpression pExpression) {
+    return pExpression.getOperand().accept(this).flatMap(v -> ofBoolean(v.signum() == 0));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(LessThanOrEqualExpression pExpression) {
+    return handleComparison(pExpression, (a, b) -> toBigInteger(a.compareTo(b) <= 0));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(LessThanExpression pExpression) {
+    return handleComparison(pExpression, (a, b) -> toBigInteger(a.compareTo(b) < 0));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(EqualsExpression pExpression) {
+    return handleComparison(pExpression, (a, b) -> toBigInteger(a.equals(b)));
+  }
+
+  @Override
+  public Optional<BigInteger> visit(LogicalOrExpression pExpression) {
+    Optional<BigInteger> operand1 = pExpression.getOperand1().accept(this);
+    if (operand1.isPresent() && operand1.orElseThrow().signum() != 0) {
+      return ofBoolean(true);
+    }
+    Optional<BigInteger> operand2 = pExpression.getOperand2().accept(this);
+    if (operand2.isPresent() && operand2.orElseThrow().signum() != 0) {
+      return ofBoolean(true);
+    }
+    if (operand1.isPresent() && operand2.isPresent()) {
+      return ofBoolean(false);
+    }
+    return Optional.empty();
+  }
+
+  @Override
+  public Optional<BigInteger> visit(LogicalAndExpression pExpression) {
+    Optional<BigInteger> operand1 = pExpression.getOperand1().accept(this);
+    if (operand1.isPresent() && operand1.orElseThrow().signum() == 0) {
+      return ofBoolean(false);
+    }
+    Optional<BigInteger> operand2 = pExpression.getOperand2().accept(this);
+    if (operand2.isPresent() && operand2.orElseThrow().signum() == 0) {
+      return ofBoolean(false);
+    }
+    if (operand1.isPresent() && operand2.isPresent()) {
+      return ofBoolean(true);
+    }
+    return Optional.empty();
+  }
+
+  @Override
+  public Optional<BigInteger> visit(CastExpression pExpression) {
+    Optional<BigInteger> operand = pExpression.getOperand().accept(this);
+    Optional<CSimpleType> type = getIntegerType(pExpression.getType());
+    if (type.isPresent() && type.orElseThrow().getType() == CBasicType.BOOL) {
+      return operand.flatMap(v -> ofBoolean(v.signum() != 0));
+    }
+    // only casts that do not change the value are supported
+    return inRange(operand, pExpression.getType());
+  }
+
+  @Override
+  public Optional<BigInteger> visit(PointerExpression pExpression) {
+    return Optional.empty();
+  }
+
+  @Override
+  public Optional<BigInteger> visit(AddressOfExpression pExpression) {
+    return Optional.empty();
+  }
+
+  @Override
+  public Optional<BigInteger> visit(NegationExpression pExpression) {
+    return inRange(
+        pExpression.getOperand().accept(this).map(BigInteger::negate), pExpression.getType());
+  }
+}
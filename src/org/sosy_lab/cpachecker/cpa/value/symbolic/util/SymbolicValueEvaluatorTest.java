@@ -0,0 +1,70 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.cpa.value.symbolic.util;
+
+import static com.google.common.truth.Truth8.assertThat;
+
+import com.google.common.collect.ImmutableMap;
+import java.math.BigInteger;
+import java.util.Optional;
+import org.junit.Test;
+import org.sosy_lab.cpachecker.cfa.types.MachineModel;
+import org.sosy_lab.cpachecker.cfa.types.Type;
+import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicExpression;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicIdentifier;
+import org.sosy_lab.cpachecker.cpa.value.symbolic.type.SymbolicValueFactory;
+import org.sosy_lab.cpachecker.cpa.value.type.NumericValue;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+
+/** Unit tests for {@link SymbolicValueEvaluator}. */
+public class SymbolicValueEvaluatorTest {
+
+  private final SymbolicValueFactory factory = SymbolicValueFactory.getInstance();
+  private final Type defType = CNumericTypes.INT;
+
+  private final SymbolicIdentifier id1 = factory.newIdentifier(MemoryLocation.valueOf("a"));
+  private final SymbolicIdentifier id2 = factory.newIdentifier(MemoryLocation.valueOf("b"));
+
+  private final SymbolicExpression idExp1 = factory.asConstant(id1, defType);
+  private final SymbolicExpression idExp2 = factory.asConstant(id2, defType);
+  private final SymbolicExpression numExp = factory.asConstant(new NumericValue(5), defType);
+
+  private SymbolicValueEvaluator evaluatorFor(BigInteger pValue) {
+    return new SymbolicValueEvaluator(MachineModel.LINUX32, ImmutableMap.of(id1, pValue));
+  }
+
+  @Test
+  public void testEvaluateCondition() {
+    SymbolicExpression condition =
+        factory.lessThan(factory.add(idExp1, numExp, defType, defType), numExp, defType, defType);
+
+    assertThat(evaluatorFor(BigInteger.valueOf(-1)).evaluateCondition(condition))
+        .isEqualTo(Optional.of(true));
+    assertThat(evaluatorFor(BigInteger.ONE).evaluateCondition(condition))
+        .isEqualTo(Optional.of(false));
+  }
+
+  @Test
+  public void testEvaluateCondition_unassignedIdentifier() {
+    SymbolicExpression condition = factory.lessThan(idExp1, idExp2, defType, defType);
+
+    assertThat(evaluatorFor(BigInteger.ZERO).evaluateCondition(condition)).isEmpty();
+  }
+
+  @Test
+  public void testEvaluateCondition_overflow() {
+    BigInteger max = MachineModel.LINUX32.getMaximalIntegerValue(CNumericTypes.INT);
+    SymbolicExpression condition =
+        factory.lessThan(numExp, factory.add(idExp1, numExp, defType, defType), defType, defType);
+
+    // signed overflow is undefined, so the evaluator must leave the decision to the solver
+    assertThat(evaluatorFor(max).evaluateCondition(condition)).isEmpty();
+  }
+}
@@ -27,6 +27,19 @@ public class NumericValue implements Value, Serializable {
 
   private static final long serialVersionUID = -3829943575180448170L;
 
+  /** Inclusive bounds of the integral values for which {@link #valueOf(long)} shares instances. */
+  private static final int CACHE_LOW = -128;
+
+  private static final int CACHE_HIGH = 1024;
+
+  private static final NumericValue[] SMALL_VALUES = new NumericValue[CACHE_HIGH - CACHE_LOW + 1];
+
+  static {
+    for (int i = 0; i < SMALL_VALUES.length; i++) {
+      SMALL_VALUES[i] = new NumericValue(Long.valueOf(i + CACHE_LOW));
+    }
+  }
+
   private Number number;
 
   /**
@@ -37,6 +50,21 @@ public class NumericValue implements Value, Serializable {
     number = pNumber;
   }
 
+  /**
+   * Returns a <code>NumericValue</code> that stores the given integer as {@link Long}, i.e., a
+   * value equal to <code>new NumericValue(pValue)</code>. Instances for small values (which are by
+   * far the most common in programs, e.g., boolean results and loop counters) are shared, so that
+   * neither the value nor its box has to be allocated.
+   *
+   * @param pValue the value of the number
+   */
+  public static NumericValue valueOf(long pValue) {
+    if (pValue >= CACHE_LOW && pValue <= CACHE_HIGH) {
+      return SMALL_VALUES[(int) pValue - CACHE_LOW];
+    }
+    return new NumericValue(pValue);
+  }
+
   /**
    * Returns the number stored in the container.
    *
@@ -18,6 +18,16 @@ import org.sosy_lab.common.rationals.Rational;
 
 public class NumericValueTest {
 
+  @Test
+  public void valueOf_equalToConstructed() {
+    for (long l : new long[] {-129, -128, -1, 0, 1, 1024, 1025, Long.MIN_VALUE, Long.MAX_VALUE}) {
+      NumericValue val = NumericValue.valueOf(l);
+      assertThat(val).isEqualTo(new NumericValue(l));
+      assertThat(val.getNumber()).isInstanceOf(Long.class);
+    }
+    assertThat(NumericValue.valueOf(7)).isSameInstanceAs(NumericValue.valueOf(7));
+  }
+
   @Test
   public void longValue_conversionFromPositiveLong(){
     NumericValue val = new NumericValue(5L);
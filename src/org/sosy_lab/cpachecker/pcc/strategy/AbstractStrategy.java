@@ -25,6 +25,7 @@ import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.logging.Level;
+import java.util.zip.Deflater;
 import java.util.zip.ZipEntry;
 import java.util.zip.ZipInputStream;
 import java.util.zip.ZipOutputStream;
@@ -41,6 +42,8 @@ import org.sosy_lab.cpachecker.core.interfaces.StatisticsProvider;
 import org.sosy_lab.cpachecker.core.interfaces.pcc.PCCStrategy;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.exceptions.ValidationConfigurationConstructionFailed;
+import org.sosy_lab.cpachecker.pcc.util.ChunkedProofFormat;
+import org.sosy_lab.cpachecker.pcc.util.DeduplicatingObjectOutputStream;
 import org.sosy_lab.cpachecker.pcc.util.ProofStatesInfoCollector;
 import org.sosy_lab.cpachecker.pcc.util.ValidationConfigurationBuilder;
 import org.sosy_lab.cpachecker.util.Triple;
@@ -66,6 +69,33 @@ public abstract class AbstractStrategy implements PCCStrategy, StatisticsProvide
   @IntegerOption(min=1)
   protected int numThreads = 1;
 
+  /** Container formats for proofs. */
+  public enum ProofFormat {
+    /** all entries in a ZIP file, which needs to be read sequentially */
+    ZIP,
+    /** separately compressed entries with an index, which can be read in parallel */
+    CHUNKED
+  }
+
+  @Option(
+      secure = true,
+      name = "proofFormat",
+      description =
+          "container format for writing proofs: ZIP needs to decompress all preceding entries"
+              + " to read an entry, CHUNKED compresses each entry (e.g., partition) on its own"
+              + " and stores an index, such that entries can be read lazily and in parallel."
+              + " The format of a proof that is read is detected automatically.")
+  private ProofFormat proofFormat = ProofFormat.ZIP;
+
+  @Option(
+      secure = true,
+      name = "deduplicateValues",
+      description =
+          "write equal immutable values (e.g., variable names, numbers, intervals) that occur in"
+              + " several states of the proof only once. The proof remains readable without this"
+              + " option.")
+  private boolean deduplicateValues = false;
+
   @Option(secure=true,
       name="storeConfig",
       description = "writes the validation configuration required for checking to proof")
@@ -85,7 +115,6 @@ public abstract class AbstractStrategy implements PCCStrategy, StatisticsProvide
   }
 
   @Override
-  @SuppressFBWarnings(value="OS_OPEN_STREAM", justification="Do not close stream o because it wraps stream zos/fos which need to remain open and would be closed if o.close() is called.")
   public void writeProof(UnmodifiableReachedSet pReached) {
 
     Path dir = proofFile.getParent();
@@ -95,44 +124,22 @@ public abstract class AbstractStrategy implements PCCStrategy, StatisticsProvide
         Files.createDirectories(dir);
       }
 
-      try (final OutputStream fos = Files.newOutputStream(proofFile);
-          final ZipOutputStream zos = new ZipOutputStream(fos)) {
-        zos.setLevel(9);
-
-        ZipEntry ze = new ZipEntry(PROOF_ZIPENTRY_NAME);
-        zos.putNextEntry(ze);
-        ObjectOutputStream o = new ObjectOutputStream(zos);
-        //TODO might also want to write used configuration to the file so that proof checker does not need to get it as an argument
-        //write ARG
-        writeProofToStream(o, pReached);
-        o.flush();
-        zos.closeEntry();
-
-        // write additional proof information
-        int index = 0;
-        boolean continueWriting;
-        do {
-          ze = new ZipEntry(ADDITIONAL_PROOFINFO_ZIPENTRY_NAME + index);
-          zos.putNextEntry(ze);
-          o = new ObjectOutputStream(zos);
-          continueWriting = writeAdditionalProofStream(o);
-          o.flush();
-          zos.closeEntry();
-          index++;
-        } while (continueWriting);
-
-        if (storeConfig) {
-          ze = new ZipEntry(CONFIG_ZIPENTRY_NAME);
-          zos.putNextEntry(ze);
-          o = new ObjectOutputStream(zos);
-          try {
-            writeConfiguration(o);
-          } catch (ValidationConfigurationConstructionFailed eIC) {
-            logger.log(Level.WARNING, "Construction of validation configuration failed. Validation configuration is empty.");
-          }
-
-          o.flush();
-          zos.closeEntry();
+      try (final OutputStream fos = Files.newOutputStream(proofFile)) {
+        switch (proofFormat) {
+          case ZIP:
+            try (ZipOutputStream zos = new ZipOutputStream(fos)) {
+              zos.setLevel(9);
+              writeProofEntries(zos, name -> zos.putNextEntry(new ZipEntry(name)), pReached);
+            }
+            break;
+          case CHUNKED:
+            try (ChunkedProofFormat.Writer writer =
+                new ChunkedProofFormat.Writer(fos, Deflater.BEST_SPEED)) {
+              writeProofEntries(writer, writer::putNextEntry, pReached);
+            }
+            break;
+          default:
+            throw new AssertionError("unknown proof format " + proofFormat);
         }
       } catch (NotSerializableException eS) {
         logger.log(Level.SEVERE, "Proof cannot be written. Class " + eS.getMessage()
@@ -151,13 +158,63 @@ public abstract class AbstractStrategy implements PCCStrategy, StatisticsProvide
     logger.log(Level.INFO, proofInfo.getInfoAsString());
   }
 
+  @FunctionalInterface
+  private interface ProofEntryStarter {
+    /** Start the entry with the given name, everything written afterwards belongs to it. */
+    void putNextEntry(String pName) throws IOException;
+  }
+
+  @SuppressFBWarnings(
+      value = "OS_OPEN_STREAM",
+      justification =
+          "Do not close stream o because it wraps stream pOut which needs to remain open and would"
+              + " be closed if o.close() is called.")
+  private void writeProofEntries(
+      OutputStream pOut, ProofEntryStarter pEntries, UnmodifiableReachedSet pReached)
+      throws IOException, InvalidConfigurationException, InterruptedException {
+    pEntries.putNextEntry(PROOF_ZIPENTRY_NAME);
+    ObjectOutputStream o = newObjectOutputStream(pOut);
+    //TODO might also want to write used configuration to the file so that proof checker does not need to get it as an argument
+    //write ARG
+    writeProofToStream(o, pReached);
+    o.flush();
+
+    // write additional proof information
+    int index = 0;
+    boolean continueWriting;
+    do {
+      pEntries.putNextEntry(ADDITIONAL_PROOFINFO_ZIPENTRY_NAME + index);
+      o = newObjectOutputStream(pOut);
+      continueWriting = writeAdditionalProofStream(o);
+      o.flush();
+      index++;
+    } while (continueWriting);
+
+    if (storeConfig) {
+      pEntries.putNextEntry(CONFIG_ZIPENTRY_NAME);
+      o = newObjectOutputStream(pOut);
+      try {
+        writeConfiguration(o);
+      } catch (ValidationConfigurationConstructionFailed eIC) {
+        logger.log(Level.WARNING, "Construction of validation configuration failed. Validation configuration is empty.");
+      }
+      o.flush();
+    }
+  }
+
+  private ObjectOutputStream newObjectOutputStream(OutputStream pOut) throws IOException {
+    return deduplicateValues
+        ? new DeduplicatingObjectOutputStream(pOut)
+        : new ObjectOutputStream(pOut);
+  }
+
   protected abstract void writeProofToStream(ObjectOutputStream out, UnmodifiableReachedSet reached)
       throws IOException, InvalidConfigurationException, InterruptedException;
 
 
   @Override
   public void readProof() throws IOException, ClassNotFoundException, InvalidConfigurationException {
-    Triple<InputStream, ZipInputStream, ObjectInputStream> proofStream = openProofStream();
+    Triple<InputStream, InputStream, ObjectInputStream> proofStream = openProofStream();
     readProofFromStream(proofStream.getThird());
     proofStream.getThird().close();
     proofStream.getSecond().close();
@@ -181,25 +238,37 @@ public abstract class AbstractStrategy implements PCCStrategy, StatisticsProvide
   }
 
 
-  protected Triple<InputStream, ZipInputStream, ObjectInputStream> openProofStream() throws IOException {
-    InputStream fis = Files.newInputStream(proofFile);
-    ZipInputStream zis = new ZipInputStream(fis);
-    ZipEntry entry = zis.getNextEntry();
-    assert entry.getName().equals(PROOF_ZIPENTRY_NAME);
-    return Triple.of(fis, zis, new ObjectInputStream(zis));
+  protected Triple<InputStream, InputStream, ObjectInputStream> openProofStream() throws IOException {
+    return openProofEntry(PROOF_ZIPENTRY_NAME, 0);
   }
 
-  public Triple<InputStream, ZipInputStream, ObjectInputStream> openAdditionalProofStream(final int index)
+  public Triple<InputStream, InputStream, ObjectInputStream> openAdditionalProofStream(final int index)
       throws IOException {
     checkArgument(index >= 0, "Not a valid index. Indices must be at least zero.");
+    return openProofEntry(ADDITIONAL_PROOFINFO_ZIPENTRY_NAME + index, index + 1);
+  }
+
+  /**
+   * Open an entry of the proof file, in whichever format the proof was written.
+   *
+   * @param pName the name of the entry
+   * @param pZipPosition the position of the entry in a ZIP file, which needs to be read
+   *     sequentially (entries in the chunked format are found via its index)
+   */
+  private Triple<InputStream, InputStream, ObjectInputStream> openProofEntry(
+      String pName, int pZipPosition) throws IOException {
+    if (ChunkedProofFormat.isChunkedProof(proofFile)) {
+      InputStream in = ChunkedProofFormat.openEntry(proofFile, pName);
+      return Triple.of(in, in, new ObjectInputStream(in));
+    }
+
     InputStream fis = Files.newInputStream(proofFile);
     ZipInputStream zis = new ZipInputStream(fis);
-    for (int i = 0; i <= index; i++) { // skip index+1 entries
+    for (int i = 0; i < pZipPosition; i++) {
       zis.getNextEntry();
     }
     ZipEntry entry = zis.getNextEntry();
-
-    assert entry.getName().equals("ADDITIONAL_PROOFINFO_ZIPENTRY_NAME " + index);
+    assert entry != null && entry.getName().equals(pName);
     return Triple.of(fis, zis, new ObjectInputStream(zis));
   }
 
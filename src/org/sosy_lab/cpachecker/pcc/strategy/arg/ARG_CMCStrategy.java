@@ -22,7 +22,6 @@ import java.util.List;
 import java.util.concurrent.Semaphore;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.logging.Level;
-import java.util.zip.ZipInputStream;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
@@ -147,7 +146,7 @@ public class ARG_CMCStrategy extends AbstractStrategy {
       List<ARGState> incompleteStates = new ArrayList<>();
       ConfigurableProgramAnalysis cpa;
 
-      Triple<InputStream, ZipInputStream, ObjectInputStream> streams = null;
+      Triple<InputStream, InputStream, ObjectInputStream> streams = null;
       try {
         streams = openProofStream();
         ObjectInputStream o = streams.getThird();
@@ -227,7 +226,7 @@ public class ARG_CMCStrategy extends AbstractStrategy {
 
         @Override
         public void run() {
-          Triple<InputStream, ZipInputStream, ObjectInputStream> streams = null;
+          Triple<InputStream, InputStream, ObjectInputStream> streams = null;
           try {
             streams = openProofStream();
             ObjectInputStream o = streams.getThird();
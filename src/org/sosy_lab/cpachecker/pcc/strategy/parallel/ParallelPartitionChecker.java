@@ -8,12 +8,16 @@
 
 package org.sosy_lab.cpachecker.pcc.strategy.parallel;
 
+import static com.google.common.base.Preconditions.checkNotNull;
+
 import java.util.Collection;
 import java.util.concurrent.Semaphore;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicInteger;
 import java.util.concurrent.locks.Lock;
+import java.util.logging.Level;
 
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cfa.model.CFANode;
@@ -22,6 +26,8 @@ import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
 import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
 import org.sosy_lab.cpachecker.core.interfaces.pcc.PartitioningCheckingHelper;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.pcc.strategy.partitioning.CertificateStateIndex;
 import org.sosy_lab.cpachecker.pcc.strategy.partitioning.PartitionChecker;
 import org.sosy_lab.cpachecker.pcc.strategy.partitioning.PartitioningIOHelper;
 
@@ -35,16 +41,20 @@ public class ParallelPartitionChecker implements Runnable, PartitioningCheckingH
   private final AtomicBoolean checkResult;
   private final Semaphore readAndUnprocessedPartitions;
   private final Semaphore checkedPartitions;
-  private final Lock mutex;
+  private final @Nullable Lock mutex;
+  /** buffer slots of the readers, released together with each checked partition, if not null */
+  private final @Nullable Semaphore bufferSlots;
 
   private final PartitioningIOHelper ioHelper;
   private final PartitionChecker checker;
 
   private final Collection<AbstractState> certificate;
-  private final Multimap<CFANode, AbstractState> partitionElems;
-  private final Collection<AbstractState> inOtherPartition;
+  private final @Nullable Multimap<CFANode, AbstractState> partitionElems;
+  private final @Nullable Collection<AbstractState> inOtherPartition;
+  private final @Nullable CertificateStateIndex certificateIndex;
 
   private final ShutdownNotifier shutdownNotifier;
+  private final LogManager logger;
 
   public ParallelPartitionChecker(final AtomicInteger pAvailablePartitions, final AtomicInteger pNextId,
       final AtomicBoolean pCheckResult, final Semaphore pReadButUnprocessed, final Semaphore pPartitionsChecked,
@@ -52,19 +62,82 @@ public class ParallelPartitionChecker implements Runnable, PartitioningCheckingH
       final Multimap<CFANode, AbstractState> partitionElements, final Collection<AbstractState> pCertificate,
       final Collection<AbstractState> pInOtherPartition, final Precision init, final StopOperator stop,
       final TransferRelation transfer, final ShutdownNotifier pShutdownNotifier, final LogManager pLogger) {
+    this(pAvailablePartitions, pNextId, pCheckResult, pReadButUnprocessed, pPartitionsChecked,
+        pMutex, null, pIOHelper, partitionElements, pCertificate, pInOtherPartition, init, stop,
+        transfer, pShutdownNotifier, pLogger);
+  }
+
+  /**
+   * Create a checker that drops the states of each partition after checking it and releases one
+   * of the given buffer slots, such that the readers can read the next partition (cf. {@link
+   * org.sosy_lab.cpachecker.pcc.strategy.parallel.io.ParallelPartitionReader}).
+   */
+  public ParallelPartitionChecker(
+      final AtomicInteger pAvailablePartitions,
+      final AtomicInteger pNextId,
+      final AtomicBoolean pCheckResult,
+      final Semaphore pReadButUnprocessed,
+      final Semaphore pPartitionsChecked,
+      final Lock pMutex,
+      final @Nullable Semaphore pBufferSlots,
+      final PartitioningIOHelper pIOHelper,
+      final Multimap<CFANode, AbstractState> partitionElements,
+      final Collection<AbstractState> pCertificate,
+      final Collection<AbstractState> pInOtherPartition,
+      final Precision init,
+      final StopOperator stop,
+      final TransferRelation transfer,
+      final ShutdownNotifier pShutdownNotifier,
+      final LogManager pLogger) {
+    this(pAvailablePartitions, pNextId, pCheckResult, pReadButUnprocessed, pPartitionsChecked,
+        checkNotNull(pMutex), pBufferSlots, pIOHelper, checkNotNull(partitionElements),
+        pCertificate, checkNotNull(pInOtherPartition), null, init, stop, transfer,
+        pShutdownNotifier, pLogger);
+  }
+
+  /**
+   * Create a checker for the case that all partitions are available before checking starts. The
+   * states that a partition expects in other partitions are checked against the given index of
+   * the complete certificate directly after checking the partition, so apart from adding the
+   * recomputed states to the certificate (which needs to be thread-safe) there is no shared state
+   * that needs to be synchronized.
+   */
+  public ParallelPartitionChecker(final AtomicInteger pAvailablePartitions, final AtomicInteger pNextId,
+      final AtomicBoolean pCheckResult, final Semaphore pReadButUnprocessed, final Semaphore pPartitionsChecked,
+      final PartitioningIOHelper pIOHelper, final CertificateStateIndex pCertificateIndex,
+      final Collection<AbstractState> pConcurrentCertificate, final Precision init, final StopOperator stop,
+      final TransferRelation transfer, final ShutdownNotifier pShutdownNotifier, final LogManager pLogger) {
+    this(pAvailablePartitions, pNextId, pCheckResult, pReadButUnprocessed, pPartitionsChecked, null,
+        null, pIOHelper, null, pConcurrentCertificate, null, checkNotNull(pCertificateIndex), init,
+        stop, transfer, pShutdownNotifier, pLogger);
+  }
+
+  private ParallelPartitionChecker(final AtomicInteger pAvailablePartitions, final AtomicInteger pNextId,
+      final AtomicBoolean pCheckResult, final Semaphore pReadButUnprocessed, final Semaphore pPartitionsChecked,
+      final @Nullable Lock pMutex, final @Nullable Semaphore pBufferSlots,
+      final PartitioningIOHelper pIOHelper,
+      final @Nullable Multimap<CFANode, AbstractState> partitionElements,
+      final Collection<AbstractState> pCertificate,
+      final @Nullable Collection<AbstractState> pInOtherPartition,
+      final @Nullable CertificateStateIndex pCertificateIndex, final Precision init,
+      final StopOperator stop, final TransferRelation transfer,
+      final ShutdownNotifier pShutdownNotifier, final LogManager pLogger) {
     numPartitionsAcquiredForChecking = pAvailablePartitions;
     nextPartition = pNextId;
     checkResult = pCheckResult;
     readAndUnprocessedPartitions = pReadButUnprocessed;
     checkedPartitions = pPartitionsChecked;
     mutex = pMutex;
+    bufferSlots = pBufferSlots;
 
     ioHelper = pIOHelper;
     certificate = pCertificate;
     partitionElems = partitionElements;
     inOtherPartition = pInOtherPartition;
+    certificateIndex = pCertificateIndex;
 
     shutdownNotifier = pShutdownNotifier;
+    logger = pLogger;
 
     checker = new PartitionChecker(init, stop, transfer, ioHelper, this, pShutdownNotifier, pLogger);
   }
@@ -98,18 +171,39 @@ public class ParallelPartitionChecker implements Runnable, PartitioningCheckingH
       }
       checker.checkPartition(nextPartitionId);
 
-      mutex.lock();
-      try {
+      if (certificateIndex != null) {
+        try {
+          if (!checker.areElementsCheckedInOtherPartitionsCovered(certificateIndex)) {
+            logger.log(Level.SEVERE,
+                "A state which should be in other partition is not covered by certificate.");
+            abortCheckingPreparation();
+            break;
+          }
+        } catch (CPAException | InterruptedException e) {
+          logger.logException(Level.SEVERE, e, "Checking coverage of states in other partitions failed");
+          abortCheckingPreparation();
+          break;
+        }
         checker.addCertificatePartsToCertificate(certificate);
-        checker.addPartitionElements(partitionElems);
-        checker.addElementsCheckedInOtherPartitions(inOtherPartition);
-      } finally {
-        mutex.unlock();
+      } else {
+        mutex.lock();
+        try {
+          checker.addCertificatePartsToCertificate(certificate);
+          checker.addPartitionElements(partitionElems);
+          checker.addElementsCheckedInOtherPartitions(inOtherPartition);
+        } finally {
+          mutex.unlock();
+        }
       }
 
       checkedPartitions.release();
 
       checker.clearAllSavedPartitioningElements();
+
+      if (bufferSlots != null) {
+        ioHelper.releasePartition(nextPartitionId);
+        bufferSlots.release();
+      }
     }
 
   }
@@ -124,6 +218,9 @@ public class ParallelPartitionChecker implements Runnable, PartitioningCheckingH
     checkResult.set(false);
     readAndUnprocessedPartitions.release(ioHelper.getNumPartitions());
     checkedPartitions.release(ioHelper.getNumPartitions());
+    if (bufferSlots != null) {
+      bufferSlots.release(ioHelper.getNumPartitions());
+    }
   }
 
 }
@@ -8,29 +8,24 @@
 
 package org.sosy_lab.cpachecker.pcc.strategy.parallel;
 
-import com.google.common.collect.HashMultimap;
-import com.google.common.collect.Multimap;
-import com.google.common.collect.Sets;
 import java.io.IOException;
 import java.io.ObjectInputStream;
 import java.io.ObjectOutputStream;
 import java.nio.file.Path;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.Semaphore;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicInteger;
-import java.util.concurrent.locks.Lock;
-import java.util.concurrent.locks.ReentrantLock;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.log.LogManager;
-import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
@@ -39,8 +34,8 @@ import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.PropertyChecker.PropertyCheckerCPA;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.pcc.strategy.AbstractStrategy;
+import org.sosy_lab.cpachecker.pcc.strategy.partitioning.CertificateStateIndex;
 import org.sosy_lab.cpachecker.pcc.strategy.partitioning.PartitioningIOHelper;
-import org.sosy_lab.cpachecker.pcc.strategy.partitioning.PartitioningUtils;
 
 
 public class PartialReachedSetPartitioningParallelStrategy extends AbstractStrategy{
@@ -76,11 +71,10 @@ public class PartialReachedSetPartitioningParallelStrategy extends AbstractStrat
     AtomicInteger nextId = new AtomicInteger(0);
     Semaphore partitionChecked = new Semaphore(0);
     Semaphore readButUnprocessed =new Semaphore(ioHelper.getNumPartitions());
-    Lock lock = new ReentrantLock();
 
-    Collection<AbstractState> certificate = Sets.newHashSetWithExpectedSize(ioHelper.getNumPartitions());
-    Multimap<CFANode, AbstractState> partitionNodes = HashMultimap.create();
-    Collection<AbstractState> inOtherPartition = new ArrayList<>();
+    // all partitions have been read, so they can be indexed for all threads in advance
+    CertificateStateIndex certificateIndex = CertificateStateIndex.of(ioHelper);
+    Collection<AbstractState> certificate = ConcurrentHashMap.newKeySet(ioHelper.getSavedReachedSetSize());
     AbstractState initialState = pReachedSet.popFromWaitlist();
     Precision initPrec = pReachedSet.getPrecision(initialState);
 
@@ -89,7 +83,7 @@ public class PartialReachedSetPartitioningParallelStrategy extends AbstractStrat
     try {
       for (int i = 0; i < numThreads; i++) {
         executor.execute(new ParallelPartitionChecker(availablePartitions, nextId, checkResult, readButUnprocessed,
-            partitionChecked, lock, ioHelper, partitionNodes, certificate, inOtherPartition, initPrec,
+            partitionChecked, ioHelper, certificateIndex, certificate, initPrec,
             cpa.getStopOperator(), cpa.getTransferRelation(), shutdownNotifier, logger));
       }
 
@@ -97,15 +91,9 @@ public class PartialReachedSetPartitioningParallelStrategy extends AbstractStrat
 
       if (!checkResult.get()) { return false; }
 
-      logger.log(Level.INFO, "Add initial state to elements for which it will be checked if they are covered by partition nodes of certificate.");
-      inOtherPartition.add(initialState);
-
-      logger.log(Level.INFO,
-              "Check if initial state and all nodes which should be contained in different partition are covered by certificate (partition node).");
-      if (!PartitioningUtils.areElementsCoveredByPartitionElement(inOtherPartition, partitionNodes, cpa.getStopOperator(),
-          initPrec)) {
-        logger.log(Level.SEVERE,
-            "Initial state or a state which should be in other partition is not covered by certificate.");
+      logger.log(Level.INFO, "Check if initial state is covered by certificate (partition node).");
+      if (!certificateIndex.isCovered(initialState, cpa.getStopOperator(), initPrec)) {
+        logger.log(Level.SEVERE, "Initial state is not covered by certificate.");
         return false;
       }
 
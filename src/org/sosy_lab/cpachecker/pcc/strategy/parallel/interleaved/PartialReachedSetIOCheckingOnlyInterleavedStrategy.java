@@ -24,7 +24,6 @@ import java.util.Set;
 import java.util.concurrent.Semaphore;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.logging.Level;
-import java.util.zip.ZipInputStream;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
@@ -193,7 +192,7 @@ public class PartialReachedSetIOCheckingOnlyInterleavedStrategy extends Abstract
     @Override
     @SuppressWarnings("Finally") // not really better doable without switching to Closer
     public void run() {
-      Triple<InputStream, ZipInputStream, ObjectInputStream> streams = null;
+      Triple<InputStream, InputStream, ObjectInputStream> streams = null;
       try {
         streams = openProofStream();
         ObjectInputStream o = streams.getThird();
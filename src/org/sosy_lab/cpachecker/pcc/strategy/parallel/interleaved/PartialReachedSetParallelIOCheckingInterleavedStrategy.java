@@ -28,6 +28,7 @@ import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -54,6 +55,15 @@ public class PartialReachedSetParallelIOCheckingInterleavedStrategy extends Abst
       description = "The number of cores used exclusively for proof reading. Must be less than pcc.useCores and may not be negative. Value 0 means that the cores used for reading and checking are shared")
   private int numReadThreads = 0;
 
+  @Option(
+      secure = true,
+      description =
+          "The maximal number of partitions that are read but not yet checked. Checked partitions"
+              + " are dropped from memory. Only used if pcc.interleaved.useReadCores is positive."
+              + " Value 0 means that the number of buffered partitions is not bounded.")
+  @IntegerOption(min = 0)
+  private int maxBufferedPartitions = 0;
+
   private int nextPartition;
   private final PartitioningIOHelper ioHelper;
   private final ShutdownNotifier shutdown;
@@ -96,23 +106,28 @@ public class PartialReachedSetParallelIOCheckingInterleavedStrategy extends Abst
     AbstractState initialState = pReachedSet.popFromWaitlist();
     Precision initPrec = pReachedSet.getPrecision(initialState);
     Lock lock = new ReentrantLock();
+    // with shared cores, waiting readers could block all threads before any checker is started
+    Semaphore bufferSlots =
+        numReadThreads > 0 && maxBufferedPartitions > 0
+            ? new Semaphore(maxBufferedPartitions)
+            : null;
 
     ExecutorService executor = null, readExecutor = null, checkExecutor = null;
     logger.log(Level.INFO, "Create and start threads");
     try {
       if (numReadThreads == 0) {
         executor = Executors.newFixedThreadPool(numThreads);
-        startReadingThreads(numThreads, executor, checkResult, partitionsRead);
+        startReadingThreads(numThreads, executor, checkResult, partitionsRead, bufferSlots);
         startCheckingThreads(numThreads, executor, checkResult, partitionsRead, partitionChecked, certificate,
             partitionNodes, inOtherPartition,
-            initPrec, lock);
+            initPrec, lock, bufferSlots);
       } else {
         readExecutor = Executors.newFixedThreadPool(numReadThreads);
-        startReadingThreads(numReadThreads, readExecutor, checkResult, partitionsRead);
+        startReadingThreads(numReadThreads, readExecutor, checkResult, partitionsRead, bufferSlots);
         checkExecutor = Executors.newFixedThreadPool(numThreads - numReadThreads);
         startCheckingThreads(numThreads - numReadThreads, checkExecutor, checkResult, partitionsRead, partitionChecked,
             certificate, partitionNodes, inOtherPartition,
-            initPrec, lock);
+            initPrec, lock, bufferSlots);
       }
 
       partitionChecked.acquire(ioHelper.getNumPartitions());
@@ -157,24 +172,25 @@ public class PartialReachedSetParallelIOCheckingInterleavedStrategy extends Abst
   }
 
   private void startReadingThreads(final int threads, final ExecutorService pReadingExecutor, final AtomicBoolean pCheckResult,
-      final Semaphore partitionsRead) {
+      final Semaphore partitionsRead, final @Nullable Semaphore pBufferSlots) {
     AtomicInteger nextPartitionId = new AtomicInteger(0);
     for (int i = 0; i < threads; i++) {
-      pReadingExecutor.execute(new ParallelPartitionReader(pCheckResult, partitionsRead, nextPartitionId, this,
-          ioHelper, stats, logger));
+      pReadingExecutor.execute(new ParallelPartitionReader(pCheckResult, partitionsRead, null,
+          pBufferSlots, nextPartitionId, this, ioHelper, stats, logger));
     }
   }
 
   private void startCheckingThreads(final int threads, final ExecutorService pCheckingExecutor, final AtomicBoolean pCheckResult,
       final Semaphore pPartitionsRead, final Semaphore pPartitionChecked, final Collection<AbstractState> pCertificate,
       final Multimap<CFANode, AbstractState> pInPartition, final Collection<AbstractState> pInOtherPartition,
-      final Precision pInitialPrecision, final Lock pLock) {
+      final Precision pInitialPrecision, final Lock pLock, final @Nullable Semaphore pBufferSlots) {
     AtomicInteger availablePartitions = new AtomicInteger(0);
     AtomicInteger nextId = new AtomicInteger(0);
     for (int i = 0; i < threads; i++) {
       pCheckingExecutor.execute(new ParallelPartitionChecker(availablePartitions, nextId, pCheckResult, pPartitionsRead,
-          pPartitionChecked, pLock, ioHelper, pInPartition, pCertificate, pInOtherPartition, pInitialPrecision, cpa
-              .getStopOperator(), cpa.getTransferRelation(), shutdown, logger));
+          pPartitionChecked, pLock, pBufferSlots, ioHelper, pInPartition, pCertificate,
+          pInOtherPartition, pInitialPrecision, cpa.getStopOperator(), cpa.getTransferRelation(),
+          shutdown, logger));
     }
   }
 
@@ -17,7 +17,7 @@ import java.util.concurrent.atomic.AtomicInteger;
 import java.util.concurrent.locks.Lock;
 import java.util.concurrent.locks.ReentrantLock;
 import java.util.logging.Level;
-import java.util.zip.ZipInputStream;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.pcc.strategy.AbstractStrategy;
 import org.sosy_lab.cpachecker.pcc.strategy.AbstractStrategy.PCStrategyStatistics;
@@ -30,6 +30,8 @@ public class ParallelPartitionReader implements Runnable {
   private final AtomicBoolean success;
   private final Semaphore waitRead;
   private final Semaphore partitionChecked;
+  /** limits the number of partitions that are read but not yet checked, if not null */
+  private final @Nullable Semaphore bufferSlots;
 
   private final AtomicInteger nextPartition;
 
@@ -46,9 +48,24 @@ public class ParallelPartitionReader implements Runnable {
       final Semaphore pPartitionChecked, final AtomicInteger nextPartitionId, final AbstractStrategy proofReader,
       final PartitioningIOHelper pIOHelper, final PCStrategyStatistics pStats,
       final LogManager pLogger) {
+    this(isSuccess, partitionsRead, pPartitionChecked, null, nextPartitionId, proofReader,
+        pIOHelper, pStats, pLogger);
+  }
+
+  /**
+   * Create a reader that acquires one of the given buffer slots before it reads a partition. The
+   * checkers release the slot once the partition is checked, so only a bounded number of
+   * partitions is kept in memory at the same time.
+   */
+  public ParallelPartitionReader(final AtomicBoolean isSuccess, final Semaphore partitionsRead,
+      final @Nullable Semaphore pPartitionChecked, final @Nullable Semaphore pBufferSlots,
+      final AtomicInteger nextPartitionId, final AbstractStrategy proofReader,
+      final PartitioningIOHelper pIOHelper, final PCStrategyStatistics pStats,
+      final LogManager pLogger) {
     success = isSuccess;
     waitRead = partitionsRead;
     partitionChecked = pPartitionChecked;
+    bufferSlots = pBufferSlots;
     nextPartition = nextPartitionId;
     strategy = proofReader;
     ioHelper = pIOHelper;
@@ -70,21 +87,30 @@ public class ParallelPartitionReader implements Runnable {
     if(partitionChecked!=null){
       partitionChecked.release(ioHelper.getNumPartitions());
     }
+    if (bufferSlots != null) {
+      bufferSlots.release(ioHelper.getNumPartitions());
+    }
   }
 
   @Override
   @SuppressWarnings("Finally") // not really better doable without switching to Closer
   public void run() {
-    Triple<InputStream, ZipInputStream, ObjectInputStream> streams = null;
+    Triple<InputStream, InputStream, ObjectInputStream> streams = null;
     int nextId;
     while ((nextId = nextPartition.getAndIncrement()) < ioHelper.getNumPartitions()) {
       try {
+        if (bufferSlots != null) {
+          bufferSlots.acquire();
+        }
         streams = strategy.openAdditionalProofStream(nextId);
         ioHelper.readPartition(streams.getThird(), stats, lock);
         waitRead.release();
       } catch (IOException | ClassNotFoundException e) {
         logger.logUserException(Level.SEVERE, e, "Partition reading failed. Stop checking");
         prepareAbortion();
+      } catch (InterruptedException e) {
+        prepareAbortion();
+        return;
       } catch (Exception e2) {
         logger.logException(Level.SEVERE, e2, "Unexpected failure during proof reading");
         prepareAbortion();
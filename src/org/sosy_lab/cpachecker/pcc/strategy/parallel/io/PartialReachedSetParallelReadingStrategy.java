@@ -8,22 +8,18 @@
 
 package org.sosy_lab.cpachecker.pcc.strategy.parallel.io;
 
-import com.google.common.collect.HashMultimap;
-import com.google.common.collect.Multimap;
-import com.google.common.collect.Sets;
 import java.io.IOException;
 import java.io.ObjectInputStream;
 import java.io.ObjectOutputStream;
 import java.nio.file.Path;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.Semaphore;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicInteger;
-import java.util.concurrent.locks.Lock;
-import java.util.concurrent.locks.ReentrantLock;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
@@ -32,7 +28,6 @@ import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.common.log.LogManager;
-import org.sosy_lab.cpachecker.cfa.model.CFANode;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Precision;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
@@ -42,8 +37,8 @@ import org.sosy_lab.cpachecker.cpa.PropertyChecker.PropertyCheckerCPA;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.pcc.strategy.AbstractStrategy;
 import org.sosy_lab.cpachecker.pcc.strategy.parallel.ParallelPartitionChecker;
+import org.sosy_lab.cpachecker.pcc.strategy.partitioning.CertificateStateIndex;
 import org.sosy_lab.cpachecker.pcc.strategy.partitioning.PartitioningIOHelper;
-import org.sosy_lab.cpachecker.pcc.strategy.partitioning.PartitioningUtils;
 
 @Options(prefix = "pcc.parallel.io")
 public class PartialReachedSetParallelReadingStrategy extends AbstractStrategy {
@@ -51,7 +46,6 @@ public class PartialReachedSetParallelReadingStrategy extends AbstractStrategy {
   private final PartitioningIOHelper ioHelper;
   private final PropertyCheckerCPA cpa;
   private final ShutdownNotifier shutdownNotifier;
-  private final Lock lock = new ReentrantLock();
 
   @Option(secure=true, description = "enables parallel checking of partial certificate")
   private boolean enableParallelCheck = false;
@@ -85,9 +79,9 @@ public class PartialReachedSetParallelReadingStrategy extends AbstractStrategy {
     AtomicInteger id = new AtomicInteger(0);
     Semaphore partitionChecked = new Semaphore(0);
     Semaphore readPartitions = new Semaphore(ioHelper.getNumPartitions());
-    Collection<AbstractState> certificate = Sets.newHashSetWithExpectedSize(ioHelper.getNumPartitions());
-    Multimap<CFANode, AbstractState> partitionNodes = HashMultimap.create();
-    Collection<AbstractState> inOtherPartition = new ArrayList<>();
+    // all partitions have been read, so they can be indexed for all threads in advance
+    CertificateStateIndex certificateIndex = CertificateStateIndex.of(ioHelper);
+    Collection<AbstractState> certificate = ConcurrentHashMap.newKeySet(ioHelper.getSavedReachedSetSize());
     AbstractState initialState = pReachedSet.popFromWaitlist();
     Precision initPrec = pReachedSet.getPrecision(initialState);
 
@@ -97,7 +91,7 @@ public class PartialReachedSetParallelReadingStrategy extends AbstractStrategy {
     try {
       for (int i = 0; i < threads; i++) {
         executor.execute(new ParallelPartitionChecker(availablePartitions, id, checkResult, readPartitions,
-            partitionChecked, lock, ioHelper, partitionNodes, certificate, inOtherPartition, initPrec, cpa
+            partitionChecked, ioHelper, certificateIndex, certificate, initPrec, cpa
                 .getStopOperator(), cpa.getTransferRelation(), shutdownNotifier, logger));
       }
 
@@ -105,15 +99,9 @@ public class PartialReachedSetParallelReadingStrategy extends AbstractStrategy {
 
       if (!checkResult.get()) { return false; }
 
-      logger.log(Level.INFO, "Add initial state to elements for which it will be checked if they are covered by partition nodes of certificate.");
-      inOtherPartition.add(initialState);
-
-      logger.log(Level.INFO,
-              "Check if initial state and all nodes which should be contained in different partition are covered by certificate (partition node).");
-      if (!PartitioningUtils.areElementsCoveredByPartitionElement(inOtherPartition, partitionNodes, cpa.getStopOperator(),
-          initPrec)) {
-        logger.log(Level.SEVERE,
-            "Initial state or a state which should be in other partition is not covered by certificate.");
+      logger.log(Level.INFO, "Check if initial state is covered by certificate (partition node).");
+      if (!certificateIndex.isCovered(initialState, cpa.getStopOperator(), initPrec)) {
+        logger.log(Level.SEVERE, "Initial state is not covered by certificate.");
         return false;
       }
 
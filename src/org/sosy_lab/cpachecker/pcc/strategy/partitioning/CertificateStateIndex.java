@@ -0,0 +1,65 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.pcc.strategy.partitioning;
+
+import com.google.common.collect.ImmutableListMultimap;
+import com.google.common.collect.ImmutableSet;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.interfaces.StopOperator;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+
+/**
+ * Immutable index of the states of all partitions of a partitioned certificate, grouped by their
+ * location.
+ *
+ * <p>The index is built once after all partitions were read and can then be shared between all
+ * checking threads without synchronization. This allows each thread to check directly after
+ * checking a partition whether the states that the partition expects to be in other partitions
+ * are covered by the certificate, instead of collecting these states and all partition states in
+ * shared collections and checking them sequentially afterwards.
+ */
+public final class CertificateStateIndex {
+
+  private final ImmutableSet<AbstractState> states;
+  private final ImmutableListMultimap<CFANode, AbstractState> statesPerLocation;
+
+  private CertificateStateIndex(
+      ImmutableSet<AbstractState> pStates,
+      ImmutableListMultimap<CFANode, AbstractState> pStatesPerLocation) {
+    states = pStates;
+    statesPerLocation = pStatesPerLocation;
+  }
+
+  /** Build the index for the partitions that are currently stored in the given helper. */
+  public static CertificateStateIndex of(PartitioningIOHelper pIOHelper) {
+    ImmutableSet.Builder<AbstractState> states = ImmutableSet.builder();
+    ImmutableListMultimap.Builder<CFANode, AbstractState> statesPerLocation =
+        ImmutableListMultimap.builder();
+    for (int i = 0; i < pIOHelper.getNumPartitions(); i++) {
+      for (AbstractState state : pIOHelper.getPartition(i).getFirst()) {
+        states.add(state);
+        statesPerLocation.put(AbstractStates.extractLocation(state), state);
+      }
+    }
+    return new CertificateStateIndex(states.build(), statesPerLocation.build());
+  }
+
+  /**
+   * Check whether the given state is a state of one of the partitions or covered by the states of
+   * the partitions at its location.
+   */
+  public boolean isCovered(AbstractState pState, StopOperator pStop, Precision pPrec)
+      throws CPAException, InterruptedException {
+    return states.contains(pState)
+        || pStop.stop(pState, statesPerLocation.get(AbstractStates.extractLocation(pState)), pPrec);
+  }
+}
@@ -0,0 +1,310 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.pcc.strategy.partitioning;
+
+import com.google.common.base.Throwables;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.NavigableMap;
+import java.util.Set;
+import java.util.TreeMap;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicIntegerArray;
+import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.interfaces.pcc.FiducciaMattheysesOptimizer;
+import org.sosy_lab.cpachecker.core.interfaces.pcc.PartitioningRefiner;
+import org.sosy_lab.cpachecker.pcc.strategy.partialcertificate.PartialReachedSetDirectedGraph;
+import org.sosy_lab.cpachecker.pcc.strategy.partialcertificate.WeightedGraph;
+import org.sosy_lab.cpachecker.pcc.strategy.partitioning.FiducciaMattheysesOptimzerFactory.OptimizationCriteria;
+
+/**
+ * Parallel variant of the greedy k-way FM refinement of {@link
+ * FiducciaMattheysesWeightedKWayAlgorithm}, mainly based on the ideas of parallel greedy
+ * refinement in mt-Metis.
+ *
+ * <p>Each refinement pass consists of two parallel phases. First, every thread computes the best
+ * move for each node of its share of the graph, with respect to the partitioning at the beginning
+ * of the pass, and sorts the moves with a positive gain (as well as moves without gain that reduce
+ * the imbalance) into its own gain buckets. Second, every thread applies its moves in the order of
+ * decreasing gain, as long as the balance constraint is satisfied. Partition weights are updated
+ * atomically, so the balance constraint holds for the resulting partitioning. To prevent adjacent
+ * nodes from being swapped forth and back, each pass only moves nodes to partitions with a higher
+ * (or, alternatingly, lower) index. As the gains are computed independently, the returned gain is
+ * an estimate.
+ */
+@Options(prefix = "pcc.partitioning.parallelfm")
+public class ParallelFiducciaMattheysesRefiner implements PartitioningRefiner {
+
+  @Option(secure = true, description = "[parallel FM] number of threads used for refinement")
+  @IntegerOption(min = 1)
+  private int threads = 4;
+
+  @Option(
+      secure = true,
+      description = "[parallel FM] Balance criterion for pairwise optimization of partitions")
+  private double balancePrecision = 1.3d;
+
+  @Option(secure = true, description = "[parallel FM] maximal number of refinement passes")
+  @IntegerOption(min = 1)
+  private int maxPasses = 50;
+
+  private final LogManager logger;
+  private final OptimizationCriteria optimizationCriterion;
+  private final @Nullable ExecutorService executor;
+
+  public ParallelFiducciaMattheysesRefiner(
+      Configuration pConfig, LogManager pLogger, OptimizationCriteria pCriterion)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+    optimizationCriterion = pCriterion;
+    if (threads > 1) {
+      executor =
+          Executors.newFixedThreadPool(
+              threads,
+              new ThreadFactoryBuilder().setDaemon(true).setNameFormat("parallel-fm-%d").build());
+    } else {
+      executor = null;
+    }
+  }
+
+  @Override
+  public int refinePartitioning(
+      List<Set<Integer>> partitioning, PartialReachedSetDirectedGraph pGraph, int numPartitions) {
+    return refinePartitioning(partitioning, new WeightedGraph(pGraph), numPartitions);
+  }
+
+  @Override
+  public int refinePartitioning(
+      List<Set<Integer>> partitioning, WeightedGraph wGraph, int numPartitions) {
+    int maxWeight = (int) (balancePrecision * wGraph.computePartitionLoad(numPartitions));
+    int numNodes = wGraph.getNumNodes();
+    int[] nodeToPartition = new int[numNodes];
+    AtomicIntegerArray partitionWeights = new AtomicIntegerArray(partitioning.size());
+    for (int partition = 0; partition < partitioning.size(); partition++) {
+      for (Integer node : partitioning.get(partition)) {
+        nodeToPartition[node] = partition;
+        partitionWeights.addAndGet(partition, wGraph.getNode(node).getWeight());
+      }
+    }
+
+    int totalGain = 0;
+    int oldGain = 0;
+    int timesWithoutImprovement = 0;
+    int pass = 0;
+    while (pass < maxPasses
+        && timesWithoutImprovement < 5
+        && !Thread.currentThread().isInterrupted()) {
+      int newGain =
+          refinementPass(
+              partitioning, wGraph, nodeToPartition, partitionWeights, maxWeight, pass % 2 == 0);
+      totalGain += newGain;
+      if (oldGain == newGain) {
+        timesWithoutImprovement++;
+      }
+      oldGain = newGain;
+      pass++;
+    }
+    logger.log(
+        Level.FINE,
+        String.format(
+            "[ParallelFM] refinement gain %d after %d refinement passes", totalGain, pass));
+    return totalGain;
+  }
+
+  /** A move of a node into another partition, as computed in the first phase of a pass. */
+  private static final class Move {
+    private final int node;
+    private final int from;
+    private final int to;
+
+    private Move(int pNode, int pFrom, int pTo) {
+      node = pNode;
+      from = pFrom;
+      to = pTo;
+    }
+  }
+
+  private int refinementPass(
+      List<Set<Integer>> partitioning,
+      WeightedGraph wGraph,
+      int[] nodeToPartition,
+      AtomicIntegerArray partitionWeights,
+      int maxWeight,
+      boolean upwards) {
+    int numThreads = executor == null ? 1 : threads;
+    int numNodes = wGraph.getNumNodes();
+    int chunkSize = (numNodes + numThreads - 1) / numThreads;
+
+    // phase 1: compute moves, nodeToPartition is not modified concurrently
+    List<Callable<NavigableMap<Integer, List<Move>>>> computeTasks = new ArrayList<>(numThreads);
+    for (int t = 0; t < numThreads; t++) {
+      int start = t * chunkSize;
+      int end = Math.min(numNodes, start + chunkSize);
+      computeTasks.add(
+          () ->
+              computeMoves(
+                  wGraph, nodeToPartition, partitionWeights, maxWeight, upwards, start, end));
+    }
+    List<NavigableMap<Integer, List<Move>>> buckets = runAll(computeTasks);
+
+    // phase 2: apply moves, each thread only writes the entries of its own nodes
+    List<Callable<Integer>> applyTasks = new ArrayList<>(numThreads);
+    List<List<Move>> appliedMoves = new ArrayList<>(numThreads);
+    for (NavigableMap<Integer, List<Move>> threadBuckets : buckets) {
+      List<Move> applied = new ArrayList<>();
+      appliedMoves.add(applied);
+      applyTasks.add(
+          () ->
+              applyMoves(
+                  threadBuckets, wGraph, nodeToPartition, partitionWeights, maxWeight, applied));
+    }
+    int gain = 0;
+    for (int threadGain : runAll(applyTasks)) {
+      gain += threadGain;
+    }
+
+    // update the partitioning itself, which is not thread-safe
+    for (List<Move> applied : appliedMoves) {
+      for (Move move : applied) {
+        partitioning.get(move.from).remove(move.node);
+        partitioning.get(move.to).add(move.node);
+      }
+    }
+    return gain;
+  }
+
+  /** Compute the best move for each node in the given range and sort them into gain buckets. */
+  private NavigableMap<Integer, List<Move>> computeMoves(
+      WeightedGraph wGraph,
+      int[] nodeToPartition,
+      AtomicIntegerArray partitionWeights,
+      int maxWeight,
+      boolean upwards,
+      int start,
+      int end) {
+    FiducciaMattheysesOptimizer optimizer =
+        FiducciaMattheysesOptimzerFactory.createFMOptimizer(optimizationCriterion);
+    NavigableMap<Integer, List<Move>> buckets = new TreeMap<>();
+
+    for (int node = start; node < end; node++) {
+      int from = nodeToPartition[node];
+      int nodeWeight = wGraph.getNode(node).getWeight();
+      int maxGain = 0;
+      int to = from;
+      int maxUnbalancing = nodeWeight;
+      for (Integer succ : wGraph.getIntSuccessors(node)) {
+        int target = nodeToPartition[succ];
+        if ((upwards ? target <= from : target >= from)
+            || partitionWeights.get(target) + nodeWeight > maxWeight) {
+          continue;
+        }
+        int gain = optimizer.computeGain(node, target, nodeToPartition, wGraph);
+        if (gain > maxGain) {
+          maxGain = gain;
+          to = target;
+        } else if (maxGain <= 0 && gain == 0) {
+          // no improving move found so far, prefer moves that reduce the imbalance
+          int unbalancing = partitionWeights.get(from) - partitionWeights.get(target);
+          if (unbalancing > maxUnbalancing) {
+            maxUnbalancing = unbalancing;
+            to = target;
+          }
+        }
+      }
+      if (to != from) {
+        buckets.computeIfAbsent(maxGain, k -> new ArrayList<>()).add(new Move(node, from, to));
+      }
+    }
+    return buckets;
+  }
+
+  /**
+   * Apply the given moves in the order of decreasing gain as long as the balance constraint allows
+   * it.
+   *
+   * @return the sum of the gains of the applied moves
+   */
+  private static int applyMoves(
+      NavigableMap<Integer, List<Move>> pBuckets,
+      WeightedGraph wGraph,
+      int[] nodeToPartition,
+      AtomicIntegerArray partitionWeights,
+      int maxWeight,
+      List<Move> pApplied) {
+    int gain = 0;
+    for (Map.Entry<Integer, List<Move>> bucket : pBuckets.descendingMap().entrySet()) {
+      for (Move move : bucket.getValue()) {
+        int nodeWeight = wGraph.getNode(move.node).getWeight();
+        if (reserveWeight(partitionWeights, move.to, nodeWeight, maxWeight)) {
+          partitionWeights.addAndGet(move.from, -nodeWeight);
+          nodeToPartition[move.node] = move.to;
+          pApplied.add(move);
+          gain += bucket.getKey();
+        }
+      }
+    }
+    return gain;
+  }
+
+  private static boolean reserveWeight(
+      AtomicIntegerArray pPartitionWeights, int pPartition, int pWeight, int pMaxWeight) {
+    while (true) {
+      int current = pPartitionWeights.get(pPartition);
+      if (current + pWeight > pMaxWeight) {
+        return false;
+      }
+      if (pPartitionWeights.compareAndSet(pPartition, current, current + pWeight)) {
+        return true;
+      }
+    }
+  }
+
+  /** Run all tasks, in parallel if possible, and wait for their results. */
+  private <T> List<T> runAll(List<Callable<T>> pTasks) {
+    List<T> results = new ArrayList<>(pTasks.size());
+    try {
+      if (executor == null) {
+        for (Callable<T> task : pTasks) {
+          results.add(task.call());
+        }
+      } else {
+        List<Future<T>> futures = new ArrayList<>(pTasks.size());
+        for (Callable<T> task : pTasks) {
+          futures.add(executor.submit(task));
+        }
+        // a pass needs to be finished completely to keep the partitioning consistent
+        for (Future<T> future : futures) {
+          results.add(Uninterruptibles.getUninterruptibly(future));
+        }
+      }
+    } catch (ExecutionException e) {
+      Throwables.throwIfUnchecked(e.getCause());
+      throw new AssertionError(e);
+    } catch (Exception e) {
+      Throwables.throwIfUnchecked(e);
+      throw new AssertionError(e);
+    }
+    return results;
+  }
+}
@@ -128,6 +128,20 @@ public class PartitionChecker {
     pStatesMustBeInCertificate.addAll(mustBeInCertificate);
   }
 
+  /**
+   * Check whether all states of the last checked partition that must be contained in other
+   * partitions are covered by the given index of the complete certificate.
+   */
+  public boolean areElementsCheckedInOtherPartitionsCovered(final CertificateStateIndex pIndex)
+      throws CPAException, InterruptedException {
+    for (AbstractState state : mustBeInCertificate) {
+      if (!pIndex.isCovered(state, stop, initPrec)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   public void addPartitionElements(final Multimap<CFANode, AbstractState> pPartitionElements){
     pPartitionElements.putAll(partitionParts);
   }
@@ -15,6 +15,7 @@ import java.io.ObjectInputStream;
 import java.io.ObjectOutputStream;
 import java.io.PrintStream;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 import java.util.Set;
 import java.util.concurrent.locks.Lock;
@@ -133,6 +134,19 @@ public class PartitioningIOHelper {
     }
   }
 
+  /**
+   * Drop the states of the partition with the given index once they are no longer needed, e.g.,
+   * because the partition was checked. The sizes of the partition remain available for the
+   * statistics.
+   */
+  public void releasePartition(int pIndex) {
+    Pair<AbstractState[], AbstractState[]> partition = getPartition(pIndex);
+    if (partition != null) {
+      Arrays.fill(partition.getFirst(), null);
+      Arrays.fill(partition.getSecond(), null);
+    }
+  }
+
   public void readPartition(final ObjectInputStream pIn, final PCStrategyStatistics pStats)
       throws ClassNotFoundException, IOException {
     Pair<AbstractState[], AbstractState[]> result = readPartitionContent(pIn);
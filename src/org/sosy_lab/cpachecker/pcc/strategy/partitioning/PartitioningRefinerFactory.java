@@ -20,7 +20,9 @@ public class PartitioningRefinerFactory {
 
   public static enum RefinementHeuristics {
     FM_NODECUT,
-    FM_EDGECUT
+    FM_EDGECUT,
+    PARALLEL_FM_NODECUT,
+    PARALLEL_FM_EDGECUT
   }
 
   public static PartitioningRefiner createRefiner(final Configuration pConfig,
@@ -28,6 +30,10 @@ public class PartitioningRefinerFactory {
       final RefinementHeuristics pHeuristic)
           throws InvalidConfigurationException {
     switch (pHeuristic) {
+      case PARALLEL_FM_NODECUT:
+        return new ParallelFiducciaMattheysesRefiner(pConfig, pLogger, OptimizationCriteria.NODECUT);
+      case PARALLEL_FM_EDGECUT:
+        return new ParallelFiducciaMattheysesRefiner(pConfig, pLogger, OptimizationCriteria.EDGECUT);
       case FM_EDGECUT:
         return new FiducciaMattheysesKWayBalancedGraphPartitioner(pConfig, pLogger,OptimizationCriteria.EDGECUT);
       default: //FM_K_WAY (NODE_CUT)
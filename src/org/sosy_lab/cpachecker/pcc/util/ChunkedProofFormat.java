@@ -0,0 +1,260 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.pcc.util;
+
+import static com.google.common.base.Preconditions.checkState;
+
+import com.google.common.io.ByteStreams;
+import com.google.common.io.CountingOutputStream;
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.EOFException;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.nio.ByteBuffer;
+import java.nio.channels.Channels;
+import java.nio.channels.FileChannel;
+import java.nio.channels.FileChannel.MapMode;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.zip.Deflater;
+import java.util.zip.DeflaterOutputStream;
+import java.util.zip.InflaterInputStream;
+import org.checkerframework.checker.nullness.qual.Nullable;
+
+/**
+ * Container format for proofs that consist of several named entries (e.g., one per partition).
+ *
+ * <p>In contrast to a ZIP file, the entries can be read in arbitrary order and in parallel without
+ * decompressing the preceding entries. A file consists of a header with a magic number and the
+ * format version, the entries one after another (each one compressed on its own), an index with
+ * the name, offset, and length of each entry, and a trailer with the offset of the index. Entries
+ * are written in a streaming fashion, and reading an entry maps only the bytes of this entry into
+ * memory.
+ */
+public final class ChunkedProofFormat {
+
+  private static final int MAGIC = 0x43504343; // "CPCC"
+  private static final int VERSION = 1;
+  private static final int HEADER_SIZE = Integer.BYTES + Integer.BYTES;
+  private static final int TRAILER_SIZE = Long.BYTES + Integer.BYTES;
+
+  private ChunkedProofFormat() {}
+
+  /** Check whether the given file is in this format (instead of, e.g., a ZIP file). */
+  public static boolean isChunkedProof(Path pFile) throws IOException {
+    try (DataInputStream in = new DataInputStream(Files.newInputStream(pFile))) {
+      return in.readInt() == MAGIC;
+    } catch (EOFException e) {
+      return false;
+    }
+  }
+
+  /**
+   * Writer for proof files. Similar to {@link java.util.zip.ZipOutputStream}, everything that is
+   * written to this stream is added to the entry that was started last.
+   */
+  public static final class Writer extends OutputStream {
+
+    private final CountingOutputStream out;
+    private final Map<String, long[]> index = new LinkedHashMap<>();
+    private final int compressionLevel;
+
+    private @Nullable String currentName = null;
+    private long currentStart;
+    private @Nullable Deflater deflater = null;
+    private @Nullable DeflaterOutputStream current = null;
+
+    public Writer(OutputStream pOut, int pCompressionLevel) throws IOException {
+      out = new CountingOutputStream(new BufferedOutputStream(pOut));
+      compressionLevel = pCompressionLevel;
+      DataOutputStream header = new DataOutputStream(out);
+      header.writeInt(MAGIC);
+      header.writeInt(VERSION);
+      header.flush();
+    }
+
+    /** Start a new entry, closing the current entry if there is one. */
+    public void putNextEntry(String pName) throws IOException {
+      closeEntry();
+      checkState(!index.containsKey(pName), "Duplicate proof entry %s", pName);
+      currentName = pName;
+      currentStart = out.getCount();
+      deflater = new Deflater(compressionLevel);
+      current = new DeflaterOutputStream(out, deflater, 1 << 16);
+    }
+
+    /** Close the current entry if there is one. */
+    public void closeEntry() throws IOException {
+      if (current != null) {
+        current.finish();
+        deflater.end();
+        index.put(currentName, new long[] {currentStart, out.getCount() - currentStart});
+        current = null;
+        deflater = null;
+        currentName = null;
+      }
+    }
+
+    private OutputStream current() {
+      checkState(current != null, "No proof entry started");
+      return current;
+    }
+
+    @Override
+    public void write(int pByte) throws IOException {
+      current().write(pByte);
+    }
+
+    @Override
+    public void write(byte[] pBytes, int pOffset, int pLength) throws IOException {
+      current().write(pBytes, pOffset, pLength);
+    }
+
+    @Override
+    public void flush() throws IOException {
+      if (current != null) {
+        current.flush();
+      }
+      out.flush();
+    }
+
+    /** Close the current entry, write the index, and close the underlying stream. */
+    @Override
+    public void close() throws IOException {
+      try {
+        closeEntry();
+        long indexOffset = out.getCount();
+        DataOutputStream data = new DataOutputStream(out);
+        data.writeInt(index.size());
+        for (Map.Entry<String, long[]> entry : index.entrySet()) {
+          data.writeUTF(entry.getKey());
+          data.writeLong(entry.getValue()[0]);
+          data.writeLong(entry.getValue()[1]);
+        }
+        data.writeLong(indexOffset);
+        data.writeInt(MAGIC);
+        data.flush();
+      } finally {
+        out.close();
+      }
+    }
+  }
+
+  /**
+   * Open the entry with the given name for reading. Only the index and the requested entry are
+   * read, so this method can be called concurrently for different entries of the same file.
+   */
+  public static InputStream openEntry(Path pFile, String pName) throws IOException {
+    FileChannel channel = FileChannel.open(pFile, StandardOpenOption.READ);
+    boolean keepOpen = false;
+    try {
+      long[] entry = readIndex(channel, pFile).get(pName);
+      if (entry == null) {
+        throw new IOException("Proof " + pFile + " does not contain entry " + pName);
+      }
+      InputStream compressed;
+      if (entry[1] <= Integer.MAX_VALUE) {
+        // a mapping stays valid after the channel is closed
+        compressed = new ByteBufferInputStream(channel.map(MapMode.READ_ONLY, entry[0], entry[1]));
+      } else {
+        channel.position(entry[0]);
+        compressed =
+            ByteStreams.limit(new BufferedInputStream(Channels.newInputStream(channel)), entry[1]);
+        keepOpen = true;
+      }
+      return new BufferedInputStream(new InflaterInputStream(compressed), 1 << 16);
+    } finally {
+      if (!keepOpen) {
+        channel.close();
+      }
+    }
+  }
+
+  private static Map<String, long[]> readIndex(FileChannel pChannel, Path pFile)
+      throws IOException {
+    long size = pChannel.size();
+    if (size < HEADER_SIZE + TRAILER_SIZE) {
+      throw new IOException("Proof " + pFile + " is truncated");
+    }
+    ByteBuffer header = readFully(pChannel, 0, HEADER_SIZE);
+    if (header.getInt() != MAGIC || header.getInt() != VERSION) {
+      throw new IOException("Proof " + pFile + " has an invalid header or unsupported version");
+    }
+    ByteBuffer trailer = readFully(pChannel, size - TRAILER_SIZE, TRAILER_SIZE);
+    long indexOffset = trailer.getLong();
+    if (trailer.getInt() != MAGIC || indexOffset < HEADER_SIZE || indexOffset > size) {
+      throw new IOException("Proof " + pFile + " is truncated or corrupted");
+    }
+
+    pChannel.position(indexOffset);
+    DataInputStream in =
+        new DataInputStream(
+            new BufferedInputStream(
+                ByteStreams.limit(
+                    Channels.newInputStream(pChannel), size - TRAILER_SIZE - indexOffset)));
+    int count = in.readInt();
+    Map<String, long[]> index = new LinkedHashMap<>();
+    for (int i = 0; i < count; i++) {
+      String name = in.readUTF();
+      index.put(name, new long[] {in.readLong(), in.readLong()});
+    }
+    return index;
+  }
+
+  private static ByteBuffer readFully(FileChannel pChannel, long pPosition, int pLength)
+      throws IOException {
+    ByteBuffer buffer = ByteBuffer.allocate(pLength);
+    while (buffer.hasRemaining()) {
+      if (pChannel.read(buffer, pPosition + buffer.position()) < 0) {
+        throw new EOFException();
+      }
+    }
+    buffer.flip();
+    return buffer;
+  }
+
+  private static final class ByteBufferInputStream extends InputStream {
+
+    private final ByteBuffer buffer;
+
+    private ByteBufferInputStream(ByteBuffer pBuffer) {
+      buffer = pBuffer;
+    }
+
+    @Override
+    public int read() {
+      return buffer.hasRemaining() ? Byte.toUnsignedInt(buffer.get()) : -1;
+    }
+
+    @Override
+    public int read(byte[] pBytes, int pOffset, int pLength) {
+      if (pLength == 0) {
+        return 0;
+      }
+      if (!buffer.hasRemaining()) {
+        return -1;
+      }
+      int length = Math.min(pLength, buffer.remaining());
+      buffer.get(pBytes, pOffset, length);
+      return length;
+    }
+
+    @Override
+    public int available() {
+      return buffer.remaining();
+    }
+  }
+}
@@ -0,0 +1,67 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.pcc.util;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.ObjectInputStream;
+import java.io.ObjectOutputStream;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.zip.Deflater;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+
+public class ChunkedProofFormatTest {
+
+  @Rule public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+  private Path writeProof(int pEntries) throws IOException {
+    Path file = tempFolder.newFile("proof").toPath();
+    try (ChunkedProofFormat.Writer writer =
+        new ChunkedProofFormat.Writer(Files.newOutputStream(file), Deflater.BEST_SPEED)) {
+      for (int i = 0; i < pEntries; i++) {
+        writer.putNextEntry("Entry" + i);
+        ObjectOutputStream o = new ObjectOutputStream(writer);
+        o.writeInt(i);
+        o.writeObject("content of entry " + i);
+        o.flush();
+      }
+    }
+    return file;
+  }
+
+  @Test
+  public void testReadEntriesInArbitraryOrder() throws Exception {
+    Path file = writeProof(5);
+    assertThat(ChunkedProofFormat.isChunkedProof(file)).isTrue();
+    for (int i : new int[] {3, 0, 4, 1, 2}) {
+      try (InputStream in = ChunkedProofFormat.openEntry(file, "Entry" + i);
+          ObjectInputStream o = new ObjectInputStream(in)) {
+        assertThat(o.readInt()).isEqualTo(i);
+        assertThat(o.readObject()).isEqualTo("content of entry " + i);
+      }
+    }
+  }
+
+  @Test(expected = IOException.class)
+  public void testMissingEntry() throws IOException {
+    ChunkedProofFormat.openEntry(writeProof(2), "Entry2");
+  }
+
+  @Test
+  public void testOtherFormat() throws IOException {
+    Path file = tempFolder.newFile("other").toPath();
+    Files.write(file, new byte[] {'P', 'K', 3, 4, 0, 0});
+    assertThat(ChunkedProofFormat.isChunkedProof(file)).isFalse();
+  }
+}
@@ -0,0 +1,64 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.pcc.util;
+
+import java.io.IOException;
+import java.io.ObjectOutputStream;
+import java.io.OutputStream;
+import java.math.BigDecimal;
+import java.math.BigInteger;
+import java.util.HashMap;
+import java.util.Map;
+import org.sosy_lab.cpachecker.cpa.interval.Interval;
+import org.sosy_lab.cpachecker.cpa.value.type.NumericValue;
+
+/**
+ * {@link ObjectOutputStream} that writes equal immutable values only once.
+ *
+ * <p>Java serialization writes an object that was already written as a back-reference, but only if
+ * it is the same instance. Abstract states of neighboring ARG nodes often contain values that are
+ * equal but were created separately, e.g., variable names, numbers, and intervals. This stream
+ * replaces each such value with the first equal value that was written, such that it is stored
+ * only once. The result is a regular serialization stream that can be read with {@link
+ * java.io.ObjectInputStream} (the read values are then shared, too).
+ *
+ * <p>Only values of classes whose instances are interchangeable if they are equal are replaced.
+ * Abstract states themselves are never replaced, because several of them rely on their identity.
+ */
+public class DeduplicatingObjectOutputStream extends ObjectOutputStream {
+
+  private final Map<Object, Object> writtenValues = new HashMap<>();
+
+  public DeduplicatingObjectOutputStream(OutputStream pOut) throws IOException {
+    super(pOut);
+    enableReplaceObject(true);
+  }
+
+  @Override
+  protected Object replaceObject(Object pObj) throws IOException {
+    if (isInterchangeableValue(pObj)) {
+      Object previous = writtenValues.putIfAbsent(pObj, pObj);
+      if (previous != null) {
+        return previous;
+      }
+    }
+    return pObj;
+  }
+
+  private static boolean isInterchangeableValue(Object pObj) {
+    return pObj instanceof String
+        || pObj instanceof Long
+        || pObj instanceof Integer
+        || pObj instanceof BigInteger
+        || pObj instanceof BigDecimal
+        // subclasses could be equal to a NumericValue without being interchangeable
+        || pObj.getClass() == NumericValue.class
+        || pObj instanceof Interval;
+  }
+}
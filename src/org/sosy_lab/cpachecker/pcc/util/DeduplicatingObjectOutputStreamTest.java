@@ -0,0 +1,60 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.pcc.util;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.ObjectInputStream;
+import java.io.ObjectOutputStream;
+import java.math.BigInteger;
+import java.util.List;
+import org.junit.Test;
+
+public class DeduplicatingObjectOutputStreamTest {
+
+  private static byte[] write(ObjectOutputStream pOut, ByteArrayOutputStream pBytes, Object pObj)
+      throws IOException {
+    pOut.writeObject(pObj);
+    pOut.flush();
+    return pBytes.toByteArray();
+  }
+
+  @Test
+  public void testEqualValuesAreWrittenOnce() throws Exception {
+    StringBuilder name = new StringBuilder("main::");
+    for (int i = 0; i < 100; i++) {
+      name.append('x');
+    }
+    ImmutableList<Object> values =
+        ImmutableList.of(
+            name.toString(),
+            name.toString(),
+            new BigInteger("123456789012345678901234567890"),
+            new BigInteger("123456789012345678901234567890"));
+    assertThat(values.get(0)).isNotSameInstanceAs(values.get(1));
+
+    ByteArrayOutputStream plainBytes = new ByteArrayOutputStream();
+    byte[] plain = write(new ObjectOutputStream(plainBytes), plainBytes, values);
+    ByteArrayOutputStream dedupBytes = new ByteArrayOutputStream();
+    byte[] dedup = write(new DeduplicatingObjectOutputStream(dedupBytes), dedupBytes, values);
+    assertThat(dedup.length).isLessThan(plain.length);
+
+    try (ObjectInputStream in = new ObjectInputStream(new ByteArrayInputStream(dedup))) {
+      @SuppressWarnings("unchecked")
+      List<Object> read = (List<Object>) in.readObject();
+      assertThat(read).containsExactlyElementsIn(values).inOrder();
+      assertThat(read.get(0)).isSameInstanceAs(read.get(1));
+      assertThat(read.get(2)).isSameInstanceAs(read.get(3));
+    }
+  }
+}
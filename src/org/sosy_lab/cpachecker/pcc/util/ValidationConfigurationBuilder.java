@@ -215,6 +215,13 @@ public class ValidationConfigurationBuilder {
   public static Configuration readConfigFromProof(Path proofFile)
       throws IOException, InvalidConfigurationException {
 
+    if (ChunkedProofFormat.isChunkedProof(proofFile)) {
+      try (InputStream in =
+          ChunkedProofFormat.openEntry(proofFile, AbstractStrategy.CONFIG_ZIPENTRY_NAME)) {
+        return readConfig(in);
+      }
+    }
+
     try (InputStream fis = Files.newInputStream(proofFile);
         ZipInputStream zis = new ZipInputStream(fis);) {
       ZipEntry entry;
@@ -226,16 +233,21 @@ public class ValidationConfigurationBuilder {
 
       if (entry == null) { throw new IOException("Unable to find configuration entry in proof."); }
 
-      Path valConfig = Files.createTempFile("pcc-check-config", "properties");
+      return readConfig(zis);
+    }
+  }
 
-      try (ObjectInputStream in = new ObjectInputStream(zis)) {
-        IO.writeFile(valConfig, StandardCharsets.UTF_8, in.readObject());
-      } catch (ClassNotFoundException e) {
-        throw new IOException("Failed to read configuration");
-      }
+  private static Configuration readConfig(InputStream pIn)
+      throws IOException, InvalidConfigurationException {
+    Path valConfig = Files.createTempFile("pcc-check-config", "properties");
 
-      return Configuration.builder().loadFromFile(valConfig).build();
+    try (ObjectInputStream in = new ObjectInputStream(pIn)) {
+      IO.writeFile(valConfig, StandardCharsets.UTF_8, in.readObject());
+    } catch (ClassNotFoundException e) {
+      throw new IOException("Failed to read configuration");
     }
+
+    return Configuration.builder().loadFromFile(valConfig).build();
   }
 
 }
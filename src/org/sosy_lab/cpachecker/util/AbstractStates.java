@@ -36,6 +36,7 @@ import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
 import org.sosy_lab.cpachecker.cpa.assumptions.storage.AssumptionStorageState;
 import org.sosy_lab.cpachecker.cpa.callstack.CallstackState;
 import org.sosy_lab.cpachecker.cpa.callstack.CallstackStateEqualsWrapper;
+import org.sosy_lab.cpachecker.cpa.composite.CompositeState;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
 import org.sosy_lab.java_smt.api.BooleanFormula;
 
@@ -72,6 +73,9 @@ public final class AbstractStates {
       AbstractState wrapped = ((AbstractSingleWrapperState)pState).getWrappedState();
       return extractStateByType(wrapped, pType);
 
+    } else if (pState instanceof CompositeState) {
+      return ((CompositeState) pState).getComponentByType(pType);
+
     } else if (pState instanceof AbstractWrapperState) {
       for (AbstractState wrapped : ((AbstractWrapperState)pState).getWrappedStates()) {
         T result = extractStateByType(wrapped, pType);
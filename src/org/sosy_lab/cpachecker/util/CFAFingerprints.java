@@ -0,0 +1,271 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util;
+
+import static com.google.common.base.Preconditions.checkArgument;
+import static java.nio.charset.StandardCharsets.UTF_8;
+
+import com.google.common.base.Splitter;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableSortedMap;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayDeque;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Map.Entry;
+import java.util.Objects;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdgeType;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionSummaryEdge;
+
+/**
+ * Fingerprints of the functions of a CFA, which allow to match information from an analysis of
+ * one version of a program with another version of the program.
+ *
+ * <p>The fingerprint of a function is a hash over the code and the structure of all edges of the
+ * function, visited in a deterministic order. Function calls are represented by their summary
+ * edges, such that a function is not considered modified if only a called function is modified.
+ * For each function, the node numbers are stored in the order of the traversal. Thus the nodes of
+ * a function that is unchanged between two versions can be mapped onto each other, even if the
+ * node numbers differ (e.g., due to changes in other functions).
+ *
+ * <p>Fingerprints can be written to and read from a file with one line per function, containing
+ * the function name, the fingerprint, and the node numbers.
+ */
+public final class CFAFingerprints {
+
+  private static final Splitter SPLITTER = Splitter.on(' ').omitEmptyStrings();
+
+  private static final class FunctionFingerprint {
+    private final String hash;
+    private final ImmutableList<Integer> nodeNumbers;
+
+    private FunctionFingerprint(String pHash, List<Integer> pNodeNumbers) {
+      hash = pHash;
+      nodeNumbers = ImmutableList.copyOf(pNodeNumbers);
+    }
+
+    @Override
+    public boolean equals(Object pObj) {
+      return pObj instanceof FunctionFingerprint
+          && hash.equals(((FunctionFingerprint) pObj).hash)
+          && nodeNumbers.equals(((FunctionFingerprint) pObj).nodeNumbers);
+    }
+
+    @Override
+    public int hashCode() {
+      return Objects.hash(hash, nodeNumbers);
+    }
+  }
+
+  private final ImmutableSortedMap<String, FunctionFingerprint> functions;
+
+  private CFAFingerprints(Map<String, FunctionFingerprint> pFunctions) {
+    functions = ImmutableSortedMap.copyOf(pFunctions);
+  }
+
+  /** Compute the fingerprints of all functions of the given CFA. */
+  public static CFAFingerprints of(CFA pCfa) {
+    Map<String, FunctionFingerprint> functions = new HashMap<>();
+    for (Entry<String, FunctionEntryNode> function : pCfa.getAllFunctions().entrySet()) {
+      functions.put(function.getKey(), computeFingerprint(function.getValue()));
+    }
+    return new CFAFingerprints(functions);
+  }
+
+  private static FunctionFingerprint computeFingerprint(FunctionEntryNode pEntry) {
+    Hasher hasher = Hashing.sha256().newHasher();
+    Map<CFANode, Integer> ordinals = new LinkedHashMap<>();
+    Deque<CFANode> waitlist = new ArrayDeque<>();
+    ordinals.put(pEntry, 0);
+    waitlist.push(pEntry);
+
+    while (!waitlist.isEmpty()) {
+      CFANode node = waitlist.pop();
+      hasher.putInt(ordinals.get(node)).putBoolean(node.isLoopStart());
+      for (CFAEdge edge : getLeavingEdgesInFunction(node)) {
+        CFANode successor = edge.getSuccessor();
+        Integer ordinal = ordinals.get(successor);
+        if (ordinal == null) {
+          ordinal = ordinals.size();
+          ordinals.put(successor, ordinal);
+          waitlist.push(successor);
+        }
+        hasher
+            .putString(edge.getEdgeType().name(), UTF_8)
+            .putChar('\0')
+            .putString(edge.getCode(), UTF_8)
+            .putChar('\0')
+            .putInt(ordinal);
+      }
+      hasher.putChar('\n');
+    }
+
+    ImmutableList.Builder<Integer> nodeNumbers = ImmutableList.builder();
+    for (CFANode node : ordinals.keySet()) {
+      nodeNumbers.add(node.getNodeNumber());
+    }
+    return new FunctionFingerprint(hasher.hash().toString(), nodeNumbers.build());
+  }
+
+  /** Return the leaving edges of a node without entering or leaving its function. */
+  private static List<CFAEdge> getLeavingEdgesInFunction(CFANode pNode) {
+    ImmutableList.Builder<CFAEdge> edges = ImmutableList.builder();
+    for (int i = 0; i < pNode.getNumLeavingEdges(); i++) {
+      CFAEdge edge = pNode.getLeavingEdge(i);
+      if (edge.getEdgeType() != CFAEdgeType.FunctionCallEdge
+          && edge.getEdgeType() != CFAEdgeType.FunctionReturnEdge) {
+        edges.add(edge);
+      }
+    }
+    FunctionSummaryEdge summaryEdge = pNode.getLeavingSummaryEdge();
+    if (summaryEdge != null) {
+      edges.add(summaryEdge);
+    }
+    return edges.build();
+  }
+
+  /** Read fingerprints from a file that was written with {@link #write(Appendable)}. */
+  public static CFAFingerprints read(Path pFile) throws IOException {
+    try (BufferedReader reader = Files.newBufferedReader(pFile, UTF_8)) {
+      return read(reader);
+    }
+  }
+
+  static CFAFingerprints read(BufferedReader pReader) throws IOException {
+    Map<String, FunctionFingerprint> functions = new HashMap<>();
+    String line;
+    while ((line = pReader.readLine()) != null) {
+      List<String> parts = SPLITTER.splitToList(line);
+      if (parts.isEmpty()) {
+        continue;
+      }
+      checkArgument(parts.size() >= 2, "Invalid line in fingerprint file: %s", line);
+      ImmutableList.Builder<Integer> nodeNumbers = ImmutableList.builder();
+      try {
+        for (String nodeNumber : parts.subList(2, parts.size())) {
+          nodeNumbers.add(Integer.parseInt(nodeNumber));
+        }
+      } catch (NumberFormatException e) {
+        throw new IllegalArgumentException("Invalid line in fingerprint file: " + line, e);
+      }
+      functions.put(parts.get(0), new FunctionFingerprint(parts.get(1), nodeNumbers.build()));
+    }
+    return new CFAFingerprints(functions);
+  }
+
+  /** Write the fingerprints in the format that is expected by {@link #read(Path)}. */
+  public void write(Appendable pOut) throws IOException {
+    for (Entry<String, FunctionFingerprint> function : functions.entrySet()) {
+      pOut.append(function.getKey()).append(' ').append(function.getValue().hash);
+      for (int nodeNumber : function.getValue().nodeNumbers) {
+        pOut.append(' ').append(Integer.toString(nodeNumber));
+      }
+      pOut.append('\n');
+    }
+  }
+
+  /** Return the hash of the given function, or null if the function is not known. */
+  public @Nullable String getHash(String pFunction) {
+    FunctionFingerprint fingerprint = functions.get(pFunction);
+    return fingerprint == null ? null : fingerprint.hash;
+  }
+
+  /** Check whether the given function has the same fingerprint in both instances. */
+  public boolean isUnchanged(String pFunction, CFAFingerprints pOther) {
+    FunctionFingerprint fingerprint = functions.get(pFunction);
+    FunctionFingerprint other = pOther.functions.get(pFunction);
+    return fingerprint != null
+        && other != null
+        && fingerprint.hash.equals(other.hash)
+        && fingerprint.nodeNumbers.size() == other.nodeNumbers.size();
+  }
+
+  /**
+   * Create a mapping from the nodes of a previous program version to the nodes of the given CFA,
+   * which contains the nodes of all functions that are unchanged.
+   *
+   * @param pCfa The CFA of the current program version, for which this instance was computed.
+   * @param pPrevious The fingerprints of the previous program version.
+   */
+  public NodeMapping mapFrom(CFAFingerprints pPrevious, CFA pCfa) {
+    Map<Integer, CFANode> nodes = new HashMap<>();
+    for (CFANode node : pCfa.getAllNodes()) {
+      nodes.put(node.getNodeNumber(), node);
+    }
+
+    ImmutableMap.Builder<Integer, CFANode> mapping = ImmutableMap.builder();
+    for (Entry<String, FunctionFingerprint> function : functions.entrySet()) {
+      if (isUnchanged(function.getKey(), pPrevious)) {
+        List<Integer> previousNodes = pPrevious.functions.get(function.getKey()).nodeNumbers;
+        List<Integer> currentNodes = function.getValue().nodeNumbers;
+        for (int i = 0; i < currentNodes.size(); i++) {
+          CFANode node = nodes.get(currentNodes.get(i));
+          if (node != null) {
+            mapping.put(previousNodes.get(i), node);
+          }
+        }
+      }
+    }
+    return new NodeMapping(mapping.build(), this, pPrevious);
+  }
+
+  /** Mapping of nodes and functions from a previous program version to the current one. */
+  public static final class NodeMapping {
+
+    private final ImmutableMap<Integer, CFANode> nodes;
+    private final CFAFingerprints current;
+    private final CFAFingerprints previous;
+
+    private NodeMapping(
+        ImmutableMap<Integer, CFANode> pNodes,
+        CFAFingerprints pCurrent,
+        CFAFingerprints pPrevious) {
+      nodes = pNodes;
+      current = pCurrent;
+      previous = pPrevious;
+    }
+
+    /**
+     * Return the current node for the given node number of the previous version, or null if the
+     * node does not exist anymore or its function was modified.
+     */
+    public @Nullable CFANode getNode(int pPreviousNodeNumber) {
+      return nodes.get(pPreviousNodeNumber);
+    }
+
+    /** Check whether the given function exists in both versions and is unchanged. */
+    public boolean isUnchanged(String pFunction) {
+      return current.isUnchanged(pFunction, previous);
+    }
+  }
+
+  @Override
+  public boolean equals(Object pObj) {
+    return pObj instanceof CFAFingerprints && functions.equals(((CFAFingerprints) pObj).functions);
+  }
+
+  @Override
+  public int hashCode() {
+    return functions.hashCode();
+  }
+}
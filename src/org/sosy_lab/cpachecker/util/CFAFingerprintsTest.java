@@ -0,0 +1,49 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import java.io.BufferedReader;
+import java.io.IOException;
+import java.io.StringReader;
+import org.junit.Test;
+
+/** Unit tests for {@link CFAFingerprints}. */
+public class CFAFingerprintsTest {
+
+  private static final String FINGERPRINTS = "f 0a1b 5 7 6\nmain 2c3d 1 2 3 4\n";
+
+  private static CFAFingerprints read(String pContent) throws IOException {
+    return CFAFingerprints.read(new BufferedReader(new StringReader(pContent)));
+  }
+
+  @Test
+  public void testWriteRead() throws IOException {
+    CFAFingerprints fingerprints = read(FINGERPRINTS);
+    StringBuilder out = new StringBuilder();
+    fingerprints.write(out);
+    assertThat(out.toString()).isEqualTo(FINGERPRINTS);
+    assertThat(read(out.toString())).isEqualTo(fingerprints);
+  }
+
+  @Test
+  public void testIsUnchanged() throws IOException {
+    CFAFingerprints previous = read(FINGERPRINTS);
+    CFAFingerprints current = read("f 0a1b 8 10 9\nmain ffff 1 2 3 4\ng 4e5f 11\n");
+    assertThat(current.isUnchanged("f", previous)).isTrue();
+    assertThat(current.isUnchanged("main", previous)).isFalse();
+    assertThat(current.isUnchanged("g", previous)).isFalse();
+  }
+
+  @Test(expected = IllegalArgumentException.class)
+  public void testInvalidLine() throws IOException {
+    read("main\n");
+  }
+}
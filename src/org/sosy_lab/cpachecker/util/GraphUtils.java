@@ -20,6 +20,7 @@ import com.google.common.collect.Multimaps;
 import com.google.common.collect.SetMultimap;
 import java.util.ArrayDeque;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.Deque;
@@ -27,7 +28,6 @@ import java.util.HashMap;
 import java.util.HashSet;
 import java.util.List;
 import java.util.Map;
-import java.util.Objects;
 import java.util.Optional;
 import java.util.Set;
 import java.util.function.Function;
@@ -279,73 +279,122 @@ public class GraphUtils {
       List<ARGState> pARGStates, Optional<Collection<ARGState>> pExcludeStates) {
     checkNotNull(pARGStates);
 
-    List<StronglyConnectedComponent> SCCs = new ArrayList<>();
-
-    int index = 0;
-
-    Deque<ARGState> dfsStack = new ArrayDeque<>();
-    Map<ARGState, Integer> stateIndex = new HashMap<>();
-
-    // Map to store the topmost reachable ancestor with the minimum possible index value
-    Map<ARGState, Integer> stateLowLink = new HashMap<>();
-
+    SCCSearch search = new SCCSearch(pExcludeStates);
     for (ARGState state : pARGStates) {
-      if (pExcludeStates.isPresent()) {
-        if (pExcludeStates.orElseThrow().contains(state)) {
-          continue;
-        }
-      }
-      if (!stateIndex.containsKey(state)) {
-        strongConnect(state, index, stateIndex, stateLowLink, dfsStack, SCCs, pExcludeStates);
+      if (!search.isExcluded(state) && !search.isVisited(state)) {
+        search.strongConnect(state);
       }
     }
+    List<StronglyConnectedComponent> SCCs = search.sccs;
     Collections.reverse(SCCs);
     return ImmutableSet.copyOf(SCCs);
   }
 
-  /** Recursively find {@link StronglyConnectedComponent}s using DFS traversal */
-  private static void strongConnect(
-      ARGState pState,
-      int pIndex,
-      Map<ARGState, Integer> pStateIndex,
-      Map<ARGState, Integer> pStateLowLink,
-      Deque<ARGState> pDfsStack,
-      List<StronglyConnectedComponent> pSCCs,
-      Optional<Collection<ARGState>> pExcludeStates) {
-
-    pStateIndex.put(pState, pIndex);
-    pStateLowLink.put(pState, pIndex);
-    pIndex++;
-    pDfsStack.push(pState);
-
-    for (ARGState sucessorState : pState.getChildren()) {
-      if (pExcludeStates.isPresent() && pExcludeStates.orElseThrow().contains(sucessorState)) {
-        continue;
-      }
-      if (!pStateIndex.containsKey(sucessorState)) {
-        // Successor has not yet been visited; recurse on it
-        strongConnect(
-            sucessorState, pIndex, pStateIndex, pStateLowLink, pDfsStack, pSCCs, pExcludeStates);
-        pStateLowLink.put(
-            pState, Math.min(pStateLowLink.get(pState), pStateLowLink.get(sucessorState)));
-      } else if (pDfsStack.contains(sucessorState)) {
-        // Successor is in the stack ('dfsNodeStack') and hence in the current SCC
-        // Otherwise, if the sucessorState is not on the stack, then (pState, sucessorState) is a
-        // cross-edge (not a back edge) in the DFS tree and thus it must be ignored
-        pStateLowLink.put(
-            pState, Math.min(pStateLowLink.get(pState), pStateIndex.get(sucessorState)));
+  /**
+   * Iterative version of Tarjan's algorithm, which uses an explicit stack of DFS frames instead of
+   * recursion, such that deep ARGs do not overflow the call stack. Visited states are numbered
+   * densely in visiting order (which is also their Tarjan index), and all per-state data is stored
+   * in primitive arrays indexed by this number.
+   */
+  private static final class SCCSearch {
+
+    private final Optional<Collection<ARGState>> excludeStates;
+    private final Map<ARGState, Integer> stateIndex = new HashMap<>();
+    private final List<ARGState> states = new ArrayList<>();
+    private final List<List<ARGState>> successors = new ArrayList<>();
+    private final List<StronglyConnectedComponent> sccs = new ArrayList<>();
+
+    // Map to store the topmost reachable ancestor with the minimum possible index value
+    private int[] lowLink = new int[16];
+    private boolean[] onStack = new boolean[16];
+
+    // states that are not yet assigned to an SCC
+    private int[] sccStack = new int[16];
+    private int sccStackSize = 0;
+
+    // DFS frames: the state and the position of its next successor to explore
+    private int[] frameState = new int[16];
+    private int[] frameSuccessor = new int[16];
+    private int frameCount = 0;
+
+    private SCCSearch(Optional<Collection<ARGState>> pExcludeStates) {
+      excludeStates = pExcludeStates;
+    }
+
+    private boolean isExcluded(ARGState pState) {
+      return excludeStates.isPresent() && excludeStates.orElseThrow().contains(pState);
+    }
+
+    private boolean isVisited(ARGState pState) {
+      return stateIndex.containsKey(pState);
+    }
+
+    private void visit(ARGState pState) {
+      int index = states.size();
+      if (index == lowLink.length) {
+        int newLength = 2 * index;
+        lowLink = Arrays.copyOf(lowLink, newLength);
+        onStack = Arrays.copyOf(onStack, newLength);
+        sccStack = Arrays.copyOf(sccStack, newLength);
+        frameState = Arrays.copyOf(frameState, newLength);
+        frameSuccessor = Arrays.copyOf(frameSuccessor, newLength);
       }
+      stateIndex.put(pState, index);
+      states.add(pState);
+      successors.add(ImmutableList.copyOf(pState.getChildren()));
+
+      lowLink[index] = index;
+      onStack[index] = true;
+      sccStack[sccStackSize++] = index;
+      frameState[frameCount] = index;
+      frameSuccessor[frameCount] = 0;
+      frameCount++;
     }
 
-    // If pState is a root node, pop the stack and generate an SCC
-    if (pStateIndex.get(pState).intValue() == pStateLowLink.get(pState).intValue()) {
-      ARGState s;
-      StronglyConnectedComponent scc = new StronglyConnectedComponent(pState);
-      do {
-        s = pDfsStack.pop();
-        scc.addNode(s);
-      } while (!Objects.equals(pState, s));
-      pSCCs.add(scc);
+    /** Find {@link StronglyConnectedComponent}s using DFS traversal from the given state. */
+    private void strongConnect(ARGState pStartState) {
+      visit(pStartState);
+
+      while (frameCount > 0) {
+        int current = frameState[frameCount - 1];
+        List<ARGState> currentSuccessors = successors.get(current);
+
+        if (frameSuccessor[frameCount - 1] < currentSuccessors.size()) {
+          ARGState successorState = currentSuccessors.get(frameSuccessor[frameCount - 1]++);
+          if (isExcluded(successorState)) {
+            continue;
+          }
+          Integer successor = stateIndex.get(successorState);
+          if (successor == null) {
+            // Successor has not yet been visited; descend into it
+            visit(successorState);
+          } else if (onStack[successor]) {
+            // Successor is on the stack and hence in the current SCC.
+            // Otherwise, (current, successor) is a cross-edge (not a back edge)
+            // in the DFS tree and thus it must be ignored
+            lowLink[current] = Math.min(lowLink[current], successor);
+          }
+          continue;
+        }
+
+        // all successors explored, return from the frame
+        frameCount--;
+        if (lowLink[current] == current) {
+          // current is a root node, pop the stack and generate an SCC
+          StronglyConnectedComponent scc = new StronglyConnectedComponent(states.get(current));
+          int s;
+          do {
+            s = sccStack[--sccStackSize];
+            onStack[s] = false;
+            scc.addNode(states.get(s));
+          } while (s != current);
+          sccs.add(scc);
+        }
+        if (frameCount > 0) {
+          int parent = frameState[frameCount - 1];
+          lowLink[parent] = Math.min(lowLink[parent], lowLink[current]);
+        }
+      }
     }
   }
 }
@@ -30,6 +30,7 @@ import com.google.common.collect.Multimap;
 import com.google.common.collect.Multimaps;
 import com.google.common.collect.SortedSetMultimap;
 import com.google.common.collect.TreeMultimap;
+import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.Comparator;
@@ -71,6 +72,7 @@ import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
 import org.sosy_lab.cpachecker.core.specification.Specification;
 import org.sosy_lab.cpachecker.cpa.livevar.LiveVariablesCPA;
+import org.sosy_lab.cpachecker.cpa.livevar.LiveVariablesDataflowSolver;
 import org.sosy_lab.cpachecker.exceptions.CPAException;
 import org.sosy_lab.cpachecker.util.LoopStructure.Loop;
 import org.sosy_lab.cpachecker.util.resources.ResourceLimit;
@@ -139,6 +141,11 @@ public class LiveVariables {
                     min=0)
     private TimeSpan partwiseLivenessCheckTime = TimeSpan.ofSeconds(20);
 
+    @Option(secure=true, description="Compute the function-wise live variables with a worklist"
+        + " solver directly on the CFA instead of running the LiveVariablesCPA with a"
+        + " reached set. The global analysis always uses the CPA.")
+    private boolean useDataflowSolver = true;
+
     public LiveVariablesConfiguration(Configuration config) throws InvalidConfigurationException {
       config.inject(this);
     }
@@ -422,7 +429,13 @@ public class LiveVariables {
     // create live variables
     if (parts.isPresent()) {
       liveVariables =
-          addLiveVariablesFromCFA(cfa, logger, parts.orElseThrow(), config.evaluationStrategy);
+          addLiveVariablesFromCFA(
+              cfa,
+              logger,
+              shutdownNotifier,
+              parts.orElseThrow(),
+              config.evaluationStrategy,
+              config.useDataflowSolver);
     }
 
     if (limitChecker != null) {
@@ -467,11 +480,14 @@ public class LiveVariables {
   private static Multimap<CFANode, Wrapper<ASimpleDeclaration>> addLiveVariablesFromCFA(
       final CFA pCfa,
       final LogManager logger,
+      final ShutdownNotifier shutdownNotifier,
       AnalysisParts analysisParts,
-      EvaluationStrategy evaluationStrategy
+      EvaluationStrategy evaluationStrategy,
+      boolean useDataflowSolver
   ) throws IllegalArgumentException, InterruptedException {
 
     Optional<LoopStructure> loopStructure = pCfa.getLoopStructure();
+    List<CFANode> startNodes = new ArrayList<>();
 
     // put all FunctionExitNodes into the waitlist
     final Collection<FunctionEntryNode> functionHeads;
@@ -490,13 +506,7 @@ public class LiveVariables {
     for (FunctionEntryNode node : functionHeads) {
       FunctionExitNode exitNode = node.getExitNode();
       if (pCfa.getAllNodes().contains(exitNode)) {
-        analysisParts.reachedSet.add(
-            analysisParts.cpa.getInitialState(
-                exitNode,
-                StateSpacePartition.getDefaultPartition()),
-            analysisParts.cpa.getInitialPrecision(
-                exitNode,
-                StateSpacePartition.getDefaultPartition()));
+        startNodes.add(exitNode);
       }
     }
 
@@ -513,21 +523,38 @@ public class LiveVariables {
         // edges because the LoopStructure is not able to say that loops with
         // function calls inside have no outgoing edges
         if (from(l.getOutgoingEdges()).filter(not(instanceOf(FunctionCallEdge.class))).isEmpty()) {
-          CFANode functionHead = l.getLoopHeads().iterator().next();
-          analysisParts.reachedSet.add(
-              analysisParts.cpa.getInitialState(
-                  functionHead, StateSpacePartition.getDefaultPartition()),
-              analysisParts.cpa.getInitialPrecision(
-                  functionHead, StateSpacePartition.getDefaultPartition()));
+          startNodes.add(l.getLoopHeads().iterator().next());
         }
       }
     }
 
+    LiveVariablesCPA liveVarCPA =
+        ((WrapperCPA) analysisParts.cpa).retrieveWrappedCpa(LiveVariablesCPA.class);
+
     logger.log(Level.INFO, "Starting live variables collection ...");
     try {
-      do {
-        analysisParts.algorithm.run(analysisParts.reachedSet);
-      } while (analysisParts.reachedSet.hasWaitingState());
+      if (useDataflowSolver && evaluationStrategy == EvaluationStrategy.FUNCTION_WISE) {
+        // the function-wise analysis does not need a callstack,
+        // so we can solve the dataflow equations directly
+        LiveVariablesDataflowSolver solver =
+            new LiveVariablesDataflowSolver(liveVarCPA, shutdownNotifier);
+        for (CFANode startNode : startNodes) {
+          solver.addStartNode(startNode);
+        }
+        solver.solve();
+
+      } else {
+        for (CFANode startNode : startNodes) {
+          analysisParts.reachedSet.add(
+              analysisParts.cpa.getInitialState(
+                  startNode, StateSpacePartition.getDefaultPartition()),
+              analysisParts.cpa.getInitialPrecision(
+                  startNode, StateSpacePartition.getDefaultPartition()));
+        }
+        do {
+          analysisParts.algorithm.run(analysisParts.reachedSet);
+        } while (analysisParts.reachedSet.hasWaitingState());
+      }
 
     } catch (CPAException | InterruptedException e) {
       logger.logUserException(Level.WARNING, e, "Could not compute live variables.");
@@ -536,8 +563,6 @@ public class LiveVariables {
 
     logger.log(Level.INFO, "Stopping live variables collection ...");
 
-    LiveVariablesCPA liveVarCPA = ((WrapperCPA) analysisParts.cpa).retrieveWrappedCpa(LiveVariablesCPA.class);
-
     return liveVarCPA.getLiveVariables();
   }
 
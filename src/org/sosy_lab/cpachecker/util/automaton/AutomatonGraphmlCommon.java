@@ -15,6 +15,7 @@ import com.google.common.base.Preconditions;
 import com.google.common.collect.FluentIterable;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
+import com.google.common.collect.Maps;
 import com.google.common.collect.Sets;
 import com.google.common.hash.HashCode;
 import com.google.common.hash.Hashing;
@@ -333,6 +334,57 @@ public class AutomatonGraphmlCommon {
     return BaseEncoding.base16().lowerCase().encode(hash.asBytes());
   }
 
+  /**
+   * Returns the data entries that describe a witness graph as a whole (witness type, producer,
+   * specification, program hashes, ...) in the order in which they are written to the graph
+   * element.
+   */
+  public static List<Map.Entry<KeyDef, String>> getGraphDataEntries(
+      WitnessType pGraphType, CFA pCfa, VerificationTaskMetaData pVerificationTaskMetaData)
+      throws IOException {
+    List<Map.Entry<KeyDef, String>> result = new ArrayList<>();
+    result.add(Maps.immutableEntry(KeyDef.WITNESS_TYPE, pGraphType.toString()));
+    result.add(Maps.immutableEntry(KeyDef.SOURCECODELANGUAGE, pCfa.getLanguage().toString()));
+    result.add(
+        Maps.immutableEntry(KeyDef.PRODUCER, pVerificationTaskMetaData.getProducerString()));
+
+    int nSpecs = 0;
+    for (SpecificationProperty property : pVerificationTaskMetaData.getProperties()) {
+      result.add(Maps.immutableEntry(KeyDef.SPECIFICATION, property.toString()));
+      ++nSpecs;
+    }
+
+    for (Path specFile : pVerificationTaskMetaData.getNonPropertySpecificationFiles()) {
+      result.add(
+          Maps.immutableEntry(
+              KeyDef.SPECIFICATION,
+              MoreFiles.asCharSource(specFile, Charsets.UTF_8).read().trim()));
+      ++nSpecs;
+    }
+
+    if (nSpecs == 0) {
+      result.add(Maps.immutableEntry(KeyDef.SPECIFICATION, "TRUE"));
+    }
+
+    for (Path inputWitness : pVerificationTaskMetaData.getInputWitnessFiles()) {
+      result.add(Maps.immutableEntry(KeyDef.INPUTWITNESSHASH, computeHash(inputWitness)));
+    }
+
+    for (Path programFile : pCfa.getFileNames()) {
+      result.add(Maps.immutableEntry(KeyDef.PROGRAMFILE, programFile.toString()));
+    }
+    for (Path programFile : pCfa.getFileNames()) {
+      result.add(Maps.immutableEntry(KeyDef.PROGRAMHASH, computeHash(programFile)));
+    }
+
+    result.add(Maps.immutableEntry(KeyDef.ARCHITECTURE, getArchitecture(pCfa.getMachineModel())));
+    ZonedDateTime now = ZonedDateTime.now(ZoneId.systemDefault()).withNano(0);
+    result.add(
+        Maps.immutableEntry(
+            KeyDef.CREATIONTIME, now.format(DateTimeFormatter.ISO_OFFSET_DATE_TIME)));
+    return result;
+  }
+
   public static class GraphMlBuilder {
 
     private final Document doc;
@@ -365,47 +417,10 @@ public class AutomatonGraphmlCommon {
       graph = doc.createElement("graph");
       root.appendChild(graph);
       graph.setAttribute("edgedefault", "directed");
-      graph.appendChild(createDataElement(KeyDef.WITNESS_TYPE, pGraphType.toString()));
-      graph.appendChild(
-          createDataElement(KeyDef.SOURCECODELANGUAGE, pCfa.getLanguage().toString()));
-      graph.appendChild(
-          createDataElement(KeyDef.PRODUCER, pVerificationTaskMetaData.getProducerString()));
-
-      int nSpecs = 0;
-      for (SpecificationProperty property : pVerificationTaskMetaData.getProperties()) {
-        graph.appendChild(createDataElement(KeyDef.SPECIFICATION, property.toString()));
-        ++nSpecs;
-      }
-
-      for (Path specFile : pVerificationTaskMetaData.getNonPropertySpecificationFiles()) {
-        graph.appendChild(
-            createDataElement(
-                KeyDef.SPECIFICATION,
-                MoreFiles.asCharSource(specFile, Charsets.UTF_8).read().trim()));
-        ++nSpecs;
-      }
-
-      if (nSpecs == 0) {
-        graph.appendChild(createDataElement(KeyDef.SPECIFICATION, "TRUE"));
+      for (Map.Entry<KeyDef, String> graphData :
+          getGraphDataEntries(pGraphType, pCfa, pVerificationTaskMetaData)) {
+        graph.appendChild(createDataElement(graphData.getKey(), graphData.getValue()));
       }
-
-      for (Path inputWitness : pVerificationTaskMetaData.getInputWitnessFiles()) {
-        graph.appendChild(createDataElement(KeyDef.INPUTWITNESSHASH, computeHash(inputWitness)));
-      }
-
-      for (Path programFile : pCfa.getFileNames()) {
-        graph.appendChild(createDataElement(KeyDef.PROGRAMFILE, programFile.toString()));
-      }
-      for (Path programFile : pCfa.getFileNames()) {
-        graph.appendChild(createDataElement(KeyDef.PROGRAMHASH, computeHash(programFile)));
-      }
-
-      graph.appendChild(
-          createDataElement(KeyDef.ARCHITECTURE, getArchitecture(pCfa.getMachineModel())));
-      ZonedDateTime now = ZonedDateTime.now(ZoneId.systemDefault()).withNano(0);
-      graph.appendChild(
-          createDataElement(
-              KeyDef.CREATIONTIME, now.format(DateTimeFormatter.ISO_OFFSET_DATE_TIME)));
     }
 
     private void defineKey(KeyDef pKeyDef) {
@@ -19,6 +19,7 @@ import org.junit.Before;
 import org.junit.Test;
 import org.sosy_lab.common.collect.PathCopyingPersistentTreeMap;
 import org.sosy_lab.common.collect.PersistentMap;
+import org.sosy_lab.common.collect.PersistentSortedMap;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cfa.types.MachineModel;
 import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
@@ -142,7 +143,7 @@ public class TranslatorTest {
 
   @Test
   public void testIntervalAndCartesianTranslator() {
-    PersistentMap<String, Interval> intervals = PathCopyingPersistentTreeMap.of();
+    PersistentSortedMap<String, Interval> intervals = PathCopyingPersistentTreeMap.of();
     PersistentMap<String, Integer> referenceMap = PathCopyingPersistentTreeMap.of();
 
     intervals = intervals.putAndCopy("var1", new Interval(Long.MIN_VALUE, (long) 5));
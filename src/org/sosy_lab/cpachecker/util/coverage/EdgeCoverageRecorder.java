@@ -0,0 +1,155 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.coverage;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.BitSet;
+import java.util.List;
+import java.util.Queue;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionEntryNode;
+import org.sosy_lab.cpachecker.cfa.model.FunctionSummaryEdge;
+
+/**
+ * Records which edges of a CFA are visited while the analysis runs, such that coverage data can
+ * be created at the end without traversing the reached set.
+ *
+ * <p>Every edge of the CFA gets an index, and each thread that records edges sets the bits of the
+ * visited edges in its own {@link BitSet}. The bit sets are merged only when the coverage data is
+ * requested, so recording is cheap and does not need synchronization. Coverage data must not be
+ * requested while edges are recorded.
+ */
+public final class EdgeCoverageRecorder {
+
+  private final CFA cfa;
+
+  /** The index of the first leaving edge of each node, indexed by node number, or -1. */
+  private final int[] firstEdgeIndex;
+
+  private final CFAEdge[] edges;
+
+  private final Queue<BitSet> visitedEdgesPerThread = new ConcurrentLinkedQueue<>();
+  private final ThreadLocal<BitSet> visitedEdges =
+      ThreadLocal.withInitial(
+          () -> {
+            BitSet visited = new BitSet(getNumberOfEdges());
+            visitedEdgesPerThread.add(visited);
+            return visited;
+          });
+
+  /** Edges that were not part of the CFA when this recorder was created. */
+  private final Set<CFAEdge> unindexedEdges = ConcurrentHashMap.newKeySet();
+
+  public EdgeCoverageRecorder(CFA pCfa) {
+    cfa = checkNotNull(pCfa);
+
+    int maxNodeNumber = -1;
+    for (CFANode node : cfa.getAllNodes()) {
+      maxNodeNumber = Math.max(maxNodeNumber, node.getNodeNumber());
+    }
+    firstEdgeIndex = new int[maxNodeNumber + 1];
+    Arrays.fill(firstEdgeIndex, -1);
+
+    List<CFAEdge> edgeList = new ArrayList<>();
+    for (CFANode node : cfa.getAllNodes()) {
+      firstEdgeIndex[node.getNodeNumber()] = edgeList.size();
+      for (int i = 0; i < node.getNumLeavingEdges(); i++) {
+        edgeList.add(node.getLeavingEdge(i));
+      }
+      // the summary edge gets the index after the other leaving edges
+      FunctionSummaryEdge summaryEdge = node.getLeavingSummaryEdge();
+      if (summaryEdge != null) {
+        edgeList.add(summaryEdge);
+      }
+    }
+    edges = edgeList.toArray(new CFAEdge[0]);
+  }
+
+  private int getNumberOfEdges() {
+    return edges.length;
+  }
+
+  /** Return the CFA whose edges are recorded. */
+  public CFA getCFA() {
+    return cfa;
+  }
+
+  /** Mark the given edge as visited. */
+  public void recordEdge(CFAEdge pEdge) {
+    int index = getIndex(pEdge);
+    if (index >= 0) {
+      visitedEdges.get().set(index);
+    } else {
+      unindexedEdges.add(pEdge);
+    }
+  }
+
+  private int getIndex(CFAEdge pEdge) {
+    CFANode predecessor = pEdge.getPredecessor();
+    int nodeNumber = predecessor.getNodeNumber();
+    if (nodeNumber >= firstEdgeIndex.length || firstEdgeIndex[nodeNumber] < 0) {
+      return -1;
+    }
+    int index = firstEdgeIndex[nodeNumber];
+    int numLeavingEdges = predecessor.getNumLeavingEdges();
+    for (int i = 0; i < numLeavingEdges; i++) {
+      if (predecessor.getLeavingEdge(i) == pEdge) {
+        index += i;
+        break;
+      }
+    }
+    if (index >= edges.length || edges[index] != pEdge) {
+      // a summary edge, or the CFA was changed after creating this recorder
+      index = firstEdgeIndex[nodeNumber] + numLeavingEdges;
+      if (index >= edges.length || edges[index] != pEdge) {
+        return -1;
+      }
+    }
+    return index;
+  }
+
+  /**
+   * Create the coverage data for the edges that were visited so far, merging the records of all
+   * threads.
+   */
+  public CoverageData toCoverageData() {
+    CoverageData cov = new CoverageData();
+    cov.putCFA(cfa);
+
+    BitSet visited = new BitSet(edges.length);
+    for (BitSet visitedByThread : visitedEdgesPerThread) {
+      visited.or(visitedByThread);
+    }
+    for (int i = visited.nextSetBit(0); i >= 0; i = visited.nextSetBit(i + 1)) {
+      addVisitedEdge(cov, edges[i]);
+    }
+    for (CFAEdge edge : unindexedEdges) {
+      addVisitedEdge(cov, edge);
+    }
+    return cov;
+  }
+
+  private static void addVisitedEdge(CoverageData pCov, CFAEdge pEdge) {
+    pCov.addVisitedEdge(pEdge);
+    if (pEdge.getPredecessor() instanceof FunctionEntryNode) {
+      FunctionEntryNode entryNode = (FunctionEntryNode) pEdge.getPredecessor();
+      if (entryNode.getFileLocation().getStartingLineNumber() != 0) {
+        pCov.addVisitedFunction(entryNode);
+      }
+    }
+  }
+}
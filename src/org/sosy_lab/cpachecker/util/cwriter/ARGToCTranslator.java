@@ -22,11 +22,13 @@ import java.util.ArrayDeque;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Deque;
+import java.util.HashMap;
 import java.util.HashSet;
 import java.util.LinkedHashSet;
 import java.util.List;
 import java.util.Map;
 import java.util.Map.Entry;
+import java.util.Optional;
 import java.util.Set;
 import java.util.StringJoiner;
 import java.util.logging.Level;
@@ -146,6 +148,29 @@ public class ARGToCTranslator {
   private @Nullable Set<ARGState> addPragmaAfter;
   private Map<ARGState, List<CDeclaration>> copyValuesForGoto;
 
+  /** Maps each root of an ARG subtree that occurs more than once to the id of its structure. */
+  private Map<ARGState, Integer> identicalSubtrees = ImmutableMap.of();
+  /** The first translated occurrence of each subtree structure, which others may jump to. */
+  private final Map<Integer, SharedSubtree> sharedSubtrees = new HashMap<>();
+  /** The number of the last local declaration that was added to a block. */
+  private final Map<CompoundStatement, Integer> lastDeclarationInBlock = new HashMap<>();
+  private int declarationCounter = 0;
+  private int numberOfSharedSubtrees = 0;
+
+  private static final int NOT_SHAREABLE = -1;
+
+  private static class SharedSubtree {
+    private final ARGState root;
+    private final CompoundStatement block;
+    private final int declarationsBefore;
+
+    private SharedSubtree(ARGState pRoot, CompoundStatement pBlock, int pDeclarationsBefore) {
+      root = pRoot;
+      block = pBlock;
+      declarationsBefore = pDeclarationsBefore;
+    }
+  }
+
   public ARGToCTranslator(LogManager pLogger, Configuration pConfig, MachineModel pMachineModel)
       throws InvalidConfigurationException {
     config = new TranslatorConfig(pConfig);
@@ -167,6 +192,21 @@ public class ARGToCTranslator {
   public String translateARG(
       ARGState argRoot, @Nullable Set<ARGState> pAddPragma, boolean hasGotoDecProblem)
       throws CPAException, IOException {
+    StringBuilder buffer = new StringBuilder();
+    translateARG(argRoot, pAddPragma, hasGotoDecProblem, buffer);
+    return buffer.toString();
+  }
+
+  /**
+   * Translates the ARG into a C program and writes it directly to the given destination, which
+   * avoids building the (potentially huge) program text in memory first.
+   */
+  public void translateARG(
+      ARGState argRoot,
+      @Nullable Set<ARGState> pAddPragma,
+      boolean hasGotoDecProblem,
+      Appendable pDestination)
+      throws CPAException, IOException {
 
     addPragmaAfter = pAddPragma == null ? ImmutableSet.of() : pAddPragma;
 
@@ -175,24 +215,28 @@ public class ARGToCTranslator {
     } else {
       copyValuesForGoto = ImmutableMap.of();
     }
+    if (config.doShareIdenticalSubtrees()) {
+      identicalSubtrees = identifyIdenticalSubtrees(argRoot);
+    }
     translate(argRoot);
+    if (config.doShareIdenticalSubtrees()) {
+      logger.log(
+          Level.FINE,
+          "Replaced",
+          numberOfSharedSubtrees,
+          "ARG subtrees by jumps to identical code.");
+    }
 
-    return generateCCode();
+    generateCCode(pDestination);
   }
 
-
-
-  private String generateCCode() throws IOException {
-    StringBuilder buffer = new StringBuilder();
-
-    try (StatementWriter writer = StatementWriter.getWriter(buffer, config)) {
+  private void generateCCode(Appendable pDestination) throws IOException {
+    try (StatementWriter writer = StatementWriter.getWriter(pDestination, config)) {
       for (String globalDef : globalDefinitionsList) {
         writer.write(globalDef);
       }
       mainFunction.accept(writer);
     }
-
-    return buffer.toString();
   }
 
   private void translate(ARGState rootElement) throws CPAException {
@@ -228,9 +272,25 @@ public class ARGToCTranslator {
 
   private void getRelevantChildrenOfElement(ARGState currentElement, Deque<ARGEdge> waitlist, CompoundStatement currentBlock) {
     discoveredElements.add(currentElement);
+    @Nullable ARGState identicalSubtree = findSharedSubtree(currentElement, currentBlock);
     // generate label for element and add to current block if needed
     generateLabel(currentElement, currentBlock);
 
+    if (identicalSubtree != null) {
+      // the code for the subtree of this element was already generated; jump to it
+      if (copyValuesForGoto.containsKey(identicalSubtree)) {
+        addTmpAssignments(
+            currentBlock,
+            copyValuesForGoto.get(identicalSubtree),
+            identicalSubtree.getStateId(),
+            false);
+      }
+      currentBlock.addStatement(
+          new SimpleStatement("goto label_" + identicalSubtree.getStateId() + ";"));
+      numberOfSharedSubtrees++;
+      return;
+    }
+
     // find the next elements to add to the waitlist
     Collection<ARGState> childrenOfElement = currentElement.getChildren();
 
@@ -467,8 +527,167 @@ public class ARGToCTranslator {
     return newBlock;
   }
 
+  /**
+   * Returns the first translated occurrence of the subtree of the given element if the current
+   * element may jump to it instead of generating the same code again. Registers the element as
+   * first occurrence if there is none yet.
+   */
+  private @Nullable ARGState findSharedSubtree(
+      ARGState pElement, CompoundStatement pCurrentBlock) {
+    Integer subtree = identicalSubtrees.get(pElement);
+    if (subtree == null) {
+      return null;
+    }
+    SharedSubtree shared = sharedSubtrees.get(subtree);
+    if (shared == null) {
+      sharedSubtrees.put(subtree, new SharedSubtree(pElement, pCurrentBlock, declarationCounter));
+      return null;
+    }
+    if (hasSameVariablesInScope(shared, pCurrentBlock)) {
+      return shared.root;
+    }
+    return null;
+  }
+
+  private boolean isFirstOccurrenceOfSharedSubtree(ARGState pElement) {
+    Integer subtree = identicalSubtrees.get(pElement);
+    return subtree != null && sharedSubtrees.get(subtree).root == pElement;
+  }
+
+  /**
+   * Shared subtrees contain no declarations, but refer to variables declared before them. Jumping
+   * into the code of a shared subtree is thus only allowed if the same declarations are visible
+   * at both places, i.e., if no local declaration was added to the blocks that enclose only one
+   * of them, or to their common block after the shared code was started.
+   */
+  private boolean hasSameVariablesInScope(SharedSubtree pShared, CompoundStatement pBlock) {
+    Set<CompoundStatement> enclosingShared = new HashSet<>();
+    for (CompoundStatement b = pShared.block; b != null; b = b.getSurroundingBlock()) {
+      enclosingShared.add(b);
+    }
+
+    CompoundStatement common = pBlock;
+    while (!enclosingShared.contains(common)) {
+      if (common == null || lastDeclarationInBlock.containsKey(common)) {
+        return false;
+      }
+      common = common.getSurroundingBlock();
+    }
+    for (CompoundStatement b = pShared.block; b != common; b = b.getSurroundingBlock()) {
+      if (lastDeclarationInBlock.containsKey(b)) {
+        return false;
+      }
+    }
+    return lastDeclarationInBlock.getOrDefault(common, 0) <= pShared.declarationsBefore;
+  }
+
+  private void noteDeclaration(CompoundStatement pBlock) {
+    if (config.doShareIdenticalSubtrees()) {
+      lastDeclarationInBlock.put(pBlock, ++declarationCounter);
+    }
+  }
+
+  /**
+   * Groups the subtrees of the ARG by their structure: two subtrees get the same id if they are
+   * translated to the same code, except for the ids used in labels. Subtrees with declarations,
+   * function calls, or returns are not considered, as their code depends on the surrounding
+   * blocks. States that are goto targets themselves (states with several parents or states that
+   * cover others) are compared by identity.
+   *
+   * @return the ids of all subtrees whose structure occurs at least twice
+   */
+  private Map<ARGState, Integer> identifyIdenticalSubtrees(final ARGState pRoot) {
+    Map<ARGState, Integer> subtreeIds = new HashMap<>();
+    Map<List<Object>, Integer> idsOfStructures = new HashMap<>();
+    List<Integer> occurrences = new ArrayList<>();
+    Set<ARGState> visited = new HashSet<>();
+    Deque<ARGState> waitlist = new ArrayDeque<>();
+
+    // post-order traversal, so that the ids of all children are known before their parent's
+    waitlist.push(pRoot);
+    while (!waitlist.isEmpty()) {
+      ARGState current = waitlist.peek();
+      if (visited.add(current)) {
+        for (ARGState child : current.getChildren()) {
+          if (!visited.contains(child)) {
+            waitlist.push(child);
+          }
+        }
+        continue;
+      }
+      waitlist.pop();
+      if (subtreeIds.containsKey(current)) {
+        continue;
+      }
+
+      List<Object> structure = getSubtreeStructure(current, subtreeIds);
+      int id = NOT_SHAREABLE;
+      if (structure != null) {
+        id = idsOfStructures.computeIfAbsent(structure, k -> idsOfStructures.size());
+        if (id == occurrences.size()) {
+          occurrences.add(0);
+        }
+        occurrences.set(id, occurrences.get(id) + 1);
+      }
+      subtreeIds.put(current, id);
+    }
+
+    Map<ARGState, Integer> result = new HashMap<>();
+    for (Entry<ARGState, Integer> subtree : subtreeIds.entrySet()) {
+      int id = subtree.getValue();
+      if (id != NOT_SHAREABLE && occurrences.get(id) > 1) {
+        result.put(subtree.getKey(), id);
+      }
+    }
+    return result;
+  }
+
+  private @Nullable List<Object> getSubtreeStructure(
+      ARGState pState, Map<ARGState, Integer> pSubtreeIds) {
+    if (pState.getChildren().isEmpty()) {
+      // nothing to gain from sharing a single statement
+      return null;
+    }
+
+    List<Object> structure = new ArrayList<>();
+    for (ARGState child : pState.getChildren()) {
+      CFAEdge edge = pState.getEdgeToChild(child);
+      if (edge == null
+          || edge instanceof CDeclarationEdge
+          || edge instanceof CFunctionCallEdge
+          || edge instanceof CFunctionReturnEdge
+          || edge instanceof CReturnStatementEdge
+          || mustHandleDefaultReturn(edge)) {
+        return null;
+      }
+      structure.add(edge);
+      // edges are compared by their end points only, which does not distinguish both branches
+      structure.add(edge instanceof CAssumeEdge && ((CAssumeEdge) edge).getTruthAssumption());
+      structure.add(child.isTarget() && addPragmaAfter.contains(child));
+      structure.add(child.isTarget());
+      structure.add(getAssumptionCode(child).orElse(""));
+
+      if (child.isCovered()) {
+        structure.add(ImmutableList.of(child.getCoveringState()));
+      } else if (child.getParents().size() > 1 || !child.getCoveredByThis().isEmpty()) {
+        structure.add(child);
+      } else if (child.getChildren().isEmpty()) {
+        structure.add(AbstractStates.extractLocation(child));
+      } else {
+        Integer childId = pSubtreeIds.get(child);
+        if (childId == null || childId == NOT_SHAREABLE) {
+          return null;
+        }
+        structure.add(childId);
+      }
+    }
+    return structure;
+  }
+
   private void generateLabel(ARGState currentElement, CompoundStatement block) {
-    if(!currentElement.getCoveredByThis().isEmpty() || mergeElements.contains(currentElement)) {
+    if (!currentElement.getCoveredByThis().isEmpty()
+        || mergeElements.contains(currentElement)
+        || isFirstOccurrenceOfSharedSubtree(currentElement)) {
       // this element covers others; they may want to jump to it
       if (copyValuesForGoto.containsKey(currentElement)) {
         addTmpAssignments(
@@ -554,6 +773,7 @@ public class ARGToCTranslator {
     if (edge instanceof CFunctionCallEdge) {
       // if this is a function call edge we need to inline it
       currentBlock = processFunctionCall(edge, currentBlock);
+      noteDeclaration(currentBlock);
     }
     else if (edge instanceof CReturnStatementEdge) {
       CReturnStatementEdge returnEdge = (CReturnStatementEdge)edge;
@@ -604,6 +824,9 @@ public class ARGToCTranslator {
           edgeStatementCodes.append(processSimpleEdge(innerEdge));
         }
         edgeStatementCodes.append("\n");
+        if (innerEdge instanceof CDeclarationEdge) {
+          noteDeclaration(currentBlock);
+        }
       }
       currentBlock.addStatement(new SimpleStatement(edge, edgeStatementCodes.toString()));
     } else if (mustHandleDefaultReturn(edge)) {
@@ -613,6 +836,9 @@ public class ARGToCTranslator {
       String statement = processSimpleEdge(edge);
       if (!statement.isEmpty()) {
         currentBlock.addStatement(new SimpleStatement(edge, statement));
+        if (edge instanceof CDeclarationEdge) {
+          noteDeclaration(currentBlock);
+        }
       }
     }
 
@@ -629,9 +855,16 @@ public class ARGToCTranslator {
   }
 
   private void handleAssumptions(ARGState childElement, CompoundStatement currentBlock) {
+    Optional<String> statement = getAssumptionCode(childElement);
+    if (statement.isPresent()) {
+      currentBlock.addStatement(new SimpleStatement(statement.orElseThrow()));
+    }
+  }
+
+  private Optional<String> getAssumptionCode(ARGState pElement) {
     if (config.doAddAssumptions()) {
       List<AExpression> assumptions = new ArrayList<>();
-      AbstractStates.asIterable(childElement)
+      AbstractStates.asIterable(pElement)
           .filter(AbstractStateWithAssumptions.class)
           .transform(x -> x.getAssumptions())
           .forEach(x -> assumptions.addAll(x));
@@ -639,10 +872,10 @@ public class ARGToCTranslator {
       if (!assumptions.isEmpty()) {
         StringJoiner joiner = new StringJoiner(" && ", "__VERIFIER_assume(", ");");
         assumptions.stream().map(x -> x.toQualifiedASTString()).forEach(joiner::add);
-        String statement = joiner.toString();
-        currentBlock.addStatement(new SimpleStatement(statement));
+        return Optional.of(joiner.toString());
       }
     }
+    return Optional.empty();
   }
 
   private boolean mustHandleDefaultReturn(final CFAEdge pEdge) {
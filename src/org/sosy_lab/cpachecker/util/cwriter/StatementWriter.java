@@ -12,6 +12,9 @@ import static com.google.common.base.Preconditions.checkState;
 
 import java.io.Closeable;
 import java.io.IOException;
+import java.util.ArrayDeque;
+import java.util.Deque;
+import java.util.Iterator;
 import java.util.Optional;
 import org.sosy_lab.cpachecker.util.cwriter.ARGToCTranslator.TargetTreatment;
 import org.sosy_lab.cpachecker.util.cwriter.Statement.CompoundStatement;
@@ -126,21 +129,46 @@ public class StatementWriter implements StatementVisitor<IOException>, Closeable
     visitCompound(pS);
   }
 
+  /**
+   * Writes the given block and all blocks nested in it. Residual programs open a new block for
+   * every branching in the ARG, so the nesting depth grows with the depth of the ARG. Nested
+   * blocks are thus handled with an explicit stack instead of recursion.
+   */
   private void visitCompound(CompoundStatement pS) throws IOException {
-    addLabelIfNecessary(pS);
-    addIndent();
-    sb.append("{\n");
-
-    for (Statement statement : pS.getStatements()) {
-      int indentBefore = currentIndent;
+    final int indentBefore = currentIndent;
+    Deque<Iterator<Statement>> openBlocks = new ArrayDeque<>();
+    openBlock(pS, openBlocks);
+
+    while (!openBlocks.isEmpty()) {
+      Iterator<Statement> remaining = openBlocks.peek();
+      if (!remaining.hasNext()) {
+        openBlocks.pop();
+        addIndent();
+        sb.append("}\n");
+        if (!openBlocks.isEmpty()) {
+          decreaseIndent();
+        }
+        continue;
+      }
+
+      Statement statement = remaining.next();
       increaseIndent();
-      statement.accept(this);
-      decreaseIndent();
-      checkState(currentIndent == indentBefore);
+      if (statement instanceof CompoundStatement) {
+        openBlock((CompoundStatement) statement, openBlocks);
+      } else {
+        statement.accept(this);
+        decreaseIndent();
+      }
     }
+    checkState(currentIndent == indentBefore);
+  }
 
+  private void openBlock(CompoundStatement pBlock, Deque<Iterator<Statement>> pOpenBlocks)
+      throws IOException {
+    addLabelIfNecessary(pBlock);
     addIndent();
-    sb.append("}\n");
+    sb.append("{\n");
+    pOpenBlocks.push(pBlock.getStatements().iterator());
   }
 
   @Override
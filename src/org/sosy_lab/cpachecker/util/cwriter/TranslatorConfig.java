@@ -46,6 +46,15 @@ public class TranslatorConfig {
               + " states. Disable if you want to create residual programs.")
   private boolean addAssumptions = true;
 
+  @Option(
+      secure = true,
+      description =
+          "Write the code for structurally identical subtrees of the ARG only once and jump to"
+              + " it with a goto from the other occurrences. Only subtrees without declarations,"
+              + " function calls, and returns are shared, and only if the same variables are in"
+              + " scope at both occurrences.")
+  private boolean shareIdenticalSubtrees = false;
+
   @Option(
       secure = true,
       description =
@@ -81,6 +90,10 @@ public class TranslatorConfig {
     return addAssumptions;
   }
 
+  public boolean doShareIdenticalSubtrees() {
+    return shareIdenticalSubtrees;
+  }
+
   public Path getMetadataOutput() {
     return metadataOutput;
   }
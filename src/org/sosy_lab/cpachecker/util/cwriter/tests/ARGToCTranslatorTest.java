@@ -123,6 +123,29 @@ public final class ARGToCTranslatorTest {
     }
   }
 
+  @RunWith(Parameterized.class)
+  public static class SharedSubtreeTranslationTest extends TranslationTest {
+
+    public SharedSubtreeTranslationTest(
+        String pTestLabel, String pProgram, boolean pVerdict, boolean pHasGotoDecProblem)
+        throws InvalidConfigurationException, IOException {
+      super(pTestLabel, pProgram, pVerdict, pHasGotoDecProblem);
+    }
+
+    @Override
+    protected ConfigurationBuilder getGenerationConfig(String propfile)
+        throws InvalidConfigurationException {
+      return super.getGenerationConfig(propfile)
+          .setOption("cpa.arg.export.code.shareIdenticalSubtrees", "true");
+    }
+
+    @Parameters(name = "{0}")
+    public static Collection<Object[]> data() {
+      // sharing code of identical subtrees must not change the verdict
+      return TranslationTest.data();
+    }
+  }
+
   @RunWith(Parameterized.class)
   public static class SpecificationCombinationTest extends TranslationTest {
     private final String spec;
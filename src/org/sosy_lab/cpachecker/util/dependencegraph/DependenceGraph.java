@@ -82,6 +82,23 @@ public final class DependenceGraph implements Serializable {
     shutdownNotifier = pShutdownNotifier;
   }
 
+  private DependenceGraph(
+      final ImmutableNodeMap pNodes,
+      final ImmutableTable<DGNode, DGNode, DependenceType> pEdges,
+      final ShutdownNotifier pShutdownNotifier) {
+    nodes = pNodes;
+    adjacencyMatrix = pEdges;
+    shutdownNotifier = pShutdownNotifier;
+  }
+
+  /**
+   * Return a dependence graph with the same nodes and edges as this one that uses the given
+   * shutdown notifier for its traversals. The data of the graph is shared and not copied.
+   */
+  public DependenceGraph withShutdownNotifier(final ShutdownNotifier pShutdownNotifier) {
+    return new DependenceGraph(nodes, adjacencyMatrix, pShutdownNotifier);
+  }
+
   public static DependenceGraphBuilder builder(
       final CFA pCfa,
       final Configuration pConfig,
@@ -10,6 +10,7 @@ package org.sosy_lab.cpachecker.util.dependencegraph;
 
 import static com.google.common.base.Preconditions.checkNotNull;
 
+import com.google.common.base.Throwables;
 import com.google.common.collect.ForwardingTable;
 import com.google.common.collect.HashBasedTable;
 import com.google.common.collect.ImmutableList;
@@ -17,6 +18,7 @@ import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Iterables;
 import com.google.common.collect.Table;
 import com.google.common.collect.Table.Cell;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
 import java.io.IOException;
 import java.io.PrintStream;
 import java.io.Writer;
@@ -32,11 +34,16 @@ import java.util.Map;
 import java.util.Map.Entry;
 import java.util.Optional;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.logging.Level;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.ConfigurationBuilder;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -146,6 +153,38 @@ public class DependenceGraphBuilder implements StatisticsProvider {
       description = "Whether to consider (data-)flow dependencies.")
   private boolean considerFlowDeps = true;
 
+  @Option(
+      secure = true,
+      description =
+          "Number of threads for computing the flow and control dependences."
+              + " With more than one thread, the functions are handled in parallel.")
+  @IntegerOption(min = 1)
+  private int threads = 1;
+
+  /** The analysis that provides the pointer information for the flow dependences. */
+  public enum PointerAnalysisType {
+    /** Run the flow-sensitive PointerCPA over the whole program. */
+    FLOW_SENSITIVE,
+    /** Solve flow-insensitive inclusion constraints without running a CPA. */
+    ANDERSEN
+  }
+
+  @Option(
+      secure = true,
+      name = "flowdeps.pointerAnalysis",
+      description =
+          "Which pointer analysis to use for the flow dependences. FLOW_SENSITIVE runs the"
+              + " PointerCPA over the whole program, ANDERSEN solves flow-insensitive inclusion"
+              + " constraints directly, which scales better but is less precise.")
+  private PointerAnalysisType pointerAnalysis = PointerAnalysisType.FLOW_SENSITIVE;
+
+  @Option(
+      secure = true,
+      name = "flowdeps.fieldSensitivePointerAnalysis",
+      description =
+          "Whether the ANDERSEN pointer analysis distinguishes the fields of composite types.")
+  private boolean fieldSensitivePointerAnalysis = true;
+
   public DependenceGraphBuilder(
       final CFA pCfa,
       final Configuration pConfig,
@@ -268,8 +307,19 @@ public class DependenceGraphBuilder implements StatisticsProvider {
 
   private void addFlowDependencesNew() throws InterruptedException, CPAException {
 
-    GlobalPointerState pointerState =
-        GlobalPointerState.createFlowSensitive(cfa, logger, shutdownNotifier);
+    final GlobalPointerState pointerState;
+    switch (pointerAnalysis) {
+      case FLOW_SENSITIVE:
+        pointerState = GlobalPointerState.createFlowSensitive(cfa, logger, shutdownNotifier);
+        break;
+      case ANDERSEN:
+        pointerState =
+            GlobalPointerState.createAndersen(
+                cfa, fieldSensitivePointerAnalysis, shutdownNotifier);
+        break;
+      default:
+        throw new AssertionError("Unhandled pointer analysis: " + pointerAnalysis);
+    }
 
     boolean unknownPointer = false;
 
@@ -335,124 +385,147 @@ public class DependenceGraphBuilder implements StatisticsProvider {
       }
     }
 
-    for (FunctionEntryNode entryNode : cfa.getAllFunctionHeads()) {
+    for (FunctionDependences dependences :
+        computeForAllFunctions(
+            entryNode ->
+                computeFlowDependences(
+                    entryNode,
+                    pointerState,
+                    foreignDefUseData,
+                    globalEdges,
+                    declarationEdges))) {
+      dependences.addTo(this);
+      flowDependenceNumber.setNextValue(dependences.count);
+    }
+  }
 
-      StatCounter flowDepCounter = new StatCounter("Flow Dependency Counter");
+  /**
+   * Compute the flow dependences of a single function. This does not modify the state of the
+   * builder and can be called for several functions in parallel.
+   */
+  private FunctionDependences computeFlowDependences(
+      FunctionEntryNode entryNode,
+      GlobalPointerState pointerState,
+      ForeignDefUseData foreignDefUseData,
+      List<CFAEdge> globalEdges,
+      Map<String, CFAEdge> declarationEdges) {
+
+    FunctionDependences dependences = new FunctionDependences();
+
+    CFAEdge funcDeclEdge = declarationEdges.get(entryNode.getFunctionName());
+    for (CFAEdge callEdge : CFAUtils.enteringEdges(entryNode)) {
+      dependences.addFlowDependence(funcDeclEdge, Optional.empty(), callEdge, Optional.empty());
+      dependences.count++;
+    }
 
-      CFAEdge funcDeclEdge = declarationEdges.get(entryNode.getFunctionName());
-      for (CFAEdge callEdge : CFAUtils.enteringEdges(entryNode)) {
-        addFlowDependence(funcDeclEdge, Optional.empty(), callEdge, Optional.empty());
-        flowDepCounter.inc();
-      }
+    DomTree<CFANode> domTree = DominanceUtils.createFunctionDomTree(entryNode);
 
-      DomTree<CFANode> domTree = DominanceUtils.createFunctionDomTree(entryNode);
+    DependenceConsumer dependenceConsumer =
+        (defEdge, useEdge, cause) -> {
+          Optional<MemoryLocation> defEdgeCause = Optional.empty();
+          Optional<MemoryLocation> useEdgeCause = Optional.empty();
 
-      DependenceConsumer dependenceConsumer =
-          (defEdge, useEdge, cause) -> {
-            Optional<MemoryLocation> defEdgeCause = Optional.empty();
-            Optional<MemoryLocation> useEdgeCause = Optional.empty();
+          if (defEdge instanceof CFunctionCallEdge
+              || defEdge instanceof CFunctionReturnEdge
+              || defEdge instanceof CFunctionSummaryEdge) {
+            defEdgeCause = Optional.of(cause);
+          }
 
-            if (defEdge instanceof CFunctionCallEdge
-                || defEdge instanceof CFunctionReturnEdge
-                || defEdge instanceof CFunctionSummaryEdge) {
-              defEdgeCause = Optional.of(cause);
-            }
+          if (useEdge instanceof CFunctionCallEdge
+              || useEdge instanceof CFunctionReturnEdge
+              || useEdge instanceof CFunctionSummaryEdge) {
+            useEdgeCause = Optional.of(cause);
+          }
 
-            if (useEdge instanceof CFunctionCallEdge
-                || useEdge instanceof CFunctionReturnEdge
-                || useEdge instanceof CFunctionSummaryEdge) {
-              useEdgeCause = Optional.of(cause);
+          if (defEdge instanceof CFunctionReturnEdge
+              && useEdge instanceof CFunctionSummaryEdge
+              && ((CFunctionReturnEdge) defEdge)
+                  .getFunctionEntry()
+                  .getReturnVariable()
+                  .transform(decl -> MemoryLocation.valueOf(decl.getQualifiedName()))
+                  .toJavaUtil()
+                  .equals(defEdgeCause)) {
+
+            CFunctionCallEdge callEdge = getCallEdge((CFunctionSummaryEdge) useEdge);
+            EdgeDefUseData defUseData = EdgeDefUseData.extract(callEdge);
+
+            for (MemoryLocation summaryEdgeDef : defUseData.getDefs()) {
+              dependences.addFlowDependence(
+                  defEdge, defEdgeCause, useEdge, Optional.of(summaryEdgeDef));
             }
 
-            if (defEdge instanceof CFunctionReturnEdge
-                && useEdge instanceof CFunctionSummaryEdge
-                && ((CFunctionReturnEdge) defEdge)
-                    .getFunctionEntry()
-                    .getReturnVariable()
-                    .transform(decl -> MemoryLocation.valueOf(decl.getQualifiedName()))
-                    .toJavaUtil()
-                    .equals(defEdgeCause)) {
-
-              CFunctionCallEdge callEdge = getCallEdge((CFunctionSummaryEdge) useEdge);
-              EdgeDefUseData defUseData = EdgeDefUseData.extract(callEdge);
-
-              for (MemoryLocation summaryEdgeDef : defUseData.getDefs()) {
-                addFlowDependence(defEdge, defEdgeCause, useEdge, Optional.of(summaryEdgeDef));
-              }
-
-            } else if (useEdge instanceof CFunctionSummaryEdge
-                && !(defEdge instanceof CFunctionReturnEdge)) {
-
-              CFunctionSummaryEdge summaryEdge = (CFunctionSummaryEdge) useEdge;
-              List<CParameterDeclaration> params =
-                  summaryEdge.getFunctionEntry().getFunctionParameters();
-              List<CExpression> expressions =
-                  summaryEdge.getExpression().getFunctionCallExpression().getParameterExpressions();
-
-              assert params.size() == expressions.size();
-
-              CFunctionCall functionCall = summaryEdge.getExpression();
-              if (functionCall instanceof CFunctionCallAssignmentStatement) {
-                CLeftHandSide lhs =
-                    ((CFunctionCallAssignmentStatement) functionCall).getLeftHandSide();
-                EdgeDefUseData defUseData = EdgeDefUseData.extract(lhs);
-                if (defUseData.getUses().contains(cause)
-                    || !defUseData.getPointeeUses().isEmpty()) {
-                  addFlowDependence(defEdge, defEdgeCause, useEdge, useEdgeCause);
-                }
+          } else if (useEdge instanceof CFunctionSummaryEdge
+              && !(defEdge instanceof CFunctionReturnEdge)) {
+
+            CFunctionSummaryEdge summaryEdge = (CFunctionSummaryEdge) useEdge;
+            List<CParameterDeclaration> params =
+                summaryEdge.getFunctionEntry().getFunctionParameters();
+            List<CExpression> expressions =
+                summaryEdge.getExpression().getFunctionCallExpression().getParameterExpressions();
+
+            assert params.size() == expressions.size();
+
+            CFunctionCall functionCall = summaryEdge.getExpression();
+            if (functionCall instanceof CFunctionCallAssignmentStatement) {
+              CLeftHandSide lhs =
+                  ((CFunctionCallAssignmentStatement) functionCall).getLeftHandSide();
+              EdgeDefUseData defUseData = EdgeDefUseData.extract(lhs);
+              if (defUseData.getUses().contains(cause)
+                  || !defUseData.getPointeeUses().isEmpty()) {
+                dependences.addFlowDependence(defEdge, defEdgeCause, useEdge, useEdgeCause);
               }
+            }
 
-              if (foreignDefUseData
-                  .getForeignUses(summaryEdge.getFunctionEntry().getFunction())
-                  .contains(cause)) {
-                addFlowDependence(defEdge, defEdgeCause, useEdge, useEdgeCause);
-                flowDepCounter.inc();
-              }
+            if (foreignDefUseData
+                .getForeignUses(summaryEdge.getFunctionEntry().getFunction())
+                .contains(cause)) {
+              dependences.addFlowDependence(defEdge, defEdgeCause, useEdge, useEdgeCause);
+              dependences.count++;
+            }
 
-              for (int index = 0; index < params.size(); index++) {
+            for (int index = 0; index < params.size(); index++) {
 
-                EdgeDefUseData defUseData = EdgeDefUseData.extract(expressions.get(index));
-                Optional<MemoryLocation> paramUseCause =
-                    Optional.of(MemoryLocation.valueOf(params.get(index).getQualifiedName()));
+              EdgeDefUseData defUseData = EdgeDefUseData.extract(expressions.get(index));
+              Optional<MemoryLocation> paramUseCause =
+                  Optional.of(MemoryLocation.valueOf(params.get(index).getQualifiedName()));
 
-                if (defUseData.getUses().contains(cause)
-                    || !defUseData.getPointeeUses().isEmpty()) {
-                  addFlowDependence(defEdge, defEdgeCause, useEdge, paramUseCause);
-                  flowDepCounter.inc();
-                }
+              if (defUseData.getUses().contains(cause)
+                  || !defUseData.getPointeeUses().isEmpty()) {
+                dependences.addFlowDependence(defEdge, defEdgeCause, useEdge, paramUseCause);
+                dependences.count++;
               }
-            } else {
-              addFlowDependence(defEdge, defEdgeCause, useEdge, useEdgeCause);
-              flowDepCounter.inc();
             }
-          };
-
-      boolean isMain = entryNode.equals(cfa.getMainFunction());
-
-      new FlowDepAnalysis(
-              domTree,
-              Dominance.createDomFrontiers(domTree),
-              entryNode,
-              isMain ? ImmutableList.of() : globalEdges,
-              pointerState,
-              foreignDefUseData,
-              declarationEdges,
-              dependenceConsumer)
-          .run();
-
-      flowDependenceNumber.setNextValue((int) flowDepCounter.getValue());
-    }
+          } else {
+            dependences.addFlowDependence(defEdge, defEdgeCause, useEdge, useEdgeCause);
+            dependences.count++;
+          }
+        };
+
+    boolean isMain = entryNode.equals(cfa.getMainFunction());
+
+    new FlowDepAnalysis(
+            domTree,
+            Dominance.createDomFrontiers(domTree),
+            entryNode,
+            isMain ? ImmutableList.of() : globalEdges,
+            pointerState,
+            foreignDefUseData,
+            declarationEdges,
+            dependenceConsumer)
+        .run();
+
+    return dependences;
   }
 
-  private void addControlDependences() {
+  private void addControlDependences() throws InterruptedException, CPAException {
 
-    for (FunctionEntryNode entryNode : cfa.getAllFunctionHeads()) {
+    for (ImmutableSet<ControlDependency> controlDependencies :
+        computeForAllFunctions(
+            entryNode ->
+                ControlDependenceBuilder.computeControlDependencies(
+                    entryNode, controlDepsTakeBothAssumptions))) {
 
       int controlDepCounter = 0;
-      ImmutableSet<ControlDependency> controlDependencies =
-          ControlDependenceBuilder.computeControlDependencies(
-              entryNode, controlDepsTakeBothAssumptions);
-
       for (ControlDependency controlDependency : controlDependencies) {
         addDependence(
             getDGNode(controlDependency.getControlEdge(), Optional.empty()),
@@ -465,6 +538,89 @@ public class DependenceGraphBuilder implements StatisticsProvider {
     }
   }
 
+  /**
+   * Apply the given computation to all functions of the CFA and return the results in the order
+   * of {@link CFA#getAllFunctionHeads()}. If more than one thread is configured, the functions are
+   * handled in parallel, so the computation must not modify shared state.
+   */
+  private <T> List<T> computeForAllFunctions(FunctionComputation<T> pComputation)
+      throws InterruptedException, CPAException {
+    Collection<FunctionEntryNode> functions = cfa.getAllFunctionHeads();
+    List<T> results = new ArrayList<>(functions.size());
+    if (threads == 1 || functions.size() <= 1) {
+      for (FunctionEntryNode entryNode : functions) {
+        shutdownNotifier.shutdownIfNecessary();
+        results.add(pComputation.compute(entryNode));
+      }
+      return results;
+    }
+
+    ExecutorService executor =
+        Executors.newFixedThreadPool(
+            Math.min(threads, functions.size()),
+            new ThreadFactoryBuilder()
+                .setDaemon(true)
+                .setNameFormat("dependence-graph-%d")
+                .build());
+    try {
+      List<Future<T>> futures = new ArrayList<>(functions.size());
+      for (FunctionEntryNode entryNode : functions) {
+        futures.add(executor.submit(() -> pComputation.compute(entryNode)));
+      }
+      for (Future<T> future : futures) {
+        shutdownNotifier.shutdownIfNecessary();
+        try {
+          results.add(future.get());
+        } catch (ExecutionException e) {
+          Throwable cause = e.getCause();
+          Throwables.throwIfInstanceOf(cause, CPAException.class);
+          Throwables.throwIfInstanceOf(cause, InterruptedException.class);
+          Throwables.throwIfUnchecked(cause);
+          throw new AssertionError("Unexpected exception during dependence computation", cause);
+        }
+      }
+      return results;
+    } finally {
+      executor.shutdownNow();
+    }
+  }
+
+  @FunctionalInterface
+  private interface FunctionComputation<T> {
+    T compute(FunctionEntryNode pEntryNode) throws InterruptedException, CPAException;
+  }
+
+  /**
+   * Dependences of a single function that were computed without modifying the builder and are
+   * added to the dependence graph afterwards.
+   */
+  private static final class FunctionDependences {
+
+    private final List<CFAEdge> defEdges = new ArrayList<>();
+    private final List<Optional<MemoryLocation>> defEdgeCauses = new ArrayList<>();
+    private final List<CFAEdge> useEdges = new ArrayList<>();
+    private final List<Optional<MemoryLocation>> useEdgeCauses = new ArrayList<>();
+    private int count = 0;
+
+    private void addFlowDependence(
+        CFAEdge pDefEdge,
+        Optional<MemoryLocation> pDefEdgeCause,
+        CFAEdge pUseEdge,
+        Optional<MemoryLocation> pUseEdgeCause) {
+      defEdges.add(pDefEdge);
+      defEdgeCauses.add(pDefEdgeCause);
+      useEdges.add(pUseEdge);
+      useEdgeCauses.add(pUseEdgeCause);
+    }
+
+    private void addTo(DependenceGraphBuilder pBuilder) {
+      for (int i = 0; i < defEdges.size(); i++) {
+        pBuilder.addFlowDependence(
+            defEdges.get(i), defEdgeCauses.get(i), useEdges.get(i), useEdgeCauses.get(i));
+      }
+    }
+  }
+
   @SuppressWarnings("unused") // old method for computing flow dependences
   private void addFlowDependences()
       throws InvalidConfigurationException, InterruptedException, CPAException {
@@ -37,6 +37,7 @@ import org.sosy_lab.cpachecker.core.interfaces.StateSpacePartition;
 import org.sosy_lab.cpachecker.core.reachedset.AggregatedReachedSets;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
 import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
+import org.sosy_lab.cpachecker.cpa.pointer2.AndersenPointerAnalysis;
 import org.sosy_lab.cpachecker.cpa.pointer2.PointerDomain;
 import org.sosy_lab.cpachecker.cpa.pointer2.PointerState;
 import org.sosy_lab.cpachecker.cpa.pointer2.PointerTransferRelation;
@@ -65,6 +66,19 @@ abstract class GlobalPointerState {
     return FlowSensitivePointerState.create(pCfa, pLogger, pShutdownNotifier);
   }
 
+  /**
+   * Create a flow-insensitive pointer state with the constraint-based {@link
+   * AndersenPointerAnalysis} instead of an analysis run.
+   */
+  public static GlobalPointerState createAndersen(
+      CFA pCfa, boolean pFieldSensitive, ShutdownNotifier pShutdownNotifier)
+      throws CPAException, InterruptedException {
+
+    return new FlowInsensitivePointerState(
+        AndersenPointerAnalysis.computePointsToInformation(
+            pCfa, pFieldSensitive, pShutdownNotifier));
+  }
+
   private static final class FlowInsensitivePointerState extends GlobalPointerState {
 
     private static final Precision PRECISION = new Precision() {};
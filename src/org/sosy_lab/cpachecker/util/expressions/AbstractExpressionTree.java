@@ -9,13 +9,27 @@
 package org.sosy_lab.cpachecker.util.expressions;
 
 import com.google.common.base.Function;
+import com.google.errorprone.annotations.concurrent.LazyInit;
 import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
 import org.sosy_lab.cpachecker.core.counterexample.CExpressionToOrinalCodeVisitor;
 
 abstract class AbstractExpressionTree<LeafType> implements ExpressionTree<LeafType> {
 
+  /**
+   * Expression trees are immutable, but the same (large) invariants are converted to code several
+   * times during witness export, so the code is computed only once.
+   */
+  @LazyInit private String code = null;
+
   @Override
   public String toString() {
+    if (code == null) {
+      code = toCode();
+    }
+    return code;
+  }
+
+  private String toCode() {
     return accept(
         new ToCodeVisitor<>(
             new Function<LeafType, String>() {
@@ -10,13 +10,32 @@ package org.sosy_lab.cpachecker.util.floatingpoint;
 
 import static com.google.common.primitives.Ints.max;
 
+import java.math.BigDecimal;
+import java.util.function.DoubleBinaryOperator;
+import java.util.function.DoubleUnaryOperator;
+
+/**
+ * This class implements {@link CFloat} by computing with the floating-point types of the host.
+ *
+ * <p>The types float and double are computed in Java, whose arithmetic follows IEEE 754 with
+ * rounding to nearest just like C on the supported platforms, including the bit patterns of the
+ * NaN values that the hardware produces. Only long double, which has no Java counterpart, and
+ * the operations whose C library implementation may differ from Java (pow and conversions from
+ * and to integer types) are computed natively by {@link CFloatNativeAPI}. This avoids a JNI call
+ * per operation for the common types.
+ */
 @Deprecated
 public class CFloatNative extends CFloat {
   private final CFloatWrapper wrapper;
   private final int type;
 
+  private static final long SINGLE_SIGN_BIT = 1L << 8;
+  private static final long DOUBLE_SIGN_BIT = 1L << 11;
+  private static final long SINGLE_MANTISSA_MASK = (1L << 23) - 1;
+  private static final long DOUBLE_MANTISSA_MASK = (1L << 52) - 1;
+
   public CFloatNative(String rep, int type) {
-    this.wrapper = CFloatNativeAPI.createFp(rep, type);
+    this.wrapper = createWrapper(rep, type);
     this.type = type;
   }
 
@@ -27,6 +46,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat add(CFloat summand) {
+    if (isHostType(type, summand.getType())) {
+      return computeOnHost(summand, (a, b) -> a + b);
+    }
     CFloatWrapper newFloat =
         CFloatNativeAPI.addFp(wrapper, type, summand.copyWrapper(), summand.getType());
     return new CFloatNative(newFloat, max(type, summand.getType()));
@@ -47,6 +69,9 @@ public class CFloatNative extends CFloat {
     int[] types = new int[summands.length + 1];
 
     maxType = constructParametersForMultiOperation(index, maxType, wrappers, types, summands);
+    if (isHostType(maxType)) {
+      return computeOnHost(maxType, types, wrappers, (a, b) -> a + b);
+    }
 
     CFloatWrapper newFloat = CFloatNativeAPI.addManyFp(wrapper, types, wrappers);
     return new CFloatNative(newFloat, maxType);
@@ -54,6 +79,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat multiply(CFloat factor) {
+    if (isHostType(type, factor.getType())) {
+      return computeOnHost(factor, (a, b) -> a * b);
+    }
     CFloatWrapper newFloat =
         CFloatNativeAPI.multiplyFp(wrapper, type, factor.copyWrapper(), factor.getType());
     return new CFloatNative(newFloat, max(type, factor.getType()));
@@ -74,6 +102,9 @@ public class CFloatNative extends CFloat {
     int[] types = new int[factors.length + 1];
 
     maxType = constructParametersForMultiOperation(index, maxType, wrappers, types, factors);
+    if (isHostType(maxType)) {
+      return computeOnHost(maxType, types, wrappers, (a, b) -> a * b);
+    }
 
     CFloatWrapper newFloat = CFloatNativeAPI.multiplyManyFp(wrapper, types, wrappers);
     return new CFloatNative(newFloat, maxType);
@@ -81,6 +112,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat subtract(CFloat subtrahend) {
+    if (isHostType(type, subtrahend.getType())) {
+      return computeOnHost(subtrahend, (a, b) -> a - b);
+    }
     CFloatWrapper newFloat =
         CFloatNativeAPI.subtractFp(wrapper, type, subtrahend.copyWrapper(), subtrahend.getType());
 
@@ -89,6 +123,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloatNative divideBy(CFloat divisor) {
+    if (isHostType(type, divisor.getType())) {
+      return computeOnHost(divisor, (a, b) -> a / b);
+    }
     CFloatWrapper newFloat =
         CFloatNativeAPI.divideFp(wrapper, type, divisor.copyWrapper(), divisor.getType());
 
@@ -112,6 +149,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat sqrt() {
+    if (isHostType(type)) {
+      return computeOnHost(Math::sqrt);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.sqrtFp(wrapper, type);
 
     return new CFloatNative(newFloat, type);
@@ -119,6 +159,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat round() {
+    if (isHostType(type)) {
+      return computeOnHost(CFloatNative::roundHalfAwayFromZero);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.roundFp(wrapper, type);
 
     return new CFloatNative(newFloat, type);
@@ -126,6 +169,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat trunc() {
+    if (isHostType(type)) {
+      return computeOnHost(CFloatNative::truncate);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.truncFp(wrapper, type);
 
     return new CFloatNative(newFloat, type);
@@ -133,6 +179,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat ceil() {
+    if (isHostType(type)) {
+      return computeOnHost(Math::ceil);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.ceilFp(wrapper, type);
 
     return new CFloatNative(newFloat, type);
@@ -140,6 +189,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat floor() {
+    if (isHostType(type)) {
+      return computeOnHost(Math::floor);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.floorFp(wrapper, type);
 
     return new CFloatNative(newFloat, type);
@@ -147,6 +199,11 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat abs() {
+    if (isHostType(type)) {
+      return new CFloatNative(
+          new CFloatWrapper(wrapper.getExponent() & ~getSignBit(type), wrapper.getMantissa()),
+          type);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.absFp(wrapper, type);
 
     return new CFloatNative(newFloat, type);
@@ -154,26 +211,41 @@ public class CFloatNative extends CFloat {
 
   @Override
   public boolean isZero() {
+    if (isHostType(type)) {
+      return toHostValue(wrapper, type) == 0;
+    }
     return CFloatNativeAPI.isZeroFp(wrapper, type);
   }
 
   @Override
   public boolean isOne() {
+    if (isHostType(type)) {
+      return toHostValue(wrapper, type) == 1;
+    }
     return CFloatNativeAPI.isOneFp(wrapper, type);
   }
 
   @Override
   public boolean isNan() {
+    if (isHostType(type)) {
+      return Double.isNaN(toHostValue(wrapper, type));
+    }
     return CFloatNativeAPI.isNanFp(wrapper, type);
   }
 
   @Override
   public boolean isInfinity() {
+    if (isHostType(type)) {
+      return Double.isInfinite(toHostValue(wrapper, type));
+    }
     return CFloatNativeAPI.isInfinityFp(wrapper, type);
   }
 
   @Override
   public boolean isNegative() {
+    if (isHostType(type)) {
+      return (wrapper.getExponent() & getSignBit(type)) != 0;
+    }
     return CFloatNativeAPI.isNegativeFp(wrapper, type);
   }
 
@@ -187,6 +259,12 @@ public class CFloatNative extends CFloat {
               + source.getType()
               + " of second argument must not be different.");
     }
+    if (isHostType(type)) {
+      long signBit = getSignBit(type);
+      long exponent =
+          (wrapper.getExponent() & ~signBit) | (source.copyWrapper().getExponent() & signBit);
+      return new CFloatNative(new CFloatWrapper(exponent, wrapper.getMantissa()), type);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.copySignFp(wrapper, source.copyWrapper(), type);
 
     return new CFloatNative(newFloat, type);
@@ -194,6 +272,9 @@ public class CFloatNative extends CFloat {
 
   @Override
   public CFloat castTo(int toType) {
+    if (isHostType(type, toType)) {
+      return fromHostValue(toHostValue(wrapper, type), toType);
+    }
     CFloatWrapper newFloat = CFloatNativeAPI.castFpFromTo(wrapper, type, toType);
 
     return new CFloatNative(newFloat, toType);
@@ -227,7 +308,122 @@ public class CFloatNative extends CFloat {
 
   @Override
   public String toString() {
-    return CFloatNativeAPI.printFp(wrapper, type).replaceAll("(\\.[0-9]+?)0*$", "$1");
+    String representation =
+        isHostType(type) ? printHostValue(wrapper, type) : CFloatNativeAPI.printFp(wrapper, type);
+    return representation.replaceAll("(\\.[0-9]+?)0*$", "$1");
+  }
+
+  private static CFloatWrapper createWrapper(String pRep, int pType) {
+    if (isHostType(pType)) {
+      try {
+        // parse float directly, rounding the parsed double again could give a different result
+        double value =
+            pType == CFloatNativeAPI.FP_TYPE_SINGLE
+                ? Float.parseFloat(pRep)
+                : Double.parseDouble(pRep);
+        return fromHostValue(value, pType).wrapper;
+      } catch (NumberFormatException e) {
+        // the C library accepts some more formats, e.g., hexadecimal numbers without exponent
+      }
+    }
+    return CFloatNativeAPI.createFp(pRep, pType);
+  }
+
+  private static boolean isHostType(int pType) {
+    return pType == CFloatNativeAPI.FP_TYPE_SINGLE || pType == CFloatNativeAPI.FP_TYPE_DOUBLE;
+  }
+
+  private static boolean isHostType(int pType1, int pType2) {
+    return isHostType(pType1) && isHostType(pType2);
+  }
+
+  private static long getSignBit(int pType) {
+    return pType == CFloatNativeAPI.FP_TYPE_SINGLE ? SINGLE_SIGN_BIT : DOUBLE_SIGN_BIT;
+  }
+
+  /**
+   * Returns the value of the given float or double. A float is converted to double, which is
+   * exact, so all computations on the host can be done with double values.
+   */
+  private static double toHostValue(CFloatWrapper pWrapper, int pType) {
+    if (pType == CFloatNativeAPI.FP_TYPE_SINGLE) {
+      return Float.intBitsToFloat((int) ((pWrapper.getExponent() << 23) | pWrapper.getMantissa()));
+    }
+    return Double.longBitsToDouble((pWrapper.getExponent() << 52) | pWrapper.getMantissa());
+  }
+
+  /** Rounds the given value to the given type, if necessary, and wraps its bits. */
+  private static CFloatNative fromHostValue(double pValue, int pType) {
+    if (pType == CFloatNativeAPI.FP_TYPE_SINGLE) {
+      long bits = Float.floatToRawIntBits((float) pValue) & 0xFFFFFFFFL;
+      return new CFloatNative(
+          new CFloatWrapper(bits >>> 23, bits & SINGLE_MANTISSA_MASK), pType);
+    }
+    long bits = Double.doubleToRawLongBits(pValue);
+    return new CFloatNative(new CFloatWrapper(bits >>> 52, bits & DOUBLE_MANTISSA_MASK), pType);
+  }
+
+  /**
+   * Computes a binary operation in the larger of both types. For float operands, computing in
+   * double and rounding the result to float gives the correctly rounded float result for the basic
+   * arithmetic operations, because double has more than twice the precision of float.
+   */
+  private CFloatNative computeOnHost(CFloat pOther, DoubleBinaryOperator pOperation) {
+    return fromHostValue(
+        pOperation.applyAsDouble(
+            toHostValue(wrapper, type), toHostValue(pOther.getWrapper(), pOther.getType())),
+        max(type, pOther.getType()));
+  }
+
+  /** Computes an operation over many operands from left to right, rounding after each step. */
+  private CFloatNative computeOnHost(
+      int pMaxType, int[] pTypes, CFloatWrapper[] pOperands, DoubleBinaryOperator pOperation) {
+    CFloatNative result = fromHostValue(toHostValue(wrapper, type), pMaxType);
+    for (int i = 0; i < pOperands.length; i++) {
+      result =
+          fromHostValue(
+              pOperation.applyAsDouble(
+                  toHostValue(result.wrapper, pMaxType), toHostValue(pOperands[i], pTypes[i + 1])),
+              pMaxType);
+    }
+    return result;
+  }
+
+  private CFloatNative computeOnHost(DoubleUnaryOperator pOperation) {
+    return fromHostValue(pOperation.applyAsDouble(toHostValue(wrapper, type)), type);
+  }
+
+  /** Rounds like C's round(), i.e., halfway cases away from zero. */
+  private static double roundHalfAwayFromZero(double pValue) {
+    if (Double.isNaN(pValue) || Double.isInfinite(pValue)) {
+      return pValue;
+    }
+    double magnitude = Math.abs(pValue);
+    double rounded = Math.floor(magnitude);
+    if (magnitude - rounded >= 0.5) {
+      rounded += 1;
+    }
+    return Math.copySign(rounded, pValue);
+  }
+
+  private static double truncate(double pValue) {
+    return pValue < 0 ? Math.ceil(pValue) : Math.floor(pValue);
+  }
+
+  /** Prints the exact value like printf("%f") does with enough digits after the decimal point. */
+  private static String printHostValue(CFloatWrapper pWrapper, int pType) {
+    double value = toHostValue(pWrapper, pType);
+    boolean negative = (pWrapper.getExponent() & getSignBit(pType)) != 0;
+    if (Double.isNaN(value)) {
+      return negative ? "-nan" : "nan";
+    } else if (Double.isInfinite(value)) {
+      return negative ? "-inf" : "inf";
+    }
+    String digits = new BigDecimal(value).toPlainString();
+    if (negative && value == 0) {
+      digits = "-0";
+    }
+    return digits.contains(".") ? digits : digits + ".0";
   }
 
   @Override
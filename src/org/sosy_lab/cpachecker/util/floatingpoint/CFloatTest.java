@@ -640,6 +640,27 @@ public class CFloatTest {
         .isEqualTo(b.copyWrapper().getMantissa() & b.getNormalizedMantissaMask());
   }
 
+  @Test
+  public void hostRoundingTest() {
+    CFloat half = new CFloatNative("2.5", CFloatNativeAPI.FP_TYPE_DOUBLE);
+    CFloat nHalf = new CFloatNative("-2.5", CFloatNativeAPI.FP_TYPE_DOUBLE);
+    CFloat belowHalf = new CFloatNative("0.49999999999999994", CFloatNativeAPI.FP_TYPE_DOUBLE);
+    CFloat nSmall = new CFloatNative("-0.5", CFloatNativeAPI.FP_TYPE_SINGLE);
+
+    assertThat(half.round().toString()).isEqualTo("3.0");
+    assertThat(nHalf.round().toString()).isEqualTo("-3.0");
+    assertThat(belowHalf.round().toString()).isEqualTo("0.0");
+    assertThat(nSmall.trunc().toString()).isEqualTo("-0.0");
+    assertThat(nSmall.abs().toString()).isEqualTo("0.5");
+
+    CFloat a = new CFloatNative("0.1f", CFloatNativeAPI.FP_TYPE_SINGLE);
+    CFloat b = new CFloatNative("0.2f", CFloatNativeAPI.FP_TYPE_SINGLE);
+    assertThat(a.add(b).toString()).isEqualTo("0.300000011920928955078125");
+    assertThat(a.add(b, b).getType()).isEqualTo(CFloatNativeAPI.FP_TYPE_SINGLE);
+    assertThat(a.castTo(CFloatNativeAPI.FP_TYPE_DOUBLE).toString())
+        .isEqualTo("0.100000001490116119384765625");
+  }
+
   @Test
   public void divisionTest_2() {
     CFloat a = new CFloatImpl("625", CFloatNativeAPI.FP_TYPE_DOUBLE);
@@ -10,6 +10,7 @@ package org.sosy_lab.cpachecker.util.globalinfo;
 
 import com.google.common.base.Preconditions;
 import java.util.Optional;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.log.LogManager;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
@@ -25,6 +26,15 @@ import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
 
 public class GlobalInfo {
   private static GlobalInfo instance;
+
+  /**
+   * Instance for the analysis that runs in the current thread (and the threads it starts), if
+   * this analysis has its own one, e.g., inside a {@link
+   * org.sosy_lab.cpachecker.core.algorithm.ParallelAlgorithm}.
+   */
+  private static final InheritableThreadLocal<GlobalInfo> analysisInstance =
+      new InheritableThreadLocal<>();
+
   private CFAInfo cfaInfo;
   private AutomatonInfo automatonInfo = new AutomatonInfo();
   private ConfigurableProgramAnalysis cpa;
@@ -39,13 +49,44 @@ public class GlobalInfo {
 
   }
 
-  public static synchronized GlobalInfo getInstance() {
+  public static GlobalInfo getInstance() {
+    GlobalInfo localInstance = analysisInstance.get();
+    return localInstance != null ? localInstance : getGlobalInstance();
+  }
+
+  private static synchronized GlobalInfo getGlobalInstance() {
     if (instance == null) {
       instance = new GlobalInfo();
     }
     return instance;
   }
 
+  /**
+   * Create a new instance for a separate analysis. It shares the program and the log manager with
+   * this instance, but the information from the CPA is kept separately, such that analyses in
+   * different threads do not overwrite each other's information.
+   *
+   * @see #setInstanceForCurrentThread(GlobalInfo)
+   */
+  public synchronized GlobalInfo createInstanceForAnalysis() {
+    GlobalInfo result = new GlobalInfo();
+    result.cfaInfo = cfaInfo;
+    result.logger = logger;
+    return result;
+  }
+
+  /**
+   * Use the given instance for the current thread and all threads started by it (or the global
+   * instance again, if the argument is null).
+   */
+  public static void setInstanceForCurrentThread(@Nullable GlobalInfo pInstance) {
+    if (pInstance == null) {
+      analysisInstance.remove();
+    } else {
+      analysisInstance.set(pInstance);
+    }
+  }
+
   public synchronized void storeCFA(CFA cfa) {
     cfaInfo = new CFAInfo(cfa);
   }
@@ -15,6 +15,7 @@ import com.google.common.collect.ImmutableList;
 import com.google.common.collect.Iterables;
 import com.google.common.io.CharStreams;
 import java.io.BufferedReader;
+import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
 import java.io.InputStreamReader;
@@ -22,6 +23,8 @@ import java.nio.charset.Charset;
 import java.nio.file.Path;
 import java.util.ArrayList;
 import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
 import jhoafparser.consumer.HOAConsumerStore;
 import jhoafparser.parser.HOAFParser;
 import jhoafparser.parser.generated.ParseException;
@@ -41,7 +44,16 @@ public class Ltl2BuechiConverter {
 
   private static final Converter EXECUTABLE = Converter.LTL3BA;
 
+  /**
+   * Output of the external tool for each formula that was already converted. The formula that is
+   * passed to the tool uses aliases for its atomic propositions, so formulas that differ only in
+   * their propositions share an entry. The output is cached instead of the parsed automaton,
+   * because the automaton is modified afterwards.
+   */
+  private static final Map<String, String> toolOutputCache = new ConcurrentHashMap<>();
+
   private final LabelledFormula labelledFormula;
+  private final String formula;
   private final ProcessBuilder builder;
 
   /**
@@ -108,8 +120,7 @@ public class Ltl2BuechiConverter {
     Path nativeLibraryPath = NativeLibraries.getNativeLibraryPath();
     builder.directory(nativeLibraryPath.toFile());
 
-    String formula =
-        LtlStringVisitor.toString(labelledFormula.getFormula(), labelledFormula.getAPs());
+    formula = LtlStringVisitor.toString(labelledFormula.getFormula(), labelledFormula.getAPs());
     ImmutableList<String> commands =
         ImmutableList.<String>builder()
             .add(EXECUTABLE.execTool())
@@ -128,7 +139,14 @@ public class Ltl2BuechiConverter {
    */
   private StoredAutomaton createHoaAutomaton() throws InterruptedException, LtlParseException {
 
-    try (InputStream is = runLtlExec()) {
+    String toolOutput = toolOutputCache.get(formula);
+    if (toolOutput == null) {
+      toolOutput = runLtlExec();
+      toolOutputCache.put(formula, toolOutput);
+    }
+
+    try (InputStream is =
+        new ByteArrayInputStream(toolOutput.getBytes(Charset.defaultCharset()))) {
 
       HOAConsumerStore consumer = new HOAConsumerStore();
       HOAFParser.parseHOA(is, consumer);
@@ -165,37 +183,36 @@ public class Ltl2BuechiConverter {
 
   /**
    * Execute the external tool to transform a ltl property to a buechi-automaton. The output is
-   * provided as input stream, which is required by the hoaf-library for parsing the resulting
-   * output afterwards.
+   * read completely before waiting for the tool to terminate, such that a large automaton cannot
+   * block the tool on a full pipe.
    *
-   * @return The input stream with the automaton description
+   * @return The automaton description
    */
-  private InputStream runLtlExec() throws LtlParseException, InterruptedException {
+  private String runLtlExec() throws LtlParseException, InterruptedException {
     try {
       Process process = builder.start();
-      InputStream is = process.getInputStream();
+      String output = readLinesFromStream(process.getInputStream());
 
       int exitvalue = process.waitFor();
 
       if (exitvalue != 0) {
-        String errMsg = readLinesFromStream(is);
         throw new LtlParseException(
             String.format(
                 "Tool '%s' exited with error code %d. Message from tool:%n%s",
                 EXECUTABLE.getToolName(),
                 exitvalue,
-                errMsg));
+                output));
       }
 
-      return is;
+      return output;
     } catch (IOException e) {
       throw new LtlParseException(e.getMessage(), e);
     }
   }
 
   /**
-   * Convert an {@link InputStream} to a human-readable string. This is used to forward error
-   * messages from the external tool to the logger.
+   * Convert an {@link InputStream} to a human-readable string. This is used to read the output
+   * of the external tool, including error messages that are forwarded to the logger.
    *
    * @return A readable string taken and transformed from the {@link InputStream}
    * @throws IOException In case an I/O error occurs
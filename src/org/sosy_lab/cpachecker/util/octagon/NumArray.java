@@ -8,18 +8,33 @@
 
 package org.sosy_lab.cpachecker.util.octagon;
 
+import org.checkerframework.checker.nullness.qual.Nullable;
+
 public class NumArray {
 
   private final long array;
 
+  /** the values if this array is not stored in the native library, infinity as positive infinity */
+  private final double @Nullable [] values;
+
   NumArray(long l) {
     array = l;
+    values = null;
+  }
+
+  NumArray(double[] pValues) {
+    array = 0;
+    values = pValues;
   }
 
   long getArray() {
     return array;
   }
 
+  double @Nullable [] getValues() {
+    return values;
+  }
+
   @Override
   public String toString() {
     // TODO
@@ -32,11 +47,11 @@ public class NumArray {
       return false;
     }
     NumArray otherArr = (NumArray) pObj;
-    return this.array == otherArr.array;
+    return this.array == otherArr.array && this.values == otherArr.values;
   }
 
   @Override
   public int hashCode() {
-    return (int)array;
+    return values == null ? (int)array : System.identityHashCode(values);
   }
 }
\ No newline at end of file
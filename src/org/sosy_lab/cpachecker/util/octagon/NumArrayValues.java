@@ -0,0 +1,82 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.octagon;
+
+import static com.google.common.base.Preconditions.checkElementIndex;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * Values for a {@link NumArray} that are collected on the Java side in a direct buffer, such that
+ * the whole array can be created with a single native call by {@link
+ * OctagonManager#init_num_t(NumArrayValues)} instead of one native call per entry.
+ *
+ * <p>Each entry occupies two 64-bit words in native byte order: the kind of the entry ({@link
+ * #KIND_INT}, {@link #KIND_FLOAT}, or {@link #KIND_INFINITY}) and its value. Entries that are not
+ * set explicitly are zero.
+ */
+public final class NumArrayValues {
+
+  static final long KIND_INT = 0;
+  static final long KIND_FLOAT = 1;
+  static final long KIND_INFINITY = 2;
+
+  private static final int ENTRY_SIZE = 2 * Long.BYTES;
+
+  private final int size;
+  private final ByteBuffer buffer;
+
+  public NumArrayValues(int pSize) {
+    size = pSize;
+    buffer = ByteBuffer.allocateDirect(pSize * ENTRY_SIZE).order(ByteOrder.nativeOrder());
+  }
+
+  public int size() {
+    return size;
+  }
+
+  /** Sets the entry at the given position to an integer, truncated as by num_set_int. */
+  public NumArrayValues setInt(int pPos, long pValue) {
+    checkElementIndex(pPos, size);
+    buffer.putLong(pPos * ENTRY_SIZE, KIND_INT);
+    buffer.putLong(pPos * ENTRY_SIZE + Long.BYTES, (int) pValue);
+    return this;
+  }
+
+  public NumArrayValues setFloat(int pPos, double pValue) {
+    checkElementIndex(pPos, size);
+    buffer.putLong(pPos * ENTRY_SIZE, KIND_FLOAT);
+    buffer.putDouble(pPos * ENTRY_SIZE + Long.BYTES, pValue);
+    return this;
+  }
+
+  public NumArrayValues setInfinite(int pPos) {
+    checkElementIndex(pPos, size);
+    buffer.putLong(pPos * ENTRY_SIZE, KIND_INFINITY);
+    buffer.putLong(pPos * ENTRY_SIZE + Long.BYTES, 0);
+    return this;
+  }
+
+  long getKind(int pPos) {
+    return buffer.getLong(pPos * ENTRY_SIZE);
+  }
+
+  int getInt(int pPos) {
+    return (int) buffer.getLong(pPos * ENTRY_SIZE + Long.BYTES);
+  }
+
+  double getFloat(int pPos) {
+    return buffer.getDouble(pPos * ENTRY_SIZE + Long.BYTES);
+  }
+
+  ByteBuffer getBuffer() {
+    return buffer;
+  }
+}
@@ -8,6 +8,8 @@
 
 package org.sosy_lab.cpachecker.util.octagon;
 
+import java.nio.ByteBuffer;
+
 @SuppressWarnings("AlmostJavadoc")
 class OctWrapper {
 
@@ -20,6 +22,8 @@ class OctWrapper {
 
   /* allocate new space for num array and init*/
   static native long J_init_n (int n); // first allocates space with new_n for num_t* and calls void num_init_n (num_t* a, size_t n), returns the pointer to allocated space
+  /* allocate new space for num array and set all values from a direct buffer, see NumArrayValues */
+  static native long J_init_n_values(int n, ByteBuffer values); // like J_init_n, afterwards calls num_set_int, num_set_float, or num_set_infty for each entry
   /* num copy */
   static native void J_num_set(long n1, long n2); // void num_set (num_t* a, const num_t* b)
   /* set int */
@@ -10,31 +10,106 @@ package org.sosy_lab.cpachecker.util.octagon;
 
 import java.lang.ref.Reference;
 import java.lang.ref.ReferenceQueue;
-import java.util.ArrayList;
-import java.util.List;
+import java.util.HashSet;
+import java.util.Set;
+import java.util.concurrent.atomic.AtomicLong;
+import org.checkerframework.checker.nullness.qual.Nullable;
 
 
 public class Octagon {
 
   private final long octId;
   private final OctagonManager manager;
-  private static List<OctagonPhantomReference> phantomReferences = new ArrayList<>();
+  private final @Nullable OctagonPhantomReference phantomReference;
+
+  /** the matrix of octagons that are not stored in the native library */
+  private final @Nullable OctagonMatrix matrix;
+
+  private static final AtomicLong nextMatrixId = new AtomicLong();
+  private static Set<OctagonPhantomReference> phantomReferences = new HashSet<>();
   private static ReferenceQueue<Octagon> referenceQueue = new ReferenceQueue<>();
 
+  /** number of octagons whose native memory is not yet freed, and the maximum of it */
+  private static final AtomicLong liveNativeOctagons = new AtomicLong();
+  private static final AtomicLong peakNativeOctagons = new AtomicLong();
+
+  /** see {@link #setNativeOctagonLimit(long)}, 0 means no limit */
+  private static long nativeOctagonLimit = 0;
+  private static long nextCollectionAt = 0;
+
   Octagon(long l, OctagonManager manager) {
     octId = l;
     this.manager = manager;
-    registerPhantomReference(this);
+    matrix = null;
+    phantomReference = new OctagonPhantomReference(this, referenceQueue);
+    phantomReferences.add(phantomReference);
+    peakNativeOctagons.accumulateAndGet(liveNativeOctagons.incrementAndGet(), Math::max);
+    manager.registerOctagon(this);
   }
 
-  private static void registerPhantomReference(Octagon oct) {
-    phantomReferences.add(new OctagonPhantomReference(oct, referenceQueue));
+  /** Octagons of the Java octagon library are normal heap objects without native memory. */
+  Octagon(OctagonMatrix pMatrix, OctagonManager manager) {
+    octId = nextMatrixId.incrementAndGet();
+    this.manager = manager;
+    matrix = pMatrix;
+    phantomReference = null;
   }
 
   public static void removePhantomReferences() {
+    pollPhantomReferences();
+
+    if (nativeOctagonLimit > 0 && liveNativeOctagons.get() > nextCollectionAt) {
+      // The Java heap does not see the native memory of octagons, so the garbage collector may
+      // not run (and enqueue the references of unreachable octagons) before the native heap is
+      // exhausted. Request a collection explicitly when too many native octagons are alive.
+      System.gc();
+      pollPhantomReferences();
+      // if most octagons are still reachable, do not collect again for every new octagon
+      nextCollectionAt = Math.max(nativeOctagonLimit, 2 * liveNativeOctagons.get());
+    }
+  }
+
+  private static void pollPhantomReferences() {
     Reference<? extends Octagon> reference;
     while ((reference = referenceQueue.poll()) != null) {
+      phantomReferences.remove(reference);
       ((OctagonPhantomReference)reference).cleanup();
+      liveNativeOctagons.decrementAndGet();
+    }
+  }
+
+  /**
+   * Sets the number of octagons with native memory that may be alive before a garbage collection
+   * is requested in order to free the native memory of unreachable octagons. A value of 0 disables
+   * this, i.e., native memory is only freed by garbage collections of the Java heap.
+   */
+  public static void setNativeOctagonLimit(long pLimit) {
+    nativeOctagonLimit = pLimit;
+    nextCollectionAt = pLimit;
+  }
+
+  /** Returns the number of octagons whose native memory is currently not freed. */
+  public static long getLiveNativeOctagons() {
+    return liveNativeOctagons.get();
+  }
+
+  /** Returns the maximal number of octagons whose native memory was not freed at the same time. */
+  public static long getPeakNativeOctagons() {
+    return peakNativeOctagons.get();
+  }
+
+  /**
+   * Frees the native memory of this octagon immediately, such that it is not freed again by the
+   * garbage collector. This octagon must not be used afterwards.
+   */
+  void free() {
+    if (phantomReference == null) {
+      return;
+    }
+    if (phantomReferences.remove(phantomReference)) {
+      phantomReference.clear();
+      manager.free(octId);
+      liveNativeOctagons.decrementAndGet();
     }
   }
 
@@ -42,6 +117,11 @@ public class Octagon {
     return octId;
   }
 
+  OctagonMatrix getMatrix() {
+    assert matrix != null : "octagon is stored in the native library";
+    return matrix;
+  }
+
   public OctagonManager getManager() {
     return manager;
   }
@@ -0,0 +1,68 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.octagon;
+
+import static com.google.common.base.Preconditions.checkState;
+
+import com.google.common.collect.Sets;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
+
+/**
+ * Scope for the octagons that are created by an {@link OctagonManager} while the arena is open,
+ * e.g., during a single transfer. When the arena is closed, the native memory of all octagons that
+ * were created inside it and not marked with {@link #keep(Octagon)} is freed immediately, instead
+ * of waiting for the garbage collector to enqueue their {@link OctagonPhantomReference}s.
+ *
+ * <p>The caller has to make sure that octagons which are not kept are not used after closing the
+ * arena. Kept octagons are moved to the enclosing arena (if any), otherwise they are again only
+ * freed by the garbage collector.
+ */
+public final class OctagonArena implements AutoCloseable {
+
+  private final OctagonManager manager;
+  private final @Nullable OctagonArena parent;
+  private final List<Octagon> octagons = new ArrayList<>();
+  private final Set<Octagon> kept = Sets.newIdentityHashSet();
+  private boolean closed = false;
+
+  OctagonArena(OctagonManager pManager, @Nullable OctagonArena pParent) {
+    manager = pManager;
+    parent = pParent;
+  }
+
+  void register(Octagon pOctagon) {
+    checkState(!closed);
+    octagons.add(pOctagon);
+  }
+
+  /** Marks the given octagon as still needed after the arena is closed. */
+  public void keep(Octagon pOctagon) {
+    kept.add(pOctagon);
+  }
+
+  @Override
+  public void close() {
+    checkState(!closed, "arena already closed");
+    closed = true;
+    manager.closeArena(this, parent);
+    for (Octagon oct : octagons) {
+      if (kept.contains(oct)) {
+        if (parent != null) {
+          parent.register(oct);
+        }
+      } else {
+        oct.free();
+      }
+    }
+    octagons.clear();
+  }
+}
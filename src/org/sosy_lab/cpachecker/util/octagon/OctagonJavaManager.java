@@ -0,0 +1,359 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.octagon;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+
+import com.google.common.collect.BiMap;
+import com.google.common.collect.HashBiMap;
+import java.util.Arrays;
+import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonDoubleValue;
+import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonIntValue;
+import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
+import org.sosy_lab.cpachecker.util.states.MemoryLocation;
+
+/**
+ * Octagon manager that does not use the native octagon library but the pure-Java {@link
+ * OctagonMatrix}. This avoids the overhead of the native calls, and as octagons are immutable
+ * heap objects without global state, they can also be used from several threads.
+ *
+ * <p>Only the operations that are used by the octagon analysis are supported, i.e., no
+ * substitutions and no general linear constraints.
+ */
+public class OctagonJavaManager extends OctagonManager {
+
+  private final boolean integers;
+
+  /**
+   * Create a manager for octagons over integers (with tight closure) or over floating-point
+   * numbers.
+   */
+  public OctagonJavaManager(boolean pIntegers) {
+    integers = pIntegers;
+  }
+
+  private Octagon wrap(OctagonMatrix matrix) {
+    return new Octagon(matrix, this);
+  }
+
+  private static double[] values(NumArray n) {
+    return checkNotNull(n.getValues(), "num array does not belong to the Java octagon library");
+  }
+
+  /* num handling function*/
+
+  @Override
+  public NumArray init_num_t(int n) {
+    return new NumArray(new double[n]);
+  }
+
+  @Override
+  public NumArray init_num_t(NumArrayValues pValues) {
+    double[] result = new double[pValues.size()];
+    for (int i = 0; i < result.length; i++) {
+      long kind = pValues.getKind(i);
+      if (kind == NumArrayValues.KIND_INT) {
+        result[i] = pValues.getInt(i);
+      } else if (kind == NumArrayValues.KIND_FLOAT) {
+        result[i] = pValues.getFloat(i);
+      } else {
+        result[i] = Double.POSITIVE_INFINITY;
+      }
+    }
+    return new NumArray(result);
+  }
+
+  @Override
+  public void num_set(NumArray n1, NumArray n2) {
+    double[] target = values(n1);
+    double[] source = values(n2);
+    System.arraycopy(source, 0, target, 0, Math.min(source.length, target.length));
+  }
+
+  @Override
+  public void num_set_int(NumArray n, int pos, long i) {
+    values(n)[pos] = (int) i;
+  }
+
+  @Override
+  public void num_set_float(NumArray n, int pos, double d) {
+    values(n)[pos] = d;
+  }
+
+  @Override
+  public void num_set_inf(NumArray n, int pos) {
+    values(n)[pos] = Double.POSITIVE_INFINITY;
+  }
+
+  @Override
+  public long num_get_int(NumArray n, int pos) {
+    return (long) values(n)[pos];
+  }
+
+  @Override
+  public double num_get_float(NumArray n, int pos) {
+    return values(n)[pos];
+  }
+
+  @Override
+  public boolean num_infty(NumArray n, int pos) {
+    return Double.isInfinite(values(n)[pos]);
+  }
+
+  @Override
+  public void num_clear_n(NumArray n, int size) {
+    // nothing to free
+  }
+
+  /* Octagon Creation */
+
+  @Override
+  public Octagon empty(int n) {
+    return wrap(OctagonMatrix.empty(n, integers));
+  }
+
+  @Override
+  public Octagon universe(int n) {
+    return wrap(OctagonMatrix.universe(n, integers));
+  }
+
+  @Override
+  public Octagon copy(Octagon oct) {
+    return wrap(oct.getMatrix());
+  }
+
+  @Override
+  public Octagon full_copy(Octagon oct) {
+    return wrap(oct.getMatrix());
+  }
+
+  /* Query Functions */
+
+  @Override
+  public int dimension(Octagon oct) {
+    return oct.getMatrix().getDimension();
+  }
+
+  @Override
+  public int nbconstraints(Octagon oct) {
+    return oct.getMatrix().getNumberOfConstraints();
+  }
+
+  /* Test Functions, the lazy variants return 1 for true and 2 for false */
+
+  @Override
+  public boolean isEmpty(Octagon oct) {
+    return oct.getMatrix().isEmpty();
+  }
+
+  @Override
+  public int isEmptyLazy(Octagon oct) {
+    return isEmpty(oct) ? 1 : 2;
+  }
+
+  @Override
+  public boolean isUniverse(Octagon oct) {
+    return oct.getMatrix().isUniverse();
+  }
+
+  @Override
+  public boolean isIncludedIn(Octagon oct1, Octagon oct2) {
+    return oct1.getMatrix().isIncludedIn(oct2.getMatrix());
+  }
+
+  @Override
+  public int isIncludedInLazy(Octagon oct1, Octagon oct2) {
+    return isIncludedIn(oct1, oct2) ? 1 : 2;
+  }
+
+  @Override
+  public boolean isEqual(Octagon oct1, Octagon oct2) {
+    return oct1.getMatrix().isEqualTo(oct2.getMatrix());
+  }
+
+  @Override
+  public int isEqualLazy(Octagon oct1, Octagon oct2) {
+    return isEqual(oct1, oct2) ? 1 : 2;
+  }
+
+  /* Operators */
+
+  @Override
+  public Octagon intersection(Octagon oct1, Octagon oct2) {
+    return wrap(oct1.getMatrix().intersection(oct2.getMatrix()));
+  }
+
+  @Override
+  public Octagon union(Octagon oct1, Octagon oct2) {
+    return wrap(oct1.getMatrix().union(oct2.getMatrix()));
+  }
+
+  @Override
+  public Octagon widening(Octagon oct1, Octagon oct2) {
+    return wrap(oct1.getMatrix().widening(oct2.getMatrix()));
+  }
+
+  @Override
+  public Octagon narrowing(Octagon oct1, Octagon oct2) {
+    return wrap(oct1.getMatrix().narrowing(oct2.getMatrix()));
+  }
+
+  /* Transfer Functions */
+
+  @Override
+  public Octagon forget(Octagon oct, int k) {
+    return wrap(oct.getMatrix().forget(k));
+  }
+
+  @Override
+  public Octagon assingVar(Octagon oct, int k, NumArray array) {
+    OctagonMatrix matrix = oct.getMatrix();
+    return wrap(
+        matrix.assign(k, Arrays.copyOf(values(array), matrix.getDimension() + 1)));
+  }
+
+  @Override
+  public Octagon addBinConstraint(Octagon oct, int noOfConstraints, NumArray array) {
+    double[] constraints = values(array);
+    OctagonMatrix matrix = oct.getMatrix();
+    for (int i = 0; i < noOfConstraints; i++) {
+      matrix =
+          matrix.addBinaryConstraint(
+              (int) constraints[4 * i],
+              (int) constraints[4 * i + 1],
+              (int) constraints[4 * i + 2],
+              constraints[4 * i + 3]);
+    }
+    return wrap(matrix);
+  }
+
+  @Override
+  public Octagon intervAssingVar(Octagon oct, int k, NumArray array) {
+    // pairs of upper bound and negated lower bound, as in the native library
+    double[] coefficients = values(array);
+    OctagonMatrix matrix = oct.getMatrix();
+    int n = matrix.getDimension();
+    double[] lower = new double[n + 1];
+    double[] upper = new double[n + 1];
+    for (int i = 0; i <= n; i++) {
+      upper[i] = coefficients[2 * i];
+      lower[i] = 0 - coefficients[2 * i + 1];
+    }
+    return wrap(matrix.assignInterval(k, lower, upper));
+  }
+
+  @Override
+  public Octagon set_bounds(Octagon oct, int pos, NumArray lower, NumArray upper) {
+    throw new UnsupportedOperationException("not supported by the Java octagon library");
+  }
+
+  @Override
+  public boolean isIn(Octagon oct1, NumArray array) {
+    throw new UnsupportedOperationException("not supported by the Java octagon library");
+  }
+
+  @Override
+  public Octagon substituteVar(Octagon oct, int x, NumArray array) {
+    throw new UnsupportedOperationException("not supported by the Java octagon library");
+  }
+
+  @Override
+  public Octagon addConstraint(Octagon oct, NumArray array) {
+    throw new UnsupportedOperationException("not supported by the Java octagon library");
+  }
+
+  @Override
+  public Octagon intervSubstituteVar(Octagon oct, int x, NumArray array) {
+    throw new UnsupportedOperationException("not supported by the Java octagon library");
+  }
+
+  @Override
+  public Octagon intervAddConstraint(Octagon oct, NumArray array) {
+    throw new UnsupportedOperationException("not supported by the Java octagon library");
+  }
+
+  /* change of dimensions */
+
+  @Override
+  public Octagon addDimensionAndEmbed(Octagon oct, int k) {
+    return wrap(oct.getMatrix().addDimensionsAndEmbed(k));
+  }
+
+  @Override
+  public Octagon addDimensionAndProject(Octagon oct, int k) {
+    return wrap(oct.getMatrix().addDimensionsAndProject(k));
+  }
+
+  @Override
+  public Octagon removeDimension(Octagon oct, int k) {
+    return wrap(oct.getMatrix().removeDimensions(k));
+  }
+
+  @Override
+  public void printNum(NumArray arr, int size) {
+    System.out.println(Arrays.toString(Arrays.copyOf(values(arr), size)));
+  }
+
+  @Override
+  public void printOct(Octagon oct) {
+    System.out.println(print(oct, HashBiMap.create()));
+  }
+
+  @Override
+  public String print(Octagon oct, BiMap<Integer, MemoryLocation> map) {
+    OctagonMatrix matrix = oct.getMatrix();
+    StringBuilder str = new StringBuilder();
+    str.append("Octagon (id: " + oct.getOctId() + ") (dimension: " + matrix.getDimension() + ")\n");
+    if (matrix.isEmpty()) {
+      str.append("[Empty]\n");
+      return str.toString();
+    }
+
+    for (int i = 0; i < map.size(); i++) {
+      str.append(" ").append(map.get(i)).append(" -> [");
+      double lower = matrix.getLowerBound(i);
+      double upper = matrix.getUpperBound(i);
+      if (Double.isInfinite(lower)) {
+        str.append("-INFINITY, ");
+      } else {
+        str.append(integers ? Long.toString((long) lower) : Double.toString(lower)).append(", ");
+      }
+      if (Double.isInfinite(upper)) {
+        str.append("INFINITY]\n");
+      } else {
+        str.append(integers ? Long.toString((long) upper) : Double.toString(upper)).append("]\n");
+      }
+    }
+    return str.toString();
+  }
+
+  @Override
+  public OctagonInterval getVariableBounds(Octagon oct, int id) {
+    OctagonMatrix matrix = oct.getMatrix();
+    assert id < matrix.getDimension();
+    double lower = matrix.getLowerBound(id);
+    double upper = matrix.getUpperBound(id);
+    boolean lowerInfinite = Double.isInfinite(lower);
+    boolean upperInfinite = Double.isInfinite(upper);
+
+    if (lowerInfinite && upperInfinite) {
+      return new OctagonInterval(Double.NEGATIVE_INFINITY, Double.POSITIVE_INFINITY);
+    } else if (!integers) {
+      return new OctagonInterval(lower, upper);
+    } else if (lowerInfinite) {
+      return new OctagonInterval(
+          new OctagonDoubleValue(Double.NEGATIVE_INFINITY), OctagonIntValue.of((long) upper));
+    } else if (upperInfinite) {
+      return new OctagonInterval(
+          OctagonIntValue.of((long) lower), new OctagonDoubleValue(Double.POSITIVE_INFINITY));
+    } else {
+      return new OctagonInterval((long) lower, (long) upper);
+    }
+  }
+}
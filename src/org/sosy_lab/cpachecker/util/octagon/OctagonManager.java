@@ -21,6 +21,7 @@ import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_free;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_full_copy;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_init;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_init_n;
+import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_init_n_values;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intersection;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intervAddConstraint;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_intervAssingVar;
@@ -52,7 +53,10 @@ import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_union;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_universe;
 import static org.sosy_lab.cpachecker.util.octagon.OctWrapper.J_widening;
 
+import static com.google.common.base.Preconditions.checkState;
+
 import com.google.common.collect.BiMap;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.NativeLibraries;
 import org.sosy_lab.cpachecker.cpa.octagon.values.OctagonInterval;
 import org.sosy_lab.cpachecker.util.states.MemoryLocation;
@@ -62,6 +66,17 @@ public abstract class OctagonManager {
 
   private static boolean libraryLoaded = false;
 
+  /**
+   * Whether the loaded library provides the bulk initialization of num arrays. Older builds of the
+   * native library do not, in this case we fall back to setting each entry with its own call.
+   */
+  private static boolean bulkInitAvailable = true;
+
+  private @Nullable OctagonArena currentArena = null;
+
+  /** Constructor for managers that do not use the native octagon library. */
+  protected OctagonManager() {}
+
   @SuppressWarnings("StaticAssignmentInConstructor")
   protected OctagonManager(String libraryName) {
     if (!libraryLoaded) {
@@ -74,178 +89,226 @@ public abstract class OctagonManager {
   /* num handling function*/
 
   /* allocate new space for num array and init*/
-  public final NumArray init_num_t (int n) {
+  public NumArray init_num_t(int n) {
     return new NumArray(J_init_n(n));
   }
 
+  /**
+   * Allocates a num array with the given values. In contrast to setting the entries one by one,
+   * this needs only a single native call.
+   */
+  public NumArray init_num_t(NumArrayValues values) {
+    if (bulkInitAvailable) {
+      try {
+        return new NumArray(J_init_n_values(values.size(), values.getBuffer()));
+      } catch (UnsatisfiedLinkError e) {
+        bulkInitAvailable = false;
+      }
+    }
+    NumArray arr = init_num_t(values.size());
+    for (int i = 0; i < values.size(); i++) {
+      long kind = values.getKind(i);
+      if (kind == NumArrayValues.KIND_INT) {
+        J_num_set_int(arr.getArray(), i, values.getInt(i));
+      } else if (kind == NumArrayValues.KIND_FLOAT) {
+        J_num_set_float(arr.getArray(), i, values.getFloat(i));
+      } else {
+        J_num_set_inf(arr.getArray(), i);
+      }
+    }
+    return arr;
+  }
+
   /* num copy */
-  public final void num_set(NumArray n1, NumArray n2) {
+  public void num_set(NumArray n1, NumArray n2) {
     J_num_set(n1.getArray(), n2.getArray());
   }
 
-  public final Octagon set_bounds(Octagon oct, int pos, NumArray lower, NumArray upper) {
+  public Octagon set_bounds(Octagon oct, int pos, NumArray lower, NumArray upper) {
     return new Octagon(J_set_bounds(oct.getOctId(), pos, lower.getArray(), upper.getArray(), false), this);
   }
 
   /* set int */
-  public final void num_set_int(NumArray n, int pos, long i) {
+  public void num_set_int(NumArray n, int pos, long i) {
     J_num_set_int(n.getArray(), pos, (int)i);
   }
   /* set float */
-  public final void num_set_float(NumArray n, int pos, double d) {
+  public void num_set_float(NumArray n, int pos, double d) {
     J_num_set_float(n.getArray(), pos, d);
   }
   /* set infinity */
-  public final void num_set_inf(NumArray n, int pos) {
+  public void num_set_inf(NumArray n, int pos) {
     J_num_set_inf(n.getArray(), pos);
   }
 
-  public final long num_get_int(NumArray n, int pos) {
+  public long num_get_int(NumArray n, int pos) {
     return J_num_get_int(n.getArray(), pos);
   }
 
-  public final double num_get_float(NumArray n, int pos) {
+  public double num_get_float(NumArray n, int pos) {
     return J_num_get_float(n.getArray(), pos);
   }
 
-  public final boolean num_infty(NumArray n, int pos) {
+  public boolean num_infty(NumArray n, int pos) {
     return J_num_infty(n.getArray(), pos);
   }
 
-  public final void num_clear_n(NumArray n, int size) {
+  public void num_clear_n(NumArray n, int size) {
     J_num_clear_n(n.getArray(), size);
   }
 
+  /* Octagon lifetime */
+
+  /**
+   * Opens an arena that collects all octagons created by this manager until it is closed. Arenas
+   * can be nested, the latest opened one has to be closed first.
+   */
+  public final OctagonArena openArena() {
+    currentArena = new OctagonArena(this, currentArena);
+    return currentArena;
+  }
+
+  final void closeArena(OctagonArena arena, @Nullable OctagonArena parent) {
+    checkState(currentArena == arena, "arenas have to be closed in reverse order of opening");
+    currentArena = parent;
+  }
+
+  final void registerOctagon(Octagon oct) {
+    if (currentArena != null) {
+      currentArena.register(oct);
+    }
+  }
+
   /* Octagon handling functions */
 
   /* Octagon Creation */
-  public final Octagon empty(int n) {
+  public Octagon empty(int n) {
     return new Octagon(J_empty(n), this);
   }
 
-  public final Octagon universe(int n) {
+  public Octagon universe(int n) {
     return new Octagon(J_universe(n), this);
   }
   final void free(Long oct) {
     J_free(oct);
   }
 
-  public final Octagon copy(Octagon oct) {
+  public Octagon copy(Octagon oct) {
     return new Octagon(J_copy(oct.getOctId()), this);
   }
 
-  public final Octagon full_copy(Octagon oct) {
+  public Octagon full_copy(Octagon oct) {
     return new Octagon(J_full_copy(oct.getOctId()), this);
   }
 
   /* Query Functions */
-  public final int dimension(Octagon oct) {
+  public int dimension(Octagon oct) {
     return J_dimension(oct.getOctId());
   }
 
-  public final int nbconstraints(Octagon oct) {
+  public int nbconstraints(Octagon oct) {
     return J_nbconstraints(oct.getOctId());
   }
 
   /* Test Functions */
-  public final boolean isEmpty(Octagon oct) {
+  public boolean isEmpty(Octagon oct) {
     return J_isEmpty(oct.getOctId());
   }
 
-  public final int isEmptyLazy(Octagon oct) {
+  public int isEmptyLazy(Octagon oct) {
     return J_isEmptyLazy(oct.getOctId());
   }
 
-  public final boolean isUniverse(Octagon oct) {
+  public boolean isUniverse(Octagon oct) {
     return J_isUniverse(oct.getOctId());
   }
 
-  public final boolean isIncludedIn(Octagon oct1, Octagon oct2) {
+  public boolean isIncludedIn(Octagon oct1, Octagon oct2) {
     return J_isIncludedIn(oct1.getOctId(), oct2.getOctId());
   }
 
-  public final int isIncludedInLazy(Octagon oct1, Octagon oct2) {
+  public int isIncludedInLazy(Octagon oct1, Octagon oct2) {
     return J_isIncludedInLazy(oct1.getOctId(), oct2.getOctId());
   }
 
-  public final boolean isEqual(Octagon oct1, Octagon oct2) {
+  public boolean isEqual(Octagon oct1, Octagon oct2) {
     return J_isEqual(oct1.getOctId(), oct2.getOctId());
   }
 
-  public final int isEqualLazy(Octagon oct1, Octagon oct2) {
+  public int isEqualLazy(Octagon oct1, Octagon oct2) {
     return J_isEqualLazy(oct1.getOctId(), oct2.getOctId());
   }
 
-  public final boolean isIn(Octagon oct1, NumArray array) {
+  public boolean isIn(Octagon oct1, NumArray array) {
     return J_isIn(oct1.getOctId(), array.getArray());
   }
 
   /* Operators */
-  public final Octagon intersection(Octagon oct1, Octagon oct2) {
+  public Octagon intersection(Octagon oct1, Octagon oct2) {
     return new Octagon(J_intersection(oct1.getOctId(), oct2.getOctId(), false), this);
   }
 
-  public final Octagon union(Octagon oct1, Octagon oct2) {
+  public Octagon union(Octagon oct1, Octagon oct2) {
     return new Octagon(J_union(oct1.getOctId(), oct2.getOctId(), false), this);
   }
 
   /* int widening = 0 -> OCT_WIDENING_FAST
    * int widening = 1 ->  OCT_WIDENING_ZERO
    * int widening = 2 -> OCT_WIDENING_UNIT*/
-  public final Octagon widening(Octagon oct1, Octagon oct2) {
+  public Octagon widening(Octagon oct1, Octagon oct2) {
     return new Octagon(J_widening(oct1.getOctId(), oct2.getOctId(), false, 1), this);
   }
 
-  public final Octagon narrowing(Octagon oct1, Octagon oct2) {
+  public Octagon narrowing(Octagon oct1, Octagon oct2) {
     return new Octagon(J_narrowing(oct1.getOctId(), oct2.getOctId(), false), this);
   }
 
   /* Transfer Functions */
-  public final Octagon forget(Octagon oct, int k) {
+  public Octagon forget(Octagon oct, int k) {
     return new Octagon(J_forget(oct.getOctId(), k, false), this);
   }
 
-  public final Octagon assingVar(Octagon oct, int k, NumArray array) {
+  public Octagon assingVar(Octagon oct, int k, NumArray array) {
     return new Octagon(J_assingVar(oct.getOctId(), k, array.getArray(), false), this);
   }
 
-  public final Octagon addBinConstraint(Octagon oct, int noOfConstraints, NumArray array) {
+  public Octagon addBinConstraint(Octagon oct, int noOfConstraints, NumArray array) {
     return new Octagon(J_addBinConstraints(oct.getOctId(), noOfConstraints, array.getArray(), false), this);
   }
 
-  public final Octagon substituteVar(Octagon oct, int x, NumArray array) {
+  public Octagon substituteVar(Octagon oct, int x, NumArray array) {
     return new Octagon(J_substituteVar(oct.getOctId(), x, array.getArray(), false), this);
   }
 
-  public final Octagon addConstraint(Octagon oct, NumArray array) {
+  public Octagon addConstraint(Octagon oct, NumArray array) {
     return new Octagon(J_addConstraint(oct.getOctId(), array.getArray(), false), this);
   }
-  public final Octagon intervAssingVar(Octagon oct, int k, NumArray array) {
+  public Octagon intervAssingVar(Octagon oct, int k, NumArray array) {
     return new Octagon(J_intervAssingVar(oct.getOctId(), k, array.getArray(), false), this);
   }
-  public final Octagon intervSubstituteVar(Octagon oct, int x, NumArray array) {
+  public Octagon intervSubstituteVar(Octagon oct, int x, NumArray array) {
     return new Octagon(J_intervSubstituteVar(oct.getOctId(), x, array.getArray(), false), this);
   }
-  public final Octagon intervAddConstraint(Octagon oct, NumArray array) {
+  public Octagon intervAddConstraint(Octagon oct, NumArray array) {
     return new Octagon(J_intervAddConstraint(oct.getOctId(), array.getArray(), false), this);
   }
 
   /* change of dimensions */
-  public final Octagon addDimensionAndEmbed(Octagon oct, int k) {
+  public Octagon addDimensionAndEmbed(Octagon oct, int k) {
     return new Octagon(J_addDimenensionAndEmbed(oct.getOctId(), k, false), this);
   }
-  public final Octagon addDimensionAndProject(Octagon oct, int k) {
+  public Octagon addDimensionAndProject(Octagon oct, int k) {
     return new Octagon(J_addDimenensionAndProject(oct.getOctId(), k, false), this);
   }
-  public final Octagon removeDimension(Octagon oct, int k) {
+  public Octagon removeDimension(Octagon oct, int k) {
     return new Octagon(J_removeDimension(oct.getOctId(), k, false), this);
   }
 
-  public final void printNum(NumArray arr, int size) {
+  public void printNum(NumArray arr, int size) {
       J_printNum(arr.getArray(), size);
   }
 
-  public final void printOct(Octagon oct) {
+  public void printOct(Octagon oct) {
     J_print(oct.getOctId());
   }
 
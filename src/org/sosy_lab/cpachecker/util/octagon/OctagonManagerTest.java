@@ -40,4 +40,23 @@ public class OctagonManagerTest {
     assertThat(manager.num_get_float(num, 0)).isWithin(0).of(3.3);
   }
 
+  @Test
+  public void testNum_Values() {
+    NumArray num =
+        manager.init_num_t(new NumArrayValues(3).setInt(0, 3).setFloat(1, 3.3).setInfinite(2));
+    assertThat(manager.num_get_int(num, 0)).isEqualTo(3);
+    assertThat(manager.num_get_float(num, 1)).isWithin(0).of(3.3);
+    assertThat(manager.num_infty(num, 2)).isTrue();
+  }
+
+  @Test
+  public void testArena() {
+    Octagon kept;
+    try (OctagonArena arena = manager.openArena()) {
+      Octagon oct = manager.universe(2);
+      kept = manager.addDimensionAndEmbed(oct, 1);
+      arena.keep(kept);
+    }
+    assertThat(manager.dimension(kept)).isEqualTo(3);
+  }
 }
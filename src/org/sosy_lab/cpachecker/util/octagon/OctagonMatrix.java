@@ -0,0 +1,618 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.octagon;
+
+import static com.google.common.base.Preconditions.checkArgument;
+
+import java.util.Arrays;
+import org.checkerframework.checker.nullness.qual.Nullable;
+
+/**
+ * Pure-Java octagon as a difference bound matrix in half-matrix storage, following the
+ * representation of Miné's octagon library.
+ *
+ * <p>Each variable v_k is represented by two nodes, 2k for +v_k and 2k+1 for -v_k, and the entry
+ * (i, j) is an upper bound for V_j - V_i. Because of coherence, (i, j) and (j^1, i^1) are the
+ * same constraint, so only the entries with j <= (i|1) are stored, row by row.
+ *
+ * <p>Instances are immutable, thus they can be shared between threads. All operations except
+ * widening and narrowing return strongly closed matrices. The closure uses the Floyd-Warshall
+ * algorithm followed by a single strengthening step (and tightening for integers), and updates
+ * that change only the constraints of one variable use an incremental closure in quadratic time.
+ */
+final class OctagonMatrix {
+
+  private static final double INF = Double.POSITIVE_INFINITY;
+
+  private final int dimension;
+  private final boolean integers;
+
+  /** the bounds, null iff the octagon is empty */
+  private final double @Nullable [] m;
+
+  private final boolean closed;
+
+  private OctagonMatrix(int pDimension, boolean pIntegers, double @Nullable [] pM, boolean pClosed) {
+    dimension = pDimension;
+    integers = pIntegers;
+    m = pM;
+    closed = pClosed;
+  }
+
+  static OctagonMatrix universe(int pDimension, boolean pIntegers) {
+    double[] m = new double[matSize(pDimension)];
+    Arrays.fill(m, INF);
+    for (int i = 0; i < 2 * pDimension; i++) {
+      m[matPos(i, i)] = 0;
+    }
+    return new OctagonMatrix(pDimension, pIntegers, m, true);
+  }
+
+  static OctagonMatrix empty(int pDimension, boolean pIntegers) {
+    return new OctagonMatrix(pDimension, pIntegers, null, true);
+  }
+
+  private OctagonMatrix withBounds(double @Nullable [] pM, boolean pClosed) {
+    return new OctagonMatrix(dimension, integers, pM, pClosed);
+  }
+
+  /* half-matrix layout */
+
+  static int matSize(int pDimension) {
+    return 2 * pDimension * (pDimension + 1);
+  }
+
+  private static int rowStart(int i) {
+    return ((i + 1) * (i + 1)) / 2;
+  }
+
+  private static int matPos(int i, int j) {
+    return j + rowStart(i);
+  }
+
+  private static double get(double[] m, int i, int j) {
+    return j <= (i | 1) ? m[matPos(i, j)] : m[matPos(j ^ 1, i ^ 1)];
+  }
+
+  private static void set(double[] m, int i, int j, double value) {
+    if (j <= (i | 1)) {
+      m[matPos(i, j)] = value;
+    } else {
+      m[matPos(j ^ 1, i ^ 1)] = value;
+    }
+  }
+
+  private static void setMin(double[] m, int i, int j, double value) {
+    set(m, i, j, Math.min(get(m, i, j), value));
+  }
+
+  /* closure */
+
+  /** Floyd-Warshall step for the two nodes of variable k. */
+  private static void pivot(double[] m, int n, int k, double[] colP, double[] colQ) {
+    int p = 2 * k;
+    int q = p + 1;
+    for (int i = 0; i < 2 * n; i++) {
+      colP[i] = get(m, i, p);
+      colQ[i] = get(m, i, q);
+    }
+    double mpq = get(m, p, q);
+    double mqp = get(m, q, p);
+    // rows p and q (by coherence the reversed columns q and p), including the
+    // paths that go through both nodes of k
+    double[] rowP = new double[2 * n];
+    double[] rowQ = new double[2 * n];
+    for (int j = 0; j < 2 * n; j++) {
+      rowP[j] = Math.min(colQ[j ^ 1], mpq + colP[j ^ 1]);
+      rowQ[j] = Math.min(colP[j ^ 1], mqp + colQ[j ^ 1]);
+    }
+    for (int i = 0; i < 2 * n; i++) {
+      double a = colP[i];
+      double b = colQ[i];
+      if (a == INF && b == INF) {
+        continue;
+      }
+      int start = rowStart(i);
+      int end = i | 1;
+      // simple loop over consecutive memory, which the JIT compiler can vectorize
+      for (int j = 0; j <= end; j++) {
+        m[start + j] = Math.min(m[start + j], Math.min(a + rowP[j], b + rowQ[j]));
+      }
+    }
+  }
+
+  /**
+   * Tightening for integers and strengthening of a matrix that is closed with respect to
+   * shortest paths.
+   *
+   * @return false if the matrix is empty
+   */
+  private static boolean strengthen(double[] m, int n, boolean pIntegers) {
+    double[] unary = new double[2 * n];
+    for (int i = 0; i < 2 * n; i++) {
+      double bound = get(m, i, i ^ 1);
+      if (pIntegers && bound != INF) {
+        bound = 2 * Math.floor(bound / 2);
+        set(m, i, i ^ 1, bound);
+      }
+      unary[i] = bound;
+    }
+    for (int i = 0; i < 2 * n; i++) {
+      double ui = unary[i];
+      if (ui == INF) {
+        continue;
+      }
+      int start = rowStart(i);
+      int end = i | 1;
+      for (int j = 0; j <= end; j++) {
+        m[start + j] = Math.min(m[start + j], (ui + unary[j ^ 1]) / 2);
+      }
+    }
+    for (int i = 0; i < 2 * n; i++) {
+      if (m[matPos(i, i)] < 0) {
+        return false;
+      }
+      m[matPos(i, i)] = 0;
+    }
+    return true;
+  }
+
+  /** Strong closure in cubic time, returns false if the matrix is empty. */
+  private static boolean closeFull(double[] m, int n, boolean pIntegers) {
+    double[] colP = new double[2 * n];
+    double[] colQ = new double[2 * n];
+    for (int k = 0; k < n; k++) {
+      pivot(m, n, k, colP, colQ);
+    }
+    return strengthen(m, n, pIntegers);
+  }
+
+  /**
+   * Strong closure in quadratic time for a matrix that is closed except for the constraints of
+   * variable v, returns false if the matrix is empty.
+   */
+  private static boolean closeIncremental(double[] m, int n, int v, boolean pIntegers) {
+    // close the rows of v (and thus its columns) with respect to all other variables
+    for (int k = 0; k < n; k++) {
+      if (k == v) {
+        continue;
+      }
+      int p = 2 * k;
+      int q = p + 1;
+      double mpq = get(m, p, q);
+      double mqp = get(m, q, p);
+      for (int u = 2 * v; u <= 2 * v + 1; u++) {
+        for (int j = 0; j < 2 * n; j++) {
+          double up = get(m, u, p);
+          double uq = get(m, u, q);
+          double pj = get(m, p, j);
+          double qj = get(m, q, j);
+          double bound =
+              Math.min(
+                  Math.min(up + pj, uq + qj), Math.min(up + mpq + qj, uq + mqp + pj));
+          if (bound < get(m, u, j)) {
+            set(m, u, j, bound);
+          }
+        }
+      }
+    }
+    // afterwards, one step with v as pivot closes the whole matrix
+    pivot(m, n, v, new double[2 * n], new double[2 * n]);
+    return strengthen(m, n, pIntegers);
+  }
+
+  /** Returns the strong closure of this matrix. */
+  OctagonMatrix close() {
+    if (closed || m == null) {
+      return this;
+    }
+    double[] result = m.clone();
+    return withBounds(closeFull(result, dimension, integers) ? result : null, true);
+  }
+
+  /* queries */
+
+  int getDimension() {
+    return dimension;
+  }
+
+  boolean isEmpty() {
+    return close().m == null;
+  }
+
+  boolean isUniverse() {
+    double[] c = close().m;
+    if (c == null) {
+      return false;
+    }
+    for (int i = 0; i < 2 * dimension; i++) {
+      for (int j = 0; j <= (i | 1); j++) {
+        if (i != j && c[matPos(i, j)] != INF) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  int getNumberOfConstraints() {
+    double[] c = close().m;
+    if (c == null) {
+      return 0;
+    }
+    int constraints = 0;
+    for (int i = 0; i < 2 * dimension; i++) {
+      for (int j = 0; j <= (i | 1); j++) {
+        if (i != j && c[matPos(i, j)] != INF) {
+          constraints++;
+        }
+      }
+    }
+    return constraints;
+  }
+
+  boolean isIncludedIn(OctagonMatrix pOther) {
+    checkArgument(dimension == pOther.dimension, "octagons have different dimensions");
+    double[] c = close().m;
+    if (c == null) {
+      return true;
+    }
+    double[] o = pOther.m;
+    if (o == null || pOther.isEmpty()) {
+      return false;
+    }
+    for (int i = 0; i < c.length; i++) {
+      if (c[i] > o[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  boolean isEqualTo(OctagonMatrix pOther) {
+    if (dimension != pOther.dimension) {
+      return false;
+    }
+    double[] c = close().m;
+    double[] o = pOther.close().m;
+    if (c == null || o == null) {
+      return c == o;
+    }
+    for (int i = 0; i < c.length; i++) {
+      // not Arrays.equals, which distinguishes 0.0 and -0.0
+      if (c[i] != o[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Returns the upper bound of the variable, or positive infinity. */
+  double getUpperBound(int pVar) {
+    double[] c = close().m;
+    return c == null ? Double.NEGATIVE_INFINITY : get(c, 2 * pVar + 1, 2 * pVar) / 2;
+  }
+
+  /** Returns the lower bound of the variable, or negative infinity. */
+  double getLowerBound(int pVar) {
+    double[] c = close().m;
+    return c == null ? INF : 0 - get(c, 2 * pVar, 2 * pVar + 1) / 2;
+  }
+
+  /* operators */
+
+  OctagonMatrix intersection(OctagonMatrix pOther) {
+    checkArgument(dimension == pOther.dimension, "octagons have different dimensions");
+    if (m == null || pOther.m == null) {
+      return empty(dimension, integers);
+    }
+    double[] result = new double[m.length];
+    for (int i = 0; i < result.length; i++) {
+      result[i] = Math.min(m[i], pOther.m[i]);
+    }
+    return withBounds(closeFull(result, dimension, integers) ? result : null, true);
+  }
+
+  /** Convex hull of both octagons, the maximum of two closed matrices is closed. */
+  OctagonMatrix union(OctagonMatrix pOther) {
+    checkArgument(dimension == pOther.dimension, "octagons have different dimensions");
+    OctagonMatrix c = close();
+    OctagonMatrix o = pOther.close();
+    if (c.m == null) {
+      return o;
+    } else if (o.m == null) {
+      return c;
+    }
+    double[] result = new double[c.m.length];
+    for (int i = 0; i < result.length; i++) {
+      result[i] = Math.max(c.m[i], o.m[i]);
+    }
+    return withBounds(result, true);
+  }
+
+  /**
+   * Widening with threshold zero, like OCT_WIDENING_ZERO. This matrix is not closed beforehand
+   * and neither is the result, otherwise the widening would not guarantee termination.
+   */
+  OctagonMatrix widening(OctagonMatrix pOther) {
+    checkArgument(dimension == pOther.dimension, "octagons have different dimensions");
+    if (m == null) {
+      return pOther.close();
+    }
+    double[] o = pOther.close().m;
+    if (o == null) {
+      return this;
+    }
+    double[] result = new double[m.length];
+    for (int i = 0; i < result.length; i++) {
+      if (o[i] <= m[i]) {
+        result[i] = m[i];
+      } else {
+        result[i] = o[i] <= 0 ? 0 : INF;
+      }
+    }
+    return withBounds(result, false);
+  }
+
+  OctagonMatrix narrowing(OctagonMatrix pOther) {
+    checkArgument(dimension == pOther.dimension, "octagons have different dimensions");
+    double[] c = close().m;
+    double[] o = pOther.close().m;
+    if (c == null || o == null) {
+      return empty(dimension, integers);
+    }
+    double[] result = new double[c.length];
+    for (int i = 0; i < result.length; i++) {
+      result[i] = c[i] == INF ? o[i] : c[i];
+    }
+    return withBounds(result, false);
+  }
+
+  /* transfer functions */
+
+  /** Removes all constraints of the variable, forgetting keeps the matrix closed. */
+  private static void forget(double[] m, int n, int pVar) {
+    for (int u = 2 * pVar; u <= 2 * pVar + 1; u++) {
+      for (int j = 0; j < 2 * n; j++) {
+        if (j != u) {
+          set(m, u, j, INF);
+        }
+      }
+    }
+  }
+
+  OctagonMatrix forget(int pVar) {
+    OctagonMatrix c = close();
+    if (c.m == null) {
+      return c;
+    }
+    double[] result = c.m.clone();
+    forget(result, dimension, pVar);
+    return withBounds(result, true);
+  }
+
+  private OctagonMatrix closedAfterUpdateOf(double[] pResult, int pVar) {
+    return withBounds(closeIncremental(pResult, dimension, pVar, integers) ? pResult : null, true);
+  }
+
+  /**
+   * Adds a constraint over at most two variables, with the types of the native library: 0: x <=
+   * c, 1: -x <= c, 2: x+y <= c, 3: x-y <= c, 4: -x+y <= c, 5: -x-y <= c.
+   */
+  OctagonMatrix addBinaryConstraint(int pType, int pX, int pY, double pConstant) {
+    OctagonMatrix c = close();
+    if (c.m == null) {
+      return c;
+    }
+    double[] result = c.m.clone();
+    int x = 2 * pX;
+    int y = 2 * pY;
+    switch (pType) {
+      case 0:
+        setMin(result, x + 1, x, 2 * pConstant);
+        break;
+      case 1:
+        setMin(result, x, x + 1, 2 * pConstant);
+        break;
+      case 2:
+        setMin(result, y + 1, x, pConstant);
+        break;
+      case 3:
+        setMin(result, y, x, pConstant);
+        break;
+      case 4:
+        setMin(result, x, y, pConstant);
+        break;
+      case 5:
+        setMin(result, x, y + 1, pConstant);
+        break;
+      default:
+        throw new IllegalArgumentException("unknown type of constraint " + pType);
+    }
+    return closedAfterUpdateOf(result, pX);
+  }
+
+  private static void setBounds(double[] m, int pVar, double pLower, double pUpper) {
+    setMin(m, 2 * pVar + 1, 2 * pVar, 2 * pUpper);
+    setMin(m, 2 * pVar, 2 * pVar + 1, -2 * pLower);
+  }
+
+  /**
+   * Assigns x := sum(coefficients[i] * v_i) + coefficients[n]. The assignment is exact if the
+   * right-hand side has the form c or +-v_j + c, otherwise the interval of the right-hand side is
+   * assigned.
+   */
+  OctagonMatrix assign(int pVar, double[] pCoefficients) {
+    int n = dimension;
+    checkArgument(pCoefficients.length == n + 1, "wrong number of coefficients");
+    double[] lower = new double[n + 1];
+    double[] upper = new double[n + 1];
+    for (int i = 0; i <= n; i++) {
+      lower[i] = pCoefficients[i];
+      upper[i] = pCoefficients[i];
+    }
+    return assignInterval(pVar, lower, upper);
+  }
+
+  /** Assigns x := sum([lower[i], upper[i]] * v_i) + [lower[n], upper[n]]. */
+  OctagonMatrix assignInterval(int pVar, double[] pLower, double[] pUpper) {
+    int n = dimension;
+    checkArgument(pLower.length == n + 1 && pUpper.length == n + 1, "wrong number of coefficients");
+    OctagonMatrix c = close();
+    if (c.m == null) {
+      return c;
+    }
+    double[] result = c.m.clone();
+    double constLower = pLower[n];
+    double constUpper = pUpper[n];
+
+    int single = -1;
+    int nonZero = 0;
+    for (int i = 0; i < n; i++) {
+      if (pLower[i] != 0 || pUpper[i] != 0) {
+        nonZero++;
+        single = i;
+      }
+    }
+    boolean unitCoefficient =
+        nonZero == 1
+            && pLower[single] == pUpper[single]
+            && Math.abs(pLower[single]) == 1;
+
+    if (unitCoefficient && single == pVar && constLower == constUpper) {
+      // x := +-x + c, shift (and mirror) the constraints of x, which keeps the matrix closed
+      if (pLower[single] < 0) {
+        negate(result, n, pVar);
+      }
+      shift(result, n, pVar, constLower);
+      return withBounds(result, true);
+
+    } else if (unitCoefficient && single != pVar) {
+      // x := +-v_j + [a, b], i.e., a <= x -+ v_j <= b
+      forget(result, n, pVar);
+      int j = pLower[single] > 0 ? 2 * single : 2 * single + 1;
+      setMin(result, j, 2 * pVar, constUpper);
+      setMin(result, 2 * pVar, j, -constLower);
+      return closedAfterUpdateOf(result, pVar);
+
+    } else {
+      // non-relational assignment of the bounds of the right-hand side
+      double lower = constLower;
+      double upper = constUpper;
+      for (int i = 0; i < n; i++) {
+        if (pLower[i] != 0 || pUpper[i] != 0) {
+          double varLower = -get(c.m, 2 * i, 2 * i + 1) / 2;
+          double varUpper = get(c.m, 2 * i + 1, 2 * i) / 2;
+          double p1 = multiply(pLower[i], varLower);
+          double p2 = multiply(pLower[i], varUpper);
+          double p3 = multiply(pUpper[i], varLower);
+          double p4 = multiply(pUpper[i], varUpper);
+          lower += Math.min(Math.min(p1, p2), Math.min(p3, p4));
+          upper += Math.max(Math.max(p1, p2), Math.max(p3, p4));
+        }
+      }
+      if (Double.isNaN(lower)) {
+        lower = Double.NEGATIVE_INFINITY;
+      }
+      if (Double.isNaN(upper)) {
+        upper = INF;
+      }
+      forget(result, n, pVar);
+      setBounds(result, pVar, lower, upper);
+      return closedAfterUpdateOf(result, pVar);
+    }
+  }
+
+  /** Multiplication for interval bounds, where zero times infinity is zero. */
+  private static double multiply(double a, double b) {
+    return a == 0 || b == 0 ? 0 : a * b;
+  }
+
+  /** x := -x, swaps the nodes of x. */
+  private static void negate(double[] m, int n, int pVar) {
+    int p = 2 * pVar;
+    int q = p + 1;
+    for (int j = 0; j < 2 * n; j++) {
+      if (j != p && j != q) {
+        double pj = get(m, p, j);
+        set(m, p, j, get(m, q, j));
+        set(m, q, j, pj);
+      }
+    }
+    double pq = get(m, p, q);
+    set(m, p, q, get(m, q, p));
+    set(m, q, p, pq);
+  }
+
+  /** x := x + c, the bounds of V_j - V_i change by c for j = +x or i = -x. */
+  private static void shift(double[] m, int n, int pVar, double pConstant) {
+    int p = 2 * pVar;
+    int q = p + 1;
+    for (int i = 0; i < 2 * n; i++) {
+      if (i != p && i != q) {
+        // column p and, by coherence, row q
+        set(m, i, p, get(m, i, p) + pConstant);
+        // column q and, by coherence, row p
+        set(m, i, q, get(m, i, q) - pConstant);
+      }
+    }
+    set(m, q, p, get(m, q, p) + 2 * pConstant);
+    set(m, p, q, get(m, p, q) - 2 * pConstant);
+  }
+
+  /* change of dimensions */
+
+  /** Adds unconstrained variables at the end, the half-matrix of the old ones is a prefix. */
+  OctagonMatrix addDimensionsAndEmbed(int pNumber) {
+    int newDimension = dimension + pNumber;
+    if (m == null) {
+      return empty(newDimension, integers);
+    }
+    double[] result = Arrays.copyOf(m, matSize(newDimension));
+    Arrays.fill(result, m.length, result.length, INF);
+    for (int i = 2 * dimension; i < 2 * newDimension; i++) {
+      result[matPos(i, i)] = 0;
+    }
+    return new OctagonMatrix(newDimension, integers, result, closed);
+  }
+
+  /** Adds variables with value zero at the end. */
+  OctagonMatrix addDimensionsAndProject(int pNumber) {
+    OctagonMatrix embedded = close().addDimensionsAndEmbed(pNumber);
+    if (embedded.m == null) {
+      return embedded;
+    }
+    OctagonMatrix result = embedded;
+    for (int v = dimension; v < dimension + pNumber && result.m != null; v++) {
+      double[] bounds = result.m.clone();
+      setBounds(bounds, v, 0, 0);
+      result = result.closedAfterUpdateOf(bounds, v);
+    }
+    return result;
+  }
+
+  /** Removes the given number of variables at the end. */
+  OctagonMatrix removeDimensions(int pNumber) {
+    checkArgument(pNumber <= dimension, "cannot remove more dimensions than existing");
+    int newDimension = dimension - pNumber;
+    double[] c = close().m;
+    if (c == null) {
+      return empty(newDimension, integers);
+    }
+    return new OctagonMatrix(
+        newDimension, integers, Arrays.copyOf(c, matSize(newDimension)), true);
+  }
+
+  /** Primarily for tests: returns the bound of V_j - V_i in the closed matrix. */
+  double getBound(int i, int j) {
+    double[] c = close().m;
+    checkArgument(c != null, "octagon is empty");
+    return get(c, i, j);
+  }
+}
@@ -0,0 +1,136 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.octagon;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import java.util.Random;
+import org.junit.Test;
+
+public class OctagonMatrixTest {
+
+  private static final int PX = 0;
+  private static final int MX = 1;
+  private static final int PXPY = 2;
+  private static final int MXPY = 4;
+
+  private static OctagonMatrix interval(OctagonMatrix m, int var, double low, double high) {
+    return m.addBinaryConstraint(PX, var, 0, high).addBinaryConstraint(MX, var, 0, -low);
+  }
+
+  @Test
+  public void testClosureDerivesBounds() {
+    OctagonMatrix m = OctagonMatrix.universe(2, true);
+    m = m.addBinaryConstraint(PX, 0, 0, 1).addBinaryConstraint(MXPY, 0, 1, 2);
+    assertThat(m.getUpperBound(1)).isEqualTo(3);
+    assertThat(m.getLowerBound(1)).isNegativeInfinity();
+  }
+
+  @Test
+  public void testTightClosureForIntegers() {
+    OctagonMatrix ints = OctagonMatrix.universe(1, true).addBinaryConstraint(PXPY, 0, 0, 3);
+    assertThat(ints.getUpperBound(0)).isEqualTo(1);
+    OctagonMatrix floats = OctagonMatrix.universe(1, false).addBinaryConstraint(PXPY, 0, 0, 3);
+    assertThat(floats.getUpperBound(0)).isEqualTo(1.5);
+  }
+
+  @Test
+  public void testEmpty() {
+    OctagonMatrix m = interval(OctagonMatrix.universe(1, true), 0, 1, 0);
+    assertThat(m.isEmpty()).isTrue();
+    assertThat(OctagonMatrix.universe(1, true).isEmpty()).isFalse();
+  }
+
+  @Test
+  public void testAssignRelational() {
+    OctagonMatrix m = interval(OctagonMatrix.universe(2, true), 1, 0, 1);
+    m = m.assign(0, new double[] {0, 1, 2});
+    assertThat(m.getLowerBound(0)).isEqualTo(2);
+    assertThat(m.getUpperBound(0)).isEqualTo(3);
+    // x - y <= 2 and y - x <= -2
+    assertThat(m.getBound(2, 0)).isEqualTo(2);
+    assertThat(m.getBound(0, 2)).isEqualTo(-2);
+  }
+
+  @Test
+  public void testAssignShiftAndNegate() {
+    OctagonMatrix m = interval(OctagonMatrix.universe(1, true), 0, 1, 2);
+    OctagonMatrix shifted = m.assign(0, new double[] {1, 3});
+    assertThat(shifted.getLowerBound(0)).isEqualTo(4);
+    assertThat(shifted.getUpperBound(0)).isEqualTo(5);
+    OctagonMatrix negated = m.assign(0, new double[] {-1, 0});
+    assertThat(negated.getLowerBound(0)).isEqualTo(-2);
+    assertThat(negated.getUpperBound(0)).isEqualTo(-1);
+  }
+
+  @Test
+  public void testAssignNonRelational() {
+    OctagonMatrix m = interval(OctagonMatrix.universe(2, true), 1, 0, 1);
+    m = m.assignInterval(0, new double[] {0, 2, -1}, new double[] {0, 2, 1});
+    assertThat(m.getLowerBound(0)).isEqualTo(-1);
+    assertThat(m.getUpperBound(0)).isEqualTo(3);
+  }
+
+  @Test
+  public void testIncrementalClosureEqualsFullClosure() {
+    Random random = new Random(0);
+    for (int run = 0; run < 200; run++) {
+      int dimension = 1 + random.nextInt(5);
+      boolean integers = random.nextBoolean();
+      OctagonMatrix universe = OctagonMatrix.universe(dimension, integers);
+      OctagonMatrix incremental = universe;
+      OctagonMatrix full = universe;
+      for (int c = 0; c < 2 * dimension; c++) {
+        int type = random.nextInt(6);
+        int x = random.nextInt(dimension);
+        int y = random.nextInt(dimension);
+        double constant = random.nextInt(15) - 3;
+        incremental = incremental.addBinaryConstraint(type, x, y, constant);
+        // intersection uses the full closure
+        full = full.intersection(universe.addBinaryConstraint(type, x, y, constant));
+      }
+      assertThat(incremental.isEmpty()).isEqualTo(full.isEmpty());
+      assertThat(incremental.isEqualTo(full)).isTrue();
+    }
+  }
+
+  @Test
+  public void testJoinAndInclusion() {
+    OctagonMatrix universe = OctagonMatrix.universe(1, true);
+    OctagonMatrix m1 = interval(universe, 0, 0, 1);
+    OctagonMatrix m2 = interval(universe, 0, 3, 4);
+    OctagonMatrix join = m1.union(m2);
+    assertThat(join.getLowerBound(0)).isEqualTo(0);
+    assertThat(join.getUpperBound(0)).isEqualTo(4);
+    assertThat(m1.isIncludedIn(join)).isTrue();
+    assertThat(join.isIncludedIn(m1)).isFalse();
+    assertThat(OctagonMatrix.empty(1, true).isIncludedIn(m1)).isTrue();
+  }
+
+  @Test
+  public void testWidening() {
+    OctagonMatrix universe = OctagonMatrix.universe(1, true);
+    OctagonMatrix widened = interval(universe, 0, 0, 0).widening(interval(universe, 0, 0, 1));
+    assertThat(widened.getLowerBound(0)).isEqualTo(0);
+    assertThat(widened.getUpperBound(0)).isPositiveInfinity();
+  }
+
+  @Test
+  public void testChangeOfDimensions() {
+    OctagonMatrix m = interval(OctagonMatrix.universe(1, true), 0, 1, 2);
+    OctagonMatrix embedded = m.addDimensionsAndEmbed(2);
+    assertThat(embedded.getDimension()).isEqualTo(3);
+    assertThat(embedded.getUpperBound(0)).isEqualTo(2);
+    assertThat(embedded.getUpperBound(2)).isPositiveInfinity();
+    OctagonMatrix projected = m.addDimensionsAndProject(1);
+    assertThat(projected.getUpperBound(1)).isEqualTo(0);
+    assertThat(projected.getLowerBound(1)).isEqualTo(0);
+    assertThat(embedded.removeDimensions(2).isEqualTo(m)).isTrue();
+  }
+}
@@ -17,7 +17,6 @@ import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.ImmutableSetMultimap;
 import com.google.common.collect.Iterables;
 import com.google.common.collect.LinkedHashMultimap;
-import com.google.common.collect.Maps;
 import com.google.common.collect.Multimap;
 import com.google.common.collect.SetMultimap;
 import java.util.ArrayList;
@@ -120,6 +119,12 @@ public class AssignmentToPathAllocator {
     final Map<LeftHandSide, Object> variables = new LinkedHashMap<>();
     final SetMultimap<String, ValueAssignment> functionEnvironment = LinkedHashMultimap.create();
     final Map<String, Map<Address, Object>> memory = new LinkedHashMap<>();
+    final Map<String, Memory> memoryObjects = new LinkedHashMap<>();
+    final Set<String> changedHeaps = new HashSet<>();
+
+    // On long paths most edges do not change the assignment, so the concrete state (which copies
+    // all variables and the memory) is reused instead of being recreated for every edge.
+    ConcreteState concreteState = null;
 
     int ssaMapIndex = 0;
 
@@ -143,14 +148,19 @@ public class AssignmentToPathAllocator {
         isInsideMultiEdge = false;
       }
 
-      createAssignments(terms, variableEnvironment, variables, functionEnvironment, memory);
-      removeDeallocatedVariables(ssaMap, variableEnvironment, variables);
-      ImmutableMap<String, Memory> allocatedMemory =
-          ImmutableMap.copyOf(
-              Maps.transformEntries(memory, (name, heap) -> new Memory(name, heap)));
+      boolean changed =
+          createAssignments(
+              terms, variableEnvironment, variables, functionEnvironment, memory, changedHeaps);
+      changed |= removeDeallocatedVariables(ssaMap, variableEnvironment, variables);
 
-      ConcreteState concreteState =
-          new ConcreteState(variables, allocatedMemory, addressOfVariables, memoryName, evaluator);
+      if (changed || concreteState == null) {
+        for (String heapName : changedHeaps) {
+          memoryObjects.put(heapName, new Memory(heapName, memory.get(heapName)));
+        }
+        changedHeaps.clear();
+        concreteState =
+            new ConcreteState(variables, memoryObjects, addressOfVariables, memoryName, evaluator);
+      }
 
       final SingleConcreteState singleConcreteState;
       if (isInsideMultiEdge) {
@@ -398,22 +408,29 @@ public class AssignmentToPathAllocator {
     }
   }
 
-  private void removeDeallocatedVariables(
+  /** Remove variables that are out of scope, and return whether some variable was removed. */
+  private boolean removeDeallocatedVariables(
       SSAMap pMap,
       Map<String, ValueAssignment> variableEnvironment,
       Map<LeftHandSide, Object> variables) {
     variableEnvironment.keySet().removeIf(name -> pMap.getIndex(name) < 0);
-    variables.keySet().removeIf(lhs -> pMap.getIndex(lhs.toString()) < 0);
+    return variables.keySet().removeIf(lhs -> pMap.getIndex(lhs.toString()) < 0);
   }
 
-  /** We need the variableEnvironment and functionEnvironment for their SSAIndeces. */
-  private void createAssignments(
+  /**
+   * We need the variableEnvironment and functionEnvironment for their SSAIndeces. Return whether
+   * the values of variables or memory were changed, the names of changed heaps are added to
+   * pChangedHeaps.
+   */
+  private boolean createAssignments(
       ImmutableCollection<ValueAssignment> terms,
       Map<String, ValueAssignment> variableEnvironment,
       Map<LeftHandSide, Object> pVariables,
       Multimap<String, ValueAssignment> functionEnvironment,
-      Map<String, Map<Address, Object>> memory) {
+      Map<String, Map<Address, Object>> memory,
+      Set<String> pChangedHeaps) {
 
+    boolean changed = false;
     for (final ValueAssignment term : terms) {
       String fullName = term.getName();
       Pair<String, OptionalInt> pair = FormulaManagerView.parseName(fullName);
@@ -434,6 +451,7 @@ public class AssignmentToPathAllocator {
 
             LeftHandSide lhs = createLeftHandSide(canonicalName);
             pVariables.put(lhs, term.getValue());
+            changed = true;
           }
         } else {
           //update variableEnvironment for subsequent calculation
@@ -441,6 +459,7 @@ public class AssignmentToPathAllocator {
 
           LeftHandSide lhs = createLeftHandSide(canonicalName);
           pVariables.put(lhs, term.getValue());
+          changed = true;
         }
       }
 
@@ -459,23 +478,30 @@ public class AssignmentToPathAllocator {
               functionEnvironment.remove(name, oldAssignment);
               functionEnvironment.put(name, term);
               replaced = true;
-              addHeapValue(memory, term);
+              pChangedHeaps.add(addHeapValue(memory, term));
+              changed = true;
 
             }
           }
 
           if (!replaced) {
             functionEnvironment.put(name, term);
-            addHeapValue(memory, term);
+            pChangedHeaps.add(addHeapValue(memory, term));
+            changed = true;
           }
         } else {
           functionEnvironment.put(name, term);
-          addHeapValue(memory, term);
+          pChangedHeaps.add(addHeapValue(memory, term));
+          changed = true;
         }
       }
     }
+    return changed;
   }
-  private void addHeapValue(Map<String, Map<Address, Object>> memory, ValueAssignment pFunctionAssignment) {
+
+  /** Store the value of the given assignment in its heap and return the name of the heap. */
+  private String addHeapValue(
+      Map<String, Map<Address, Object>> memory, ValueAssignment pFunctionAssignment) {
     String heapName = getName(pFunctionAssignment);
 
     Map<Address, Object> heap = memory.get(heapName);
@@ -489,6 +515,7 @@ public class AssignmentToPathAllocator {
 
     Object value = pFunctionAssignment.getValue();
     heap.put(address, value);
+    return heapName;
   }
 
   private ImmutableMap<LeftHandSide, Address> getVariableAddresses(
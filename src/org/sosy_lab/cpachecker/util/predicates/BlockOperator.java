@@ -11,8 +11,14 @@ package org.sosy_lab.cpachecker.util.predicates;
 import static com.google.common.base.Preconditions.checkState;
 
 import com.google.common.collect.ImmutableSet;
+import java.util.concurrent.TimeUnit;
+import java.util.logging.Level;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.configuration.TimeSpanOption;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.common.time.TimeSpan;
 import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.cfa.model.BlankEdge;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
@@ -82,6 +88,37 @@ public class BlockOperator {
   @Option(secure=true, description="abstraction always at explicitly computed abstraction nodes.")
   private boolean alwaysAtExplicitNodes = false;
 
+  @Option(
+      secure = true,
+      description =
+          "adapt the threshold dynamically between 1 and 4 times its configured value,"
+              + " depending on the size of the block formulas and the time of the abstractions"
+              + " (no effect if threshold = 0)")
+  private boolean adaptiveThreshold = false;
+
+  @Option(
+      secure = true,
+      description =
+          "with adaptive threshold, lower the threshold if an abstraction takes longer than this,"
+              + " and raise it if abstractions are much faster")
+  @TimeSpanOption(
+      codeUnit = TimeUnit.MILLISECONDS,
+      defaultUserUnit = TimeUnit.MILLISECONDS,
+      min = 1)
+  private TimeSpan adaptiveTargetTime = TimeSpan.ofMillis(100);
+
+  @Option(
+      secure = true,
+      description =
+          "with adaptive threshold, lower the threshold if a block formula has more atoms than this"
+              + " (0 for no limit)")
+  @IntegerOption(min = 0)
+  private int adaptiveMaxAtoms = 0;
+
+  // the threshold that is currently used, differs from threshold only with adaptiveThreshold
+  private int currentThreshold = -1;
+  private LogManager logger = LogManager.createNullLogManager();
+
   private ImmutableSet<CFANode> explicitAbstractionNodes = null;
   private ImmutableSet<CFANode> loopHeads = null;
 
@@ -93,6 +130,7 @@ public class BlockOperator {
   public StatCounter numBlkBranch = new StatCounter("");
   public StatCounter numBlkThreshold = new StatCounter("");
   public StatCounter numBlkExit = new StatCounter("");
+  public StatCounter numThresholdChanges = new StatCounter("");
 
   /**
    * Check whether an abstraction should be computed.
@@ -229,7 +267,64 @@ public class BlockOperator {
   }
 
   protected boolean isThresholdFulfilled(int thresholdValue) {
-    return thresholdValue >= threshold;
+    return thresholdValue >= getCurrentThreshold();
+  }
+
+  public int getCurrentThreshold() {
+    return currentThreshold < 0 ? threshold : currentThreshold;
+  }
+
+  /**
+   * Inform this operator about an abstraction that was computed for a block, such that it can adapt
+   * the threshold if {@code blk.adaptiveThreshold} is enabled. The threshold is halved if the
+   * abstraction took longer than the target time or the block formula was too large, and increased
+   * by one if the abstraction took less than a quarter of the target time and the block formula
+   * was small. Changes are logged, thus a run can be reproduced with a fixed threshold.
+   *
+   * @param pBlockSize The length of the block (the value compared with the threshold).
+   * @param pAtoms The number of atoms in the block formula.
+   * @param pAbstractionTime The time the abstraction took.
+   */
+  public void reportAbstraction(int pBlockSize, int pAtoms, TimeSpan pAbstractionTime) {
+    if (!adaptiveThreshold || threshold <= 1) {
+      return;
+    }
+    int oldThreshold = getCurrentThreshold();
+    boolean tooLarge = adaptiveMaxAtoms > 0 && pAtoms > adaptiveMaxAtoms;
+    boolean small = adaptiveMaxAtoms == 0 || pAtoms <= adaptiveMaxAtoms / 4;
+    int newThreshold = oldThreshold;
+    if (tooLarge || pAbstractionTime.compareTo(adaptiveTargetTime) > 0) {
+      newThreshold = Math.max(1, oldThreshold / 2);
+    } else if (small
+        && pBlockSize >= oldThreshold
+        && pAbstractionTime.asNanos() * 4 < adaptiveTargetTime.asNanos()) {
+      newThreshold = Math.min(4 * threshold, oldThreshold + 1);
+    }
+    if (newThreshold != oldThreshold) {
+      currentThreshold = newThreshold;
+      numThresholdChanges.inc();
+      logger.log(
+          Level.FINE,
+          "Changing block threshold from",
+          oldThreshold,
+          "to",
+          newThreshold,
+          "after abstraction of block with size",
+          pBlockSize,
+          "and",
+          pAtoms,
+          "atoms in",
+          pAbstractionTime);
+    }
+  }
+
+  /** Whether {@link #reportAbstraction(int, int, TimeSpan)} needs to be called. */
+  public boolean isAdaptive() {
+    return adaptiveThreshold && threshold > 1;
+  }
+
+  public void setLogger(LogManager pLogger) {
+    logger = pLogger;
   }
 
   protected boolean isLoopHead(CFANode succLoc) {
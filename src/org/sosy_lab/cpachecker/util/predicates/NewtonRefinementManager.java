@@ -221,7 +221,7 @@ public class NewtonRefinementManager implements StatisticsProvider {
     assert isFeasible(pFormulas.getFormulas(), pPath) == isFeasible(pathFormulas, pPath);
 
     // Compute the unsatisfiable core if configured, else create empty Optional
-    Optional<List<BooleanFormula>> unsatCore;
+    Optional<Set<BooleanFormula>> unsatCore;
     if (infeasibleCore) {
       unsatCore = Optional.of(computeUnsatCore(pathFormulas, pPath));
     } else {
@@ -247,7 +247,7 @@ public class NewtonRefinementManager implements StatisticsProvider {
   private List<BooleanFormula> createPredicatesBlockLevel(
       ARGPath pPath, BlockFormulas pFormulas, List<PathLocation> pPathLocations)
       throws InterruptedException, RefinementFailedException {
-    List<BooleanFormula> unsatCore = computeUnsatCore(pFormulas.getFormulas(), pPath);
+    Set<BooleanFormula> unsatCore = computeUnsatCore(pFormulas.getFormulas(), pPath);
     List<BooleanFormula> predicates = new ArrayList<>();
 
     // Filter pathlocations to only abstractionstate locations
@@ -277,7 +277,7 @@ public class NewtonRefinementManager implements StatisticsProvider {
    * Calculates the StrongestPostCondition at all states on a error-trace.
    *
    * @param pPathLocations A list with the necessary information to all path locations
-   * @param pUnsatCore An optional holding the unsatisfiable core in the form of a list of Formulas.
+   * @param pUnsatCore An optional holding the unsatisfiable core in the form of a set of Formulas.
    *     If no list of formulas is applied it computes the regular postCondition
    * @return A list of Formulas, each Formula represents an assertion at the corresponding
    *     abstraction state, the last formula should be unsatisfiable(representing Error state)
@@ -285,7 +285,7 @@ public class NewtonRefinementManager implements StatisticsProvider {
    * @throws RefinementFailedException In case an exception in the solver.
    */
   private List<BooleanFormula> calculateStrongestPostCondition(
-      List<PathLocation> pPathLocations, Optional<List<BooleanFormula>> pUnsatCore)
+      List<PathLocation> pPathLocations, Optional<Set<BooleanFormula>> pUnsatCore)
       throws InterruptedException, RefinementFailedException {
     logger.log(Level.FINE, "Calculate Strongest Postcondition for the error trace.");
     stats.postConditionTimer.start();
@@ -476,7 +476,8 @@ public class NewtonRefinementManager implements StatisticsProvider {
   }
 
   /**
-   * Compute the Unsatisfiable core as a list of BooleanFormulas
+   * Compute the Unsatisfiable core as a set of BooleanFormulas, such that checking whether a
+   * formula is part of the core for each location of long paths does not take quadratic time.
    *
    * @param pFormulas The List of Formulas to compute the unsatisfiable core for
    * @param pPath The path to the Error(Needed for RefinementFailedException)
@@ -484,7 +485,7 @@ public class NewtonRefinementManager implements StatisticsProvider {
    * @throws RefinementFailedException If the solver fails while calculating unsatisfiable core
    * @throws InterruptedException If the Execution is interrupted
    */
-  private List<BooleanFormula> computeUnsatCore(List<BooleanFormula> pFormulas, ARGPath pPath)
+  private Set<BooleanFormula> computeUnsatCore(List<BooleanFormula> pFormulas, ARGPath pPath)
       throws RefinementFailedException, InterruptedException {
     stats.unsatCoreTimer.start();
     try {
@@ -498,7 +499,7 @@ public class NewtonRefinementManager implements StatisticsProvider {
         throw new RefinementFailedException(Reason.NewtonRefinementFailed, pPath, e);
       }
       logger.log(Level.FINEST, "Unsatisfiable Core is: ", unsatCore);
-      return ImmutableList.copyOf(unsatCore);
+      return ImmutableSet.copyOf(unsatCore);
     } finally {
       stats.unsatCoreTimer.stop();
     }
@@ -11,6 +11,9 @@ package org.sosy_lab.cpachecker.util.predicates;
 import static com.google.common.collect.FluentIterable.from;
 
 import com.google.common.base.Preconditions;
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
+import com.google.common.cache.CacheStats;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableSet;
 import com.google.common.collect.Sets;
@@ -18,14 +21,13 @@ import com.google.common.math.LongMath;
 import java.io.PrintStream;
 import java.util.ArrayList;
 import java.util.Collection;
-import java.util.HashMap;
 import java.util.List;
-import java.util.Map;
 import java.util.Optional;
 import java.util.Set;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicBoolean;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -72,6 +74,14 @@ public class RCNFManager implements StatisticsProvider {
       + "expanded into 'x >= a AND x <= a'. Can lead to stronger weakenings.")
   private boolean expandEquality = false;
 
+  @Option(
+      secure = true,
+      description =
+          "Maximal number of formulas whose conversion result is cached. Value 0 means that the"
+              + " size of the cache is not bounded.")
+  @IntegerOption(min = 0)
+  private int conversionCacheSize = 100000;
+
   public enum BOUND_VARS_HANDLING {
 
     /**
@@ -94,13 +104,17 @@ public class RCNFManager implements StatisticsProvider {
   private FormulaManagerView fmgr = null;
   private BooleanFormulaManager bfmgr = null;
   private final RCNFConversionStatistics statistics;
-  private final Map<BooleanFormula, ImmutableSet<BooleanFormula>> conversionCache;
+  private final Cache<BooleanFormula, ImmutableSet<BooleanFormula>> conversionCache;
 
   public RCNFManager(Configuration options)
       throws InvalidConfigurationException{
     options.inject(this);
-    statistics = new RCNFConversionStatistics();
-    conversionCache = new HashMap<>();
+    CacheBuilder<Object, Object> cacheBuilder = CacheBuilder.newBuilder().recordStats();
+    if (conversionCacheSize > 0) {
+      cacheBuilder.maximumSize(conversionCacheSize);
+    }
+    conversionCache = cacheBuilder.build();
+    statistics = new RCNFConversionStatistics(conversionCache);
   }
 
   /**
@@ -132,9 +146,22 @@ public class RCNFManager implements StatisticsProvider {
     fmgr = pFmgr;
     bfmgr = pFmgr.getBooleanFormulaManager();
 
-    ImmutableSet<BooleanFormula> out = conversionCache.get(input);
+    ImmutableSet<BooleanFormula> out = conversionCache.getIfPresent(input);
     if (out != null) {
-      statistics.conversionCacheHits++;
+      return out;
+    }
+
+    // A quantifier-free conjunction is converted by converting its conjuncts, such that
+    // conjunctions that share conjuncts with previously converted formulas reuse their results.
+    Set<BooleanFormula> conjuncts = bfmgr.toConjunctionArgs(input, false);
+    if (conjuncts.size() > 1 && !fmgr.visit(input, quantifiedBodyExtractor).isPresent()) {
+      ImmutableSet.Builder<BooleanFormula> lemmas = ImmutableSet.builder();
+      for (BooleanFormula conjunct : conjuncts) {
+        lemmas.addAll(toLemmas(conjunct, pFmgr));
+      }
+      statistics.incrementalConversions++;
+      out = lemmas.build();
+      conversionCache.put(input, out);
       return out;
     }
 
@@ -371,7 +398,12 @@ public class RCNFManager implements StatisticsProvider {
     Timer lightQuantifierElimination = new Timer();
     Timer quantifierElimination = new Timer();
     Timer conversion = new Timer();
-    int conversionCacheHits = 0;
+    int incrementalConversions = 0;
+    private final Cache<?, ?> conversionCache;
+
+    private RCNFConversionStatistics(Cache<?, ?> pConversionCache) {
+      conversionCache = pConversionCache;
+    }
 
     @Override
     public void printStatistics(PrintStream out, Result result, UnmodifiableReachedSet reached) {
@@ -380,6 +412,15 @@ public class RCNFManager implements StatisticsProvider {
           + "elimination");
       printTimer(out, quantifierElimination, "quantifier elimination");
 
+      CacheStats cacheStats = conversionCache.stats();
+      out.printf(
+          "Conversion cache: %d lookups, %d hits, %d evictions, %d entries%n",
+          cacheStats.requestCount(),
+          cacheStats.hitCount(),
+          cacheStats.evictionCount(),
+          conversionCache.size());
+      out.printf(
+          "Conjunctions converted from their conjuncts: %d%n", incrementalConversions);
     }
 
     @Override
@@ -395,7 +436,7 @@ public class RCNFManager implements StatisticsProvider {
           t.getMaxTime().formatAs(TimeUnit.SECONDS),
           t.getAvgTime().formatAs(TimeUnit.SECONDS),
           t.getNumberOfIntervals(),
-          conversionCacheHits);
+          conversionCache.stats().hitCount());
     }
   }
 
@@ -112,6 +112,18 @@ public class RCNFManagerTest extends SolverViewBasedTest0 {
             bfmgr.or(v("c"), v("f")));
   }
 
+  @Test
+  public void testConjunctionFromConjuncts() throws Exception {
+    BooleanFormula disjunction = bfmgr.or(bfmgr.and(v("a"), v("b")), bfmgr.and(v("a"), v("c")));
+    Set<BooleanFormula> disjunctionLemmas = rcnfManager.toLemmas(disjunction, mgrv);
+
+    BooleanFormula input = bfmgr.and(disjunction, v("d"));
+    Set<BooleanFormula> lemmas = rcnfManager.toLemmas(input, mgrv);
+    assertThatFormula(bfmgr.and(lemmas)).isEquivalentTo(input);
+    Truth.assertThat(lemmas).containsAtLeastElementsIn(disjunctionLemmas);
+    Truth.assertThat(lemmas).containsExactly(v("a"), bfmgr.or(v("b"), v("c")), v("d"));
+  }
+
   private BooleanFormula v(String name) {
     return bfmgr.makeVariable(name);
   }
@@ -13,8 +13,10 @@ import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import java.util.ArrayList;
 import java.util.Collections;
+import java.util.HashMap;
 import java.util.HashSet;
 import java.util.List;
+import java.util.Map;
 import java.util.Set;
 import java.util.logging.Level;
 import org.sosy_lab.common.log.LogManager;
@@ -138,23 +140,34 @@ public class UCBRefinementManager {
     CFANode dstNode = AbstractStates.extractLocation(dst);
 
     if (srcNode != null && dstNode != null) {
-      return computeWeakestPrecondition(srcNode, dstNode, postCondition, ImmutableSet.of());
+      return computeWeakestPrecondition(
+          srcNode, dstNode, postCondition, ImmutableSet.of(), new HashMap<>());
     }
 
     return bfmgr.makeFalse();
   }
 
 
+  /**
+   * Compute the weakest precondition of all paths from src to dst that do not visit a node twice.
+   *
+   * @param completeWps the weakest preconditions of nodes whose paths to dst did not need to
+   *     be cut because they visit a node twice. They do not depend on the visited nodes and can be
+   *     reused for all paths that reach the node again, which avoids enumerating exponentially many
+   *     paths through blocks with many branches.
+   */
   private BooleanFormula computeWeakestPrecondition(final CFANode src,
                                                     final CFANode dst,
                                                     final BooleanFormula postCondition,
-                                                    final Set<CFANode> visitedNodes)
+                                                    final Set<CFANode> visitedNodes,
+                                                    final Map<CFANode, BooleanFormula> completeWps)
       throws CPAException, InterruptedException {
 
     Set<CFANode> visited = new HashSet<>(visitedNodes);
     visited.add(src);
 
     BooleanFormula res = bfmgr.makeFalse();
+    boolean complete = true;
 
     for(int i = 0; i < src.getNumLeavingEdges(); i++) {
       CFAEdge edge = src.getLeavingEdge(i);
@@ -165,8 +178,13 @@ public class UCBRefinementManager {
 
       if(next.equals(dst)) {
         post = postCondition;
+      } else if (completeWps.containsKey(next)) {
+        post = completeWps.get(next);
       } else if (!visited.contains(next)) {
-        post = computeWeakestPrecondition(next, dst, postCondition, visited);
+        post = computeWeakestPrecondition(next, dst, postCondition, visited, completeWps);
+        complete &= completeWps.containsKey(next);
+      } else {
+        complete = false;
       }
 
       if(!bfmgr.isFalse(post)) {
@@ -180,6 +198,9 @@ public class UCBRefinementManager {
       }
     }
 
+    if (complete) {
+      completeWps.put(src, res);
+    }
     return res;
   }
 
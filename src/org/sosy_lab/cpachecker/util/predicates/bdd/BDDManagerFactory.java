@@ -8,6 +8,7 @@
 
 package org.sosy_lab.cpachecker.util.predicates.bdd;
 
+import java.util.logging.Level;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
@@ -46,6 +47,14 @@ public class BDDManagerFactory {
   @Option(secure = true, description = "sequentialize all accesses to the BDD library.")
   private boolean synchronizeLibraryAccess = false;
 
+  @Option(
+      secure = true,
+      description =
+          "Do not sequentialize accesses to BDD libraries that support concurrent accesses"
+              + " (Sylvan, PJBDD), even if synchronizeLibraryAccess is set. "
+              + "This allows concurrent analyses to use the parallelism of these libraries.")
+  private boolean allowConcurrentLibraryAccess = false;
+
   @Option(
       secure = true,
       description =
@@ -85,7 +94,12 @@ public class BDDManagerFactory {
       rmgr = new CountingRegionManager(rmgr);
     }
     if (synchronizeLibraryAccess) {
-      rmgr = new SynchronizedRegionManager(rmgr);
+      if (allowConcurrentLibraryAccess && rmgr.isThreadSafe()) {
+        logger.log(
+            Level.FINE, "Accessing thread-safe BDD library", rmgr.getVersion(), "concurrently.");
+      } else {
+        rmgr = new SynchronizedRegionManager(rmgr);
+      }
     }
     return rmgr;
   }
@@ -71,6 +71,11 @@ class JavaBDDRegionManager implements RegionManager {
   // Statistics
   private final StatInt cleanupQueueSize = new StatInt(StatKind.AVG, "Size of BDD node cleanup queue");
   private final StatTimer cleanupTimer = new StatTimer("Time for BDD node cleanup");
+  private final StatTimer reorderTimer = new StatTimer("Time for dynamic BDD reordering");
+  private final StatInt nodesBeforeReordering =
+      new StatInt(StatKind.AVG, "Number of BDD nodes before dynamic reordering");
+  private final StatInt nodesAfterReordering =
+      new StatInt(StatKind.AVG, "Number of BDD nodes after dynamic reordering");
   private final LogManager logger;
   private final BDDFactory factory;
   private final Region trueFormula;
@@ -96,6 +101,24 @@ class JavaBDDRegionManager implements RegionManager {
   @Option(secure = true,
       description = "Size of the BDD cache in relation to the node table size (set to 0 to use fixed BDD cache size).")
   private double cacheRatio = 0.1;
+
+  @Option(
+      secure = true,
+      description =
+          "Framework strategy for reordering the BDD variables dynamically whenever the number"
+              + " of BDD nodes exceeds reorderingThreshold, e.g., FRAMEWORK_SIFT"
+              + " (DISABLE for no dynamic reordering).")
+  private PredicateOrderingStrategy dynamicReordering = PredicateOrderingStrategy.DISABLE;
+
+  @Option(
+      secure = true,
+      description =
+          "Number of BDD nodes above which the BDD variables are reordered dynamically. After a"
+              + " reordering, the threshold is raised to twice the number of remaining nodes if"
+              + " necessary, such that reorderings do not repeat too often.")
+  @IntegerOption(min = 1)
+  private int reorderingThreshold = 1000000;
+
   private int nextvar = 0;
   private int varcount = 100;
 
@@ -122,6 +145,11 @@ class JavaBDDRegionManager implements RegionManager {
     if (cacheSize == 0) {
       cacheSize = (int)(initTableSize * cacheRatio);
     }
+    if (dynamicReordering != PredicateOrderingStrategy.DISABLE
+        && !dynamicReordering.getIsFrameworkStrategy()) {
+      throw new InvalidConfigurationException("Invalid value " + dynamicReordering
+          + " for option bdd.javabdd.dynamicReordering, needs to be a framework strategy.");
+    }
     factory =
         BDDFactory.init(bddPackage.toLowerCase(), initTableSize, cacheSize);
 
@@ -217,6 +245,9 @@ class JavaBDDRegionManager implements RegionManager {
           .putIf(currentCacheSize >= 0, "Size of BDD cache", currentCacheSize)
           .put(cleanupQueueSize)
           .put(cleanupTimer)
+          .putIfUpdatedAtLeastOnce(reorderTimer)
+          .putIfUpdatedAtLeastOnce(nodesBeforeReordering)
+          .putIfUpdatedAtLeastOnce(nodesAfterReordering)
           .put(
               "Time for BDD garbage collection",
               TimeSpan.ofMillis(stats.sumtime).formatAs(SECONDS)
@@ -305,6 +336,44 @@ class JavaBDDRegionManager implements RegionManager {
     } finally {
       cleanupTimer.stop();
     }
+    reorderIfNecessary();
+  }
+
+  /**
+   * Reorder the BDD variables if dynamic reordering is enabled and the number of BDD nodes exceeds
+   * the threshold. This is only called at the beginning of operations, when all BDDs in use are
+   * referenced from outside of the library and thus stay valid.
+   */
+  private void reorderIfNecessary() {
+    if (dynamicReordering == PredicateOrderingStrategy.DISABLE) {
+      return;
+    }
+    try {
+      int nodes = factory.getNodeNum();
+      if (nodes <= reorderingThreshold) {
+        return;
+      }
+      reorderTimer.start();
+      try {
+        reorder(dynamicReordering);
+      } finally {
+        reorderTimer.stop();
+      }
+      int remainingNodes = factory.getNodeNum();
+      nodesBeforeReordering.setNextValue(nodes);
+      nodesAfterReordering.setNextValue(remainingNodes);
+      logger.log(LOG_LEVEL, "Dynamic BDD reordering reduced", nodes, "nodes to", remainingNodes);
+      if (remainingNodes > reorderingThreshold / 2) {
+        reorderingThreshold = remainingNodes > Integer.MAX_VALUE / 2
+            ? Integer.MAX_VALUE
+            : 2 * remainingNodes;
+      }
+    } catch (UnsupportedOperationException e) {
+      logger.logDebugException(e);
+      logger.log(Level.WARNING, "BDD package", factory.getVersion(),
+          "does not support dynamic reordering, disabling it.");
+      dynamicReordering = PredicateOrderingStrategy.DISABLE;
+    }
   }
 
   /**
@@ -11,6 +11,7 @@ package org.sosy_lab.cpachecker.util.predicates.bdd;
 import static com.google.common.base.Preconditions.checkState;
 import static org.sosy_lab.cpachecker.util.predicates.bdd.PJBDDRegion.unwrap;
 import static org.sosy_lab.cpachecker.util.predicates.bdd.PJBDDRegion.wrap;
+import static org.sosy_lab.cpachecker.util.statistics.StatisticsWriter.writingStatisticsTo;
 
 import com.google.common.base.Preconditions;
 import com.google.common.primitives.ImmutableIntArray;
@@ -19,6 +20,7 @@ import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.Function;
 import java.util.stream.IntStream;
 import org.sosy_lab.common.ShutdownNotifier;
@@ -52,6 +54,7 @@ public class PJBDDRegionManager implements RegionManager {
   private final Region trueFormula;
   private final Region falseFormula;
   private final Creator<BDD> bddCreator;
+  private final AtomicInteger numberOfVariables = new AtomicInteger(0);
 
   public PJBDDRegionManager(Configuration pConfig) throws InvalidConfigurationException {
     BuildFromConfig buildFromConfig = new BuildFromConfig(pConfig);
@@ -67,6 +70,7 @@ public class PJBDDRegionManager implements RegionManager {
 
   @Override
   public Region createPredicate() {
+    numberOfVariables.incrementAndGet();
     return wrap(bddCreator.makeVariable());
   }
 
@@ -94,7 +98,7 @@ public class PJBDDRegionManager implements RegionManager {
 
   @Override
   public void printStatistics(PrintStream out) {
-    out.println("Stats to be printed");
+    writingStatisticsTo(out).put("Number of BDD variables", numberOfVariables.get());
     // TODO    out.print(bddCreator.getCreatorStats().prettyPrint());
   }
 
@@ -103,6 +107,12 @@ public class PJBDDRegionManager implements RegionManager {
     return bddCreator.getVersion();
   }
 
+  /** The creators of PJBDD are designed for concurrent use. */
+  @Override
+  public boolean isThreadSafe() {
+    return true;
+  }
+
   @Override
   public void setVarOrder(ImmutableIntArray pOrder) {
     throw new UnsupportedOperationException(
@@ -29,6 +29,7 @@ import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.Function;
 import java.util.logging.Level;
 import jsylvan.JSylvan;
@@ -94,7 +95,7 @@ class SylvanBDDRegionManager implements RegionManager {
   @Option(secure = true, description = "Number of worker threads, 0 for automatic.")
   @IntegerOption(min = 0)
   private int threads = 0;
-  private int nextvar = 0;
+  private final AtomicInteger nextvar = new AtomicInteger(0);
 
   public SylvanBDDRegionManager(Configuration config, LogManager pLogger)
       throws InvalidConfigurationException {
@@ -179,7 +180,9 @@ class SylvanBDDRegionManager implements RegionManager {
   @Override
   public void printStatistics(PrintStream out) {
     synchronized (cleanupTimer) {
-      writingStatisticsTo(out).putIf(cleanupTimer.getUpdateCount() > 0,
+      writingStatisticsTo(out)
+          .put("Number of BDD variables", nextvar.get())
+          .putIf(cleanupTimer.getUpdateCount() > 0,
           "Number of BDD freed by GC", cleanupTimer.getUpdateCount())
           .putIfUpdatedAtLeastOnce(cleanupTimer);
     }
@@ -187,7 +190,7 @@ class SylvanBDDRegionManager implements RegionManager {
 
   @Override
   public SylvanBDDRegion createPredicate() {
-    return wrap(JSylvan.makeVar(nextvar++));
+    return wrap(JSylvan.makeVar(nextvar.getAndIncrement()));
   }
 
   /**
@@ -276,12 +279,16 @@ class SylvanBDDRegionManager implements RegionManager {
       return pF1;
     }
 
-    long tmp = unwrap(pF2[0]);
+    // intermediate results are ref'ed, such that a garbage collection
+    // triggered by a concurrent operation does not free them
+    long cube = ref(unwrap(pF2[0]));
     for (int i = 1; i < pF2.length; i++) {
-      tmp = JSylvan.makeAnd(tmp, unwrap(pF2[i]));
+      long tmp = ref(JSylvan.makeAnd(cube, unwrap(pF2[i])));
+      deref(cube);
+      cube = tmp;
     }
-    Region result = wrap(JSylvan.makeExists(unwrap(pF1), tmp));
-    // TODO: is there a way/necessity to free 'tmp'? deref(...) fails.
+    Region result = wrap(JSylvan.makeExists(unwrap(pF1), cube));
+    deref(cube);
 
     return result;
   }
@@ -301,13 +308,21 @@ class SylvanBDDRegionManager implements RegionManager {
   @Override
   public Region replace(Region pRegion, Region[] pOldPredicates, Region[] pNewPredicates) {
     Preconditions.checkArgument(pOldPredicates.length == pNewPredicates.length);
-    long bdd = unwrap(pRegion);
+    long bdd = ref(unwrap(pRegion));
     for (int i = 0; i < pOldPredicates.length; i++) {
       long oldVar = JSylvan.getVar(unwrap(pOldPredicates[i]));
       long newVar = JSylvan.getVar(unwrap(pNewPredicates[i]));
-      bdd = JSylvan.makeExists(JSylvan.makeAnd(bdd, JSylvan.makeEquals(oldVar, newVar)), oldVar);
+      long equality = ref(JSylvan.makeEquals(oldVar, newVar));
+      long conjunction = ref(JSylvan.makeAnd(bdd, equality));
+      long result = ref(JSylvan.makeExists(conjunction, oldVar));
+      deref(equality);
+      deref(conjunction);
+      deref(bdd);
+      bdd = result;
     }
-    return wrap(bdd);
+    Region result = wrap(bdd);
+    deref(bdd);
+    return result;
   }
 
   @Override
@@ -334,6 +349,15 @@ class SylvanBDDRegionManager implements RegionManager {
     return String.format("Sylvan (%d threads)", threads);
   }
 
+  /**
+   * Sylvan synchronizes its operations internally, and all BDDs that are not wrapped in a region
+   * are ref'ed while we use them, so they survive garbage collections triggered by other threads.
+   */
+  @Override
+  public boolean isThreadSafe() {
+    return true;
+  }
+
   private class SylvanBDDRegionBuilder implements RegionBuilder {
 
     // Invariants:
@@ -22,6 +22,7 @@ import com.google.common.collect.Lists;
 import com.google.common.primitives.ImmutableIntArray;
 import com.google.common.primitives.Ints;
 import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
 import java.nio.file.Path;
 import java.util.ArrayList;
 import java.util.Arrays;
@@ -30,7 +31,10 @@ import java.util.List;
 import java.util.ListIterator;
 import java.util.Optional;
 import java.util.concurrent.Callable;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.CompletionService;
 import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorCompletionService;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.Future;
@@ -38,7 +42,9 @@ import java.util.concurrent.TimeUnit;
 import java.util.concurrent.TimeoutException;
 import java.util.logging.Level;
 import java.util.stream.IntStream;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.Classes.UnexpectedCheckedException;
+import org.sosy_lab.common.ShutdownManager;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -198,9 +204,21 @@ public final class InterpolationManager {
               + " options instead of giving up immediately.")
   private boolean tryAgainOnInterpolationError = true;
 
+  @Option(
+      secure = true,
+      name = "parallel.directions",
+      description =
+          "Analyze each counterexample with several values of cexTraceCheckDirection in parallel,"
+              + " each one with a separate solver instance, and use the interpolants of the first"
+              + " analysis that finishes. The list defines the directions that are tried"
+              + " (empty list disables parallel counterexample analysis).")
+  private List<CexTraceAnalysisDirection> parallelDirections = ImmutableList.of();
+
   private final ITPStrategy itpStrategy;
 
   private final ExecutorService executor;
+  private final @Nullable ExecutorService parallelExecutor;
+  private final List<Configuration> parallelConfigs;
   private final LoopStructure loopStructure;
   private final VariableClassification variableClassification;
 
@@ -231,6 +249,33 @@ public final class InterpolationManager {
           Executors.newSingleThreadExecutor(new ThreadFactoryBuilder().setDaemon(true).build());
     }
 
+    if (parallelDirections.isEmpty()) {
+      parallelExecutor = null;
+      parallelConfigs = ImmutableList.of();
+    } else {
+      ImmutableList.Builder<Configuration> configs = ImmutableList.builder();
+      for (CexTraceAnalysisDirection parallelDirection : parallelDirections) {
+        configs.add(
+            Configuration.builder()
+                .copyFrom(config)
+                .setOption(
+                    "cpa.predicate.refinement.cexTraceCheckDirection", parallelDirection.name())
+                .setOption("cpa.predicate.refinement.parallel.directions", "")
+                .setOption("cpa.predicate.refinement.reuseInterpolationEnvironment", "false")
+                // the time limit is enforced for the whole race by this instance
+                .setOption("cpa.predicate.refinement.timelimit", "0")
+                .build());
+      }
+      parallelConfigs = configs.build();
+      parallelExecutor =
+          Executors.newFixedThreadPool(
+              parallelDirections.size(),
+              new ThreadFactoryBuilder()
+                  .setDaemon(true)
+                  .setNameFormat("parallel-interpolation-%d")
+                  .build());
+    }
+
     if (reuseInterpolationEnvironment) {
       interpolator = new Interpolator<>();
     } else {
@@ -327,32 +372,146 @@ public final class InterpolationManager {
     try {
       final BlockFormulas f = prepareCounterexampleFormulas(pFormulas);
 
-      final Interpolator<?> currentInterpolator;
-      if (reuseInterpolationEnvironment) {
-        currentInterpolator = checkNotNull(interpolator);
-      } else {
-        currentInterpolator = new Interpolator<>();
+      if (parallelExecutor != null) {
+        CounterexampleTraceInfo result = analyzeInParallel(f, pAbstractionStates);
+        if (result != null) {
+          return result;
+        }
       }
 
+      return interpolate(f, pAbstractionStates);
+
+    } finally {
+      cexAnalysisTimer.stop();
+    }
+  }
+
+  /** Analyze the prepared formulas of a counterexample and compute interpolants if infeasible. */
+  private CounterexampleTraceInfo interpolate(
+      final BlockFormulas f, final List<AbstractState> pAbstractionStates)
+      throws CPAException, InterruptedException {
+    final Interpolator<?> currentInterpolator;
+    if (reuseInterpolationEnvironment) {
+      currentInterpolator = checkNotNull(interpolator);
+    } else {
+      currentInterpolator = new Interpolator<>();
+    }
+
+    try {
       try {
+        return currentInterpolator.buildCounterexampleTrace(f, pAbstractionStates);
+      } finally {
+        if (!reuseInterpolationEnvironment) {
+          currentInterpolator.close();
+        }
+      }
+    } catch (SolverException itpException) {
+      logger.logUserException(
+          Level.FINEST,
+          itpException,
+          "Interpolation failed, attempting to solve without interpolation");
+      return fallbackWithoutInterpolation(f, itpException);
+    }
+  }
+
+  /**
+   * Analyze the prepared formulas of a counterexample with all directions from {@link
+   * #parallelDirections} in parallel, each one with its own solver instance. The first analysis
+   * that finishes determines the result, all others are cancelled.
+   *
+   * @return The result with interpolants translated into our solver context if the counterexample
+   *     is infeasible, or null if it is feasible or no analysis succeeded (the caller then needs to
+   *     analyze the counterexample itself, e.g., in order to get a model in our context).
+   */
+  private @Nullable CounterexampleTraceInfo analyzeInParallel(
+      final BlockFormulas f, final List<AbstractState> pAbstractionStates)
+      throws CPAException, InterruptedException {
+    assert parallelExecutor != null;
+    List<ShutdownManager> shutdownManagers = new ArrayList<>(parallelConfigs.size());
+    List<Solver> solvers = new ArrayList<>(parallelConfigs.size());
+    List<Future<Pair<CounterexampleTraceInfo, Solver>>> futures =
+        new ArrayList<>(parallelConfigs.size());
+    CompletionService<Pair<CounterexampleTraceInfo, Solver>> completionService =
+        new ExecutorCompletionService<>(parallelExecutor);
+
+    try {
+      for (Configuration parallelConfig : parallelConfigs) {
+        ShutdownManager shutdownManager = ShutdownManager.createWithParent(shutdownNotifier);
+        shutdownManagers.add(shutdownManager);
+        Solver parallelSolver =
+            Solver.create(parallelConfig, logger, shutdownManager.getNotifier());
+        solvers.add(parallelSolver);
+        InterpolationManager parallelManager =
+            new InterpolationManager(
+                pmgr,
+                parallelSolver,
+                Optional.ofNullable(loopStructure),
+                Optional.ofNullable(variableClassification),
+                parallelConfig,
+                shutdownManager.getNotifier(),
+                logger);
+
+        // translate on this thread, our solver context must not be used by the other threads
+        FormulaManagerView parallelFmgr = parallelSolver.getFormulaManager();
+        List<BooleanFormula> formulas =
+            Lists.transform(f.getFormulas(), formula -> parallelFmgr.translateFrom(formula, fmgr));
+        BlockFormulas translated =
+            f.hasBranchingFormula()
+                ? new BlockFormulas(
+                    ImmutableList.copyOf(formulas),
+                    parallelFmgr.translateFrom(f.getBranchingFormula(), fmgr))
+                : new BlockFormulas(ImmutableList.copyOf(formulas));
+
+        futures.add(
+            completionService.submit(
+                () ->
+                    Pair.of(
+                        parallelManager.interpolate(translated, pAbstractionStates),
+                        parallelSolver)));
+      }
+
+      for (int i = 0; i < futures.size(); i++) {
+        Pair<CounterexampleTraceInfo, Solver> result;
         try {
-          return currentInterpolator.buildCounterexampleTrace(
-              f, pAbstractionStates);
-        } finally {
-          if (!reuseInterpolationEnvironment) {
-            currentInterpolator.close();
+          result = completionService.take().get();
+        } catch (ExecutionException e) {
+          Throwable t = e.getCause();
+          if (t instanceof InterruptedException) {
+            shutdownNotifier.shutdownIfNecessary();
           }
+          Throwables.throwIfUnchecked(t);
+          logger.logDebugException(t, "Parallel counterexample analysis failed");
+          continue;
+        }
+
+        CounterexampleTraceInfo info = result.getFirst();
+        if (!info.isSpurious()) {
+          return null;
         }
-      } catch (SolverException itpException) {
-        logger.logUserException(
-            Level.FINEST,
-            itpException,
-            "Interpolation failed, attempting to solve without interpolation");
-        return fallbackWithoutInterpolation(f, itpException);
+        FormulaManagerView parallelFmgr = result.getSecond().getFormulaManager();
+        return CounterexampleTraceInfo.infeasible(
+            Lists.transform(info.getInterpolants(), itp -> fmgr.translateFrom(itp, parallelFmgr)));
       }
+      return null;
+
+    } catch (InvalidConfigurationException e) {
+      // the configurations were already checked in the constructor
+      throw new AssertionError(e);
 
     } finally {
-      cexAnalysisTimer.stop();
+      for (ShutdownManager shutdownManager : shutdownManagers) {
+        shutdownManager.requestShutdown("parallel counterexample analysis finished");
+      }
+      for (Future<?> future : futures) {
+        try {
+          Uninterruptibles.getUninterruptibly(future);
+        } catch (ExecutionException | CancellationException e) {
+          // ignore, only the first result is relevant
+        }
+      }
+      for (Solver parallelSolver : solvers) {
+        parallelSolver.close();
+      }
     }
   }
 
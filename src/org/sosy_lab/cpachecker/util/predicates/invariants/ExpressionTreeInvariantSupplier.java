@@ -34,6 +34,7 @@ public class ExpressionTreeInvariantSupplier implements ExpressionTreeSupplier {
   private final CFA cfa;
 
   private Set<UnmodifiableReachedSet> lastUsedReachedSets = ImmutableSet.of();
+  private long lastUsedVersion = -1;
   private ExpressionTreeSupplier lastInvariantSupplier = TrivialInvariantSupplier.INSTANCE;
 
   private final Map<UnmodifiableReachedSet, ExpressionTreeSupplier> singleInvariantSuppliers =
@@ -51,6 +52,11 @@ public class ExpressionTreeInvariantSupplier implements ExpressionTreeSupplier {
   }
 
   public void updateInvariants() {
+    long version = aggregatedReached.getVersion();
+    if (version == lastUsedVersion) {
+      return;
+    }
+    lastUsedVersion = version;
     Set<UnmodifiableReachedSet> newReached = aggregatedReached.snapShot();
     if (!newReached.equals(lastUsedReachedSets)) {
       // if we have a former aggregated supplier we do only replace the changed parts
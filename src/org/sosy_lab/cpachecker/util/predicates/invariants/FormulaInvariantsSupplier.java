@@ -48,6 +48,7 @@ public class FormulaInvariantsSupplier implements InvariantSupplier {
   private final AggregatedReachedSets aggregatedReached;
 
   private Set<UnmodifiableReachedSet> lastUsedReachedSets = ImmutableSet.of();
+  private long lastUsedVersion = -1;
   private InvariantSupplier lastInvariantSupplier = TrivialInvariantSupplier.INSTANCE;
 
   private final Map<UnmodifiableReachedSet, ReachedSetBasedFormulaSupplier>
@@ -66,10 +67,24 @@ public class FormulaInvariantsSupplier implements InvariantSupplier {
       PathFormulaManager pPfmgr,
       @Nullable PathFormula pContext)
       throws InterruptedException {
-    return lastInvariantSupplier.getInvariantFor(pNode, pCallstackInfo, pFmgr, pPfmgr, pContext);
+    BooleanFormula invariant =
+        lastInvariantSupplier.getInvariantFor(pNode, pCallstackInfo, pFmgr, pPfmgr, pContext);
+    // invariants that were published by other analyses while they are running
+    return pFmgr
+        .getBooleanFormulaManager()
+        .and(
+            invariant,
+            aggregatedReached
+                .getSharedInvariants()
+                .getInvariantFor(pNode, pCallstackInfo, pFmgr, pPfmgr, pContext));
   }
 
   public void updateInvariants() {
+    long version = aggregatedReached.getVersion();
+    if (version == lastUsedVersion) {
+      return;
+    }
+    lastUsedVersion = version;
     Set<UnmodifiableReachedSet> tmp = aggregatedReached.snapShot();
     if (!tmp.equals(lastUsedReachedSets)) {
       // if we have a former aggregated supplier we do only replace the changed parts
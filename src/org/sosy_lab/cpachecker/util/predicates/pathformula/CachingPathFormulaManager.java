@@ -11,12 +11,19 @@ package org.sosy_lab.cpachecker.util.predicates.pathformula;
 import static org.sosy_lab.cpachecker.util.statistics.StatisticsUtils.toPercent;
 
 import com.google.common.base.Equivalence;
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
+import com.google.common.cache.RemovalNotification;
 import java.io.PrintStream;
-import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Set;
 import java.util.concurrent.atomic.LongAdder;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
 import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
 import org.sosy_lab.cpachecker.cfa.ast.c.CIdExpression;
 import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
@@ -28,6 +35,7 @@ import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
 import org.sosy_lab.cpachecker.util.Pair;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap.SSAMapBuilder;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing.PointerTargetSet;
+import org.sosy_lab.cpachecker.util.resources.MemoryPressureMonitor;
 import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer;
 import org.sosy_lab.cpachecker.util.statistics.ThreadSafeTimerContainer.TimerWrapper;
 import org.sosy_lab.java_smt.api.BooleanFormula;
@@ -37,32 +45,86 @@ import org.sosy_lab.java_smt.api.Model.ValueAssignment;
 /**
  * Implementation of {@link PathFormulaManager} that delegates to another
  * instance but caches results of some methods.
+ *
+ * <p>The caches are thread-safe and can optionally be bounded in size, in which case the least
+ * recently used entries are evicted first.
  */
+@Options(prefix = "cpa.predicate.pathFormulaCache")
 public class CachingPathFormulaManager implements PathFormulaManager {
 
+  @Option(
+      secure = true,
+      description =
+          "Maximum number of entries in each of the caches for path formulas."
+              + " If a cache is full, the least recently used entries are evicted."
+              + " Use -1 to disable the limit.")
+  @IntegerOption(min = -1)
+  private int maximumSize = -1;
+
   public final ThreadSafeTimerContainer pathFormulaComputationTimer =
       new ThreadSafeTimerContainer(null);
   public LongAdder pathFormulaCacheHits = new LongAdder();
+  public LongAdder pathFormulaCacheMisses = new LongAdder();
+  public LongAdder pathFormulaCacheEvictions = new LongAdder();
 
   public final PathFormulaManager delegate;
 
-  private final Map<
+  private final Cache<
           Pair<Equivalence.Wrapper<CFAEdge>, PathFormula>, Pair<PathFormula, ErrorConditions>>
-      andFormulaWithConditionsCache = new HashMap<>();
-  private final Map<Pair<Equivalence.Wrapper<CFAEdge>, PathFormula>, PathFormula> andFormulaCache =
-      new HashMap<>();
+      andFormulaWithConditionsCache;
+  private final Cache<Pair<Equivalence.Wrapper<CFAEdge>, PathFormula>, PathFormula>
+      andFormulaCache;
 
-  private final Map<Pair<PathFormula, PathFormula>, PathFormula> orFormulaCache
-            = new HashMap<>();
+  private final Cache<Pair<PathFormula, PathFormula>, PathFormula> orFormulaCache;
 
-  private final Map<PathFormula, PathFormula> emptyFormulaCache
-            = new HashMap<>();
+  private final Cache<PathFormula, PathFormula> emptyFormulaCache;
 
   private final PathFormula emptyFormula;
 
+  /** Create an instance with unbounded caches. */
   public CachingPathFormulaManager(PathFormulaManager pDelegate) {
     delegate = pDelegate;
     emptyFormula = delegate.makeEmptyPathFormula();
+    andFormulaWithConditionsCache = createCache();
+    andFormulaCache = createCache();
+    orFormulaCache = createCache();
+    emptyFormulaCache = createCache();
+    registerCaches();
+  }
+
+  /** Create an instance with caches that are configured by the given configuration. */
+  public CachingPathFormulaManager(PathFormulaManager pDelegate, Configuration pConfig)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    delegate = pDelegate;
+    emptyFormula = delegate.makeEmptyPathFormula();
+    andFormulaWithConditionsCache = createCache();
+    andFormulaCache = createCache();
+    orFormulaCache = createCache();
+    emptyFormulaCache = createCache();
+    registerCaches();
+  }
+
+  private void registerCaches() {
+    MemoryPressureMonitor.registerCache(
+        this,
+        "path formulas",
+        MemoryPressureMonitor.Priority.FIRST,
+        CachingPathFormulaManager::clearCaches);
+  }
+
+  private <K, V> Cache<K, V> createCache() {
+    CacheBuilder<Object, Object> builder = CacheBuilder.newBuilder();
+    if (maximumSize >= 0) {
+      builder = builder.maximumSize(maximumSize).removalListener(this::onRemoval);
+    }
+    return builder.build();
+  }
+
+  private void onRemoval(RemovalNotification<Object, Object> pNotification) {
+    if (pNotification.wasEvicted()) {
+      pathFormulaCacheEvictions.increment();
+    }
   }
 
   /**
@@ -79,8 +141,9 @@ public class CachingPathFormulaManager implements PathFormulaManager {
       PathFormula pOldFormula, CFAEdge pEdge) throws CPATransferException, InterruptedException {
     final Pair<Equivalence.Wrapper<CFAEdge>, PathFormula> formulaCacheKey =
         createFormulaCacheKey(pOldFormula, pEdge);
-    Pair<PathFormula, ErrorConditions> result = andFormulaWithConditionsCache.get(formulaCacheKey);
+    Pair<PathFormula, ErrorConditions> result = andFormulaWithConditionsCache.getIfPresent(formulaCacheKey);
     if (result == null) {
+      pathFormulaCacheMisses.increment();
       TimerWrapper t = pathFormulaComputationTimer.getNewTimer();
       t.start();
       // compute new pathFormula with the operation on the edge
@@ -98,8 +161,9 @@ public class CachingPathFormulaManager implements PathFormulaManager {
   public PathFormula makeAnd(PathFormula pOldFormula, CFAEdge pEdge) throws CPATransferException, InterruptedException {
     final Pair<Equivalence.Wrapper<CFAEdge>, PathFormula> formulaCacheKey =
         createFormulaCacheKey(pOldFormula, pEdge);
-    PathFormula result = andFormulaCache.get(formulaCacheKey);
+    PathFormula result = andFormulaCache.getIfPresent(formulaCacheKey);
     if (result == null) {
+      pathFormulaCacheMisses.increment();
       TimerWrapper t = pathFormulaComputationTimer.getNewTimer();
       try {
         t.start(); // compute new pathFormula with the operation on the edge
@@ -119,13 +183,14 @@ public class CachingPathFormulaManager implements PathFormulaManager {
   public PathFormula makeOr(PathFormula pF1, PathFormula pF2) throws InterruptedException {
     final Pair<PathFormula, PathFormula> formulaCacheKey = Pair.of(pF1, pF2);
 
-    PathFormula result = orFormulaCache.get(formulaCacheKey);
+    PathFormula result = orFormulaCache.getIfPresent(formulaCacheKey);
     if (result == null) {
       // try again with other order
-      result = orFormulaCache.get(Pair.of(pF2, pF1));
+      result = orFormulaCache.getIfPresent(Pair.of(pF2, pF1));
     }
 
     if (result == null) {
+      pathFormulaCacheMisses.increment();
       result = delegate.makeOr(pF1, pF2);
       orFormulaCache.put(formulaCacheKey, result);
     } else {
@@ -141,8 +206,9 @@ public class CachingPathFormulaManager implements PathFormulaManager {
 
   @Override
   public PathFormula makeEmptyPathFormula(PathFormula pOldFormula) {
-    PathFormula result = emptyFormulaCache.get(pOldFormula);
+    PathFormula result = emptyFormulaCache.getIfPresent(pOldFormula);
     if (result == null) {
+      pathFormulaCacheMisses.increment();
       result = delegate.makeEmptyPathFormula(pOldFormula);
       emptyFormulaCache.put(pOldFormula, result);
     } else {
@@ -208,10 +274,10 @@ public class CachingPathFormulaManager implements PathFormulaManager {
 
   @Override
   public void clearCaches() {
-    andFormulaWithConditionsCache.clear();
-    andFormulaCache.clear();
-    orFormulaCache.clear();
-    emptyFormulaCache.clear();
+    andFormulaWithConditionsCache.invalidateAll();
+    andFormulaCache.invalidateAll();
+    orFormulaCache.invalidateAll();
+    emptyFormulaCache.invalidateAll();
     delegate.clearCaches();
   }
 
@@ -237,6 +303,11 @@ public class CachingPathFormulaManager implements PathFormulaManager {
             + " ("
             + toPercent(cacheHits, totalPathFormulaComputations)
             + ")");
+    out.println("Number of path formula cache misses: " + pathFormulaCacheMisses.longValue());
+    if (maximumSize >= 0) {
+      out.println(
+          "Number of path formula cache evictions: " + pathFormulaCacheEvictions.longValue());
+    }
     out.println();
 
     out.println("Inside post operator:                  ");
@@ -0,0 +1,260 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.pathformula;
+
+import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableSortedSet;
+import com.google.common.collect.Sets;
+import java.io.PrintStream;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.Objects;
+import java.util.OptionalInt;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.exceptions.UnrecognizedCFAEdgeException;
+import org.sosy_lab.cpachecker.exceptions.UnrecognizedCodeException;
+import org.sosy_lab.cpachecker.util.Pair;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap.SSAMapBuilder;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.ctoformula.CtoFormulaConverter;
+import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.resources.MemoryPressureMonitor;
+import org.sosy_lab.cpachecker.util.statistics.StatCounter;
+import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+
+/**
+ * Cache for the formulas of CFA edges that allows to reuse the formula of an edge for different
+ * SSA indices.
+ *
+ * <p>For each edge, the formula of its last conversion is stored as a template together with the
+ * SSA indices it was created for. When the edge is converted again for a path formula whose
+ * {@link SSAMap} differs only in the values of the indices, the template is instantiated by
+ * shifting the indices of each variable by the difference between the old and the current index,
+ * instead of converting the edge again. The formula of an edge depends not only on the indices but
+ * also on which variables have an index at all (e.g., for deciding whether a variable is encoded
+ * in the heap), on their types, on the fresh indices, and on the {@link
+ * org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing.PointerTargetSet}. Thus a
+ * template is only used if all of these are the same as for its creation, and only for edges that
+ * do not modify the pointer-target set. Otherwise the edge is converted as usual and the template
+ * is replaced.
+ */
+final class EdgeFormulaTemplates {
+
+  private final CtoFormulaConverter converter;
+  private final FormulaManagerView fmgr;
+  private final BooleanFormulaManagerView bfmgr;
+
+  private final ConcurrentMap<CFAEdge, EdgeFormulaTemplate> templates = new ConcurrentHashMap<>();
+
+  private final StatCounter instantiations = new StatCounter("Number of instantiated templates");
+  private final StatCounter conversions = new StatCounter("Number of conversions of edges");
+  private final StatCounter mismatches =
+      new StatCounter("Number of conversions due to non-matching template");
+
+  EdgeFormulaTemplates(CtoFormulaConverter pConverter, FormulaManagerView pFmgr) {
+    converter = pConverter;
+    fmgr = pFmgr;
+    bfmgr = pFmgr.getBooleanFormulaManager();
+    MemoryPressureMonitor.registerCache(
+        this,
+        "edge formula templates",
+        MemoryPressureMonitor.Priority.FIRST,
+        EdgeFormulaTemplates::clear);
+  }
+
+  /**
+   * Same as {@link CtoFormulaConverter#makeAnd(PathFormula, CFAEdge, ErrorConditions)} without
+   * error conditions, but reusing the formula of a previous conversion of the edge if possible.
+   */
+  PathFormula makeAnd(PathFormula pOldFormula, CFAEdge pEdge)
+      throws UnrecognizedCodeException, UnrecognizedCFAEdgeException, InterruptedException {
+    EdgeFormulaTemplate template = templates.get(pEdge);
+    if (template != null) {
+      @Nullable PathFormula result = template.instantiate(pOldFormula);
+      if (result != null) {
+        instantiations.inc();
+        return result;
+      }
+      mismatches.inc();
+    }
+
+    conversions.inc();
+    PathFormula context =
+        new PathFormula(
+            bfmgr.makeTrue(), pOldFormula.getSsa(), pOldFormula.getPointerTargetSet(), 0);
+    PathFormula edgeFormula =
+        converter.makeAnd(context, pEdge, ErrorConditions.dummyInstance(bfmgr));
+
+    if (edgeFormula == context) {
+      // edge does not change anything
+      templates.put(pEdge, new EdgeFormulaTemplate(context, context, ImmutableSortedSet.of()));
+      return pOldFormula;
+    }
+    if (edgeFormula.getPointerTargetSet().equals(pOldFormula.getPointerTargetSet())) {
+      templates.put(
+          pEdge,
+          new EdgeFormulaTemplate(
+              context,
+              edgeFormula,
+              ImmutableSortedSet.copyOf(fmgr.extractFunctionNames(edgeFormula.getFormula()))));
+    } else {
+      templates.remove(pEdge);
+    }
+    return combine(pOldFormula, edgeFormula.getFormula(), edgeFormula);
+  }
+
+  private PathFormula combine(
+      PathFormula pOldFormula, BooleanFormula pEdgeFormula, PathFormula pEdgeResult) {
+    return new PathFormula(
+        bfmgr.and(pOldFormula.getFormula(), pEdgeFormula),
+        pEdgeResult.getSsa(),
+        pEdgeResult.getPointerTargetSet(),
+        pOldFormula.getLength() + 1);
+  }
+
+  void clear() {
+    templates.clear();
+  }
+
+  void printStatistics(PrintStream out) {
+    StatisticsWriter.writingStatisticsTo(out)
+        .put("Edge formula templates", "")
+        .beginLevel()
+        .put(instantiations)
+        .put(conversions)
+        .put(mismatches);
+  }
+
+  /** Information about one variable of an {@link SSAMap} that is relevant for a template. */
+  private static final class VariableInfo {
+
+    private final boolean present;
+    private final int index;
+    private final int freshOffset;
+    private final @Nullable CType type;
+
+    private VariableInfo(SSAMap pSsa, SSAMapBuilder pSsaBuilder, String pVariable) {
+      present = pSsa.containsVariable(pVariable);
+      index = pSsa.getIndex(pVariable);
+      freshOffset = pSsaBuilder.getFreshIndex(pVariable) - index;
+      type = pSsa.getType(pVariable);
+    }
+  }
+
+  private final class EdgeFormulaTemplate {
+
+    private final boolean changesNothing;
+    private final BooleanFormula formula;
+    private final SSAMap oldSsa;
+    private final SSAMap newSsa;
+    private final PathFormula result;
+
+    /** The variables that occur in the formula or whose index is changed by the edge. */
+    private final ImmutableMap<String, VariableInfo> variables;
+
+    private EdgeFormulaTemplate(
+        PathFormula pContext, PathFormula pEdgeResult, ImmutableSortedSet<String> pSymbols) {
+      changesNothing = pContext == pEdgeResult;
+      formula = pEdgeResult.getFormula();
+      oldSsa = pContext.getSsa();
+      newSsa = pEdgeResult.getSsa();
+      result = pEdgeResult;
+
+      SSAMapBuilder oldSsaBuilder = oldSsa.builder();
+      Map<String, VariableInfo> relevantVariables = new HashMap<>();
+      for (String variable : Sets.union(oldSsa.allVariables(), newSsa.allVariables())) {
+        if (oldSsa.getIndex(variable) != newSsa.getIndex(variable)) {
+          relevantVariables.put(variable, new VariableInfo(oldSsa, oldSsaBuilder, variable));
+        }
+      }
+      for (String symbol : pSymbols) {
+        relevantVariables.computeIfAbsent(
+            FormulaManagerView.parseName(symbol).getFirst(),
+            variable -> new VariableInfo(oldSsa, oldSsaBuilder, variable));
+      }
+      variables = ImmutableMap.copyOf(relevantVariables);
+    }
+
+    /**
+     * Create the path formula for the edge of this template from the given path formula, or return
+     * null if the template is not applicable.
+     */
+    private @Nullable PathFormula instantiate(PathFormula pOldFormula) {
+      SSAMap ssa = pOldFormula.getSsa();
+      if (!ssa.allVariables().equals(oldSsa.allVariables())
+          || !pOldFormula.getPointerTargetSet().equals(result.getPointerTargetSet())) {
+        return null;
+      }
+
+      SSAMapBuilder ssaBuilder = ssa.builder();
+      Map<String, Integer> shifts = new HashMap<>();
+      for (Map.Entry<String, VariableInfo> entry : variables.entrySet()) {
+        String variable = entry.getKey();
+        VariableInfo info = entry.getValue();
+        int index = ssa.getIndex(variable);
+        if (ssaBuilder.getFreshIndex(variable) - index != info.freshOffset
+            || !Objects.equals(ssa.getType(variable), info.type)) {
+          return null;
+        }
+        if (info.present) {
+          if (index != info.index) {
+            shifts.put(variable, index - info.index);
+          }
+        } else if (index != info.index) {
+          return null;
+        }
+      }
+
+      if (changesNothing) {
+        return pOldFormula;
+      }
+
+      // apply the changes of the edge to the current SSA indices
+      for (Map.Entry<String, VariableInfo> entry : variables.entrySet()) {
+        String variable = entry.getKey();
+        int newIndex = newSsa.getIndex(variable);
+        if (newIndex == entry.getValue().index) {
+          continue; // not changed by the edge
+        } else if (!newSsa.containsVariable(variable)) {
+          ssaBuilder.deleteVariable(variable);
+        } else {
+          ssaBuilder.setIndex(
+              variable, newSsa.getType(variable), newIndex + shifts.getOrDefault(variable, 0));
+        }
+      }
+
+      BooleanFormula instantiatedFormula = formula;
+      if (!shifts.isEmpty()) {
+        instantiatedFormula =
+            fmgr.renameFreeVariablesAndUFs(
+                formula,
+                symbol -> {
+                  Pair<String, OptionalInt> name = FormulaManagerView.parseName(symbol);
+                  Integer shift = shifts.get(name.getFirst());
+                  if (shift == null || !name.getSecond().isPresent()) {
+                    return symbol;
+                  }
+                  return FormulaManagerView.instantiateVariableName(
+                      name.getFirst(), name.getSecond().orElseThrow() + shift);
+                });
+      }
+
+      return new PathFormula(
+          bfmgr.and(pOldFormula.getFormula(), instantiatedFormula),
+          ssaBuilder.build(),
+          result.getPointerTargetSet(),
+          pOldFormula.getLength() + 1);
+    }
+  }
+}
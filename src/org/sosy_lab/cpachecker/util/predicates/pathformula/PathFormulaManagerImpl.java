@@ -122,13 +122,23 @@ public class PathFormulaManagerImpl implements PathFormulaManager {
   )
   private boolean useNondetFlags = false;
 
+  @Option(
+      secure = true,
+      description =
+          "Cache the formula of each CFA edge as a template and instantiate it with the current"
+              + " SSA indices instead of converting the edge again, if the SSA map differs only"
+              + " in the values of the indices (e.g., in later iterations of unrolled loops).")
+  private boolean useEdgeFormulaTemplates = false;
+
+  private final @Nullable EdgeFormulaTemplates edgeFormulaTemplates;
+
   public PathFormulaManagerImpl(FormulaManagerView pFmgr,
       Configuration config, LogManager pLogger, ShutdownNotifier pShutdownNotifier,
       CFA pCfa, AnalysisDirection pDirection)
           throws InvalidConfigurationException {
 
     this(pFmgr, config, pLogger, pShutdownNotifier, pCfa.getMachineModel(),
-        pCfa.getVarClassification(), pDirection);
+        pCfa.getVarClassification(), pDirection, pCfa);
   }
 
   public PathFormulaManagerImpl(FormulaManagerView pFmgr,
@@ -136,6 +146,16 @@ public class PathFormulaManagerImpl implements PathFormulaManager {
       MachineModel pMachineModel,
       Optional<VariableClassification> pVariableClassification, AnalysisDirection pDirection)
           throws InvalidConfigurationException {
+    this(pFmgr, config, pLogger, pShutdownNotifier, pMachineModel, pVariableClassification,
+        pDirection, null);
+  }
+
+  private PathFormulaManagerImpl(FormulaManagerView pFmgr,
+      Configuration config, LogManager pLogger, ShutdownNotifier pShutdownNotifier,
+      MachineModel pMachineModel,
+      Optional<VariableClassification> pVariableClassification, AnalysisDirection pDirection,
+      @Nullable CFA pCfa)
+          throws InvalidConfigurationException {
 
     config.inject(this, PathFormulaManagerImpl.class);
 
@@ -146,6 +166,15 @@ public class PathFormulaManagerImpl implements PathFormulaManager {
 
     if (handlePointerAliasing) {
       final FormulaEncodingWithPointerAliasingOptions options = new FormulaEncodingWithPointerAliasingOptions(config);
+      if (pCfa != null) {
+        boolean arraysSupported = true;
+        try {
+          fmgr.getArrayFormulaManager();
+        } catch (UnsupportedOperationException e) {
+          arraysSupported = false;
+        }
+        options.selectHeapEncoding(pCfa, arraysSupported, logger);
+      }
       if (options.useQuantifiersOnArrays()) {
         try {
           fmgr.getQuantifiedFormulaManager();
@@ -212,6 +241,8 @@ public class PathFormulaManagerImpl implements PathFormulaManager {
     }
 
     NONDET_FORMULA_TYPE = converter.getFormulaTypeFromCType(NONDET_TYPE);
+    edgeFormulaTemplates =
+        useEdgeFormulaTemplates ? new EdgeFormulaTemplates(converter, fmgr) : null;
   }
 
   @Override
@@ -226,7 +257,12 @@ public class PathFormulaManagerImpl implements PathFormulaManager {
   private PathFormula makeAnd(
       PathFormula pOldFormula, final CFAEdge pEdge, ErrorConditions errorConditions)
       throws UnrecognizedCodeException, UnrecognizedCFAEdgeException, InterruptedException {
-    PathFormula pf = converter.makeAnd(pOldFormula, pEdge, errorConditions);
+    PathFormula pf;
+    if (edgeFormulaTemplates != null && !errorConditions.isEnabled()) {
+      pf = edgeFormulaTemplates.makeAnd(pOldFormula, pEdge);
+    } else {
+      pf = converter.makeAnd(pOldFormula, pEdge, errorConditions);
+    }
 
     if (useNondetFlags) {
       SSAMapBuilder ssa = pf.getSsa().builder();
@@ -542,6 +578,9 @@ public class PathFormulaManagerImpl implements PathFormulaManager {
 
   @Override
   public void clearCaches() {
+    if (edgeFormulaTemplates != null) {
+      edgeFormulaTemplates.clear();
+    }
   }
 
   @Override
@@ -588,6 +627,9 @@ public class PathFormulaManagerImpl implements PathFormulaManager {
   @Override
   public void printStatistics(PrintStream out) {
     converter.printStatistics(out);
+    if (edgeFormulaTemplates != null) {
+      edgeFormulaTemplates.printStatistics(out);
+    }
   }
 
   @Override
@@ -311,6 +311,39 @@ public class PathFormulaManagerImplTest extends SolverViewBasedTest0 {
     assertThatFormula(pf.getFormula()).isEquivalentTo(expected);
   }
 
+  @Test
+  public void testEdgeFormulaTemplates() throws Exception {
+    Triple<CFAEdge, CFAEdge, MutableCFA> data = createCFA();
+    CFAEdge a_to_b = data.getFirst();
+
+    Configuration configWithTemplates =
+        Configuration.builder()
+            .copyFrom(config)
+            .setOption("cpa.predicate.useEdgeFormulaTemplates", "true")
+            .build();
+    PathFormulaManager pfmgrWithTemplates =
+        new PathFormulaManagerImpl(
+            mgrv,
+            configWithTemplates,
+            logger,
+            ShutdownNotifier.createDummy(),
+            MachineModel.LINUX32,
+            Optional.empty(),
+            AnalysisDirection.FORWARD);
+
+    PathFormula pf = makePathFormulaWithCustomIndex(pfmgrFwd, "x", CNumericTypes.INT, 10);
+    PathFormula expected = pf;
+    // the second and third conversion of the edge are instantiated from the first one
+    for (int i = 0; i < 3; i++) {
+      pf = pfmgrWithTemplates.makeAnd(pf, a_to_b);
+      expected = pfmgrFwd.makeAnd(expected, a_to_b);
+    }
+
+    assertThat(pf.getSsa()).isEqualTo(expected.getSsa());
+    assertThat(pf.getLength()).isEqualTo(expected.getLength());
+    assertThatFormula(pf.getFormula()).isEquivalentTo(expected.getFormula());
+  }
+
   private PathFormula makePathFormulaWithCustomIndex(
       PathFormulaManager pPfmgr, String pVar, CType pType, int pIndex) {
     SSAMap ssaMap = SSAMap.emptySSAMap().builder().setIndex(pVar, pType, pIndex).build();
@@ -17,6 +17,7 @@ import java.lang.reflect.Constructor;
 import org.junit.Before;
 import org.junit.Test;
 import org.sosy_lab.common.annotations.SuppressForbidden;
+import org.sosy_lab.common.collect.MapsDifference;
 import org.sosy_lab.common.collect.PathCopyingPersistentTreeMap;
 import org.sosy_lab.common.collect.PersistentLinkedList;
 import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
@@ -154,4 +155,39 @@ public class PathFormulaTest {
 
     assertThrows(IllegalArgumentException.class, () -> builder.setIndex("a", CNumericTypes.INT, 1));
   }
+
+  @Test
+  public void testSSAHashConsing() {
+    SSAMap ssa1 =
+        builder.setIndex("a", CNumericTypes.INT, 1).setIndex("b", CNumericTypes.INT, 2).build();
+    SSAMap ssa2 =
+        SSAMap.emptySSAMap()
+            .builder()
+            .setIndex("b", CNumericTypes.INT, 2)
+            .setIndex("a", CNumericTypes.INT, 1)
+            .build();
+
+    assertThat(ssa2).isSameInstanceAs(ssa1);
+    assertThat(SSAMap.emptySSAMap().builder().build()).isSameInstanceAs(SSAMap.emptySSAMap());
+    assertThat(ssa1.builder().deleteVariable("a").deleteVariable("b").build())
+        .isSameInstanceAs(SSAMap.emptySSAMap());
+  }
+
+  @Test
+  public void testSSAHashConsingDefault() {
+    SSAMap ssa = builder.setIndex("a", CNumericTypes.INT, 1).build();
+
+    assertThat(ssa.withDefault(1)).isNotEqualTo(ssa);
+    assertThat(ssa.withDefault(1)).isSameInstanceAs(ssa.withDefault(1));
+    assertThat(ssa.withDefault(1).getIndex("b")).isEqualTo(1);
+  }
+
+  @Test
+  public void testSSAMergeIdentical() {
+    SSAMap ssa = builder.setIndex("a", CNumericTypes.INT, 1).build();
+    SSAMap other = SSAMap.emptySSAMap().builder().setIndex("a", CNumericTypes.INT, 1).build();
+
+    assertThat(SSAMap.merge(ssa, other, MapsDifference.ignoreMapsDifference()))
+        .isSameInstanceAs(ssa);
+  }
 }
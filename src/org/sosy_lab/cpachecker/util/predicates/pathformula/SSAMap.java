@@ -13,6 +13,8 @@ import static com.google.common.base.Preconditions.checkArgument;
 import com.google.common.base.Equivalence;
 import com.google.common.base.Joiner;
 import com.google.common.base.Preconditions;
+import com.google.common.collect.Interner;
+import com.google.common.collect.Interners;
 import java.io.Serializable;
 import java.util.AbstractMap.SimpleImmutableEntry;
 import java.util.Map;
@@ -35,6 +37,10 @@ import org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing.TypeH
 /**
  * Maps a variable name to its latest "SSA index", that should be used when
  * referring to that variable.
+ *
+ * <p>Instances are hash-consed: all methods that create an SSAMap return a canonical instance,
+ * such that equal SSAMaps are always identical. Thus comparisons of SSAMaps (e.g., in cache keys)
+ * and merges of equal SSAMaps are cheap, and equal SSAMaps do not waste memory.
  */
 public class SSAMap implements Serializable {
 
@@ -174,7 +180,7 @@ public class SSAMap implements Serializable {
         return ssa;
       }
 
-      ssa = new SSAMap(vars, freshValueProvider, varsHashCode, varTypes, ssa.defaultValue);
+      ssa = intern(new SSAMap(vars, freshValueProvider, varsHashCode, varTypes, ssa.defaultValue));
       return ssa;
     }
 
@@ -187,11 +193,21 @@ public class SSAMap implements Serializable {
     }
   }
 
-  private static final SSAMap EMPTY_SSA_MAP = new SSAMap(
-      PathCopyingPersistentTreeMap.of(),
-      new FreshValueProvider(),
-      0,
-      PathCopyingPersistentTreeMap.of());
+  // Weak interner, such that SSAMaps that are not referenced anymore can be garbage collected.
+  // Needs to be initialized before EMPTY_SSA_MAP.
+  private static final Interner<SSAMap> INTERNER = Interners.newWeakInterner();
+
+  private static SSAMap intern(SSAMap pSsa) {
+    return INTERNER.intern(pSsa);
+  }
+
+  private static final SSAMap EMPTY_SSA_MAP =
+      intern(
+          new SSAMap(
+              PathCopyingPersistentTreeMap.of(),
+              new FreshValueProvider(),
+              0,
+              PathCopyingPersistentTreeMap.of()));
 
   /**
    * Returns an empty immutable SSAMap.
@@ -201,7 +217,12 @@ public class SSAMap implements Serializable {
   }
 
   public SSAMap withDefault(final int pDefaultValue) {
-    return new SSAMap(this.vars, this.freshValueProvider, this.varsHashCode, this.varTypes, pDefaultValue);
+    if (pDefaultValue == defaultValue) {
+      return this;
+    }
+    return intern(
+        new SSAMap(
+            this.vars, this.freshValueProvider, this.varsHashCode, this.varTypes, pDefaultValue));
   }
 
   /**
@@ -219,6 +240,11 @@ public class SSAMap implements Serializable {
     // We don't bother checking the vars set for emptiness, because this will
     // probably never be the case on a merge.
 
+    if (s1 == s2) {
+      // equal SSAMaps are identical because of hash-consing
+      return s1;
+    }
+
     checkArgument(s1.defaultValue == s2.defaultValue);
     PersistentSortedMap<String, Integer> vars;
     FreshValueProvider freshValueProvider;
@@ -247,7 +273,7 @@ public class SSAMap implements Serializable {
             TYPE_CONFLICT_CHECKER,
             MapsDifference.ignoreMapsDifference());
 
-    return new SSAMap(vars, freshValueProvider, 0, varTypes, defaultIndex);
+    return intern(new SSAMap(vars, freshValueProvider, 0, varTypes, defaultIndex));
   }
 
   private final PersistentSortedMap<String, Integer> vars;
@@ -283,6 +309,11 @@ public class SSAMap implements Serializable {
     this(vars, freshValueProvider, varsHashCode, varTypes, DEFAULT_DEFAULT_IDX);
   }
 
+  private Object readResolve() {
+    // keep instances canonical after deserialization
+    return intern(this);
+  }
+
   /**
    * Returns a SSAMapBuilder that is initialized with the current SSAMap.
    */
@@ -337,6 +368,7 @@ public class SSAMap implements Serializable {
       SSAMap other = (SSAMap)obj;
       // Do a few cheap checks before the expensive ones.
       return varsHashCode == other.varsHashCode
+          && defaultValue == other.defaultValue
           && vars.equals(other.vars)
           && freshValueProvider.equals(other.freshValueProvider);
     }
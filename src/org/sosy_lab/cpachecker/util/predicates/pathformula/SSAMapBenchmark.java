@@ -0,0 +1,58 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.pathformula;
+
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.sosy_lab.common.collect.MapsDifference;
+import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap.SSAMapBuilder;
+
+/** Micro benchmark for merging two {@link SSAMap}s that differ in half of their variables. */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@Fork(1)
+@Warmup(iterations = 3)
+@Measurement(iterations = 5)
+public class SSAMapBenchmark {
+
+  @Param({"10", "1000"})
+  private int size;
+
+  private SSAMap first;
+  private SSAMap second;
+
+  @Setup
+  public void setUp() {
+    SSAMapBuilder firstBuilder = SSAMap.emptySSAMap().builder();
+    SSAMapBuilder secondBuilder = SSAMap.emptySSAMap().builder();
+    for (int i = 0; i < size; i++) {
+      firstBuilder.setIndex("main::x" + i, CNumericTypes.INT, 1);
+      secondBuilder.setIndex("main::x" + i, CNumericTypes.INT, i % 2 == 0 ? 1 : 2);
+    }
+    first = firstBuilder.build();
+    second = secondBuilder.build();
+  }
+
+  @Benchmark
+  public SSAMap merge() {
+    return SSAMap.merge(first, second, MapsDifference.ignoreMapsDifference());
+  }
+}
@@ -31,6 +31,10 @@ public class Constraints {
     constraints.add(pCo);
   }
 
+  public int size() {
+    return constraints.size();
+  }
+
   public BooleanFormula get() {
     return bfmgr.and(constraints);
   }
@@ -292,6 +292,7 @@ public class CToFormulaConverterWithPointerAliasing extends CtoFormulaConverter
               functionName, oldIndex, newIndex, returnFormulaType, targetAddress));
     }
 
+    ptsMgr.addRetentionConstraintsToStats(result.size());
     return bfmgr.and(result);
   }
 
@@ -1349,5 +1350,6 @@ public class CToFormulaConverterWithPointerAliasing extends CtoFormulaConverter
   @Override
   public void printStatistics(PrintStream out) {
     regionMgr.printStatistics(out);
+    ptsMgr.printStatistics(out);
   }
 }
@@ -9,11 +9,14 @@
 package org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing;
 
 import com.google.common.collect.ImmutableSet;
+import java.util.logging.Level;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFA;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.ctoformula.FormulaEncodingOptions;
 
 @Options(prefix="cpa.predicate")
@@ -107,6 +110,17 @@ public class FormulaEncodingWithPointerAliasingOptions extends FormulaEncodingOp
       description = "Use an optimisation for constraint generation")
   private boolean useConstraintOptimization = true;
 
+  @Option(
+      secure = true,
+      description =
+          "Choose the heap encoding and whether to use memory regions based on cheap syntactic"
+              + " features of the program, overriding the options useArraysForHeap,"
+              + " useByteArrayForHeap, and useMemoryRegions. Byte-level casts lead to the"
+              + " byte-array encoding, programs without allocations and pointer arithmetic use"
+              + " uninterpreted functions, and all others use arrays. Memory regions are used if"
+              + " some field is never accessed by its address.")
+  private boolean selectHeapEncoding = false;
+
   public FormulaEncodingWithPointerAliasingOptions(Configuration config) throws InvalidConfigurationException {
     super(config);
     config.inject(this, FormulaEncodingWithPointerAliasingOptions.class);
@@ -120,6 +134,51 @@ public class FormulaEncodingWithPointerAliasingOptions extends FormulaEncodingOp
     }
   }
 
+  /**
+   * Choose the heap encoding and whether to use memory regions for the given program, if this was
+   * requested by the user.
+   *
+   * @param pCfa the program to analyze
+   * @param pArraysSupported whether the solver supports the theory of arrays
+   * @param pLogger the logger to report the choice to
+   */
+  public void selectHeapEncoding(
+      final CFA pCfa, boolean pArraysSupported, final LogManager pLogger) {
+    if (!selectHeapEncoding) {
+      return;
+    }
+    HeapEncodingFeatures features = HeapEncodingFeatures.collect(pCfa, this);
+    if (!pArraysSupported) {
+      useByteArrayForHeap = false;
+      useArraysForHeap = false;
+    } else if (features.getByteLevelCasts() > 0) {
+      // only the byte-wise heap is precise if the same memory is read with different types
+      useByteArrayForHeap = true;
+      useArraysForHeap = true;
+    } else {
+      // without allocations and pointer arithmetic the heap contains only address-taken variables,
+      // for which uninterpreted functions are cheaper and interpolate better
+      useByteArrayForHeap = false;
+      useArraysForHeap = features.getAllocations() > 0 || features.getPointerArithmetic() > 0;
+    }
+    useMemoryRegions = features.hasFieldsForSeparateRegions();
+    String heapEncoding;
+    if (useByteArrayForHeap) {
+      heapEncoding = "byte array";
+    } else if (useArraysForHeap) {
+      heapEncoding = "arrays";
+    } else {
+      heapEncoding = "uninterpreted functions";
+    }
+    pLogger.log(
+        Level.INFO,
+        "Program has",
+        features,
+        "; encoding heap with",
+        heapEncoding,
+        useMemoryRegions ? "and memory regions" : "without memory regions");
+  }
+
   @Override
   public boolean shouldAbortOnLargeArrays() {
     if (useArraysForHeap() || useQuantifiersOnArrays()) {
@@ -0,0 +1,141 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing;
+
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.ast.AAstNode;
+import org.sosy_lab.cpachecker.cfa.ast.c.CBinaryExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CCastExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CFunctionCallExpression;
+import org.sosy_lab.cpachecker.cfa.ast.c.CIdExpression;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.types.c.CPointerType;
+import org.sosy_lab.cpachecker.cfa.types.c.CType;
+import org.sosy_lab.cpachecker.cfa.types.c.CTypes;
+import org.sosy_lab.cpachecker.cfa.types.c.CVoidType;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.variableclassification.VariableClassification;
+
+/**
+ * Cheap syntactic features of a program that are used to choose the heap encoding of the
+ * pointer-aliasing formula encoding (cf. option cpa.predicate.selectHeapEncoding).
+ */
+final class HeapEncodingFeatures {
+
+  /** Additions and subtractions with a pointer operand. */
+  private int pointerArithmetic = 0;
+
+  /** Casts that make memory accessible as bytes or reinterpret it with another pointee type. */
+  private int byteLevelCasts = 0;
+
+  /** Calls of memory allocation functions. */
+  private int allocations = 0;
+
+  /** Whether some field is relevant but never accessed by address (cf. BnB memory regions). */
+  private boolean hasFieldsForSeparateRegions = false;
+
+  private HeapEncodingFeatures() {}
+
+  static HeapEncodingFeatures collect(
+      final CFA pCfa, final FormulaEncodingWithPointerAliasingOptions pOptions) {
+    HeapEncodingFeatures features = new HeapEncodingFeatures();
+    for (CFANode node : pCfa.getAllNodes()) {
+      for (CFAEdge edge : CFAUtils.leavingEdges(node)) {
+        for (AAstNode astNode : CFAUtils.getAstNodesFromCfaEdge(edge)) {
+          for (AAstNode subNode : CFAUtils.traverseRecursively(astNode)) {
+            features.visit(subNode, pOptions);
+          }
+        }
+      }
+    }
+    if (pCfa.getVarClassification().isPresent()) {
+      VariableClassification varClassification = pCfa.getVarClassification().orElseThrow();
+      features.hasFieldsForSeparateRegions =
+          !varClassification
+              .getAddressedFields()
+              .entries()
+              .containsAll(varClassification.getRelevantFields().entries());
+    }
+    return features;
+  }
+
+  private void visit(AAstNode pNode, FormulaEncodingWithPointerAliasingOptions pOptions) {
+    if (pNode instanceof CBinaryExpression) {
+      CBinaryExpression binExp = (CBinaryExpression) pNode;
+      if (isPointer(binExp.getOperand1()) || isPointer(binExp.getOperand2())) {
+        switch (binExp.getOperator()) {
+          case PLUS:
+          case MINUS:
+            pointerArithmetic++;
+            break;
+          default:
+            // other operators do not compute new addresses
+        }
+      }
+
+    } else if (pNode instanceof CCastExpression) {
+      CCastExpression cast = (CCastExpression) pNode;
+      CType targetType = cast.getExpressionType().getCanonicalType();
+      CType sourceType = cast.getOperand().getExpressionType().getCanonicalType();
+      if (targetType instanceof CPointerType && sourceType instanceof CPointerType) {
+        CType targetPointee = ((CPointerType) targetType).getType().getCanonicalType();
+        CType sourcePointee = ((CPointerType) sourceType).getType().getCanonicalType();
+        // casts from and to void* are the normal way of passing memory around
+        if (!(targetPointee instanceof CVoidType)
+            && !(sourcePointee instanceof CVoidType)
+            && (CTypes.isCharacterType(targetPointee)
+                || !CTypes.areTypesCompatible(targetPointee, sourcePointee))) {
+          byteLevelCasts++;
+        }
+      }
+
+    } else if (pNode instanceof CFunctionCallExpression) {
+      CExpression function = ((CFunctionCallExpression) pNode).getFunctionNameExpression();
+      if (function instanceof CIdExpression) {
+        String name = ((CIdExpression) function).getName();
+        if (pOptions.isMemoryAllocationFunction(name)
+            || pOptions.isMemoryAllocationFunctionWithZeroing(name)) {
+          allocations++;
+        }
+      }
+    }
+  }
+
+  private static boolean isPointer(CExpression pExpression) {
+    return pExpression.getExpressionType().getCanonicalType() instanceof CPointerType;
+  }
+
+  int getPointerArithmetic() {
+    return pointerArithmetic;
+  }
+
+  int getByteLevelCasts() {
+    return byteLevelCasts;
+  }
+
+  int getAllocations() {
+    return allocations;
+  }
+
+  boolean hasFieldsForSeparateRegions() {
+    return hasFieldsForSeparateRegions;
+  }
+
+  @Override
+  public String toString() {
+    return String.format(
+        "%d pointer-arithmetic operations, %d byte-level casts, %d allocations, %s",
+        pointerArithmetic,
+        byteLevelCasts,
+        allocations,
+        hasFieldsForSeparateRegions ? "fields without address" : "no fields without address");
+  }
+}
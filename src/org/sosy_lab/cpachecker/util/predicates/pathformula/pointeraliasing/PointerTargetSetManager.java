@@ -19,6 +19,7 @@ import com.google.common.base.Joiner;
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.Iterables;
 import com.google.errorprone.annotations.CheckReturnValue;
+import java.io.PrintStream;
 import java.math.BigInteger;
 import java.util.ArrayList;
 import java.util.HashSet;
@@ -53,6 +54,10 @@ import org.sosy_lab.cpachecker.util.predicates.pathformula.ctoformula.Constraint
 import org.sosy_lab.cpachecker.util.predicates.pathformula.pointeraliasing.PointerTargetSetBuilder.RealPointerTargetSetBuilder;
 import org.sosy_lab.cpachecker.util.predicates.smt.BooleanFormulaManagerView;
 import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.statistics.StatCounter;
+import org.sosy_lab.cpachecker.util.statistics.StatInt;
+import org.sosy_lab.cpachecker.util.statistics.StatKind;
+import org.sosy_lab.cpachecker.util.statistics.StatisticsWriter;
 import org.sosy_lab.java_smt.api.BooleanFormula;
 import org.sosy_lab.java_smt.api.Formula;
 import org.sosy_lab.java_smt.api.FormulaType;
@@ -113,6 +118,17 @@ class PointerTargetSetManager {
   private final TypeHandlerWithPointerAliasing typeHandler;
   private final MemoryRegionManager regionMgr;
   private final SMTHeap heap;
+
+  private final StatCounter mergeCount = new StatCounter("Number of merges");
+  private final StatCounter identicalMergeCount =
+      new StatCounter("Number of merges of identical sets");
+  private final StatCounter sharedComponentCount =
+      new StatCounter("Number of shared bases/fields/targets maps skipped");
+  private final StatInt importConstraintCount =
+      new StatInt(StatKind.SUM, "Number of value-import constraints in merge formulas");
+  private final StatInt retentionConstraintCount =
+      new StatInt(StatKind.SUM, "Number of memory-retention constraints in merge formulas");
+
   /**
    * Creates a new PointerTargetSetManager.
    *
@@ -214,71 +230,61 @@ class PointerTargetSetManager {
       final PointerTargetSet pts1, final PointerTargetSet pts2, final SSAMapBuilder ssa)
       throws InterruptedException {
 
+    mergeCount.inc();
     if (pts1.isEmpty() && pts2.isEmpty()) {
       return MergeResult.trivial(PointerTargetSet.emptyPointerTargetSet(), bfmgr);
     }
+    if (pts1 == pts2) {
+      // Common case at join points of branches that did not touch the heap.
+      identicalMergeCount.inc();
+      return MergeResult.trivial(pts1, bfmgr);
+    }
+
+    // Parts of the two sets are often the very same persistent maps (e.g., if only one branch
+    // allocated memory or added a field). For such parts, the merge is the identity and there are
+    // no differences that require targets or merge formulas, so we skip them completely.
 
     final CopyOnWriteSortedMap<String, CType> basesOnlyPts1 =
         CopyOnWriteSortedMap.copyOf(PathCopyingPersistentTreeMap.<String, CType>of());
     final CopyOnWriteSortedMap<String, CType> basesOnlyPts2 =
         CopyOnWriteSortedMap.copyOf(PathCopyingPersistentTreeMap.<String, CType>of());
 
-    PersistentSortedMap<String, CType> mergedBases =
-        merge(
-            pts1.getBases(),
-            pts2.getBases(),
-            Equivalence.equals(),
-            BaseUnitingConflictHandler.INSTANCE,
-            new MapsDifference.DefaultVisitor<String, CType>() {
-              @Override
-              public void leftValueOnly(String pKey, CType pLeftValue) {
-                basesOnlyPts1.put(pKey, pLeftValue);
-              }
-
-              @Override
-              public void rightValueOnly(String pKey, CType pRightValue) {
-                basesOnlyPts2.put(pKey, pRightValue);
-              }
-
-              @Override
-              public void differingValues(String pKey, CType pLeftValue, CType pRightValue) {
-                if (isFakeBaseType(pLeftValue) && !(pRightValue instanceof CElaboratedType)) {
-                  basesOnlyPts2.put(pKey, pRightValue);
-                } else if (isFakeBaseType(pRightValue) && !(pLeftValue instanceof CElaboratedType)) {
-                  basesOnlyPts1.put(pKey, pLeftValue);
-                }
-              }
-            });
+    final PersistentSortedMap<String, CType> mergedBases;
+    if (pts1.getBases() == pts2.getBases()) {
+      sharedComponentCount.inc();
+      mergedBases = pts1.getBases();
+    } else {
+      mergedBases = mergeBases(pts1, pts2, basesOnlyPts1, basesOnlyPts2);
+    }
     shutdownNotifier.shutdownIfNecessary();
 
-
     final CopyOnWriteSortedMap<CompositeField, Boolean> fieldsOnlyPts1 =
         CopyOnWriteSortedMap.copyOf(PathCopyingPersistentTreeMap.<CompositeField, Boolean>of());
     final CopyOnWriteSortedMap<CompositeField, Boolean> fieldsOnlyPts2 =
         CopyOnWriteSortedMap.copyOf(PathCopyingPersistentTreeMap.<CompositeField, Boolean>of());
 
-    PersistentSortedMap<CompositeField, Boolean> mergedFields =
-        merge(
-            pts1.getFields(),
-            pts2.getFields(),
-            Equivalence.equals(),
-            PersistentSortedMaps.getExceptionMergeConflictHandler(),
-            new MapsDifference.DefaultVisitor<CompositeField, Boolean>() {
-              @Override
-              public void leftValueOnly(CompositeField pKey, Boolean pLeftValue) {
-                fieldsOnlyPts1.put(pKey, pLeftValue);
-              }
-
-              @Override
-              public void rightValueOnly(CompositeField pKey, Boolean pRightValue) {
-                fieldsOnlyPts2.put(pKey, pRightValue);
-              }
-            });
+    final PersistentSortedMap<CompositeField, Boolean> mergedFields;
+    if (pts1.getFields() == pts2.getFields()) {
+      sharedComponentCount.inc();
+      mergedFields = pts1.getFields();
+    } else {
+      mergedFields = mergeFields(pts1, pts2, fieldsOnlyPts1, fieldsOnlyPts2);
+    }
     shutdownNotifier.shutdownIfNecessary();
 
-    PersistentSortedMap<String, PersistentList<PointerTarget>> mergedTargets =
-        merge(
-            pts1.getTargets(), pts2.getTargets(), (key, list1, list2) -> mergeLists(list1, list2));
+    PersistentSortedMap<String, PersistentList<PointerTarget>> mergedTargets;
+    if (pts1.getTargets() == pts2.getTargets()) {
+      sharedComponentCount.inc();
+      mergedTargets = pts1.getTargets();
+    } else {
+      // mergeLists() returns shared target lists of a region without looking at them,
+      // so only the regions that differ are actually merged.
+      mergedTargets =
+          merge(
+              pts1.getTargets(),
+              pts2.getTargets(),
+              (key, list1, list2) -> mergeLists(list1, list2));
+    }
     shutdownNotifier.shutdownIfNecessary();
 
     // Targets is always the cross product of bases and fields.
@@ -330,6 +336,69 @@ class PointerTargetSetManager {
     return new MergeResult<>(resultPTS, mergeFormula1, mergeFormula2, bfmgr.makeTrue());
   }
 
+  /**
+   * Merges the bases of two {@link PointerTargetSet}s and collects the bases that occur only in
+   * one of them.
+   */
+  private static PersistentSortedMap<String, CType> mergeBases(
+      final PointerTargetSet pts1,
+      final PointerTargetSet pts2,
+      final CopyOnWriteSortedMap<String, CType> basesOnlyPts1,
+      final CopyOnWriteSortedMap<String, CType> basesOnlyPts2) {
+    return merge(
+        pts1.getBases(),
+        pts2.getBases(),
+        Equivalence.equals(),
+        BaseUnitingConflictHandler.INSTANCE,
+        new MapsDifference.DefaultVisitor<String, CType>() {
+          @Override
+          public void leftValueOnly(String pKey, CType pLeftValue) {
+            basesOnlyPts1.put(pKey, pLeftValue);
+          }
+
+          @Override
+          public void rightValueOnly(String pKey, CType pRightValue) {
+            basesOnlyPts2.put(pKey, pRightValue);
+          }
+
+          @Override
+          public void differingValues(String pKey, CType pLeftValue, CType pRightValue) {
+            if (isFakeBaseType(pLeftValue) && !(pRightValue instanceof CElaboratedType)) {
+              basesOnlyPts2.put(pKey, pRightValue);
+            } else if (isFakeBaseType(pRightValue) && !(pLeftValue instanceof CElaboratedType)) {
+              basesOnlyPts1.put(pKey, pLeftValue);
+            }
+          }
+        });
+  }
+
+  /**
+   * Merges the fields of two {@link PointerTargetSet}s and collects the fields that occur only in
+   * one of them.
+   */
+  private static PersistentSortedMap<CompositeField, Boolean> mergeFields(
+      final PointerTargetSet pts1,
+      final PointerTargetSet pts2,
+      final CopyOnWriteSortedMap<CompositeField, Boolean> fieldsOnlyPts1,
+      final CopyOnWriteSortedMap<CompositeField, Boolean> fieldsOnlyPts2) {
+    return merge(
+        pts1.getFields(),
+        pts2.getFields(),
+        Equivalence.equals(),
+        PersistentSortedMaps.getExceptionMergeConflictHandler(),
+        new MapsDifference.DefaultVisitor<CompositeField, Boolean>() {
+          @Override
+          public void leftValueOnly(CompositeField pKey, Boolean pLeftValue) {
+            fieldsOnlyPts1.put(pKey, pLeftValue);
+          }
+
+          @Override
+          public void rightValueOnly(CompositeField pKey, Boolean pRightValue) {
+            fieldsOnlyPts2.put(pKey, pRightValue);
+          }
+        });
+  }
+
   /**
    * A handler for merge conflicts that appear when merging bases.
    */
@@ -464,9 +533,29 @@ class PointerTargetSetManager {
       }
     }
 
+    importConstraintCount.setNextValue(constraints.size());
     return constraints.get();
   }
 
+  /**
+   * Count the constraints that are necessary for retaining the memory contents of the targets of
+   * one region when merging two path formulas (for the statistics).
+   */
+  void addRetentionConstraintsToStats(int pCount) {
+    retentionConstraintCount.setNextValue(pCount);
+  }
+
+  void printStatistics(PrintStream out) {
+    StatisticsWriter.writingStatisticsTo(out)
+        .put("Merges of pointer-target sets", "")
+        .beginLevel()
+        .put(mergeCount)
+        .put(identicalMergeCount)
+        .put(sharedComponentCount)
+        .put(importConstraintCount)
+        .put(retentionConstraintCount);
+  }
+
   /**
    * Recursively adds pointer targets for every used (tracked) (sub)field of the newly allocated base.
    *
@@ -152,4 +152,9 @@ public class CountingRegionManager implements RegionManager {
     operationsCtr.setNextValue(1);
     return delegate.replace(pRegion, pOldPredicates, pNewPredicates);
   }
+
+  @Override
+  public boolean isThreadSafe() {
+    return delegate.isThreadSafe();
+  }
 }
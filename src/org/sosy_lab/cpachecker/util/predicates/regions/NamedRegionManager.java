@@ -331,4 +331,9 @@ public class NamedRegionManager implements RegionManager {
   public Region replace(Region pRegion, Region[] pOldPredicates, Region[] pNewPredicates) {
     return delegate.replace(pRegion, pOldPredicates, pNewPredicates);
   }
-}
\ No newline at end of file
+
+  @Override
+  public boolean isThreadSafe() {
+    return delegate.isThreadSafe();
+  }
+}
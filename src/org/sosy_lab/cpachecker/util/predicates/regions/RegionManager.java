@@ -93,4 +93,12 @@ public interface RegionManager extends RegionCreator {
    * We also assume identical lengths of the old and new predicates.
    */
   Region replace(Region region, Region[] oldPredicates, Region[] newPredicates);
+
+  /**
+   * Returns whether this RegionManager may be accessed concurrently by several threads
+   * without external synchronization.
+   */
+  default boolean isThreadSafe() {
+    return false;
+  }
 }
@@ -163,4 +163,9 @@ public class SynchronizedRegionManager implements RegionManager {
       return delegate.replace(pRegion, pOldPredicates, pNewPredicates);
     }
   }
+
+  @Override
+  public boolean isThreadSafe() {
+    return true;
+  }
 }
@@ -1151,6 +1151,15 @@ public class FormulaManagerView {
     return makeName(pVar, pSsa.getIndex(pVar));
   }
 
+  /**
+   * Add the given SSA index to a single variable name. Typically it is not necessary and not
+   * recommended to use this method, prefer more high-level methods like {@link
+   * #instantiate(Formula, SSAMap)}.
+   */
+  public static String instantiateVariableName(String pVar, int pIndex) {
+    return makeName(pVar, pIndex);
+  }
+
   /**
    * Uninstantiate a given formula.
    * (remove the SSA indices from its free variables and UFs)
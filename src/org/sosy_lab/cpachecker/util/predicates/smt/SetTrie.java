@@ -0,0 +1,131 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.smt;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.NavigableMap;
+import java.util.Set;
+import java.util.TreeMap;
+import org.checkerframework.checker.nullness.qual.Nullable;
+
+/**
+ * A set-trie that stores sets of elements and supports efficient queries whether a stored set is
+ * a subset or a superset of a given set.
+ *
+ * <p>Each element gets a dense integer id on its first insertion, and each stored set is inserted
+ * as the path of its sorted ids. A subset query then only follows edges that are labeled with
+ * elements of the query set, and a superset query can skip all edges with ids larger than the
+ * next required element.
+ *
+ * <p>This class is not thread-safe.
+ */
+final class SetTrie<T> {
+
+  private static final class Node {
+    private final NavigableMap<Integer, Node> children = new TreeMap<>();
+    private boolean isEndOfSet = false;
+  }
+
+  private final Map<T, Integer> ids = new HashMap<>();
+  private final Node root = new Node();
+  private int size = 0;
+
+  /** Store the given set. */
+  void add(Set<? extends T> pSet) {
+    int[] path = new int[pSet.size()];
+    int i = 0;
+    for (T element : pSet) {
+      Integer id = ids.get(element);
+      if (id == null) {
+        id = ids.size();
+        ids.put(element, id);
+      }
+      path[i++] = id;
+    }
+    Arrays.sort(path);
+
+    Node node = root;
+    for (int id : path) {
+      node = node.children.computeIfAbsent(id, k -> new Node());
+    }
+    if (!node.isEndOfSet) {
+      node.isEndOfSet = true;
+      size++;
+    }
+  }
+
+  /** Check whether a subset of the given set (including the set itself) is stored. */
+  boolean containsSubsetOf(Set<? extends T> pSet) {
+    // elements without id do not occur in any stored set and can be ignored
+    int[] query = toSortedIds(pSet, /* pIgnoreUnknown= */ true);
+    return query != null && containsSubsetOf(root, query, 0);
+  }
+
+  private static boolean containsSubsetOf(Node pNode, int[] pQuery, int pStart) {
+    if (pNode.isEndOfSet) {
+      return true;
+    }
+    for (int i = pStart; i < pQuery.length; i++) {
+      Node child = pNode.children.get(pQuery[i]);
+      if (child != null && containsSubsetOf(child, pQuery, i + 1)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** Check whether a superset of the given set (including the set itself) is stored. */
+  boolean containsSupersetOf(Set<? extends T> pSet) {
+    // elements without id do not occur in any stored set, so there cannot be a superset
+    int[] query = toSortedIds(pSet, /* pIgnoreUnknown= */ false);
+    return query != null && containsSupersetOf(root, query, 0);
+  }
+
+  private static boolean containsSupersetOf(Node pNode, int[] pQuery, int pStart) {
+    if (pStart == pQuery.length) {
+      // every node is on the path of at least one stored set
+      return pNode.isEndOfSet || !pNode.children.isEmpty();
+    }
+    int next = pQuery[pStart];
+    for (Map.Entry<Integer, Node> child : pNode.children.headMap(next, true).entrySet()) {
+      int nextStart = child.getKey() == next ? pStart + 1 : pStart;
+      if (containsSupersetOf(child.getValue(), pQuery, nextStart)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Return the sorted ids of the given elements. Unknown elements are skipped if requested,
+   * otherwise null is returned if there is an unknown element.
+   */
+  private int @Nullable [] toSortedIds(Set<? extends T> pSet, boolean pIgnoreUnknown) {
+    int[] result = new int[pSet.size()];
+    int i = 0;
+    for (T element : pSet) {
+      Integer id = ids.get(element);
+      if (id != null) {
+        result[i++] = id;
+      } else if (!pIgnoreUnknown) {
+        return null;
+      }
+    }
+    result = Arrays.copyOf(result, i);
+    Arrays.sort(result);
+    return result;
+  }
+
+  /** Return the number of stored sets. */
+  int size() {
+    return size;
+  }
+}
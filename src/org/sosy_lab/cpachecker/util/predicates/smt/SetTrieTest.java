@@ -0,0 +1,74 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.smt;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableSet;
+import org.junit.Before;
+import org.junit.Test;
+
+public class SetTrieTest {
+
+  private SetTrie<String> trie;
+
+  @Before
+  public void init() {
+    trie = new SetTrie<>();
+  }
+
+  @Test
+  public void testEmpty() {
+    assertThat(trie.containsSubsetOf(ImmutableSet.of("a"))).isFalse();
+    assertThat(trie.containsSupersetOf(ImmutableSet.of())).isFalse();
+    assertThat(trie.size()).isEqualTo(0);
+  }
+
+  @Test
+  public void testSubset() {
+    trie.add(ImmutableSet.of("b", "c"));
+    trie.add(ImmutableSet.of("a", "d"));
+
+    assertThat(trie.containsSubsetOf(ImmutableSet.of("c", "b"))).isTrue();
+    assertThat(trie.containsSubsetOf(ImmutableSet.of("a", "b", "c", "x"))).isTrue();
+    assertThat(trie.containsSubsetOf(ImmutableSet.of("a", "x", "d"))).isTrue();
+    assertThat(trie.containsSubsetOf(ImmutableSet.of("a", "b"))).isFalse();
+    assertThat(trie.containsSubsetOf(ImmutableSet.of("x"))).isFalse();
+  }
+
+  @Test
+  public void testEmptySetIsSubsetOfEverything() {
+    trie.add(ImmutableSet.of());
+
+    assertThat(trie.containsSubsetOf(ImmutableSet.of())).isTrue();
+    assertThat(trie.containsSubsetOf(ImmutableSet.of("x"))).isTrue();
+  }
+
+  @Test
+  public void testSuperset() {
+    trie.add(ImmutableSet.of("a", "b", "c"));
+    trie.add(ImmutableSet.of("d", "e"));
+
+    assertThat(trie.containsSupersetOf(ImmutableSet.of())).isTrue();
+    assertThat(trie.containsSupersetOf(ImmutableSet.of("c", "a"))).isTrue();
+    assertThat(trie.containsSupersetOf(ImmutableSet.of("a", "b", "c"))).isTrue();
+    assertThat(trie.containsSupersetOf(ImmutableSet.of("e"))).isTrue();
+    assertThat(trie.containsSupersetOf(ImmutableSet.of("a", "e"))).isFalse();
+    assertThat(trie.containsSupersetOf(ImmutableSet.of("a", "x"))).isFalse();
+  }
+
+  @Test
+  public void testSize() {
+    trie.add(ImmutableSet.of("a", "b"));
+    trie.add(ImmutableSet.of("b", "a"));
+    trie.add(ImmutableSet.of("a"));
+
+    assertThat(trie.size()).isEqualTo(2);
+  }
+}
@@ -14,19 +14,18 @@ import static org.sosy_lab.java_smt.api.SolverContext.ProverOptions.GENERATE_UNS
 
 import com.google.common.annotations.VisibleForTesting;
 import com.google.common.base.Verify;
-import com.google.common.collect.ImmutableMap;
 import com.google.common.collect.ImmutableSet;
 import edu.umd.cs.findbugs.annotations.SuppressFBWarnings;
 import java.io.PrintStream;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
-import java.util.Map.Entry;
 import java.util.Set;
 import java.util.concurrent.TimeUnit;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -36,6 +35,8 @@ import org.sosy_lab.cpachecker.util.predicates.interpolation.SeparateInterpolati
 import org.sosy_lab.cpachecker.util.predicates.ufCheckingProver.UFCheckingBasicProverEnvironment.UFCheckingProverOptions;
 import org.sosy_lab.cpachecker.util.predicates.ufCheckingProver.UFCheckingInterpolatingProverEnvironment;
 import org.sosy_lab.cpachecker.util.predicates.ufCheckingProver.UFCheckingProverEnvironment;
+import org.sosy_lab.cpachecker.util.resources.MemoryPressureMonitor;
+import org.sosy_lab.cpachecker.util.statistics.TraceEvents.SatCheckEvent;
 import org.sosy_lab.java_smt.SolverContextFactory;
 import org.sosy_lab.java_smt.SolverContextFactory.Solvers;
 import org.sosy_lab.java_smt.api.BooleanFormula;
@@ -85,6 +86,16 @@ public final class Solver implements AutoCloseable {
   description="Extract and cache unsat cores for satisfiability checking")
   private boolean cacheUnsatCores = true;
 
+  @Option(
+      secure = true,
+      description =
+          "Maximum number of constraint sets that are cached per group key"
+              + " for satisfiability checks of sets of constraints."
+              + " If the limit is reached, the cache for this key is cleared."
+              + " Use -1 to disable the limit.")
+  @IntegerOption(min = -1)
+  private int groupedUnsatCacheSize = -1;
+
   @Option(
       secure = true,
       description =
@@ -105,15 +116,23 @@ public final class Solver implements AutoCloseable {
   /**
    * More complex unsat cache, grouped by an arbitrary key.
    *
-   * <p>For each node, map a set of constraints to whether it is unsatisfiable
-   * or satisfiable (maps to |true| <=> |UNSAT|).
+   * <p>For each node, store the sets of constraints that are known to be unsatisfiable
+   * and those that are known to be satisfiable.
    * If a set of constraints is satisfiable, any subset of it is also
    * satisfiable.
    * If a set of constraints is unsatisfiable, any superset of it is also
    * unsatisfiable.
    */
-  private final Map<Object, Map<Set<BooleanFormula>, Boolean>>
-      groupedUnsatCache = new HashMap<>();
+  private final Map<Object, GroupedUnsatCacheEntry> groupedUnsatCache = new HashMap<>();
+
+  private static final class GroupedUnsatCacheEntry {
+    private final SetTrie<BooleanFormula> unsatSets = new SetTrie<>();
+    private final SetTrie<BooleanFormula> satSets = new SetTrie<>();
+
+    private int size() {
+      return unsatSets.size() + satSets.size();
+    }
+  }
 
   private final LogManager logger;
 
@@ -122,6 +141,10 @@ public final class Solver implements AutoCloseable {
   public int satChecks = 0;
   public int trivialSatChecks = 0;
   public int cachedSatChecks = 0;
+  public final Timer groupedUnsatCacheLookupTime = new Timer();
+  public int groupedUnsatCacheLookups = 0;
+  public int groupedUnsatCacheHits = 0;
+  public int groupedUnsatCacheClears = 0;
 
   private Solver(
       Configuration config,
@@ -165,6 +188,9 @@ public final class Solver implements AutoCloseable {
     } else {
       ufCheckingProverOptions = null;
     }
+
+    MemoryPressureMonitor.registerCache(
+        this, "satisfiability checks", MemoryPressureMonitor.Priority.NORMAL, Solver::clearCaches);
   }
 
   /**
@@ -210,6 +236,9 @@ public final class Solver implements AutoCloseable {
     } else {
       ufCheckingProverOptions = null;
     }
+
+    MemoryPressureMonitor.registerCache(
+        this, "satisfiability checks", MemoryPressureMonitor.Priority.NORMAL, Solver::clearCaches);
   }
 
   /**
@@ -274,6 +303,17 @@ public final class Solver implements AutoCloseable {
    * formulas.
    */
   public void printStatistics(PrintStream pOut) {
+    if (groupedUnsatCacheLookups > 0) {
+      pOut.println();
+      writingStatisticsTo(pOut)
+          .put("Statistics about grouped unsat cache", "")
+          .beginLevel()
+          .put("Number of lookups", groupedUnsatCacheLookups)
+          .put("Number of hits", groupedUnsatCacheHits)
+          .put("Time for lookups", groupedUnsatCacheLookupTime)
+          .put("Number of cleared groups", groupedUnsatCacheClears)
+          .endLevel();
+    }
     if (solvingContext instanceof StatisticsSolverContext) {
       final SolverStatistics stats =
           ((StatisticsSolverContext) solvingContext).getSolverStatistics();
@@ -394,17 +434,27 @@ public final class Solver implements AutoCloseable {
     }
 
     solverTime.start();
+    SatCheckEvent event = new SatCheckEvent(1);
+    event.begin();
     try {
       result = isUnsatUncached(f);
+      event.setUnsat(result);
 
       unsatCache.put(f, result);
       return result;
 
     } finally {
+      event.commit();
       solverTime.stop();
     }
   }
 
+  /** Forget all cached results of satisfiability checks. */
+  public void clearCaches() {
+    unsatCache.clear();
+    groupedUnsatCache.clear();
+  }
+
   /**
    * Unsatisfiability check with more complex cache look up,
    * optionally based on unsat core.
@@ -417,9 +467,14 @@ public final class Solver implements AutoCloseable {
   public boolean isUnsat(Set<BooleanFormula> constraints, Object cacheKey)
       throws InterruptedException, SolverException {
     solverTime.start();
+    SatCheckEvent event = new SatCheckEvent(constraints.size());
+    event.begin();
     try {
-      return isUnsat0(constraints, cacheKey);
+      boolean result = isUnsat0(constraints, cacheKey);
+      event.setUnsat(result);
+      return result;
     } finally {
+      event.commit();
       solverTime.stop();
     }
   }
@@ -428,32 +483,37 @@ public final class Solver implements AutoCloseable {
       throws InterruptedException, SolverException {
     satChecks++;
 
-    Map<Set<BooleanFormula>, Boolean> stored = groupedUnsatCache.get(cacheKey);
+    GroupedUnsatCacheEntry stored = groupedUnsatCache.get(cacheKey);
     if (stored != null) {
-      for (Entry<Set<BooleanFormula>, Boolean> isUnsatResults : stored
-          .entrySet()) {
-        Set<BooleanFormula> cachedConstraints = isUnsatResults.getKey();
-        boolean cachedIsUnsat = isUnsatResults.getValue();
-
-        if (cachedIsUnsat && lemmas.containsAll(cachedConstraints)) {
+      groupedUnsatCacheLookups++;
+      groupedUnsatCacheLookupTime.start();
+      try {
+        if (stored.unsatSets.containsSubsetOf(lemmas)) {
 
           // Any superset of unreachable constraints is unreachable.
+          groupedUnsatCacheHits++;
           cachedSatChecks++;
           return true;
-        } else if (!cachedIsUnsat &&
-            cachedConstraints.containsAll(lemmas)) {
+        } else if (stored.satSets.containsSupersetOf(lemmas)) {
 
           // Any subset of reachable constraints is reachable.
+          groupedUnsatCacheHits++;
           cachedSatChecks++;
           return false;
         }
+      } finally {
+        groupedUnsatCacheLookupTime.stop();
+      }
+
+      if (groupedUnsatCacheSize >= 0 && stored.size() >= groupedUnsatCacheSize) {
+        groupedUnsatCacheClears++;
+        stored = null;
       }
     }
 
     if (stored == null) {
-      stored = new HashMap<>();
-    } else {
-      stored = new HashMap<>(stored);
+      stored = new GroupedUnsatCacheEntry();
+      groupedUnsatCache.put(cacheKey, stored);
     }
 
     ProverOptions[] opts;
@@ -470,17 +530,15 @@ public final class Solver implements AutoCloseable {
       }
       if (pe.isUnsat()) {
         if (cacheUnsatCores) {
-          stored.put(ImmutableSet.copyOf(pe.getUnsatCore()), true);
+          stored.unsatSets.add(ImmutableSet.copyOf(pe.getUnsatCore()));
         } else {
-          stored.put(ImmutableSet.copyOf(lemmas), true);
+          stored.unsatSets.add(lemmas);
         }
         return true;
       } else {
-        stored.put(lemmas, false);
+        stored.satSets.add(lemmas);
         return false;
       }
-    } finally {
-      groupedUnsatCache.put(cacheKey, ImmutableMap.copyOf(stored));
     }
   }
 
@@ -0,0 +1,204 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.smt;
+
+import static com.google.common.base.Preconditions.checkArgument;
+import static com.google.common.base.Preconditions.checkState;
+
+import com.google.common.collect.ImmutableList;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.atomic.AtomicInteger;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+
+/**
+ * A fixed-size pool of additional {@link Solver} instances for analyses that want to use SMT
+ * solving from several threads.
+ *
+ * <p>A solver context must never be used by more than one thread at the same time. The pool hands
+ * out each solver exclusively via {@link #acquire()} until the returned {@link PooledSolver} is
+ * closed again, such that the thread that acquired it can safely pass it to a worker thread.
+ *
+ * <p>Formulas are translated between the main solver context (the one of the given {@link
+ * FormulaManagerView}) and the pooled contexts with {@link PooledSolver#translateFromMain} and
+ * {@link PooledSolver#translateToMain}. These methods use the main solver context, so they must be
+ * called by the thread that owns the main solver, and only while no worker uses the pooled solver.
+ * The translations are cached per pooled solver, this avoids translating the same formulas (e.g.,
+ * predicates) again and again.
+ */
+@Options(prefix = "solver.pool")
+public final class SolverPool implements AutoCloseable {
+
+  @Option(
+      secure = true,
+      description =
+          "maximal number of translated formulas that are cached for each pooled solver instance,"
+              + " the cache is cleared if it gets larger (0 disables the cache)")
+  @IntegerOption(min = 0)
+  private int translationCacheSize = 10000;
+
+  private final FormulaManagerView mainFmgr;
+  private final ImmutableList<PooledSolver> solvers;
+  private final BlockingQueue<PooledSolver> idle;
+
+  private final AtomicInteger translations = new AtomicInteger();
+  private final AtomicInteger cachedTranslations = new AtomicInteger();
+
+  /**
+   * Create a pool with a fixed number of solvers.
+   *
+   * @param pConfig The configuration for the pooled solvers.
+   * @param pMainFmgr The formula manager of the main solver, from and to which formulas are
+   *     translated.
+   * @param pSize The number of solver instances.
+   */
+  public SolverPool(
+      Configuration pConfig,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier,
+      FormulaManagerView pMainFmgr,
+      int pSize)
+      throws InvalidConfigurationException {
+    checkArgument(pSize >= 0, "negative size of solver pool");
+    pConfig.inject(this);
+    mainFmgr = pMainFmgr;
+
+    ImmutableList.Builder<PooledSolver> builder = ImmutableList.builderWithExpectedSize(pSize);
+    try {
+      for (int i = 0; i < pSize; i++) {
+        builder.add(new PooledSolver(Solver.create(pConfig, pLogger, pShutdownNotifier)));
+      }
+    } catch (InvalidConfigurationException | RuntimeException e) {
+      for (PooledSolver solver : builder.build()) {
+        solver.solver.close();
+      }
+      throw e;
+    }
+    solvers = builder.build();
+    idle = new LinkedBlockingQueue<>(solvers);
+  }
+
+  /** Return the number of solver instances in this pool. */
+  public int size() {
+    return solvers.size();
+  }
+
+  /**
+   * Get a solver for exclusive use, waiting until one is free.
+   * The solver needs to be released by closing it.
+   */
+  public PooledSolver acquire() throws InterruptedException {
+    checkState(!solvers.isEmpty(), "acquiring solver from empty pool");
+    PooledSolver solver = idle.take();
+    solver.inUse = true;
+    return solver;
+  }
+
+  /**
+   * Get a solver for exclusive use if one is free.
+   *
+   * @return A solver that needs to be released by closing it, or null if no solver is free.
+   */
+  public @Nullable PooledSolver tryAcquire() {
+    PooledSolver solver = idle.poll();
+    if (solver != null) {
+      solver.inUse = true;
+    }
+    return solver;
+  }
+
+  /** Return the number of translations that were requested and how many came from the cache. */
+  public String getTranslationStatistics() {
+    return cachedTranslations.get() + " of " + translations.get() + " from cache";
+  }
+
+  /** Close all solvers. This must not be called while solvers are still in use. */
+  @Override
+  public void close() {
+    for (PooledSolver solver : solvers) {
+      solver.solver.close();
+    }
+  }
+
+  /** A solver instance of a {@link SolverPool}. Closing it returns it to the pool. */
+  public final class PooledSolver implements AutoCloseable {
+
+    private final Solver solver;
+    private final FormulaManagerView fmgr;
+    private final Map<BooleanFormula, BooleanFormula> fromMainCache = new HashMap<>();
+    private final Map<BooleanFormula, BooleanFormula> toMainCache = new HashMap<>();
+    private volatile boolean inUse = false;
+
+    private PooledSolver(Solver pSolver) {
+      solver = pSolver;
+      fmgr = pSolver.getFormulaManager();
+    }
+
+    public Solver getSolver() {
+      return solver;
+    }
+
+    public FormulaManagerView getFormulaManager() {
+      return fmgr;
+    }
+
+    /** Translate a formula from the main solver context into the context of this solver. */
+    public BooleanFormula translateFromMain(BooleanFormula pFormula) {
+      return translate(pFormula, fromMainCache, toMainCache, fmgr, mainFmgr);
+    }
+
+    /** Translate a formula from the context of this solver into the main solver context. */
+    public BooleanFormula translateToMain(BooleanFormula pFormula) {
+      return translate(pFormula, toMainCache, fromMainCache, mainFmgr, fmgr);
+    }
+
+    private BooleanFormula translate(
+        BooleanFormula pFormula,
+        Map<BooleanFormula, BooleanFormula> pCache,
+        Map<BooleanFormula, BooleanFormula> pReverseCache,
+        FormulaManagerView pTarget,
+        FormulaManagerView pSource) {
+      checkState(inUse, "translating formulas for released solver");
+      translations.incrementAndGet();
+      BooleanFormula result = pCache.get(pFormula);
+      if (result != null) {
+        cachedTranslations.incrementAndGet();
+        return result;
+      }
+      result = pTarget.translateFrom(pFormula, pSource);
+      if (translationCacheSize > 0) {
+        if (pCache.size() >= translationCacheSize || pReverseCache.size() >= translationCacheSize) {
+          pCache.clear();
+          pReverseCache.clear();
+        }
+        pCache.put(pFormula, result);
+        pReverseCache.put(result, pFormula);
+      }
+      return result;
+    }
+
+    /** Return this solver to the pool. */
+    @Override
+    public void close() {
+      checkState(inUse, "releasing solver twice");
+      inUse = false;
+      idle.add(this);
+    }
+  }
+}
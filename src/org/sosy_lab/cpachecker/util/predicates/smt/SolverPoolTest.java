@@ -0,0 +1,77 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.smt;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool.PooledSolver;
+import org.sosy_lab.cpachecker.util.test.TestDataTools;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.NumeralFormula.IntegerFormula;
+
+public class SolverPoolTest {
+
+  private Solver solver;
+  private SolverPool pool;
+
+  @Before
+  public void setUp() throws Exception {
+    Configuration config =
+        TestDataTools.configurationForTest().setOption("solver.solver", "smtinterpol").build();
+    LogManager logger = LogManager.createTestLogManager();
+    ShutdownNotifier notifier = ShutdownNotifier.createDummy();
+    solver = Solver.create(config, logger, notifier);
+    pool = new SolverPool(config, logger, notifier, solver.getFormulaManager(), 2);
+  }
+
+  @After
+  public void tearDown() {
+    pool.close();
+    solver.close();
+  }
+
+  private BooleanFormula makeFormula(FormulaManagerView fmgr) {
+    IntegerFormulaManagerView imgr = fmgr.getIntegerFormulaManager();
+    IntegerFormula x = imgr.makeVariable("x");
+    return imgr.greaterThan(x, imgr.makeNumber(1));
+  }
+
+  @Test
+  public void testAcquireAndRelease() throws Exception {
+    assertThat(pool.size()).isEqualTo(2);
+    PooledSolver first = pool.acquire();
+    PooledSolver second = pool.acquire();
+    assertThat(second).isNotSameInstanceAs(first);
+    assertThat(pool.tryAcquire()).isNull();
+
+    first.close();
+    PooledSolver third = pool.tryAcquire();
+    assertThat(third).isSameInstanceAs(first);
+    third.close();
+    second.close();
+  }
+
+  @Test
+  public void testTranslation() throws Exception {
+    BooleanFormula main = makeFormula(solver.getFormulaManager());
+    try (PooledSolver pooled = pool.acquire()) {
+      BooleanFormula translated = pooled.translateFromMain(main);
+      assertThat(translated).isEqualTo(makeFormula(pooled.getFormulaManager()));
+      assertThat(pooled.translateFromMain(main)).isSameInstanceAs(translated);
+      assertThat(pooled.translateToMain(translated)).isSameInstanceAs(main);
+    }
+    assertThat(pool.getTranslationStatistics()).isEqualTo("2 of 3 from cache");
+  }
+}
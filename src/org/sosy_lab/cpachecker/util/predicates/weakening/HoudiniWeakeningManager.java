@@ -0,0 +1,316 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.predicates.weakening;
+
+import static com.google.common.collect.FluentIterable.from;
+
+import com.google.common.base.Throwables;
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
+import com.google.common.util.concurrent.Uninterruptibles;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.Classes.UnexpectedCheckedException;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormula;
+import org.sosy_lab.cpachecker.util.predicates.smt.FormulaManagerView;
+import org.sosy_lab.cpachecker.util.predicates.smt.Solver;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool;
+import org.sosy_lab.cpachecker.util.predicates.smt.SolverPool.PooledSolver;
+import org.sosy_lab.cpachecker.util.predicates.weakening.InductiveWeakeningManager.InductiveWeakeningStatistics;
+import org.sosy_lab.java_smt.api.BooleanFormula;
+import org.sosy_lab.java_smt.api.BooleanFormulaManager;
+import org.sosy_lab.java_smt.api.Model;
+import org.sosy_lab.java_smt.api.ProverEnvironment;
+import org.sosy_lab.java_smt.api.SolverContext.ProverOptions;
+import org.sosy_lab.java_smt.api.SolverException;
+
+/**
+ * Perform weakening with the Houdini algorithm: every lemma that is violated after the transition
+ * is dropped, until the remaining lemmas are inductive.
+ *
+ * <p>With more than one thread, the lemmas are partitioned between the solvers of a {@link
+ * SolverPool}, which check their part in parallel. A dropped lemma is immediately visible to all
+ * workers and is no longer assumed by their next check. The result does not depend on the number
+ * of threads: it is always the largest inductive subset of the lemmas.
+ */
+class HoudiniWeakeningManager {
+
+  private final Solver solver;
+  private final BooleanFormulaManager bfmgr;
+  private final WeakeningOptions options;
+  private final LogManager logger;
+  private final ShutdownNotifier shutdownNotifier;
+  private final InductiveWeakeningStatistics statistics;
+
+  // created on first parallel weakening
+  private @Nullable SolverPool solverPool = null;
+  private @Nullable ExecutorService executor = null;
+
+  HoudiniWeakeningManager(
+      Solver pSolver,
+      WeakeningOptions pOptions,
+      InductiveWeakeningStatistics pStatistics,
+      LogManager pLogger,
+      ShutdownNotifier pShutdownNotifier) {
+    solver = pSolver;
+    bfmgr = pSolver.getFormulaManager().getBooleanFormulaManager();
+    options = pOptions;
+    statistics = pStatistics;
+    logger = pLogger;
+    shutdownNotifier = pShutdownNotifier;
+  }
+
+  /**
+   * Returns set of selectors which should be abstracted.
+   *
+   * @param selectionVarsInfo Mapping from the selectors to the (uninstantiated) lemmas they
+   *     annotate.
+   * @param fromState Instantiated formula representing the state before the transition, may
+   *     contain the selectors.
+   * @param transition Transition under which inductiveness should hold.
+   */
+  Set<BooleanFormula> performWeakening(
+      Map<BooleanFormula, BooleanFormula> selectionVarsInfo,
+      BooleanFormula fromState,
+      PathFormula transition)
+      throws SolverException, InterruptedException {
+    FormulaManagerView fmgr = solver.getFormulaManager();
+    ImmutableList<BooleanFormula> selectors = ImmutableList.copyOf(selectionVarsInfo.keySet());
+    ImmutableList<BooleanFormula> lemmas =
+        from(selectors)
+            .transform(s -> fmgr.instantiate(selectionVarsInfo.get(s), transition.getSsa()))
+            .toList();
+    BooleanFormula query = bfmgr.and(fromState, transition.getFormula());
+    Set<Integer> dropped = ConcurrentHashMap.newKeySet();
+
+    int threads = Math.min(options.getHoudiniThreads(), selectors.size());
+    if (threads > 1) {
+      weakenInParallel(query, selectors, lemmas, dropped, threads);
+    } else {
+      List<Integer> all = new ArrayList<>(selectors.size());
+      for (int i = 0; i < selectors.size(); i++) {
+        all.add(i);
+      }
+      try (Worker worker = new Worker(solver, query, selectors, lemmas, all, dropped)) {
+        worker.call();
+      }
+      statistics.iterationsNo.add(1);
+    }
+    return from(dropped).transform(selectors::get).toSet();
+  }
+
+  private void weakenInParallel(
+      BooleanFormula query,
+      List<BooleanFormula> selectors,
+      List<BooleanFormula> lemmas,
+      Set<Integer> dropped,
+      int threads)
+      throws SolverException, InterruptedException {
+    SolverPool pool = getSolverPool();
+    List<PooledSolver> acquired = new ArrayList<>(threads);
+    List<Worker> workers = new ArrayList<>(threads);
+    try {
+      for (int k = 0; k < threads; k++) {
+        PooledSolver pooled = pool.acquire();
+        acquired.add(pooled);
+        List<Integer> partition = new ArrayList<>();
+        for (int i = k; i < selectors.size(); i += threads) {
+          partition.add(i);
+        }
+        // translate on this thread, our solver context must not be used by the workers
+        workers.add(
+            new Worker(
+                pooled.getSolver(),
+                pooled.translateFromMain(query),
+                from(selectors).transform(pooled::translateFromMain).toList(),
+                from(lemmas).transform(pooled::translateFromMain).toList(),
+                partition,
+                dropped));
+      }
+
+      // If some lemma was dropped during a round, a worker might have finished its partition
+      // while still assuming the dropped lemma, so its part needs to be checked again.
+      int rounds = 0;
+      int droppedBefore;
+      do {
+        droppedBefore = dropped.size();
+        rounds++;
+        runRound(workers);
+      } while (dropped.size() != droppedBefore);
+      statistics.iterationsNo.add(rounds);
+
+    } finally {
+      for (Worker worker : workers) {
+        worker.close();
+      }
+      for (PooledSolver pooled : acquired) {
+        pooled.close();
+      }
+    }
+  }
+
+  private void runRound(List<Worker> workers) throws SolverException, InterruptedException {
+    assert executor != null;
+    List<Future<Void>> futures = new ArrayList<>(workers.size());
+    try {
+      for (Worker worker : workers) {
+        futures.add(executor.submit(worker));
+      }
+      for (Future<Void> future : futures) {
+        try {
+          future.get();
+        } catch (ExecutionException e) {
+          Throwable t = e.getCause();
+          Throwables.propagateIfPossible(t, SolverException.class, InterruptedException.class);
+          throw new UnexpectedCheckedException("parallel inductive weakening", t);
+        }
+      }
+    } finally {
+      // the workers must not use their solvers anymore when we return
+      for (Future<?> future : futures) {
+        future.cancel(true);
+        try {
+          Uninterruptibles.getUninterruptibly(future);
+        } catch (ExecutionException | CancellationException e) {
+          // ignore, the exception was already handled above or the result is not relevant
+        }
+      }
+    }
+  }
+
+  private SolverPool getSolverPool() {
+    if (solverPool == null) {
+      try {
+        solverPool =
+            new SolverPool(
+                options.getConfiguration(),
+                logger,
+                shutdownNotifier,
+                solver.getFormulaManager(),
+                options.getHoudiniThreads());
+      } catch (InvalidConfigurationException e) {
+        throw new IllegalStateException("Invalid configuration for parallel weakening", e);
+      }
+      executor =
+          Executors.newFixedThreadPool(
+              options.getHoudiniThreads(),
+              new ThreadFactoryBuilder().setDaemon(true).setNameFormat("houdini-%d").build());
+    }
+    return solverPool;
+  }
+
+  /** Release the solvers and threads used for parallel weakening. */
+  void close() {
+    if (executor != null) {
+      executor.shutdownNow();
+    }
+    if (solverPool != null) {
+      solverPool.close();
+    }
+  }
+
+  /**
+   * Checks one partition of the lemmas on its own solver. All formulas belong to the context of
+   * this solver, the lemmas and selectors are identified across workers by their index.
+   */
+  private final class Worker implements Callable<Void>, AutoCloseable {
+
+    private final BooleanFormulaManager workerBfmgr;
+    private final ProverEnvironment prover;
+    private final List<BooleanFormula> selectors;
+    private final List<BooleanFormula> lemmas;
+    private final List<Integer> partition;
+    private final Set<Integer> dropped;
+
+    private Worker(
+        Solver pSolver,
+        BooleanFormula pQuery,
+        List<BooleanFormula> pSelectors,
+        List<BooleanFormula> pLemmas,
+        List<Integer> pPartition,
+        Set<Integer> pDropped)
+        throws InterruptedException {
+      workerBfmgr = pSolver.getFormulaManager().getBooleanFormulaManager();
+      selectors = pSelectors;
+      lemmas = pLemmas;
+      partition = pPartition;
+      dropped = pDropped;
+      prover = pSolver.newProverEnvironment(ProverOptions.GENERATE_MODELS);
+      prover.push(pQuery);
+    }
+
+    /** Drop lemmas of the partition until the remaining ones hold after the transition. */
+    @Override
+    public Void call() throws SolverException, InterruptedException {
+      while (true) {
+        shutdownNotifier.shutdownIfNecessary();
+        Set<Integer> droppedNow = ImmutableSet.copyOf(dropped);
+        List<Integer> candidates = from(partition).filter(i -> !droppedNow.contains(i)).toList();
+        if (candidates.isEmpty()) {
+          return null;
+        }
+
+        // Every lemma that was not dropped holds before the transition.
+        List<BooleanFormula> assumptions = new ArrayList<>(selectors.size());
+        for (int i = 0; i < selectors.size(); i++) {
+          BooleanFormula selector = selectors.get(i);
+          assumptions.add(droppedNow.contains(i) ? selector : workerBfmgr.not(selector));
+        }
+
+        prover.push(workerBfmgr.not(workerBfmgr.and(from(candidates).transform(lemmas::get).toList())));
+        try {
+          if (prover.isUnsatWithAssumptions(assumptions)) {
+            return null;
+          }
+          List<Integer> violated = new ArrayList<>();
+          try (Model m = prover.getModel()) {
+            for (int i : candidates) {
+              if (Boolean.FALSE.equals(m.evaluate(lemmas.get(i)))) {
+                violated.add(i);
+              }
+            }
+            if (violated.isEmpty()) {
+              // model is partial, dropping undecided lemmas is still sound
+              for (int i : candidates) {
+                if (!Boolean.TRUE.equals(m.evaluate(lemmas.get(i)))) {
+                  violated.add(i);
+                }
+              }
+            }
+          }
+          if (violated.isEmpty()) {
+            throw new IllegalStateException("Model does not violate any lemma");
+          }
+          dropped.addAll(violated);
+        } finally {
+          prover.pop();
+        }
+      }
+    }
+
+    @Override
+    public void close() {
+      prover.close();
+    }
+  }
+}
@@ -64,7 +64,13 @@ public class InductiveWeakeningManager implements StatisticsProvider {
     /**
      * Select literals to abstract based on the counterexamples-to-induction.
      */
-    CEX
+    CEX,
+
+    /**
+     * Drop all lemmas violated after the transition until a fixpoint is reached (Houdini),
+     * optionally checking the lemmas on several solvers in parallel.
+     */
+    HOUDINI
   }
 
   private final WeakeningOptions options;
@@ -77,6 +83,7 @@ public class InductiveWeakeningManager implements StatisticsProvider {
   private final SyntacticWeakeningManager syntacticWeakeningManager;
   private final DestructiveWeakeningManager destructiveWeakeningManager;
   private final CEXWeakeningManager cexWeakeningManager;
+  private final HoudiniWeakeningManager houdiniWeakeningManager;
   private final Solver solver;
 
   private static final String SELECTOR_VAR_TEMPLATE = "_FS_SEL_VAR_";
@@ -98,6 +105,8 @@ public class InductiveWeakeningManager implements StatisticsProvider {
     solver = pSolver;
     cexWeakeningManager =
         new CEXWeakeningManager(fmgr, pSolver, statistics, options, pShutdownNotifier);
+    houdiniWeakeningManager =
+        new HoudiniWeakeningManager(pSolver, options, statistics, pLogger, pShutdownNotifier);
   }
 
   /**
@@ -255,6 +264,10 @@ public class InductiveWeakeningManager implements StatisticsProvider {
             fromState,
             transition,
             toState);
+
+      case HOUDINI:
+        return houdiniWeakeningManager.performWeakening(selectionVarsInfo, fromState, transition);
+
       default:
         throw new UnsupportedOperationException("Unexpected enum value");
     }
@@ -326,6 +339,14 @@ public class InductiveWeakeningManager implements StatisticsProvider {
     return result.build();
   }
 
+  /**
+   * Release the additional solvers that were created for the 'HOUDINI' weakening strategy, if
+   * any. This manager must not be used afterwards.
+   */
+  public void close() {
+    houdiniWeakeningManager.close();
+  }
+
   @Override
   public void collectStatistics(Collection<Statistics> statsCollection) {
     statsCollection.add(statistics);
@@ -19,6 +19,7 @@ import org.junit.runners.Parameterized;
 import org.junit.runners.Parameterized.Parameter;
 import org.junit.runners.Parameterized.Parameters;
 import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.cpachecker.cfa.types.c.CNumericTypes;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.PathFormula;
 import org.sosy_lab.cpachecker.util.predicates.pathformula.SSAMap;
@@ -87,6 +88,60 @@ public class InductiveWeakeningManagerTest extends SolverViewBasedTest0 {
     );
   }
 
+  @Test
+  public void testHoudini() throws Exception {
+    checkHoudini(1);
+  }
+
+  @Test
+  public void testParallelHoudini() throws Exception {
+    checkHoudini(2);
+  }
+
+  private void checkHoudini(int threads) throws Exception {
+    Configuration houdiniConfig =
+        Configuration.builder()
+            .copyFrom(config)
+            .setOption("solver.solver", solverToUse().name())
+            .setOption("cpa.slicing.weakeningStrategy", "HOUDINI")
+            .setOption("cpa.slicing.houdiniThreads", Integer.toString(threads))
+            .build();
+    InductiveWeakeningManager houdiniManager =
+        new InductiveWeakeningManager(
+            new WeakeningOptions(houdiniConfig), solver, logger, ShutdownNotifier.createDummy());
+
+    // b' = b + 1, z' = b: "z = 0" is only inductive as long as "b = 0" is
+    SSAMap startingSsa = SSAMap.emptySSAMap().withDefault(0);
+    PathFormula transition =
+        new PathFormula(
+            bfmgr.and(
+                ifmgr.equal(
+                    ifmgr.makeVariable("b", 1),
+                    ifmgr.add(ifmgr.makeVariable("b", 0), ifmgr.makeNumber(1))),
+                ifmgr.equal(ifmgr.makeVariable("z", 1), ifmgr.makeVariable("b", 0))),
+            startingSsa
+                .builder()
+                .setIndex("b", CNumericTypes.INT, 1)
+                .setIndex("z", CNumericTypes.INT, 1)
+                .build(),
+            PointerTargetSet.emptyPointerTargetSet(),
+            0);
+    BooleanFormula bGreaterZero =
+        ifmgr.greaterOrEquals(ifmgr.makeVariable("b"), ifmgr.makeNumber(0));
+    Set<BooleanFormula> lemmas =
+        ImmutableSet.of(
+            ifmgr.equal(ifmgr.makeVariable("b"), ifmgr.makeNumber(0)),
+            ifmgr.equal(ifmgr.makeVariable("z"), ifmgr.makeNumber(0)),
+            bGreaterZero);
+    try {
+      Set<BooleanFormula> weakening =
+          houdiniManager.findInductiveWeakeningForRCNF(startingSsa, transition, lemmas);
+      assertThat(weakening).containsExactly(bGreaterZero);
+    } finally {
+      houdiniManager.close();
+    }
+  }
+
   @Test public void testRemovingRedundancies() throws Exception {
     IntegerFormula x, y;
     x = ifmgr.makeVariable("x");
@@ -9,6 +9,7 @@
 package org.sosy_lab.cpachecker.util.predicates.weakening;
 
 import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -30,9 +31,20 @@ public class WeakeningOptions {
   @Option(description = "Depth limit for the 'LEAST_REMOVALS' strategy.")
   private int leastRemovalsDepthLimit = 2;
 
-  public WeakeningOptions(Configuration config)
+  @Option(
+      secure = true,
+      description =
+          "Number of solver instances that check the lemmas in parallel for the 'HOUDINI'"
+              + " weakening strategy")
+  @IntegerOption(min = 1)
+  private int houdiniThreads = 1;
+
+  private final Configuration config;
+
+  public WeakeningOptions(Configuration pConfig)
       throws InvalidConfigurationException {
-    config.inject(this);
+    pConfig.inject(this);
+    config = pConfig;
   }
 
   WEAKENING_STRATEGY getWeakeningStrategy() {
@@ -50,4 +62,13 @@ public class WeakeningOptions {
   int getLeastRemovalsDepthLimit() {
     return leastRemovalsDepthLimit;
   }
+
+  int getHoudiniThreads() {
+    return houdiniThreads;
+  }
+
+  /** The configuration for creating additional solver instances. */
+  Configuration getConfiguration() {
+    return config;
+  }
 }
\ No newline at end of file
@@ -8,9 +8,14 @@
 
 package org.sosy_lab.cpachecker.util.refinement;
 
+import com.google.common.collect.Lists;
 import java.util.Deque;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
 import java.util.Optional;
 import java.util.Set;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -51,6 +56,14 @@ public class GenericEdgeInterpolator<S extends ForgetfulState<T>, T, I extends I
   @Option(secure=true, description="whether or not to manage the callstack, which is needed for BAM")
   private boolean manageCallstack = true;
 
+  @Option(
+      secure = true,
+      description =
+          "cache the interpolants derived for a candidate interpolant and the remaining error"
+              + " path, such that later refinements re-use them for paths with the same suffix"
+              + " (only supported for the value analysis)")
+  private boolean cacheInterpolants = false;
+
   /**
    * the shutdownNotifier in use
    */
@@ -80,6 +93,11 @@ public class GenericEdgeInterpolator<S extends ForgetfulState<T>, T, I extends I
    */
   private final FeasibilityChecker<S> checker;
 
+  /**
+   * the root of the trie of (reversed) error-path suffixes for which interpolants are cached
+   */
+  private final SuffixNode<I> interpolantCache = new SuffixNode<>();
+
   /**
    * This method acts as the constructor of the class.
    */
@@ -189,6 +207,20 @@ public class GenericEdgeInterpolator<S extends ForgetfulState<T>, T, I extends I
       return interpolantManager.getTrueInterpolant();
     }
 
+    // the result of interpolation only depends on the candidate interpolant and the remaining path
+    SuffixNode<I> cacheEntry = null;
+    I candidateInterpolant = null;
+    if (cacheInterpolants && isCachingPossible(pErrorPath)) {
+      cacheEntry = getCacheEntry(remainingErrorPath);
+      if (cacheEntry != null) {
+        candidateInterpolant = interpolantManager.createInterpolant(initialSuccessor);
+        I cachedInterpolant = cacheEntry.interpolants.get(candidateInterpolant);
+        if (cachedInterpolant != null) {
+          return cachedInterpolant;
+        }
+      }
+    }
+
     for (MemoryLocation currentMemoryLocation : determineMemoryLocationsToInterpolateOn(initialSuccessor)) {
       shutdownNotifier.shutdownIfNecessary();
 
@@ -202,7 +234,44 @@ public class GenericEdgeInterpolator<S extends ForgetfulState<T>, T, I extends I
       }
     }
 
-    return interpolantManager.createInterpolant(initialSuccessor);
+    I interpolant = interpolantManager.createInterpolant(initialSuccessor);
+    if (cacheEntry != null) {
+      cacheEntry.interpolants.put(candidateInterpolant, interpolant);
+    }
+    return interpolant;
+  }
+
+  /**
+   * This method decides whether interpolants derived for the given error path may be cached, i.e.,
+   * whether the strongest-post operator and the feasibility checks along the path only depend on
+   * its edges and the given states, and not on other information of the path.
+   *
+   * @param pErrorPath the error path that is interpolated
+   * @return true, if interpolants for the given error path may be cached, else false
+   */
+  protected boolean isCachingPossible(final ARGPath pErrorPath) {
+    return false;
+  }
+
+  /**
+   * This method returns the node of the interpolant cache for the given remaining error path.
+   *
+   * @return the node for the given path, or null if the path cannot be identified by its edges
+   */
+  private @Nullable SuffixNode<I> getCacheEntry(final ARGPath pRemainingErrorPath) {
+    List<CFAEdge> edges = pRemainingErrorPath.getFullPath();
+    if (edges.isEmpty() && pRemainingErrorPath.size() > 1) {
+      // the holes in the path cannot be filled
+      return null;
+    }
+
+    // interpolations along a path query shorter and shorter suffixes,
+    // so the trie is built from the end of the paths
+    SuffixNode<I> node = interpolantCache;
+    for (CFAEdge edge : Lists.reverse(edges)) {
+      node = node.predecessors.computeIfAbsent(edge, e -> new SuffixNode<>());
+    }
+    return node;
   }
 
   /**
@@ -314,4 +383,17 @@ public class GenericEdgeInterpolator<S extends ForgetfulState<T>, T, I extends I
     //|| cfaEdge.getEdgeType() == CFAEdgeType.ReturnStatementEdge
     ;
   }
+
+  /**
+   * A node of the interpolant cache, representing the error-path suffix consisting of the edges on
+   * the way from this node to the root.
+   */
+  private static final class SuffixNode<I> {
+
+    /** the nodes for the suffixes that extend this suffix by one edge at its front */
+    private final Map<CFAEdge, SuffixNode<I>> predecessors = new HashMap<>();
+
+    /** the interpolants for this suffix, by their candidate interpolants */
+    private final Map<I, I> interpolants = new HashMap<>();
+  }
 }
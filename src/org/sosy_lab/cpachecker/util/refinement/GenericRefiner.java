@@ -8,18 +8,28 @@
 
 package org.sosy_lab.cpachecker.util.refinement;
 
+import com.google.common.base.Throwables;
 import com.google.common.collect.ImmutableList;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
 import com.google.errorprone.annotations.ForOverride;
 import java.io.PrintStream;
+import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.HashSet;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.logging.Level;
+import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -95,6 +105,16 @@ public abstract class GenericRefiner<S extends ForgetfulState<?>, I extends Inte
       + " e.g., for supporting counterexample checks")
   private boolean addAssumptionsToCex = true;
 
+  @Option(
+      secure = true,
+      description =
+          "number of threads for interpolating the paths of an interpolation tree in parallel."
+              + " This only has an effect if the paths are independent of each other,"
+              + " i.e., for the bottom-up interpolation strategy,"
+              + " and if the refiner supports parallel interpolation.")
+  @IntegerOption(min = 1)
+  private int interpolationThreads = 1;
+
   protected final LogManager logger;
 
   private final PathInterpolator<I> interpolator;
@@ -107,6 +127,11 @@ public abstract class GenericRefiner<S extends ForgetfulState<?>, I extends Inte
 
   private Set<Integer> previousErrorPathIds = new HashSet<>();
 
+  /** one interpolator per thread, created lazily for parallel interpolation */
+  private @Nullable List<PathInterpolator<I>> threadInterpolators = null;
+
+  private @Nullable ExecutorService interpolationExecutor = null;
+
   // statistics
   private final StatCounter refinementCounter = new StatCounter("Number of refinements");
   private final StatInt numberOfTargets = new StatInt(StatKind.SUM, "Number of targets found");
@@ -160,7 +185,7 @@ public abstract class GenericRefiner<S extends ForgetfulState<?>, I extends Inte
     // (ABE) block, which may not be visible when constructing the target path in the next refinement.
     // Possible problem: alternating error-paths
     if (repeatingCEX && searchForFurtherErrorPaths) {
-      for (ARGPath targetPath : pathExtractor.getTargetPaths(targets)) {
+      for (ARGPath targetPath : pathExtractor.getTargetPaths(pReached, targets)) {
         if (madeProgress(targetPath)) {
           logger.log(Level.INFO, "The error path given to", getClass().getSimpleName(), "is a repeated counterexample,",
               "so instead, refiner uses a new error path extracted from the reachset.");
@@ -183,7 +208,8 @@ public abstract class GenericRefiner<S extends ForgetfulState<?>, I extends Inte
     CounterexampleInfo cex = isPathFeasible(targetPathToUse);
 
     if (cex.isSpurious()) {
-      refineUsingInterpolants(pReached, obtainInterpolants(targetPathToUse));
+      refineUsingInterpolants(
+          pReached, obtainInterpolants(getPathsForInterpolation(pReached, targetPathToUse)));
     }
 
     refinementTime.stop();
@@ -196,14 +222,49 @@ public abstract class GenericRefiner<S extends ForgetfulState<?>, I extends Inte
       final InterpolationTree<S, I> pInterpolationTree
       ) throws InterruptedException;
 
-  private InterpolationTree<S, I> obtainInterpolants(ARGPath pTargetPath)
+  /**
+   * This method returns the paths that are interpolated together with the given infeasible target
+   * path. All returned paths have to be infeasible.
+   */
+  @ForOverride
+  protected List<ARGPath> getPathsForInterpolation(
+      final ARGReachedSet pReached, final ARGPath pInfeasibleTargetPath)
+      throws CPAException, InterruptedException {
+    return ImmutableList.of(pInfeasibleTargetPath);
+  }
+
+  /**
+   * This method returns the given infeasible target path, followed by the infeasible paths to all
+   * other target states that the {@link PathExtractor} provides for the given reached set.
+   */
+  protected final List<ARGPath> getInfeasibleTargetPaths(
+      final ARGReachedSet pReached, final ARGPath pInfeasibleTargetPath)
+      throws CPAException, InterruptedException {
+    List<ARGPath> infeasiblePaths = new ArrayList<>();
+    infeasiblePaths.add(pInfeasibleTargetPath);
+    Collection<ARGState> targets = pathExtractor.getTargetStates(pReached);
+    for (ARGPath targetPath : pathExtractor.getTargetPaths(pReached, targets)) {
+      if (!targetPath.getLastState().equals(pInfeasibleTargetPath.getLastState())
+          && !isErrorPathFeasible(targetPath)) {
+        infeasiblePaths.add(targetPath);
+      }
+    }
+    return infeasiblePaths;
+  }
+
+  private InterpolationTree<S, I> obtainInterpolants(List<ARGPath> pTargetPaths)
       throws CPAException, InterruptedException {
 
-    InterpolationTree<S, I> interpolationTree =
-        createInterpolationTree(ImmutableList.of(pTargetPath));
+    InterpolationTree<S, I> interpolationTree = createInterpolationTree(pTargetPaths);
 
-    while (interpolationTree.hasNextPathForInterpolation()) {
-      performPathInterpolation(interpolationTree);
+    if (interpolationTree.hasIndependentPaths() && isParallelInterpolationAvailable()) {
+      while (interpolationTree.hasNextPathForInterpolation()) {
+        performParallelPathInterpolation(interpolationTree);
+      }
+    } else {
+      while (interpolationTree.hasNextPathForInterpolation()) {
+        performPathInterpolation(interpolationTree);
+      }
     }
 
     exportTree(interpolationTree, "FINAL");
@@ -242,6 +303,94 @@ public abstract class GenericRefiner<S extends ForgetfulState<?>, I extends Inte
     exportTree(interpolationTree, "ALWAYS");
   }
 
+  /**
+   * This method interpolates the next paths of the given interpolation tree in parallel, at most
+   * one path per thread. The interpolants are added to the tree in the order of the paths, so the
+   * result does not depend on the scheduling of the threads.
+   */
+  private void performParallelPathInterpolation(InterpolationTree<S, I> interpolationTree)
+      throws CPAException, InterruptedException {
+    List<ARGPath> errorPaths = new ArrayList<>(threadInterpolators.size());
+    do {
+      ARGPath errorPath = interpolationTree.getNextPathForInterpolation();
+      if (errorPath == InterpolationTree.EMPTY_PATH) {
+        logger.log(Level.FINEST, "skipping interpolation,"
+            + " because false interpolant on path to target state");
+      } else {
+        errorPaths.add(errorPath);
+      }
+    } while (errorPaths.size() < threadInterpolators.size()
+        && interpolationTree.hasNextPathForInterpolation());
+
+    List<Future<Map<ARGState, I>>> interpolants = new ArrayList<>(errorPaths.size());
+    try {
+      for (int i = 0; i < errorPaths.size(); i++) {
+        // independent paths start at the root, so the initial interpolant is never too weak
+        ARGPath errorPath = errorPaths.get(i);
+        I initialItp = interpolationTree.getInitialInterpolantForPath(errorPath);
+        PathInterpolator<I> threadInterpolator = threadInterpolators.get(i);
+        interpolants.add(
+            interpolationExecutor.submit(
+                () -> threadInterpolator.performInterpolation(errorPath, initialItp)));
+      }
+      for (Future<Map<ARGState, I>> pathInterpolants : interpolants) {
+        interpolationTree.addInterpolants(pathInterpolants.get());
+      }
+    } catch (ExecutionException e) {
+      Throwables.throwIfInstanceOf(e.getCause(), CPAException.class);
+      Throwables.throwIfInstanceOf(e.getCause(), InterruptedException.class);
+      Throwables.throwIfUnchecked(e.getCause());
+      throw new AssertionError(e);
+    } finally {
+      for (Future<?> pathInterpolants : interpolants) {
+        pathInterpolants.cancel(true);
+      }
+    }
+    exportTree(interpolationTree, "ALWAYS");
+  }
+
+  private boolean isParallelInterpolationAvailable() throws CPAException {
+    if (interpolationThreads <= 1) {
+      return false;
+    }
+    if (threadInterpolators == null) {
+      List<PathInterpolator<I>> interpolators = new ArrayList<>(interpolationThreads);
+      try {
+        for (int i = 0; i < interpolationThreads; i++) {
+          PathInterpolator<I> threadInterpolator = createPathInterpolatorForThread();
+          if (threadInterpolator == null) {
+            logger.log(Level.WARNING, getClass().getSimpleName(),
+                "does not support parallel interpolation, interpolating sequentially.");
+            interpolationThreads = 1;
+            return false;
+          }
+          interpolators.add(threadInterpolator);
+        }
+      } catch (InvalidConfigurationException e) {
+        throw new CPAException("Could not create interpolator for parallel interpolation", e);
+      }
+      threadInterpolators = interpolators;
+      interpolationExecutor =
+          Executors.newFixedThreadPool(
+              interpolationThreads,
+              new ThreadFactoryBuilder().setDaemon(true).setNameFormat("interpolation-%d").build());
+    }
+    return true;
+  }
+
+  /**
+   * This method creates an additional path interpolator for one of the threads used for parallel
+   * interpolation. The interpolator must not share any mutable state with other interpolators.
+   *
+   * @return a new interpolator, or null if the refiner does not support parallel interpolation
+   * @throws InvalidConfigurationException may be thrown in subclass
+   */
+  @ForOverride
+  protected @Nullable PathInterpolator<I> createPathInterpolatorForThread()
+      throws InvalidConfigurationException {
+    return null;
+  }
+
   private boolean isInitialInterpolantTooWeak(ARGState root, I initialItp, ARGPath errorPath)
       throws CPAException, InterruptedException {
 
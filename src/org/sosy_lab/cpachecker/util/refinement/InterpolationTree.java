@@ -202,6 +202,17 @@ public class InterpolationTree<S extends AbstractState, I extends Interpolant<S,
     return strategy.hasNextPathForInterpolation();
   }
 
+  /**
+   * This method decides whether the paths for interpolation are independent of each other, i.e.,
+   * whether the initial interpolant of a path does not depend on the interpolants of other paths.
+   * Then, several paths can be interpolated at once.
+   *
+   * @return true if the paths for interpolation are independent of each other, else false
+   */
+  public boolean hasIndependentPaths() {
+    return strategy.hasIndependentPaths();
+  }
+
   /**
    * This method exports the current representation in dot format to the given file.
    *
@@ -468,6 +479,8 @@ public class InterpolationTree<S extends AbstractState, I extends Interpolant<S,
 
     boolean hasNextPathForInterpolation();
 
+    boolean hasIndependentPaths();
+
     I getInitialInterpolantForRoot(ARGState root);
   }
 
@@ -540,6 +553,12 @@ public class InterpolationTree<S extends AbstractState, I extends Interpolant<S,
     public boolean hasNextPathForInterpolation() {
       return !sources.isEmpty();
     }
+
+    @Override
+    public boolean hasIndependentPaths() {
+      // paths start at the states where the previous paths branched off
+      return false;
+    }
   }
 
   private class BottomUpInterpolationStrategy implements InterpolationStrategy<I> {
@@ -591,5 +610,11 @@ public class InterpolationTree<S extends AbstractState, I extends Interpolant<S,
     public boolean hasNextPathForInterpolation() {
       return !sources.isEmpty();
     }
+
+    @Override
+    public boolean hasIndependentPaths() {
+      // all paths start at the root with the initial interpolant
+      return true;
+    }
   }
 }
@@ -32,6 +32,7 @@ import org.sosy_lab.cpachecker.core.CPAcheckerResult.Result;
 import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
 import org.sosy_lab.cpachecker.core.interfaces.Statistics;
 import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
+import org.sosy_lab.cpachecker.cpa.arg.ARGParentIndex;
 import org.sosy_lab.cpachecker.cpa.arg.ARGReachedSet;
 import org.sosy_lab.cpachecker.cpa.arg.ARGState;
 import org.sosy_lab.cpachecker.cpa.arg.ARGUtils;
@@ -119,6 +120,19 @@ public class PathExtractor implements Statistics {
     return new ArrayList<>(Collections2.transform(targetStates, ARGUtils::getOnePathTo));
   }
 
+  /**
+   * Like {@link #getTargetPaths(Collection)}, but extracts the paths with the parent index of the
+   * given ARG, which is shared by all path extractions of the current refinement.
+   */
+  public List<ARGPath> getTargetPaths(
+      final ARGReachedSet pReached, final Collection<ARGState> targetStates) {
+    if (targetStates.size() <= 1) {
+      return getTargetPaths(targetStates);
+    }
+    ARGParentIndex parentIndex = pReached.getParentIndex();
+    return new ArrayList<>(Collections2.transform(targetStates, parentIndex::getOnePathTo));
+  }
+
   public void addFeasibleTarget(ARGState pLastState) {
     feasibleTargets.add(pLastState);
   }
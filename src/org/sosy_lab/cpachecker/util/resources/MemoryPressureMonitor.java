@@ -0,0 +1,268 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.resources;
+
+import static com.google.common.base.Preconditions.checkNotNull;
+import static com.google.common.base.Preconditions.checkState;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryMXBean;
+import java.lang.management.MemoryUsage;
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Consumer;
+import java.util.logging.Level;
+import javax.management.ListenerNotFoundException;
+import javax.management.Notification;
+import javax.management.NotificationEmitter;
+import javax.management.NotificationListener;
+import org.checkerframework.checker.nullness.qual.Nullable;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+
+/**
+ * Clears caches of the analysis if the heap is almost full even after a garbage collection, in
+ * order to avoid an {@link OutOfMemoryError} at the cost of recomputing some results.
+ *
+ * <p>Caches register themselves with {@link #registerCache(Object, String, Priority, Consumer)},
+ * regardless of whether a monitor is active. The owner of a cache is referenced only weakly, so
+ * registration does not keep it alive. A monitor receives the notifications of the garbage
+ * collectors and checks the heap usage after each collection. If it exceeds the configured
+ * threshold, the caches with the lowest priority are requested to be cleared, and if the heap
+ * usage is still too high after the next collection, the caches with the next priority, and so on.
+ *
+ * <p>Because the caches are usually not thread-safe, they are not cleared from the notification
+ * thread, but only when the analysis calls {@link #shedCachesIfRequested()}, which is cheap if
+ * nothing was requested.
+ */
+@Options(prefix = "memoryPressure")
+public final class MemoryPressureMonitor implements NotificationListener {
+
+  /** Order in which caches are cleared: caches with priority {@link #FIRST} are cleared first. */
+  public enum Priority {
+    /** For caches whose content is cheap to recompute. */
+    FIRST,
+    NORMAL,
+    /** For caches whose content is expensive to recompute, e.g., with many solver calls. */
+    LAST,
+  }
+
+  private static final class RegisteredCache<T> {
+    private final WeakReference<T> owner;
+    private final String name;
+    private final Priority priority;
+    private final Consumer<? super T> shedAction;
+
+    private RegisteredCache(
+        T pOwner, String pName, Priority pPriority, Consumer<? super T> pShedAction) {
+      owner = new WeakReference<>(pOwner);
+      name = pName;
+      priority = pPriority;
+      shedAction = pShedAction;
+    }
+
+    private boolean isAlive() {
+      return owner.get() != null;
+    }
+
+    /** Clear the cache and return whether its owner still exists. */
+    private boolean shed() {
+      T currentOwner = owner.get();
+      if (currentOwner == null) {
+        return false;
+      }
+      shedAction.accept(currentOwner);
+      return true;
+    }
+  }
+
+  /** Notification type of com.sun.management.GarbageCollectionNotificationInfo */
+  private static final String GC_NOTIFICATION = "com.sun.management.gc.notification";
+
+  private static final int NOTHING_REQUESTED = -1;
+
+  private static final List<RegisteredCache<?>> caches = new ArrayList<>();
+
+  private static volatile @Nullable MemoryPressureMonitor activeMonitor = null;
+
+  @Option(
+      secure = true,
+      name = "shedCaches",
+      description =
+          "clear caches of the analysis (e.g., for path formulas, satisfiability checks,"
+              + " or predicate abstractions) if the heap is almost full after a garbage"
+              + " collection, instead of running out of memory."
+              + " The caches are cleared by the thread that runs the CPA algorithm,"
+              + " so this should not be used with analyses that run several CPA algorithms"
+              + " in parallel threads.")
+  private boolean shedCaches = false;
+
+  @Option(
+      secure = true,
+      name = "threshold",
+      description =
+          "percentage of the maximum heap size that is considered as memory pressure"
+              + " if it is still used after a garbage collection")
+  @IntegerOption(min = 1, max = 100)
+  private int threshold = 90;
+
+  private final LogManager logger;
+  private final MemoryMXBean memory = ManagementFactory.getMemoryMXBean();
+  private final List<NotificationEmitter> emitters = new ArrayList<>();
+
+  /** Highest ordinal of {@link Priority} whose caches should be cleared, or -1. */
+  private final AtomicInteger requestedLevel = new AtomicInteger(NOTHING_REQUESTED);
+
+  /** Priority level that is requested on the next notification about memory pressure. */
+  private int nextLevel = 0; // only accessed from notification thread
+
+  private volatile int lastHeapPercentage = 0;
+  private int shedEvents = 0;
+
+  public MemoryPressureMonitor(Configuration pConfig, LogManager pLogger)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    logger = pLogger;
+  }
+
+  /**
+   * Register a cache that can be cleared under memory pressure.
+   *
+   * @param owner The object that holds the cache, referenced only weakly.
+   * @param name A human-readable name of the cache for log messages.
+   * @param priority Determines the order in which caches are cleared.
+   * @param shedAction Clears the cache of a given owner. This must not reference the owner itself,
+   *     typically it is a method reference like {@code Solver::clearCaches}.
+   */
+  public static <T> void registerCache(
+      T owner, String name, Priority priority, Consumer<? super T> shedAction) {
+    RegisteredCache<T> cache =
+        new RegisteredCache<>(
+            checkNotNull(owner), checkNotNull(name), checkNotNull(priority), shedAction);
+    synchronized (caches) {
+      caches.removeIf(c -> !c.isAlive());
+      caches.add(cache);
+    }
+  }
+
+  /**
+   * Clear the caches for which the active monitor has detected memory pressure, if any. This
+   * should be called regularly from the main loop of the analysis at a point where no cache is in
+   * use.
+   */
+  public static void shedCachesIfRequested() {
+    MemoryPressureMonitor monitor = activeMonitor;
+    if (monitor != null && monitor.requestedLevel.get() != NOTHING_REQUESTED) {
+      monitor.shedRequestedCaches();
+    }
+  }
+
+  /** Start listening for garbage collections if this is enabled by the configuration. */
+  public void start() {
+    if (!shedCaches) {
+      return;
+    }
+    checkState(emitters.isEmpty());
+    for (GarbageCollectorMXBean gc : ManagementFactory.getGarbageCollectorMXBeans()) {
+      if (gc instanceof NotificationEmitter) {
+        NotificationEmitter emitter = (NotificationEmitter) gc;
+        emitter.addNotificationListener(
+            this, notification -> notification.getType().equals(GC_NOTIFICATION), null);
+        emitters.add(emitter);
+      }
+    }
+    if (emitters.isEmpty()) {
+      logger.log(
+          Level.WARNING,
+          "JVM does not provide notifications about garbage collections,"
+              + " caches will not be cleared under memory pressure.");
+      return;
+    }
+    activeMonitor = this;
+  }
+
+  /** Stop listening for garbage collections. */
+  public void stop() {
+    for (NotificationEmitter emitter : emitters) {
+      try {
+        emitter.removeNotificationListener(this);
+      } catch (ListenerNotFoundException e) {
+        logger.logDebugException(e, "Removing listener for garbage collections failed");
+      }
+    }
+    emitters.clear();
+    if (activeMonitor == this) {
+      activeMonitor = null;
+    }
+    if (shedEvents > 0) {
+      logger.log(Level.INFO, "Caches were cleared", shedEvents, "times due to memory pressure.");
+    }
+  }
+
+  @Override
+  public void handleNotification(Notification pNotification, Object pHandback) {
+    final MemoryUsage heap;
+    try {
+      heap = memory.getHeapMemoryUsage();
+    } catch (IllegalArgumentException e) {
+      // JDK-8207200, cf. MemoryStatistics
+      return;
+    }
+    if (heap.getMax() <= 0) {
+      return; // no limit known
+    }
+
+    int percentage = (int) (100 * heap.getUsed() / heap.getMax());
+    if (percentage >= threshold) {
+      lastHeapPercentage = percentage;
+      requestedLevel.accumulateAndGet(nextLevel, Math::max);
+      nextLevel = Math.min(nextLevel + 1, Priority.LAST.ordinal());
+    } else {
+      nextLevel = 0;
+    }
+  }
+
+  private void shedRequestedCaches() {
+    int level = requestedLevel.getAndSet(NOTHING_REQUESTED);
+    if (level == NOTHING_REQUESTED) {
+      return;
+    }
+
+    List<RegisteredCache<?>> toShed = new ArrayList<>();
+    synchronized (caches) {
+      for (RegisteredCache<?> cache : caches) {
+        if (cache.priority.ordinal() <= level) {
+          toShed.add(cache);
+        }
+      }
+    }
+
+    List<String> names = new ArrayList<>();
+    for (RegisteredCache<?> cache : toShed) {
+      if (cache.shed()) {
+        names.add(cache.name);
+      }
+    }
+    shedEvents++;
+    logger.log(
+        Level.INFO,
+        "Heap usage after garbage collection is at",
+        lastHeapPercentage + "%,",
+        "clearing caches with priority up to",
+        Priority.values()[level] + ":",
+        names);
+  }
+}
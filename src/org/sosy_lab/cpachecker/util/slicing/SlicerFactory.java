@@ -8,8 +8,17 @@
 
 package org.sosy_lab.cpachecker.util.slicing;
 
+import com.google.common.base.Splitter;
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
+import com.google.common.collect.ImmutableList;
 import java.util.ArrayList;
 import java.util.Collection;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.ExecutionException;
+import java.util.logging.Level;
+import java.util.stream.Collectors;
 import org.sosy_lab.common.ShutdownNotifier;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
@@ -76,12 +85,52 @@ public class SlicerFactory implements StatisticsProvider {
     }
   }
 
+  /**
+   * Dependence graphs that were already created, per CFA and per configuration of the dependence
+   * graph. Nested and restarted analyses (e.g., in a {@link
+   * org.sosy_lab.cpachecker.core.algorithm.NestingAlgorithm}) share the same CFA, so they can also
+   * share its dependence graph instead of building it again. The CFAs are referenced weakly, such
+   * that graphs are released together with their CFA.
+   */
+  private static final Cache<CFA, ConcurrentMap<String, DependenceGraph>> dependenceGraphs =
+      CacheBuilder.newBuilder().weakKeys().build();
+
   private final Collection<Statistics> stats;
 
   public SlicerFactory() {
     stats = new ArrayList<>();
   }
 
+  private DependenceGraph getDependenceGraph(
+      LogManager pLogger, ShutdownNotifier pShutdownNotifier, Configuration pConfig, CFA pCfa)
+      throws InterruptedException, InvalidConfigurationException {
+
+    final ConcurrentMap<String, DependenceGraph> graphsForCfa;
+    try {
+      graphsForCfa = dependenceGraphs.get(pCfa, ConcurrentHashMap::new);
+    } catch (ExecutionException e) {
+      throw new AssertionError(e);
+    }
+    final String key = getDependenceGraphOptions(pConfig);
+    DependenceGraph dependenceGraph = graphsForCfa.get(key);
+    if (dependenceGraph == null) {
+      dependenceGraph = createDependenceGraph(pLogger, pShutdownNotifier, pConfig, pCfa);
+      // if another analysis was faster, its graph is equivalent
+      graphsForCfa.putIfAbsent(key, dependenceGraph);
+      return dependenceGraph;
+    }
+    pLogger.log(Level.FINE, "Reusing existing dependence graph");
+    return dependenceGraph.withShutdownNotifier(pShutdownNotifier);
+  }
+
+  private static String getDependenceGraphOptions(Configuration pConfig) {
+    return ImmutableList.sortedCopyOf(
+            Splitter.on('\n').omitEmptyStrings().split(pConfig.asPropertiesString()))
+        .stream()
+        .filter(option -> option.startsWith("dependencegraph."))
+        .collect(Collectors.joining("\n"));
+  }
+
   private DependenceGraph createDependenceGraph(
       LogManager pLogger, ShutdownNotifier pShutdownNotifier, Configuration pConfig, CFA pCfa)
       throws InterruptedException, InvalidConfigurationException {
@@ -127,7 +176,7 @@ public class SlicerFactory implements StatisticsProvider {
     switch (slicingType) {
       case STATIC:
         DependenceGraph dependenceGraph =
-            createDependenceGraph(pLogger, pShutdownNotifier, pConfig, pCfa);
+            getDependenceGraph(pLogger, pShutdownNotifier, pConfig, pCfa);
         return new StaticSlicer(extractor, pLogger, pShutdownNotifier, pConfig, dependenceGraph);
       case IDENTITY:
         return new IdentitySlicer(extractor, pLogger, pShutdownNotifier, pConfig);
@@ -19,19 +19,39 @@ import java.util.List;
 import java.util.Map;
 import java.util.Objects;
 import java.util.OptionalLong;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ConcurrentMap;
+import java.util.concurrent.atomic.AtomicInteger;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.collect.PathCopyingPersistentTreeMap;
 import org.sosy_lab.common.collect.PersistentMap;
 
 /**
-* This class describes a location in the memory.
-*/
+ * This class describes a location in the memory.
+ *
+ * <p>All memory locations are interned: each distinct memory location gets a dense integer id
+ * (cf. {@link #getId()}), such that {@link #equals(Object)}, {@link #hashCode()} and the check for
+ * equality in {@link #compareTo(MemoryLocation)} are constant-time integer operations. The
+ * factory methods return the same instance for equal memory locations.
+ */
 public class MemoryLocation implements Comparable<MemoryLocation>, Serializable {
 
   private static final long serialVersionUID = -8910967707373729034L;
+
+  /** The registry that gives each distinct memory location its id. */
+  private static final ConcurrentMap<LocationKey, Integer> ids = new ConcurrentHashMap<>();
+
+  /** The interned instances of this class (not of sub-classes), indexed by their keys. */
+  private static final ConcurrentMap<LocationKey, MemoryLocation> instances =
+      new ConcurrentHashMap<>();
+
+  private static final AtomicInteger nextId = new AtomicInteger();
+
   private final String functionName;
   private final String identifier;
   private final @Nullable Long offset;
+  private final transient int id;
+  private final transient int hashCode;
 
   private MemoryLocation(String pFunctionName, String pIdentifier, @Nullable Long pOffset) {
     checkNotNull(pFunctionName);
@@ -40,6 +60,8 @@ public class MemoryLocation implements Comparable<MemoryLocation>, Serializable
     functionName = pFunctionName;
     identifier = pIdentifier;
     offset = pOffset;
+    hashCode = Objects.hash(functionName, identifier, offset);
+    id = idOf(new LocationKey(functionName, identifier, offset));
   }
 
   protected MemoryLocation(String pIdentifier, @Nullable Long pOffset) {
@@ -54,6 +76,33 @@ public class MemoryLocation implements Comparable<MemoryLocation>, Serializable
       identifier = pIdentifier;
     }
     offset = pOffset;
+    hashCode = Objects.hash(functionName, identifier, offset);
+    id = idOf(new LocationKey(functionName, identifier, offset));
+  }
+
+  private static int idOf(LocationKey pKey) {
+    Integer result = ids.get(pKey);
+    if (result == null) {
+      result = ids.computeIfAbsent(pKey, k -> nextId.getAndIncrement());
+    }
+    return result;
+  }
+
+  /** Return the unique instance of the given memory location. */
+  private static MemoryLocation intern(MemoryLocation pLocation) {
+    LocationKey key =
+        new LocationKey(pLocation.functionName, pLocation.identifier, pLocation.offset);
+    MemoryLocation existing = instances.putIfAbsent(key, pLocation);
+    return existing == null ? pLocation : existing;
+  }
+
+  /**
+   * Return the id of this memory location. Ids are dense non-negative integers, and two memory
+   * locations have the same id if and only if they are equal. Ids are only valid within one JVM run
+   * and should not be persisted.
+   */
+  public int getId() {
+    return id;
   }
 
   @Override
@@ -67,32 +116,30 @@ public class MemoryLocation implements Comparable<MemoryLocation>, Serializable
       return false;
     }
 
-    MemoryLocation otherLocation = (MemoryLocation) other;
-
-    return Objects.equals(functionName, otherLocation.functionName)
-        && Objects.equals(identifier, otherLocation.identifier)
-        && Objects.equals(offset, otherLocation.offset);
+    // ids are equal iff all components are equal
+    return id == ((MemoryLocation) other).id;
   }
 
   @Override
   public int hashCode() {
-    return Objects.hash(functionName, identifier, offset);
+    return hashCode;
   }
 
   public static MemoryLocation valueOf(String pFunctionName, String pIdentifier) {
-    return new MemoryLocation(pFunctionName, pIdentifier, null);
+    return intern(new MemoryLocation(pFunctionName, pIdentifier, null));
   }
 
   public static MemoryLocation valueOf(String pFunctionName, String pIdentifier, long pOffset) {
-    return new MemoryLocation(pFunctionName, pIdentifier, pOffset);
+    return intern(new MemoryLocation(pFunctionName, pIdentifier, pOffset));
   }
 
   public static MemoryLocation valueOf(String pIdentifier, long pOffset) {
-    return new MemoryLocation(pIdentifier, pOffset);
+    return intern(new MemoryLocation(pIdentifier, pOffset));
   }
 
   public static MemoryLocation valueOf(String pIdentifier, OptionalLong pOffset) {
-    return new MemoryLocation(pIdentifier, pOffset.isPresent() ? pOffset.orElseThrow() : null);
+    return intern(
+        new MemoryLocation(pIdentifier, pOffset.isPresent() ? pOffset.orElseThrow() : null));
   }
 
   public static MemoryLocation valueOf(String pVariableName) {
@@ -111,14 +158,14 @@ public class MemoryLocation implements Comparable<MemoryLocation>, Serializable
       if (hasOffset) {
         varName = varName.replace("/" + offset, "");
       }
-      return new MemoryLocation(functionName, varName, offset);
+      return intern(new MemoryLocation(functionName, varName, offset));
 
     } else {
       String varName = nameParts.get(0);
       if (hasOffset) {
         varName = varName.replace("/" + offset, "");
       }
-      return new MemoryLocation(varName.replace("/" + offset, ""), offset);
+      return intern(new MemoryLocation(varName.replace("/" + offset, ""), offset));
     }
   }
 
@@ -168,9 +215,9 @@ public class MemoryLocation implements Comparable<MemoryLocation>, Serializable
   public MemoryLocation getReferenceStart() {
     checkState(isReference(), "Memory location is no reference: %s", this);
     if (functionName != null) {
-      return new MemoryLocation(functionName, identifier, null);
+      return intern(new MemoryLocation(functionName, identifier, null));
     } else {
-      return new MemoryLocation(identifier, null);
+      return intern(new MemoryLocation(identifier, null));
     }
   }
 
@@ -193,10 +240,62 @@ public class MemoryLocation implements Comparable<MemoryLocation>, Serializable
 
   @Override
   public int compareTo(MemoryLocation other) {
+    if (id == other.id) {
+      return 0;
+    }
     return ComparisonChain.start()
         .compare(functionName, other.functionName, Ordering.natural().nullsFirst())
         .compare(identifier, other.identifier)
         .compare(offset, other.offset, Ordering.natural().nullsFirst())
         .result();
   }
+
+  /**
+   * Ids are only valid within one JVM run, thus after deserialization we use the interned instance
+   * with the id of the current run. Sub-classes need to override this method.
+   */
+  protected Object readResolve() {
+    if (functionName != null) {
+      return intern(new MemoryLocation(functionName, identifier, offset));
+    } else {
+      return intern(new MemoryLocation(identifier, offset));
+    }
+  }
+
+  @Nullable Long getNullableOffset() {
+    return offset;
+  }
+
+  /** Key of a memory location for the registry of ids and instances. */
+  private static final class LocationKey {
+    private final @Nullable String functionName;
+    private final String identifier;
+    private final @Nullable Long offset;
+
+    private LocationKey(
+        @Nullable String pFunctionName, String pIdentifier, @Nullable Long pOffset) {
+      functionName = pFunctionName;
+      identifier = pIdentifier;
+      offset = pOffset;
+    }
+
+    @Override
+    public boolean equals(Object pOther) {
+      if (this == pOther) {
+        return true;
+      }
+      if (!(pOther instanceof LocationKey)) {
+        return false;
+      }
+      LocationKey other = (LocationKey) pOther;
+      return Objects.equals(functionName, other.functionName)
+          && identifier.equals(other.identifier)
+          && Objects.equals(offset, other.offset);
+    }
+
+    @Override
+    public int hashCode() {
+      return Objects.hash(functionName, identifier, offset);
+    }
+  }
 }
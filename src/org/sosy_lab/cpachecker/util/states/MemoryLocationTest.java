@@ -0,0 +1,62 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.states;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.testing.SerializableTester;
+import org.junit.Test;
+
+public class MemoryLocationTest {
+
+  @Test
+  public void testInterning() {
+    MemoryLocation loc1 = MemoryLocation.valueOf("main", "x");
+    MemoryLocation loc2 = MemoryLocation.valueOf("main::x");
+    MemoryLocation loc3 = MemoryLocation.valueOf("main", "x", 4);
+
+    assertThat(loc2).isSameInstanceAs(loc1);
+    assertThat(loc2.getId()).isEqualTo(loc1.getId());
+    assertThat(loc3.getId()).isNotEqualTo(loc1.getId());
+    assertThat(loc3.getReferenceStart()).isSameInstanceAs(loc1);
+  }
+
+  @Test
+  public void testEqualsAndOrdering() {
+    MemoryLocation global = MemoryLocation.valueOf("x");
+    MemoryLocation local = MemoryLocation.valueOf("main", "x");
+    MemoryLocation other = MemoryLocation.valueOf("main", "y");
+
+    assertThat(global).isNotEqualTo(local);
+    assertThat(global.compareTo(local)).isLessThan(0);
+    assertThat(local.compareTo(other)).isLessThan(0);
+    assertThat(other.compareTo(local)).isGreaterThan(0);
+    assertThat(local.compareTo(MemoryLocation.valueOf("main::y"))).isLessThan(0);
+  }
+
+  @Test
+  public void testPointerToMemoryLocation() {
+    MemoryLocation loc = MemoryLocation.valueOf("main::p");
+    PointerToMemoryLocation pointer = PointerToMemoryLocation.valueOf("main::p");
+
+    assertThat(pointer).isEqualTo(loc);
+    assertThat(loc).isEqualTo(pointer);
+    assertThat(pointer.hashCode()).isEqualTo(loc.hashCode());
+    assertThat(pointer.getId()).isEqualTo(loc.getId());
+  }
+
+  @Test
+  public void testSerialization() {
+    MemoryLocation loc = MemoryLocation.valueOf("main", "z", 8);
+    assertThat(SerializableTester.reserialize(loc)).isSameInstanceAs(loc);
+
+    PointerToMemoryLocation pointer = PointerToMemoryLocation.valueOf("q");
+    assertThat(SerializableTester.reserializeAndAssert(pointer).getId()).isEqualTo(pointer.getId());
+  }
+}
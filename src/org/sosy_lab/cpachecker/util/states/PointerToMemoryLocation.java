@@ -21,4 +21,12 @@ public class PointerToMemoryLocation extends MemoryLocation {
   public static PointerToMemoryLocation valueOf(String pIdentifier) {
       return new PointerToMemoryLocation(pIdentifier, null);
   }
+
+  @Override
+  protected Object readResolve() {
+    // recompute the transient id for the current run
+    String identifier =
+        isOnFunctionStack() ? getFunctionName() + "::" + getIdentifier() : getIdentifier();
+    return new PointerToMemoryLocation(identifier, getNullableOffset());
+  }
 }
\ No newline at end of file
@@ -0,0 +1,330 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.statistics;
+
+import static com.google.common.collect.ImmutableList.toImmutableList;
+import static org.sosy_lab.cpachecker.util.statistics.StatisticsWriter.writingStatisticsTo;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.ImmutableMap;
+import com.google.common.collect.ImmutableSet;
+import com.google.common.collect.Sets;
+import java.io.PrintStream;
+import java.lang.reflect.Array;
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.ArrayDeque;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.Map;
+import java.util.Set;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.ast.AAstNode;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.cfa.types.Type;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.reachedset.UnmodifiableReachedSet;
+import org.sosy_lab.cpachecker.cpa.automaton.Automaton;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.predicates.regions.Region;
+import org.sosy_lab.java_smt.api.Formula;
+
+/**
+ * Estimates how much heap memory the states of each CPA use, in order to find out which CPAs
+ * dominate the memory consumption of an analysis.
+ *
+ * <p>A sample of the states in the reached set is split into its component states (cf. {@link
+ * AbstractStates#asIterable(AbstractState)}), and the objects reachable from each component are
+ * measured with a simple model of the object layout of a 64-bit JVM with compressed references.
+ * Objects that are reachable from several states are counted only once, for the component in
+ * which they are found first, such that the result approximates the retained size. The traversal
+ * stops at other abstract states (these are measured on their own) and at objects that are shared
+ * with the rest of the analysis like CFA nodes, AST nodes, precisions, and solver formulas.
+ *
+ * <p>Fields of JDK classes can not be accessed reflectively, thus strings are measured by their
+ * length and JDK collections by their elements plus a fixed overhead per element. All numbers are
+ * only rough estimates.
+ */
+@Options(prefix = "statistics.stateSizes")
+public final class StateSizeEstimator {
+
+  @Option(
+      secure = true,
+      name = "samples",
+      description =
+          "maximum number of states of the reached set that are sampled for estimating"
+              + " the memory usage of the states of each CPA")
+  @IntegerOption(min = 1)
+  private int samples = 1000;
+
+  private static final int OBJECT_HEADER = 12;
+  private static final int ARRAY_HEADER = 16;
+  private static final int REFERENCE = 4;
+  private static final int ALIGNMENT = 8;
+  private static final int COLLECTION_ELEMENT_OVERHEAD = 16;
+  private static final int MAP_ENTRY_OVERHEAD = 32;
+
+  /** Limit for the number of objects per component state to bound the cost of the census. */
+  private static final int MAX_OBJECTS_PER_STATE = 100_000;
+
+  private static final ImmutableSet<Class<?>> BOUNDARY_TYPES =
+      ImmutableSet.of(
+          AbstractState.class,
+          Precision.class,
+          CFANode.class,
+          CFAEdge.class,
+          AAstNode.class,
+          Type.class,
+          Formula.class,
+          Region.class,
+          Automaton.class,
+          LogManager.class,
+          Class.class,
+          ClassLoader.class,
+          Thread.class,
+          Enum.class);
+
+  private static final ImmutableMap<Class<?>, Integer> PRIMITIVE_SIZES =
+      ImmutableMap.<Class<?>, Integer>builder()
+          .put(boolean.class, 1)
+          .put(byte.class, 1)
+          .put(char.class, 2)
+          .put(short.class, 2)
+          .put(int.class, 4)
+          .put(float.class, 4)
+          .put(long.class, 8)
+          .put(double.class, 8)
+          .build();
+
+  /** Memory usage of the states of one type, extrapolated to the whole reached set. */
+  public static final class StateTypeSize {
+    private final String type;
+    private final long instances;
+    private final long bytes;
+
+    private StateTypeSize(String pType, long pInstances, long pBytes) {
+      type = pType;
+      instances = pInstances;
+      bytes = pBytes;
+    }
+
+    public String getType() {
+      return type;
+    }
+
+    public long getInstances() {
+      return instances;
+    }
+
+    public long getBytes() {
+      return bytes;
+    }
+
+    public long getBytesPerInstance() {
+      return instances == 0 ? 0 : bytes / instances;
+    }
+  }
+
+  private static final class Layout {
+    private final long shallowSize;
+    private final ImmutableList<Field> referenceFields;
+    private final boolean accessible;
+
+    private Layout(long pShallowSize, ImmutableList<Field> pReferenceFields, boolean pAccessible) {
+      shallowSize = pShallowSize;
+      referenceFields = pReferenceFields;
+      accessible = pAccessible;
+    }
+  }
+
+  private final Map<Class<?>, Layout> layouts = new HashMap<>();
+  private final Map<Class<?>, Boolean> boundaries = new HashMap<>();
+
+  public StateSizeEstimator(Configuration pConfig) throws InvalidConfigurationException {
+    pConfig.inject(this);
+  }
+
+  /**
+   * Estimate the memory usage of the states in the given reached set, grouped by the class of the
+   * component states and sorted by decreasing size.
+   */
+  public ImmutableList<StateTypeSize> estimate(UnmodifiableReachedSet reached) {
+    int size = reached.size();
+    if (size == 0) {
+      return ImmutableList.of();
+    }
+    int stride = Math.max(1, (size + samples - 1) / samples);
+
+    Map<String, long[]> perType = new HashMap<>(); // instances, bytes
+    Set<Object> visited = Sets.newIdentityHashSet();
+    int sampled = 0;
+    int index = 0;
+    for (AbstractState state : reached) {
+      if (index++ % stride != 0) {
+        continue;
+      }
+      sampled++;
+      for (AbstractState component : AbstractStates.asIterable(state)) {
+        long[] entry =
+            perType.computeIfAbsent(component.getClass().getSimpleName(), k -> new long[2]);
+        entry[0]++;
+        entry[1] += measure(component, visited);
+      }
+    }
+
+    double factor = (double) size / sampled;
+    return perType.entrySet().stream()
+        .map(
+            e ->
+                new StateTypeSize(
+                    e.getKey(),
+                    Math.round(e.getValue()[0] * factor),
+                    Math.round(e.getValue()[1] * factor)))
+        .sorted(Comparator.comparingLong(StateTypeSize::getBytes).reversed())
+        .collect(toImmutableList());
+  }
+
+  /** Print the result of {@link #estimate(UnmodifiableReachedSet)}. */
+  public static void printEstimate(ImmutableList<StateTypeSize> pSizes, PrintStream out) {
+    StatisticsWriter writer =
+        writingStatisticsTo(out).put("Estimated memory of states per type", "").beginLevel();
+    for (StateTypeSize size : pSizes) {
+      writer.put(
+          size.getType(),
+          String.format(
+              "%dMB (%d bytes per state, %d states)",
+              size.getBytes() / 1000 / 1000, size.getBytesPerInstance(), size.getInstances()));
+    }
+  }
+
+  private long measure(AbstractState root, Set<Object> visited) {
+    if (!visited.add(root)) {
+      return 0;
+    }
+    long bytes = 0;
+    int objects = 0;
+    Deque<Object> waitlist = new ArrayDeque<>();
+    bytes += visit(root, waitlist);
+
+    while (!waitlist.isEmpty() && objects++ < MAX_OBJECTS_PER_STATE) {
+      Object obj = waitlist.pop();
+      if (isBoundary(obj.getClass()) || !visited.add(obj)) {
+        continue;
+      }
+      bytes += visit(obj, waitlist);
+    }
+    return bytes;
+  }
+
+  /** Return the shallow size of an object and add the objects it references to the waitlist. */
+  private long visit(Object obj, Deque<Object> waitlist) {
+    Class<?> cls = obj.getClass();
+
+    if (cls.isArray()) {
+      int length = Array.getLength(obj);
+      Class<?> componentType = cls.getComponentType();
+      if (componentType.isPrimitive()) {
+        return align(ARRAY_HEADER + (long) length * PRIMITIVE_SIZES.get(componentType));
+      }
+      for (Object element : (Object[]) obj) {
+        if (element != null) {
+          waitlist.push(element);
+        }
+      }
+      return align(ARRAY_HEADER + (long) length * REFERENCE);
+    }
+
+    Layout layout = layouts.computeIfAbsent(cls, StateSizeEstimator::computeLayout);
+    long bytes = layout.shallowSize;
+    if (layout.accessible) {
+      for (Field field : layout.referenceFields) {
+        Object value;
+        try {
+          value = field.get(obj);
+        } catch (IllegalAccessException e) {
+          throw new AssertionError(e);
+        }
+        if (value != null) {
+          waitlist.push(value);
+        }
+      }
+
+    } else if (obj instanceof String) {
+      bytes += align(ARRAY_HEADER + ((String) obj).length());
+
+    } else if (obj instanceof Map<?, ?>) {
+      for (Map.Entry<?, ?> entry : ((Map<?, ?>) obj).entrySet()) {
+        bytes += MAP_ENTRY_OVERHEAD;
+        pushIfNotNull(entry.getKey(), waitlist);
+        pushIfNotNull(entry.getValue(), waitlist);
+      }
+
+    } else if (obj instanceof Collection<?>) {
+      for (Iterator<?> it = ((Collection<?>) obj).iterator(); it.hasNext(); ) {
+        bytes += COLLECTION_ELEMENT_OVERHEAD;
+        pushIfNotNull(it.next(), waitlist);
+      }
+    }
+    return bytes;
+  }
+
+  private static void pushIfNotNull(Object obj, Deque<Object> waitlist) {
+    if (obj != null) {
+      waitlist.push(obj);
+    }
+  }
+
+  private boolean isBoundary(Class<?> cls) {
+    return boundaries.computeIfAbsent(
+        cls, c -> BOUNDARY_TYPES.stream().anyMatch(boundary -> boundary.isAssignableFrom(c)));
+  }
+
+  private static Layout computeLayout(Class<?> cls) {
+    boolean accessible = isReflectivelyAccessible(cls);
+    long size = OBJECT_HEADER;
+    ImmutableList.Builder<Field> references = ImmutableList.builder();
+    for (Class<?> c = cls; c != null; c = c.getSuperclass()) {
+      accessible &= isReflectivelyAccessible(c);
+      for (Field field : c.getDeclaredFields()) {
+        if (Modifier.isStatic(field.getModifiers())) {
+          continue;
+        }
+        Class<?> fieldType = field.getType();
+        if (fieldType.isPrimitive()) {
+          size += PRIMITIVE_SIZES.get(fieldType);
+        } else {
+          size += REFERENCE;
+          if (accessible && field.trySetAccessible()) {
+            references.add(field);
+          }
+        }
+      }
+    }
+    return new Layout(align(size), references.build(), accessible);
+  }
+
+  /** Whether private fields of the class can be read without an illegal access. */
+  private static boolean isReflectivelyAccessible(Class<?> cls) {
+    return cls.getModule().isOpen(cls.getPackageName(), StateSizeEstimator.class.getModule());
+  }
+
+  private static long align(long size) {
+    return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  }
+}
@@ -0,0 +1,87 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.statistics;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import com.google.common.collect.ImmutableList;
+import com.google.common.collect.Iterables;
+import org.junit.Before;
+import org.junit.Test;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.core.defaults.SingletonPrecision;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSet;
+import org.sosy_lab.cpachecker.core.reachedset.ReachedSetFactory;
+import org.sosy_lab.cpachecker.util.statistics.StateSizeEstimator.StateTypeSize;
+
+public class StateSizeEstimatorTest {
+
+  private static final class ArrayState implements AbstractState {
+    @SuppressWarnings("unused")
+    private final int[] values;
+
+    private ArrayState(int[] pValues) {
+      values = pValues;
+    }
+  }
+
+  private static final class LinkedState implements AbstractState {
+    @SuppressWarnings("unused")
+    private final AbstractState other;
+
+    private LinkedState(AbstractState pOther) {
+      other = pOther;
+    }
+  }
+
+  private StateSizeEstimator estimator;
+  private ReachedSet reached;
+
+  @Before
+  public void init() throws InvalidConfigurationException {
+    Configuration config =
+        Configuration.builder().setOption("analysis.reachedSet", "NORMAL").build();
+    estimator = new StateSizeEstimator(config);
+    reached = new ReachedSetFactory(config, LogManager.createTestLogManager()).create();
+  }
+
+  @Test
+  public void testEmptyReachedSet() {
+    assertThat(estimator.estimate(reached)).isEmpty();
+  }
+
+  @Test
+  public void testSharedObjectsAreCountedOnce() {
+    int[] shared = new int[10];
+    reached.add(new ArrayState(shared), SingletonPrecision.getInstance());
+    reached.add(new ArrayState(shared), SingletonPrecision.getInstance());
+
+    StateTypeSize size = Iterables.getOnlyElement(estimator.estimate(reached));
+    assertThat(size.getType()).isEqualTo("ArrayState");
+    assertThat(size.getInstances()).isEqualTo(2);
+    // two objects with header and one reference, and one array with 10 ints
+    assertThat(size.getBytes()).isEqualTo(2 * 16 + 56);
+  }
+
+  @Test
+  public void testOtherStatesAreNotCounted() {
+    ArrayState big = new ArrayState(new int[1000]);
+    reached.add(big, SingletonPrecision.getInstance());
+    reached.add(new LinkedState(big), SingletonPrecision.getInstance());
+
+    ImmutableList<StateTypeSize> sizes = estimator.estimate(reached);
+    assertThat(sizes).hasSize(2);
+    assertThat(sizes.get(0).getType()).isEqualTo("ArrayState");
+    assertThat(sizes.get(1).getType()).isEqualTo("LinkedState");
+    assertThat(sizes.get(1).getBytes()).isEqualTo(16);
+  }
+}
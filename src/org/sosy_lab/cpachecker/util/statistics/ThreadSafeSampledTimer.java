@@ -0,0 +1,131 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.statistics;
+
+import static com.google.common.base.Preconditions.checkArgument;
+
+import java.util.concurrent.ThreadLocalRandom;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.LongAccumulator;
+import java.util.concurrent.atomic.LongAdder;
+import org.sosy_lab.common.time.TimeSpan;
+
+/**
+ * Thread-safe timer for very short and very frequent intervals, e.g., single operator calls of a
+ * CPA, that can be shared by several threads without synchronization.
+ *
+ * <p>Instead of measuring every interval, only a random sample of the intervals is measured (on
+ * average one of {@code sampleRate} intervals) and the total time is extrapolated from the
+ * sample. All intervals are counted exactly. With a sample rate of 0 no time is measured at all,
+ * such that the timer only costs an increment of a {@link LongAdder} per interval.
+ *
+ * <p>Because the timer is shared, there is no notion of a running interval. The value returned
+ * by {@link #start()} has to be passed to {@link #stop(long)}:
+ *
+ * <pre>{@code
+ * long start = timer.start();
+ * try {
+ *   ...
+ * } finally {
+ *   timer.stop(start);
+ * }
+ * }</pre>
+ */
+public class ThreadSafeSampledTimer extends AbstractStatValue {
+
+  private static final long NOT_SAMPLED = Long.MIN_VALUE;
+
+  private final int sampleRate;
+
+  private final LongAdder intervals = new LongAdder();
+  private final LongAdder sampledIntervals = new LongAdder();
+  private final LongAdder sampledTime = new LongAdder();
+  private final LongAccumulator maxTime = new LongAccumulator(Math::max, 0);
+
+  /**
+   * Create a timer.
+   *
+   * @param pTitle the title of the statistics
+   * @param pSampleRate measure one of this many intervals, 1 for all intervals and 0 for none.
+   */
+  public ThreadSafeSampledTimer(String pTitle, int pSampleRate) {
+    super(StatKind.SUM, pTitle);
+    checkArgument(pSampleRate >= 0, "negative sample rate %s", pSampleRate);
+    sampleRate = pSampleRate;
+  }
+
+  /** Start an interval and return the value that needs to be passed to {@link #stop(long)}. */
+  public long start() {
+    intervals.increment();
+    if (sampleRate == 0
+        || (sampleRate > 1 && ThreadLocalRandom.current().nextInt(sampleRate) != 0)) {
+      return NOT_SAMPLED;
+    }
+    return System.nanoTime();
+  }
+
+  /** Stop the interval that was started by the call to {@link #start()} that returned the value. */
+  public void stop(long pStart) {
+    if (pStart != NOT_SAMPLED) {
+      long time = System.nanoTime() - pStart;
+      sampledIntervals.increment();
+      sampledTime.add(time);
+      maxTime.accumulate(time);
+    }
+  }
+
+  /** Add the intervals and times of the given timer to this timer. */
+  public void mergeWith(ThreadSafeSampledTimer pOther) {
+    intervals.add(pOther.intervals.sum());
+    sampledIntervals.add(pOther.sampledIntervals.sum());
+    sampledTime.add(pOther.sampledTime.sum());
+    maxTime.accumulate(pOther.maxTime.get());
+  }
+
+  public long getNumberOfIntervals() {
+    return intervals.sum();
+  }
+
+  public long getNumberOfSampledIntervals() {
+    return sampledIntervals.sum();
+  }
+
+  /**
+   * Return the sum of all intervals, which is extrapolated from the measured intervals if not all
+   * intervals were measured, and 0 if no interval was measured.
+   */
+  public TimeSpan getSumTime() {
+    long sampled = sampledIntervals.sum();
+    if (sampled == 0) {
+      return TimeSpan.empty();
+    }
+    long time = sampledTime.sum();
+    long all = intervals.sum();
+    if (sampled < all) {
+      time = (long) ((double) time / sampled * all);
+    }
+    return TimeSpan.of(time, TimeUnit.NANOSECONDS);
+  }
+
+  /** Return the maximal time of the measured intervals. */
+  public TimeSpan getMaxTime() {
+    return TimeSpan.of(maxTime.get(), TimeUnit.NANOSECONDS);
+  }
+
+  @Override
+  public int getUpdateCount() {
+    return intervals.intValue();
+  }
+
+  @Override
+  public String toString() {
+    String time = getSumTime().formatAs(TimeUnit.SECONDS);
+    return sampleRate > 1 ? time + " (estimated)" : time;
+  }
+}
@@ -0,0 +1,61 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.statistics;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.Test;
+import org.sosy_lab.common.time.TimeSpan;
+
+public class ThreadSafeSampledTimerTest {
+
+  private static void measure(ThreadSafeSampledTimer pTimer, int pIntervals) {
+    for (int i = 0; i < pIntervals; i++) {
+      pTimer.stop(pTimer.start());
+    }
+  }
+
+  @Test
+  public void allIntervalsSampled() {
+    ThreadSafeSampledTimer timer = new ThreadSafeSampledTimer("", 1);
+    measure(timer, 10);
+    assertThat(timer.getNumberOfIntervals()).isEqualTo(10);
+    assertThat(timer.getNumberOfSampledIntervals()).isEqualTo(10);
+    assertThat(timer.getUpdateCount()).isEqualTo(10);
+  }
+
+  @Test
+  public void noIntervalSampled() {
+    ThreadSafeSampledTimer timer = new ThreadSafeSampledTimer("", 0);
+    measure(timer, 10);
+    assertThat(timer.getNumberOfIntervals()).isEqualTo(10);
+    assertThat(timer.getNumberOfSampledIntervals()).isEqualTo(0);
+    assertThat(timer.getSumTime()).isEqualTo(TimeSpan.empty());
+  }
+
+  @Test
+  public void someIntervalsSampled() {
+    ThreadSafeSampledTimer timer = new ThreadSafeSampledTimer("", 4);
+    measure(timer, 1000);
+    assertThat(timer.getNumberOfIntervals()).isEqualTo(1000);
+    assertThat(timer.getNumberOfSampledIntervals()).isAtMost(1000);
+    assertThat(timer.getSumTime().compareTo(timer.getMaxTime())).isAtLeast(0);
+  }
+
+  @Test
+  public void mergeWith() {
+    ThreadSafeSampledTimer timer = new ThreadSafeSampledTimer("", 1);
+    ThreadSafeSampledTimer other = new ThreadSafeSampledTimer("", 1);
+    measure(timer, 3);
+    measure(other, 5);
+    timer.mergeWith(other);
+    assertThat(timer.getNumberOfIntervals()).isEqualTo(8);
+    assertThat(timer.getNumberOfSampledIntervals()).isEqualTo(8);
+  }
+}
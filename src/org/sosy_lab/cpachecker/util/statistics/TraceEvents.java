@@ -0,0 +1,166 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.statistics;
+
+import jdk.jfr.Category;
+import jdk.jfr.Description;
+import jdk.jfr.Event;
+import jdk.jfr.Label;
+import jdk.jfr.Name;
+
+/**
+ * Custom events for the Java Flight Recorder (JFR) that mark the main phases and some expensive
+ * operations of CPAchecker, such that the timeline of a recording shows where the time was spent.
+ *
+ * <p>The events are recorded whenever CPAchecker runs with JFR enabled, e.g., with {@code
+ * JAVA_VM_ARGUMENTS=-XX:StartFlightRecording=filename=cpachecker.jfr,settings=profile}. Without a
+ * recording, creating and committing an event costs almost nothing, so the events are only
+ * placed around operations that are significantly more expensive than that.
+ *
+ * <p>Usage:
+ *
+ * <pre>{@code
+ * SomeEvent event = new SomeEvent(...);
+ * event.begin();
+ * try {
+ *   ...
+ * } finally {
+ *   event.commit();
+ * }
+ * }</pre>
+ */
+public final class TraceEvents {
+
+  private static final String CATEGORY = "CPAchecker";
+
+  private TraceEvents() {}
+
+  @Name("org.sosy_lab.cpachecker.CFACreationStage")
+  @Label("CFA Creation Stage")
+  @Category({CATEGORY, "CFA"})
+  public static final class CFACreationStageEvent extends Event {
+
+    @Label("Stage")
+    private String stage;
+
+    public CFACreationStageEvent(String pStage) {
+      stage = pStage;
+    }
+  }
+
+  @Name("org.sosy_lab.cpachecker.Refinement")
+  @Label("Refinement")
+  @Category({CATEGORY, "Algorithm"})
+  public static final class RefinementEvent extends Event {
+
+    @Label("Refinement Number")
+    private int number;
+
+    @Label("Reached Set Size")
+    @Description("Size of the reached set before the refinement")
+    private int reachedSetSize;
+
+    @Label("Successful")
+    private boolean successful;
+
+    public RefinementEvent(int pNumber, int pReachedSetSize) {
+      number = pNumber;
+      reachedSetSize = pReachedSetSize;
+    }
+
+    public void setSuccessful(boolean pSuccessful) {
+      successful = pSuccessful;
+    }
+  }
+
+  @Name("org.sosy_lab.cpachecker.PredicateAbstraction")
+  @Label("Predicate Abstraction")
+  @Category({CATEGORY, "Predicate Analysis"})
+  public static final class PredicateAbstractionEvent extends Event {
+
+    @Label("Abstraction Id")
+    private int abstractionId;
+
+    @Label("Predicates")
+    private int predicates;
+
+    @Label("Path Formula Length")
+    @Description("Number of edges in the block that is abstracted")
+    private int pathFormulaLength;
+
+    public PredicateAbstractionEvent(int pAbstractionId, int pPredicates, int pPathFormulaLength) {
+      abstractionId = pAbstractionId;
+      predicates = pPredicates;
+      pathFormulaLength = pPathFormulaLength;
+    }
+  }
+
+  @Name("org.sosy_lab.cpachecker.SatCheck")
+  @Label("Satisfiability Check")
+  @Category({CATEGORY, "Solver"})
+  public static final class SatCheckEvent extends Event {
+
+    @Label("Constraints")
+    @Description("Number of formulas whose conjunction is checked")
+    private int constraints;
+
+    @Label("Unsatisfiable")
+    private boolean unsat;
+
+    public SatCheckEvent(int pConstraints) {
+      constraints = pConstraints;
+    }
+
+    public void setUnsat(boolean pUnsat) {
+      unsat = pUnsat;
+    }
+  }
+
+  @Name("org.sosy_lab.cpachecker.BAMBlock")
+  @Label("BAM Block Analysis")
+  @Category({CATEGORY, "BAM"})
+  public static final class BAMBlockEvent extends Event {
+
+    @Label("Block")
+    @Description("Call node of the block")
+    private String block;
+
+    @Label("Function")
+    private String function;
+
+    @Label("Nesting Level")
+    private int nestingLevel;
+
+    public BAMBlockEvent(String pBlock, String pFunction, int pNestingLevel) {
+      block = pBlock;
+      function = pFunction;
+      nestingLevel = pNestingLevel;
+    }
+  }
+
+  @Name("org.sosy_lab.cpachecker.ARGSubtreeRemoval")
+  @Label("ARG Subtree Removal")
+  @Category({CATEGORY, "BAM"})
+  public static final class ARGSubtreeRemovalEvent extends Event {
+
+    @Label("Path Length")
+    private int pathLength;
+
+    @Label("Affected Blocks")
+    private int affectedBlocks;
+
+    public ARGSubtreeRemovalEvent(int pPathLength) {
+      pathLength = pPathLength;
+    }
+
+    public void setAffectedBlocks(int pAffectedBlocks) {
+      affectedBlocks = pAffectedBlocks;
+    }
+  }
+}
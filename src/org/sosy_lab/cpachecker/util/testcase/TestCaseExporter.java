@@ -27,15 +27,18 @@ import java.nio.file.Files;
 import java.nio.file.Path;
 import java.nio.file.StandardOpenOption;
 import java.util.HashMap;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Optional;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.BiPredicate;
 import java.util.logging.Level;
 import org.sosy_lab.common.Appender;
 import org.sosy_lab.common.UniqueIdGenerator;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -99,6 +102,15 @@ public class TestCaseExporter {
   @FileOption(FileOption.Type.OUTPUT_FILE)
   private Path testCaseZip = null;
 
+  @Option(
+      secure = true,
+      name = "zip.batchSize",
+      description =
+          "Number of test cases that are collected in memory before they are written "
+              + "into the zip file together.")
+  @IntegerOption(min = 1)
+  private int zipBatchSize = 1;
+
   @Option(
     secure = true,
     description = "Only convert literal value and do not add suffix, e.g., for unsigned, etc.")
@@ -109,7 +121,16 @@ public class TestCaseExporter {
     description = "Do not output values for variables that are not initialized when declared")
   private boolean excludeInitialization = false;
 
-  private static int testsWritten = 0;
+  private static final AtomicInteger testsWritten = new AtomicInteger();
+
+  /** Test cases may be written concurrently, but the zip file must not be opened twice. */
+  private static final Object zipLock = new Object();
+
+  /**
+   * Test cases for the zip file that are not written yet, guarded by {@link #zipLock}. Opening
+   * and closing the zip file system rewrites the archive, so entries are written in batches.
+   */
+  private static final Map<String, String> pendingZipEntries = new LinkedHashMap<>();
 
   private final CFA cfa;
   private final HarnessExporter harnessExporter;
@@ -137,9 +158,11 @@ public class TestCaseExporter {
   public void writeTestCaseFiles(
       final CounterexampleInfo pCex,
       Optional<SpecificationProperty> pSpec) {
-    // TODO check if this and openZipFS(), closeZipFS() are thread-safe
+    // This method may be called concurrently for different counterexamples,
+    // as long as the ARG of each counterexample is not changed at the same time.
     if (areTestsEnabled()) {
       ARGPath targetPath = pCex.getTargetPath();
+      boolean isFirstTest = testsWritten.getAndIncrement() == 0;
 
       if (testHarnessFile != null) {
         writeTestCase(
@@ -153,7 +176,7 @@ public class TestCaseExporter {
 
       if (testXMLFile != null) {
         Path testCaseFile = testXMLFile.getPath(id.getFreshId());
-        if (isFirstTest()) {
+        if (isFirstTest) {
           writeTestCase(
               testCaseFile.resolveSibling("metadata.xml"),
               targetPath,
@@ -163,16 +186,20 @@ public class TestCaseExporter {
         }
         writeTestCase(testCaseFile, targetPath, pCex, FormatType.XML, pSpec);
       }
-      increaseTestsWritten();
     }
   }
 
-  private static void increaseTestsWritten() {
-    testsWritten++;
-  }
-
-  private static boolean isFirstTest() {
-    return testsWritten == 0;
+  /**
+   * Return the test inputs of the given counterexample in the order in which the program reads
+   * them, or an empty optional if no test vector can be extracted from the counterexample.
+   */
+  public Optional<ImmutableList<String>> getTestInputs(final CounterexampleInfo pCex) {
+    ARGPath targetPath = pCex.getTargetPath();
+    return extractTestInputs(
+        targetPath.getFirstState(),
+        Predicates.in(targetPath.getStateSet()),
+        BiPredicates.pairIn(ImmutableSet.copyOf(targetPath.getStatePairs())),
+        pCex);
   }
 
   private void writeTestCase(
@@ -187,111 +214,113 @@ public class TestCaseExporter {
         BiPredicates.pairIn(ImmutableSet.copyOf(pTargetPath.getStatePairs()));
     try {
       Optional<String> testOutput;
+      Appender content = null;
+
+      switch (type) {
+        case HARNESS:
+          content =
+              appendable ->
+                  harnessExporter.writeHarness(
+                      appendable, rootState, relevantStates, relevantEdges, pCexInfo);
+          break;
+        case METADATA:
+          content =
+              appendable ->
+                  XMLTestCaseExport.writeXMLMetadata(
+                      appendable, cfa, pSpec.orElse(null), producerString);
+          break;
+        case PLAIN:
+          testOutput =
+              writeTestInputNondetValues(
+                  rootState,
+                  relevantStates,
+                  relevantEdges,
+                  pCexInfo,
+                  TestCaseExporter::printLineSeparated);
+
+          if (testOutput.isPresent()) {
+            content = appendable -> appendable.append(testOutput.orElseThrow());
+          }
+          break;
+        case XML:
+          testOutput =
+              writeTestInputNondetValues(
+                  rootState,
+                  relevantStates,
+                  relevantEdges,
+                  pCexInfo,
+                  XMLTestCaseExport.XML_TEST_CASE);
+          if (testOutput.isPresent()) {
+            content = appendable -> appendable.append(testOutput.orElseThrow());
+          }
+          break;
+        default:
+          throw new AssertionError("Unknown test case format.");
+      }
 
       if (zipTestCases) {
-        try (FileSystem zipFS = openZipFS()) {
-          Path fileName = pFile.getFileName();
-          Path testFile =
-              zipFS.getPath(fileName != null ? fileName.toString() : id.getFreshId() + "test.txt");
-          try (Writer writer =
-                   new OutputStreamWriter(
-                       zipFS
-                           .provider()
-                           .newOutputStream(testFile, StandardOpenOption.CREATE,
-                               StandardOpenOption.WRITE),
-                       Charset.defaultCharset())) {
-            switch (type) {
-              case HARNESS:
-                harnessExporter.writeHarness(
-                    writer, rootState, relevantStates, relevantEdges, pCexInfo);
-                break;
-              case METADATA:
-                XMLTestCaseExport.writeXMLMetadata(writer, cfa, pSpec.orElse(null), producerString);
-                break;
-              case PLAIN:
-                testOutput =
-                    writeTestInputNondetValues(
-                        rootState,
-                        relevantStates,
-                        relevantEdges,
-                        pCexInfo,
-                        TestCaseExporter::printLineSeparated);
-                if (testOutput.isPresent()) {
-                  writer.write(testOutput.orElseThrow());
-                }
-                break;
-              case XML:
-                testOutput =
-                    writeTestInputNondetValues(
-                        rootState,
-                        relevantStates,
-                        relevantEdges,
-                        pCexInfo,
-                        XMLTestCaseExport.XML_TEST_CASE);
-                if (testOutput.isPresent()) {
-                  writer.write(testOutput.orElseThrow());
-                }
-                break;
-              default:
-                throw new AssertionError("Unknown test case format.");
-            }
-          }
-        }
-      } else {
-        Object content = null;
-
-        switch (type) {
-          case HARNESS:
-            content =
-                (Appender)
-                    appendable ->
-                        harnessExporter.writeHarness(
-                            appendable, rootState, relevantStates, relevantEdges, pCexInfo);
-            break;
-          case METADATA:
-            content =
-                (Appender)
-                    appendable ->
-                        XMLTestCaseExport.writeXMLMetadata(
-                            appendable, cfa, pSpec.orElse(null), producerString);
-            break;
-          case PLAIN:
-            testOutput =
-                writeTestInputNondetValues(
-                    rootState,
-                    relevantStates,
-                    relevantEdges,
-                    pCexInfo,
-                    TestCaseExporter::printLineSeparated);
-
-            if (testOutput.isPresent()) {
-              content = (Appender) appendable -> appendable.append(testOutput.orElseThrow());
-            }
-            break;
-          case XML:
-            testOutput =
-                writeTestInputNondetValues(
-                    rootState,
-                    relevantStates,
-                    relevantEdges,
-                    pCexInfo,
-                    XMLTestCaseExport.XML_TEST_CASE);
-            if (testOutput.isPresent()) {
-              content = (Appender) appendable -> appendable.append(testOutput.orElseThrow());
-            }
-            break;
-          default:
-            throw new AssertionError("Unknown test case format.");
-        }
+        Path fileName = pFile.getFileName();
+        StringBuilder text = new StringBuilder();
         if (content != null) {
-          IO.writeFile(pFile, Charset.defaultCharset(), content);
+          content.appendTo(text);
+        }
+        synchronized (zipLock) {
+          pendingZipEntries.put(
+              fileName != null ? fileName.toString() : id.getFreshId() + "test.txt",
+              text.toString());
+          if (pendingZipEntries.size() >= zipBatchSize) {
+            writePendingZipEntries();
+          }
         }
+      } else if (content != null) {
+        IO.writeFile(pFile, Charset.defaultCharset(), content);
       }
     } catch (IOException e) {
       logger.logUserException(Level.WARNING, e, "Could not write test case to file");
     }
   }
 
+  /**
+   * Write all test cases that are still buffered for the zip file. Has no effect if test cases
+   * are not compressed.
+   */
+  public void flush() {
+    if (!zipTestCases) {
+      return;
+    }
+    synchronized (zipLock) {
+      try {
+        writePendingZipEntries();
+      } catch (IOException e) {
+        logger.logUserException(Level.WARNING, e, "Could not write test case to file");
+      }
+    }
+  }
+
+  /** Needs to be called while holding {@link #zipLock}. */
+  private void writePendingZipEntries() throws IOException {
+    if (pendingZipEntries.isEmpty()) {
+      return;
+    }
+    try (FileSystem zipFS = openZipFS()) {
+      for (Map.Entry<String, String> entry : pendingZipEntries.entrySet()) {
+        try (Writer writer =
+            new OutputStreamWriter(
+                zipFS
+                    .provider()
+                    .newOutputStream(
+                        zipFS.getPath(entry.getKey()),
+                        StandardOpenOption.CREATE,
+                        StandardOpenOption.WRITE),
+                Charset.defaultCharset())) {
+          writer.write(entry.getValue());
+        }
+      }
+    } finally {
+      pendingZipEntries.clear();
+    }
+  }
+
   private boolean areTestsEnabled() {
     return testValueFile != null || testHarnessFile != null || testXMLFile != null;
   }
@@ -332,6 +361,15 @@ public class TestCaseExporter {
       final BiPredicate<ARGState, ARGState> pIsRelevantEdge,
       final CounterexampleInfo pCounterexampleInfo,
       final TestValuesToFormat formatter) {
+    return extractTestInputs(pRootState, pIsRelevantState, pIsRelevantEdge, pCounterexampleInfo)
+        .map(formatter::convertToOutput);
+  }
+
+  private Optional<ImmutableList<String>> extractTestInputs(
+      final ARGState pRootState,
+      final Predicate<? super ARGState> pIsRelevantState,
+      final BiPredicate<ARGState, ARGState> pIsRelevantEdge,
+      final CounterexampleInfo pCounterexampleInfo) {
 
     final Multimap<ARGState, CFAEdgeWithAssumptions> valueMap = getValueMap(pCounterexampleInfo);
     final Optional<TargetTestVector> maybeTestVector =
@@ -340,13 +378,11 @@ public class TestCaseExporter {
     if (maybeTestVector.isPresent()) {
       final TestVector vector = maybeTestVector.orElseThrow().getVector();
 
-      List<String> inputs =
+      return Optional.of(
           vector.getTestInputsInOrder().stream()
               .filter(v -> !excludeInitialization || (v instanceof ExpressionTestValue))
               .map(v -> unpack(v.getValue()))
-              .collect(ImmutableList.toImmutableList());
-
-      return Optional.of(formatter.convertToOutput(inputs));
+              .collect(ImmutableList.toImmutableList()));
     } else {
       return Optional.empty();
     }
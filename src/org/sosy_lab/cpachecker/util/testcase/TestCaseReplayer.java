@@ -0,0 +1,165 @@
+// This file is part of CPAchecker,
+// a tool for configurable software verification:
+// https://cpachecker.sosy-lab.org
+//
+// SPDX-FileCopyrightText: 2007-2020 Dirk Beyer <https://www.sosy-lab.org>
+//
+// SPDX-License-Identifier: Apache-2.0
+
+package org.sosy_lab.cpachecker.util.testcase;
+
+import com.google.common.collect.ImmutableSet;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Path;
+import java.util.Collection;
+import java.util.List;
+import org.sosy_lab.common.Appender;
+import org.sosy_lab.common.ShutdownNotifier;
+import org.sosy_lab.common.configuration.Configuration;
+import org.sosy_lab.common.configuration.ConfigurationBuilder;
+import org.sosy_lab.common.configuration.IntegerOption;
+import org.sosy_lab.common.configuration.InvalidConfigurationException;
+import org.sosy_lab.common.configuration.Option;
+import org.sosy_lab.common.configuration.Options;
+import org.sosy_lab.common.io.IO;
+import org.sosy_lab.common.io.TempFile;
+import org.sosy_lab.common.io.TempFile.DeleteOnCloseFile;
+import org.sosy_lab.common.log.LogManager;
+import org.sosy_lab.cpachecker.cfa.CFA;
+import org.sosy_lab.cpachecker.cfa.model.CFAEdge;
+import org.sosy_lab.cpachecker.cfa.model.CFANode;
+import org.sosy_lab.cpachecker.core.CoreComponentsFactory;
+import org.sosy_lab.cpachecker.core.interfaces.AbstractState;
+import org.sosy_lab.cpachecker.core.interfaces.ConfigurableProgramAnalysis;
+import org.sosy_lab.cpachecker.core.interfaces.Precision;
+import org.sosy_lab.cpachecker.core.interfaces.StateSpacePartition;
+import org.sosy_lab.cpachecker.core.interfaces.TransferRelation;
+import org.sosy_lab.cpachecker.core.reachedset.AggregatedReachedSets;
+import org.sosy_lab.cpachecker.core.specification.Specification;
+import org.sosy_lab.cpachecker.exceptions.CPAException;
+import org.sosy_lab.cpachecker.util.AbstractStates;
+import org.sosy_lab.cpachecker.util.CFAUtils;
+import org.sosy_lab.cpachecker.util.CPAs;
+
+/**
+ * Replays the inputs of a test case with a value analysis that follows the single program path
+ * determined by these inputs, and reports the edges that the test case covers.
+ *
+ * <p>The inputs are passed to the value analysis in the format of Test-Comp test cases (cf. {@link
+ * org.sosy_lab.cpachecker.cpa.value.TestCompTestcaseLoader}), so only the values of integer input
+ * functions are known.
+ */
+@Options(prefix = "testcase.replay")
+public class TestCaseReplayer {
+
+  @Option(
+      secure = true,
+      description = "maximal number of edges that are followed when replaying a test case")
+  @IntegerOption(min = 1)
+  private int maxSteps = 10000;
+
+  private final Configuration config;
+  private final LogManager logger;
+  private final ShutdownNotifier shutdownNotifier;
+  private final CFA cfa;
+
+  public TestCaseReplayer(
+      Configuration pConfig, LogManager pLogger, ShutdownNotifier pShutdownNotifier, CFA pCfa)
+      throws InvalidConfigurationException {
+    pConfig.inject(this);
+    config = pConfig;
+    logger = pLogger;
+    shutdownNotifier = pShutdownNotifier;
+    cfa = pCfa;
+  }
+
+  /**
+   * Return the edges that an execution with the given inputs passes. The replay stops at the
+   * first point where the execution is not determined by the inputs, e.g., because there are
+   * fewer inputs than calls to input functions, so the result may belong to a prefix of the
+   * execution only.
+   */
+  public ImmutableSet<CFAEdge> getCoveredEdges(List<String> pInputs)
+      throws CPAException, InterruptedException {
+    try (DeleteOnCloseFile inputFile =
+        TempFile.builder().prefix("testcase-replay").suffix(".xml").createDeleteOnClose()) {
+      IO.writeFile(
+          inputFile.toPath(), StandardCharsets.UTF_8, (Appender) out -> writeInputs(out, pInputs));
+
+      ConfigurableProgramAnalysis replayCpa = createReplayCpa(inputFile.toPath());
+      try {
+        return followExecution(replayCpa);
+      } finally {
+        CPAs.closeCpaIfPossible(replayCpa, logger);
+      }
+
+    } catch (IOException e) {
+      throw new CPAException("Could not write inputs for replaying test case", e);
+    } catch (InvalidConfigurationException e) {
+      throw new CPAException("Could not create analysis for replaying test case", e);
+    }
+  }
+
+  private static void writeInputs(Appendable pOut, List<String> pInputs) throws IOException {
+    pOut.append("<testcase>\n");
+    for (String input : pInputs) {
+      pOut.append("  <input>").append(input).append("</input>\n");
+    }
+    pOut.append("</testcase>\n");
+  }
+
+  private ConfigurableProgramAnalysis createReplayCpa(Path pInputFile)
+      throws InvalidConfigurationException, CPAException {
+    ConfigurationBuilder replayConfig =
+        Configuration.builder()
+            .setOption("cpa", "cpa.composite.CompositeCPA")
+            .setOption(
+                "CompositeCPA.cpas",
+                "cpa.location.LocationCPA, cpa.callstack.CallstackCPA, "
+                    + "cpa.value.ValueAnalysisCPA")
+            .setOption("cpa.value.ignoreFunctionValueExceptRandom", "true")
+            .setOption("cpa.value.functionValuesForRandom", pInputFile.toString());
+    replayConfig.copyOptionFromIfPresent(config, "analysis.machineModel");
+
+    CoreComponentsFactory factory =
+        new CoreComponentsFactory(
+            replayConfig.build(), logger, shutdownNotifier, new AggregatedReachedSets());
+    return factory.createCPA(cfa, Specification.alwaysSatisfied());
+  }
+
+  private ImmutableSet<CFAEdge> followExecution(ConfigurableProgramAnalysis pCpa)
+      throws CPAException, InterruptedException {
+    CFANode entryNode = cfa.getMainFunction();
+    StateSpacePartition partition = StateSpacePartition.getDefaultPartition();
+    AbstractState state = pCpa.getInitialState(entryNode, partition);
+    Precision precision = pCpa.getInitialPrecision(entryNode, partition);
+    TransferRelation transfer = pCpa.getTransferRelation();
+
+    ImmutableSet.Builder<CFAEdge> coveredEdges = ImmutableSet.builder();
+    for (int step = 0; step < maxSteps; step++) {
+      shutdownNotifier.shutdownIfNecessary();
+      AbstractState next = null;
+      CFAEdge nextEdge = null;
+      for (CFAEdge edge : CFAUtils.leavingEdges(AbstractStates.extractLocation(state))) {
+        Collection<? extends AbstractState> successors =
+            transfer.getAbstractSuccessorsForEdge(state, precision, edge);
+        for (AbstractState successor : successors) {
+          if (next != null) {
+            // the execution is not determined by the inputs from here on
+            return coveredEdges.build();
+          }
+          next = successor;
+          nextEdge = edge;
+        }
+      }
+      if (next == null) {
+        // the program terminated
+        break;
+      }
+      coveredEdges.add(nextEdge);
+      state = next;
+    }
+    return coveredEdges.build();
+  }
+}
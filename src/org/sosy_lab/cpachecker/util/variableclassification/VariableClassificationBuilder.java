@@ -14,13 +14,15 @@ import static org.sosy_lab.cpachecker.util.CFAUtils.leavingEdges;
 
 import com.google.common.base.Joiner;
 import com.google.common.base.Optional;
+import com.google.common.base.Throwables;
 import com.google.common.collect.HashMultiset;
 import com.google.common.collect.ImmutableMultimap;
 import com.google.common.collect.ImmutableSet;
-import com.google.common.collect.Iterables;
 import com.google.common.collect.Multimap;
+import com.google.common.collect.Multimaps;
 import com.google.common.collect.Multiset;
 import com.google.common.collect.Sets;
+import com.google.common.util.concurrent.ThreadFactoryBuilder;
 import java.io.IOException;
 import java.io.PrintStream;
 import java.io.Writer;
@@ -28,14 +30,20 @@ import java.math.BigInteger;
 import java.nio.charset.Charset;
 import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.util.ArrayList;
 import java.util.Collection;
 import java.util.HashSet;
 import java.util.List;
 import java.util.Set;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.logging.Level;
 import org.checkerframework.checker.nullness.qual.Nullable;
 import org.sosy_lab.common.configuration.Configuration;
 import org.sosy_lab.common.configuration.FileOption;
+import org.sosy_lab.common.configuration.IntegerOption;
 import org.sosy_lab.common.configuration.InvalidConfigurationException;
 import org.sosy_lab.common.configuration.Option;
 import org.sosy_lab.common.configuration.Options;
@@ -106,6 +114,14 @@ public class VariableClassificationBuilder implements StatisticsProvider {
   @Option(secure=true, description = "Print some information about the variable classification.")
   private boolean printStatsOnStartup = false;
 
+  @Option(
+      secure = true,
+      description =
+          "Number of threads for computing which variables and fields are relevant or addressed."
+              + " With more than one thread, this is done for each function in parallel.")
+  @IntegerOption(min = 1)
+  private int threads = 1;
+
   /**
    * Use {@link FunctionEntryNode#getReturnVariable()} and
    * {@link AReturnStatement#asAssignment()} instead.
@@ -124,6 +140,9 @@ public class VariableClassificationBuilder implements StatisticsProvider {
 
   private final Dependencies dependencies = new Dependencies();
 
+  private final Multiset<String> assumedVariables = HashMultiset.create();
+  private final Multiset<String> assignedVariables = HashMultiset.create();
+
   private Optional<Set<String>> relevantVariables = Optional.absent();
   private Optional<Multimap<CCompositeType, String>> relevantFields = Optional.absent();
   private Optional<Multimap<CCompositeType, String>> addressedFields = Optional.absent();
@@ -173,7 +192,8 @@ public class VariableClassificationBuilder implements StatisticsProvider {
   /** This function does the whole work:
    * creating all maps, collecting vars, solving dependencies.
    * The function runs only once, after that it does nothing. */
-  public VariableClassification build(CFA cfa) throws UnrecognizedCodeException {
+  public VariableClassification build(CFA cfa)
+      throws UnrecognizedCodeException, InterruptedException {
     checkArgument(cfa.getLanguage() == Language.C, "VariableClassification currently only supports C");
 
     stats.variableClassificationTimer.start();
@@ -250,8 +270,8 @@ public class VariableClassificationBuilder implements StatisticsProvider {
             intEqualPartitions,
             intAddPartitions,
             dependencies.edgeToPartition,
-            extractAssumedVariables(cfa.getAllNodes()),
-            extractAssignedVariables(cfa.getAllNodes()),
+            assumedVariables,
+            assignedVariables,
             logger);
     stats.buildTimer.stop();
 
@@ -393,19 +413,60 @@ public class VariableClassificationBuilder implements StatisticsProvider {
     return Sets.intersection(ofVars, relevantVariables.get()).size();
   }
 
-  /** This function iterates over all edges of the cfa, collects all variables
-   * and orders them into different sets, i.e. nonBoolean and nonIntEuqalNumber. */
-  private void collectVars(CFA cfa) throws UnrecognizedCodeException {
-    Collection<CFANode> nodes = cfa.getAllNodes();
+  /**
+   * This function iterates over all edges of the cfa, collects all variables and orders them into
+   * different sets, i.e. nonBoolean and nonIntEuqalNumber. All information is collected in a
+   * single pass over the edges. The relevancy of variables and fields does not depend on shared
+   * state, so if more than one thread is configured, it is computed separately for each function
+   * in parallel to the rest and merged afterwards.
+   */
+  private void collectVars(CFA cfa) throws UnrecognizedCodeException, InterruptedException {
     VarFieldDependencies varFieldDependencies = VarFieldDependencies.emptyDependencies();
-    for (CFANode node : nodes) {
-      for (CFAEdge edge : leavingEdges(node)) {
-        handleEdge(edge, cfa);
-        varFieldDependencies =
-            varFieldDependencies.withDependencies(
-                VariableAndFieldRelevancyComputer.handleEdge(cfa, edge));
+    List<Future<VarFieldDependencies>> futures = new ArrayList<>();
+    ExecutorService executor = null;
+    try {
+      if (threads > 1) {
+        executor =
+            Executors.newFixedThreadPool(
+                threads,
+                new ThreadFactoryBuilder()
+                    .setDaemon(true)
+                    .setNameFormat("variable-classification-%d")
+                    .build());
+        for (Collection<CFANode> functionNodes :
+            Multimaps.index(cfa.getAllNodes(), CFANode::getFunctionName).asMap().values()) {
+          futures.add(executor.submit(() -> collectVarFieldDependencies(cfa, functionNodes)));
+        }
+      }
+
+      for (CFANode node : cfa.getAllNodes()) {
+        for (CFAEdge edge : leavingEdges(node)) {
+          handleEdge(edge, cfa);
+          collectAssumedAndAssignedVariables(edge);
+          if (executor == null) {
+            varFieldDependencies =
+                varFieldDependencies.withDependencies(
+                    VariableAndFieldRelevancyComputer.handleEdge(cfa, edge));
+          }
+        }
+      }
+
+      for (Future<VarFieldDependencies> future : futures) {
+        try {
+          varFieldDependencies = varFieldDependencies.withDependencies(future.get());
+        } catch (ExecutionException e) {
+          Throwable cause = e.getCause();
+          Throwables.throwIfInstanceOf(cause, UnrecognizedCodeException.class);
+          Throwables.throwIfUnchecked(cause);
+          throw new AssertionError("Unexpected exception during variable classification", cause);
+        }
+      }
+    } finally {
+      if (executor != null) {
+        executor.shutdownNow();
       }
     }
+
     addressedVariables = Optional.of(varFieldDependencies.computeAddressedVariables());
     addressedFields = Optional.of(varFieldDependencies.computeAddressedFields());
     final Pair<ImmutableSet<String>, ImmutableMultimap<CCompositeType, String>> relevant =
@@ -414,49 +475,38 @@ public class VariableClassificationBuilder implements StatisticsProvider {
     relevantFields = Optional.of(relevant.getSecond());
   }
 
-  /**
-   * This method extracts all variables (i.e., their qualified name), that occur in an assumption.
-   */
-  private Multiset<String> extractAssumedVariables(Collection<CFANode> nodes) {
-    Multiset<String> assumeVariables = HashMultiset.create();
-
+  private static VarFieldDependencies collectVarFieldDependencies(
+      CFA cfa, Collection<CFANode> nodes) throws UnrecognizedCodeException {
+    VarFieldDependencies varFieldDependencies = VarFieldDependencies.emptyDependencies();
     for (CFANode node : nodes) {
-      for (CAssumeEdge edge : Iterables.filter(leavingEdges(node), CAssumeEdge.class)) {
-        assumeVariables.addAll(
-            CFAUtils.getIdExpressionsOfExpression(edge.getExpression())
-                .transform(id -> id.getDeclaration().getQualifiedName())
-                .toSet());
+      for (CFAEdge edge : leavingEdges(node)) {
+        varFieldDependencies =
+            varFieldDependencies.withDependencies(
+                VariableAndFieldRelevancyComputer.handleEdge(cfa, edge));
       }
     }
-
-    return assumeVariables;
+    return varFieldDependencies;
   }
 
   /**
-   * This method extracts all variables (i.e., their qualified name), that occur
-   * as left-hand side in an assignment.
+   * This method extracts all variables (i.e., their qualified name), that occur in an assumption
+   * or as left-hand side in an assignment of the given edge.
    */
-  private Multiset<String> extractAssignedVariables(Collection<CFANode> nodes) {
-    Multiset<String> assignedVariables = HashMultiset.create();
-
-    for (CFANode node : nodes) {
-      for (CFAEdge leavingEdge : leavingEdges(node)) {
-        if (leavingEdge instanceof AStatementEdge) {
-          AStatementEdge edge = (AStatementEdge) leavingEdge;
-          if (!(edge.getStatement() instanceof CAssignment)) {
-            continue;
-          }
-
-          CAssignment assignment = (CAssignment) edge.getStatement();
-          assignedVariables.addAll(
-              CFAUtils.getIdExpressionsOfExpression(assignment.getLeftHandSide())
-                  .transform(id -> id.getDeclaration().getQualifiedName())
-                  .toSet());
-        }
-      }
+  private void collectAssumedAndAssignedVariables(CFAEdge edge) {
+    if (edge instanceof CAssumeEdge) {
+      assumedVariables.addAll(
+          CFAUtils.getIdExpressionsOfExpression(((CAssumeEdge) edge).getExpression())
+              .transform(id -> id.getDeclaration().getQualifiedName())
+              .toSet());
+
+    } else if (edge instanceof AStatementEdge
+        && ((AStatementEdge) edge).getStatement() instanceof CAssignment) {
+      CAssignment assignment = (CAssignment) ((AStatementEdge) edge).getStatement();
+      assignedVariables.addAll(
+          CFAUtils.getIdExpressionsOfExpression(assignment.getLeftHandSide())
+              .transform(id -> id.getDeclaration().getQualifiedName())
+              .toSet());
     }
-
-    return assignedVariables;
   }
 
   /** switch to edgeType and handle all expressions, that could be part of the edge. */